@@ -0,0 +1,81 @@
+// Host benchmark: legacy strcasecmp chain vs the FED4_Colors.h registry.
+//
+//   g++ -O2 -std=c++17 -I src scripts/color-bench.cpp -o /tmp/color-bench && /tmp/color-bench
+//
+// Names come through a volatile index so the compiler cannot fold the runtime
+// paths; FED4_COLOR() is shown for comparison (a constant, no lookup at all).
+
+#include <chrono>
+#include <cstdio>
+#include <strings.h>
+
+#include "FED4_Colors.h"
+
+static volatile uint32_t gSink = 0;
+
+// ── legacy getColorFromString (pre-FED4_Colors) ─────────────────────────────
+
+static uint32_t legacyColor(const char *colorName)
+{
+    if (strcasecmp(colorName, "red") == 0)
+        return 0xFF0000;
+    if (strcasecmp(colorName, "green") == 0)
+        return 0x008000;
+    if (strcasecmp(colorName, "blue") == 0)
+        return 0x0000FF;
+    if (strcasecmp(colorName, "white") == 0)
+        return 0xFFFFFF;
+    if (strcasecmp(colorName, "black") == 0)
+        return 0x000000;
+    if (strcasecmp(colorName, "yellow") == 0)
+        return 0xFFFF00;
+    if (strcasecmp(colorName, "purple") == 0)
+        return 0x800080;
+    if (strcasecmp(colorName, "cyan") == 0)
+        return 0x00FFFF;
+    if (strcasecmp(colorName, "orange") == 0)
+        return 0xFFA500;
+    return 0x000000;
+}
+
+// Registry order plus mixed case and misses (meta.json is user-edited)
+static const char *const kNames[] = {"red", "Green", "blue", "WHITE", "black", "yellow",
+                                     "purple", "cyan", "Orange", "magenta", "", "reds"};
+static constexpr size_t kNameCount = sizeof(kNames) / sizeof(kNames[0]);
+static constexpr uint32_t kIters = 20000000;
+
+template <typename F>
+static double bench(const char *label, F lookup)
+{
+    volatile size_t idx = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kIters; i++)
+    {
+        gSink = gSink + lookup(kNames[idx]);
+        idx = idx + 1 == kNameCount ? 0 : idx + 1;
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / kIters;
+    printf("%-22s %7.2f ns/lookup\n", label, ns);
+    return ns;
+}
+
+int main()
+{
+    // Same answers for every name, including the misses
+    for (const char *name : kNames)
+    {
+        if (legacyColor(name) != fed4Color(name))
+        {
+            printf("MISMATCH for \"%s\"\n", name);
+            return 1;
+        }
+    }
+
+    printf("perfect hash: %zu names, %u slots, seed %u\n", FED4_COLOR_COUNT,
+           (unsigned)FedColorHashTable::kSlots, (unsigned)kFedColorHash.seed);
+    const double legacy = bench("strcasecmp chain", legacyColor);
+    const double hashed = bench("perfect hash", fed4Color);
+    bench("FED4_COLOR literal", [](const char *) { return FED4_COLOR("orange"); });
+    printf("speedup (runtime names): %.1fx\n", legacy / hashed);
+    return 0;
+}
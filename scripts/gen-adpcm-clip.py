@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Encode a 48 kHz mono 16-bit clip as IMA-ADPCM (4:1) for FED4 playback.
+
+Usage:
+  python3 scripts/gen-adpcm-clip.py <input.wav|pcm_header.h> --header src/sounds/startup_sound.h --name STARTUP
+  python3 scripts/gen-adpcm-clip.py <input.wav|pcm_header.h> --wav cue.wav
+
+--header emits a C header (uint8_t <NAME>_ADPCM[] in flash) for playAdpcmAsync().
+--wav emits a standard IMA-ADPCM WAV (format 0x11) to copy onto the SD card
+and load with loadAudioClip(). Plain 16-bit PCM WAVs load too, at 4x the size.
+
+The input may be a WAV already at 48 kHz mono 16-bit, or a legacy PCM header
+(int16_t array as written by examples/.../sounds/gen_startup_sound.py).
+Blocks match the Microsoft IMA layout the decoder in src/FED4_Adpcm.h reads:
+4-byte header (first sample, step index, 0) then packed nibbles, low first.
+"""
+
+import argparse
+import math
+import re
+import struct
+import sys
+import wave
+from pathlib import Path
+
+SAMPLE_RATE = 48000
+BLOCK_ALIGN = 256  # bytes per block → 505 samples
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+
+
+def samples_per_block(block_align: int) -> int:
+    return (block_align - 4) * 2 + 1
+
+
+def step_nibble(pred: int, index: int, nib: int):
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if nib & 4:
+        diff += step
+    if nib & 2:
+        diff += step >> 1
+    if nib & 1:
+        diff += step >> 2
+    pred = pred - diff if nib & 8 else pred + diff
+    pred = max(-32768, min(32767, pred))
+    index = max(0, min(88, index + INDEX_TABLE[nib]))
+    return pred, index
+
+
+def encode_sample(sample: int, pred: int, index: int) -> int:
+    step = STEP_TABLE[index]
+    diff = sample - pred
+    nib = 0
+    if diff < 0:
+        nib = 8
+        diff = -diff
+    if diff >= step:
+        nib |= 4
+        diff -= step
+    step >>= 1
+    if diff >= step:
+        nib |= 2
+        diff -= step
+    step >>= 1
+    if diff >= step:
+        nib |= 1
+    return nib
+
+
+def encode(pcm, block_align: int = BLOCK_ALIGN) -> bytes:
+    spb = samples_per_block(block_align)
+    out = bytearray()
+    index = 0
+    for start in range(0, len(pcm), spb):
+        block = list(pcm[start : start + spb])
+        block += [block[-1]] * (spb - len(block))  # pad the tail block
+        pred = block[0]
+        out += struct.pack("<hBB", pred, index, 0)
+        nibbles = []
+        for s in block[1:]:
+            nib = encode_sample(s, pred, index)
+            pred, index = step_nibble(pred, index, nib)
+            nibbles.append(nib)
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+    return bytes(out)
+
+
+def decode(data: bytes, samples: int, block_align: int = BLOCK_ALIGN):
+    out = []
+    for off in range(0, len(data), block_align):
+        pred, index, _ = struct.unpack_from("<hBB", data, off)
+        out.append(pred)
+        for b in data[off + 4 : off + block_align]:
+            for nib in (b & 0x0F, b >> 4):
+                pred, index = step_nibble(pred, index, nib)
+                out.append(pred)
+    return out[:samples]
+
+
+def read_input(path: Path):
+    if path.suffix.lower() == ".h":
+        text = path.read_text()
+        body = text[text.index("{") + 1 : text.rindex("}")]
+        return [int(v) for v in re.findall(r"-?\d+", body)]
+    with wave.open(str(path), "rb") as w:
+        ch, sw, rate, nframes, _, _ = w.getparams()
+        if ch != 1 or sw != 2 or rate != SAMPLE_RATE:
+            sys.exit(f"Expected 1ch 16-bit {SAMPLE_RATE} Hz, got {ch}ch {sw * 8}-bit {rate} Hz")
+        raw = w.readframes(nframes)
+    return list(struct.unpack("<" + "h" * (len(raw) // 2), raw))
+
+
+def write_header(out: Path, name: str, data: bytes, samples: int) -> None:
+    with out.open("w") as h:
+        h.write("// Auto-generated — do not edit by hand.\n")
+        h.write(f"// python3 scripts/gen-adpcm-clip.py <source.wav> --header {out.as_posix()} --name {name}\n")
+        h.write("// IMA-ADPCM, 48 kHz mono, Microsoft block layout (see src/FED4_Adpcm.h)\n\n")
+        h.write("#pragma once\n\n")
+        h.write("#include <Arduino.h>\n\n")
+        h.write(f"static const uint32_t {name}_ADPCM_RATE = {SAMPLE_RATE};\n")
+        h.write(f"static const uint32_t {name}_ADPCM_SAMPLES = {samples};\n")
+        h.write(f"static const uint16_t {name}_ADPCM_BLOCK_ALIGN = {BLOCK_ALIGN};\n\n")
+        h.write(f"static const uint8_t {name}_ADPCM[] PROGMEM = {{\n")
+        for i in range(0, len(data), 16):
+            h.write("  " + ", ".join(f"0x{b:02x}" for b in data[i : i + 16]) + ",\n")
+        h.write("};\n")
+
+
+def write_wav(out: Path, data: bytes, samples: int) -> None:
+    spb = samples_per_block(BLOCK_ALIGN)
+    byte_rate = SAMPLE_RATE * BLOCK_ALIGN // spb
+    fmt = struct.pack("<HHIIHHHH", 0x11, 1, SAMPLE_RATE, byte_rate, BLOCK_ALIGN, 4, 2, spb)
+    fact = struct.pack("<I", samples)
+    riff = b"WAVE"
+    riff += b"fmt " + struct.pack("<I", len(fmt)) + fmt
+    riff += b"fact" + struct.pack("<I", len(fact)) + fact
+    riff += b"data" + struct.pack("<I", len(data)) + data
+    out.write_bytes(b"RIFF" + struct.pack("<I", len(riff)) + riff)
+
+
+def main() -> None:
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input", type=Path)
+    ap.add_argument("--header", type=Path, help="write a C header for flash")
+    ap.add_argument("--name", default="STARTUP", help="symbol prefix for --header")
+    ap.add_argument("--wav", type=Path, help="write an IMA-ADPCM WAV for the SD card")
+    args = ap.parse_args()
+    if not args.header and not args.wav:
+        ap.error("give --header and/or --wav")
+
+    pcm = read_input(args.input)
+    data = encode(pcm)
+
+    # Round-trip check so a bad encode never ships silently
+    dec = decode(data, len(pcm))
+    sig = sum(s * s for s in pcm) or 1
+    err = sum((a - b) ** 2 for a, b in zip(pcm, dec)) or 1
+    print(f"{len(pcm)} samples ({len(pcm) / SAMPLE_RATE:.2f} s): "
+          f"PCM {len(pcm) * 2} B → ADPCM {len(data)} B, SNR {10 * math.log10(sig / err):.1f} dB")
+
+    if args.header:
+        write_header(args.header, args.name, data, len(pcm))
+        print(f"Wrote {args.header}")
+    if args.wav:
+        write_wav(args.wav, data, len(pcm))
+        print(f"Wrote {args.wav}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+// Host benchmark: legacy per-sample sin()/float synthesis vs FedToneGen (src/FED4_Synth.h).
+//
+//   g++ -O2 -std=c++17 -I src scripts/synth-bench.cpp -o /tmp/synth-bench && /tmp/synth-bench
+//
+// Both paths fill 256-sample chunks exactly like FED4_Audio.cpp; the I2S write
+// is replaced by a checksum so the compiler cannot drop the work.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "FED4_Synth.h"
+
+static constexpr uint32_t kRate = 48000;
+static constexpr size_t kChunk = 256;
+static constexpr uint32_t kSeconds = 20; // of audio per run
+
+static volatile int64_t gSink = 0;
+
+static void consume(const int16_t *buf, size_t n)
+{
+    int64_t acc = 0;
+    for (size_t i = 0; i < n; i++)
+        acc += buf[i];
+    gSink = gSink + acc;
+}
+
+// ── legacy (pre-FED4_Synth) loops ────────────────────────────────────────────
+
+static void legacySine(uint32_t frequency, uint32_t samples, float amplitude)
+{
+    const float twoPiF = 2.0 * M_PI * frequency;
+    int16_t buf[kChunk];
+    size_t inBuf = 0;
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        float sample = amplitude * sin((twoPiF * i) / kRate);
+        buf[inBuf++] = (int16_t)(sample * 32767);
+        if (inBuf >= kChunk)
+        {
+            consume(buf, inBuf);
+            inBuf = 0;
+        }
+    }
+    consume(buf, inBuf);
+}
+
+static void legacySquare(uint32_t frequency, uint32_t samples, float amplitude)
+{
+    const uint32_t fade = (kRate * 2) / 1000;
+    const float halfPeriod = (float)kRate / (2.0f * (float)frequency);
+    int16_t buf[kChunk];
+    size_t inBuf = 0;
+    float phase = 0.0f;
+    int sign = 1;
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        float env = 1.0f;
+        if (i < fade)
+            env = (float)i / (float)fade;
+        else if (i > samples - fade)
+            env = (float)(samples - i) / (float)fade;
+        buf[inBuf++] = (int16_t)(sign * amplitude * env * 32767.0f);
+        phase += 1.0f;
+        if (phase >= halfPeriod)
+        {
+            phase -= halfPeriod;
+            sign = -sign;
+        }
+        if (inBuf >= kChunk)
+        {
+            consume(buf, inBuf);
+            inBuf = 0;
+        }
+    }
+    consume(buf, inBuf);
+}
+
+static void legacyNoise(uint32_t samples, float amplitude)
+{
+    int16_t buf[kChunk];
+    size_t inBuf = 0;
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        float sample = (((float)(rand() % 65536) / 32768.0f) - 1.0f) * amplitude;
+        buf[inBuf++] = (int16_t)(sample * 32767);
+        if (inBuf >= kChunk)
+        {
+            consume(buf, inBuf);
+            inBuf = 0;
+        }
+    }
+    consume(buf, inBuf);
+}
+
+// ── FedToneGen ───────────────────────────────────────────────────────────────
+
+static void synth(FedWave wave, uint32_t frequency, uint32_t samples, float amplitude)
+{
+    FedToneGen gen;
+    gen.start(wave, frequency, samples, FedToneGen::amplitudeQ15(amplitude), (kRate * 2) / 1000, kRate);
+    int16_t buf[kChunk];
+    size_t n;
+    while ((n = gen.fill(buf, kChunk)) != 0)
+        consume(buf, n);
+}
+
+template <typename F>
+static double samplesPerSecond(uint32_t samples, F &&fn)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    fn();
+    const auto t1 = std::chrono::steady_clock::now();
+    const double s = std::chrono::duration<double>(t1 - t0).count();
+    return samples / s;
+}
+
+static void report(const char *name, double legacy, double fixed)
+{
+    printf("%-7s legacy %8.1f Msps   synth %8.1f Msps   x%.1f   (%.0fx / %.0fx real time)\n", name,
+           legacy / 1e6, fixed / 1e6, fixed / legacy, legacy / kRate, fixed / kRate);
+}
+
+int main()
+{
+    const uint32_t n = kRate * kSeconds;
+
+    report("sine", samplesPerSecond(n, [&] { legacySine(1000, n, 0.25f); }),
+           samplesPerSecond(n, [&] { synth(FedWave::Sine, 1000, n, 0.25f); }));
+    report("square", samplesPerSecond(n, [&] { legacySquare(1000, n, 0.3f); }),
+           samplesPerSecond(n, [&] { synth(FedWave::Square, 1000, n, 0.3f); }));
+    report("noise", samplesPerSecond(n, [&] { legacyNoise(n, 1.0f); }),
+           samplesPerSecond(n, [&] { synth(FedWave::Noise, 0, n, 1.0f); }));
+
+    // Accuracy of the interpolated LUT against libm
+    FedToneGen gen;
+    gen.start(FedWave::Sine, 997, kRate, 32767, 0, kRate);
+    int16_t buf[kChunk];
+    int maxErr = 0;
+    uint32_t i = 0;
+    size_t got;
+    while ((got = gen.fill(buf, kChunk)) != 0)
+    {
+        for (size_t k = 0; k < got; k++, i++)
+        {
+            const int ref = (int)lround(32767.0 * sin(2.0 * M_PI * 997.0 * i / kRate));
+            const int err = abs(ref - buf[k]);
+            if (err > maxErr)
+                maxErr = err;
+        }
+    }
+    printf("sine max |error| vs libm: %d LSB (checksum %lld)\n", maxErr, (long long)gSink);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Host test: FedTimeUs / FedClockModel (src/FED4_Time.h) over multi-month runs.
+//
+//   g++ -O2 -std=c++17 -I src scripts/timebase-test.cpp -o /tmp/timebase-test && /tmp/timebase-test
+//
+// Simulates a device that boots, anchors on a DS3231 seconds tick and then
+// logs for 150 days — three 32-bit millis() wraps — with the internal clock
+// running off-rate. The DS3231 is read every 10 min, as updateTime() does.
+// Exit status is the number of failed checks.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "FED4_Time.h"
+
+static constexpr int64_t kSecUs = 1000000LL;
+static constexpr int64_t kDayUs = 86400LL * kSecUs;
+static constexpr int64_t kSyncUs = 600LL * kSecUs;            // rtcSyncPeriodS default
+static constexpr int64_t kMinBaselineUs = 3600LL * kSecUs;    // as FED4_RTC.cpp
+static constexpr int64_t kWrapUs = (int64_t)(1ULL << 32) * 1000; // millis() wraps here
+static constexpr int kDays = 150;
+
+static int gFailures = 0;
+
+static void check(bool ok, const char *what)
+{
+    printf("  %-4s %s\n", ok ? "ok" : "FAIL", what);
+    if (!ok)
+        gFailures++;
+}
+
+// ── reference clock ──────────────────────────────────────────────────────────
+
+/** True Unix µs at FedTimeUs t for an internal clock ppm fast, true second edge at unix0 when t = t0. */
+struct TrueClock
+{
+    FedTimeUs t0;
+    int64_t unix0Us;
+    double ppm;
+
+    int64_t unixUs(FedTimeUs t) const { return unix0Us + (int64_t)llround((double)(t - t0) / (1.0 + ppm * 1e-6)); }
+    uint32_t seconds(FedTimeUs t) const { return (uint32_t)(unixUs(t) / kSecUs); }
+    /** First FedTimeUs (≥ t) at which the DS3231 shows a new second. */
+    FedTimeUs nextTick(FedTimeUs t) const
+    {
+        const uint32_t s = seconds(t);
+        while (seconds(t) == s)
+            t += 100;
+        return t;
+    }
+};
+
+// ── wall-clock discipline ────────────────────────────────────────────────────
+
+static void runDiscipline(double ppm)
+{
+    printf("internal clock %+.0f ppm, %d days, DS3231 read every %lld s\n", ppm, kDays,
+           (long long)(kSyncUs / kSecUs));
+    const TrueClock ref = {2 * kSecUs, 1767225600LL * kSecUs + 370000, ppm}; // boot 0.37 s into a second
+
+    FedClockModel model;
+    FedTimeUs t = ref.nextTick(ref.t0); // initializeRTC(): syncClock(true) waits for the tick
+    model.anchor(t, (int64_t)ref.seconds(t) * kSecUs);
+
+    const FedTimeUs end = t + kDays * kDayUs;
+    FedTimeUs nextSync = t + kSyncUs;
+    int64_t maxErrUs = 0, maxErrSettledUs = 0, maxBackUs = 0, prevUnix = model.toUnixUs(t);
+    uint32_t syncs = 0, steps = 0, backwards = 0;
+    for (; t < end; t += 10 * kSecUs) // a log row every 10 s
+    {
+        if (t >= nextSync)
+        {
+            syncs++;
+            if (model.discipline(t, ref.seconds(t), kMinBaselineUs) != 0)
+                steps++;
+            nextSync += kSyncUs;
+        }
+        const int64_t unix = model.toUnixUs(t);
+        const int64_t err = std::llabs(unix - ref.unixUs(t));
+        if (err > maxErrUs)
+            maxErrUs = err;
+        if (t - ref.t0 > 2 * kDayUs && err > maxErrSettledUs)
+            maxErrSettledUs = err;
+        if (unix < prevUnix)
+        {
+            backwards++;
+            if (prevUnix - unix > maxBackUs)
+                maxBackUs = prevUnix - unix;
+        }
+        prevUnix = unix;
+    }
+    printf("  %u syncs, %u corrections, drift estimate %+.2f ppm, max error %.3f s (%.3f s after day 2)\n",
+           syncs, steps, model.driftPpm, maxErrUs / 1e6, maxErrSettledUs / 1e6);
+    printf("  %u backward steps, largest %.3f s\n", backwards, maxBackUs / 1e6);
+
+    // Bounded by the DS3231's 1 s resolution plus what the residual rate adds in one sync period
+    const double bound = 1.0 + std::fabs(model.driftPpm - ppm) * 1e-6 * (kSyncUs / 1e6) + 0.01;
+    check(maxErrSettledUs / 1e6 <= bound, "wall time stays within the DS3231 second after day 2");
+    check(std::fabs(model.driftPpm - ppm) < 10.0, "drift estimate within 10 ppm of the true rate");
+    check(maxBackUs <= kSecUs, "any backward correction is under 1 s");
+}
+
+// ── 32-bit wrap ──────────────────────────────────────────────────────────────
+
+static void runWrap()
+{
+    printf("millis() wrap at %.2f days\n", kWrapUs / (double)kDayUs);
+    int naiveWrong = 0, fedWrong = 0, intervalWrong = 0;
+    for (int wrap = 1; wrap <= 3; wrap++) // 49.7, 99.4, 149.1 days
+    {
+        for (int64_t offsetMs = -19750; offsetMs <= 20000; offsetMs += 250)
+        {
+            // A pellet in the well 20 s before the wrap point, taken offsetMs + 20 s later
+            const FedTimeUs wellUs = wrap * kWrapUs - 20000 * 1000LL;
+            const FedTimeUs takenUs = wrap * kWrapUs + offsetMs * 1000LL;
+            const uint32_t wellMs = fedMs32(wellUs), takenMs = fedMs32(takenUs);
+            if (!(takenMs > wellMs)) // ordering on millis() values, as a naive check would
+                naiveWrong++;
+            if (!(takenUs > wellUs))
+                fedWrong++;
+            if ((uint32_t)(takenMs - wellMs) != (uint32_t)((takenUs - wellUs) / 1000))
+                intervalWrong++;
+        }
+    }
+    printf("  naive millis() ordering wrong %d times; FedTimeUs ordering wrong %d times\n", naiveWrong, fedWrong);
+    check(naiveWrong > 0, "the simulation does cross the wrap");
+    check(fedWrong == 0, "FedTimeUs orders events across every wrap");
+    check(intervalWrong == 0, "unsigned fedMs32() differences stay right across the wrap");
+}
+
+// ── ElapsedSeconds precision ─────────────────────────────────────────────────
+
+static void runElapsed()
+{
+    printf("ElapsedSeconds column over %d days\n", kDays);
+    double worstFloat = 0;
+    int formatWrong = 0;
+    char text[32];
+    for (FedTimeUs t = 0; t < kDays * kDayUs; t += 7 * 3600 * kSecUs + 123457)
+    {
+        const double exact = (double)(t / 1000) / 1000.0; // ms resolution
+        const float legacy = (float)(llround(t / 1000.0)) / 1000.0f;
+        if (std::fabs((double)legacy - exact) > worstFloat)
+            worstFloat = std::fabs((double)legacy - exact);
+        fedFormatSeconds(text, sizeof(text), t);
+        long long sec = 0;
+        int ms = 0;
+        if (sscanf(text, "%lld.%d", &sec, &ms) != 2 || sec * 1000 + ms != t / 1000)
+            formatWrong++;
+    }
+    printf("  float seconds off by up to %.3f s; fedFormatSeconds exact in all but %d rows\n", worstFloat, formatWrong);
+    check(worstFloat > 0.1, "float ElapsedSeconds really does lose precision");
+    check(formatWrong == 0, "fedFormatSeconds is exact to the ms");
+}
+
+int main()
+{
+    runDiscipline(0.0);
+    runDiscipline(+180.0);  // a warm ESP32 RTC slow clock
+    runDiscipline(-1500.0); // an uncalibrated one
+    runWrap();
+    runElapsed();
+    printf("%s (%d failed)\n", gFailures ? "FAIL" : "PASS", gFailures);
+    return gFailures;
+}
@@ -23,8 +23,7 @@ Please support them!
 /**
  * Constructor for FED4 class
  */
-FED4::FED4() : Adafruit_GFX(DISPLAY_WIDTH, DISPLAY_HEIGHT),
-               stepper(MOTOR_STEPS, MOTOR_PIN_1, MOTOR_PIN_3, MOTOR_PIN_2, MOTOR_PIN_4)
+FED4::FED4() : Adafruit_GFX(DISPLAY_WIDTH, DISPLAY_HEIGHT)
 #ifndef FED4_EXCLUDE_HUBLINK
                ,
                hublink(SD_CS)
@@ -64,11 +63,109 @@ FED4::FED4() : Adafruit_GFX(DISPLAY_WIDTH, DISPLAY_HEIGHT),
  ********************************************************/
 void FED4::update()
 {
+    lastUpdateSavedUs = 0;
+
     updateTime();
-    refreshSensors();
-    updateDisplay();
-    serialStatusReport();
+    fed4Trace(FedTracePoint::UpdateTime);
+    servicePhotogates();
+    if (stagingInFlight && motorIdle())
+        finishStaging(true);
+    fed4Trace(FedTracePoint::UpdatePhotogates);
+    updateLanes();
+    updateAccelActivity();
+    serviceMotionWindow();
+    fed4Trace(FedTracePoint::UpdateLanes);
+    serviceAudio();
+    serviceStimuli();
+    serviceLeds();
+    serviceInterrupts(); // INT_OR sources (ToF samples, accel FIFO, ...) + their handlers
+    fed4Trace(FedTracePoint::UpdateOutputs);
+
+    if (!sensorBatchPlanned)
+        beginSensorBatch(); // update() outside waitUntil()
+    runUpdatePart(FedUpdatePart::Sensors, sensorBatch != 0 || bmePending || lightPending, &FED4::serviceSensors);
+    lastPollTime = millis();
+    fed4Trace(FedTracePoint::UpdateSensors);
+    serviceEnergy();
+    flushSessionNvs(false); // rate-limited NVS copy of the session checkpoint
+    fed4Trace(FedTracePoint::UpdateEnergy);
+
+    // Redraw only when something on screen changed (MIP keeps its pixels)
+    const uint32_t shown = displayStateHash();
+    const bool redraw = !incrementalUpdate || displayDirty || shown != lastDisplayHash ||
+                        !(updatePartRan & (1u << (uint8_t)FedUpdatePart::Display));
+    if (runUpdatePart(FedUpdatePart::Display, redraw, &FED4::updateDisplay))
+    {
+        lastDisplayHash = displayStateHash(); // updateDisplay() refreshes pelletPresent
+        displayDirty = false;
+    }
+    fed4Trace(FedTracePoint::UpdateDisplay);
+    runUpdatePart(FedUpdatePart::Serial, redraw || updatePartDue(FedUpdatePart::Serial, updatePeriods.serialMs),
+                  &FED4::serialStatusReport);
+    fed4Trace(FedTracePoint::UpdateSerial);
+    collectEnvironmentReading(); // still measuring: it waits in the sensor for the next wake
+    collectLightReading();
+    sensorBatchPlanned = false;
     syncHublink();
+    fed4Trace(FedTracePoint::UpdateHublink);
+
+    updateSavedTotalUs += lastUpdateSavedUs;
+}
+
+bool FED4::updatePartDue(FedUpdatePart part, uint32_t periodMs) const
+{
+    const uint8_t i = (uint8_t)part;
+    return !incrementalUpdate || !(updatePartRan & (1u << i)) || millis() - updatePartLastMs[i] >= periodMs;
+}
+
+/** Run one update() part when due (timing it), else credit its last cost to lastUpdateSavedUs. */
+bool FED4::runUpdatePart(FedUpdatePart part, bool due, void (FED4::*fn)())
+{
+    const uint8_t i = (uint8_t)part;
+    if (!due)
+    {
+        lastUpdateSavedUs += updatePartCostUs[i];
+        return false;
+    }
+    const int64_t startUs = esp_timer_get_time();
+    (this->*fn)();
+    updatePartCostUs[i] = (uint32_t)(esp_timer_get_time() - startUs);
+    updatePartLastMs[i] = millis();
+    updatePartRan |= (uint8_t)(1u << i);
+    return true;
+}
+
+/** FNV-1a over everything the status screen shows, at the precision it shows it. */
+uint32_t FED4::displayStateHash()
+{
+    uint32_t h = 2166136261u;
+    auto mix = [&h](int32_t v) {
+        for (uint8_t b = 0; b < 4; b++)
+        {
+            h ^= (uint8_t)(v >> (b * 8));
+            h *= 16777619u;
+        }
+    };
+    const uint32_t clockS = max<uint32_t>(updatePeriods.clockMs / 1000, 1);
+    mix((int32_t)(unixtime / clockS));
+    mix(pelletCount);
+    mix(leftCount);
+    mix(centerCount);
+    mix(rightCount);
+    mix((leftTouch ? 1 : 0) | (centerTouch ? 2 : 0) | (rightTouch ? 4 : 0) | (checkForPellet() ? 8 : 0) |
+        (audioSilenced ? 16 : 0) | (sdCardAvailable ? 32 : 0));
+    mix(currentSequenceIndex);
+    mix(currentSequenceLevel);
+    mix((int32_t)readings.temperature.value);
+    mix((int32_t)readings.humidity.value);
+    mix((int32_t)(readings.cellVoltage.value * 10));
+    mix((int32_t)timeToEmptyHours());
+    for (const String *s : {&program, &mouseId, &currentSequence})
+    {
+        for (size_t i = 0; i < s->length(); i++)
+            mix((*s)[i]);
+    }
+    return h;
 }
 
 /**
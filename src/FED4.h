@@ -7,7 +7,6 @@
 #include <string>
 #include <Adafruit_MCP23X17.h> // version 2.3.2
 #include "Adafruit_MAX1704X.h" // version 1.0.3
-#include <Stepper.h>           // version 1.1.3
 #include <FastLED.h>           // version 3.10.2
 #include <Wire.h>
 #include <Adafruit_GFX.h> // version 1.12.3
@@ -41,6 +40,13 @@ class DateTime;
 #include "FED4_Pins.h"
 #include "FED4_DisplayOrient.h"
 #include "FED4_TouchHelpers.h"
+#include "FED4_TouchFeatures.h"
+#include "FED4_Synth.h"
+#include "FED4_Adpcm.h"
+#include "FED4_LedAnim.h"
+#include "FED4_Colors.h"
+#include "FED4_Trace.h"
+#include "FED4_Time.h"
 
 // Sense TRRS TRIG+UART master (FED4_Submodule*) — TRRS2=TRIG, TRRS3=DATA.
 // Set to 1 here (library rebuild) to expose FED4::sense*.
@@ -72,6 +78,8 @@ static const uint8_t DISPLAY_ROTATION = FED4_DISPLAY_ROTATION_NATIVE;
 static const uint8_t NUM_STRIP_LEDS = 8;
 static const uint16_t MOTOR_STEPS = 512;
 static const uint8_t MOTOR_SPEED = 24;
+// One full step at MOTOR_SPEED RPM (Arduino Stepper timing): 60e6 / (512 * 24) ≈ 4883 µs
+static const uint32_t MOTOR_STEP_US = 60UL * 1000UL * 1000UL / MOTOR_STEPS / MOTOR_SPEED;
 
 // TOUCH_THRESHOLD (rise fraction) is defined in FED4_TouchHelpers.h
 static const char *META_FILE = "/meta.json";
@@ -103,9 +111,353 @@ struct FedEvent
 {
     FedWakeSource source = FedWakeSource::None;
     FedPad pad = FedPad::None;
-    uint8_t button = 0; // 1/2/3 when Button
+    uint8_t button = 0;                    // 1/2/3 when Button
+    FedContact contact = FedContact::None; // lick/poke/hold label when Touch
 };
 
+static const uint8_t FED4_NUM_PHOTOGATES = 4;
+
+/** One photogate edge from the PG ISR (FED4_Photogates.cpp). gate 0–3 = PHOTOGATE_1–4. */
+struct FedGateEdge
+{
+    FedTimeUs timeUs = 0; // esp_timer_get_time() at the edge
+    uint8_t gate = 0;
+    uint8_t level = 0; // pin level after the edge — LOW = beam broken
+};
+
+// FedStepSegment::flags
+static const uint8_t FED4_SEG_STOP_ON_PELLET = 1 << 0; // abort queue when PG1 breaks
+static const uint8_t FED4_SEG_COUNT_STEPS = 1 << 1;    // steps count toward motorTurns
+
+/** One queued stepper move (FED4_Stepper.cpp): steps, then holdTicks step periods with coils off. */
+struct FedStepSegment
+{
+    int16_t steps = 0; // negative = dispense direction
+    uint16_t holdTicks = 0;
+    uint8_t flags = 0;
+};
+
+/** Dispense state machine (FED4_Feed.cpp). */
+enum class FedDispenseState : uint8_t
+{
+    Idle = 0,
+    Advance,  // 25-turn batch toward the drop
+    Pause,    // 1 s coils-off rest between batches
+    JamClear, // reverse + vibrate wobble
+    Done,     // pellet in well (or Button 1)
+    GaveUp    // jammed() — DispenseError
+};
+
+static const uint8_t FED4_DROP_STEP_SAMPLES = 8; // clean drops remembered for staging
+static const uint8_t FED4_DISPENSE_HISTORY = 32;   // telemetry window (FED4_DispenseStats.cpp)
+static const uint8_t FED4_DISPENSE_MIN_SAMPLES = 8; // clean dispenses before early jam clearing
+
+/** Per-dispense telemetry record. Times are from dispense() start; 0 = not seen. */
+struct FedDispenseRecord
+{
+    uint32_t timeUnix = 0;
+    uint32_t steps = 0;        // counted advance steps (incl. staging)
+    uint32_t timeToDropMs = 0; // PG4 break
+    uint32_t timeToWellMs = 0; // PG1 break
+    uint32_t dropToWellMs = 0; // PG4 → PG1 fall time
+    uint8_t clears = 0;        // jam clears attempted
+    bool earlyClear = false;   // first clear triggered by the learned distribution
+    bool jammed = false;
+    bool staged = false;
+    bool wellDetected = false;
+};
+
+/** Rolling step-count distribution over clean dispenses in the window. */
+struct FedDispenseStats
+{
+    uint16_t samples = 0;
+    float meanSteps = 0.0f;
+    float sdSteps = 0.0f;
+};
+
+static const uint8_t FED4_NUM_LANES = 2; // PG2 left, PG3 right
+static const uint8_t FED4_INT_SOURCES = 4; // INT_OR sources (FED4IntSource bits)
+
+/** How lane (PG2/PG3) visits reach the CSV. */
+enum class FedLaneLogMode : uint8_t
+{
+    Off = 0,  // count in RAM only
+    PerEvent, // one LeftLane/RightLane row per completed visit
+    Summary   // one LaneSummary row every laneSummarySeconds
+};
+
+/** Debounced per-lane counters (FED4_Lanes.cpp). */
+struct FedLaneStats
+{
+    uint32_t entries = 0;       // since boot
+    uint32_t windowEntries = 0; // since last LaneSummary
+    uint32_t windowDwellMs = 0;
+    uint32_t maxDwellMs = 0;
+    uint32_t lastDwellMs = 0;
+    bool occupied = false;
+    FedTimeUs entryUs = 0;
+    uint8_t rawLevel = HIGH; // last raw edge (debounce candidate)
+    FedTimeUs rawUs = 0;
+};
+
+static const uint32_t FED4_AUDIO_SAMPLE_RATE_HZ = 48000; // I2S mono 16-bit
+static const uint8_t FED4_AUDIO_MAX_NOTES = 16;          // notes per queued sequence
+static const uint32_t FED4_AUDIO_DMA_DESC = 6;            // ESP_I2S default TX ring: 6 descriptors
+static const uint32_t FED4_AUDIO_DMA_FRAMES = 240;        // × 240 frames each
+struct FedAudioRequest;                                   // FED4_AudioEngine.cpp
+
+/** One note of a queued sequence (FED4_AudioEngine.cpp). frequency 0 or amplitude 0 = rest. */
+struct FedAudioNote
+{
+    uint16_t frequency = 0;
+    uint16_t durationMs = 0;
+    uint16_t amplitudeQ15 = 0;
+    FedWave wave = FedWave::Sine;
+    uint8_t fadeMs = 2;
+    uint16_t glideToHz = 0; // 0 = fixed pitch
+};
+
+constexpr FedAudioNote fed4Note(uint16_t frequency, uint16_t durationMs, float amplitude,
+                                FedWave wave = FedWave::Sine, uint8_t fadeMs = 2)
+{
+    return FedAudioNote{frequency, durationMs, FedToneGen::amplitudeQ15(amplitude), wave, fadeMs, 0};
+}
+
+constexpr FedAudioNote fed4Rest(uint16_t durationMs)
+{
+    return FedAudioNote{0, durationMs, 0, FedWave::Sine, 0, 0};
+}
+
+/** Clip loaded from SD by loadAudioClip() (heap copy; PSRAM when present). */
+struct FedAudioClip
+{
+    uint8_t *data = nullptr;
+    uint32_t bytes = 0;
+    uint32_t samples = 0;
+    uint16_t blockAlign = 0; // 0 = 16-bit PCM, else IMA-ADPCM block size
+};
+
+/**
+ * Audio start/stop callback, run on the audio task — keep it short (no SD/I2C).
+ * id is the value returned by play*Async(); timeUs is esp_timer_get_time().
+ */
+typedef void (*FedAudioCallback)(uint32_t id, int64_t timeUs);
+typedef void (*FedAudioHook)(void *ctx, int64_t startUs, int64_t stopUs); // internal
+
+static const uint8_t FED4_MAX_STIMULI = 8; // concurrently scheduled stimuli
+
+/** Output used by stimulus() (FED4_Stimulus.cpp). */
+enum class FedStimKind : uint8_t
+{
+    Tone = 0, // speaker (audio task)
+    Led,      // front strip, solid color
+    Haptic,   // vibration motor (expander)
+    Trrs      // TRRS output pulse, channel 1–3
+};
+
+struct FedStimulus
+{
+    FedStimKind kind = FedStimKind::Tone;
+    uint32_t durationMs = 0; // Led: 0 = leave on
+    uint16_t frequency = 0;  // Tone
+    float amplitude = 0.25f; // Tone
+    uint32_t color = 0;      // Led (0xRRGGBB)
+    uint8_t channel = 1;     // Trrs
+};
+
+/** Scheduled vs physical onset, all esp_timer_get_time() µs. */
+struct FedStimOnset
+{
+    uint32_t id = 0;
+    FedStimKind kind = FedStimKind::Tone;
+    int64_t scheduledUs = 0;
+    int64_t onsetUs = 0;  // physical output on: software stamp + outputLatencyUs
+    int64_t offsetUs = 0; // physical output off (0 = left on)
+    int32_t outputLatencyUs = 0; // fixed stamp-to-output delay for this kind (out_lat_us)
+};
+
+/** Power states for energy accounting (FED4_Energy.cpp). */
+enum class FedPowerState : uint8_t
+{
+    SleepPsv2On = 0, // light sleep, photogate/SD rail powered
+    SleepPsv2Off,    // light sleep, rail off
+    AwakeIdle,       // CPU awake — base current; the states below add on top
+    Display,         // MIP refresh()
+    SdWrite,         // logData() open/append/close
+    Motor,           // stepper coils energized
+    Audio,           // amp enabled
+    Leds,            // front strip, scaled by its lit load (coefficient = all white)
+    Count
+};
+static const uint8_t FED4_POWER_STATES = (uint8_t)FedPowerState::Count;
+
+/**
+ * Current per power state in mA. Defaults are rough board estimates — measure
+ * once on a bench supply and overwrite. Display..Leds are extras above AwakeIdle.
+ */
+struct FedEnergyCoefficients
+{
+    float mA[FED4_POWER_STATES] = {3.0f, 1.2f, 40.0f, 2.0f, 30.0f, 220.0f, 45.0f, 480.0f};
+};
+
+/** Parts of update() that run on their own period (incremental update). */
+enum class FedUpdatePart : uint8_t
+{
+    Sensors = 0, // the poll scheduler's batch (serviceSensors)
+    Display,
+    Serial,
+    Count
+};
+static const uint8_t FED4_UPDATE_PARTS = (uint8_t)FedUpdatePart::Count;
+
+/** update() refresh periods; the display and status line also run whenever what they show changed. */
+struct FedUpdatePeriods
+{
+    uint32_t clockMs = 60000;  // clock text: redraw when this time bucket rolls over
+    uint32_t serialMs = 60000; // status line
+};
+
+/** Sensor channels of the poll scheduler (FED4_Sensors.cpp). */
+enum class FedSensor : uint8_t
+{
+    Tph = 0, // BME680 temperature/humidity/pressure (heater off)
+    Gas,     // BME680 gas resistance (heater on; also refreshes Tph)
+    Battery, // MAX17048 voltage/SOC
+    Light,   // VEML7700 lux/white
+    Motion,  // PIR level (GPIO, not batched)
+    Prox,    // VL53L1X distance
+    Accel,   // LIS2DH12 device-oriented x/y/z
+    Count
+};
+static const uint8_t FED4_SENSORS = (uint8_t)FedSensor::Count;
+
+/**
+ * One sensor's schedule. A reading that stays within threshold (in each field's
+ * unit) doubles the interval up to maxPeriodMs; one that moves snaps it back to
+ * periodMs. A sensor within jitterMs of due is read with any I2C batch going now.
+ */
+struct FedSensorSchedule
+{
+    bool enabled;
+    uint32_t periodMs; // 0 = every update()
+    uint32_t jitterMs;
+    float threshold;
+    uint32_t maxPeriodMs;
+};
+
+/** Activity metrics of the last closed accelerometer FIFO window (FED4_Accel.cpp). */
+struct FedAccelActivity
+{
+    uint32_t samples = 0;
+    float meanMagG = 0.0f;      // mean |a|
+    float magVarianceG2 = 0.0f; // variance of |a| — activity / handling
+    float tiltChangeDeg = 0.0f; // mean gravity vector vs the previous window — device moved
+    uint16_t knocks = 0;        // runs of sample-to-sample jumps ≥ accelKnockG — cage bumps
+    uint32_t endMs = 0;
+};
+
+/** Running sums of the open window. */
+struct FedAccelWindow
+{
+    uint32_t n = 0;
+    float meanMag = 0.0f;
+    float m2 = 0.0f;
+    float sumX = 0.0f, sumY = 0.0f, sumZ = 0.0f;
+    uint16_t knocks = 0;
+};
+
+/** VL53L1X threshold window (its detection config values). */
+enum class FedProxWindow : uint8_t
+{
+    Below = 0,   // range < nearMm
+    Above = 1,   // range > farMm
+    Outside = 2, // range < nearMm or > farMm
+    Inside = 3   // nearMm ≤ range ≤ farMm (0..150 = every range up to the prox() cap)
+};
+
+/** One ToF range from the proximity service. */
+struct FedProxSample
+{
+    uint32_t ms = 0; // millis() when collected
+    int16_t mm = -1; // prox() scale, 0..150
+    uint8_t status = 0; // VL53L1X range status, 0 = valid
+};
+
+/** Latest value with its timestamps (millis). value only moves by ≥ the sensor's threshold. */
+template <typename T>
+struct FedStamped
+{
+    T value;
+    uint32_t sampledMs = 0; // last read that confirmed or replaced value
+    uint32_t changedMs = 0; // last time value moved
+    bool valid = false;
+    uint32_t ageMs() const { return valid ? (uint32_t)(millis() - sampledMs) : UINT32_MAX; }
+};
+
+/** Latest-readings table: logData(), the display, serial and Hublink read this. */
+struct FedReadings
+{
+    FedStamped<float> temperature{-1.0f}; // °C
+    FedStamped<float> humidity{-1.0f};    // %RH
+    FedStamped<float> pressure{-1.0f};    // hPa
+    FedStamped<float> gas{-1.0f};         // kΩ
+    FedStamped<float> cellVoltage{0.0f};  // V
+    FedStamped<float> cellPercent{0.0f};  // %
+    FedStamped<float> lux{-1.0f};
+    FedStamped<float> white{-1.0f};
+    FedStamped<bool> motion{false};    // PIR level at the last sample
+    FedStamped<int16_t> proxMm{-1};    // 0..150 mm
+    FedStamped<float> accelX{0.0f};    // m/s², device axes (see FED4_Accel.cpp)
+    FedStamped<float> accelY{0.0f};
+    FedStamped<float> accelZ{0.0f};
+};
+
+class FED4;
+
+/** Adds its lifetime to one power state (wraps refresh() and logData()). */
+struct FedEnergySpan
+{
+    FedEnergySpan(FED4 &fed, FedPowerState state);
+    ~FedEnergySpan();
+    FED4 &fed;
+    FedPowerState state;
+    int64_t startUs;
+};
+
+/**
+ * Warm-restart checkpoint (FED4_Session.cpp). Plain data: it lives in RTC
+ * slow memory across resets and is copied byte-for-byte to NVS, so it must
+ * stay trivially constructible. Bump kSessionVersion when the layout changes.
+ */
+struct FedSessionState
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;
+    uint32_t generation; // +1 per checkpoint; the newer of RTC/NVS wins
+    uint32_t savedUnix;  // wall time of the checkpoint
+    int32_t pelletCount;
+    int32_t centerCount;
+    int32_t leftCount;
+    int32_t rightCount;
+    int32_t blockPokeCount;
+    int32_t blockPelletCount;
+    int32_t FR;
+    int32_t sequenceIndex;
+    int32_t sequenceLevel;
+    uint32_t reserved0;       // explicit padding: every byte is covered by the CRC
+    int64_t pelletWellUnixUs; // pellet left in the well at this wall time (pendingRetrieval)
+    uint32_t touchIdle[3];    // L, C, R baselines
+    uint8_t pendingRetrieval;
+    uint8_t reserved1[3];
+    char filename[32];
+    char program[24];
+    char mouseId[16];
+    uint32_t crc; // esp_rom_crc32_le over everything above
+    uint32_t reserved2;
+};
+static_assert(sizeof(FedSessionState) == 160, "FedSessionState has implicit padding; bump kSessionVersion on layout changes");
+
 // current very public-oriented, consider pushing some to private
 class FED4 : public Adafruit_GFX
 {
@@ -138,8 +490,17 @@ public:
     // Corefunctions
     void feed();
     void run(); // legacy: update() + sleep(sleepSeconds)
-    /** Refresh clock/display/serial/hublink — call after feed() or when UI must change. */
+    /**
+     * Refresh clock/display/serial/hublink — call after feed() or when UI must change.
+     * Sensors run on sensorSchedule; the display is redrawn only when something it
+     * shows changed (counts, pokes, well, clock bucket, sensor values) or displayDirty.
+     */
     void update();
+    bool incrementalUpdate = true; // false: every update() reads all sensors and redraws
+    FedUpdatePeriods updatePeriods;
+    bool displayDirty = false;        // force a redraw on the next update()
+    uint32_t lastUpdateSavedUs = 0;   // awake time the last update() skipped (last cost of each skipped part)
+    uint64_t updateSavedTotalUs = 0;
     /**
      * Light-sleep until touch, button, or updateIntervalSeconds.
      * MIP VCOM is kept alive by LEDC during sleep (no CPU wake chunks).
@@ -166,8 +527,42 @@ public:
     void menuRTC();
     void menuEnd();
 
-    // Sensor polling (BME/battery/lux for UI — called from update())
-    void refreshSensors();
+    // Sensor poll scheduler (defined in FED4_Sensors.cpp). waitUntil() plans a
+    // batch right after wakeUp() and starts the BME680; update() reads the rest.
+    FedSensorSchedule sensorSchedule[FED4_SENSORS] = {
+        {true, 300000, 60000, 0.2f, 900000},   // Tph: °C / %RH / hPa
+        {true, 900000, 120000, 5.0f, 1800000}, // Gas: kΩ
+        {true, 600000, 120000, 0.01f, 1800000}, // Battery: V / %
+        {true, 300000, 60000, 0.5f, 900000},   // Light: lux / counts
+        {true, 0, 0, 0.5f, 0},                 // Motion: every update() while useMotionSensor
+        {false, 1000, 0, 5.0f, 1000},          // Prox: mm (off by default)
+        {true, 300000, 60000, 0.5f, 900000},   // Accel: m/s²
+    };
+    FedReadings readings;
+    uint32_t sensorBatches = 0;           // batches with at least one I2C read
+    uint32_t sensorPulledForward = 0;     // reads taken early to share a batch
+    uint32_t sensorReads[FED4_SENSORS] = {};
+    uint32_t sensorChanges[FED4_SENSORS] = {};
+    void beginSensorBatch(); // plan what is due, start the BME680 measurement
+    void serviceSensors();   // collect the BME680 if done, read the rest of the batch
+    uint32_t sensorIntervalMs(FedSensor sensor) const { return sensorInterval[(uint8_t)sensor]; }
+
+    // Blocking reads of everything, outside the scheduler (startup, sketches)
+    void refreshSensors(); // all three now
+    void refreshEnvironment(); // blocking BME680 read (one heater cycle)
+    /**
+     * Split-phase BME680: start a TPH + gas measurement (~190 ms on the sensor,
+     * heater included) and return; collect it once the sensor is done. waitUntil()
+     * starts one right after wakeUp() when the Environment part is due, update()
+     * collects after the display and status line, or on the next wake.
+     */
+    void startEnvironmentReading(bool withGas = true);
+    bool collectEnvironmentReading(bool wait = false); // true when new values were stored
+    bool environmentReadingPending() const { return bmePending; }
+    uint32_t environmentAgeMs() const { return readings.temperature.ageMs(); } // UINT32_MAX before the first
+    uint32_t environmentDeferred = 0;  // readings picked up on a later wake than they started
+    void refreshBattery();
+    void refreshLight();
     void startupPollSensors();
     /** @deprecated Use refreshSensors(); kept as alias for older sketches. */
     void pollSensors(int minToUpdateSensors = 10);
@@ -188,10 +583,52 @@ public:
      * (up to waitUntil interval); PSV2 stays off in light sleep for battery life.
      */
     bool checkLateRetrieval();
-    unsigned long pelletDropTime;
-    unsigned long pelletWellTime;
+    unsigned long pelletDropTime; // fedMs32(pelletDropUs): millis() scale, wraps at 49.7 days
+    unsigned long pelletWellTime; // fedMs32(pelletWellUs)
     bool dispenseError = false;
     void handleJams();
+    FedDispenseState dispenseState = FedDispenseState::Idle;
+
+    // Pellet staging (defined in FED4_Feed.cpp)
+    bool pelletStaging = false;       // pre-advance the disc toward the learned drop point after each take
+    uint16_t stagingMarginSteps = 40; // stop this many steps short of the shortest recent drop
+    uint32_t deliveryLatencyMs = 0;   // last trial: triggering poke (or feed() call) → pellet in well
+    uint32_t stagingSteps() const;
+
+    // Dispense telemetry (defined in FED4_DispenseStats.cpp)
+    bool earlyJamClear = true;   // start jam clearing early when steps run far above the learned mean
+    float earlyJamSigma = 3.0f;  // ... at mean + earlyJamSigma × σ
+    FedDispenseRecord lastDispense;
+    FedDispenseStats dispenseStats;
+    uint32_t earlyJamThresholdSteps() const;
+    String dispenseDetail() const;
+    void exportDispenseTelemetry(Print &out, bool header = true); // CSV of the window (Serial or an open SD File)
+    bool saveDispenseTelemetry();  // append the window to <log>_DISP.CSV (automatic each time it fills)
+    /** Advance the dispense state machine on motor/pellet events (called from dispense()). */
+    void serviceDispense();
+
+    // Photogate edge capture (defined in FED4_Photogates.cpp)
+    bool initializePhotogates();                   // INPUT_PULLUP + CHANGE ISR on PG1–PG4
+    void armPhotogates();                          // re-attach ISRs (wakeUp)
+    uint16_t servicePhotogates();                  // drain ISR queue → timestamps below
+    void resetPelletEdges();                       // clear pellet stamps before a dispense
+    bool waitForPhotogateEdge(uint32_t timeoutMs); // block until an edge is queued or timeout
+    uint32_t photogateEdgesDropped() const;        // ISR queue overflows since boot
+    uint8_t photogateLevel[FED4_NUM_PHOTOGATES] = {HIGH, HIGH, HIGH, HIGH};
+    FedTimeUs photogateEdgeUs[FED4_NUM_PHOTOGATES] = {};
+    FedTimeUs pelletWellUs = 0;  // PG1 first break since resetPelletEdges()
+    FedTimeUs pelletTakenUs = 0; // PG1 last clear
+    FedTimeUs pelletDropUs = 0;  // PG4 first break since resetPelletEdges()
+    FedTimeUs headEntryUs = 0;   // last PG2/PG3 break
+    uint8_t headEntryGate = 0; // 1 = PG2 left, 2 = PG3 right
+
+    // Lane head-entry events (defined in FED4_Lanes.cpp)
+    FedLaneLogMode laneLogMode = FedLaneLogMode::Off;
+    uint32_t laneSummarySeconds = 300;
+    uint32_t laneDebounceMs = 20;
+    bool laneWakeInSleep = false; // GPIO-wake on lane changes in light sleep (re-sleeps without wakeUp)
+    FedLaneStats lanes[FED4_NUM_LANES];
+    void updateLanes(); // commit debounced edges + log per laneLogMode (called from update())
 
     // TRRS input/output connector functions
     bool initializeTRRS();
@@ -203,12 +640,20 @@ public:
     int currentSecond;
     unsigned long unixtime;
 
-    // Stepper motor functionality (defined in FED4_Motor.cpp)
+    // Stepper motor functionality (engine in FED4_Stepper.cpp, jam moves in FED4_Motor.cpp)
     bool initializeMotor();
     void releaseMotor();
-    void minorJamClear();
-    void vibrateJamClear();
+    void minorJamClear();   // blocking wrapper around queueMinorJamClear()
+    void vibrateJamClear(); // blocking 35-cycle wobble
     void jammed();
+    bool queueMotorSteps(int16_t steps, uint32_t holdMs = 0, uint8_t flags = 0);
+    uint32_t motorQueueSpace() const;
+    bool motorIdle();
+    bool waitMotorIdle(uint32_t timeoutMs);
+    void stopMotor();
+    bool motorStoppedByPellet() const;
+    uint32_t motorCountedSteps(bool reset = false);
+    uint32_t motorCoilTicks() const; // step periods with coils energized (energy accounting)
 
     // Timeout functionality (defined in FED4_Timeout.cpp)
     void timeout(uint16_t min, uint16_t max);
@@ -228,6 +673,19 @@ public:
     /** 0=none, 1=left, 2=center, 3=right — sync of FedPad after capturePoke; not an ISR latch. */
     static uint8_t wakePad;
 
+    // Contact classification (features/classifier in FED4_TouchFeatures.h)
+    bool lickBoutLogging = false; // true: licks roll up into one "LickBout" row per bout (waitUntil)
+    uint32_t lickBoutGapMs = 1000; // no contact for this long ends a lick bout
+    FedContactThresholds contactThresholds;
+    FedContact lastContact = FedContact::None; // label of the last capturePoke() contact
+    FedContactFeatures lastContactFeatures;
+    int lickCount = 0;
+    /** Stay awake while licks continue on wakePad, then log one "LickBout" row.
+     *  Returns false when the bout ended on a non-lick contact (left in lastContact/wakePad). */
+    bool captureLickBout();
+    /** key=value summary of lastContactFeatures for logData() detail. */
+    String contactDetail() const;
+
     // Status LED and Strip control (defined in FED4_LEDs.cpp)
     // (strip - front RGB LEDs on PSV3 rail)
     bool initializeStrip();
@@ -254,6 +712,20 @@ public:
     void centerLight(const char *colorName, uint8_t brightness);
     void rightLight(const char *colorName);
     void rightLight(const char *colorName, uint8_t brightness);
+    // (non-blocking animations, defined in FED4_LedAnim.cpp — stepped by serviceLeds()
+    //  from update(); a direct strip write such as leftLight() or lightsOff() stops them)
+    void colorWipeAsync(uint32_t color, unsigned long wait);
+    void stripTheaterChaseAsync(uint32_t color, unsigned long wait, unsigned int groupSize = 3, unsigned int numChases = 10);
+    void stripRainbowAsync(unsigned long wait, unsigned int numLoops = 1);
+    void randomMotionAsync(float motionStrength, uint32_t color, unsigned long frameDelay = 75, unsigned long durationMs = 3000);
+    void playKeyframes(const FedLedKeyframe *frames, uint8_t count, uint16_t numLoops = 1);
+    void playAnimation(FedLedEffect &effect); // effect must outlive the animation
+    void stopAnimation(bool clear = false);
+    bool animationRunning() const;
+    bool waitAnimation(uint32_t timeoutMs = 10000);
+    void serviceLeds(); // next frame; FastLED.show() only if it changed (update())
+    uint32_t stripShows = 0;        // strip pushes
+    uint32_t stripShowsSkipped = 0; // frames identical to what the strip already shows
     // (status LED — digital red on STATUS_LED pin; LEDC VCOM owns the PWM path)
     bool initializePixel();
     void redPix(uint8_t brightness = 5);
@@ -302,6 +774,17 @@ public:
     FedWakeSource lastWakeSource = FedWakeSource::None;
     unsigned long pollSensorsTimer = 0;
 
+    // Wake-path profiler (defined in FED4_Trace.cpp; tracepoints in FED4_Trace.h)
+    bool traceSerial = false;  // per-stage breakdown on Serial after every waitUntil() wake
+    bool traceLogging = false; // "WakeTrace" CSV row per wake
+    uint32_t lastWakeToReadyUs = 0;
+    uint32_t maxWakeToReadyUs = 0;
+    uint32_t wakeTraceCount = 0;
+    uint64_t wakeTraceTotalUs = 0;
+    void finishWakeTrace(); // Ready stamp + stats/report (end of waitUntil())
+    String traceWakeDetail() const;
+    void traceDumpChrome();
+
     // Power management (defined in FED4_Power.cpp)
     bool initializePower();
     void PSV2_ON();
@@ -313,7 +796,8 @@ public:
     bool initializeSD();
     bool createMetaJson();
     bool createLogFile();
-    bool logData(const String &newEvent = "");
+    /** Append one CSV row; detail fills the trailing Detail column (key=value;key=value). */
+    bool logData(const String &newEvent = "", const String &detail = "");
     String getMetaValue(const char *rootKey, const char *subKey);
     bool setMetaValue(const char *rootKey, const char *subKey, const char *value);
     void setProgram(String program);
@@ -343,9 +827,11 @@ public:
     bool centerTouch;
     bool rightTouch;
     bool motionDetected = false;  // Track motion detection status
-    int motionCount = 0;          // Aggregate motion detections between 5-minute intervals
-    float motionPercentage = 0.0; // Percentage of motion detections in the last 5-minute period
-    int pollCount = 0;            // Track total number of polls in each 5-minute period
+    int motionCount = 0;          // PIR rising edges in the last closed window (takeMotionWindow)
+    float motionPercentage = 0.0; // PIR on-time in the last closed window, % of its length
+    uint32_t motionWindowMs = 0;  // length of that window (motion_ms= in the log Detail)
+    uint32_t motionWindowS = 60;  // update() closes the PIR window this often
+    int pollCount = 0;            // unused since the duty-cycle PIR; kept for older sketches
     unsigned long waketime;
     bool lastMotionPositive = false; // Debounce: require two consecutive positives
 
@@ -357,6 +843,28 @@ public:
     void updateTime();
     bool forceRTCUpdate = false; // Set to true to force RTC update on next initialization
 
+    // Time service: DS3231 read on a schedule, timestamps from the internal clock (FED4_RTC.cpp)
+    int64_t nowUnixUs();                 // Unix µs, no I2C
+    int64_t clockUnixUs(FedTimeUs timerUs) const; // Unix µs at a FedTimeUs stamp
+    bool syncClock(bool align = false);  // read the DS3231 and discipline against it
+    uint32_t rtcSyncPeriodS = 600;       // updateTime() syncs this often (0 = every update())
+    float clockDriftPpm = 0.0f;          // internal vs DS3231 rate, + = internal fast
+    int32_t clockLastErrorMs = 0;        // internal minus the DS3231's second at the last sync (0 = inside it)
+    uint32_t clockSyncs = 0;
+    uint32_t clockSteps = 0;             // syncs that had to correct the internal clock
+    uint32_t clockSyncFailures = 0;      // DS3231 reads that failed (retried every rtcSyncPeriodS)
+
+    // Warm restart: session checkpoint in RTC memory + NVS (FED4_Session.cpp)
+    void checkpointSession(bool forceNvs = false); // after each logged row; forceNvs before a planned restart
+    void clearSession();                 // the next boot starts a new log file
+    bool sessionResumed() const { return resumedSession; }
+    bool sessionResume = true;           // false: never resume, always a new file
+    bool sessionResumeOnPowerOn = false; // also resume after a power cycle (NVS copy only)
+    uint32_t sessionResumeMaxS = 3600;   // older checkpoints start a new session
+    uint32_t sessionNvsPeriodS = 300;    // at most one NVS write per this many seconds
+    uint32_t sessionCheckpoints = 0;
+    uint32_t sessionNvsWrites = 0;
+
 #if FED4_ENABLE_SUBMODULE
     // TRRS submodule (TRIG=AUDIO_TRRS_2, DATA=AUDIO_TRRS_3 half-duplex UART)
     bool senseBegin();
@@ -379,7 +887,15 @@ public:
     bool initializeLightSensor();
     bool reinitializeLightSensor();
 
-    // variables to store temp/humidity/pressure/gas and battery info so we don't have to keep pinging the chips every time
+    // Ambient light (defined in FED4_Light.cpp) — one-shot auto-ranged samples,
+    // ALS shut down in between; false = legacy free-running gain 2 / 800 ms.
+    bool lightAutoRange = true;
+    uint16_t lightIntegrationMs = 0; // of the last sample
+    uint32_t lightSaturations = 0;   // samples re-measured at the least sensitive range
+    bool startLightReading();
+    bool collectLightReading(bool wait = false); // true when new values were stored
+
+    // Mirrors of readings.*.value for older sketches (kept in step by the store functions)
     float temperature = -1.0;
     float humidity = -1.0;
     float pressure = -1.0;
@@ -390,6 +906,20 @@ public:
     float cellPercent = 0.0;
     unsigned long lastPollTime = 0; // make this a large negative so FED polls sensors at first startup
 
+    // Energy accounting (defined in FED4_Energy.cpp) — time per power state ×
+    // energyCoeffs, cross-checked against the MAX17048 SOC, "Energy" row per period.
+    FedEnergyCoefficients energyCoeffs;
+    float batteryCapacityMah = 4400.0f;
+    uint16_t energyLogMinutes = 60; // 0 = no "Energy" rows
+    void serviceEnergy();           // motor ticks, SOC anchor, periodic log (update())
+    void energyAdd(FedPowerState state, int64_t us);
+    uint64_t energyStateUs(FedPowerState state) const; // Leds: weighted by load
+    float energyUsedMah() const;                       // model, since boot
+    float energySocUsedMah() const;                    // SOC drop since boot × capacity (-1 = no reading yet)
+    float energyAverageMa() const;
+    float timeToEmptyHours() const; // -1 until 10 min of history
+    String energyDetail() const;    // key=value summary for logData()
+
     // Speaker functions (defined in FED4_Speaker.cpp)
     bool initializeSpeaker();
     struct Tone
@@ -417,6 +947,41 @@ public:
     void soundSweep(uint32_t startFreq = 500, uint32_t endFreq = 1500, uint32_t duration_ms = 1000);
     void noise(uint32_t duration_ms = 500, float amplitude = 1);
 
+    // Async audio engine (defined in FED4_AudioEngine.cpp) — one task owns I2S.
+    // play*Async() return a request id (0 = queue full); sound starts within ~1 ms.
+    // They honor silence() unless bypassMute (the library's tones and jingles, like playTone()).
+    uint32_t playToneAsync(uint32_t frequency, uint32_t duration_ms, float amplitude = 0.25, bool bypassMute = false);
+    uint32_t playSequenceAsync(const FedAudioNote *notes, size_t count, bool bypassMute = false);
+    uint32_t playClipAsync(const int16_t *pcm, uint32_t samples);
+    uint32_t playAdpcmAsync(const uint8_t *blocks, uint32_t samples, uint16_t blockAlign = FED4_ADPCM_BLOCK_ALIGN,
+                            bool bypassMute = false);
+    uint32_t playClipAsync(const FedAudioClip &clip);
+    bool loadAudioClip(const char *path, FedAudioClip &clip); // 48 kHz mono WAV: PCM16 or IMA-ADPCM
+    void freeAudioClip(FedAudioClip &clip);
+    bool audioBusy() const;
+    bool waitAudioIdle(uint32_t timeoutMs = 10000);
+    void stopAudio();
+    void serviceAudio(); // amp off once idle (called from update())
+    FedAudioCallback onAudioStart = nullptr;
+    FedAudioCallback onAudioStop = nullptr;
+    volatile int64_t lastAudioStartUs = 0; // first sample into DMA
+    volatile int64_t lastAudioStopUs = 0;  // last sample clocked out
+
+    // Stimulus onsets (defined in FED4_Stimulus.cpp) — one esp_timer µs clock.
+    // Returns a stimulus id (0 = all FED4_MAX_STIMULI slots busy). Tone/TRRS
+    // onsets fire from a timer; Led/Haptic fire in serviceStimuli() (loop).
+    uint32_t stimulus(const FedStimulus &stim, uint32_t delayMs = 0);
+    uint32_t stimTone(uint16_t frequency, uint32_t durationMs, float amplitude = 0.25, uint32_t delayMs = 0);
+    uint32_t stimLed(uint32_t color, uint32_t durationMs, uint32_t delayMs = 0);
+    uint32_t stimHaptic(uint32_t durationMs, uint32_t delayMs = 0);
+    uint32_t stimTrrs(uint8_t channel, uint32_t durationMs, uint32_t delayMs = 0);
+    void serviceStimuli(); // fire due Led/Haptic, log completed onsets (update())
+    bool waitStimuli(uint32_t timeoutMs = 5000);
+    void cancelStimuli(); // drop onsets not yet started
+    bool stimLogging = true;  // "StimOnset" CSV row per stimulus
+    FedStimOnset lastStimOnset;
+    void (*onStimOnset)(const FedStimOnset &onset) = nullptr; // loop context
+
     // "Super Mario"-style sound effects (tone synthesis)
     void marioCoin();
     void marioJump();
@@ -459,15 +1024,51 @@ public:
     void readAccel(float &x, float &y, float &z);
     bool accelDataReady();
 
-    // ToF sensor functions (defined in FED4_ToF.cpp)
+    // FIFO activity mode: watermark on INT1 → INT_OR; drained once per fill
+    // (also from light sleep), windows of accelWindowSeconds → "Bump"/"Moved".
+    bool startAccelFifo(lis3dh_dataRate_t dataRate = LIS3DH_DATARATE_10_HZ, uint8_t watermark = 30);
+    void stopAccelFifo();
+    uint8_t drainAccelFifo(); // samples read
+    void updateAccelActivity(); // close a due window and log (called from update())
+    bool accelFifoActive = false;
+    uint16_t accelWindowSeconds = 60;
+    float accelKnockG = 0.5f;    // sample-to-sample jump counted as a knock
+    float accelMovedDeg = 10.0f; // tilt change logged as "Moved"
+    FedAccelActivity accelActivity;
+    uint32_t accelFifoDrains = 0;
+    uint32_t accelFifoOverruns = 0;
+    uint32_t accelSleepWakes = 0; // drains done from light sleep without a full wake
+
+    // ToF sensor functions (defined in FED4_Prox.cpp)
     bool initializeToF();
+    /** Distance in mm (0..150) or -1: the service's latest range when running, else one-shot. */
     int prox();
+    /**
+     * Autonomous low-power ranging every periodMs; only ranges matching the
+     * window (nearMm..farMm, prox() scale) assert INT_SRC_TOF. serviceProx()
+     * (called from update(); call it in tight loops too) stamps them into a ring.
+     */
+    bool startProxService(uint16_t periodMs = 50, uint16_t nearMm = 0, uint16_t farMm = 150,
+                          FedProxWindow window = FedProxWindow::Inside);
+    void stopProxService();
+    uint8_t serviceProx();
+    bool popProxSample(FedProxSample &out); // oldest first
+    uint32_t proxSamplesQueued() const;
+    bool proxServiceActive = false;
+    FedProxSample latestProx;       // last good range (ms = 0: none yet)
+    uint32_t proxSampleCount = 0;
+    uint32_t proxRangeErrors = 0;   // samples with a non-zero range status
 
     // Motion sensor functions (defined in FED4_Motion.cpp) - PIR EKMB1107112
     // PIR pin configured in begin(); no protocol init required
     bool motion();
     void updateStatusLedFromMotion(); // STATUS_LED mirrors PIR (Demo-Hardware)
     void resetMotionCounters();
+    void armPir();                    // edge-timing ISR on PIR_MOTION (begin / wakeUp)
+    float motionDutyPercent() const;  // live on-time % of the open window
+    void takeMotionWindow();          // close the window now
+    void serviceMotionWindow();       // close it once motionWindowS old (update())
+    uint32_t pirSleepWakes = 0;       // PIR edges stamped in light sleep without a full wake
 
     // Drop sensor functions
     bool initializeDropSensor();
@@ -488,11 +1089,15 @@ public:
         INT_SRC_RTC = 1 << 1,     // DS3231 alarm 1 or alarm 2
         INT_SRC_BATTERY = 1 << 2, // MAX17048 voltage / SOC alert
         INT_SRC_ACCEL = 1 << 3,   // LIS2DH12TR inertial event on INT1
+        INT_SRC_ALL = 0x0F,
     };
 
+    /** Deferred handler for one INT_OR source, run by serviceInterrupts() in loop context. */
+    typedef void (*FedIntHandler)(FED4 &fed, uint8_t source, uint32_t assertMs);
+
     bool initializeInterrupts();               // configure INT_OR wake + accel INT1
     bool interruptPending();                   // true when INT_OR is LOW
-    uint8_t scanInterrupts();                  // bitmask of all asserted sources (no clear)
+    uint8_t scanInterrupts(uint8_t sources = 0); // asserted among sources (0 = armed ones; no clear)
     void clearInterrupts(uint8_t mask = 0xFF); // clear latches for given sources
     uint8_t scanAndClearInterrupts();          // scan + clear + verify line release
     FED4IntSource firstInterruptSource();      // highest-priority single source
@@ -500,6 +1105,17 @@ public:
     /** Serial dump of INT_OR + button wake pins + decoded scanInterrupts() mask. */
     void printInterruptStatus(const char *tag = nullptr);
 
+    // Dispatcher: armed sources only, priority ACCEL > TOF > RTC > BAT, stop once INT_OR releases
+    void armInterruptSource(uint8_t mask, bool armed = true); // the enable helpers arm their own source
+    uint8_t armedInterruptSources() const { return armedInterrupts; }
+    void onInterrupt(uint8_t source, FedIntHandler handler);  // nullptr removes it
+    uint8_t dispatchInterrupts(); // scan + clear + queue handlers; returns the mask
+    uint8_t serviceInterrupts();  // update(): dispatch if INT_OR fired, run queued handlers
+    uint32_t interruptScans = 0;          // dispatches with INT_OR asserted
+    uint32_t interruptEarlyExits = 0;     // dispatches that skipped armed sources (line released)
+    uint32_t interruptStrays = 0;         // asserted sources nothing had armed
+    uint32_t interruptEventsDropped = 0;  // handler queue full
+
     // Opt-in per-source interrupt enable helpers
     bool enableAccelInterrupt(float threshold_g = 0.1f, uint8_t duration_count = 0);
     bool enableRTCAlarmInterrupt(uint8_t alarmNum = 1);          // arm DS3231 alarm on INT pin
@@ -521,9 +1137,105 @@ private:
     Adafruit_MAX17048 maxlipo;
     RTC_DS3231 rtc;
     ESP32Time Inrtc;
+    FedClockModel wallClock;       // FedTimeUs → Unix µs (FED4_Time.h)
+    FedTimeUs clockLastSyncUs = 0;
+    FedTimeUs clockRetryUs = 0;    // no DS3231 read before this after a failed one
+    void anchorClock(uint32_t unixSeconds);
+    FedSessionState sessionState = {}; // checkpoint found at boot (valid if sessionLoaded)
+    bool sessionLoaded = false;
+    bool resumedSession = false;
+    const char *sessionSource = "";    // "rtc" or "nvs"
+    uint32_t sessionGeneration = 0;
+    uint32_t sessionGapS = 0;          // boot time minus the checkpoint's
+    uint32_t sessionNvsCrc = 0;        // content last written to NVS
+    bool sessionNvsDirty = false;
+    uint32_t sessionNvsMs = 0;
+    bool loadSession();
+    bool restoreSessionTouch();
+    bool resumeSessionLog();
+    String sessionResumeDetail();
+    void flushSessionNvs(bool force);
     Adafruit_BME680 bme;
-    Stepper stepper;
+    bool bmePending = false;              // measurement started, not yet collected
+    uint32_t bmeReadyMs = 0;              // millis() the sensor finishes it
+    uint32_t bmeStartWake = 0;            // wakeCount when it started
+    bool bmeWithGas = false;              // heater on for the pending measurement
+    bool bmeHeaterOn = true;              // Adafruit begin() enables 320 °C / 150 ms
+    void restoreGasHeater();              // back to that profile after a TPH-only read
+    bool storeEnvironment(float temp, float hum, float pres, float gas, uint32_t ms);
+    bool storeBattery(float voltage, float percent);
+    bool storeLight(float luxValue, float whiteValue);
+
+    // Accelerometer FIFO state (FED4_Accel.cpp)
+    FedAccelWindow accelWin;
+    uint32_t accelWindowStartMs = 0;
+    float accelPrev[3] = {};
+    bool accelHavePrev = false;
+    bool accelInKnock = false;
+    float accelGravity[3] = {};
+    bool accelHaveGravity = false;
+    void addAccelSample(float x, float y, float z);
+    void armAccelWake();
+    bool serviceAccelWake();
+    bool accelFifoWatermark();
+
+    // Proximity service state (FED4_Prox.cpp)
+    bool tofReady = false;     // VL53L1X begin() done
+    uint16_t proxPeriodMs = 0; // inter-measurement period of the service
+    int16_t proxIdleMm = 150;  // prox() when no in-window range arrives (target outside the window)
+    uint32_t proxStartMs = 0;  // millis() when the service started
+    uint32_t proxErrorMs = 0;  // millis() of the last failed range (status != 0)
+    void captureProxSample();
+    void pauseProxService(bool pause);
+
+    // VEML7700 sampling state (FED4_Light.cpp)
+    uint8_t lightRange = 5;           // kLightRanges index for the next sample
+    uint8_t lightPendingRange = 0xFF; // range of the sample in flight
+    bool lightPending = false;
+    uint32_t lightReadyMs = 0;
+    uint8_t lightFailures = 0; // consecutive no-answer starts
+    float lightLastLux = -1.0f;
+    float lightLastWhite = -1.0f;
+
+    // Poll scheduler state (FED4_Sensors.cpp)
+    uint32_t sensorLastMs[FED4_SENSORS] = {};
+    uint32_t sensorInterval[FED4_SENSORS] = {}; // current (backed-off) interval
+    uint8_t sensorRan = 0;                      // bit per sensor: has been read once
+    uint8_t sensorBatch = 0;                    // bit per sensor still to read this wake
+    bool sensorBatchPlanned = false;
+    bool sensorDue(FedSensor sensor, uint32_t slackMs) const;
+    void sensorSampled(FedSensor sensor, bool changed);
+    template <typename T>
+    bool publishReading(FedStamped<T> &reading, T value, float threshold, uint32_t ms);
+    void sampleMotion();
+    void sampleProx();
+    void sampleAccel();
     CRGB strip_leds[NUM_STRIP_LEDS];
+    CRGB stripShadow[NUM_STRIP_LEDS];  // last frame pushed by showStrip()
+    uint8_t stripShadowBrightness = 0;
+    bool stripShadowValid = false;     // false after PSV3 power-up
+    FedLedEffect *ledEffect = nullptr; // running animation
+    unsigned long ledEffectStartMs = 0;
+    bool showStrip(bool force = false);
+
+    // Energy accounting state (FED4_Energy.cpp)
+    uint64_t energyUs[FED4_POWER_STATES] = {};      // closed intervals (level-weighted)
+    uint16_t energyLevelQ8[FED4_POWER_STATES] = {}; // Audio/Leds: current level, 256 = full
+    int64_t energyLevelSinceUs[FED4_POWER_STATES] = {};
+    uint32_t energyMotorTicks = 0;
+    float energySocStart = -1.0f;
+    unsigned long energyLastLogMs = 0;
+    bool psv2On = false;
+    void energyLevel(FedPowerState state, uint16_t levelQ8);
+
+    // Incremental update() state (FED4.cpp)
+    uint32_t updatePartLastMs[FED4_UPDATE_PARTS] = {};
+    uint32_t updatePartCostUs[FED4_UPDATE_PARTS] = {}; // µs of the last run
+    uint8_t updatePartRan = 0;                         // bit per part: has run once
+    uint32_t lastDisplayHash = 0;
+    bool updatePartDue(FedUpdatePart part, uint32_t periodMs) const;
+    bool runUpdatePart(FedUpdatePart part, bool due, void (FED4::*fn)());
+    uint32_t displayStateHash();
     Adafruit_LIS3DH accel;
     Adafruit_VEML7700 lightSensor;
     I2SClass i2s; // New I2S driver object for ESP32 core 3.x
@@ -542,10 +1254,60 @@ private:
     String age;
     bool dropSensorAvailable;        // Flag to store drop sensor availability status
     uint8_t lastInterruptMask = 0;   // captured by wakeUp() on INT_OR GPIO wake
+    uint8_t armedInterrupts = 0;     // sources the dispatcher scans
+    bool accelMotionArmed = false;   // enableAccelInterrupt() (INT_SRC_ACCEL outlives the FIFO)
+    FedIntHandler intHandlers[FED4_INT_SOURCES] = {};
+    bool scanInterruptSource(uint8_t source);
+    void armInterruptLine();
     uint8_t statusLedBrightness = 0; // Current PWM brightness for STATUS_LED
     bool pendingRetrieval = false;   // pellet still in well after awake 20 s window
+    uint8_t vibrateCyclesLeft = 0;   // JamClear wobble cycles still to queue
+    uint8_t dispenseClears = 0;      // jam clears this dispense (reversed disc)
+    bool dispenseEarlyCleared = false;
+    FedTimeUs dispenseStartUs = 0;
+    FedDispenseRecord dispenseHistory[FED4_DISPENSE_HISTORY];
+    uint8_t dispenseHistoryCount = 0;
+    uint8_t dispenseHistoryIndex = 0;
+    void recordDispenseTelemetry(bool pelletDetected);
+    void updateDispenseStats();
+    bool pelletStaged = false;       // staging move queued since the last take
+    bool stagingInFlight = false;    // staging move not yet checked by finishStaging()
+    bool lastFeedWasStaged = false;
+    uint32_t feedStartMs = 0;
+    uint16_t dropStepSamples[FED4_DROP_STEP_SAMPLES] = {};
+    uint8_t dropStepCount = 0;
+    uint8_t dropStepIndex = 0;
+    void recordStepsToDrop(uint32_t steps);
+    void stagePellet();
+    void finishStaging(bool completed);
+    void enterDispenseState(FedDispenseState state);
+    void logDispensePoke();
+    uint32_t lastContactOnsetMs = 0; // inter-contact interval reference for the classifier
+    bool trackContact(int padIndex); // sample one contact to release; classify + count
+    uint32_t lastLaneSummaryMs = 0;
+    void laneEdge(uint8_t lane, uint8_t level, FedTimeUs timeUs);
+    void commitLane(uint8_t lane, FedTimeUs nowUs);
+    void armLaneWake();
+    void disarmLaneWake();
+    bool serviceLaneWake();
+    void armPirWake();
+    void disarmPirWake();
+    bool servicePirWake();
     void monitorPelletInWell(uint32_t retrievalTimeoutSec);
 
+    // Audio engine internals (FED4_AudioEngine.cpp)
+    bool ampOn = false; // EXP_AMP_SD state — expander is only written from loop context
+    static void audioTask(void *arg);
+    bool startAudioEngine();
+    uint32_t enqueueAudio(FedAudioRequest &req);
+    void reserveAudio(FedAudioRequest &req);
+    bool armAudio(uint8_t slot, const FedAudioNote &note, FedAudioHook hook, void *ctx, bool immediate);
+    static bool postArmedAudio(uint8_t slot);
+    void disarmAudio(uint8_t slot);
+    bool fireStimulus(uint8_t slot); // loop-context onset (Led/Haptic, or delay 0)
+    static void stimOnTimer(void *arg);
+
+
     // RTC functions
     Preferences preferences;
     String getCompileDateTime();
@@ -1,5 +1,7 @@
 #include "FED4.h"
 
+#include "driver/gpio.h"
+
 /********************************************************
  * FED4 Accelerometer Functions
  *
@@ -123,3 +125,227 @@ bool FED4::accelDataReady()
 {
     return accel.haveNewData();
 }
+
+// ── FIFO activity mode ───────────────────────────────────────────────────────
+// startAccelFifo() runs the LIS2DH12 in stream mode with its 32-sample FIFO and
+// routes the watermark to INT1 (→ INT_OR, INT_SRC_ACCEL). The CPU only touches
+// the bus once per fill: drainAccelFifo() reads every stored sample in bursts
+// from OUT_X_L (the address rolls back in FIFO mode) and folds them into the
+// current window: |a| mean/variance (Welford), mean gravity vector, and knocks
+// (sample-to-sample jumps ≥ accelKnockG). startSleep() drains on INT_OR wakes
+// and goes straight back to sleep; update() closes windows and logs "Bump" /
+// "Moved" rows.
+
+static const uint8_t kAccelFifoDepth = 32;
+static const uint8_t kAccelBurstSamples = 20; // 120 bytes — inside the 128-byte Wire buffer
+static const float kAccelNormalG = 0.004f;    // normal mode (10-bit), ±2 g: 4 mg/digit
+
+static void accelWriteReg(uint8_t reg, uint8_t val)
+{
+    Wire.beginTransmission(I2C_ADDR_ACCEL);
+    Wire.write(reg);
+    Wire.write(val);
+    Wire.endTransmission();
+}
+
+static uint8_t accelReadReg(uint8_t reg)
+{
+    Wire.beginTransmission(I2C_ADDR_ACCEL);
+    Wire.write(reg);
+    Wire.endTransmission(false);
+    Wire.requestFrom((uint8_t)I2C_ADDR_ACCEL, (uint8_t)1);
+    return Wire.available() ? Wire.read() : 0xFF;
+}
+
+bool FED4::startAccelFifo(lis3dh_dataRate_t dataRate, uint8_t watermark)
+{
+    if (accelReadReg(LIS3DH_REG_WHOAMI) != 0x33) {
+        Serial.println("startAccelFifo: LIS2DH12 not found");
+        return false;
+    }
+    accel.setRange(LIS3DH_RANGE_2_G);
+    accel.setPerformanceMode(LIS3DH_MODE_NORMAL);
+    accel.setDataRate(dataRate);
+
+    accelWriteReg(LIS3DH_REG_FIFOCTRL, 0x00); // bypass: empties the FIFO
+    accelWriteReg(LIS3DH_REG_CTRL5, (uint8_t)(accelReadReg(LIS3DH_REG_CTRL5) | 0x40)); // FIFO_EN
+    const uint8_t wtm = watermark < 1 ? 1 : (watermark > 31 ? 31 : watermark);
+    accelWriteReg(LIS3DH_REG_FIFOCTRL, (uint8_t)(0x80 | wtm)); // stream mode, FTH, trigger on INT1
+    accelWriteReg(LIS3DH_REG_CTRL3, (uint8_t)(accelReadReg(LIS3DH_REG_CTRL3) | 0x04)); // I1_WTM
+
+    accelFifoActive = true;
+    armInterruptSource(INT_SRC_ACCEL);
+    accelWindowStartMs = millis();
+    accelWin = FedAccelWindow();
+    Serial.printf("Accel FIFO: watermark %d samples\n", wtm);
+    return true;
+}
+
+void FED4::stopAccelFifo()
+{
+    if (!accelFifoActive) {
+        return;
+    }
+    accelWriteReg(LIS3DH_REG_CTRL3, (uint8_t)(accelReadReg(LIS3DH_REG_CTRL3) & ~0x04));
+    accelWriteReg(LIS3DH_REG_FIFOCTRL, 0x00);
+    accelWriteReg(LIS3DH_REG_CTRL5, (uint8_t)(accelReadReg(LIS3DH_REG_CTRL5) & ~0x40));
+    accelFifoActive = false;
+    armInterruptSource(INT_SRC_ACCEL, accelMotionArmed);
+    // Back to the initializeAccel() defaults
+    accel.setDataRate(LIS3DH_DATARATE_50_HZ);
+    accel.setPerformanceMode(LIS3DH_MODE_HIGH_RESOLUTION);
+}
+
+/** Read every sample in the FIFO into the current window; returns the count. */
+uint8_t FED4::drainAccelFifo()
+{
+    if (!accelFifoActive) {
+        return 0;
+    }
+    const uint8_t src = accelReadReg(LIS3DH_REG_FIFOSRC);
+    if (src == 0xFF) {
+        return 0;
+    }
+    if (src & 0x40) {
+        accelFifoOverruns++; // OVRN: the oldest samples were overwritten
+    }
+    uint8_t count = (src & 0x40) ? kAccelFifoDepth : (src & 0x1F);
+    const uint8_t total = count;
+
+    uint8_t raw[kAccelBurstSamples * 6];
+    while (count > 0) {
+        const uint8_t n = count > kAccelBurstSamples ? kAccelBurstSamples : count;
+        Wire.beginTransmission(I2C_ADDR_ACCEL);
+        Wire.write((uint8_t)(LIS3DH_REG_OUT_X_L | 0x80)); // auto-increment
+        Wire.endTransmission(false);
+        const uint8_t got = Wire.requestFrom((uint8_t)I2C_ADDR_ACCEL, (uint8_t)(n * 6));
+        if (got != n * 6) {
+            return total - count;
+        }
+        for (uint8_t i = 0; i < n * 6; i++) {
+            raw[i] = Wire.read();
+        }
+        for (uint8_t i = 0; i < n; i++) {
+            const int16_t cx = (int16_t)(raw[i * 6] | (raw[i * 6 + 1] << 8)) >> 6;
+            const int16_t cy = (int16_t)(raw[i * 6 + 2] | (raw[i * 6 + 3] << 8)) >> 6;
+            const int16_t cz = (int16_t)(raw[i * 6 + 4] | (raw[i * 6 + 5] << 8)) >> 6;
+            // Device axes (see header): X = -chip Y, Y = chip X, Z = chip Z
+            addAccelSample(-cy * kAccelNormalG, cx * kAccelNormalG, cz * kAccelNormalG);
+        }
+        count -= n;
+    }
+    accelFifoDrains++;
+    return total;
+}
+
+void FED4::addAccelSample(float x, float y, float z)
+{
+    FedAccelWindow &w = accelWin;
+    const float mag = sqrtf(x * x + y * y + z * z);
+    w.n++;
+    const float delta = mag - w.meanMag;
+    w.meanMag += delta / w.n;
+    w.m2 += delta * (mag - w.meanMag);
+    w.sumX += x;
+    w.sumY += y;
+    w.sumZ += z;
+    if (accelHavePrev) {
+        // One knock per run of large jumps (a bump rings for several samples)
+        const float dx = x - accelPrev[0], dy = y - accelPrev[1], dz = z - accelPrev[2];
+        const bool jump = sqrtf(dx * dx + dy * dy + dz * dz) >= accelKnockG;
+        if (jump && !accelInKnock) {
+            w.knocks++;
+        }
+        accelInKnock = jump;
+    }
+    accelPrev[0] = x;
+    accelPrev[1] = y;
+    accelPrev[2] = z;
+    accelHavePrev = true;
+}
+
+/** Close the window every accelWindowSeconds: metrics into accelActivity, Bump/Moved rows. */
+void FED4::updateAccelActivity()
+{
+    if (!accelFifoActive || millis() - accelWindowStartMs < (uint32_t)accelWindowSeconds * 1000UL) {
+        return;
+    }
+    drainAccelFifo();
+    const FedAccelWindow w = accelWin;
+    accelWin = FedAccelWindow();
+    accelWindowStartMs = millis();
+    if (w.n < 2) {
+        return;
+    }
+
+    FedAccelActivity &a = accelActivity;
+    a.samples = w.n;
+    a.meanMagG = w.meanMag;
+    a.magVarianceG2 = w.m2 / (w.n - 1);
+    a.knocks = w.knocks;
+    a.endMs = millis();
+    const float gx = w.sumX / w.n, gy = w.sumY / w.n, gz = w.sumZ / w.n;
+    a.tiltChangeDeg = 0.0f;
+    if (accelHaveGravity) {
+        const float dot = gx * accelGravity[0] + gy * accelGravity[1] + gz * accelGravity[2];
+        const float norms = sqrtf(gx * gx + gy * gy + gz * gz) *
+                            sqrtf(accelGravity[0] * accelGravity[0] + accelGravity[1] * accelGravity[1] +
+                                  accelGravity[2] * accelGravity[2]);
+        if (norms > 0) {
+            a.tiltChangeDeg = acosf(constrain(dot / norms, -1.0f, 1.0f)) * 57.29578f;
+        }
+    }
+    accelGravity[0] = gx;
+    accelGravity[1] = gy;
+    accelGravity[2] = gz;
+    accelHaveGravity = true;
+
+    char detail[112];
+    snprintf(detail, sizeof(detail), "knocks=%u;var_g2=%.5f;tilt_deg=%.1f;samples=%lu;window_s=%u",
+             (unsigned)a.knocks, a.magVarianceG2, a.tiltChangeDeg, (unsigned long)a.samples,
+             (unsigned)accelWindowSeconds);
+    if (a.knocks > 0) {
+        logData("Bump", detail);
+    }
+    if (a.tiltChangeDeg >= accelMovedDeg) {
+        logData("Moved", detail);
+    }
+}
+
+/** GPIO wake during light sleep: arm INT_OR only while the line is idle. */
+void FED4::armAccelWake()
+{
+    if (accelFifoActive && !interruptPending()) {
+        gpio_wakeup_enable((gpio_num_t)INT_OR, GPIO_INTR_LOW_LEVEL);
+    }
+}
+
+/**
+ * After esp_light_sleep_start(): if INT_OR woke us for the FIFO watermark
+ * alone, drain it and return true so startSleep() sleeps on.
+ */
+bool FED4::serviceAccelWake()
+{
+    if (!accelFifoActive || esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_GPIO || !interruptPending()) {
+        return false;
+    }
+    if (digitalRead(BUTTON_1) == HIGH || digitalRead(BUTTON_2) == HIGH || digitalRead(BUTTON_3) == HIGH) {
+        return false;
+    }
+    if (!(accelReadReg(LIS3DH_REG_FIFOSRC) & 0x80)) {
+        return false; // not the watermark: full wake scans the other sources
+    }
+    drainAccelFifo();
+    delayMicroseconds(50);
+    if (interruptPending()) {
+        return false; // another source is asserting too
+    }
+    accelSleepWakes++;
+    return true;
+}
+
+/** True when the FIFO watermark is asserted (scanInterrupts()). */
+bool FED4::accelFifoWatermark()
+{
+    return accelFifoActive && (accelReadReg(LIS3DH_REG_FIFOSRC) & 0x80);
+}
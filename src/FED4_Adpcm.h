@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// IMA-ADPCM (4 bits/sample) block decoder — Microsoft WAV layout, mono.
+// Block: int16 first sample, uint8 step index, uint8 reserved, then
+// (blockAlign - 4) bytes of nibbles, low nibble first. Encoder:
+// scripts/gen-adpcm-clip.py. No Arduino deps, so it also builds on a host.
+
+static constexpr uint16_t FED4_ADPCM_BLOCK_ALIGN = 256; // bytes → 505 samples
+static constexpr uint16_t FED4_ADPCM_BLOCK_MAX = 2048;  // largest block accepted (ffmpeg/sox use ≤2048)
+
+constexpr uint32_t fed4AdpcmSamplesPerBlock(uint16_t blockAlign)
+{
+    return blockAlign > 4 ? (uint32_t)(blockAlign - 4) * 2 + 1 : 0;
+}
+
+struct FedAdpcmTables
+{
+    static constexpr int8_t index[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+    static constexpr int16_t step[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+        253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+        1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+        11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+        32767};
+};
+
+/** Decode one nibble; predictor/index are the running decoder state. */
+inline int16_t fed4AdpcmNibble(int32_t &predictor, int8_t &index, uint8_t nib)
+{
+    const int32_t step = FedAdpcmTables::step[index];
+    int32_t diff = step >> 3;
+    if (nib & 4)
+        diff += step;
+    if (nib & 2)
+        diff += step >> 1;
+    if (nib & 1)
+        diff += step >> 2;
+    predictor += (nib & 8) ? -diff : diff;
+    if (predictor > 32767)
+        predictor = 32767;
+    else if (predictor < -32768)
+        predictor = -32768;
+    index += FedAdpcmTables::index[nib];
+    if (index < 0)
+        index = 0;
+    else if (index > 88)
+        index = 88;
+    return (int16_t)predictor;
+}
+
+/**
+ * Decode one block into out (room for fed4AdpcmSamplesPerBlock(bytes)).
+ * bytes may be short for the tail block. Returns samples written.
+ */
+inline size_t fed4AdpcmDecodeBlock(const uint8_t *block, size_t bytes, int16_t *out)
+{
+    if (bytes < 4)
+        return 0;
+    int32_t predictor = (int16_t)(block[0] | (block[1] << 8));
+    int8_t index = (int8_t)(block[2] > 88 ? 88 : block[2]);
+    size_t n = 0;
+    out[n++] = (int16_t)predictor;
+    for (size_t i = 4; i < bytes; i++)
+    {
+        out[n++] = fed4AdpcmNibble(predictor, index, block[i] & 0x0F);
+        out[n++] = fed4AdpcmNibble(predictor, index, block[i] >> 4);
+    }
+    return n;
+}
@@ -1,12 +1,12 @@
 // src/FED4_Audio.cpp
 // Align with examples/2_UnitTests/FED4-Speaker: I2S mono @ 48 kHz, PSV2 then
 // EXP_AMP_SD HIGH → settle → write (≥256-sample pad for short tones) → SD LOW.
+// Sounds are queued on the audio task (FED4_AudioEngine.cpp); only playTone,
+// playTones, playStartup and resetJingle still wait for the sound to finish.
 // Mario / menuJingle / resetJingle are legacy — flagged for refactor in SRC_AUDIT.
 #include "FED4.h"
 #include "sounds/startup_sound.h"
 
-static constexpr uint32_t FED4_AUDIO_SAMPLE_RATE_HZ = 48000;
-
 /**
  * Initializes the speaker and configures the I2S driver
  * return true if initialization is successful, false otherwise
@@ -24,10 +24,12 @@ bool FED4::initializeSpeaker()
     // Parameters: mode, sample_rate, bits_per_sample, channel_format
     // Using MONO mode with 48000 Hz - good balance for both tones and clicks
     // Higher rates (96000 Hz) work for clicks but cause crunchy longer tones
-    if (!i2s.begin(I2S_MODE_STD, 48000, I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO)) {
+    if (!i2s.begin(I2S_MODE_STD, FED4_AUDIO_SAMPLE_RATE_HZ, I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO)) {
         Serial.println("Failed to initialize I2S");
         return false;
     }
+    ampOn = false;
+    energyLevel(FedPowerState::Audio, 0);
 
     // Load audio silence state from preferences
     if (preferences.begin(PREFS_NAMESPACE, true)) {
@@ -38,6 +40,11 @@ bool FED4::initializeSpeaker()
         }
     }
 
+    if (!startAudioEngine()) {
+        Serial.println("Failed to start audio task");
+        return false;
+    }
+
     return true;
 }
 
@@ -53,6 +60,8 @@ void FED4::enableAmp(bool enable)
     }
     
     mcp.digitalWrite(EXP_AMP_SD, enable ? HIGH : LOW);
+    ampOn = enable;
+    energyLevel(FedPowerState::Audio, enable ? 256 : 0);
     if (enable)
     {
         delay(1); // stabilize amp
@@ -65,7 +74,10 @@ void FED4::enableAmp(bool enable)
  */
 void FED4::silence()
 {
+    stopAudio();
     mcp.digitalWrite(EXP_AMP_SD, LOW);
+    ampOn = false;
+    energyLevel(FedPowerState::Audio, 0);
     audioSilenced = true; // Set flag to prevent re-enabling
     
     // Save silence state to preferences
@@ -99,86 +111,45 @@ void FED4::unsilence()
 
 /**
  * Plays a single tone at a specified frequency for a given duration
+ * Blocking wrapper over playToneAsync() — returns once the tone has played.
  * @param frequency Frequency of the tone in Hz
  * @param duration_ms Duration of the tone in milliseconds
  * @param amplitude Amplitude of the tone between 0.0 and 1.0 (default 0.25)
  */
 void FED4::playTone(uint32_t frequency, uint32_t duration_ms, float amplitude)
 {
-    // Bypass audioSilenced check for immediate playback (needed for click feedback)
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);  // Stabilize amp
-    
-    // Generate and play tone
-    const uint32_t sampleRate = FED4_AUDIO_SAMPLE_RATE_HZ;
-    const uint32_t originalSampleCount = (sampleRate * duration_ms) / 1000;
-    const float twoPiF = 2.0 * M_PI * frequency;
-
-    // Ensure minimum 256 samples (one full buffer) for reliable I2S transmission
-    // I2S write is asynchronous - we need at least one full buffer queued
-    // to ensure data is available when transmission starts
-    const uint32_t sampleCount = (originalSampleCount < 256) ? 256 : originalSampleCount;
-
-    int16_t sampleBuffer[256];  
-    size_t samplesInBuffer = 0;
-
-    for (uint32_t i = 0; i < sampleCount; i++)
-    {
-        // Generate tone sample if within original duration, otherwise pad with silence
-        if (i < originalSampleCount)
-        {
-            float sample = amplitude * sin((twoPiF * i) / sampleRate);
-            sampleBuffer[samplesInBuffer++] = (int16_t)(sample * 32767);
-        }
-        else
-        {
-            sampleBuffer[samplesInBuffer++] = 0;  // Silence padding for short sounds
-        }
-
-        if (samplesInBuffer >= 256)
-        {
-            i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-            samplesInBuffer = 0;
-        }
-    }
-
-    // Write remaining samples - ensure all data is written before disabling amp
-    if (samplesInBuffer > 0)
+    // Bypasses audioSilenced for immediate playback (needed for click feedback)
+    if (playToneAsync(frequency, duration_ms, amplitude, true))
     {
-        i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
+        waitAudioIdle(duration_ms + 1000);
     }
-    
-    // Keep amp enabled long enough for transmission to start
-    // At 48000 Hz: 256 samples = ~5.3ms transmission time
-    // Small delay ensures I2S DMA has started transmitting before disabling
-    delayMicroseconds(500);
-    
-    mcp.digitalWrite(EXP_AMP_SD, LOW);  // Disable amp
 }
 
-/**
- * Represents a tone with a frequency and duration
- */
-struct Tone
-{
-    uint32_t frequency;
-    uint32_t duration_ms;
-};
-
+/** Plays tones back to back under one amp enable; blocks until done. */
 void FED4::playTones(const Tone *tones, size_t count)
 {
     if (!count)
         return;
 
-    for (size_t i = 0; i < count; i++)
+    FedAudioNote notes[FED4_AUDIO_MAX_NOTES];
+    uint32_t totalMs = 0;
+    for (size_t i = 0; i < count;)
     {
-        playTone(tones[i].frequency, tones[i].duration_ms, 0.25);
+        size_t n = 0;
+        for (; n < FED4_AUDIO_MAX_NOTES && i < count; n++, i++)
+        {
+            notes[n] = fed4Note((uint16_t)min<uint32_t>(tones[i].frequency, 0xFFFF),
+                                (uint16_t)min<uint32_t>(tones[i].duration_ms, 0xFFFF), tones[i].amplitude);
+            totalMs += tones[i].duration_ms;
+        }
+        playSequenceAsync(notes, n, true);
     }
+    waitAudioIdle(totalMs + 1000);
 }
 
 /**
- * Plays the Demo-Hardware "Welcome to FED4" PCM boot clip (~2.5 s TTS).
- * Blocking; amp path matches FED4-Speaker / playTone (SD HIGH → play → SD LOW).
+ * Plays the Demo-Hardware "Welcome to FED4" boot clip (~2.5 s TTS, IMA-ADPCM).
+ * Blocking (boot only); decoded from flash by the audio task.
  * Boot clip ignores audioSilenced so the device still announces on power-up;
  * runtime tones/jingles continue to honor the silence preference.
  */
@@ -188,25 +159,9 @@ void FED4::playStartup()
         Serial.println("playStartup: NVS audioSilenced=true (boot clip still plays)");
     }
 
-    // Speaker UT: amp on PSV2, SD HIGH, short settle, then I2S
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    constexpr size_t CHUNK = 256;
-    int16_t buf[CHUNK];
-    for (size_t i = 0; i < STARTUP_PCM_SAMPLES;) {
-        size_t n = STARTUP_PCM_SAMPLES - i;
-        if (n > CHUNK) {
-            n = CHUNK;
-        }
-        memcpy_P(buf, &STARTUP_PCM[i], n * sizeof(int16_t));
-        i2s.write((uint8_t *)buf, n * sizeof(int16_t));
-        i += n;
+    if (playAdpcmAsync(STARTUP_ADPCM, STARTUP_ADPCM_SAMPLES, STARTUP_ADPCM_BLOCK_ALIGN, true)) {
+        waitAudioIdle(STARTUP_ADPCM_SAMPLES / (FED4_AUDIO_SAMPLE_RATE_HZ / 1000) + 1000);
     }
-
-    // Drain: clip is long; give DMA time before cutting amp (Speaker uses 500 µs for short tones)
-    delay(20);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
 }
 
 /**
@@ -214,87 +169,111 @@ void FED4::playStartup()
  */
 void FED4::resetSpeaker()
 {
+    stopAudio();
+    waitAudioIdle(1000);
     i2s.end();
     delay(10);
     initializeSpeaker();
 }
 
+// ── Sound stimuli (queued — return immediately) ─────────────────────────────
+
+static const FedAudioNote kBopBeep[] = {fed4Note(1000, 300, 0.25f), fed4Note(1600, 100, 0.5f)};
+
+static const FedAudioNote kResetJingle[] = {
+    // Descending sequence to signify "powering down"
+    fed4Note(1500, 80, 0.15f), fed4Note(1300, 80, 0.15f), fed4Note(1100, 80, 0.15f),
+    fed4Note(900, 80, 0.15f), fed4Note(700, 80, 0.15f), fed4Note(500, 100, 0.15f),
+    fed4Note(300, 120, 0.15f), fed4Note(200, 400, 0.15f),
+    fed4Rest(200), // longer dramatic pause
+    // Ascending sequence to signify "powering up"
+    fed4Note(300, 30, 0.15f), fed4Note(600, 30, 0.2f), fed4Note(900, 30, 0.2f),
+    fed4Note(1200, 50, 0.2f), fed4Note(1500, 100, 0.2f),
+    // Final flourish
+    fed4Rest(500), fed4Note(1600, 300, 0.15f)};
+
+static const FedAudioNote kMenuJingle[] = {
+    // Playful ascending arpeggio
+    fed4Note(800, 80, 0.3f), fed4Note(1000, 60, 0.3f), fed4Note(1200, 40, 0.3f), fed4Rest(50),
+    // Quick descending cascade
+    fed4Note(2000, 30, 0.25f), fed4Note(1600, 30, 0.25f), fed4Note(1200, 30, 0.25f), fed4Rest(30),
+    // Final cheerful flourish
+    fed4Note(1500, 120, 0.4f), fed4Note(2000, 80, 0.3f)};
+
+/** Square-wave SFX notes: more "8-bit" than sine. */
+static constexpr FedAudioNote fed4Sq(uint16_t frequency, uint16_t durationMs, float amplitude, uint8_t fadeMs = 2)
+{
+    return fed4Note(frequency, durationMs, amplitude, FedWave::Square, fadeMs);
+}
+
+// Classic fast upward "ping" motif (approximation)
+static const FedAudioNote kMarioCoin[] = {
+    fed4Sq(1661, 18, 0.40f), // G#6-ish bite
+    fed4Rest(6),             // tiny rest
+    fed4Sq(2637, 60, 0.42f)}; // E7-ish ring
+
+// Stepped upward glide
+static const FedAudioNote kMarioJump[] = {
+    fed4Sq(740, 22, 0.28f), fed4Sq(988, 22, 0.28f), fed4Sq(1319, 24, 0.30f), fed4Sq(1760, 26, 0.30f)};
+
+// Downward "bloop" with a low tail
+static const FedAudioNote kMarioPipe[] = {
+    fed4Sq(988, 28, 0.26f), fed4Sq(740, 28, 0.26f), fed4Sq(523, 30, 0.26f),
+    fed4Sq(392, 36, 0.24f), fed4Sq(262, 55, 0.22f)};
+
+// Rapid staccato bursts (~1ms fade for sharper attacks)
+static const FedAudioNote kMarioFireball[] = {
+    fed4Sq(1319, 18, 0.28f, 1), fed4Rest(6), fed4Sq(1568, 18, 0.28f, 1), fed4Rest(6),
+    fed4Sq(1760, 18, 0.28f, 1), fed4Rest(6), fed4Sq(1568, 18, 0.28f, 1), fed4Rest(6),
+    fed4Sq(1319, 22, 0.28f, 1)};
+
+// Power-up style rising arpeggio (approximation): C5 E5 G5 C6 E6 G6 C7
+static const FedAudioNote kMarioMushroom[] = {
+    fed4Sq(523, 30, 0.24f), fed4Sq(659, 30, 0.24f), fed4Sq(784, 30, 0.24f), fed4Sq(1046, 32, 0.26f),
+    fed4Sq(1319, 32, 0.26f), fed4Sq(1568, 32, 0.26f), fed4Sq(2093, 70, 0.28f)};
+
+#define FED4_NOTES(a) (a), sizeof(a) / sizeof((a)[0])
+
 /**
- * Plays a two-tone beep sequence - a lower tone (500 Hz) followed by a higher tone (800 Hz)
+ * Plays a two-tone beep sequence - a lower tone (1000 Hz) followed by a higher tone (1600 Hz)
  */
 void FED4::bopBeep(){
-    playTone(1000, 300, 0.25);  
-    playTone(1600, 100, 0.5);     
+    playSequenceAsync(FED4_NOTES(kBopBeep), true);
 }
 
-void FED4::resetJingle() { // 🎵 Power cycle jingle
-    // Descending sequence to signify "powering down"
-    playTone(1500, 80, 0.15);    // Starting even higher
-    playTone(1300, 80, 0.15);    // First step down
-    playTone(1100, 80, 0.15);  // Continuing descent
-    playTone(900, 80, 0.15);   // Mid-range
-    playTone(700, 80, 0.15);   // Getting lower
-    playTone(500, 100, 0.15);  // Lower still
-    playTone(300, 120, 0.15);  // Almost there
-    playTone(200, 400, 0.15);  // Final deep note
-    delay(200);                 // Longer dramatic pause
-    
-    // Ascending sequence to signify "powering up" 
-    playTone(300, 30, 0.15);     // Quick low start
-    playTone(600, 30, 0.2);     // Building up
-    playTone(900, 30, 0.2);     // Getting stronger
-    playTone(1200, 50, 0.2);   // Peak
-    playTone(1500, 100, 0.2);   // Triumphant final note
-    
-    // Final flourish
-    delay(500);
-    playTone(1600, 300, 0.15);    // Quick high note
+/** Power cycle jingle — blocking, since callers restart right after it. */
+void FED4::resetJingle() {
+    playSequenceAsync(FED4_NOTES(kResetJingle), true);
+    waitAudioIdle(5000);
 }
 
 void FED4::menuJingle(){
-    // Playful ascending arpeggio
-    playTone(800, 80, 0.3);   // Root note
-    playTone(1000, 60, 0.3);  // Major third
-    playTone(1200, 40, 0.3);  // Fifth
-    delay(50);                // Brief pause
-    
-    // Quick descending cascade
-    playTone(2000, 30, 0.25);
-    playTone(1600, 30, 0.25); 
-    playTone(1200, 30, 0.25);
-    
-    delay(30);  // Micro pause
-    
-    // Final cheerful flourish
-    playTone(1500, 120, 0.4);  // Longer ending note
-    playTone(2000, 80, 0.3);   // Quick high finish
+    playSequenceAsync(FED4_NOTES(kMenuJingle), true);
 }
     
 /**
- * Plays a single low-pitched beep at 300 Hz
+ * Plays a single low-pitched beep at 500 Hz
  */
 void FED4::lowBeep(){
-    playTone(500, 200, 0.4);  // Play 500 Hz for 200ms at 40% amplitude
-
+    playToneAsync(500, 200, 0.4, true);  // Play 500 Hz for 200ms at 40% amplitude
 }
 
 /**
  * Plays a single high-pitched beep at 1000 Hz
  */
 void FED4::highBeep(){
-    playTone(1000, 200, 0.4); // Play 1000 Hz for 200ms at 40% amplitude
+    playToneAsync(1000, 200, 0.4, true); // Play 1000 Hz for 200ms at 40% amplitude
 }
 
 /**
  * Plays a single very high-pitched beep at 2000 Hz
  */
 void FED4::higherBeep(){
-    playTone(2000, 200, 0.4); // Play 2000 Hz for 200ms at 40% amplitude
-
+    playToneAsync(2000, 200, 0.4, true); // Play 2000 Hz for 200ms at 40% amplitude
 }
 
 /**
- * Plays a very short click sound
+ * Plays a very short click sound (queued — never delays touch capture)
  */
 void FED4::click(){
     noise(8, 0.1);
@@ -306,355 +285,54 @@ void FED4::click(){
  * @param endFreq Ending frequency in Hz (default 1500) 
  * @param duration_ms Total duration of the sweep in milliseconds (default 1000)
  * 
- * The sweep is broken into 50 discrete steps, with each step playing a tone
- * at an incrementally higher/lower frequency to create a smooth transition.
- * Each tone is played at 25% amplitude to avoid distortion.
+ * One continuous phase-accumulator glide at 25% amplitude with a short fade in/out.
  */
 void FED4::soundSweep(uint32_t startFreq, uint32_t endFreq, uint32_t duration_ms) {
-    // Create a smooth frequency sweep from startFreq to endFreq
-    const int steps = 50; // Number of frequency steps
-    const int freqStart = startFreq;
-    const int freqEnd = endFreq;
-    const int stepDuration = duration_ms / steps; // Total duration_ms divided into steps
-    
-    for (int i = 0; i < steps; i++) {
-        int freq = freqStart + ((freqEnd - freqStart) * i / steps);
-        playTone(freq, stepDuration, 0.25);
-    }
+    FedAudioNote note = fed4Note((uint16_t)min<uint32_t>(startFreq, 0xFFFF),
+                                 (uint16_t)min<uint32_t>(duration_ms, 0xFFFF), 0.25f);
+    note.glideToHz = (uint16_t)min<uint32_t>(endFreq, 0xFFFF);
+    playSequenceAsync(&note, 1, true);
 }
 
 /**
- * Generates white noise by playing random samples for a specified duration
+ * Generates white noise for a specified duration
  * @param duration_ms Duration of the noise in milliseconds (default 1000)
  * @param amplitude Amplitude of the noise between 0.0 and 1.0 (default 1.0)
  * 
- * Uses random number generation to create white noise samples that are played
- * through the speaker. Each sample is scaled by the amplitude parameter to
- * control the volume of the noise.
+ * xorshift32 samples at the I2S rate. No envelope — click() relies on the sharp edge.
  */
 void FED4::noise(uint32_t duration_ms, float amplitude){
-    // Important: generate noise at the same rate I2S is clocking out,
-    // otherwise noise duration/pitch will be distorted.
-    const uint32_t sampleRate = FED4_AUDIO_SAMPLE_RATE_HZ;
-    const uint32_t sampleCount = (sampleRate * duration_ms) / 1000;
-    
-    int16_t sampleBuffer[256];
-    size_t samplesInBuffer = 0;
-
-    // Use random numbers to generate white noise
-    for (uint32_t i = 0; i < sampleCount; i++) {
-        // Generate random value between -1 and 1
-        float sample = (((float)random(0, 65536) / 32768.0f) - 1.0f) * amplitude;
-        sampleBuffer[samplesInBuffer++] = (int16_t)(sample * 32767);
-
-        if (samplesInBuffer >= 256) {
-            i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-            samplesInBuffer = 0;
-        }
-    }
-
-    // Write any remaining samples
-    if (samplesInBuffer > 0) {
-        i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-    }
+    const FedAudioNote note = fed4Note(0, (uint16_t)min<uint32_t>(duration_ms, 0xFFFF), amplitude,
+                                       FedWave::Noise, 0);
+    playSequenceAsync(&note, 1);
 }
 
 void FED4::marioCoin()
 {
     if (audioSilenced) return;
-
-    // Approximation using a square wave + short envelope to get closer to the classic timbre.
-    auto playSquare = [&](uint32_t frequency, uint32_t duration_ms, float amplitude) {
-        const uint32_t sampleCount = (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
-        const uint32_t fadeSamples = min<uint32_t>((FED4_AUDIO_SAMPLE_RATE_HZ * 2) / 1000, sampleCount / 2); // ~2ms fade
-        const float halfPeriodSamples = (frequency > 0) ? (float)FED4_AUDIO_SAMPLE_RATE_HZ / (2.0f * (float)frequency) : 0.0f;
-
-        int16_t sampleBuffer[256];
-        size_t samplesInBuffer = 0;
-
-        float phaseSamples = 0.0f;
-        int sign = 1;
-
-        for (uint32_t i = 0; i < sampleCount; i++) {
-            float env = 1.0f;
-            if (fadeSamples > 0) {
-                if (i < fadeSamples) env = (float)i / (float)fadeSamples;
-                else if (i > (sampleCount - fadeSamples)) env = (float)(sampleCount - i) / (float)fadeSamples;
-            }
-
-            int16_t s = 0;
-            if (frequency > 0) {
-                const float scaled = amplitude * env * 32767.0f;
-                s = (int16_t)(sign * scaled);
-
-                phaseSamples += 1.0f;
-                if (phaseSamples >= halfPeriodSamples) {
-                    phaseSamples -= halfPeriodSamples;
-                    sign = -sign;
-                }
-            }
-
-            sampleBuffer[samplesInBuffer++] = s;
-            if (samplesInBuffer >= 256) {
-                i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-                samplesInBuffer = 0;
-            }
-        }
-
-        if (samplesInBuffer > 0) {
-            i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-        }
-    };
-
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    // Classic fast upward "ping" motif (approximation)
-    playSquare(1661, 18, 0.40f); // G#6-ish bite
-    playSquare(0,    6,  0.00f); // tiny rest
-    playSquare(2637, 60, 0.42f); // E7-ish ring
-
-    delayMicroseconds(500);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
+    playSequenceAsync(FED4_NOTES(kMarioCoin));
 }
 
 void FED4::marioJump()
 {
     if (audioSilenced) return;
-
-    auto playSquare = [&](uint32_t frequency, uint32_t duration_ms, float amplitude) {
-        const uint32_t sampleCount = (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
-        const uint32_t fadeSamples = min<uint32_t>((FED4_AUDIO_SAMPLE_RATE_HZ * 2) / 1000, sampleCount / 2);
-        const float halfPeriodSamples = (frequency > 0) ? (float)FED4_AUDIO_SAMPLE_RATE_HZ / (2.0f * (float)frequency) : 0.0f;
-
-        int16_t sampleBuffer[256];
-        size_t samplesInBuffer = 0;
-        float phaseSamples = 0.0f;
-        int sign = 1;
-
-        for (uint32_t i = 0; i < sampleCount; i++) {
-            float env = 1.0f;
-            if (fadeSamples > 0) {
-                if (i < fadeSamples) env = (float)i / (float)fadeSamples;
-                else if (i > (sampleCount - fadeSamples)) env = (float)(sampleCount - i) / (float)fadeSamples;
-            }
-
-            int16_t s = 0;
-            if (frequency > 0) {
-                const float scaled = amplitude * env * 32767.0f;
-                s = (int16_t)(sign * scaled);
-
-                phaseSamples += 1.0f;
-                if (phaseSamples >= halfPeriodSamples) {
-                    phaseSamples -= halfPeriodSamples;
-                    sign = -sign;
-                }
-            }
-
-            sampleBuffer[samplesInBuffer++] = s;
-            if (samplesInBuffer >= 256) {
-                i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-                samplesInBuffer = 0;
-            }
-        }
-
-        if (samplesInBuffer > 0) {
-            i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-        }
-    };
-
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    // Stepped upward glide (square wave is more "8-bit" than sine)
-    playSquare(740,  22, 0.28f);
-    playSquare(988,  22, 0.28f);
-    playSquare(1319, 24, 0.30f);
-    playSquare(1760, 26, 0.30f);
-
-    delayMicroseconds(500);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
+    playSequenceAsync(FED4_NOTES(kMarioJump));
 }
 
 void FED4::marioPipe()
 {
     if (audioSilenced) return;
-
-    auto playSquare = [&](uint32_t frequency, uint32_t duration_ms, float amplitude) {
-        const uint32_t sampleCount = (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
-        const uint32_t fadeSamples = min<uint32_t>((FED4_AUDIO_SAMPLE_RATE_HZ * 2) / 1000, sampleCount / 2);
-        const float halfPeriodSamples = (frequency > 0) ? (float)FED4_AUDIO_SAMPLE_RATE_HZ / (2.0f * (float)frequency) : 0.0f;
-
-        int16_t sampleBuffer[256];
-        size_t samplesInBuffer = 0;
-        float phaseSamples = 0.0f;
-        int sign = 1;
-
-        for (uint32_t i = 0; i < sampleCount; i++) {
-            float env = 1.0f;
-            if (fadeSamples > 0) {
-                if (i < fadeSamples) env = (float)i / (float)fadeSamples;
-                else if (i > (sampleCount - fadeSamples)) env = (float)(sampleCount - i) / (float)fadeSamples;
-            }
-
-            int16_t s = 0;
-            if (frequency > 0) {
-                const float scaled = amplitude * env * 32767.0f;
-                s = (int16_t)(sign * scaled);
-
-                phaseSamples += 1.0f;
-                if (phaseSamples >= halfPeriodSamples) {
-                    phaseSamples -= halfPeriodSamples;
-                    sign = -sign;
-                }
-            }
-
-            sampleBuffer[samplesInBuffer++] = s;
-            if (samplesInBuffer >= 256) {
-                i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-                samplesInBuffer = 0;
-            }
-        }
-
-        if (samplesInBuffer > 0) {
-            i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-        }
-    };
-
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    // Downward "bloop" with a low tail
-    playSquare(988,  28, 0.26f);
-    playSquare(740,  28, 0.26f);
-    playSquare(523,  30, 0.26f);
-    playSquare(392,  36, 0.24f);
-    playSquare(262,  55, 0.22f);
-    
-    delayMicroseconds(500);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
+    playSequenceAsync(FED4_NOTES(kMarioPipe));
 }
 
 void FED4::marioFireball()
 {
     if (audioSilenced) return;
-
-    auto playSquare = [&](uint32_t frequency, uint32_t duration_ms, float amplitude) {
-        const uint32_t sampleCount = (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
-        const uint32_t fadeSamples = min<uint32_t>((FED4_AUDIO_SAMPLE_RATE_HZ * 1) / 1000, sampleCount / 2); // ~1ms fade for sharper attacks
-        const float halfPeriodSamples = (frequency > 0) ? (float)FED4_AUDIO_SAMPLE_RATE_HZ / (2.0f * (float)frequency) : 0.0f;
-
-        int16_t sampleBuffer[256];
-        size_t samplesInBuffer = 0;
-        float phaseSamples = 0.0f;
-        int sign = 1;
-
-        for (uint32_t i = 0; i < sampleCount; i++) {
-            float env = 1.0f;
-            if (fadeSamples > 0) {
-                if (i < fadeSamples) env = (float)i / (float)fadeSamples;
-                else if (i > (sampleCount - fadeSamples)) env = (float)(sampleCount - i) / (float)fadeSamples;
-            }
-
-            int16_t s = 0;
-            if (frequency > 0) {
-                const float scaled = amplitude * env * 32767.0f;
-                s = (int16_t)(sign * scaled);
-
-                phaseSamples += 1.0f;
-                if (phaseSamples >= halfPeriodSamples) {
-                    phaseSamples -= halfPeriodSamples;
-                    sign = -sign;
-                }
-            }
-
-            sampleBuffer[samplesInBuffer++] = s;
-            if (samplesInBuffer >= 256) {
-                i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-                samplesInBuffer = 0;
-            }
-        }
-
-        if (samplesInBuffer > 0) {
-            i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-        }
-    };
-
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    // Rapid staccato bursts
-    playSquare(1319, 18, 0.28f);
-    playSquare(0,     6, 0.00f);
-    playSquare(1568, 18, 0.28f);
-    playSquare(0,     6, 0.00f);
-    playSquare(1760, 18, 0.28f);
-    playSquare(0,     6, 0.00f);
-    playSquare(1568, 18, 0.28f);
-    playSquare(0,     6, 0.00f);
-    playSquare(1319, 22, 0.28f);
-
-    delayMicroseconds(500);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
+    playSequenceAsync(FED4_NOTES(kMarioFireball));
 }
 
 void FED4::marioMushroom()
 {
     if (audioSilenced) return;
-
-    auto playSquare = [&](uint32_t frequency, uint32_t duration_ms, float amplitude) {
-        const uint32_t sampleCount = (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
-        const uint32_t fadeSamples = min<uint32_t>((FED4_AUDIO_SAMPLE_RATE_HZ * 2) / 1000, sampleCount / 2);
-        const float halfPeriodSamples = (frequency > 0) ? (float)FED4_AUDIO_SAMPLE_RATE_HZ / (2.0f * (float)frequency) : 0.0f;
-
-        int16_t sampleBuffer[256];
-        size_t samplesInBuffer = 0;
-        float phaseSamples = 0.0f;
-        int sign = 1;
-
-        for (uint32_t i = 0; i < sampleCount; i++) {
-            float env = 1.0f;
-            if (fadeSamples > 0) {
-                if (i < fadeSamples) env = (float)i / (float)fadeSamples;
-                else if (i > (sampleCount - fadeSamples)) env = (float)(sampleCount - i) / (float)fadeSamples;
-            }
-
-            int16_t s = 0;
-            if (frequency > 0) {
-                const float scaled = amplitude * env * 32767.0f;
-                s = (int16_t)(sign * scaled);
-
-                phaseSamples += 1.0f;
-                if (phaseSamples >= halfPeriodSamples) {
-                    phaseSamples -= halfPeriodSamples;
-                    sign = -sign;
-                }
-            }
-
-            sampleBuffer[samplesInBuffer++] = s;
-            if (samplesInBuffer >= 256) {
-                i2s.write((uint8_t*)sampleBuffer, sizeof(sampleBuffer));
-                samplesInBuffer = 0;
-            }
-        }
-
-        if (samplesInBuffer > 0) {
-            i2s.write((uint8_t*)sampleBuffer, samplesInBuffer * sizeof(int16_t));
-        }
-    };
-
-    mcp.digitalWrite(EXP_AMP_SD, HIGH);
-    delay(1);
-
-    // Power-up style rising arpeggio (approximation)
-    playSquare(523,  30, 0.24f);  // C5
-    playSquare(659,  30, 0.24f);  // E5
-    playSquare(784,  30, 0.24f);  // G5
-    playSquare(1046, 32, 0.26f);  // C6
-    playSquare(1319, 32, 0.26f);  // E6
-    playSquare(1568, 32, 0.26f);  // G6
-    playSquare(2093, 70, 0.28f);  // C7
-
-    delayMicroseconds(500);
-    mcp.digitalWrite(EXP_AMP_SD, LOW);
+    playSequenceAsync(FED4_NOTES(kMarioMushroom));
 }
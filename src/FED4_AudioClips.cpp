@@ -0,0 +1,143 @@
+#include "FED4.h"
+
+// ── SD audio clips ───────────────────────────────────────────────────────────
+// Cue sounds that change without recompiling: a 48 kHz mono WAV (16-bit PCM,
+// or IMA-ADPCM from scripts/gen-adpcm-clip.py --wav / sox / ffmpeg) is read
+// into RAM once, in loop context, so the audio task never touches the SPI bus
+// shared with the SD card and display.
+
+static const uint32_t FED4_AUDIO_CLIP_MAX_BYTES = 512UL * 1024UL; // ~21 s ADPCM, ~5 s PCM
+
+static uint16_t fed4Le16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t fed4Le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Load a WAV clip from SD. Returns false (clip untouched) on a missing file,
+ * unsupported format or allocation failure. Free with freeAudioClip().
+ */
+bool FED4::loadAudioClip(const char *path, FedAudioClip &clip)
+{
+    if (!sdCardAvailable)
+    {
+        Serial.println("loadAudioClip: SD card not available");
+        return false;
+    }
+
+    SPI.setBitOrder(MSBFIRST);
+    File f = SD.open(path, FILE_READ);
+    if (!f)
+    {
+        Serial.printf("loadAudioClip: cannot open %s\n", path);
+        reclaimSpiForDisplay();
+        return false;
+    }
+
+    uint8_t hdr[12];
+    bool ok = f.read(hdr, 12) == 12 && memcmp(hdr, "RIFF", 4) == 0 && memcmp(hdr + 8, "WAVE", 4) == 0;
+
+    uint16_t format = 0, channels = 0, blockAlign = 0, bits = 0;
+    uint32_t rate = 0, factSamples = 0, dataBytes = 0;
+    bool haveData = false;
+    while (ok && !haveData)
+    {
+        uint8_t ch[8];
+        if (f.read(ch, 8) != 8)
+            break;
+        const uint32_t size = fed4Le32(ch + 4);
+        if (memcmp(ch, "fmt ", 4) == 0 && size >= 16)
+        {
+            uint8_t fmt[16];
+            ok = f.read(fmt, 16) == 16;
+            format = fed4Le16(fmt);
+            channels = fed4Le16(fmt + 2);
+            rate = fed4Le32(fmt + 4);
+            blockAlign = fed4Le16(fmt + 12);
+            bits = fed4Le16(fmt + 14);
+            ok = ok && f.seek(f.position() + (size - 16) + (size & 1));
+        }
+        else if (memcmp(ch, "fact", 4) == 0 && size >= 4)
+        {
+            uint8_t fact[4];
+            ok = f.read(fact, 4) == 4;
+            factSamples = fed4Le32(fact);
+            ok = ok && f.seek(f.position() + (size - 4) + (size & 1));
+        }
+        else if (memcmp(ch, "data", 4) == 0)
+        {
+            dataBytes = min<uint32_t>(size, f.size() - f.position());
+            haveData = true;
+        }
+        else
+        {
+            ok = f.seek(f.position() + size + (size & 1));
+        }
+    }
+
+    const bool pcm = (format == 1 && bits == 16);
+    const bool adpcm = (format == 0x11 && bits == 4 && blockAlign > 4 && blockAlign <= FED4_ADPCM_BLOCK_MAX);
+    if (!ok || !haveData || channels != 1 || rate != FED4_AUDIO_SAMPLE_RATE_HZ || !(pcm || adpcm) ||
+        dataBytes == 0 || dataBytes > FED4_AUDIO_CLIP_MAX_BYTES)
+    {
+        Serial.printf("loadAudioClip: %s is not a 48 kHz mono PCM16/IMA-ADPCM WAV (fmt=0x%x ch=%u rate=%lu bytes=%lu)\n",
+                      path, format, channels, (unsigned long)rate, (unsigned long)dataBytes);
+        f.close();
+        reclaimSpiForDisplay();
+        return false;
+    }
+
+    uint8_t *data = (uint8_t *)(psramFound() ? ps_malloc(dataBytes) : malloc(dataBytes));
+    if (data == nullptr)
+    {
+        Serial.printf("loadAudioClip: no memory for %lu bytes\n", (unsigned long)dataBytes);
+        f.close();
+        reclaimSpiForDisplay();
+        return false;
+    }
+    ok = f.read(data, dataBytes) == dataBytes;
+    f.close();
+    reclaimSpiForDisplay();
+    if (!ok)
+    {
+        free(data);
+        Serial.printf("loadAudioClip: short read on %s\n", path);
+        return false;
+    }
+
+    freeAudioClip(clip);
+    clip.data = data;
+    clip.bytes = dataBytes;
+    if (pcm)
+    {
+        clip.blockAlign = 0;
+        clip.samples = dataBytes / 2;
+    }
+    else
+    {
+        const uint32_t perBlock = fed4AdpcmSamplesPerBlock(blockAlign);
+        const uint32_t tail = dataBytes % blockAlign;
+        clip.blockAlign = blockAlign;
+        clip.samples = (dataBytes / blockAlign) * perBlock + (tail > 4 ? (tail - 4) * 2 + 1 : 0);
+        if (factSamples && factSamples < clip.samples)
+            clip.samples = factSamples;
+    }
+    Serial.printf("Loaded audio clip %s: %lu samples (%s, %lu B)\n", path, (unsigned long)clip.samples,
+                  pcm ? "PCM" : "ADPCM", (unsigned long)dataBytes);
+    return true;
+}
+
+/** Release a clip; waits for the audio task if it may still be reading it. */
+void FED4::freeAudioClip(FedAudioClip &clip)
+{
+    if (clip.data == nullptr)
+        return;
+    if (audioBusy())
+    {
+        stopAudio();
+        waitAudioIdle(1000);
+    }
+    free(clip.data);
+    clip = FedAudioClip();
+}
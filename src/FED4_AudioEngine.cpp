@@ -0,0 +1,344 @@
+#include "FED4.h"
+#include "FED4_Adpcm.h"
+
+#include <atomic>
+
+// ── Async audio engine ───────────────────────────────────────────────────────
+// One task owns I2S: it takes requests (note sequences or PCM clips) from a
+// FreeRTOS queue and streams them in 256-sample chunks, so callers never wait
+// on the DMA. i2s.write() blocks only the audio task while the DMA is full.
+// Clips are raw 16-bit PCM or IMA-ADPCM blocks (decoded one block at a time),
+// read straight from flash or from a RAM copy made by loadAudioClip().
+// The amp SD line is on the MCP23017, whose writes are read-modify-write over
+// I2C, so the expander is only touched from loop context: enqueueing turns the
+// amp on once per busy period and serviceAudio() turns it off after the queue
+// drains.
+
+static constexpr size_t FED4_AUDIO_CHUNK = 256;       // ≥1 chunk per request (I2S start-up)
+static constexpr UBaseType_t FED4_AUDIO_QUEUE_DEPTH = 8;
+
+enum class FedAudioKind : uint8_t
+{
+    Notes = 0,
+    Pcm,
+    Adpcm
+};
+
+struct FedAudioRequest
+{
+    uint32_t id = 0;
+    FedAudioKind kind = FedAudioKind::Notes;
+    bool settleAmp = false; // amp just enabled — wait 1 ms before the first sample
+    bool bypassMute = false; // enable the amp even when audioSilenced (tones, boot clip)
+    uint8_t count = 0;
+    FedAudioNote notes[FED4_AUDIO_MAX_NOTES];
+    const void *data = nullptr; // Pcm: int16_t[], Adpcm: blocks
+    uint32_t samples = 0;
+    uint16_t blockAlign = 0;
+    FedAudioHook hook = nullptr; // internal start/stop report (stimulus onsets)
+    void *hookCtx = nullptr;
+};
+
+static QueueHandle_t sAudioQueue = nullptr;
+static TaskHandle_t sAudioTask = nullptr;
+static std::atomic<uint32_t> sAudioPending{0};  // queued + playing
+static std::atomic<uint32_t> sAudioAbortBelow{0}; // ids below this are dropped
+static uint32_t sNextAudioId = 1;                // loop context only
+static FedAudioRequest sArmed[FED4_MAX_STIMULI]; // armed by loop, posted by timer
+static int16_t sAdpcmBlock[fed4AdpcmSamplesPerBlock(FED4_ADPCM_BLOCK_MAX)]; // audio task only
+
+static uint32_t fed4AudioSamples(uint32_t duration_ms)
+{
+    return (FED4_AUDIO_SAMPLE_RATE_HZ * duration_ms) / 1000;
+}
+
+// ── audio task ───────────────────────────────────────────────────────────────
+
+void FED4::audioTask(void *arg)
+{
+    FED4 *fed = static_cast<FED4 *>(arg);
+    FedAudioRequest req;
+    int16_t buf[FED4_AUDIO_CHUNK];
+
+    for (;;)
+    {
+        if (xQueueReceive(sAudioQueue, &req, portMAX_DELAY) != pdTRUE)
+            continue;
+
+        if (req.id < sAudioAbortBelow.load())
+        {
+            sAudioPending--;
+            continue;
+        }
+        if (req.settleAmp)
+            delay(1); // stabilize amp
+
+        const int64_t startUs = esp_timer_get_time();
+        fed->lastAudioStartUs = startUs;
+        if (fed->onAudioStart)
+            fed->onAudioStart(req.id, startUs);
+
+        uint32_t written = 0;
+        bool aborted = false;
+
+        if (req.kind == FedAudioKind::Notes)
+        {
+            FedToneGen gen;
+            for (uint8_t i = 0; i < req.count && !aborted; i++)
+            {
+                const FedAudioNote &note = req.notes[i];
+                gen.start(note.wave, note.frequency, fed4AudioSamples(note.durationMs),
+                          note.frequency || note.wave == FedWave::Noise ? note.amplitudeQ15 : 0,
+                          fed4AudioSamples(note.fadeMs), FED4_AUDIO_SAMPLE_RATE_HZ);
+                if (note.glideToHz)
+                    gen.glideTo(note.glideToHz);
+
+                size_t n;
+                while ((n = gen.fill(buf, FED4_AUDIO_CHUNK)) != 0)
+                {
+                    fed->i2s.write((uint8_t *)buf, n * sizeof(int16_t));
+                    written += n;
+                    if (req.id < sAudioAbortBelow.load())
+                    {
+                        aborted = true;
+                        break;
+                    }
+                }
+            }
+        }
+        else if (req.kind == FedAudioKind::Pcm)
+        {
+            const int16_t *pcm = static_cast<const int16_t *>(req.data);
+            for (uint32_t i = 0; i < req.samples && !aborted;)
+            {
+                const size_t n = min<uint32_t>(FED4_AUDIO_CHUNK, req.samples - i);
+                memcpy_P(buf, &pcm[i], n * sizeof(int16_t));
+                fed->i2s.write((uint8_t *)buf, n * sizeof(int16_t));
+                written += n;
+                i += n;
+                aborted = req.id < sAudioAbortBelow.load();
+            }
+        }
+        else
+        {
+            // One block (505 samples at 256 B) per I2S write
+            const uint8_t *blocks = static_cast<const uint8_t *>(req.data);
+            const uint32_t perBlock = fed4AdpcmSamplesPerBlock(req.blockAlign);
+            for (uint32_t i = 0; i < req.samples && !aborted;)
+            {
+                const uint32_t left = req.samples - i;
+                const size_t bytes = left >= perBlock ? req.blockAlign : 4 + left / 2;
+                size_t n = fed4AdpcmDecodeBlock(blocks, bytes, sAdpcmBlock);
+                if (n > left)
+                    n = left;
+                fed->i2s.write((uint8_t *)sAdpcmBlock, n * sizeof(int16_t));
+                written += n;
+                i += n;
+                blocks += req.blockAlign;
+                aborted = req.id < sAudioAbortBelow.load();
+            }
+        }
+
+        // Short sounds: pad to one full chunk so the DMA actually starts
+        const uint32_t sounding = written;
+        if (written < FED4_AUDIO_CHUNK)
+        {
+            memset(buf, 0, sizeof(buf));
+            fed->i2s.write((uint8_t *)buf, (FED4_AUDIO_CHUNK - written) * sizeof(int16_t));
+            written = FED4_AUDIO_CHUNK;
+        }
+
+        // The sample clock is exact: sleep until the DMA has clocked everything out
+        const int64_t stopUs = startUs + (int64_t)sounding * 1000000 / FED4_AUDIO_SAMPLE_RATE_HZ;
+        int64_t drainedUs = startUs + (int64_t)written * 1000000 / FED4_AUDIO_SAMPLE_RATE_HZ;
+        // Last request: stay pending until the DMA ring has played the tail,
+        // so serviceAudio()/waitAudioIdle() don't drop the amp under it
+        if (uxQueueMessagesWaiting(sAudioQueue) == 0)
+            drainedUs += (int64_t)(FED4_AUDIO_DMA_DESC - 1) * FED4_AUDIO_DMA_FRAMES * 1000000 / FED4_AUDIO_SAMPLE_RATE_HZ;
+        const int64_t waitUs = drainedUs - esp_timer_get_time();
+        if (waitUs > 0)
+            vTaskDelay(pdMS_TO_TICKS((uint32_t)(waitUs / 1000) + 1));
+
+        fed->lastAudioStopUs = stopUs;
+        if (req.hook)
+            req.hook(req.hookCtx, startUs, stopUs);
+        if (fed->onAudioStop)
+            fed->onAudioStop(req.id, stopUs);
+        sAudioPending--;
+    }
+}
+
+// ── loop-side API ────────────────────────────────────────────────────────────
+
+/** Create the queue and task once; called from initializeSpeaker(). */
+bool FED4::startAudioEngine()
+{
+    if (sAudioTask != nullptr)
+        return true;
+    sAudioQueue = xQueueCreate(FED4_AUDIO_QUEUE_DEPTH, sizeof(FedAudioRequest));
+    if (sAudioQueue == nullptr)
+        return false;
+    // Above loopTask (1) so DMA refills are never starved by the behavior loop
+    return xTaskCreate(audioTask, "fed4Audio", 6144, this, 3, &sAudioTask) == pdPASS;
+}
+
+/**
+ * Loop context: id, amp on, count as pending (so serviceAudio keeps the amp).
+ * While audioSilenced the amp stays off unless req.bypassMute; the request
+ * still plays (and reports its stamps) into a silent amp.
+ */
+void FED4::reserveAudio(FedAudioRequest &req)
+{
+    req.id = sNextAudioId++;
+    req.settleAmp = !ampOn && (!audioSilenced || req.bypassMute);
+    if (req.settleAmp)
+    {
+        mcp.digitalWrite(EXP_AMP_SD, HIGH);
+        ampOn = true;
+        energyLevel(FedPowerState::Audio, 256);
+    }
+    sAudioPending++;
+}
+
+uint32_t FED4::enqueueAudio(FedAudioRequest &req)
+{
+    if (sAudioQueue == nullptr)
+        return 0;
+
+    reserveAudio(req);
+    if (xQueueSend(sAudioQueue, &req, 0) != pdTRUE)
+    {
+        sAudioPending--;
+        return 0;
+    }
+    return req.id;
+}
+
+// ── armed notes (scheduled stimulus onsets) ─────────────────────────────────
+
+/**
+ * Loop context: prepare one note in slot for postArmedAudio() from a timer.
+ * The amp is switched on now, so the onset needs no settle delay later.
+ */
+bool FED4::armAudio(uint8_t slot, const FedAudioNote &note, FedAudioHook hook, void *ctx, bool immediate)
+{
+    if (sAudioQueue == nullptr || slot >= FED4_MAX_STIMULI)
+        return false;
+    FedAudioRequest &req = sArmed[slot];
+    req = FedAudioRequest();
+    req.kind = FedAudioKind::Notes;
+    req.count = 1;
+    req.notes[0] = note;
+    req.hook = hook;
+    req.hookCtx = ctx;
+    req.bypassMute = true; // a scheduled tone, like playTone()
+    reserveAudio(req);
+    if (!immediate)
+        req.settleAmp = false;
+    return true;
+}
+
+/** Any task (esp_timer callback): queue the armed note. */
+bool FED4::postArmedAudio(uint8_t slot)
+{
+    if (xQueueSend(sAudioQueue, &sArmed[slot], 0) != pdTRUE)
+    {
+        sAudioPending--;
+        return false;
+    }
+    return true;
+}
+
+/** Loop context: release an armed note that will never be posted. */
+void FED4::disarmAudio(uint8_t slot)
+{
+    (void)slot;
+    sAudioPending--;
+}
+
+uint32_t FED4::playToneAsync(uint32_t frequency, uint32_t duration_ms, float amplitude, bool bypassMute)
+{
+    const FedAudioNote note = fed4Note((uint16_t)min<uint32_t>(frequency, 0xFFFF),
+                                       (uint16_t)min<uint32_t>(duration_ms, 0xFFFF), amplitude);
+    return playSequenceAsync(&note, 1, bypassMute);
+}
+
+/** Up to FED4_AUDIO_MAX_NOTES notes played back to back under one amp enable. */
+uint32_t FED4::playSequenceAsync(const FedAudioNote *notes, size_t count, bool bypassMute)
+{
+    if (!count)
+        return 0;
+    FedAudioRequest req;
+    req.kind = FedAudioKind::Notes;
+    req.bypassMute = bypassMute;
+    req.count = (uint8_t)min<size_t>(count, FED4_AUDIO_MAX_NOTES);
+    memcpy(req.notes, notes, req.count * sizeof(FedAudioNote));
+    return enqueueAudio(req);
+}
+
+/** 48 kHz mono PCM; the buffer must stay valid until onAudioStop (flash/PROGMEM is fine). */
+uint32_t FED4::playClipAsync(const int16_t *pcm, uint32_t samples)
+{
+    if (pcm == nullptr || samples == 0)
+        return 0;
+    FedAudioRequest req;
+    req.kind = FedAudioKind::Pcm;
+    req.data = pcm;
+    req.samples = samples;
+    return enqueueAudio(req);
+}
+
+/** 48 kHz mono IMA-ADPCM blocks (scripts/gen-adpcm-clip.py); same lifetime rule as PCM. */
+uint32_t FED4::playAdpcmAsync(const uint8_t *blocks, uint32_t samples, uint16_t blockAlign, bool bypassMute)
+{
+    if (blocks == nullptr || samples == 0 || blockAlign <= 4 || blockAlign > FED4_ADPCM_BLOCK_MAX)
+        return 0;
+    FedAudioRequest req;
+    req.kind = FedAudioKind::Adpcm;
+    req.bypassMute = bypassMute;
+    req.data = blocks;
+    req.samples = samples;
+    req.blockAlign = blockAlign;
+    return enqueueAudio(req);
+}
+
+uint32_t FED4::playClipAsync(const FedAudioClip &clip)
+{
+    if (clip.blockAlign)
+        return playAdpcmAsync(clip.data, clip.samples, clip.blockAlign);
+    return playClipAsync(reinterpret_cast<const int16_t *>(clip.data), clip.samples);
+}
+
+bool FED4::audioBusy() const
+{
+    return sAudioPending.load() != 0;
+}
+
+bool FED4::waitAudioIdle(uint32_t timeoutMs)
+{
+    const unsigned long start = millis();
+    while (audioBusy())
+    {
+        if (millis() - start >= timeoutMs)
+            return false;
+        delay(1);
+    }
+    serviceAudio();
+    return true;
+}
+
+/** Drop everything queued and cut the current sound at the next chunk boundary. */
+void FED4::stopAudio()
+{
+    sAudioAbortBelow.store(sNextAudioId);
+}
+
+void FED4::serviceAudio()
+{
+    if (ampOn && !audioBusy())
+    {
+        mcp.digitalWrite(EXP_AMP_SD, LOW);
+        ampOn = false;
+        energyLevel(FedPowerState::Audio, 0);
+    }
+}
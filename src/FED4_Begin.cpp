@@ -163,6 +163,7 @@ bool FED4::begin(const char *programName)
 
     // PIR is on always-on 3.3V — configure early so STATUS_LED can mirror it
     pinMode(PIR_MOTION, INPUT_PULLDOWN);
+    armPir();
 
     // Speaker as early as possible (needs MCP + PSV2 for amp SD) — Demo welcome clip
     Serial.println("Initializing Speaker");
@@ -249,6 +250,9 @@ bool FED4::begin(const char *programName)
         }
     }
 
+    // Warm restart: a recent session checkpoint (needs the wall clock for its age)
+    loadSession();
+
     // Initialize temperature/humidity/pressure/gas sensor BME680
     displayInitStatus("Temp/Humidity");
     Serial.println("Initializing BME680 temperature/humidity/pressure/gas sensor");
@@ -298,7 +302,7 @@ bool FED4::begin(const char *programName)
     // Initialize front LED strip (PSV3 rail)
     Serial.println("Initializing LED Strip");
     statuses["LED Strip"].initialized = initializeStrip();
-    stripRainbow(3, 1);
+    stripRainbowAsync(3, 1);
 
     // Configure GPIO pins
     Serial.println("Initializing GPIO pins");
@@ -318,8 +322,16 @@ bool FED4::begin(const char *programName)
     // Initialize Touch
     Serial.println("Initializing Touch Sensors");
     displayInitStatus("Touch Sensors");
-    statuses["Touch Sensors"].initialized = initializeTouch();
-    calibrateTouchSensors(true);  // Check stability at startup
+    // Baselines come from any recent checkpoint, even if the session itself is not resumed
+    if (restoreSessionTouch())
+    {
+        statuses["Touch Sensors"].initialized = true; // checkpoint baselines still hold
+    }
+    else
+    {
+        statuses["Touch Sensors"].initialized = initializeTouch();
+        calibrateTouchSensors(true);  // Check stability at startup
+    }
 
     // Initialize Buttons
     Serial.println("Initializing Buttons");
@@ -354,7 +366,7 @@ bool FED4::begin(const char *programName)
         }
     }
 
-    stripRainbow(3, 1);
+    stripRainbowAsync(3, 1);
 
     // Initialize ToF sensor (always-on 3.3V, no XSHUT)
     displayInitStatus("Proximity Sensor");
@@ -382,6 +394,9 @@ bool FED4::begin(const char *programName)
         Serial.println("Drop sensor not detected or not working");
     }
 
+    // Photogate edge ISRs (PG1 well, PG2/PG3 lanes, PG4 drop)
+    statuses["Photogates"].initialized = initializePhotogates();
+
     // Initialize solenoids
     displayInitStatus("Solenoids");
     statuses["Solenoids"].initialized = initializeSolenoids();
@@ -544,8 +559,12 @@ bool FED4::begin(const char *programName)
             age = "Unknown";
     }
     logData("Startup");
+    if (resumedSession)
+    {
+        logData("Resume", sessionResumeDetail());
+    }
 
-    stripRainbow(3, 1);
+    stripRainbowAsync(3, 1);
 
     // Print initialization report
     Serial.println("\n=== FED4 Initialization Report ===");
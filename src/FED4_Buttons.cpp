@@ -92,9 +92,10 @@ void FED4::checkButton2()
     holdTime += 100;
     if (holdTime >= 1000)
     {
-      colorWipe("red", 100); // red
+      colorWipe(FED4_COLOR("red"), 100); // red
       resetJingle();
       Serial.println("********** BUTTON 2 FORCED RESET! **********");
+      checkpointSession(); // RTC memory survives esp_restart(): the session resumes
       esp_restart();
       break;
     }
@@ -116,6 +117,8 @@ void FED4::checkButton3()
     {
       // temporarily unmute audio even if it is silenced
       mcp.digitalWrite(EXP_AMP_SD, HIGH);
+      ampOn = true; // serviceAudio() switches it off after the click
+      energyLevel(FedPowerState::Audio, 256);
       click();
     }
 
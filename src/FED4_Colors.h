@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+
+// Strip color names — one constexpr registry for getColorFromString(), cue
+// code and meta.json. Literals resolve at compile time with FED4_COLOR("red")
+// (an unknown name is a compile error); runtime names go through a perfect
+// hash whose seed the compiler finds, so a lookup is one hash of the name plus
+// one compare. Values match FastLED's CRGB constants. No Arduino deps, so it
+// also builds on a host (scripts/color-bench.cpp).
+
+struct FedNamedColor
+{
+    const char *name; // lower case
+    uint32_t rgb;
+};
+
+inline constexpr FedNamedColor kFedColors[] = {
+    {"red", 0xFF0000},    {"green", 0x008000},  {"blue", 0x0000FF},
+    {"white", 0xFFFFFF},  {"black", 0x000000},  {"yellow", 0xFFFF00},
+    {"purple", 0x800080}, {"cyan", 0x00FFFF},   {"orange", 0xFFA500},
+};
+inline constexpr size_t FED4_COLOR_COUNT = sizeof(kFedColors) / sizeof(kFedColors[0]);
+static constexpr uint32_t FED4_COLOR_UNKNOWN = 0x000000; // unrecognized names turn the LEDs off
+
+constexpr char fed4ColorLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+/** Case-insensitive FNV-1a; seed picks the member of the hash family. */
+constexpr uint32_t fed4ColorHash(const char *s, uint32_t seed = 0)
+{
+    uint32_t h = 2166136261u ^ seed;
+    for (; *s; s++)
+    {
+        h ^= (uint8_t)fed4ColorLower(*s);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/** Case-insensitive name compare (registry names are lower case). */
+constexpr bool fed4ColorNameEq(const char *s, const char *lower)
+{
+    for (; *s && fed4ColorLower(*s) == *lower; s++, lower++)
+    {
+    }
+    return *s == '\0' && *lower == '\0';
+}
+
+struct FedColorHashTable
+{
+    static constexpr uint8_t kSlots = 16; // power of two ≥ FED4_COLOR_COUNT
+    uint32_t seed = 0;
+    uint8_t slot[kSlots] = {}; // kFedColors index + 1, 0 = empty
+
+    static constexpr uint8_t slotOf(uint32_t h) { return (uint8_t)((h ^ (h >> 16)) & (kSlots - 1)); }
+};
+
+/** Compile time: first seed that gives every registry name its own slot. */
+constexpr FedColorHashTable fed4BuildColorHash()
+{
+    for (uint32_t seed = 0; seed < 4096; seed++)
+    {
+        FedColorHashTable t;
+        t.seed = seed;
+        bool ok = true;
+        for (size_t i = 0; i < FED4_COLOR_COUNT && ok; i++)
+        {
+            uint8_t &slot = t.slot[FedColorHashTable::slotOf(fed4ColorHash(kFedColors[i].name, seed))];
+            ok = slot == 0;
+            slot = (uint8_t)(i + 1);
+        }
+        if (ok)
+            return t;
+    }
+    return FedColorHashTable(); // no seed: caught by the static_assert below
+}
+
+inline constexpr FedColorHashTable kFedColorHash = fed4BuildColorHash();
+
+/** Perfect-hash lookup; false (rgb untouched) for names not in the registry. */
+constexpr bool fed4LookupColor(const char *name, uint32_t &rgb)
+{
+    if (name == nullptr)
+        return false;
+    const uint8_t e = kFedColorHash.slot[FedColorHashTable::slotOf(fed4ColorHash(name, kFedColorHash.seed))];
+    if (e == 0 || !fed4ColorNameEq(name, kFedColors[e - 1].name))
+        return false;
+    rgb = kFedColors[e - 1].rgb;
+    return true;
+}
+
+/** Name → 0xRRGGBB, FED4_COLOR_UNKNOWN (off) if not in the registry. */
+constexpr uint32_t fed4Color(const char *name)
+{
+    uint32_t rgb = FED4_COLOR_UNKNOWN;
+    fed4LookupColor(name, rgb);
+    return rgb;
+}
+
+constexpr bool fed4ColorHashOk()
+{
+    for (size_t i = 0; i < FED4_COLOR_COUNT; i++)
+    {
+        uint32_t rgb = ~kFedColors[i].rgb;
+        if (!fed4LookupColor(kFedColors[i].name, rgb) || rgb != kFedColors[i].rgb)
+            return false;
+    }
+    return true;
+}
+static_assert(fed4ColorHashOk(), "kFedColors: no collision-free seed — raise kSlots");
+
+inline uint32_t fed4UnknownColorName() { return FED4_COLOR_UNKNOWN; } // not constexpr on purpose
+
+/** Compile-time form used by FED4_COLOR(); an unknown name fails constant evaluation. */
+constexpr uint32_t fed4ColorLiteral(const char *name)
+{
+    uint32_t rgb = 0;
+    return fed4LookupColor(name, rgb) ? rgb : fed4UnknownColorName();
+}
+
+/** FED4_COLOR("red") → 0xFF0000 as a compile-time constant. */
+#define FED4_COLOR(name) (std::integral_constant<uint32_t, fed4ColorLiteral(name)>::value)
@@ -0,0 +1,154 @@
+#include "FED4.h"
+#include <math.h>
+
+// ── Dispense telemetry ───────────────────────────────────────────────────────
+// One record per dispense in a RAM ring (last FED4_DISPENSE_HISTORY). Clean
+// dispenses (no jam clears, not jammed) form the step-count distribution that
+// drives early jam clearing in serviceDispense(). Each time the window fills
+// it is appended to the log file's _DISP.CSV sibling, so every record reaches
+// the SD card once.
+
+/** Append the record for the dispense that just finished and refresh stats. */
+void FED4::recordDispenseTelemetry(bool pelletDetected)
+{
+    FedDispenseRecord rec;
+    rec.timeUnix = unixtime;
+    rec.steps = motorCountedSteps();
+    rec.clears = dispenseClears;
+    rec.earlyClear = dispenseEarlyCleared;
+    rec.jammed = (dispenseState == FedDispenseState::GaveUp);
+    rec.staged = lastFeedWasStaged;
+    rec.wellDetected = pelletDetected;
+
+    const FedTimeUs startUs = dispenseStartUs;
+    rec.timeToWellMs = (pelletDetected && pelletWellUs > startUs)
+                           ? (uint32_t)((pelletWellUs - startUs) / 1000)
+                           : 0;
+    rec.timeToDropMs = (pelletDropUs > startUs) ? (uint32_t)((pelletDropUs - startUs) / 1000) : 0;
+    rec.dropToWellMs = (pelletDropUs && pelletWellUs > pelletDropUs)
+                           ? (uint32_t)((pelletWellUs - pelletDropUs) / 1000)
+                           : 0;
+
+    dispenseHistory[dispenseHistoryIndex] = rec;
+    dispenseHistoryIndex = (dispenseHistoryIndex + 1) % FED4_DISPENSE_HISTORY;
+    if (dispenseHistoryCount < FED4_DISPENSE_HISTORY)
+    {
+        dispenseHistoryCount++;
+    }
+    lastDispense = rec;
+    updateDispenseStats();
+    if (dispenseHistoryIndex == 0)
+    {
+        saveDispenseTelemetry(); // window full: all FED4_DISPENSE_HISTORY records are new
+    }
+}
+
+void FED4::updateDispenseStats()
+{
+    // Welford over clean dispenses in the window
+    uint16_t n = 0;
+    float mean = 0.0f;
+    float m2 = 0.0f;
+    for (uint8_t i = 0; i < dispenseHistoryCount; i++)
+    {
+        const FedDispenseRecord &r = dispenseHistory[i];
+        if (r.clears || r.jammed || !r.wellDetected || r.steps == 0)
+        {
+            continue;
+        }
+        n++;
+        const float delta = (float)r.steps - mean;
+        mean += delta / n;
+        m2 += delta * ((float)r.steps - mean);
+    }
+    dispenseStats.samples = n;
+    dispenseStats.meanSteps = mean;
+    dispenseStats.sdSteps = (n > 1) ? sqrtf(m2 / (n - 1)) : 0.0f;
+}
+
+/**
+ * Step count at which a still-running dispense is treated as a partial jam.
+ * 0 until FED4_DISPENSE_MIN_SAMPLES clean dispenses are known. σ is floored at
+ * 10% of the mean so a very regular disc does not trip on normal jitter.
+ */
+uint32_t FED4::earlyJamThresholdSteps() const
+{
+    if (!earlyJamClear || dispenseStats.samples < FED4_DISPENSE_MIN_SAMPLES)
+    {
+        return 0;
+    }
+    const float sd = max(dispenseStats.sdSteps, 0.1f * dispenseStats.meanSteps);
+    return (uint32_t)(dispenseStats.meanSteps + earlyJamSigma * sd);
+}
+
+String FED4::dispenseDetail() const
+{
+    char buf[160];
+    snprintf(buf, sizeof(buf),
+             "latency=%lu;staged=%d;steps=%lu;clears=%u;early=%d;toDrop=%lu;toWell=%lu;dropToWell=%lu;meanSteps=%.0f;sdSteps=%.0f",
+             (unsigned long)deliveryLatencyMs, lastDispense.staged ? 1 : 0,
+             (unsigned long)lastDispense.steps, lastDispense.clears, lastDispense.earlyClear ? 1 : 0,
+             (unsigned long)lastDispense.timeToDropMs, (unsigned long)lastDispense.timeToWellMs,
+             (unsigned long)lastDispense.dropToWellMs,
+             dispenseStats.meanSteps, dispenseStats.sdSteps);
+    return String(buf);
+}
+
+/**
+ * Write the telemetry window as CSV (oldest first) — Serial, or an open SD
+ * File for fleet maintenance pulls.
+ */
+void FED4::exportDispenseTelemetry(Print &out, bool header)
+{
+    if (header)
+    {
+        out.println("UnixTime,Steps,Clears,EarlyClear,Jammed,Staged,WellDetected,TimeToDropMs,TimeToWellMs,DropToWellMs");
+    }
+    const uint8_t start = (dispenseHistoryCount < FED4_DISPENSE_HISTORY) ? 0 : dispenseHistoryIndex;
+    for (uint8_t i = 0; i < dispenseHistoryCount; i++)
+    {
+        const FedDispenseRecord &r = dispenseHistory[(start + i) % FED4_DISPENSE_HISTORY];
+        out.printf("%lu,%lu,%u,%d,%d,%d,%d,%lu,%lu,%lu\n",
+                   (unsigned long)r.timeUnix, (unsigned long)r.steps, r.clears,
+                   r.earlyClear ? 1 : 0, r.jammed ? 1 : 0, r.staged ? 1 : 0, r.wellDetected ? 1 : 0,
+                   (unsigned long)r.timeToDropMs, (unsigned long)r.timeToWellMs,
+                   (unsigned long)r.dropToWellMs);
+    }
+    out.printf("# clean=%u meanSteps=%.1f sdSteps=%.1f earlyThreshold=%lu\n",
+               dispenseStats.samples, dispenseStats.meanSteps, dispenseStats.sdSteps,
+               (unsigned long)earlyJamThresholdSteps());
+}
+
+/** Append the window to the log file name with _DISP before .CSV (header on a new file). */
+bool FED4::saveDispenseTelemetry()
+{
+    if (!sdCardAvailable || filename[0] == '\0' || dispenseHistoryCount == 0)
+    {
+        return false;
+    }
+    char path[40];
+    const char *dot = strrchr(filename, '.');
+    const int baseLen = dot ? (int)(dot - filename) : (int)strlen(filename);
+    snprintf(path, sizeof(path), "%.*s_DISP.CSV", baseLen, filename);
+
+    FedEnergySpan span(*this, FedPowerState::SdWrite);
+    SPI.setBitOrder(MSBFIRST);
+    digitalWrite(SD_CS, LOW);
+    const bool header = !SD.exists(path);
+    File file = SD.open(path, FILE_APPEND);
+    if (!file)
+    {
+        digitalWrite(SD_CS, HIGH);
+        reclaimSpiForDisplay();
+        Serial.print("WARNING: could not open ");
+        Serial.println(path);
+        return false;
+    }
+    exportDispenseTelemetry(file, header);
+    file.close();
+    digitalWrite(SD_CS, HIGH);
+    reclaimSpiForDisplay();
+    Serial.print("Dispense telemetry saved to ");
+    Serial.println(path);
+    return true;
+}
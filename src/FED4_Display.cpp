@@ -231,12 +231,12 @@ void FED4::displayEnvironmental(){
   setTextColor(DISPLAY_WHITE);
 
   setCursor(4, HEADER_TEXT_Y);
-  print((int)temperature);
+  print((int)readings.temperature.value);
   print("C");
 
-  if (humidity >= 0) {
+  if (readings.humidity.value >= 0) {
     setCursor(36, HEADER_TEXT_Y);
-    print((int)humidity);
+    print((int)readings.humidity.value);
     print("%");
   }
 
@@ -258,7 +258,7 @@ void FED4::displayBattery(){
   fillRect(barX, barY, BAR_W, BAR_H, DISPLAY_WHITE);
   fillRect(barX + 2, innerY, 14, INNER_H, DISPLAY_BLACK);
   fillRect(barX + BAR_W, innerY, 2, INNER_H, DISPLAY_WHITE); // terminal
-  int fillW = (int)(cellVoltage / 7);
+  int fillW = (int)(readings.cellVoltage.value / 7);
   if (fillW < 0) fillW = 0;
   if (fillW > 14) fillW = 14;
   if (fillW > 0) {
@@ -270,8 +270,22 @@ void FED4::displayBattery(){
   setTextColor(DISPLAY_WHITE);
 
   setCursor(142, HEADER_TEXT_Y);
-  print(cellVoltage, 1);
+  print(readings.cellVoltage.value, 1);
   print("V");
+
+  // Projected time to empty (energy model; blank for the first 10 min)
+  fillRect(84, 0, 32, HEADER_H, DISPLAY_BLACK);
+  const float tte = timeToEmptyHours();
+  if (tte >= 0) {
+    setCursor(88, HEADER_TEXT_Y);
+    if (tte >= 48) {
+      print((int)(tte / 24));
+      print("d");
+    } else {
+      print((int)tte);
+      print("h");
+    }
+  }
 }
 
 void FED4::displaySDCardStatus() {
@@ -335,7 +349,7 @@ void FED4::displayDateTime() {
   static const int16_t FOOTER_Y = 302;
   static const int16_t FOOTER_TEXT_Y = FOOTER_Y + 5;
   fillRect(0, FOOTER_Y, 176, 320 - FOOTER_Y, DISPLAY_BLACK);
-  DateTime current = rtc.now();
+  DateTime current = now();
 
   char dateStr[9];
   snprintf(dateStr, sizeof(dateStr), "%02d.%02d.%02d",
@@ -559,6 +573,7 @@ void FED4::refresh()
     if (!displayBuffer) {
         return;
     }
+    FedEnergySpan span(*this, FedPowerState::Display);
 
     reclaimSpiForDisplay();
 
@@ -727,6 +742,8 @@ void FED4::displayAudio() {
 
 // Display initialization status message below startup animation
 void FED4::displayInitStatus(const char* message) {
+  serviceLeds(); // boot rainbow advances between init steps
+
   // Called during begin() before the framebuffer exists — Serial-only until then
   if (!displayBuffer) {
     return;
@@ -0,0 +1,124 @@
+#include "FED4.h"
+
+// ── Energy accounting ────────────────────────────────────────────────────────
+// Time in each FedPowerState × energyCoeffs (mA) = a running mAh budget since
+// boot. Sleep is measured around esp_light_sleep_start(); AwakeIdle is the rest
+// of the uptime. The extras add on top: refresh() and logData() are timed by a
+// FedEnergySpan, motor time comes from the step ISR's coil-on tick count, and
+// the amp and strip are levels integrated over time (strip level = lit load,
+// so a dim single LED costs a fraction of the all-white coefficient).
+// The model is checked against the MAX17048 SOC drop and gives the display its
+// time-to-empty. Nothing is persisted: the budget restarts with each boot,
+// anchored to the SOC seen first.
+
+static const char *const kPowerStateKeys[FED4_POWER_STATES] = {
+    "sleep_on_s", "sleep_off_s", "awake_s", "disp_s", "sd_s", "motor_s", "audio_s", "led_s"};
+
+FedEnergySpan::FedEnergySpan(FED4 &fed, FedPowerState state)
+    : fed(fed), state(state), startUs(esp_timer_get_time())
+{
+}
+
+FedEnergySpan::~FedEnergySpan()
+{
+    fed.energyAdd(state, esp_timer_get_time() - startUs);
+}
+
+void FED4::energyAdd(FedPowerState state, int64_t us)
+{
+    if (us > 0)
+        energyUs[(uint8_t)state] += (uint64_t)us;
+}
+
+/** Close the running interval of a level state at its old level, then switch. */
+void FED4::energyLevel(FedPowerState state, uint16_t levelQ8)
+{
+    const uint8_t i = (uint8_t)state;
+    if (levelQ8 == energyLevelQ8[i])
+        return;
+    const int64_t now = esp_timer_get_time();
+    if (energyLevelQ8[i])
+        energyUs[i] += ((uint64_t)(now - energyLevelSinceUs[i]) * energyLevelQ8[i]) >> 8;
+    energyLevelQ8[i] = levelQ8;
+    energyLevelSinceUs[i] = now;
+}
+
+uint64_t FED4::energyStateUs(FedPowerState state) const
+{
+    const uint8_t i = (uint8_t)state;
+    const int64_t now = esp_timer_get_time();
+    if (state == FedPowerState::AwakeIdle)
+    {
+        const uint64_t slept = energyUs[(uint8_t)FedPowerState::SleepPsv2On] +
+                               energyUs[(uint8_t)FedPowerState::SleepPsv2Off];
+        return (uint64_t)now > slept ? (uint64_t)now - slept : 0;
+    }
+    uint64_t us = energyUs[i];
+    if (energyLevelQ8[i])
+        us += ((uint64_t)(now - energyLevelSinceUs[i]) * energyLevelQ8[i]) >> 8;
+    return us;
+}
+
+float FED4::energyUsedMah() const
+{
+    double mAus = 0;
+    for (uint8_t i = 0; i < FED4_POWER_STATES; i++)
+        mAus += (double)energyStateUs((FedPowerState)i) * energyCoeffs.mA[i];
+    return (float)(mAus / 3.6e9); // mA·µs → mAh
+}
+
+float FED4::energySocUsedMah() const
+{
+    if (energySocStart < 0 || cellVoltage <= 0)
+        return -1.0f;
+    return (energySocStart - cellPercent) / 100.0f * batteryCapacityMah;
+}
+
+float FED4::energyAverageMa() const
+{
+    const double hours = (double)esp_timer_get_time() / 3.6e9;
+    return hours > 0 ? (float)(energyUsedMah() / hours) : 0.0f;
+}
+
+/** Remaining charge (SOC when the gauge has read, else budget − model) / average current. */
+float FED4::timeToEmptyHours() const
+{
+    if (esp_timer_get_time() < 600LL * 1000000LL)
+        return -1.0f;
+    const float avg = energyAverageMa();
+    if (avg <= 0)
+        return -1.0f;
+    const float remaining = cellVoltage > 0 ? batteryCapacityMah * cellPercent / 100.0f
+                                            : batteryCapacityMah - energyUsedMah();
+    return remaining > 0 ? remaining / avg : 0.0f;
+}
+
+String FED4::energyDetail() const
+{
+    char buf[224];
+    int n = snprintf(buf, sizeof(buf), "mah=%.2f;soc_mah=%.1f;avg_ma=%.2f;tte_h=%.1f;soc=%.1f",
+                     energyUsedMah(), energySocUsedMah(), energyAverageMa(), timeToEmptyHours(), cellPercent);
+    for (uint8_t i = 0; i < FED4_POWER_STATES && n > 0 && n < (int)sizeof(buf); i++)
+    {
+        n += snprintf(buf + n, sizeof(buf) - n, ";%s=%.1f", kPowerStateKeys[i],
+                      (double)energyStateUs((FedPowerState)i) / 1e6);
+    }
+    return String(buf);
+}
+
+/** Fold in motor coil time, anchor the SOC, and log an "Energy" row each energyLogMinutes. */
+void FED4::serviceEnergy()
+{
+    const uint32_t ticks = motorCoilTicks();
+    energyAdd(FedPowerState::Motor, (int64_t)(ticks - energyMotorTicks) * MOTOR_STEP_US);
+    energyMotorTicks = ticks;
+
+    if (energySocStart < 0 && cellVoltage > 0)
+        energySocStart = cellPercent;
+
+    if (energyLogMinutes && millis() - energyLastLogMs >= (unsigned long)energyLogMinutes * 60000UL)
+    {
+        energyLastLogMs = millis();
+        logData("Energy", energyDetail());
+    }
+}
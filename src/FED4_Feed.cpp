@@ -8,6 +8,7 @@
  */
 void FED4::feed()
 {
+    feedStartMs = millis();
     checkLateRetrieval(); // prior pending take may have happened during sleep
     initFeeding();
     dispense();
@@ -18,6 +19,7 @@ void FED4::feed()
 
 void FED4::initFeeding()
 {
+    resetPelletEdges();
     pelletPresent = checkForPellet();
     // pelletDropped = didPelletDrop();
     pelletReady = false;
@@ -26,40 +28,70 @@ void FED4::initFeeding()
     Serial.println("Feeding!");
 }
 
+/**
+ * Non-blocking dispense: the step engine moves the disc from a timer ISR while
+ * this loop services the state machine, photogate edges and pokes. PG1 stops
+ * the motor from the ISR within one step period.
+ */
 void FED4::dispense()
 {
-    while (!pelletPresent && !dispenseError)
+    // A staged disc keeps its step count so stepsToDrop spans staging + final move
+    lastFeedWasStaged = pelletStaged;
+    stagingInFlight = false; // a staging move still running becomes part of this dispense
+    bool buttonFake = false;
+    if (!pelletStaged)
+    {
+        motorIdle(); // park an idle timer so queueMotorSteps() restarts it and clears a stale pellet-stop
+        motorCountedSteps(true);
+    }
+    dispenseClears = 0;
+    dispenseEarlyCleared = false;
+    dispenseStartUs = fedNowUs();
+    enterDispenseState(pelletPresent ? FedDispenseState::Done : FedDispenseState::Advance);
+
+    while (dispenseState != FedDispenseState::Done &&
+           dispenseState != FedDispenseState::GaveUp)
     {
         redPix();
-        // pelletDropped = didPelletDrop();
-        pelletPresent = checkForPellet();
+        servicePhotogates();
+        serviceDispense();
+        serviceLeds();
 
         // Button 1: fake pelletPresent to exit dispense (lab/debug)
         if (digitalRead(BUTTON_1) == 1)
         {
+            stopMotor();
             hapticDoubleBuzz();
             marioPipe();
             pelletPresent = true;
+            buttonFake = true;
+            enterDispenseState(FedDispenseState::Done);
+            break;
         }
 
-        // if (pelletDropped)
-        // {
-        //     blockPelletCount++;
-        // }
-
-        stepper.step(-10);
-        delay(2);
-        motorTurns++;
-        if (motorTurns % 25 == 0)
+        // Pokes keep logging while the motor runs (ISR owns the steps)
+        if (fed4TouchAnyPadActive(TOUCH_THRESHOLD) && capturePoke())
         {
-            Serial.print("Dispensing... ");
-            Serial.println(motorTurns / 25);
-            releaseMotor();
-            delay(1000);
+            logDispensePoke();
         }
 
-        handleJams(); // minor/vibrate clears — DispenseError only in jammed()
+        waitForPhotogateEdge(5);
+    }
+
+    if (dispenseState == FedDispenseState::GaveUp)
+    {
+        recordDispenseTelemetry(false);
+    }
+
+    if (!dispenseError)
+    {
+        motorTurns = motorCountedSteps() / 10; // jammed() already logged + reset
+        if (pelletPresent && dispenseClears == 0 && !buttonFake)
+        {
+            recordStepsToDrop(motorCountedSteps());
+        }
     }
+    pelletStaged = false;
 
     if (!dispenseError && pelletPresent)
     {
@@ -67,23 +99,131 @@ void FED4::dispense()
     }
 }
 
-void FED4::handleJams()
+void FED4::enterDispenseState(FedDispenseState state)
+{
+    dispenseState = state;
+    switch (state)
+    {
+    case FedDispenseState::Advance:
+        // 25 × 10-step turns, same cadence as the old step(-10) loop
+        queueMotorSteps(-250, 0, FED4_SEG_STOP_ON_PELLET | FED4_SEG_COUNT_STEPS);
+        break;
+    case FedDispenseState::Pause:
+        queueMotorSteps(0, 1000, FED4_SEG_STOP_ON_PELLET);
+        break;
+    case FedDispenseState::JamClear:
+        dispenseClears++; // reversed disc — step count no longer a drop distance
+        Serial.println("MinorJam");
+        queueMotorSteps(200, 1000, FED4_SEG_STOP_ON_PELLET);
+        // The early clear (always the first of its dispense) vibrates once; later clears follow the 200-turn rule
+        if (motorTurns % 200 == 0 || (dispenseEarlyCleared && dispenseClears == 1))
+        {
+            Serial.println("VibrateJam");
+            vibrateCyclesLeft = 35;
+        }
+        break;
+    case FedDispenseState::GaveUp:
+        jammed();
+        break;
+    default:
+        break;
+    }
+}
+
+void FED4::serviceDispense()
 {
-    if (motorTurns % 100 == 0)
+    if (motorStoppedByPellet() || checkForPellet())
     {
-        minorJamClear();
+        stopMotor();
+        pelletPresent = true;
+        enterDispenseState(FedDispenseState::Done);
+        return;
+    }
+
+    // Top up the vibrate wobble as queue space frees
+    while (dispenseState == FedDispenseState::JamClear && vibrateCyclesLeft > 0 &&
+           motorQueueSpace() >= 2)
+    {
+        queueMotorSteps(10, 10, FED4_SEG_STOP_ON_PELLET);
+        queueMotorSteps(-20, 10, FED4_SEG_STOP_ON_PELLET);
+        vibrateCyclesLeft--;
     }
 
-    if (motorTurns % 200 == 0)
+    // Far above this disc's learned steps-to-drop: clear now, not at the next 100-turn mark
+    const uint32_t earlySteps = earlyJamThresholdSteps();
+    if (dispenseState == FedDispenseState::Advance && earlySteps && !dispenseEarlyCleared &&
+        dispenseClears == 0 && motorCountedSteps() > earlySteps)
     {
-        vibrateJamClear();
+        stopMotor();
+        motorTurns = motorCountedSteps() / 10;
+        dispenseEarlyCleared = true;
+        Serial.printf("EarlyJam: %lu steps > %lu\n", (unsigned long)motorCountedSteps(),
+                      (unsigned long)earlySteps);
+        enterDispenseState(FedDispenseState::JamClear);
+        return;
+    }
+
+    if (!motorIdle())
+    {
+        return;
+    }
+
+    switch (dispenseState)
+    {
+    case FedDispenseState::Advance:
+        motorTurns = motorCountedSteps() / 10;
+        Serial.print("Dispensing... ");
+        Serial.println(motorTurns / 25);
+        enterDispenseState(FedDispenseState::Pause);
+        break;
+    case FedDispenseState::Pause:
+        handleJams();
+        break;
+    case FedDispenseState::JamClear:
+        if (vibrateCyclesLeft == 0)
+        {
+            enterDispenseState(FedDispenseState::Advance);
+        }
+        break;
+    default:
+        break;
     }
+}
 
-    // Hard give-up only — not while jam-clear motor moves are still the strategy
+/** Batch boundary: give up, start a jam clear, or advance again. DispenseError only in jammed(). */
+void FED4::handleJams()
+{
     if (motorTurns > 2000)
     {
-        jammed();
+        enterDispenseState(FedDispenseState::GaveUp);
+    }
+    else if (motorTurns % 100 == 0)
+    {
+        enterDispenseState(FedDispenseState::JamClear);
+    }
+    else
+    {
+        enterDispenseState(FedDispenseState::Advance);
+    }
+}
+
+void FED4::logDispensePoke()
+{
+    switch (wakePad)
+    {
+    case 1:
+        logData("LeftDuringDispense", contactDetail());
+        break;
+    case 2:
+        logData("CenterDuringDispense", contactDetail());
+        break;
+    case 3:
+        logData("RightDuringDispense", contactDetail());
+        break;
+    default:
+        break;
     }
+    resetTouchFlags();
 }
 
 void FED4::handlePelletSettling()
@@ -95,28 +235,44 @@ void FED4::handlePelletSettling()
         return;
     }
 
-    pelletDropTime = millis();
+    // Edge stamps from the PG ISR; fall back to now when a gate saw no edge
+    servicePhotogates();
+    pelletDropTime = fedMs32(pelletDropUs ? pelletDropUs : fedNowUs());
     pelletCount++;
-    logData("PelletDrop");
 
     unsigned long startWait = millis();
     bool pelletDetected = false;
 
     while (millis() - startWait < 500)
     {
+        servicePhotogates();
         if (checkForPellet())
         {
+            if (pelletWellUs == 0)
+            {
+                pelletWellUs = fedNowUs(); // already in well before arm
+            }
             pelletDetected = true;
-            pelletWellTime = millis();
+            pelletWellTime = fedMs32(pelletWellUs);
             break;
         }
-        delay(10);
+        waitForPhotogateEdge(10);
     }
 
     if (!pelletDetected)
     {
         dispenseError = true;
     }
+
+    // Delivery latency: triggering poke (or feed() call) → pellet in well
+    const uint32_t wellMs = pelletDetected ? pelletWellTime : millis();
+    const bool pokeTriggered = lastContactOnsetMs != 0 &&
+                               feedStartMs - lastContactOnsetMs < 5000;
+    const uint32_t triggerMs = pokeTriggered ? lastContactOnsetMs : feedStartMs;
+    deliveryLatencyMs = wellMs - triggerMs;
+
+    recordDispenseTelemetry(pelletDetected);
+    logData("PelletDrop", dispenseDetail() + (pokeTriggered ? ";from=poke" : ";from=feed"));
 }
 
 void FED4::monitorPelletInWell(uint32_t retrievalTimeoutSec)
@@ -128,9 +284,15 @@ void FED4::monitorPelletInWell(uint32_t retrievalTimeoutSec)
     while (pelletPresent)
     {
         redPix();
+        servicePhotogates();
+        serviceLeds();
         pelletPresent = checkForPellet();
 
-        retrievalTime = (static_cast<float>(millis() - pelletWellTime)) / 1000.0f;
+        // Taken time = last PG1 clear edge (ms-accurate), not the poll that saw it
+        const FedTimeUs endUs = (!pelletPresent && pelletTakenUs > pelletWellUs)
+                                  ? pelletTakenUs
+                                  : fedNowUs();
+        retrievalTime = (float)(endUs - pelletWellUs) / 1000000.0f;
         if (retrievalTime > (float)retrievalTimeoutSec)
         {
             break;
@@ -166,7 +328,7 @@ void FED4::monitorPelletInWell(uint32_t retrievalTimeoutSec)
             resetTouchFlags();
         }
 
-        delay(10);
+        waitForPhotogateEdge(10);
     }
 }
 
@@ -208,6 +370,7 @@ void FED4::finishFeeding()
             logData("PelletTaken");
             blockPokeCount = 0;
             Serial.println("Pellet Removed");
+            stagePellet();
         }
     }
 
@@ -247,13 +410,17 @@ bool FED4::checkLateRetrieval()
         return false; // still waiting
     }
 
-    retrievalTime = (static_cast<float>(millis() - pelletWellTime)) / 1000.0f;
+    // PG1 clear edge if it happened while awake; otherwise coarse (taken during sleep)
+    servicePhotogates();
+    const FedTimeUs takenUs = (pelletTakenUs > pelletWellUs) ? pelletTakenUs : fedNowUs();
+    retrievalTime = (float)(takenUs - pelletWellUs) / 1000000.0f;
     pelletPresent = false; // clear before logData/displayIndicators refresh
     logData("LatePelletTaken");
     blockPokeCount = 0;
     pendingRetrieval = false;
     retrievalTime = 0.0f;
     Serial.println("Late pellet retrieval logged");
+    stagePellet();
     return true;
 }
 
@@ -262,6 +429,110 @@ bool FED4::checkForPellet()
     return !digitalRead(PHOTOGATE_1);
 }
 
+// ── Pellet staging ───────────────────────────────────────────────────────────
+// Steps from one drop to the next are recorded for clean dispenses (no jam
+// clears). With pelletStaging on, the disc pre-advances to the shortest recent
+// distance minus stagingMarginSteps once the well is empty, so the next feed()
+// only needs a short final move.
+
+void FED4::recordStepsToDrop(uint32_t steps)
+{
+    if (steps == 0 || steps > 0xFFFF)
+    {
+        return;
+    }
+    dropStepSamples[dropStepIndex] = (uint16_t)steps;
+    dropStepIndex = (dropStepIndex + 1) % FED4_DROP_STEP_SAMPLES;
+    if (dropStepCount < FED4_DROP_STEP_SAMPLES)
+    {
+        dropStepCount++;
+    }
+}
+
+/** Learned pre-drop position in steps, or 0 until enough clean drops are seen. */
+uint32_t FED4::stagingSteps() const
+{
+    if (dropStepCount < 3)
+    {
+        return 0;
+    }
+    uint16_t shortest = 0xFFFF;
+    for (uint8_t i = 0; i < dropStepCount; i++)
+    {
+        shortest = min(shortest, dropStepSamples[i]);
+    }
+    return shortest > stagingMarginSteps ? shortest - stagingMarginSteps : 0;
+}
+
+/** Queue the staging move (non-blocking; startSleep() waits for it to finish). */
+void FED4::stagePellet()
+{
+    if (!pelletStaging || pelletStaged)
+    {
+        return;
+    }
+    const uint32_t steps = stagingSteps();
+    if (steps == 0 || checkForPellet())
+    {
+        return;
+    }
+    motorIdle();
+    motorCountedSteps(true);
+    resetPelletEdges(); // PG4/PG1 stamps from here on belong to the staging move
+    if (queueMotorSteps(-(int16_t)min<uint32_t>(steps, 0x7FFF), 0,
+                        FED4_SEG_STOP_ON_PELLET | FED4_SEG_COUNT_STEPS))
+    {
+        pelletStaged = true;
+        stagingInFlight = true;
+        Serial.printf("Staging: pre-advance %lu steps\n", (unsigned long)steps);
+    }
+}
+
+/**
+ * The staging move finished (update()) or startSleep() cut it short. A short
+ * move leaves the disc short of the staged position, so the next feed() starts
+ * over. A pellet the move knocked out is counted and logged as StagingDrop; if
+ * it sits in the well, it is left for checkLateRetrieval() like a feed() pellet.
+ */
+void FED4::finishStaging(bool completed)
+{
+    if (!stagingInFlight)
+    {
+        return;
+    }
+    stagingInFlight = false;
+    if (!completed)
+    {
+        pelletStaged = false;
+        Serial.println("Staging: move cut short");
+    }
+
+    servicePhotogates();
+    const bool inWell = motorStoppedByPellet() || checkForPellet();
+    if (!inWell && pelletDropUs == 0)
+    {
+        return;
+    }
+
+    pelletStaged = false; // the disc is past the staged position
+    pelletCount++;
+    pelletDropTime = fedMs32(pelletDropUs ? pelletDropUs : fedNowUs());
+    if (inWell && pelletWellUs == 0)
+    {
+        pelletWellUs = fedNowUs();
+    }
+    pelletWellTime = fedMs32(pelletWellUs);
+    pelletPresent = inWell;
+    pendingRetrieval = inWell;
+    retrievalTime = 0.0f;
+
+    char detail[48];
+    snprintf(detail, sizeof(detail), "steps=%lu;well=%d;complete=%d",
+             (unsigned long)motorCountedSteps(), inWell ? 1 : 0, completed ? 1 : 0);
+    logData("StagingDrop", detail);
+    Serial.println("Staging: pellet dropped during pre-advance");
+}
+
 // bool FED4::didPelletDrop()
 // {
 //     if (dropSensorAvailable)
@@ -1,4 +1,7 @@
 #include "FED4.h"
+#include "FED4_Ring.h"
+
+#include "driver/gpio.h"
 
 // Forward-declare the ToF sensor instance from FED4_Prox.cpp
 extern SFEVL53L1X distanceSensor;
@@ -20,18 +23,64 @@ extern SFEVL53L1X distanceSensor;
  * Public API:
  *   initializeInterrupts()         – one-time setup (called from begin())
  *   interruptPending()             – true when INT_OR is LOW (asserted)
- *   scanInterrupts()               – bitmask of ALL active sources (read-only)
+ *   scanInterrupts(sources)        – bitmask of active sources among `sources` (default: armed; read-only)
  *   clearInterrupts(mask)          – clear latches for selected sources
  *   scanAndClearInterrupts()       – scan + clear + verify line released
  *   firstInterruptSource()         – highest-priority single source (ACCEL > TOF > RTC > BAT)
  *   getLastInterruptMask()         – mask auto-captured on GPIO wake
+ *   onInterrupt(source, handler)   – deferred handler per source
+ *   serviceInterrupts()            – update(): dispatch + run queued handlers
  *
- * Opt-in source enables:
+ * Opt-in source enables (each also arms the source for the dispatcher):
  *   enableAccelInterrupt(thresh_g, duration)
  *   enableRTCAlarmInterrupt(alarmNum)
  *   enableBatteryAlert(minV, maxV)
+ *   startProxService(...) / startAccelFifo(...)
  ******************************************************************************/
 
+// ── Dispatcher ───────────────────────────────────────────────────────────────
+// Every status read is an I2C transaction, so the dispatcher only scans sources
+// that something armed (armInterruptSource), in priority order, clearing each
+// asserted one before moving on, and stops as soon as INT_OR is released: the
+// line is the OR of all sources, so a HIGH line means nothing further down is
+// asserting. Only if the line is still LOW after every armed source do the
+// unarmed ones get a look (interruptStrays). The clear itself happens inline —
+// it is what releases the line — and the source's handler is queued and run
+// from serviceInterrupts() in loop context, after the bus work is done.
+//
+// Awake, a FALLING ISR on INT_OR only sets a flag and a timestamp. Light sleep
+// turns the pin into a level wake source, so startSleep() masks the ISR and
+// wakeUp() attaches it again (armInterruptLine).
+
+static const uint8_t kIntPriority[] = {FED4::INT_SRC_ACCEL, FED4::INT_SRC_TOF, FED4::INT_SRC_RTC,
+                                      FED4::INT_SRC_BATTERY};
+static const uint16_t kIntSettleUs = 50; // open-drain release before re-checking INT_OR
+
+struct FedIntEvent
+{
+    uint8_t source;
+    uint32_t ms; // INT_OR assert time (millis scale)
+};
+
+static FedRing<FedIntEvent, 16> sIntEvents;
+static volatile bool sIntOrFired = false;
+static volatile int64_t sIntOrFiredUs = 0;
+
+static void IRAM_ATTR fed4IntOrIsr()
+{
+    sIntOrFiredUs = esp_timer_get_time();
+    sIntOrFired = true;
+}
+
+/** Bit index (0..3) of a single-source mask. */
+static uint8_t intSourceIndex(uint8_t source)
+{
+    uint8_t i = 0;
+    while (i < FED4_INT_SOURCES - 1 && !(source & (1u << i)))
+        i++;
+    return i;
+}
+
 // ── LIS2DH12 register helpers ────────────────────────────────────────────────
 // The Adafruit_LIS3DH library (register-compatible with LIS2DH12) does not
 // expose raw register write/read publicly, so we use Wire directly.
@@ -118,6 +167,8 @@ bool FED4::initializeInterrupts()
         return false;
     }
 
+    armInterruptLine();
+
     Serial.println("INT_OR interrupt line initialized (active LOW)");
     printInterruptStatus("int-init");
 
@@ -135,37 +186,54 @@ bool FED4::interruptPending()
 
 // ── scanInterrupts ───────────────────────────────────────────────────────────
 // Checks each source's status without clearing any latch.
-// Returns a bitmask of FED4IntSource flags for every currently-asserted source.
+// Returns a bitmask of FED4IntSource flags for every currently-asserted source
+// among `sources` (default: the armed ones).
 
-uint8_t FED4::scanInterrupts()
+bool FED4::scanInterruptSource(uint8_t source)
 {
-    uint8_t mask = INT_SRC_NONE;
-
-    // ToF (VL53L1X): checkForDataReady() returns true when distance data is ready
-    // or when a threshold interrupt was triggered (relevant in autonomous mode).
-    if (distanceSensor.checkForDataReady()) {
-        mask |= INT_SRC_TOF;
+    switch (source) {
+    case INT_SRC_TOF:
+        // ToF (VL53L1X): checkForDataReady() returns true when distance data is ready
+        // or when a threshold interrupt was triggered (relevant in autonomous mode).
+        return distanceSensor.checkForDataReady();
+
+    case INT_SRC_RTC:
+        // RTC (DS3231): alarm 1 or alarm 2 flag set
+        return rtc.alarmFired(1) || rtc.alarmFired(2);
+
+    case INT_SRC_BATTERY:
+        // Battery (MAX17048): any alert flag active in STATUS register
+        return maxlipo.isActiveAlert();
+
+    case INT_SRC_ACCEL: {
+        // Accel (LIS2DH12): read INT1_SRC IA bit (reading the register also clears it
+        // when latching is enabled via CTRL_REG5 LIR_INT1=1).
+        // Note: this clears the latch as a side effect of the scan.
+        // 0xFF = I2C fail — do not treat as ACCEL (would false-positive every scan).
+        uint8_t int1src = lis3dh_readReg(LIS3DH_REG_INT1SRC);
+        if (int1src != 0xFF && (int1src & 0x40)) { // bit 6 = IA (Interrupt Active)
+            return true;
+        }
+        // FIFO watermark (startAccelFifo) holds INT1 until the FIFO is drained
+        return accelFifoWatermark();
     }
 
-    // RTC (DS3231): alarm 1 or alarm 2 flag set
-    if (rtc.alarmFired(1) || rtc.alarmFired(2)) {
-        mask |= INT_SRC_RTC;
+    default:
+        return false;
     }
+}
 
-    // Battery (MAX17048): any alert flag active in STATUS register
-    if (maxlipo.isActiveAlert()) {
-        mask |= INT_SRC_BATTERY;
+uint8_t FED4::scanInterrupts(uint8_t sources)
+{
+    if (sources == 0) {
+        sources = armedInterrupts;
     }
-
-    // Accel (LIS2DH12): read INT1_SRC IA bit (reading the register also clears it
-    // when latching is enabled via CTRL_REG5 LIR_INT1=1).
-    // Note: this clears the latch as a side effect of the scan.
-    // 0xFF = I2C fail — do not treat as ACCEL (would false-positive every scan).
-    uint8_t int1src = lis3dh_readReg(LIS3DH_REG_INT1SRC);
-    if (int1src != 0xFF && (int1src & 0x40)) { // bit 6 = IA (Interrupt Active)
-        mask |= INT_SRC_ACCEL;
+    uint8_t mask = INT_SRC_NONE;
+    for (uint8_t source : kIntPriority) {
+        if ((sources & source) && scanInterruptSource(source)) {
+            mask |= source;
+        }
     }
-
     return mask;
 }
 
@@ -176,7 +244,11 @@ uint8_t FED4::scanInterrupts()
 void FED4::clearInterrupts(uint8_t mask)
 {
     if (mask & INT_SRC_TOF) {
-        distanceSensor.clearInterrupt();
+        if (proxServiceActive) {
+            captureProxSample(); // keep the range behind the latch, then clear it
+        } else {
+            distanceSensor.clearInterrupt();
+        }
     }
 
     if (mask & INT_SRC_RTC) {
@@ -193,27 +265,113 @@ void FED4::clearInterrupts(uint8_t mask)
     if (mask & INT_SRC_ACCEL) {
         // Reading INT1_SRC clears the latch when LIR_INT1=1 in CTRL_REG5.
         accel.readAndClearInterrupt();
+        drainAccelFifo(); // watermark releases once the FIFO is below it
     }
 }
 
-// ── scanAndClearInterrupts ───────────────────────────────────────────────────
-// Returns the bitmask of asserted sources, then clears all latched sources.
-// Logs a warning if INT_OR remains LOW after clearing (e.g. PIR still active).
+// ── dispatchInterrupts ───────────────────────────────────────────────────────
+// Priority scan of the armed sources with early exit once INT_OR releases; each
+// asserted source is cleared at once and its handler queued. Returns the mask.
 
-uint8_t FED4::scanAndClearInterrupts()
+uint8_t FED4::dispatchInterrupts()
 {
-    uint8_t mask = scanInterrupts();
+    if (!interruptPending()) {
+        return INT_SRC_NONE;
+    }
+    interruptScans++;
+    const uint32_t assertMs = (uint32_t)(sIntOrFiredUs / 1000);
+    const uint32_t nowMs = millis();
+    // ISR stamp only if it belongs to this assert (not a stale edge from long ago)
+    const uint32_t ms = (sIntOrFiredUs != 0 && nowMs - assertMs < 1000) ? assertMs : nowMs;
 
-    if (mask != INT_SRC_NONE) {
-        clearInterrupts(mask);
+    uint8_t mask = INT_SRC_NONE;
+    uint8_t scanned = INT_SRC_NONE;
+    // pass 0: armed sources; pass 1 (line still LOW): whatever else holds it
+    for (uint8_t pass = 0; pass < 2 && interruptPending(); pass++) {
+        for (uint8_t source : kIntPriority) {
+            if (((armedInterrupts & source) != 0) != (pass == 0)) {
+                continue;
+            }
+            scanned |= source;
+            if (!scanInterruptSource(source)) {
+                continue;
+            }
+            clearInterrupts(source);
+            mask |= source;
+            if (pass == 1) {
+                interruptStrays++;
+            }
+            FedIntEvent ev;
+            ev.source = source;
+            ev.ms = ms;
+            if (!sIntEvents.push(ev)) {
+                interruptEventsDropped++;
+            }
+            delayMicroseconds(kIntSettleUs);
+            if (!interruptPending()) {
+                break;
+            }
+        }
+    }
+    if (armedInterrupts & ~scanned) {
+        interruptEarlyExits++; // lower-priority armed sources never touched the bus
+    }
+    return mask;
+}
 
-        // Allow time for open-drain lines to settle before checking release
-        delayMicroseconds(50);
+/** Run the queued handlers (loop context); dispatches first if INT_OR fired since the last call. */
+uint8_t FED4::serviceInterrupts()
+{
+    uint8_t mask = INT_SRC_NONE;
+    if (sIntOrFired || interruptPending()) {
+        sIntOrFired = false;
+        mask = dispatchInterrupts();
+    }
+    FedIntEvent ev;
+    while (sIntEvents.pop(ev)) {
+        const FedIntHandler handler = intHandlers[intSourceIndex(ev.source)];
+        if (handler != nullptr) {
+            handler(*this, ev.source, ev.ms);
+        }
+    }
+    return mask;
+}
 
-        if (interruptPending()) {
-            Serial.println("INT_OR: line still asserted after clear — a source may need more time");
+void FED4::onInterrupt(uint8_t source, FedIntHandler handler)
+{
+    for (uint8_t i = 0; i < FED4_INT_SOURCES; i++) {
+        if (source & (1u << i)) {
+            intHandlers[i] = handler;
         }
     }
+}
+
+void FED4::armInterruptSource(uint8_t mask, bool armed)
+{
+    if (armed) {
+        armedInterrupts |= mask;
+    } else {
+        armedInterrupts &= (uint8_t)~mask;
+    }
+}
+
+/** FALLING ISR on INT_OR (begin, and wakeUp after light sleep made it a level wake). */
+void FED4::armInterruptLine()
+{
+    attachInterrupt(INT_OR, fed4IntOrIsr, FALLING);
+}
+
+// ── scanAndClearInterrupts ───────────────────────────────────────────────────
+// Dispatches (armed sources first, early exit) and records the mask.
+// Logs a warning if INT_OR remains LOW after clearing (e.g. PIR still active).
+
+uint8_t FED4::scanAndClearInterrupts()
+{
+    uint8_t mask = dispatchInterrupts();
+
+    if (mask != INT_SRC_NONE && interruptPending()) {
+        Serial.println("INT_OR: line still asserted after clear — a source may need more time");
+    }
 
     lastInterruptMask = mask;
     return mask;
@@ -224,7 +382,7 @@ uint8_t FED4::scanAndClearInterrupts()
 
 FED4::FED4IntSource FED4::firstInterruptSource()
 {
-    uint8_t mask = scanInterrupts();
+    uint8_t mask = scanInterrupts(INT_SRC_ALL); // armed or not, as before the dispatcher
     if (mask & INT_SRC_ACCEL)   return INT_SRC_ACCEL;
     if (mask & INT_SRC_TOF)     return INT_SRC_TOF;
     if (mask & INT_SRC_RTC)     return INT_SRC_RTC;
@@ -250,13 +408,14 @@ uint8_t FED4::getLastInterruptMask()
 void FED4::printInterruptStatus(const char *tag)
 {
     const bool intOrLow = interruptPending();
-    const uint8_t mask = scanInterrupts();
+    const uint8_t mask = scanInterrupts(INT_SRC_ALL); // diagnostics: armed or not
 
     Serial.print("INT status");
     if (tag != nullptr && tag[0] != '\0') {
         Serial.printf(" [%s]", tag);
     }
-    Serial.printf(": INT_OR=%s mask=0x%02X", intOrLow ? "LOW(asserted)" : "HIGH(idle)", mask);
+    Serial.printf(": INT_OR=%s mask=0x%02X armed=0x%02X", intOrLow ? "LOW(asserted)" : "HIGH(idle)", mask,
+                  armedInterrupts);
 
     if (mask == INT_SRC_NONE) {
         Serial.print(" (none scanned)");
@@ -355,6 +514,9 @@ bool FED4::enableAccelInterrupt(float threshold_g, uint8_t duration_count)
     // Clear any stale INT1_SRC latch from before configuration
     lis3dh_readReg(LIS3DH_REG_INT1SRC);
 
+    accelMotionArmed = true;
+    armInterruptSource(INT_SRC_ACCEL);
+
     Serial.printf("Accel interrupt enabled: threshold %.3fg (%d LSB), duration %d ticks\n",
                   threshold_g, ths, duration_count);
     return true;
@@ -384,6 +546,7 @@ bool FED4::enableRTCAlarmInterrupt(uint8_t alarmNum)
 
     // Disable the unused alarm to avoid spurious triggers
     rtc.disableAlarm(alarmNum == 1 ? 2 : 1);
+    armInterruptSource(INT_SRC_RTC);
 
     Serial.printf("RTC alarm %d interrupt output configured (set alarm time with setAlarm%d())\n",
                   alarmNum, alarmNum);
@@ -399,6 +562,7 @@ bool FED4::enableBatteryAlert(float minVoltage, float maxVoltage)
     maxlipo.setAlertVoltages(minVoltage, maxVoltage);
     // Clear any pre-existing flags before enabling
     maxlipo.clearAlertFlag(maxlipo.getAlertStatus());
+    armInterruptSource(INT_SRC_BATTERY);
     Serial.printf("Battery alert enabled: %.2fV – %.2fV\n", minVoltage, maxVoltage);
     return true;
 }
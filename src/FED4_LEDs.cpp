@@ -15,7 +15,9 @@
  *    centerLight("yellow");        // Center poke LEDs yellow
  *    rightLight("red", 200);       // Right poke LEDs red, brightness 200
  *    setStripPixel(0, "green");    // Individual LED green
- *    colorWipe("white", 10);       // Wipe animation
+ *    colorWipe("white", 10);       // Wipe animation (blocking)
+ *    stripRainbowAsync(20, 1);     // Same animations without blocking:
+ *                                  // stepped by update() (FED4_LedAnim.cpp)
  *
  *  Available Colors:
  * - "red"    (255, 0, 0)
@@ -37,6 +39,7 @@
  *
  * Note: If an unrecognized color name is passed to a strip function
  * the LED(s) default to off.
+ * Names live in FED4_Colors.h; FED4_COLOR("red") is the compile-time form.
  ********************************************************/
 
 // ── RGB LED STRIP (WS2812B, 8 LEDs, PSV3 rail) ──────────────────────────────
@@ -54,10 +57,10 @@ bool FED4::initializeStrip()
     
     // Test the strip by setting all pixels to red briefly
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Red);
-    FastLED.show();
+    showStrip(true);
     delay(1);
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
-    FastLED.show();
+    showStrip(true);
     
     return true;
 }
@@ -78,9 +81,8 @@ void FED4::colorWipe(const char* colorName, unsigned long wait)
 // New overloaded function that takes uint32_t color value
 void FED4::colorWipe(uint32_t color, unsigned long wait)
 {
-    fill_solid(strip_leds, NUM_STRIP_LEDS, color);
-    FastLED.show();
-    delay(wait * NUM_STRIP_LEDS); // Keep total time similar
+    colorWipeAsync(color, wait);
+    waitAnimation(UINT32_MAX);
 }
 
 // Example usage:
@@ -94,18 +96,8 @@ void FED4::stripTheaterChase(const char* colorName, unsigned long wait, unsigned
 // New overloaded function that takes uint32_t color value
 void FED4::stripTheaterChase(uint32_t color, unsigned long wait, unsigned int groupSize, unsigned int numChases)
 {
-    for(int chase = 0; chase < numChases; chase++) {
-        for(int q=0; q < groupSize; q++) {
-            for(int i=0; i < NUM_STRIP_LEDS; i=i+groupSize) {
-                strip_leds[i+q] = color;
-            }
-            FastLED.show();
-            delay(wait);
-            for(int i=0; i < NUM_STRIP_LEDS; i=i+groupSize) {
-                strip_leds[i+q] = CRGB::Black;
-            }
-        }
-    }
+    stripTheaterChaseAsync(color, wait, groupSize, numChases);
+    waitAnimation(UINT32_MAX);
 }
 
 // Example usage:
@@ -115,15 +107,8 @@ void FED4::stripTheaterChase(uint32_t color, unsigned long wait, unsigned int gr
 // stripRainbow(25, 3);     // Fast rainbow animation with 25ms delay, 3 loops
 void FED4::stripRainbow(unsigned long wait, unsigned int numLoops)
 {
-    for (unsigned int count = 0; count < numLoops; count++)
-    {
-        uint8_t hue = 0;
-        for (int i = 0; i < 256; i++) {
-            fill_rainbow(strip_leds, NUM_STRIP_LEDS, hue++, 255 / NUM_STRIP_LEDS);
-            FastLED.show();
-            delay(wait);
-        }
-    }
+    stripRainbowAsync(wait, numLoops);
+    waitAnimation(UINT32_MAX);
 }
 
 // Example usage:
@@ -145,117 +130,8 @@ void FED4::randomMotion(float motionStrength, const char *colorName, unsigned lo
 // durationMs: Duration of the animation in milliseconds (default: 2000)
 void FED4::randomMotion(float motionStrength, uint32_t color, unsigned long frameDelay, unsigned long durationMs)
 {
-    // Clamp motionStrength to valid range
-    if (motionStrength < -1.0f) motionStrength = -1.0f;
-    if (motionStrength > 1.0f) motionStrength = 1.0f;
-    
-    // Convert motionStrength to probability of rightward motion
-    // -1.0 -> 0.0 (0% right, 100% left)
-    //  0.0 -> 0.5 (50% right, 50% left)
-    // +1.0 -> 1.0 (100% right, 0% left)
-    float probRight = (motionStrength + 1.0f) / 2.0f;
-    
-    // Structure to track moving dots
-    struct Dot {
-        int position;      // Current position (1 to 6)
-        bool active;        // Whether this dot is active
-    };
-    
-    // Maximum number of dots active at once
-    const int MAX_DOTS = 5;
-    Dot dots[MAX_DOTS];
-    
-    // Initialize all dots as inactive
-    for (int i = 0; i < MAX_DOTS; i++) {
-        dots[i].active = false;
-    }
-    
-    // Track completed cycles (dots that have moved off the visible area)
-    unsigned int completedCycles = 0;
-    const unsigned int MAX_CYCLES = 3;
-    
-    // Run animation for the specified duration
-    unsigned long startTime = millis();
-    while (completedCycles < MAX_CYCLES && (millis() - startTime) < durationMs) {
-        // Clear the strip
-        fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
-        
-        // Update existing dots - direction determined probabilistically each step
-        for (int i = 0; i < MAX_DOTS; i++) {
-            if (dots[i].active) {
-                // Determine movement direction probabilistically based on motionStrength
-                float randVal = (float)random(0, 10000) / 10000.0f;
-                int moveDirection;
-                
-                if (randVal < probRight) {
-                    // Move right
-                    moveDirection = 1;
-                } else {
-                    // Move left
-                    moveDirection = -1;
-                }
-                
-                // Move the dot
-                dots[i].position += moveDirection;
-                
-                // Check if dot has moved off the visible area (positions 0 and 7 are excluded)
-                // Dots are only visible in positions 1 to 6
-                if (dots[i].position < 1 || dots[i].position > 6) {
-                    // Dot moved off the visible area
-                    completedCycles++;
-                    dots[i].active = false;
-                } else {
-                    // Draw the dot at its current position (only positions 1 to 6)
-                    strip_leds[dots[i].position] = color;
-                }
-            }
-        }
-        
-        // Randomly spawn new dots anywhere in the visible range
-        // Ensure minimum of 2 dots are always active
-        int activeCount = 0;
-        for (int i = 0; i < MAX_DOTS; i++) {
-            if (dots[i].active) activeCount++;
-        }
-        
-        const int MIN_DOTS = 2;
-        
-        // If we have fewer than minimum dots, always spawn (100% chance)
-        // Otherwise, spawn with probability based on active count
-        bool shouldSpawn = false;
-        if (activeCount < MIN_DOTS) {
-            shouldSpawn = true; // Always spawn if below minimum
-        } else if (activeCount < MAX_DOTS && random(0, 100) < 30) {
-            shouldSpawn = true; // 30% chance per frame when not at max
-        }
-        
-        if (shouldSpawn) {
-            // Find an inactive dot slot
-            for (int i = 0; i < MAX_DOTS; i++) {
-                if (!dots[i].active) {
-                    // Spawn dot at random position in visible range (1 to 6)
-                    dots[i].position = random(1, 7); // random between 1 and 6 inclusive
-                    dots[i].active = true;
-                    // Draw the newly spawned dot immediately at its spawn position
-                    strip_leds[dots[i].position] = color;
-                    break;
-                }
-            }
-        }
-        
-        // Show the frame
-        FastLED.show();
-        delay(frameDelay);
-        
-        // Stop if we've completed 3 cycles
-        if (completedCycles >= MAX_CYCLES) {
-            break;
-        }
-    }
-    
-    // Clear the strip at the end
-    fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
-    FastLED.show();
+    randomMotionAsync(motionStrength, color, frameDelay, durationMs);
+    waitAnimation(UINT32_MAX);
 }
 
 // Clear the strip
@@ -263,8 +139,9 @@ void FED4::randomMotion(float motionStrength, uint32_t color, unsigned long fram
 // lightsOff();    // Clears the front LEDs on FED4
 void FED4::lightsOff()
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
-    FastLED.show();
+    showStrip();
 }
 
 // Example usage:
@@ -275,8 +152,9 @@ void FED4::lightsOff()
 void FED4::setStripPixel(uint8_t pixel, uint32_t color)
 {
     if (pixel < NUM_STRIP_LEDS) {
+        stopAnimation();
         strip_leds[pixel] = color;
-        FastLED.show();
+        showStrip();
     }
 }
 
@@ -287,12 +165,12 @@ void FED4::setStripPixel(uint8_t pixel, uint32_t color)
 // leftLight("blue");    // Set left port to blue
 void FED4::leftLight(uint32_t color)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     strip_leds[5] = color;
     strip_leds[6] = color;
     strip_leds[7] = color;
-    FastLED.show();
-    delay(1);
+    showStrip();
 }
 
 // Example usage:
@@ -303,6 +181,7 @@ void FED4::leftLight(uint32_t color)
 // leftLight("yellow", 1);   // Set left port to yellow with minimum brightness 10
 void FED4::leftLight(uint32_t color, uint8_t brightness)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     // Enforce minimum brightness of 10
     if (brightness < 10) {
@@ -316,9 +195,7 @@ void FED4::leftLight(uint32_t color, uint8_t brightness)
     strip_leds[5] = dimmedColor;
     strip_leds[6] = dimmedColor;
     strip_leds[7] = dimmedColor;
-    FastLED.show();
-    delay(1);
-
+    showStrip();
 }
 
 // Example usage:
@@ -328,12 +205,11 @@ void FED4::leftLight(uint32_t color, uint8_t brightness)
 // centerLight("blue");    // Set center port to blue
 void FED4::centerLight(uint32_t color)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     strip_leds[3] = color;
     strip_leds[4] = color;
-    FastLED.show();
-    delay(1);
-
+    showStrip();
 }
 
 // Example usage:
@@ -344,6 +220,7 @@ void FED4::centerLight(uint32_t color)
 // centerLight("yellow", 1);   // Set center port to yellow with minimum brightness 10
 void FED4::centerLight(uint32_t color, uint8_t brightness)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     // Enforce minimum brightness of 10
     if (brightness < 10) {
@@ -356,8 +233,7 @@ void FED4::centerLight(uint32_t color, uint8_t brightness)
     uint32_t dimmedColor = (r << 16) | (g << 8) | b;
     strip_leds[3] = dimmedColor;
     strip_leds[4] = dimmedColor;
-    FastLED.show();
-    delay(1);
+    showStrip();
 }
 
 // Example usage:
@@ -367,12 +243,12 @@ void FED4::centerLight(uint32_t color, uint8_t brightness)
 // rightLight("blue");    // Set right port to blue
 void FED4::rightLight(uint32_t color)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     strip_leds[0] = color;
     strip_leds[1] = color;
     strip_leds[2] = color;
-    FastLED.show();
-    delay(1);
+    showStrip();
 }
 
 // Example usage:
@@ -383,6 +259,7 @@ void FED4::rightLight(uint32_t color)
 // rightLight("yellow", 1);   // Set right port to yellow with minimum brightness 10
 void FED4::rightLight(uint32_t color, uint8_t brightness)
 {
+    stopAnimation();
     fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
     // Enforce minimum brightness of 20
     if (brightness < 20) {
@@ -396,8 +273,7 @@ void FED4::rightLight(uint32_t color, uint8_t brightness)
     strip_leds[0] = dimmedColor;
     strip_leds[1] = dimmedColor;
     strip_leds[2] = dimmedColor;
-    FastLED.show();
-    delay(1);
+    showStrip();
 }
 
 // Example usage:
@@ -517,25 +393,9 @@ void FED4::noPix()
 // Convert color name to RGB value:
 // uint32_t redColor = getColorFromString("red");       // Get red color value
 // uint32_t blueColor = getColorFromString("blue");     // Get blue color value
+// Perfect-hash lookup in the FED4_Colors.h registry (case-insensitive).
+// For literals in cue code, FED4_COLOR("red") resolves at compile time.
 uint32_t FED4::getColorFromString(const char *colorName)
 {
-    if (strcasecmp(colorName, "red") == 0)
-        return CRGB::Red;
-    if (strcasecmp(colorName, "green") == 0)
-        return CRGB::Green;
-    if (strcasecmp(colorName, "blue") == 0)
-        return CRGB::Blue;
-    if (strcasecmp(colorName, "white") == 0)
-        return CRGB::White;
-    if (strcasecmp(colorName, "black") == 0)
-        return CRGB::Black;
-    if (strcasecmp(colorName, "yellow") == 0)
-        return CRGB::Yellow;
-    if (strcasecmp(colorName, "purple") == 0)
-        return CRGB::Purple;
-    if (strcasecmp(colorName, "cyan") == 0)
-        return CRGB::Cyan;
-    if (strcasecmp(colorName, "orange") == 0)
-        return CRGB::Orange;
-    return CRGB::Black; // Default to off if color not recognized
-}
\ No newline at end of file
+    return fed4Color(colorName);
+}
@@ -0,0 +1,172 @@
+#include "FED4.h"
+#include "FED4_Ring.h"
+
+#include "driver/gpio.h"
+
+// ── Lane (head-entry) events ─────────────────────────────────────────────────
+// PG2 (left) / PG3 (right) beam breaks, debounced in software from the edge
+// stream (servicePhotogates) or from light-sleep GPIO wakes (startSleep).
+// A raw edge commits once the level has held for laneDebounceMs; shorter
+// blips are dropped. Completed visits are queued and logged by updateLanes().
+
+static const uint8_t kLanePins[FED4_NUM_LANES] = {PHOTOGATE_2, PHOTOGATE_3};
+static const char *const kLaneNames[FED4_NUM_LANES] = {"Left", "Right"};
+
+struct FedLaneVisit
+{
+    uint8_t lane;
+    FedTimeUs entryUs;
+    uint32_t dwellMs;
+};
+
+static FedRing<FedLaneVisit, 16> sLaneVisits;
+
+// ── debounce ─────────────────────────────────────────────────────────────────
+
+/** Commit a held raw level as a stable transition stamped at the raw edge time. */
+void FED4::commitLane(uint8_t lane, FedTimeUs nowUs)
+{
+    FedLaneStats &s = lanes[lane];
+    const bool rawBroken = (s.rawLevel == LOW);
+    if (rawBroken == s.occupied)
+        return;
+    if (nowUs - s.rawUs < (FedTimeUs)laneDebounceMs * 1000)
+        return;
+
+    if (rawBroken)
+    {
+        s.occupied = true;
+        s.entryUs = s.rawUs;
+        s.entries++;
+        s.windowEntries++;
+    }
+    else
+    {
+        s.occupied = false;
+        s.lastDwellMs = (uint32_t)((s.rawUs - s.entryUs) / 1000);
+        s.windowDwellMs += s.lastDwellMs;
+        if (s.lastDwellMs > s.maxDwellMs)
+            s.maxDwellMs = s.lastDwellMs;
+
+        FedLaneVisit visit;
+        visit.lane = lane;
+        visit.entryUs = s.entryUs;
+        visit.dwellMs = s.lastDwellMs;
+        sLaneVisits.push(visit);
+    }
+}
+
+/** Feed one raw lane edge (loop context — from servicePhotogates or a sleep wake). */
+void FED4::laneEdge(uint8_t lane, uint8_t level, FedTimeUs timeUs)
+{
+    FedLaneStats &s = lanes[lane];
+    if (level == s.rawLevel)
+        return;
+    commitLane(lane, timeUs); // previous raw level held long enough?
+    s.rawLevel = level;
+    s.rawUs = timeUs;
+}
+
+// ── light-sleep wake ─────────────────────────────────────────────────────────
+
+/**
+ * Arm GPIO wake on the opposite of each lane's current level, so a mouse
+ * parked in a lane does not hold the wake line. The CHANGE ISR is masked
+ * first — a level-type interrupt would otherwise storm after wake.
+ */
+void FED4::armLaneWake()
+{
+    const FedTimeUs nowUs = fedNowUs();
+    for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+    {
+        const uint8_t level = (uint8_t)digitalRead(kLanePins[lane]);
+        laneEdge(lane, level, nowUs);
+        gpio_intr_disable((gpio_num_t)kLanePins[lane]);
+        gpio_wakeup_enable((gpio_num_t)kLanePins[lane],
+                           level == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    }
+}
+
+void FED4::disarmLaneWake()
+{
+    for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+    {
+        gpio_wakeup_disable((gpio_num_t)kLanePins[lane]);
+    }
+    // CHANGE ISRs come back with armPhotogates() in wakeUp()
+}
+
+/**
+ * After esp_light_sleep_start(): if only a lane changed, stamp it and return
+ * true so startSleep() can go straight back to sleep without a full wakeUp().
+ */
+bool FED4::serviceLaneWake()
+{
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_GPIO)
+        return false;
+    if (digitalRead(BUTTON_1) == HIGH || digitalRead(BUTTON_2) == HIGH ||
+        digitalRead(BUTTON_3) == HIGH)
+        return false;
+
+    const FedTimeUs nowUs = fedNowUs();
+    bool changed = false;
+    for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+    {
+        const uint8_t level = (uint8_t)digitalRead(kLanePins[lane]);
+        if (level != lanes[lane].rawLevel)
+        {
+            laneEdge(lane, level, nowUs);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// ── aggregation / logging ────────────────────────────────────────────────────
+
+/**
+ * Commit settled lane levels, then log per visit or as a periodic summary
+ * depending on laneLogMode. Called from update().
+ */
+void FED4::updateLanes()
+{
+    const FedTimeUs nowUs = fedNowUs();
+    for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+    {
+        commitLane(lane, nowUs);
+    }
+
+    FedLaneVisit visit;
+    while (sLaneVisits.pop(visit))
+    {
+        if (laneLogMode != FedLaneLogMode::PerEvent)
+            continue;
+        char detail[64];
+        snprintf(detail, sizeof(detail), "entry=%.3f;dwell=%lu",
+                 visit.entryUs / 1000000.0, (unsigned long)visit.dwellMs);
+        logData(String(kLaneNames[visit.lane]) + "Lane", detail);
+    }
+
+    if (laneLogMode != FedLaneLogMode::Summary)
+        return;
+
+    const uint32_t nowMs = millis();
+    if (nowMs - lastLaneSummaryMs < laneSummarySeconds * 1000UL)
+        return;
+    lastLaneSummaryMs = nowMs;
+
+    const FedLaneStats &l = lanes[0];
+    const FedLaneStats &r = lanes[1];
+    char detail[128];
+    snprintf(detail, sizeof(detail), "L=%lu;LDwell=%lu;LMax=%lu;R=%lu;RDwell=%lu;RMax=%lu",
+             (unsigned long)l.windowEntries, (unsigned long)l.windowDwellMs, (unsigned long)l.maxDwellMs,
+             (unsigned long)r.windowEntries, (unsigned long)r.windowDwellMs, (unsigned long)r.maxDwellMs);
+    logData("LaneSummary", detail);
+
+    for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+    {
+        lanes[lane].windowEntries = 0;
+        lanes[lane].windowDwellMs = 0;
+        lanes[lane].maxDwellMs = 0;
+    }
+}
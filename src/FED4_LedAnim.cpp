@@ -0,0 +1,121 @@
+#include "FED4.h"
+
+// ── Front-strip animation engine ─────────────────────────────────────────────
+// One effect at a time (FED4_LedAnim.h), stepped by serviceLeds() from update()
+// and the dispense / pellet-well loops, so cue lights keep running while pokes
+// and photogate edges are handled. FastLED stays in loop context. showStrip()
+// compares the buffer with what was last sent and skips unchanged frames: a
+// WS2812 push is ~30 µs/LED with interrupts held off, and most ticks of a
+// held keyframe or a slow rainbow change nothing.
+
+// Built-in effects behind the *Async() helpers (loop context only)
+static FedFillEffect sFillFx;
+static FedChaseEffect sChaseFx;
+static FedRainbowEffect sRainbowFx;
+static FedMotionEffect sMotionFx;
+static FedKeyframeEffect sKeyframeFx;
+
+/** Push the strip if pixels or brightness changed since the last push (or force). */
+bool FED4::showStrip(bool force)
+{
+    const uint8_t brightness = FastLED.getBrightness();
+    if (!force && stripShadowValid && brightness == stripShadowBrightness &&
+        memcmp(stripShadow, strip_leds, sizeof(strip_leds)) == 0)
+    {
+        stripShowsSkipped++;
+        return false;
+    }
+    FastLED.show();
+    memcpy(stripShadow, strip_leds, sizeof(strip_leds));
+
+    // Lit load for energy accounting: channel sum × brightness, 256 = all white at 255
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < NUM_STRIP_LEDS; i++)
+        sum += strip_leds[i].r + strip_leds[i].g + strip_leds[i].b;
+    energyLevel(FedPowerState::Leds, (uint16_t)(sum * brightness * 256UL / (765UL * NUM_STRIP_LEDS * 255UL)));
+    stripShadowBrightness = brightness;
+    stripShadowValid = true;
+    stripShows++;
+    return true;
+}
+
+/** Start effect (replacing any running one) and draw its first frame now. */
+void FED4::playAnimation(FedLedEffect &effect)
+{
+    ledEffect = &effect;
+    ledEffect->begin();
+    ledEffectStartMs = millis();
+    serviceLeds();
+}
+
+/** Stop the running effect; its last frame stays lit unless clear. */
+void FED4::stopAnimation(bool clear)
+{
+    ledEffect = nullptr;
+    if (clear)
+    {
+        fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
+        showStrip();
+    }
+}
+
+bool FED4::animationRunning() const
+{
+    return ledEffect != nullptr;
+}
+
+bool FED4::waitAnimation(uint32_t timeoutMs)
+{
+    const unsigned long start = millis();
+    while (ledEffect != nullptr)
+    {
+        if (millis() - start >= timeoutMs)
+            return false;
+        delay(1);
+        serviceLeds();
+    }
+    return true;
+}
+
+/** Draw the current frame of the running effect and push it if it changed. */
+void FED4::serviceLeds()
+{
+    if (ledEffect == nullptr)
+        return;
+    const bool more = ledEffect->render(strip_leds, NUM_STRIP_LEDS, millis() - ledEffectStartMs);
+    showStrip();
+    if (!more)
+        ledEffect = nullptr;
+}
+
+// ── non-blocking versions of the LED animations ─────────────────────────────
+
+void FED4::colorWipeAsync(uint32_t color, unsigned long wait)
+{
+    sFillFx = FedFillEffect(color, wait * NUM_STRIP_LEDS);
+    playAnimation(sFillFx);
+}
+
+void FED4::stripTheaterChaseAsync(uint32_t color, unsigned long wait, unsigned int groupSize, unsigned int numChases)
+{
+    sChaseFx = FedChaseEffect(color, wait, (uint8_t)groupSize, (uint16_t)numChases);
+    playAnimation(sChaseFx);
+}
+
+void FED4::stripRainbowAsync(unsigned long wait, unsigned int numLoops)
+{
+    sRainbowFx = FedRainbowEffect(wait, (uint16_t)numLoops);
+    playAnimation(sRainbowFx);
+}
+
+void FED4::randomMotionAsync(float motionStrength, uint32_t color, unsigned long frameDelay, unsigned long durationMs)
+{
+    sMotionFx = FedMotionEffect(motionStrength, color, frameDelay, durationMs);
+    playAnimation(sMotionFx);
+}
+
+void FED4::playKeyframes(const FedLedKeyframe *frames, uint8_t count, uint16_t numLoops)
+{
+    sKeyframeFx = FedKeyframeEffect(frames, count, numLoops);
+    playAnimation(sKeyframeFx);
+}
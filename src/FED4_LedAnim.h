@@ -0,0 +1,229 @@
+#pragma once
+
+#include <FastLED.h>
+
+// Front-strip animation effects for FED4::playAnimation(). An effect draws the
+// frame for "ms since start" into the strip buffer; serviceLeds() calls it from
+// loop context (FastLED is loop-only) and pushes the strip only when a pixel or
+// the brightness changed. Frames come from elapsed time, so a late tick skips
+// frames instead of stretching the animation.
+
+/** Pixel masks for FedLedKeyframe (bit i = strip LED i). */
+static constexpr uint8_t FED4_LEDS_RIGHT = 0x07;  // LEDs 0-2
+static constexpr uint8_t FED4_LEDS_CENTER = 0x18; // LEDs 3-4
+static constexpr uint8_t FED4_LEDS_LEFT = 0xE0;   // LEDs 5-7
+static constexpr uint8_t FED4_LEDS_ALL = 0xFF;
+
+class FedLedEffect
+{
+public:
+    virtual ~FedLedEffect() {}
+    /** Reset per-run state; called by playAnimation(). */
+    virtual void begin() {}
+    /** Draw the frame at elapsedMs into leds[count]. false = finished (frame stays lit). */
+    virtual bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) = 0;
+};
+
+/** Solid fill held for holdMs (colorWipe timing). */
+class FedFillEffect : public FedLedEffect
+{
+public:
+    FedFillEffect(uint32_t color = 0, uint32_t holdMs = 0) : color(color), holdMs(holdMs) {}
+    bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) override
+    {
+        fill_solid(leds, count, CRGB(color));
+        return elapsedMs < holdMs;
+    }
+
+private:
+    uint32_t color;
+    uint32_t holdMs;
+};
+
+/** Every groupSize-th LED lit, stepping one LED per waitMs, numChases times round. */
+class FedChaseEffect : public FedLedEffect
+{
+public:
+    FedChaseEffect(uint32_t color = 0, uint32_t waitMs = 50, uint8_t groupSize = 3, uint16_t numChases = 10)
+        : color(color), waitMs(waitMs ? waitMs : 1), groupSize(groupSize ? groupSize : 1), numChases(numChases) {}
+    bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) override
+    {
+        uint32_t frame = elapsedMs / waitMs;
+        const uint32_t frames = (uint32_t)numChases * groupSize;
+        const bool more = frame < frames;
+        if (!more)
+            frame = frames ? frames - 1 : 0;
+        const uint8_t q = frame % groupSize;
+        fill_solid(leds, count, CRGB::Black);
+        for (uint8_t i = q; i < count; i += groupSize)
+            leds[i] = color;
+        return more;
+    }
+
+private:
+    uint32_t color;
+    uint32_t waitMs;
+    uint8_t groupSize;
+    uint16_t numChases;
+};
+
+/** Hue rotation, one hue step per waitMs, numLoops full turns. */
+class FedRainbowEffect : public FedLedEffect
+{
+public:
+    FedRainbowEffect(uint32_t waitMs = 50, uint16_t numLoops = 1)
+        : waitMs(waitMs ? waitMs : 1), numLoops(numLoops) {}
+    bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) override
+    {
+        uint32_t frame = elapsedMs / waitMs;
+        const uint32_t frames = (uint32_t)numLoops * 256;
+        const bool more = frame < frames;
+        if (!more)
+            frame = frames ? frames - 1 : 0;
+        fill_rainbow(leds, count, (uint8_t)frame, 255 / count);
+        return more;
+    }
+
+private:
+    uint32_t waitMs;
+    uint16_t numLoops;
+};
+
+/**
+ * Dots random-walking across LEDs 1-6 (randomMotion). motionStrength -1..+1
+ * biases each step left/right; ends after 3 dots leave or durationMs, cleared.
+ */
+class FedMotionEffect : public FedLedEffect
+{
+public:
+    FedMotionEffect(float motionStrength = 0.0f, uint32_t color = 0, uint32_t frameMs = 75, uint32_t durationMs = 3000)
+        : color(color), frameMs(frameMs ? frameMs : 1), durationMs(durationMs)
+    {
+        if (motionStrength < -1.0f)
+            motionStrength = -1.0f;
+        if (motionStrength > 1.0f)
+            motionStrength = 1.0f;
+        probRight = (motionStrength + 1.0f) / 2.0f;
+    }
+    void begin() override
+    {
+        for (uint8_t i = 0; i < MAX_DOTS; i++)
+            active[i] = false;
+        completed = 0;
+        steps = 0;
+    }
+    bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) override
+    {
+        if (completed >= MAX_CYCLES || elapsedMs >= durationMs)
+        {
+            fill_solid(leds, count, CRGB::Black);
+            return false;
+        }
+        // One simulation step per frame period; a late tick runs only the newest
+        if (elapsedMs / frameMs + 1 > steps)
+        {
+            steps = elapsedMs / frameMs + 1;
+            step();
+        }
+        fill_solid(leds, count, CRGB::Black);
+        for (uint8_t i = 0; i < MAX_DOTS; i++)
+        {
+            if (active[i] && position[i] < count)
+                leds[position[i]] = color;
+        }
+        return true;
+    }
+
+private:
+    static constexpr uint8_t MAX_DOTS = 5;
+    static constexpr uint8_t MIN_DOTS = 2;
+    static constexpr uint8_t MAX_CYCLES = 3;
+
+    void step()
+    {
+        uint8_t activeCount = 0;
+        for (uint8_t i = 0; i < MAX_DOTS; i++)
+        {
+            if (!active[i])
+                continue;
+            const int8_t next = position[i] + ((float)random(0, 10000) / 10000.0f < probRight ? 1 : -1);
+            if (next < 1 || next > 6)
+            {
+                completed++; // walked off the visible LEDs
+                active[i] = false;
+            }
+            else
+            {
+                position[i] = next;
+                activeCount++;
+            }
+        }
+        if (activeCount < MIN_DOTS || (activeCount < MAX_DOTS && random(0, 100) < 30))
+        {
+            for (uint8_t i = 0; i < MAX_DOTS; i++)
+            {
+                if (!active[i])
+                {
+                    position[i] = random(1, 7);
+                    active[i] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    uint32_t color;
+    uint32_t frameMs;
+    uint32_t durationMs;
+    float probRight = 0.5f;
+    int8_t position[MAX_DOTS] = {};
+    bool active[MAX_DOTS] = {};
+    uint8_t completed = 0;
+    uint32_t steps = 0;
+};
+
+/** One step of a keyframe cue: color on the mask's LEDs (others off) for durationMs. */
+struct FedLedKeyframe
+{
+    uint16_t durationMs;
+    uint32_t color;
+    uint8_t mask;
+};
+
+/**
+ * Keyframe sequence, numLoops times (0 = until stopAnimation()). The table is
+ * not copied — keep it alive while it plays (static const is fine).
+ */
+class FedKeyframeEffect : public FedLedEffect
+{
+public:
+    FedKeyframeEffect(const FedLedKeyframe *frames = nullptr, uint8_t count = 0, uint16_t numLoops = 1)
+        : frames(frames), frameCount(count), numLoops(numLoops)
+    {
+        for (uint8_t i = 0; i < count; i++)
+            periodMs += frames[i].durationMs;
+    }
+    bool render(CRGB *leds, uint8_t count, uint32_t elapsedMs) override
+    {
+        if (frameCount == 0 || periodMs == 0)
+            return false;
+        const uint32_t loop = elapsedMs / periodMs;
+        const bool more = numLoops == 0 || loop < numLoops;
+        uint32_t t = more ? elapsedMs % periodMs : periodMs - 1;
+        uint8_t k = 0;
+        while (k + 1 < frameCount && t >= frames[k].durationMs)
+        {
+            t -= frames[k].durationMs;
+            k++;
+        }
+        for (uint8_t i = 0; i < count; i++)
+            leds[i] = (frames[k].mask >> i) & 1 ? CRGB(frames[k].color) : CRGB(CRGB::Black);
+        return more;
+    }
+
+private:
+    const FedLedKeyframe *frames;
+    uint8_t frameCount;
+    uint16_t numLoops;
+    uint32_t periodMs = 0;
+};
@@ -0,0 +1,210 @@
+#include "FED4.h"
+
+// ── Ambient light (VEML7700) ─────────────────────────────────────────────────
+// The old setup ran the VEML7700 free at gain 2 / 800 ms and readLux() waited
+// out an integration per call. With lightAutoRange each sample is one-shot:
+// startLightReading() picks the shortest integration that still gives
+// kLightMinCounts at the last light level, powers the ALS up and returns;
+// collectLightReading() reads it once the integration is over and shuts the
+// sensor down again (ALS_SD, ~0.5 µA — below any of its PSM duty-cycle modes,
+// which suit free-running rather than a sample every few minutes). A clipped
+// result is re-measured at the least sensitive range.
+
+struct FedLightRange
+{
+    uint8_t gain;
+    uint8_t it;
+    uint16_t itMs;
+    float gainX;
+};
+
+// Least sensitive first; integration time never shrinks going down the list
+static const FedLightRange kLightRanges[] = {
+    {VEML7700_GAIN_1_8, VEML7700_IT_25MS, 25, 0.125f},
+    {VEML7700_GAIN_1_4, VEML7700_IT_25MS, 25, 0.25f},
+    {VEML7700_GAIN_1, VEML7700_IT_25MS, 25, 1.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_25MS, 25, 2.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_50MS, 50, 2.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_100MS, 100, 2.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_200MS, 200, 2.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_400MS, 400, 2.0f},
+    {VEML7700_GAIN_2, VEML7700_IT_800MS, 800, 2.0f},
+};
+static const uint8_t kLightRangeCount = sizeof(kLightRanges) / sizeof(kLightRanges[0]);
+static const uint8_t kLightFixedRange = kLightRangeCount - 1; // legacy gain 2 / 800 ms
+static const uint8_t kLightStartRange = 5;                    // gain 2 / 100 ms until a first reading
+static const float kLightMaxRes = 0.0036f;                    // lux/count at gain 2, 800 ms
+static const uint16_t kLightMinCounts = 200;                  // ≤ 0.5 % quantization
+static const uint16_t kLightSaturated = 65000;
+static const uint8_t kLightFailuresBeforeReinit = 3;
+
+/** lux per count for a range. */
+static float lightResolution(uint8_t range)
+{
+    const FedLightRange &r = kLightRanges[range];
+    return kLightMaxRes * (800.0f / r.itMs) * (2.0f / r.gainX);
+}
+
+/** Least sensitive (so shortest) range that still gives kLightMinCounts at lux. */
+static uint8_t pickLightRange(float lux)
+{
+    if (lux < 0)
+        return kLightStartRange;
+    for (uint8_t i = 0; i < kLightRangeCount; i++)
+    {
+        if (lux / lightResolution(i) >= kLightMinCounts)
+            return i;
+    }
+    return kLightRangeCount - 1;
+}
+
+bool FED4::initializeLightSensor()
+{
+    // Initialize the light sensor on the primary I2C bus
+    if (!lightSensor.begin(&Wire)) {
+        Serial.println("Light sensor initialization failed");
+        return false;
+    }
+
+    const FedLightRange &r = kLightRanges[lightAutoRange ? lightRange : kLightFixedRange];
+    lightSensor.setGain(r.gain);
+    lightSensor.setIntegrationTime(r.it);
+    lightSensor.powerSaveEnable(false); // PSM off: one-shot via shutdown, or free-running at full rate
+    lightSensor.enable(!lightAutoRange); // auto-range powers up per sample
+    lightPending = false;
+
+    // Add a small delay for configuration to take effect
+    delay(5);
+
+    return true;
+}
+
+/**
+ * Attempts to reinitialize the light sensor if it's not responding
+ */
+bool FED4::reinitializeLightSensor() {
+    // First, try to reset the I2C bus
+    Wire.end();
+    delay(1);  // Give bus time to reset (reduced from 50ms)
+    Wire.begin(SDA, SCL);
+    delay(1);  // Give bus time to stabilize (reduced from 50ms)
+
+    if (!initializeLightSensor()) {
+        return false;
+    }
+    Wire.beginTransmission(I2C_ADDR_LIGHT);
+    return Wire.endTransmission() == 0;
+}
+
+/** Configure the range for this sample and power the ALS up; false if it does not answer. */
+bool FED4::startLightReading()
+{
+    if (lightPending) {
+        return true;
+    }
+    Wire.beginTransmission(I2C_ADDR_LIGHT);
+    if (Wire.endTransmission() != 0) {
+        if (++lightFailures >= kLightFailuresBeforeReinit && reinitializeLightSensor()) {
+            lightFailures = 0;
+        }
+        return false;
+    }
+
+    if (!lightAutoRange) {
+        // Free-running at the fixed range: the last integration is already in the register
+        if (lightPendingRange != kLightFixedRange || !lightSensor.enabled()) {
+            lightSensor.setGain(kLightRanges[kLightFixedRange].gain);
+            lightSensor.setIntegrationTime(kLightRanges[kLightFixedRange].it);
+            lightSensor.enable(true);
+            lightReadyMs = millis() + kLightRanges[kLightFixedRange].itMs * 2;
+        } else {
+            lightReadyMs = millis();
+        }
+        lightPendingRange = kLightFixedRange;
+        lightPending = true;
+        return true;
+    }
+
+    const FedLightRange &r = kLightRanges[lightRange];
+    lightSensor.setGain(r.gain);
+    lightSensor.setIntegrationTime(r.it, false);
+    lightSensor.enable(true);
+    lightPendingRange = lightRange;
+    lightReadyMs = millis() + r.itMs + r.itMs / 4 + 3; // one integration plus wake-up margin
+    lightPending = true;
+    return true;
+}
+
+/** Read the pending sample once its integration is over (or wait for it); true when stored. */
+bool FED4::collectLightReading(bool wait)
+{
+    while (lightPending)
+    {
+        const int32_t remaining = (int32_t)(lightReadyMs - millis());
+        if (remaining > 0) {
+            if (!wait) {
+                return false;
+            }
+            delay(remaining);
+        }
+        lightPending = false;
+
+        const uint8_t range = lightPendingRange;
+        const uint16_t als = lightSensor.readALS(false);
+        const uint16_t rawWhite = lightSensor.readWhite(false);
+        lightFailures = 0;
+
+        if (als >= kLightSaturated && lightAutoRange && range > 0) {
+            // Clipped: measure again at the least sensitive range
+            lightSaturations++;
+            lightRange = 0;
+            startLightReading();
+            continue;
+        }
+        if (lightAutoRange) {
+            lightSensor.enable(false);
+        }
+
+        const float res = lightResolution(range);
+        float luxValue = als * res;
+        if (luxValue > 1000.0f) {
+            // Vishay non-linearity correction for high illuminance
+            luxValue = (((6.0135e-13f * luxValue - 9.3924e-9f) * luxValue + 8.1488e-5f) * luxValue + 1.0023f) * luxValue;
+        }
+        lightLastLux = luxValue;
+        lightLastWhite = rawWhite * (res / kLightMaxRes); // counts on the legacy gain 2 / 800 ms scale
+        lightIntegrationMs = kLightRanges[range].itMs;
+        if (lightAutoRange) {
+            lightRange = pickLightRange(luxValue);
+        }
+        return storeLight(lightLastLux, lightLastWhite);
+    }
+    return false;
+}
+
+/** Lux now (blocking, one auto-ranged sample); -1 if the sensor does not answer. */
+float FED4::getLux()
+{
+    if (!startLightReading() || !collectLightReading(true)) {
+        return -1.0;
+    }
+    return lightLastLux;
+}
+
+/** White channel now, scaled to gain 2 / 800 ms counts; -1 if the sensor does not answer. */
+float FED4::getWhite()
+{
+    if (!startLightReading() || !collectLightReading(true)) {
+        return -1.0;
+    }
+    return lightLastWhite;
+}
+
+/** VEML7700 lux and white now (blocking), re-initializing the sensor if it does not answer. */
+void FED4::refreshLight() {
+  if (startLightReading() || (reinitializeLightSensor() && startLightReading())) {
+    collectLightReading(true);
+  } else {
+    Serial.println("Warning: light sensor not responding during sensor refresh");
+  }
+}
@@ -453,6 +453,7 @@ void FED4::menuRTC() {
                     DateTime newTime = DateTime(currentYear, currentMonth, currentDay, 
                                               currentHour, currentMinute, current.second());
                     rtc.adjust(newTime);
+                    anchorClock(newTime.unixtime());
                     
                     // Update display in real-time
                     fillRect(0, 296, 176, 24, DISPLAY_BLACK);
@@ -535,6 +536,7 @@ void FED4::menuRTC() {
                     DateTime newTime = DateTime(currentYear, currentMonth, currentDay, 
                                               currentHour, currentMinute, current.second());
                     rtc.adjust(newTime);
+                    anchorClock(newTime.unixtime());
                     
                     // Update display in real-time
                     fillRect(0, 296, 176, 24, DISPLAY_BLACK);
@@ -620,5 +622,6 @@ void FED4::menuEnd() {
     refresh();
     delay(1000);
     resetJingle();
+    clearSession(); // new settings start a new log file
     esp_restart();
 }
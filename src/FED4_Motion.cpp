@@ -1,9 +1,174 @@
 #include "FED4.h"
 
+#include "driver/gpio.h"
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
+
 // Motion detection using EKMB1107112 PIR sensor (digital push-pull output on PIR_MOTION pin).
 // The PIR pin is configured in begin() alongside other GPIO pins.
 // STATUS_LED mirrors PIR (same as FED4-Demo-Hardware / FED4-PIR-Sensor).
 
+// ── PIR duty cycle ───────────────────────────────────────────────────────────
+// Activity used to be motionCount/pollCount: the share of update() calls that
+// happened to see the pin high, which says more about the wake rate than about
+// the animal. Now every PIR edge is timed: awake, a CHANGE ISR stamps it with
+// esp_timer; in light sleep the pin is a level wake source armed on the
+// opposite level (like the lanes), and startSleep() stamps the edge and sleeps
+// on. PCNT would count edges but not on-time, and neither PCNT nor GPIO ISRs
+// run in light sleep. serviceMotionWindow() closes the window every
+// motionWindowS from update(): motionPercentage = on-time / window,
+// motionCount = rising edges. Log rows carry the last closed window, so
+// every Motion value covers about the same length (motion_ms= in Detail).
+
+static portMUX_TYPE sPirMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint8_t sPirLevel = LOW;
+static volatile int64_t sPirHighSinceUs = 0; // start of the current high
+static volatile int64_t sPirOnUs = 0;        // closed high time in this window
+static volatile uint32_t sPirEdges = 0;      // rising edges in this window
+static int64_t sPirWindowUs = 0;             // window start (loop context only)
+
+/** Account one level change at timeUs (caller holds sPirMux). */
+static inline void IRAM_ATTR pirEdgeLocked(uint8_t level, int64_t timeUs)
+{
+    if (level == sPirLevel)
+        return;
+    if (level == HIGH)
+    {
+        sPirHighSinceUs = timeUs;
+        sPirEdges = sPirEdges + 1;
+    }
+    else
+    {
+        sPirOnUs = sPirOnUs + (timeUs - sPirHighSinceUs);
+    }
+    sPirLevel = level;
+}
+
+static void IRAM_ATTR fed4PirIsr()
+{
+    const int64_t nowUs = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&sPirMux);
+    pirEdgeLocked((uint8_t)gpio_ll_get_level(&GPIO, PIR_MOTION), nowUs);
+    portEXIT_CRITICAL_ISR(&sPirMux);
+}
+
+/** Stamp the pin's current level now, in case an edge went by unseen. */
+static void pirSync()
+{
+    const uint8_t level = (uint8_t)digitalRead(PIR_MOTION);
+    const int64_t nowUs = esp_timer_get_time();
+    portENTER_CRITICAL(&sPirMux);
+    pirEdgeLocked(level, nowUs);
+    portEXIT_CRITICAL(&sPirMux);
+}
+
+/** High time since the window opened, including a high still in progress. */
+static int64_t pirOnUs(int64_t nowUs)
+{
+    portENTER_CRITICAL(&sPirMux);
+    int64_t on = sPirOnUs;
+    if (sPirLevel == HIGH)
+        on += nowUs - sPirHighSinceUs;
+    portEXIT_CRITICAL(&sPirMux);
+    return on;
+}
+
+/** (Re)attach the CHANGE ISR: at begin() and in wakeUp(), after light sleep changed the interrupt type. */
+void FED4::armPir()
+{
+    if (!useMotionSensor)
+        return;
+    if (sPirWindowUs == 0)
+        sPirWindowUs = esp_timer_get_time();
+    pirSync();
+    attachInterrupt(PIR_MOTION, fed4PirIsr, CHANGE);
+}
+
+// ── light-sleep wake ─────────────────────────────────────────────────────────
+
+/** Arm GPIO wake on the opposite level, so a PIR held high does not hold the wake line. */
+void FED4::armPirWake()
+{
+    if (!useMotionSensor)
+        return;
+    pirSync();
+    gpio_intr_disable((gpio_num_t)PIR_MOTION);
+    gpio_wakeup_enable((gpio_num_t)PIR_MOTION,
+                       sPirLevel == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+}
+
+void FED4::disarmPirWake()
+{
+    gpio_wakeup_disable((gpio_num_t)PIR_MOTION);
+    // CHANGE ISR comes back with armPir() in wakeUp()
+}
+
+/**
+ * After esp_light_sleep_start(): if the PIR changed, stamp the edge and
+ * return true so startSleep() can sleep on without a full wakeUp().
+ */
+bool FED4::servicePirWake()
+{
+    if (!useMotionSensor || esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_GPIO)
+        return false;
+    if (digitalRead(BUTTON_1) == HIGH || digitalRead(BUTTON_2) == HIGH ||
+        digitalRead(BUTTON_3) == HIGH)
+        return false;
+    const uint8_t before = sPirLevel;
+    pirSync();
+    if (sPirLevel == before)
+        return false;
+    pirSleepWakes++;
+    return true;
+}
+
+// ── activity window ──────────────────────────────────────────────────────────
+
+/** PIR on-time in the open window, in percent (live; does not close it). */
+float FED4::motionDutyPercent() const
+{
+    const int64_t nowUs = esp_timer_get_time();
+    const int64_t windowUs = nowUs - sPirWindowUs;
+    if (!useMotionSensor || sPirWindowUs == 0 || windowUs <= 0)
+        return 0.0f;
+    return (float)((double)pirOnUs(nowUs) * 100.0 / (double)windowUs);
+}
+
+/** Close the window: duty into motionPercentage, rising edges into motionCount. */
+void FED4::takeMotionWindow()
+{
+    if (!useMotionSensor || sPirWindowUs == 0)
+        return;
+    pirSync();
+    const int64_t nowUs = esp_timer_get_time();
+    const int64_t windowUs = nowUs - sPirWindowUs;
+    portENTER_CRITICAL(&sPirMux);
+    int64_t on = sPirOnUs;
+    if (sPirLevel == HIGH)
+    {
+        on += nowUs - sPirHighSinceUs;
+        sPirHighSinceUs = nowUs; // the rest of this high counts towards the next row
+    }
+    const uint32_t edges = sPirEdges;
+    sPirOnUs = 0;
+    sPirEdges = 0;
+    portEXIT_CRITICAL(&sPirMux);
+    sPirWindowUs = nowUs;
+
+    motionPercentage = windowUs > 0 ? (float)((double)on * 100.0 / (double)windowUs) : 0.0f;
+    motionCount = (int)edges;
+    motionWindowMs = (uint32_t)(windowUs / 1000);
+}
+
+/** From update(): close the window once it is motionWindowS old (later if the board slept through it). */
+void FED4::serviceMotionWindow()
+{
+    if (!useMotionSensor || sPirWindowUs == 0)
+        return;
+    if (esp_timer_get_time() - sPirWindowUs >= (int64_t)motionWindowS * 1000000)
+        takeMotionWindow();
+}
+
 void FED4::updateStatusLedFromMotion()
 {
     if (!useMotionSensor) {
@@ -24,38 +189,30 @@ bool FED4::motion()
 
     Serial.print("PIR: ");
     Serial.print(motionFlag ? "MOTION" : "clear");
-
     if (motionFlag) {
-        motionCount++;
-        motionPercentage = (pollCount > 0) ? (float)motionCount / pollCount * 100.0 : 0.0;
-
-        Serial.print(" - MOTION DETECTED! ");
-        Serial.print(motionPercentage, 2);
-        Serial.print("% (");
-        Serial.print(motionCount);
-        Serial.print("/");
-        Serial.print(pollCount);
-        Serial.println(")");
-
-        return true;
+        Serial.print(" - MOTION DETECTED!");
     }
 
-    motionPercentage = (pollCount > 0) ? (float)motionCount / pollCount * 100.0 : 0.0;
-
+    // Live on-time of the open window, from the edge timestamps
     Serial.print(" - ");
-    Serial.print(motionPercentage, 2);
-    Serial.print("% (");
-    Serial.print(motionCount);
-    Serial.print("/");
-    Serial.print(pollCount);
-    Serial.println(")");
+    Serial.print(motionDutyPercent(), 2);
+    Serial.print("% on, ");
+    Serial.print((unsigned long)sPirEdges);
+    Serial.println(" edges");
 
-    return false;
+    return motionFlag;
 }
 
 // Reset motion tracking counters (call after logging data)
 void FED4::resetMotionCounters()
 {
+    portENTER_CRITICAL(&sPirMux);
+    sPirOnUs = 0;
+    sPirEdges = 0;
+    if (sPirLevel == HIGH)
+        sPirHighSinceUs = esp_timer_get_time();
+    portEXIT_CRITICAL(&sPirMux);
+    sPirWindowUs = esp_timer_get_time();
     motionCount = 0;
     pollCount = 0;
     motionPercentage = 0.0;
@@ -1,41 +1,33 @@
 #include "FED4.h"
 // NOTE: YOU NEED A BATTERY PLUGGED IN FOR THE MOTOR TO RUN.
 
-bool FED4::initializeMotor()
-{
-    pinMode(MOTOR_PIN_1, OUTPUT);
-    pinMode(MOTOR_PIN_2, OUTPUT);
-    pinMode(MOTOR_PIN_3, OUTPUT);
-    pinMode(MOTOR_PIN_4, OUTPUT);
-    stepper.setSpeed(MOTOR_SPEED);
-    return true;
-}
-
 void FED4::releaseMotor()
 {
-    digitalWrite(MOTOR_PIN_1, LOW);
-    digitalWrite(MOTOR_PIN_2, LOW);
-    digitalWrite(MOTOR_PIN_3, LOW);
-    digitalWrite(MOTOR_PIN_4, LOW);
+    stopMotor(); // parks the step timer and drops queued moves, coils LOW
 }
 
+// Jam moves are queued on the step engine; these wrappers keep the old blocking API.
+
 void FED4::minorJamClear()
 {
     Serial.println("MinorJam");
-    stepper.step(200);
-    delay(1000);
+    queueMotorSteps(200, 1000, FED4_SEG_STOP_ON_PELLET);
+    waitMotorIdle(3000);
 }
 
 void FED4::vibrateJamClear()
-{ // make this function also monitor the pellet well
+{
     Serial.println("VibrateJam");
     for (int i = 0; i < 35; i++)
     {
-        stepper.step(10);
-        delay(10);
-        stepper.step(-20);
-        delay(10);
+        while (motorQueueSpace() < 2)
+        {
+            delay(1);
+        }
+        queueMotorSteps(10, 10, FED4_SEG_STOP_ON_PELLET);
+        queueMotorSteps(-20, 10, FED4_SEG_STOP_ON_PELLET);
     }
+    waitMotorIdle(3000);
 }
 
 void FED4::jammed()
@@ -0,0 +1,157 @@
+#include "FED4.h"
+#include "FED4_Ring.h"
+
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
+
+// ── Photogate edge capture ───────────────────────────────────────────────────
+// CHANGE ISRs on PG1–PG4 push {esp_timer µs, gate, level} into a lock-free
+// SPSC ring; servicePhotogates() drains it in loop context. Gates are on PSV2
+// with pull-ups: HIGH = beam clear, LOW = beam broken (pellet / head / drop).
+// The ISR stamps with esp_timer_get_time() (IRAM-safe), which is the
+// FedTimeUs timebase (FED4_Time.h); loop code uses fedNowUs().
+
+static DRAM_ATTR const uint8_t kGatePins[FED4_NUM_PHOTOGATES] = {
+    PHOTOGATE_1, PHOTOGATE_2, PHOTOGATE_3, PHOTOGATE_4};
+
+static FedRing<FedGateEdge, 64> sGateEdges;
+static TaskHandle_t volatile sGateWaiter = nullptr;
+
+static void IRAM_ATTR fed4PhotogateIsr(void *arg)
+{
+  const uint8_t gate = (uint8_t)(uintptr_t)arg;
+  FedGateEdge edge;
+  edge.timeUs = esp_timer_get_time();
+  edge.gate = gate;
+  edge.level = (uint8_t)gpio_ll_get_level(&GPIO, kGatePins[gate]);
+  sGateEdges.push(edge);
+
+  TaskHandle_t waiter = sGateWaiter;
+  if (waiter)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(waiter, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+// ── init / arm ───────────────────────────────────────────────────────────────
+
+bool FED4::initializePhotogates()
+{
+  for (uint8_t gate = 0; gate < FED4_NUM_PHOTOGATES; gate++)
+  {
+    pinMode(kGatePins[gate], INPUT_PULLUP);
+    photogateLevel[gate] = (uint8_t)digitalRead(kGatePins[gate]);
+    photogateEdgeUs[gate] = 0;
+  }
+
+  const FedTimeUs nowUs = fedNowUs();
+  for (uint8_t lane = 0; lane < FED4_NUM_LANES; lane++)
+  {
+    lanes[lane].rawLevel = photogateLevel[lane + 1];
+    lanes[lane].rawUs = nowUs;
+    lanes[lane].occupied = (lanes[lane].rawLevel == LOW);
+    lanes[lane].entryUs = nowUs;
+  }
+  lastLaneSummaryMs = millis();
+
+  armPhotogates();
+  sGateEdges.clear();
+  return true;
+}
+
+/** gpio_wakeup_disable() in startSleep() resets the pin interrupt type — re-arm on wake. */
+void FED4::armPhotogates()
+{
+  for (uint8_t gate = 0; gate < FED4_NUM_PHOTOGATES; gate++)
+  {
+    detachInterrupt(kGatePins[gate]);
+    attachInterruptArg(kGatePins[gate], fed4PhotogateIsr, (void *)(uintptr_t)gate, CHANGE);
+  }
+}
+
+// ── drain ────────────────────────────────────────────────────────────────────
+
+/**
+ * Drain queued edges into per-gate state and pellet/head-entry timestamps.
+ * Returns the number of edges consumed.
+ */
+uint16_t FED4::servicePhotogates()
+{
+  FedGateEdge edge;
+  uint16_t count = 0;
+
+  while (sGateEdges.pop(edge))
+  {
+    count++;
+    photogateLevel[edge.gate] = edge.level;
+    photogateEdgeUs[edge.gate] = edge.timeUs;
+    const bool broken = (edge.level == LOW);
+
+    switch (edge.gate)
+    {
+    case 0: // PG1 well: first break after arm = arrival; clear not re-broken = taken
+      if (broken)
+      {
+        if (pelletWellUs == 0)
+          pelletWellUs = edge.timeUs;
+        pelletTakenUs = 0; // pellet rocked back into the beam
+      }
+      else
+      {
+        pelletTakenUs = edge.timeUs;
+      }
+      break;
+    case 1: // PG2 left lane
+    case 2: // PG3 right lane
+      if (broken)
+      {
+        headEntryUs = edge.timeUs;
+        headEntryGate = edge.gate;
+      }
+      laneEdge(edge.gate - 1, edge.level, edge.timeUs);
+      break;
+    case 3: // PG4 drop detector
+      if (broken && pelletDropUs == 0)
+        pelletDropUs = edge.timeUs;
+      break;
+    default:
+      break;
+    }
+  }
+
+  return count;
+}
+
+/** Clear pellet timestamps for a new dispense (pending edges are consumed first). */
+void FED4::resetPelletEdges()
+{
+  servicePhotogates();
+  pelletWellUs = 0;
+  pelletTakenUs = 0;
+  pelletDropUs = 0;
+}
+
+/**
+ * Block the calling task until any gate edge is queued or timeoutMs elapses.
+ * Used instead of delay() in pellet loops so edges are serviced immediately.
+ */
+bool FED4::waitForPhotogateEdge(uint32_t timeoutMs)
+{
+  if (!sGateEdges.empty())
+    return true;
+
+  ulTaskNotifyTake(pdTRUE, 0); // drop a stale give from an earlier wait
+  sGateWaiter = xTaskGetCurrentTaskHandle();
+  if (sGateEdges.empty())
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs));
+  sGateWaiter = nullptr;
+
+  return !sGateEdges.empty();
+}
+
+uint32_t FED4::photogateEdgesDropped() const
+{
+  return sGateEdges.dropped();
+}
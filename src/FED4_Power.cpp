@@ -12,19 +12,23 @@ bool FED4::initializePower()
 void FED4::PSV2_ON()
 {
   mcp.digitalWrite(EXP_PSV2_EN, LOW); // active LOW enable
+  psv2On = true;
 }
 
 void FED4::PSV2_OFF()
 {
   mcp.digitalWrite(EXP_PSV2_EN, HIGH);
+  psv2On = false;
 }
 
 void FED4::PSV3_ON()
 {
   mcp.digitalWrite(EXP_PSV3_EN, LOW); // active LOW enable
+  stripShadowValid = false;           // strip powered up dark — next frame must be pushed
 }
 
 void FED4::PSV3_OFF()
 {
   mcp.digitalWrite(EXP_PSV3_EN, HIGH);
+  energyLevel(FedPowerState::Leds, 0); // strip unpowered
 }
@@ -1,8 +1,30 @@
 #include "FED4.h"
+#include "FED4_Ring.h"
 
 // ToF sensor instance - no XSHUT pin on v1.7 board
 SFEVL53L1X distanceSensor(Wire);
 
+// ── Proximity service ────────────────────────────────────────────────────────
+// startProxService() configures the VL53L1X once for autonomous ranging: short
+// distance mode, a short timing budget and an inter-measurement period, so the
+// sensor sleeps between ranges on its own. With a threshold window it only
+// raises GPIO1 (open-drain into INT_OR, INT_SRC_TOF) for ranges in the window.
+// The service arms INT_SRC_TOF; the INT_OR dispatcher (serviceInterrupts() in
+// update(), or serviceProx()) reads the range as it clears the ToF latch and
+// keeps it in a ring with its millis() stamp. No I2C while INT_OR is HIGH.
+
+static FedRing<FedProxSample, 64> sProxSamples; // oldest dropped when full
+static const int kProxCalibrationMm = 20;        // calibration offset in mm
+
+/** Raw VL53L1X mm → prox() scale: offset removed, 0..150. */
+static int proxCalibrate(int raw)
+{
+    const int distance = raw - kProxCalibrationMm;
+    if (distance < 0)
+        return 0;
+    return distance > 150 ? 150 : distance;
+}
+
 bool FED4::initializeToF()
 {
     // Set I2C clock speed for better compatibility
@@ -47,15 +69,37 @@ bool FED4::initializeToF()
         return false;
     }
     
+    tofReady = true;
     return true;
 }
 
 int FED4::prox()
 {
-    // Try to initialize the sensor if not already done
-    if (distanceSensor.begin() != 0)  // Begin returns 0 on a good init
-    {
-        return -1;  // Return -1 for error instead of false
+    // Service running: latest range from the ring, no I2C beyond the INT_OR check
+    if (proxServiceActive) {
+        serviceProx();
+        const uint32_t now = millis();
+        const uint32_t staleMs = 2UL * proxPeriodMs + 100;
+        if (latestProx.ms != 0 && now - latestProx.ms <= staleMs) {
+            return latestProx.mm;
+        }
+        if (now - proxStartMs <= staleMs || (proxErrorMs != 0 && now - proxErrorMs <= staleMs)) {
+            return -1; // no range yet, or the sensor is ranging but failing
+        }
+        // Nothing in the window for 2 periods: the target is outside it, unless
+        // the sensor stopped answering (one register read, only while stale)
+        if (distanceSensor.getSensorID() != 0xEACC) {
+            return -1;
+        }
+        return proxIdleMm;
+    }
+
+    // One-shot: full init only the first time (or after a failed one)
+    if (!tofReady) {
+        if (distanceSensor.begin() != 0) { // Begin returns 0 on a good init
+            return -1;  // Return -1 for error instead of false
+        }
+        tofReady = true;
     }
 
     int distance = -1; // Default error value
@@ -68,6 +112,7 @@ int FED4::prox()
     while (!distanceSensor.checkForDataReady()) {
         if (millis() - startTime > 100) { // 100ms timeout
             distanceSensor.stopRanging();
+            tofReady = false; // re-init on the next call (sensor may have lost power)
             return -1; // Timeout error
         }
         delay(1);
@@ -95,3 +140,103 @@ int FED4::prox()
     
     return distance;
 }
+
+bool FED4::startProxService(uint16_t periodMs, uint16_t nearMm, uint16_t farMm, FedProxWindow window)
+{
+    if (!tofReady) {
+        if (distanceSensor.begin() != 0) {
+            return false;
+        }
+        tofReady = true;
+    }
+    distanceSensor.stopRanging();
+    distanceSensor.setDistanceModeShort();                   // ≤1.3 m, best ambient immunity
+    const uint16_t budgetMs = periodMs >= 40 ? 20 : 15;      // 15 ms is the short-mode minimum
+    distanceSensor.setTimingBudgetInMs(budgetMs);
+    distanceSensor.setIntermeasurementPeriod(max<uint16_t>(periodMs, budgetMs + 5));
+    // Thresholds are on the sensor's raw scale (before the calibration offset)
+    distanceSensor.setDistanceThreshold(nearMm + kProxCalibrationMm, farMm + kProxCalibrationMm, (uint8_t)window);
+    distanceSensor.setInterruptPolarityLow(); // open-drain into INT_OR, idle released
+    distanceSensor.clearInterrupt();
+    distanceSensor.startRanging();
+
+    proxPeriodMs = distanceSensor.getIntermeasurementPeriod();
+    // Inside/Below hide the far ranges (prox() caps them at 150); Above/Outside
+    // hide everything up to farMm
+    proxIdleMm = (window == FedProxWindow::Inside || window == FedProxWindow::Below) ? 150 : min<uint16_t>(farMm, 150);
+    proxStartMs = millis();
+    proxErrorMs = 0;
+    proxServiceActive = true;
+    armInterruptSource(INT_SRC_TOF);
+    return true;
+}
+
+void FED4::stopProxService()
+{
+    if (!proxServiceActive) {
+        return;
+    }
+    distanceSensor.stopRanging();
+    distanceSensor.clearInterrupt();
+    proxServiceActive = false;
+    armInterruptSource(INT_SRC_TOF, false);
+}
+
+/** Stop ranging around light sleep (INT_OR wake is off) and resume after. */
+void FED4::pauseProxService(bool pause)
+{
+    if (!proxServiceActive) {
+        return;
+    }
+    if (pause) {
+        distanceSensor.stopRanging();
+        distanceSensor.clearInterrupt();
+    } else {
+        distanceSensor.startRanging();
+    }
+}
+
+/** Take the ToF range behind an asserted INT_SRC_TOF into the ring (any context that clears it). */
+void FED4::captureProxSample()
+{
+    const uint8_t status = distanceSensor.getRangeStatus();
+    const int raw = distanceSensor.getDistance();
+    distanceSensor.clearInterrupt();
+
+    FedProxSample sample;
+    sample.ms = millis();
+    sample.mm = (int16_t)proxCalibrate(raw);
+    sample.status = status;
+    if (status != 0) {
+        proxRangeErrors++; // sigma/signal/wrap-around failures: keep the stamp, flag it
+        proxErrorMs = sample.ms;
+    } else {
+        latestProx = sample;
+    }
+    FedProxSample oldest;
+    if (sProxSamples.size() == sProxSamples.capacity()) {
+        sProxSamples.pop(oldest);
+    }
+    sProxSamples.push(sample);
+    proxSampleCount++;
+}
+
+/** Collect a ready range if INT_OR is asserted; cheap to call every loop. Returns samples taken. */
+uint8_t FED4::serviceProx()
+{
+    if (!proxServiceActive || !interruptPending()) {
+        return 0;
+    }
+    // The dispatcher clears whichever sources assert; clearing TOF captures the sample
+    return (dispatchInterrupts() & INT_SRC_TOF) ? 1 : 0;
+}
+
+bool FED4::popProxSample(FedProxSample &out)
+{
+    return sProxSamples.pop(out);
+}
+
+uint32_t FED4::proxSamplesQueued() const
+{
+    return sProxSamples.size();
+}
@@ -47,8 +47,8 @@ bool FED4::initializeRTC()
             updateRTC();
             forceRTCUpdate = false;
         }
-        DateTime now = rtc.now();
-        Inrtc.setTime(now.unixtime());
+        syncClock(true);
+        DateTime now = this->now();
         Serial.printf("RTC time: %04u-%02u-%02u %02u:%02u:%02u\n",
                       now.year(), now.month(), now.day(),
                       now.hour(), now.minute(), now.second());
@@ -78,8 +78,8 @@ bool FED4::initializeRTC()
 
     preferences.end();
 
-    DateTime now = rtc.now();
-    Inrtc.setTime(now.unixtime());
+    syncClock(true); // anchor the internal clock on a DS3231 seconds tick
+    DateTime now = this->now();
     Serial.printf("RTC %s: %04u-%02u-%02u %02u:%02u:%02u\n",
                   setFromCompile ? "set" : "kept",
                   now.year(), now.month(), now.day(),
@@ -106,17 +106,102 @@ void FED4::updateRTC()
 
     // Update RTC with compilation time
     rtc.adjust(DateTime(year, month, day, hour, minute, second));
+    anchorClock(DateTime(year, month, day, hour, minute, second).unixtime());
 
     Serial.println("RTC time updated successfully");
 }
 
-// enables use of fed4.now() when fed4 is instantiated; use rtc.now() internally
+// enables use of fed4.now() when fed4 is instantiated; served from the internal clock (no I2C)
 DateTime FED4::now()
 {
-    return rtc.now();
+    return DateTime((uint32_t)(nowUnixUs() / 1000000));
 }
 
+/********************************************************
+ * Time service
+ *
+ * rtc.now() is an I2C transaction. The DS3231 is now read only by
+ * syncClock(): every rtcSyncPeriodS from updateTime(), and when it is set.
+ * Every timestamp in between (logData rows, display, status line, now())
+ * comes from FedTimeUs (esp_timer, FED4_Time.h — the clock behind millis()
+ * and the photogate stamps, which keeps running in light sleep) through the
+ * FedClockModel anchor and drift rate. The DS3231 only resolves whole
+ * seconds, so a sync corrects the internal clock only when it has left the
+ * RTC's current second, and then just to that second's edge; the rate is
+ * refit through the anchor at the same time (clockDriftPpm, + = internal
+ * runs fast).
+ ********************************************************/
+
+static const int64_t kClockMinBaselineUs = 3600LL * 1000000LL; // refit the rate only over ≥ 1 h
+
+/** Unix µs at FedTimeUs timerUs (the model in FED4_Time.h). */
+int64_t FED4::clockUnixUs(FedTimeUs timerUs) const
+{
+    return wallClock.toUnixUs(timerUs);
+}
+
+/** Unix time in µs from the internal clock; reads the DS3231 only if there is no anchor yet. */
+int64_t FED4::nowUnixUs()
+{
+    if (!wallClock.valid && (fedNowUs() < clockRetryUs || !syncClock())) {
+        return (int64_t)Inrtc.getEpoch() * 1000000LL;
+    }
+    return wallClock.toUnixUs(fedNowUs());
+}
+
+/** The DS3231 was just written with unixSeconds: its second starts now, so this is an exact anchor. */
+void FED4::anchorClock(uint32_t unixSeconds)
+{
+    clockLastSyncUs = fedNowUs();
+    wallClock.anchor(clockLastSyncUs, (int64_t)unixSeconds * 1000000LL);
+    Inrtc.setTime(unixSeconds);
+}
 
+/**
+ * Read the DS3231 and discipline the internal clock against it. With align,
+ * wait (≤ 1.1 s) for the next seconds tick and re-anchor on it exactly.
+ */
+bool FED4::syncClock(bool align)
+{
+    DateTime t = rtc.now();
+    FedTimeUs stampUs = fedNowUs();
+    if (!t.isValid() || t.year() < 2020) {
+        // No answer (or never set): keep running on the internal clock and
+        // don't retry the bus before the next regular sync
+        clockSyncFailures++;
+        clockRetryUs = stampUs + (int64_t)rtcSyncPeriodS * 1000000LL;
+        return false;
+    }
+    bool aligned = false;
+    if (align) {
+        const uint8_t second = t.second();
+        while (t.second() == second && fedNowUs() - stampUs < 1100000) {
+            delay(2);
+            t = rtc.now();
+        }
+        aligned = t.second() != second;
+        stampUs = fedNowUs();
+    }
+    clockSyncs++;
+    clockLastSyncUs = stampUs;
+    Inrtc.setTime(t.unixtime());
+
+    if (aligned) {
+        if (wallClock.valid) {
+            clockLastErrorMs = (int32_t)((wallClock.toUnixUs(stampUs) - (int64_t)t.unixtime() * 1000000LL) / 1000);
+        }
+        wallClock.anchor(stampUs, (int64_t)t.unixtime() * 1000000LL);
+        return true;
+    }
+    const int64_t errorUs = wallClock.discipline(stampUs, t.unixtime(), kClockMinBaselineUs);
+    clockLastErrorMs = (int32_t)(errorUs / 1000);
+    clockDriftPpm = (float)wallClock.driftPpm;
+    if (errorUs != 0) {
+        clockSteps++;
+        Serial.printf("Clock: %+ld ms off the DS3231, drift now %+.1f ppm\n", (long)clockLastErrorMs, clockDriftPpm);
+    }
+    return true;
+}
 
 /********************************************************
  * Compilation ID Management
@@ -146,6 +231,7 @@ void FED4::adjustRTC(uint32_t timestamp)
 {
     Serial.println("Adjusting RTC with Unix timestamp: " + String(timestamp));
     rtc.adjust(DateTime(timestamp));
+    anchorClock(timestamp);
     Serial.println("RTC time adjusted successfully");
 }
 
@@ -154,7 +240,11 @@ void FED4::adjustRTC(uint32_t timestamp)
  */
 
 void FED4::updateTime(){
-  DateTime current = rtc.now();
+  const FedTimeUs nowUs = fedNowUs();
+  if ((!wallClock.valid || nowUs - clockLastSyncUs >= (int64_t)rtcSyncPeriodS * 1000000LL) && nowUs >= clockRetryUs) {
+    syncClock();
+  }
+  DateTime current = now();
   currentHour = current.hour(); //useful for timed feeding sessions
   currentMinute = current.minute(); //useful for timed feeding sessions
   currentSecond = current.second(); //useful for timed feeding sessions
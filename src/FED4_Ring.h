@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Single-producer / single-consumer lock-free ring (ISR → loop, task → task).
+ * N must be a power of two. push() is ISR-safe; overflow drops the new item
+ * and counts it in dropped(). push()/pop() are forced inline so IRAM ISRs
+ * never call a flash copy (they run while the cache is off for flash writes).
+ */
+template <typename T, uint32_t N>
+class FedRing
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "FedRing size must be a power of two");
+
+public:
+    inline __attribute__((always_inline)) bool push(const T &item)
+    {
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N)
+        {
+            droppedCount = droppedCount + 1;
+            return false;
+        }
+        buf[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    inline __attribute__((always_inline)) bool pop(T &out)
+    {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+        out = buf[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool peek(T &out) const
+    {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+        out = buf[t & (N - 1)];
+        return true;
+    }
+
+    /** Consumer side only. */
+    void clear() { tail.store(head.load(std::memory_order_acquire), std::memory_order_release); }
+
+    uint32_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+    static constexpr uint32_t capacity() { return N; }
+    uint32_t dropped() const { return droppedCount; }
+
+private:
+    T buf[N];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+    volatile uint32_t droppedCount = 0;
+};
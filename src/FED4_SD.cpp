@@ -173,7 +173,13 @@ bool FED4::createMetaJson()
  */
 bool FED4::createLogFile()
 {
-    DateTime now = rtc.now();
+    // Warm restart: append to the checkpointed session's file
+    if (resumeSessionLog())
+    {
+        return true;
+    }
+
+    DateTime now = this->now();
     char idStr[5];
     int mouseIdValue = mouseId.toInt();  // Convert String to int
     if (mouseIdValue <= 0) {
@@ -351,7 +357,7 @@ bool FED4::createLogFile()
     // Write CSV headers
     dataFile.print("DateTime,ElapsedSeconds,ESP32_UID,MouseID,Sex,Strain,LibraryVer,Program,FR,");
     dataFile.print("Event,PelletCount,LeftCount,RightCount,CenterCount,BlockPelletCount,BlockPokeCount,RetrievalTime,PokeDuration,DispenseError,MotorTurns,Motion,");
-    dataFile.println("Temperature,Humidity,Pressure,GasResistance,Lux,White,FreeHeap,HeapSize,MinFreeHeap,WakeCount,BatteryVoltage,BatteryPercent");
+    dataFile.println("Temperature,Humidity,Pressure,GasResistance,Lux,White,FreeHeap,HeapSize,MinFreeHeap,WakeCount,BatteryVoltage,BatteryPercent,Detail");
     
     dataFile.flush();  // Force write to SD card
     
@@ -406,9 +412,10 @@ bool FED4::createLogFile()
 /**
  * Logs data to the SD card
  * @param newEvent the event to log
+ * @param detail optional key=value;key=value summary for the Detail column (commas become ';')
  * @return true if successful, false if failed
  */
-bool FED4::logData(const String &newEvent)
+bool FED4::logData(const String &newEvent, const String &detail)
 {
     // Check if SD card available flag is set
     if (!sdCardAvailable) {
@@ -421,6 +428,7 @@ bool FED4::logData(const String &newEvent)
         Serial.println("WARNING: Cannot log data - no log file created");
         return false;
     }
+    FedEnergySpan span(*this, FedPowerState::SdWrite);
     
     // Set new event if provided
     if (newEvent.length() > 0)
@@ -432,18 +440,23 @@ bool FED4::logData(const String &newEvent)
     SPI.setBitOrder(MSBFIRST);
     redPix(1); // dim status LED flash on each logData call
 
-    DateTime now = rtc.now();
-    float currentSeconds = round((millis() / 1000.000) * 1000) / 1000.0; // Get current seconds rounded to 3 decimals
+    // DateTime and ElapsedSeconds from one FedTimeUs stamp (internal clock, no RTC I2C read)
+    const FedTimeUs stampUs = fedNowUs();
+    const int64_t unixUs = wallClock.valid ? wallClock.toUnixUs(stampUs) : nowUnixUs();
+    DateTime now((uint32_t)(unixUs / 1000000));
+    const int nowMs = (int)((unixUs / 1000) % 1000);
+    char elapsedSeconds[24]; // exact ms at any uptime (a float is 0.5 s coarse after 97 days)
+    fedFormatSeconds(elapsedSeconds, sizeof(elapsedSeconds), stampUs);
 
     // Open file for writing
     digitalWrite(SD_CS, LOW); // Select SD card for operation
 
     //SD.open() with a timeout
-    unsigned long timeout = millis() + 500;
+    const unsigned long openStart = millis();
     do {
         dataFile = SD.open(filename, FILE_APPEND);
         if (!dataFile) delay(10);
-    } while (!dataFile && millis() < timeout);
+    } while (!dataFile && millis() - openStart < 500);
 
     // If the file is not found, try to reinitialize the SD card - this allows for hot swapping of the SD card
     if (!dataFile)
@@ -490,11 +503,11 @@ bool FED4::logData(const String &newEvent)
         }
 
         //SD.open() with a timeout
-        unsigned long timeout = millis() + 500;
+        const unsigned long openStart = millis();
         do {
             dataFile = SD.open(filename, FILE_APPEND);
             if (!dataFile) delay(10);
-        } while (!dataFile && millis() < timeout);
+        } while (!dataFile && millis() - openStart < 500);
 
         if (!dataFile) {
             Serial.println("Failed to open file even though it exists");
@@ -521,10 +534,10 @@ bool FED4::logData(const String &newEvent)
     }
 
     // Write timestamp
-    dataFile.printf("%04d-%02d-%02d %02d:%02d:%02d,%f,%llX,",
+    dataFile.printf("%04d-%02d-%02d %02d:%02d:%02d.%03d,%s,%llX,",
                     now.year(), now.month(), now.day(),
-                    now.hour(), now.minute(), now.second(),
-                    currentSeconds,
+                    now.hour(), now.minute(), now.second(), nowMs,
+                    elapsedSeconds,
                     ESP.getEfuseMac());
 
     // Write mouse ID and other info
@@ -583,7 +596,7 @@ bool FED4::logData(const String &newEvent)
         dataFile.print(",,,,"); // RetrievalTime, PokeDuration, DispenseError, MotorTurns
     }
 
-    // Cached members — refreshed by refreshSensors() in update(), not polled here.
+    // Latest-readings table (poll scheduler) — never polled here. PIR: last closed window.
     if (!useMotionSensor || isnan(motionPercentage)) {
         dataFile.print("Disabled,");
     } else {
@@ -591,15 +604,28 @@ bool FED4::logData(const String &newEvent)
     }
 
     dataFile.printf("%.1f,%.1f,%.1f,%.1f,%.3f,%.3f,",
-                    temperature, humidity, pressure, gasResistance, lux, white);
+                    readings.temperature.value, readings.humidity.value, readings.pressure.value,
+                    readings.gas.value, readings.lux.value, readings.white.value);
 
-    dataFile.printf("%d,%d,%d,%d,%.2f,%.2f\n",
+    dataFile.printf("%d,%d,%d,%d,%.2f,%.2f,",
                     ESP.getFreeHeap(),
                     ESP.getHeapSize(),
                     ESP.getMinFreeHeap(),
                     wakeCount,
-                    cellVoltage,
-                    cellPercent);
+                    readings.cellVoltage.value,
+                    readings.cellPercent.value);
+
+    // Detail is a single CSV field — keep it comma/newline free
+    String safeDetail = detail;
+    if (useMotionSensor && motionWindowMs > 0)
+    {
+        safeDetail += safeDetail.length() > 0 ? ";motion_ms=" : "motion_ms=";
+        safeDetail += String(motionWindowMs);
+    }
+    safeDetail.replace(",", ";");
+    safeDetail.replace("\n", " ");
+    dataFile.print(safeDetail);
+    dataFile.write('\n');
 
     // Clean up
     dataFile.flush();  // Force write to SD card
@@ -627,6 +653,7 @@ bool FED4::logData(const String &newEvent)
     // paint once via update()/updateDisplay(). Reclaim bus for a following MIP write.
     reclaimSpiForDisplay();
 
+    checkpointSession();
     return true;
 }
 
@@ -857,7 +884,7 @@ void FED4::handleSDCardError()
         {
             if (ledsOn)
             {
-                colorWipe("red", 0);
+                colorWipe(FED4_COLOR("red"), 0);
             }
             else
             {
@@ -0,0 +1,227 @@
+#include "FED4.h"
+
+// ── Sensor poll scheduler ────────────────────────────────────────────────────
+// Each FedSensor has its own sensorSchedule entry. beginSensorBatch() (right
+// after wakeUp(), or from update() when it was not called) collects what is
+// due; if any I2C sensor is due, the others within their jitterMs join it so
+// the bus work of one wake replaces several wakes' worth. The BME680 and the
+// VEML7700 are started at once (split phase, FED4_Vitals.cpp / FED4_Light.cpp)
+// and serviceSensors() reads the rest.
+// Every result goes through publishReading(): the table value only moves when
+// it changes by the sensor's threshold, and a quiet sensor backs off towards
+// maxPeriodMs. logData(), the display, serial and Hublink read readings.
+
+static const uint8_t kI2cSensors = (uint8_t)~(1u << (uint8_t)FedSensor::Motion);
+
+static inline uint8_t sensorBit(FedSensor sensor)
+{
+    return (uint8_t)(1u << (uint8_t)sensor);
+}
+
+template <typename T>
+bool FED4::publishReading(FedStamped<T> &reading, T value, float threshold, uint32_t ms)
+{
+    reading.sampledMs = ms;
+    if (reading.valid && fabsf((float)value - (float)reading.value) < threshold)
+        return false;
+    reading.value = value;
+    reading.changedMs = ms;
+    reading.valid = true;
+    return true;
+}
+
+bool FED4::sensorDue(FedSensor sensor, uint32_t slackMs) const
+{
+    const uint8_t i = (uint8_t)sensor;
+    const FedSensorSchedule &sched = sensorSchedule[i];
+    if (!sched.enabled || (sensor == FedSensor::Motion && !useMotionSensor))
+        return false;
+    if (!incrementalUpdate || !(sensorRan & sensorBit(sensor)))
+        return true;
+    return millis() - sensorLastMs[i] + slackMs >= sensorInterval[i];
+}
+
+/** Record a read: a change snaps the interval back to periodMs, a quiet one doubles it. */
+void FED4::sensorSampled(FedSensor sensor, bool changed)
+{
+    const uint8_t i = (uint8_t)sensor;
+    const FedSensorSchedule &sched = sensorSchedule[i];
+    sensorLastMs[i] = millis();
+    sensorReads[i]++;
+    if (changed)
+        sensorChanges[i]++;
+    if (changed || !(sensorRan & sensorBit(sensor)))
+        sensorInterval[i] = sched.periodMs;
+    else
+        sensorInterval[i] = min(max(sensorInterval[i] * 2, sched.periodMs), max(sched.maxPeriodMs, sched.periodMs));
+    sensorRan |= sensorBit(sensor);
+}
+
+void FED4::beginSensorBatch()
+{
+    uint8_t due = 0;
+    for (uint8_t i = 0; i < FED4_SENSORS; i++)
+    {
+        if (sensorDue((FedSensor)i, 0))
+            due |= (uint8_t)(1u << i);
+    }
+    if (due & kI2cSensors)
+    {
+        sensorBatches++;
+        for (uint8_t i = 0; i < FED4_SENSORS; i++)
+        {
+            const uint8_t bit = (uint8_t)(1u << i);
+            if ((kI2cSensors & bit) && !(due & bit) && sensorDue((FedSensor)i, sensorSchedule[i].jitterMs))
+            {
+                due |= bit;
+                sensorPulledForward++;
+            }
+        }
+    }
+    sensorBatch = due;
+    sensorBatchPlanned = true;
+
+    // One BME680 measurement serves both channels; the heater only runs for Gas
+    const uint8_t bmeBits = sensorBit(FedSensor::Tph) | sensorBit(FedSensor::Gas);
+    if ((sensorBatch & bmeBits) && !bmePending)
+    {
+        startEnvironmentReading((sensorBatch & sensorBit(FedSensor::Gas)) != 0);
+        sensorBatch &= (uint8_t)~bmeBits;
+    }
+    // The VEML7700 integrates on its own too (FED4_Light.cpp)
+    if ((sensorBatch & sensorBit(FedSensor::Light)) && startLightReading())
+        sensorBatch &= (uint8_t)~sensorBit(FedSensor::Light);
+}
+
+/** Read this wake's batch (the BME680 result is picked up here or after the display). */
+void FED4::serviceSensors()
+{
+    if (!sensorBatchPlanned)
+        beginSensorBatch();
+    collectEnvironmentReading();
+    collectLightReading();
+
+    if (sensorBatch & sensorBit(FedSensor::Battery))
+    {
+        refreshBattery();
+    }
+    if (sensorBatch & sensorBit(FedSensor::Motion))
+    {
+        sampleMotion();
+    }
+    if (sensorBatch & sensorBit(FedSensor::Prox))
+    {
+        sampleProx();
+    }
+    if (sensorBatch & sensorBit(FedSensor::Accel))
+    {
+        sampleAccel();
+    }
+    sensorBatch = 0;
+}
+
+/** PIR level into readings.motion (the activity fraction is timed from edges, FED4_Motion.cpp). */
+void FED4::sampleMotion()
+{
+    const bool level = digitalRead(PIR_MOTION) == HIGH;
+    updateStatusLedFromMotion();
+    motionDetected = level;
+    sensorSampled(FedSensor::Motion, publishReading(readings.motion, level,
+                                                    sensorSchedule[(uint8_t)FedSensor::Motion].threshold, millis()));
+}
+
+void FED4::sampleProx()
+{
+    const int mm = prox();
+    if (mm < 0)
+        return; // retried on the next batch
+    sensorSampled(FedSensor::Prox, publishReading(readings.proxMm, (int16_t)mm,
+                                                  sensorSchedule[(uint8_t)FedSensor::Prox].threshold, millis()));
+}
+
+void FED4::sampleAccel()
+{
+    if (accelFifoActive)
+    {
+        // Reading OUT_* would pop FIFO samples: publish the last window's gravity vector
+        if (!accelHaveGravity)
+            return;
+        const float threshold = sensorSchedule[(uint8_t)FedSensor::Accel].threshold;
+        const uint32_t ms = millis();
+        bool changed = publishReading(readings.accelX, accelGravity[0] * FED4_GRAVITY_MS2, threshold, ms);
+        changed |= publishReading(readings.accelY, accelGravity[1] * FED4_GRAVITY_MS2, threshold, ms);
+        changed |= publishReading(readings.accelZ, accelGravity[2] * FED4_GRAVITY_MS2, threshold, ms);
+        sensorSampled(FedSensor::Accel, changed);
+        return;
+    }
+    sensors_event_t event;
+    if (!accel.getEvent(&event))
+        return;
+    const float threshold = sensorSchedule[(uint8_t)FedSensor::Accel].threshold;
+    const uint32_t ms = millis();
+    bool changed = publishReading(readings.accelX, -event.acceleration.y, threshold, ms);
+    changed |= publishReading(readings.accelY, event.acceleration.x, threshold, ms);
+    changed |= publishReading(readings.accelZ, event.acceleration.z, threshold, ms);
+    sensorSampled(FedSensor::Accel, changed);
+}
+
+// ── store functions: table + legacy mirrors ─────────────────────────────────
+
+/** Plausible BME680 values into readings (gas < 0 = no heater this time); true if any moved. */
+bool FED4::storeEnvironment(float temp, float hum, float pres, float gas, uint32_t ms)
+{
+    const float tph = sensorSchedule[(uint8_t)FedSensor::Tph].threshold;
+    bool changed = false;
+    if (hum > 1)
+        changed |= publishReading(readings.humidity, hum, tph, ms);
+    if (pres > 0)
+        changed |= publishReading(readings.pressure, pres, tph, ms);
+    if (gas > 0)
+    {
+        sensorSampled(FedSensor::Gas, publishReading(readings.gas, gas,
+                                                     sensorSchedule[(uint8_t)FedSensor::Gas].threshold, ms));
+    }
+    const bool valid = temp > 1;
+    if (valid)
+    {
+        changed |= publishReading(readings.temperature, temp, tph, ms);
+        sensorSampled(FedSensor::Tph, changed);
+    }
+    temperature = readings.temperature.value;
+    humidity = readings.humidity.value;
+    pressure = readings.pressure.value;
+    gasResistance = readings.gas.value;
+    return valid;
+}
+
+bool FED4::storeBattery(float voltage, float percent)
+{
+    if (voltage <= 0)
+        return false;
+    const float threshold = sensorSchedule[(uint8_t)FedSensor::Battery].threshold;
+    const uint32_t ms = millis();
+    bool changed = publishReading(readings.cellVoltage, voltage, threshold, ms);
+    changed |= publishReading(readings.cellPercent, percent, threshold, ms);
+    sensorSampled(FedSensor::Battery, changed);
+    cellVoltage = readings.cellVoltage.value;
+    cellPercent = readings.cellPercent.value;
+    return true;
+}
+
+/** Either value may be < 0 (read failed); the other is still published. */
+bool FED4::storeLight(float luxValue, float whiteValue)
+{
+    if (luxValue < 0 && whiteValue < 0)
+        return false;
+    const float threshold = sensorSchedule[(uint8_t)FedSensor::Light].threshold;
+    const uint32_t ms = millis();
+    bool changed = false;
+    if (luxValue >= 0)
+        changed |= publishReading(readings.lux, luxValue, threshold, ms);
+    if (whiteValue >= 0)
+        changed |= publishReading(readings.white, whiteValue, threshold, ms);
+    sensorSampled(FedSensor::Light, changed);
+    lux = readings.lux.value;
+    white = readings.white.value;
+    return true;
+}
@@ -2,26 +2,30 @@
 
 void FED4::serialStatusReport()
 {
+    const uint32_t envAgeMs = environmentAgeMs();
+    const long envAgeS = envAgeMs == UINT32_MAX ? -1 : (long)(envAgeMs / 1000);
+    const DateTime t = now(); // internal clock — one read, no I2C
+
     if (wakeCount == 0) {
         Serial.println("********** Ready to go! **********");
     }
     
     // Check if motion sensor is disabled
     if (!useMotionSensor || isnan(motionPercentage)) {
-        Serial.printf("%02d/%02d/%02d %02d:%02d:%02d | %.1fC - %.1f%% - %.1fhPa - %.1fKΩ | %.1fLux | %.2fV(%.1f%%) | No Motion | Pel %d | Left/Cent/Right %d/%d/%d | Poke %.0fms | Mem %d | Wake %d\n",        
-            rtc.now().month(), rtc.now().day(), rtc.now().year(), rtc.now().hour(), rtc.now().minute(), rtc.now().second(),
-            temperature, humidity, pressure, gasResistance, lux, 
-            cellVoltage, cellPercent,
+        Serial.printf("%02d/%02d/%02d %02d:%02d:%02d | %.1fC - %.1f%% - %.1fhPa - %.1fKΩ (%lds old) | %.1fLux | %.2fV(%.1f%%) | No Motion | Pel %d | Left/Cent/Right %d/%d/%d | Poke %.0fms | Mem %d | Wake %d\n",        
+            t.month(), t.day(), t.year(), t.hour(), t.minute(), t.second(),
+            readings.temperature.value, readings.humidity.value, readings.pressure.value, readings.gas.value, envAgeS, readings.lux.value, 
+            readings.cellVoltage.value, readings.cellPercent.value,
             pelletCount,    
             leftCount, centerCount, rightCount,
             pokeDuration,
             ESP.getFreeHeap(),
             wakeCount);
     } else {
-        Serial.printf("%02d/%02d/%02d %02d:%02d:%02d | %.1fC - %.1f%% - %.1fhPa - %.1fKΩ | %.1fLux | %.2fV(%.1f%%) | Motion %d(%.1f%%) | Pel %d | Left/Cent/Right %d/%d/%d | Poke %.0fms | Mem %d | Wake %d\n",        
-            rtc.now().month(), rtc.now().day(), rtc.now().year(), rtc.now().hour(), rtc.now().minute(), rtc.now().second(),
-            temperature, humidity, pressure, gasResistance, lux, 
-            cellVoltage, cellPercent,
+        Serial.printf("%02d/%02d/%02d %02d:%02d:%02d | %.1fC - %.1f%% - %.1fhPa - %.1fKΩ (%lds old) | %.1fLux | %.2fV(%.1f%%) | Motion %d(%.1f%%) | Pel %d | Left/Cent/Right %d/%d/%d | Poke %.0fms | Mem %d | Wake %d\n",        
+            t.month(), t.day(), t.year(), t.hour(), t.minute(), t.second(),
+            readings.temperature.value, readings.humidity.value, readings.pressure.value, readings.gas.value, envAgeS, readings.lux.value, 
+            readings.cellVoltage.value, readings.cellPercent.value,
             motionDetected, motionPercentage,
             pelletCount,    
             leftCount, centerCount, rightCount,
@@ -0,0 +1,286 @@
+#include "FED4.h"
+
+#include "esp_rom_crc.h"
+#include "FED4_TouchHelpers.h"
+
+// ── Warm-restart session checkpoint ──────────────────────────────────────────
+// A reset (brownout, watchdog, panic, Button 2) used to start a new log file
+// with every counter at zero, and the run had to be stitched back together by
+// hand; begin() also spent a full touch calibration on it. checkpointSession()
+// snapshots the session after every logged row into RTC slow memory (survives
+// every reset except a power cycle, costs nothing) and, rate-limited to one
+// write per sessionNvsPeriodS and only when the content moved, into NVS. At
+// boot loadSession() takes the newer valid copy (CRC, version, size, age);
+// begin() then reuses the touch baselines, and createLogFile() reopens the
+// same log file with the counters restored and logs a "Resume" row.
+// The NVS copy can be up to sessionNvsPeriodS behind when RTC memory was lost.
+
+static const uint32_t kSessionMagic = 0xFED45E55;
+static const uint16_t kSessionVersion = 1;
+static const char *kSessionKey = "session";
+
+// Not zeroed at boot: whatever the last run left here, validated by CRC
+static RTC_NOINIT_ATTR FedSessionState sRtcSession;
+
+static uint32_t sessionCrc(const FedSessionState &s)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *)&s, offsetof(FedSessionState, crc));
+}
+
+/** CRC of the session content only (not generation/time), to skip NVS writes that change nothing. */
+static uint32_t sessionContentCrc(const FedSessionState &s)
+{
+    const size_t from = offsetof(FedSessionState, pelletCount);
+    return esp_rom_crc32_le(0, (const uint8_t *)&s + from, offsetof(FedSessionState, crc) - from);
+}
+
+static bool sessionValid(const FedSessionState &s)
+{
+    return s.magic == kSessionMagic && s.version == kSessionVersion &&
+           s.size == sizeof(FedSessionState) && s.crc == sessionCrc(s);
+}
+
+static void copyField(char *out, size_t size, const char *in)
+{
+    strncpy(out, in, size - 1);
+    out[size - 1] = '\0';
+}
+
+static const char *resetReasonName(esp_reset_reason_t reason)
+{
+    switch (reason)
+    {
+    case ESP_RST_POWERON:
+        return "poweron";
+    case ESP_RST_EXT:
+        return "ext";
+    case ESP_RST_SW:
+        return "sw";
+    case ESP_RST_PANIC:
+        return "panic";
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+        return "wdt";
+    case ESP_RST_BROWNOUT:
+        return "brownout";
+    case ESP_RST_DEEPSLEEP:
+        return "deepsleep";
+    default:
+        return "unknown";
+    }
+}
+
+// ── checkpoint ───────────────────────────────────────────────────────────────
+
+void FED4::checkpointSession(bool forceNvs)
+{
+    if (!sessionResume || filename[0] == '\0')
+        return;
+
+    FedSessionState s;
+    memset(&s, 0, sizeof(s)); // reserved fields are inside the CRC
+    s.magic = kSessionMagic;
+    s.version = kSessionVersion;
+    s.size = sizeof(FedSessionState);
+    s.generation = ++sessionGeneration;
+    s.savedUnix = (uint32_t)(nowUnixUs() / 1000000);
+    s.pelletCount = pelletCount;
+    s.centerCount = centerCount;
+    s.leftCount = leftCount;
+    s.rightCount = rightCount;
+    s.blockPokeCount = blockPokeCount;
+    s.blockPelletCount = blockPelletCount;
+    s.FR = FR;
+    s.sequenceIndex = currentSequenceIndex;
+    s.sequenceLevel = currentSequenceLevel;
+    s.pendingRetrieval = pendingRetrieval ? 1 : 0;
+    s.pelletWellUnixUs = pendingRetrieval ? clockUnixUs(pelletWellUs) : 0;
+    s.touchIdle[0] = fed4TouchIdleL;
+    s.touchIdle[1] = fed4TouchIdleC;
+    s.touchIdle[2] = fed4TouchIdleR;
+    copyField(s.filename, sizeof(s.filename), filename);
+    copyField(s.program, sizeof(s.program), program.c_str());
+    copyField(s.mouseId, sizeof(s.mouseId), mouseId.c_str());
+    s.crc = sessionCrc(s);
+
+    memcpy(&sRtcSession, &s, sizeof(s)); // bytewise, so the copy keeps its CRC
+    sessionCheckpoints++;
+
+    const uint32_t content = sessionContentCrc(s);
+    if (content != sessionNvsCrc)
+        sessionNvsDirty = true;
+    flushSessionNvs(forceNvs);
+}
+
+/** Copy the RTC checkpoint to NVS when it moved and the rate limit allows (force: now). */
+void FED4::flushSessionNvs(bool force)
+{
+    if (!sessionNvsDirty && !force)
+        return;
+    if (!force && sessionNvsWrites > 0 && millis() - sessionNvsMs < sessionNvsPeriodS * 1000UL)
+        return;
+    if (!sessionValid(sRtcSession))
+        return;
+    if (!preferences.begin(PREFS_NAMESPACE, false))
+        return;
+    const bool ok = preferences.putBytes(kSessionKey, &sRtcSession, sizeof(FedSessionState)) == sizeof(FedSessionState);
+    preferences.end();
+    if (!ok)
+        return;
+    sessionNvsWrites++;
+    sessionNvsMs = millis();
+    sessionNvsCrc = sessionContentCrc(sRtcSession);
+    sessionNvsDirty = false;
+}
+
+void FED4::clearSession()
+{
+    memset(&sRtcSession, 0, sizeof(sRtcSession));
+    sessionLoaded = false;
+    sessionNvsDirty = false;
+    if (preferences.begin(PREFS_NAMESPACE, false))
+    {
+        if (preferences.isKey(kSessionKey))
+            preferences.remove(kSessionKey);
+        preferences.end();
+    }
+}
+
+// ── boot ─────────────────────────────────────────────────────────────────────
+
+/** Pick the newer valid checkpoint; after initializeRTC() so its age can be checked. */
+bool FED4::loadSession()
+{
+    sessionLoaded = false;
+    FedSessionState nvs;
+    memset(&nvs, 0, sizeof(nvs));
+    bool nvsOk = false;
+    if (preferences.begin(PREFS_NAMESPACE, true))
+    {
+        nvsOk = preferences.getBytesLength(kSessionKey) == sizeof(FedSessionState) &&
+                preferences.getBytes(kSessionKey, &nvs, sizeof(nvs)) == sizeof(nvs) && sessionValid(nvs);
+        preferences.end();
+    }
+    const bool rtcOk = sessionValid(sRtcSession);
+    const bool useRtc = rtcOk && (!nvsOk || sRtcSession.generation >= nvs.generation);
+    if (!rtcOk && !nvsOk)
+        return false;
+    const FedSessionState &s = useRtc ? sRtcSession : nvs;
+    sessionGeneration = s.generation; // keep counting up either way
+    if (nvsOk)
+        sessionNvsCrc = sessionContentCrc(nvs);
+
+    const esp_reset_reason_t reason = esp_reset_reason();
+    if (!sessionResume || (reason == ESP_RST_POWERON && !sessionResumeOnPowerOn))
+        return false;
+
+    const uint32_t nowS = (uint32_t)(nowUnixUs() / 1000000);
+    if (nowS < s.savedUnix || (sessionResumeMaxS > 0 && nowS - s.savedUnix > sessionResumeMaxS))
+    {
+        Serial.print("Session: checkpoint too old to resume (");
+        Serial.print((long)nowS - (long)s.savedUnix);
+        Serial.println(" s)");
+        return false;
+    }
+
+    memcpy(&sessionState, &s, sizeof(s));
+    sessionSource = useRtc ? "rtc" : "nvs";
+    sessionGapS = nowS - s.savedUnix;
+    sessionLoaded = true;
+    Serial.print("Session: checkpoint gen ");
+    Serial.print(s.generation);
+    Serial.print(" from ");
+    Serial.print(sessionSource);
+    Serial.print(", reset ");
+    Serial.print(resetReasonName(reason));
+    Serial.print(", ");
+    Serial.print(sessionGapS);
+    Serial.println(" s ago");
+    return true;
+}
+
+/**
+ * Touch pads on the checkpoint's baselines instead of a fresh calibration.
+ * Runs before resumeSessionLog() has checked program, subject and file: the
+ * baselines describe the hardware, not the session, so they are reused for any
+ * recent checkpoint even when the log then starts a new file.
+ */
+bool FED4::restoreSessionTouch()
+{
+    if (!sessionLoaded)
+        return false;
+    if (!fed4TouchInitPadsWithIdle(sessionState.touchIdle[0], sessionState.touchIdle[1], sessionState.touchIdle[2]))
+    {
+        Serial.println("Session: touch baselines moved, recalibrating");
+        return false;
+    }
+    fed4TouchEnableTouchpadWakeup();
+    return true;
+}
+
+/**
+ * From createLogFile(): reopen the checkpoint's log file and restore the
+ * counters if it is the same program and animal and the file is still there.
+ */
+bool FED4::resumeSessionLog()
+{
+    if (!sessionLoaded)
+        return false;
+    sessionLoaded = false;
+    const FedSessionState &s = sessionState;
+
+    const String currentProgram = program.length() > 0 ? program : getMetaValue("fed", "program");
+    const String currentMouse = mouseId.length() > 0 ? mouseId : getMetaValue("subject", "id");
+    if (strncmp(s.program, currentProgram.c_str(), sizeof(s.program) - 1) != 0 ||
+        strncmp(s.mouseId, currentMouse.c_str(), sizeof(s.mouseId) - 1) != 0)
+    {
+        Serial.println("Session: program or subject changed, starting a new log file");
+        return false;
+    }
+
+    SPI.setBitOrder(MSBFIRST);
+    digitalWrite(SD_CS, LOW);
+    const bool exists = SD.exists(s.filename);
+    digitalWrite(SD_CS, HIGH);
+    if (!exists)
+    {
+        Serial.println("Session: log file missing, starting a new one");
+        return false;
+    }
+
+    copyField(filename, sizeof(filename), s.filename);
+    pelletCount = s.pelletCount;
+    centerCount = s.centerCount;
+    leftCount = s.leftCount;
+    rightCount = s.rightCount;
+    blockPokeCount = s.blockPokeCount;
+    blockPelletCount = s.blockPelletCount;
+    FR = s.FR;
+    currentSequenceIndex = s.sequenceIndex;
+    currentSequenceLevel = s.sequenceLevel;
+    pendingRetrieval = s.pendingRetrieval != 0;
+    if (pendingRetrieval)
+    {
+        // Same wall-clock instant on this boot's timebase (negative: before boot)
+        pelletWellUs = fedNowUs() - (nowUnixUs() - s.pelletWellUnixUs);
+        pelletTakenUs = pelletWellUs;
+        pelletPresent = true;
+    }
+    resumedSession = true;
+
+    Serial.print("Session: resuming ");
+    Serial.println(filename);
+    displayInitStatus("Resumed");
+    return true;
+}
+
+/** Detail for the "Resume" row logged by begin(). */
+String FED4::sessionResumeDetail()
+{
+    char detail[96];
+    snprintf(detail, sizeof(detail), "gen=%lu;from=%s;reset=%s;gap_s=%lu",
+             (unsigned long)sessionState.generation, sessionSource,
+             resetReasonName(esp_reset_reason()), (unsigned long)sessionGapS);
+    return String(detail);
+}
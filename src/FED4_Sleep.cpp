@@ -9,6 +9,7 @@ void FED4::sleep(int seconds)
   noPix();
   startSleep();
   wakeUp();
+  finishWakeTrace(); // close this wake's trace window (waitUntil() closes its own)
 }
 
 // For backward compatibility, keep the parameterless version
@@ -46,8 +47,16 @@ void FED4::startSleep()
     refresh(); // GPIO VCOM invert for this frame
   }
 
+  // Step timer does not run in light sleep — finish queued moves, coils off
+  const bool motorDone = waitMotorIdle(5000);
+  stopMotor();
+  finishStaging(motorDone); // a staging move may have dropped a pellet
+
   noPix();
-  enableAmp(false); // EXP_AMP_SD LOW; PSV2 stays on
+  waitStimuli(5000);   // scheduled onsets need the timers — finish them awake
+  waitAudioIdle(2000); // let a queued cue finish before the amp drops
+  stopAnimation();     // no loop ticks in light sleep — last frame stays (or lightsOff below)
+  enableAmp(false);    // EXP_AMP_SD LOW; PSV2 stays on
 
   if (sleepyLEDs)
   {
@@ -61,9 +70,13 @@ void FED4::startSleep()
   if (sleepSeconds <= 0)
   {
     lastWakeSource = FedWakeSource::Timer;
+    // No sleep: this is the wake, so the trace window does not reach back to an older Wake stamp
+    fed4Trace(FedTracePoint::Wake, (uint32_t)(fedNowUs() / 1000));
     return;
   }
 
+  pauseProxService(true); // ranging would only latch INT_OR while nothing listens
+
   if (interruptPending())
   {
     printInterruptStatus("pre-sleep");
@@ -71,6 +84,7 @@ void FED4::startSleep()
 
   // INT_OR must not wake us (held-low spam). Buttons may wake via GPIO.
   esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  gpio_intr_disable((gpio_num_t)INT_OR); // FALLING ISR comes back in wakeUp()
   gpio_wakeup_disable((gpio_num_t)INT_OR);
   gpio_wakeup_disable((gpio_num_t)PHOTOGATE_1);
   gpio_wakeup_enable((gpio_num_t)BUTTON_1, GPIO_INTR_HIGH_LEVEL);
@@ -85,7 +99,41 @@ void FED4::startSleep()
   esp_sleep_enable_timer_wakeup((uint64_t)sleepSeconds * 1000000ULL);
 
   Serial.flush();
-  esp_light_sleep_start();
+
+  // Lane and PIR edges and accel FIFO drains are handled and slept through until the original deadline
+  const int64_t sleepStartUs = esp_timer_get_time();
+  const int64_t sleepDeadlineUs = sleepStartUs + (int64_t)sleepSeconds * 1000000LL;
+  fed4Trace(FedTracePoint::SleepEnter);
+  for (;;)
+  {
+    if (laneWakeInSleep)
+    {
+      armLaneWake();
+    }
+    armPirWake();
+    armAccelWake();
+    esp_light_sleep_start();
+    const bool laneWake = laneWakeInSleep && serviceLaneWake();
+    const bool pirWake = servicePirWake();
+    if (!laneWake && !pirWake && !serviceAccelWake())
+    {
+      break;
+    }
+    const int64_t remainingUs = sleepDeadlineUs - esp_timer_get_time();
+    if (remainingUs <= 0)
+    {
+      break;
+    }
+    esp_sleep_enable_timer_wakeup((uint64_t)remainingUs);
+  }
+  if (laneWakeInSleep)
+  {
+    disarmLaneWake();
+  }
+  disarmPirWake();
+  const int64_t wokeUs = esp_timer_get_time();
+  fed4Trace(FedTracePoint::Wake, (uint32_t)(wokeUs / 1000));
+  energyAdd(psv2On ? FedPowerState::SleepPsv2On : FedPowerState::SleepPsv2Off, wokeUs - sleepStartUs);
 
   const esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
   const bool buttonHigh = digitalRead(BUTTON_1) == HIGH ||
@@ -126,7 +174,13 @@ FedEvent FED4::waitUntil(uint32_t updateIntervalSeconds)
   startSleep();
   wakeUp();
 
+  servicePhotogates();
   checkLateRetrieval();
+  fed4Trace(FedTracePoint::LateRetrieval);
+
+  // Plan the sensor batch; the BME680 measures while the poke is logged and the screen redrawn
+  beginSensorBatch();
+  fed4Trace(FedTracePoint::SensorBatch);
 
   sleepSeconds = savedSeconds;
 
@@ -168,30 +222,44 @@ FedEvent FED4::waitUntil(uint32_t updateIntervalSeconds)
     }
   }
 
-#if !FED4_DIAG_SKIP_SD_LOG
   if (event.source == FedWakeSource::Touch)
   {
-    if (event.pad == FedPad::Left)
-    {
-      logData("Left");
-    }
-    else if (event.pad == FedPad::Center)
+    event.contact = lastContact;
+
+    // Lick bouts: one summary row; a poke/hold that ends the bout is reported below
+    bool logContact = true;
+    if (lickBoutLogging && lastContact == FedContact::Lick)
     {
-      logData("Center");
+      logContact = !captureLickBout();
+      event.pad = static_cast<FedPad>(wakePad);
+      event.contact = lastContact;
     }
-    else if (event.pad == FedPad::Right)
+
+#if !FED4_DIAG_SKIP_SD_LOG
+    if (logContact)
     {
-      logData("Right");
+      if (event.pad == FedPad::Left)
+      {
+        logData("Left", contactDetail());
+      }
+      else if (event.pad == FedPad::Center)
+      {
+        logData("Center", contactDetail());
+      }
+      else if (event.pad == FedPad::Right)
+      {
+        logData("Right", contactDetail());
+      }
     }
-  }
 #else
-  if (event.source == FedWakeSource::Touch)
-  {
+    (void)logContact;
     Serial.println("DIAG: skip poke logData (FED4_DIAG_SKIP_SD_LOG)");
-  }
 #endif
+  }
+  fed4Trace(FedTracePoint::PokeLogged);
 
   update();
+  finishWakeTrace();
 
   return event;
 }
@@ -210,30 +278,41 @@ void FED4::wakeUp()
 
   // Hand VCOM back to GPIO before any refresh()
   releaseVcomLedcToGpio();
+  fed4Trace(FedTracePoint::WakeVcom);
 
   // Rails: PSV2 was left on; re-assert enables. No SPI.end / remount for rail cycle.
   PSV2_ON();
   PSV3_ON();
   delay(1);
+  fed4Trace(FedTracePoint::WakeRails);
 
   pinMode(PHOTOGATE_1, INPUT_PULLUP);
   pinMode(PHOTOGATE_2, INPUT_PULLUP);
   pinMode(PHOTOGATE_3, INPUT_PULLUP);
   pinMode(PHOTOGATE_4, INPUT_PULLUP);
+  armPhotogates();
+  armPir();
+  armInterruptLine();
+  fed4Trace(FedTracePoint::WakePhotogates);
 
   pinMode(SD_CS, OUTPUT);
   digitalWrite(SD_CS, HIGH);
   pinMode(DISPLAY_CS, OUTPUT);
   digitalWrite(DISPLAY_CS, LOW);
   reclaimSpiForDisplay();
+  fed4Trace(FedTracePoint::WakeSpi);
 
   i2cReinitBus();
   delay(1);
+  pauseProxService(false);
+  fed4Trace(FedTracePoint::WakeI2c);
 
   mcp.pinMode(EXP_HAPTIC, OUTPUT);
   mcp.digitalWrite(EXP_HAPTIC, LOW);
+  fed4Trace(FedTracePoint::WakeExpander);
 
   enableAmp(true);
+  fed4Trace(FedTracePoint::WakeAmp);
 
   if (wakeCause == ESP_SLEEP_WAKEUP_GPIO && interruptPending())
   {
@@ -244,6 +323,7 @@ void FED4::wakeUp()
   {
     lastInterruptMask = INT_SRC_NONE;
   }
+  fed4Trace(FedTracePoint::WakeInterrupts);
 
   if (wakeCause == ESP_SLEEP_WAKEUP_TOUCHPAD ||
       lastWakeSource == FedWakeSource::Touch ||
@@ -251,6 +331,7 @@ void FED4::wakeUp()
   {
     capturePoke();
   }
+  fed4Trace(FedTracePoint::WakePoke);
 
   if (lastWakeSource == FedWakeSource::Button ||
       (wakeCause == ESP_SLEEP_WAKEUP_GPIO && !interruptPending()))
@@ -259,6 +340,8 @@ void FED4::wakeUp()
     checkButton2();
     checkButton3();
   }
+  fed4Trace(FedTracePoint::WakeButtons);
 
   noPix();
+  fed4Trace(FedTracePoint::WakeDone);
 }
@@ -0,0 +1,209 @@
+#include "FED4.h"
+#include "FED4_Ring.h"
+
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
+
+// ── Timer-driven stepper engine ──────────────────────────────────────────────
+// A hardware timer fires once per step period (MOTOR_STEP_US, same rate as
+// Stepper at MOTOR_SPEED). Each tick the ISR either takes one full step of the
+// current segment, counts down a hold (coils released), or loads the next
+// segment from a lock-free queue (loop = producer, ISR = consumer).
+// Segments flagged FED4_SEG_STOP_ON_PELLET stop within one tick of PG1 going
+// LOW. Coil order/sequence matches Arduino Stepper 4-wire with the board's
+// IN1,IN3,IN2,IN4 wiring (38,46,45,47).
+
+static DRAM_ATTR const uint8_t kCoilPins[4] = {MOTOR_PIN_1, MOTOR_PIN_3, MOTOR_PIN_2, MOTOR_PIN_4};
+static DRAM_ATTR const uint8_t kCoilPhase[4] = {0b1010, 0b0110, 0b0101, 0b1001};
+
+static FedRing<FedStepSegment, 32> sSegments;
+static hw_timer_t *sMotorTimer = nullptr;
+static volatile bool sTimerRunning = false;
+
+// ISR-owned state (read by loop via the accessors below)
+static volatile int32_t sStepsLeft = 0; // signed: sign = direction
+static volatile uint32_t sHoldTicks = 0;
+static volatile uint8_t sFlags = 0;
+static volatile uint8_t sPhase = 0;
+static volatile bool sActive = false; // segment loaded or holding
+static volatile bool sCoilsOn = false;
+static volatile bool sPelletStop = false;
+static volatile uint32_t sCountedSteps = 0;
+static volatile uint32_t sCoilTicks = 0; // ticks that energized a step (energy accounting)
+
+static inline void IRAM_ATTR fed4WriteCoils(uint8_t bits)
+{
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        gpio_ll_set_level(&GPIO, kCoilPins[i], (bits >> (3 - i)) & 1);
+    }
+    sCoilsOn = bits != 0;
+}
+
+static void IRAM_ATTR fed4MotorIsr()
+{
+    if ((sFlags & FED4_SEG_STOP_ON_PELLET) && sActive &&
+        gpio_ll_get_level(&GPIO, PHOTOGATE_1) == 0)
+    {
+        // Pellet in well: drop everything queued and release
+        FedStepSegment discard;
+        while (sSegments.pop(discard))
+        {
+        }
+        sStepsLeft = 0;
+        sHoldTicks = 0;
+        sActive = false;
+        sPelletStop = true;
+        fed4WriteCoils(0);
+        return;
+    }
+
+    if (sStepsLeft != 0)
+    {
+        const bool forward = sStepsLeft > 0;
+        sPhase = (uint8_t)((sPhase + (forward ? 1 : 3)) & 3);
+        fed4WriteCoils(kCoilPhase[sPhase]);
+        sCoilTicks = sCoilTicks + 1;
+        sStepsLeft = forward ? sStepsLeft - 1 : sStepsLeft + 1;
+        if (sFlags & FED4_SEG_COUNT_STEPS)
+            sCountedSteps = sCountedSteps + 1;
+        return;
+    }
+
+    if (sHoldTicks)
+    {
+        if (sCoilsOn)
+            fed4WriteCoils(0);
+        sHoldTicks = sHoldTicks - 1;
+        return;
+    }
+
+    FedStepSegment seg;
+    if (sSegments.pop(seg))
+    {
+        sStepsLeft = seg.steps;
+        sHoldTicks = seg.holdTicks;
+        sFlags = seg.flags;
+        sActive = true;
+        return;
+    }
+
+    if (sCoilsOn)
+        fed4WriteCoils(0);
+    sActive = false;
+}
+
+// ── loop-side API ────────────────────────────────────────────────────────────
+
+bool FED4::initializeMotor()
+{
+    pinMode(MOTOR_PIN_1, OUTPUT);
+    pinMode(MOTOR_PIN_2, OUTPUT);
+    pinMode(MOTOR_PIN_3, OUTPUT);
+    pinMode(MOTOR_PIN_4, OUTPUT);
+    releaseMotor();
+
+    if (sMotorTimer == nullptr)
+    {
+        sMotorTimer = timerBegin(1000000); // 1 MHz → alarm in µs
+        if (sMotorTimer == nullptr)
+            return false;
+        timerAttachInterrupt(sMotorTimer, fed4MotorIsr);
+        timerAlarm(sMotorTimer, MOTOR_STEP_US, true, 0);
+        timerStop(sMotorTimer);
+        sTimerRunning = false;
+    }
+    return true;
+}
+
+/**
+ * Queue a move: steps (negative = dispense direction) then holdMs with coils
+ * released. Returns false when the queue is full.
+ */
+bool FED4::queueMotorSteps(int16_t steps, uint32_t holdMs, uint8_t flags)
+{
+    if (sMotorTimer == nullptr)
+        return false;
+
+    FedStepSegment seg;
+    seg.steps = steps;
+    seg.holdTicks = (uint16_t)min<uint32_t>((holdMs * 1000UL + MOTOR_STEP_US - 1) / MOTOR_STEP_US, 0xFFFF);
+    seg.flags = flags;
+    if (!sSegments.push(seg))
+        return false;
+
+    if (!sTimerRunning)
+    {
+        sPelletStop = false;
+        timerWrite(sMotorTimer, 0);
+        timerStart(sMotorTimer);
+        sTimerRunning = true;
+    }
+    return true;
+}
+
+uint32_t FED4::motorQueueSpace() const
+{
+    return sSegments.capacity() - sSegments.size();
+}
+
+/** True once the queue is empty and the last segment (incl. hold) has finished; parks the timer. */
+bool FED4::motorIdle()
+{
+    const bool idle = !sActive && sSegments.empty();
+    if (idle && sTimerRunning)
+    {
+        timerStop(sMotorTimer);
+        sTimerRunning = false;
+    }
+    return idle;
+}
+
+bool FED4::waitMotorIdle(uint32_t timeoutMs)
+{
+    const unsigned long start = millis();
+    while (!motorIdle())
+    {
+        if (millis() - start >= timeoutMs)
+            return false;
+        delay(1);
+    }
+    return true;
+}
+
+/** Stop immediately: park the timer, drop queued segments, release coils. */
+void FED4::stopMotor()
+{
+    if (sMotorTimer != nullptr)
+    {
+        timerStop(sMotorTimer);
+        sTimerRunning = false;
+    }
+    FedStepSegment discard;
+    while (sSegments.pop(discard)) // ISR parked — loop may consume
+    {
+    }
+    sStepsLeft = 0;
+    sHoldTicks = 0;
+    sActive = false;
+    fed4WriteCoils(0);
+}
+
+bool FED4::motorStoppedByPellet() const
+{
+    return sPelletStop;
+}
+
+/** Steps taken by FED4_SEG_COUNT_STEPS segments since the last reset. */
+uint32_t FED4::motorCountedSteps(bool reset)
+{
+    const uint32_t steps = sCountedSteps;
+    if (reset)
+        sCountedSteps = 0;
+    return steps;
+}
+
+uint32_t FED4::motorCoilTicks() const
+{
+    return sCoilTicks;
+}
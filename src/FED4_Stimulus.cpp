@@ -0,0 +1,351 @@
+#include "FED4.h"
+
+#include <atomic>
+
+// ── Stimulus onsets ──────────────────────────────────────────────────────────
+// One API for tone / LED / haptic / TRRS cues that reports scheduled and
+// physical onset on the esp_timer µs clock (same clock as millis() and the
+// photogate/touch stamps). Future onsets run from a one-shot esp_timer:
+//  - Tone: the note is armed in loop context (amp already on), the timer only
+//    posts it to the audio queue; onset = first sample into the DMA.
+//  - TRRS: the timer drives the GPIO directly; a second timer ends the pulse.
+//  - LED / haptic: FastLED and the I2C expander are loop-only, so the timer
+//    marks the slot due and serviceStimuli() switches it. Lag is in the log.
+// Every onset/offset is the software stamp plus a fixed per-kind output
+// latency (stimOutputLatencyUs, logged as out_lat_us), so onset_us means
+// "output physically on" for every kind.
+// Completed stimuli are logged as "StimOnset" rows by serviceStimuli().
+
+enum : uint8_t
+{
+    kStimFree = 0,
+    kStimScheduled, // waiting for the on-timer
+    kStimDue,       // Led/Haptic: on-timer fired, loop switches the output
+    kStimRunning,   // output on, waiting for its offset
+    kStimDone       // ready to log
+};
+
+struct FedStimSlot
+{
+    std::atomic<uint8_t> state{kStimFree};
+    FedStimulus stim;
+    FedStimOnset onset;
+    int64_t offAtUs = 0; // Led/Haptic offset, serviced by loop
+    uint8_t pin = 0;     // Trrs
+    esp_timer_handle_t onTimer = nullptr;
+    esp_timer_handle_t offTimer = nullptr;
+};
+
+static FedStimSlot sStim[FED4_MAX_STIMULI];
+static uint32_t sNextStimId = 1;
+
+static const char *const kStimNames[] = {"tone", "led", "haptic", "trrs"};
+
+// Samples written to an idle, running I2S channel go out after the rest of the
+// DMA ring (FED4_AUDIO_DMA_DESC - 1 descriptors, ±1 frame, 5 ms).
+
+/** Fixed delay from the software stamp to the physical output, per kind. */
+static int32_t stimOutputLatencyUs(FedStimKind kind)
+{
+    switch (kind)
+    {
+    case FedStimKind::Tone:
+        return (int32_t)((int64_t)(FED4_AUDIO_DMA_DESC - 1) * FED4_AUDIO_DMA_FRAMES * 1000000 / FED4_AUDIO_SAMPLE_RATE_HZ);
+    case FedStimKind::Led:
+        return NUM_STRIP_LEDS * 24 * 5 / 4; // FastLED.show() returns as the RMT frame starts: 24 bits × 1.25 µs per LED
+    default:
+        return 0; // haptic: stamped after the I2C write; TRRS: GPIO from the timer
+    }
+}
+
+static uint8_t fed4TrrsPin(uint8_t channel)
+{
+    switch (channel)
+    {
+    case 1:
+        return AUDIO_TRRS_1;
+    case 2:
+        return AUDIO_TRRS_2;
+    case 3:
+        return AUDIO_TRRS_3;
+    default:
+        return 0xFF;
+    }
+}
+
+/** Audio task: tone reached the DMA / finished. */
+static void fed4StimAudioHook(void *ctx, int64_t startUs, int64_t stopUs)
+{
+    FedStimSlot *s = static_cast<FedStimSlot *>(ctx);
+    s->onset.onsetUs = startUs + s->onset.outputLatencyUs;
+    s->onset.offsetUs = stopUs + s->onset.outputLatencyUs;
+    s->state.store(kStimDone);
+}
+
+/** esp_timer task: end of a TRRS pulse. */
+static void fed4StimOffTimer(void *arg)
+{
+    FedStimSlot *s = static_cast<FedStimSlot *>(arg);
+    digitalWrite(s->pin, LOW);
+    s->onset.offsetUs = esp_timer_get_time();
+    s->state.store(kStimDone);
+}
+
+/** esp_timer task (or loop for delay 0): the scheduled onset time has come. */
+void FED4::stimOnTimer(void *arg)
+{
+    FedStimSlot *s = static_cast<FedStimSlot *>(arg);
+    const uint8_t slot = (uint8_t)(s - sStim);
+
+    switch (s->stim.kind)
+    {
+    case FedStimKind::Tone:
+        s->state.store(kStimRunning);
+        if (!postArmedAudio(slot))
+            s->state.store(kStimDone); // queue full — logged with onset 0
+        break;
+    case FedStimKind::Trrs:
+        digitalWrite(s->pin, HIGH);
+        s->onset.onsetUs = esp_timer_get_time();
+        s->state.store(kStimRunning);
+        esp_timer_start_once(s->offTimer, (uint64_t)max<uint32_t>(s->stim.durationMs, 1) * 1000ULL);
+        break;
+    default:
+        s->state.store(kStimDue);
+        break;
+    }
+}
+
+// ── scheduling ───────────────────────────────────────────────────────────────
+
+/**
+ * Start stim delayMs from now (0 = immediately). Returns the stimulus id used
+ * in its StimOnset row, or 0 when every slot is busy or the stimulus is invalid.
+ */
+uint32_t FED4::stimulus(const FedStimulus &stim, uint32_t delayMs)
+{
+    uint8_t slot = FED4_MAX_STIMULI;
+    for (uint8_t i = 0; i < FED4_MAX_STIMULI; i++)
+    {
+        if (sStim[i].state.load() == kStimFree)
+        {
+            slot = i;
+            break;
+        }
+    }
+    if (slot == FED4_MAX_STIMULI)
+    {
+        Serial.println("stimulus: all slots busy");
+        return 0;
+    }
+
+    FedStimSlot &s = sStim[slot];
+    if (s.onTimer == nullptr)
+    {
+        esp_timer_create_args_t args = {};
+        args.callback = stimOnTimer;
+        args.arg = &s;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "fed4StimOn";
+        esp_timer_create(&args, &s.onTimer);
+        args.callback = fed4StimOffTimer;
+        args.name = "fed4StimOff";
+        esp_timer_create(&args, &s.offTimer);
+        if (s.onTimer == nullptr || s.offTimer == nullptr)
+            return 0;
+    }
+
+    s.stim = stim;
+    s.onset = FedStimOnset();
+    s.onset.kind = stim.kind;
+    s.onset.outputLatencyUs = stimOutputLatencyUs(stim.kind);
+    s.offAtUs = 0;
+
+    if (stim.kind == FedStimKind::Trrs)
+    {
+        s.pin = fed4TrrsPin(stim.channel);
+        if (s.pin == 0xFF)
+        {
+            Serial.println("*** stimulus: TRRS channel must be 1-3");
+            return 0;
+        }
+        pinMode(s.pin, OUTPUT);
+    }
+    else if (stim.kind == FedStimKind::Tone)
+    {
+        const FedAudioNote note = fed4Note(stim.frequency, (uint16_t)min<uint32_t>(stim.durationMs, 0xFFFF),
+                                           stim.amplitude);
+        if (!armAudio(slot, note, fed4StimAudioHook, &s, delayMs == 0))
+            return 0;
+    }
+
+    s.onset.id = sNextStimId++;
+    s.state.store(kStimScheduled);
+    s.onset.scheduledUs = esp_timer_get_time() + (int64_t)delayMs * 1000;
+    if (delayMs == 0)
+        stimOnTimer(&s);
+    else
+        esp_timer_start_once(s.onTimer, (uint64_t)delayMs * 1000ULL);
+
+    if (s.state.load() == kStimDue)
+        fireStimulus(slot);
+    return s.onset.id;
+}
+
+uint32_t FED4::stimTone(uint16_t frequency, uint32_t durationMs, float amplitude, uint32_t delayMs)
+{
+    FedStimulus stim;
+    stim.kind = FedStimKind::Tone;
+    stim.frequency = frequency;
+    stim.durationMs = durationMs;
+    stim.amplitude = amplitude;
+    return stimulus(stim, delayMs);
+}
+
+uint32_t FED4::stimLed(uint32_t color, uint32_t durationMs, uint32_t delayMs)
+{
+    FedStimulus stim;
+    stim.kind = FedStimKind::Led;
+    stim.color = color;
+    stim.durationMs = durationMs;
+    return stimulus(stim, delayMs);
+}
+
+uint32_t FED4::stimHaptic(uint32_t durationMs, uint32_t delayMs)
+{
+    FedStimulus stim;
+    stim.kind = FedStimKind::Haptic;
+    stim.durationMs = durationMs;
+    return stimulus(stim, delayMs);
+}
+
+uint32_t FED4::stimTrrs(uint8_t channel, uint32_t durationMs, uint32_t delayMs)
+{
+    FedStimulus stim;
+    stim.kind = FedStimKind::Trrs;
+    stim.channel = channel;
+    stim.durationMs = durationMs;
+    return stimulus(stim, delayMs);
+}
+
+// ── loop-side onsets / logging ───────────────────────────────────────────────
+
+/** Switch a due Led/Haptic output on and stamp it (stamp after the write completes). */
+bool FED4::fireStimulus(uint8_t slot)
+{
+    FedStimSlot &s = sStim[slot];
+    if (s.stim.kind == FedStimKind::Led)
+    {
+        stopAnimation();
+        fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB(s.stim.color));
+        showStrip();
+    }
+    else
+    {
+        mcp.digitalWrite(EXP_HAPTIC, HIGH);
+    }
+    s.onset.onsetUs = esp_timer_get_time() + s.onset.outputLatencyUs;
+
+    if (s.stim.durationMs == 0 && s.stim.kind == FedStimKind::Led)
+    {
+        s.state.store(kStimDone); // left on
+        return true;
+    }
+    s.offAtUs = s.onset.onsetUs + (int64_t)s.stim.durationMs * 1000;
+    s.state.store(kStimRunning);
+    return true;
+}
+
+/**
+ * Fire due Led/Haptic onsets, end their pulses, and log every completed
+ * stimulus. Called from update(); call it in tight custom loops too.
+ */
+void FED4::serviceStimuli()
+{
+    for (uint8_t i = 0; i < FED4_MAX_STIMULI; i++)
+    {
+        FedStimSlot &s = sStim[i];
+        uint8_t state = s.state.load();
+
+        if (state == kStimDue)
+        {
+            fireStimulus(i);
+            state = s.state.load();
+        }
+
+        if (state == kStimRunning && s.offAtUs && esp_timer_get_time() >= s.offAtUs)
+        {
+            if (s.stim.kind == FedStimKind::Led)
+            {
+                fill_solid(strip_leds, NUM_STRIP_LEDS, CRGB::Black);
+                showStrip();
+            }
+            else
+            {
+                mcp.digitalWrite(EXP_HAPTIC, LOW);
+            }
+            s.onset.offsetUs = esp_timer_get_time() + s.onset.outputLatencyUs;
+            state = kStimDone;
+        }
+
+        if (state != kStimDone)
+            continue;
+
+        const FedStimOnset onset = s.onset;
+        s.state.store(kStimFree);
+        lastStimOnset = onset;
+
+        if (stimLogging)
+        {
+            char detail[160];
+            snprintf(detail, sizeof(detail), "stim=%s;id=%lu;sched_us=%lld;onset_us=%lld;lag_us=%lld;off_us=%lld;out_lat_us=%ld",
+                     kStimNames[(uint8_t)onset.kind], (unsigned long)onset.id, (long long)onset.scheduledUs,
+                     (long long)onset.onsetUs,
+                     onset.onsetUs ? (long long)(onset.onsetUs - onset.scheduledUs) : -1LL,
+                     (long long)onset.offsetUs, (long)onset.outputLatencyUs);
+            logData("StimOnset", detail);
+        }
+        if (onStimOnset)
+            onStimOnset(onset);
+    }
+}
+
+bool FED4::waitStimuli(uint32_t timeoutMs)
+{
+    const unsigned long start = millis();
+    for (;;)
+    {
+        serviceStimuli();
+        bool idle = true;
+        for (uint8_t i = 0; i < FED4_MAX_STIMULI; i++)
+        {
+            if (sStim[i].state.load() != kStimFree)
+                idle = false;
+        }
+        if (idle)
+            return true;
+        if (millis() - start >= timeoutMs)
+            return false;
+        delay(1);
+    }
+}
+
+/** Drop onsets that have not started; running stimuli finish normally. */
+void FED4::cancelStimuli()
+{
+    for (uint8_t i = 0; i < FED4_MAX_STIMULI; i++)
+    {
+        FedStimSlot &s = sStim[i];
+        const uint8_t state = s.state.load();
+        if (state == kStimScheduled && esp_timer_stop(s.onTimer) == ESP_OK)
+        {
+            if (s.stim.kind == FedStimKind::Tone)
+                disarmAudio(i);
+            s.state.store(kStimFree);
+        }
+        else if (state == kStimDue)
+        {
+            s.state.store(kStimFree);
+        }
+    }
+}
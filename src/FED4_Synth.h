@@ -0,0 +1,157 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Fixed-point tone synthesis for the I2S speaker (no Arduino deps — UT/bench friendly).
+// Phase accumulator: 32-bit phase, top 10 bits index a 1024-entry sine LUT,
+// next 16 bits interpolate. Amplitude and envelope are Q15.
+
+static constexpr uint32_t FED4_SINE_LUT_BITS = 10;
+static constexpr uint32_t FED4_SINE_LUT_SIZE = 1u << FED4_SINE_LUT_BITS;
+
+/** 1024-entry full-cycle sine (+1 guard entry for interpolation), built at compile time. */
+struct FedSineLut
+{
+    int16_t v[FED4_SINE_LUT_SIZE + 1];
+
+    constexpr FedSineLut() : v()
+    {
+        constexpr double pi = 3.14159265358979323846;
+        for (uint32_t i = 0; i <= FED4_SINE_LUT_SIZE; i++)
+        {
+            // Reduce to [-pi/2, pi/2] and use a 9-term Taylor series (error < 1e-9)
+            double x = 2.0 * pi * (double)(i % FED4_SINE_LUT_SIZE) / FED4_SINE_LUT_SIZE;
+            if (x > pi)
+                x -= 2.0 * pi;
+            if (x > pi / 2)
+                x = pi - x;
+            else if (x < -pi / 2)
+                x = -pi - x;
+            double term = x, sum = x;
+            for (int k = 1; k < 10; k++)
+            {
+                term *= -x * x / (double)((2 * k) * (2 * k + 1));
+                sum += term;
+            }
+            const double s = sum * 32767.0;
+            v[i] = (int16_t)(s >= 0 ? s + 0.5 : s - 0.5);
+        }
+    }
+};
+
+inline constexpr FedSineLut kFedSineLut{};
+
+/** Waveform for FedToneGen. */
+enum class FedWave : uint8_t
+{
+    Sine = 0,
+    Square,
+    Noise
+};
+
+/**
+ * One envelope-shaped note: sine/square/noise with linear attack/release and an
+ * optional linear glide. fill() writes whole I2S chunks; call until done().
+ */
+class FedToneGen
+{
+public:
+    /** amplitudeQ15: 0..32767. fadeSamples clamps to half the note so short notes still reach zero. */
+    void start(FedWave wave, uint32_t frequencyHz, uint32_t sampleCount, uint16_t amplitudeQ15,
+               uint32_t fadeSamples, uint32_t sampleRateHz)
+    {
+        this->wave = wave;
+        rate = sampleRateHz;
+        total = sampleCount;
+        pos = 0;
+        amp = amplitudeQ15;
+        fade = fadeSamples < sampleCount / 2 ? fadeSamples : sampleCount / 2;
+        phase = 0;
+        inc = phaseIncrement(frequencyHz, sampleRateHz);
+        incStep = 0;
+        if (!noiseState)
+            noiseState = 0x2545F491u;
+    }
+
+    /** Glide linearly from the start frequency to endHz across the note. */
+    void glideTo(uint32_t endHz)
+    {
+        if (!total)
+            return;
+        const int64_t delta = (int64_t)phaseIncrement(endHz, rate) - (int64_t)inc;
+        incStep = (int32_t)(delta / (int64_t)total);
+    }
+
+    bool done() const { return pos >= total; }
+    uint32_t remaining() const { return total - pos; }
+
+    /** Fill up to n samples; returns the number written (0 once done). */
+    size_t fill(int16_t *out, size_t n)
+    {
+        if (n > total - pos)
+            n = total - pos;
+
+        for (size_t i = 0; i < n; i++, pos++)
+        {
+            int32_t s;
+            switch (wave)
+            {
+            case FedWave::Sine:
+            {
+                const uint32_t idx = phase >> (32 - FED4_SINE_LUT_BITS);
+                const int32_t frac = (int32_t)((phase >> (16 - FED4_SINE_LUT_BITS)) & 0xFFFF);
+                const int32_t a = kFedSineLut.v[idx];
+                const int32_t b = kFedSineLut.v[idx + 1];
+                s = a + (((b - a) * frac) >> 16);
+                break;
+            }
+            case FedWave::Square:
+                s = (phase & 0x80000000u) ? -32767 : 32767;
+                break;
+            default: // Noise — xorshift32
+                noiseState ^= noiseState << 13;
+                noiseState ^= noiseState >> 17;
+                noiseState ^= noiseState << 5;
+                s = (int16_t)(noiseState >> 16);
+                break;
+            }
+            phase += inc;
+            inc += incStep;
+
+            int32_t gain = amp;
+            if (pos < fade)
+                gain = (int32_t)(((int64_t)gain * pos) / fade);
+            else if (total - pos <= fade)
+                gain = (int32_t)(((int64_t)gain * (total - pos - 1)) / fade);
+            out[i] = (int16_t)((s * gain) >> 15);
+        }
+        return n;
+    }
+
+    static uint32_t phaseIncrement(uint32_t hz, uint32_t sampleRateHz)
+    {
+        return sampleRateHz ? (uint32_t)(((uint64_t)hz << 32) / sampleRateHz) : 0;
+    }
+
+    static constexpr uint16_t amplitudeQ15(float amplitude)
+    {
+        if (amplitude <= 0.0f)
+            return 0;
+        if (amplitude >= 1.0f)
+            return 32767;
+        return (uint16_t)(amplitude * 32767.0f);
+    }
+
+private:
+    FedWave wave = FedWave::Sine;
+    uint32_t rate = 48000;
+    uint32_t total = 0;
+    uint32_t pos = 0;
+    uint32_t fade = 0;
+    uint32_t phase = 0;
+    uint32_t inc = 0;
+    int32_t incStep = 0;
+    uint16_t amp = 0;
+    uint32_t noiseState = 0;
+};
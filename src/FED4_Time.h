@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Library-wide timebase. FedTimeUs is esp_timer µs since boot: 64-bit,
+// monotonic, and it keeps counting through light sleep. It does not wrap in
+// any run (2^63 µs ≈ 292 000 years). millis() is the same clock cut to 32 bits
+// and wraps after 49.7 days, so event stamps and log rows use FedTimeUs; the
+// ms fields kept for older sketches are fedMs32() of it, which makes unsigned
+// differences against millis() right across the wrap. FedClockModel maps
+// FedTimeUs to Unix µs (anchored on the DS3231 in FED4_RTC.cpp). No Arduino
+// deps — on a host the clock is steady_clock.
+
+#if defined(ESP_PLATFORM)
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+typedef int64_t FedTimeUs;
+
+inline FedTimeUs fedNowUs()
+{
+#if defined(ESP_PLATFORM)
+    return esp_timer_get_time();
+#else
+    return (FedTimeUs)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+/** Low 32 bits of the ms count — what millis() returned at t. */
+inline uint32_t fedMs32(FedTimeUs t)
+{
+    return (uint32_t)(uint64_t)(t / 1000);
+}
+
+/**
+ * "seconds.mmm" in integer arithmetic. A float of seconds since boot has 62 ms
+ * steps after 12 days and 0.5 s steps after 97 days.
+ */
+inline int fedFormatSeconds(char *out, size_t size, FedTimeUs t)
+{
+    return snprintf(out, size, "%lld.%03d", (long long)(t / 1000000), (int)((t / 1000) % 1000));
+}
+
+/**
+ * FedTimeUs → Unix µs: an anchor plus a rate. discipline() takes one reading
+ * of a whole-second reference (true time somewhere in [refSeconds, +1 s)) and
+ * corrects the model only if it has left that second, and then just to its
+ * edge: the offset over short baselines, the rate through the anchor once
+ * minBaselineUs has passed since it.
+ */
+struct FedClockModel
+{
+    FedTimeUs anchorUs = 0;
+    int64_t anchorUnixUs = 0;
+    double driftPpm = 0; // + = FedTimeUs runs fast against the reference
+    bool valid = false;
+
+    int64_t toUnixUs(FedTimeUs t) const
+    {
+        const int64_t elapsedUs = t - anchorUs;
+        return anchorUnixUs + elapsedUs - (int64_t)((double)elapsedUs * driftPpm * 1e-6);
+    }
+
+    /** The reference second started exactly at t (set, or a tick was waited for). */
+    void anchor(FedTimeUs t, int64_t unixUs)
+    {
+        anchorUs = t;
+        anchorUnixUs = unixUs;
+        valid = true;
+    }
+
+    /** Returns the correction in µs (model minus the second's nearest edge; 0 = inside it). */
+    int64_t discipline(FedTimeUs t, uint32_t refSeconds, int64_t minBaselineUs)
+    {
+        const int64_t refUs = (int64_t)refSeconds * 1000000LL;
+        if (!valid)
+        {
+            anchor(t, refUs + 500000); // mid-second: ±0.5 s until the next aligned anchor
+            return 0;
+        }
+        const int64_t predictedUs = toUnixUs(t);
+        int64_t targetUs;
+        if (predictedUs < refUs)
+            targetUs = refUs;
+        else if (predictedUs >= refUs + 1000000)
+            targetUs = refUs + 999999;
+        else
+            return 0;
+
+        const int64_t elapsedUs = t - anchorUs;
+        if (elapsedUs >= minBaselineUs)
+            driftPpm = (1.0 - (double)(targetUs - anchorUnixUs) / (double)elapsedUs) * 1e6;
+        else
+            anchorUnixUs -= predictedUs - targetUs; // too short to tell rate from offset
+        return predictedUs - targetUs;
+    }
+};
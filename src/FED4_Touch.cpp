@@ -203,6 +203,39 @@ bool fed4TouchInitPads(void)
   return fed4TouchRefreshIdleBaselines(8, 10);
 }
 
+bool fed4TouchInitPadsWithIdle(uint32_t idleL, uint32_t idleC, uint32_t idleR)
+{
+  if (!idleL || !idleC || !idleR)
+    return false;
+  if (sTouchSens == NULL)
+  {
+    if (!fed4TouchNgCreateController())
+      return false;
+  }
+  const uint8_t pads[] = {TOUCH_PAD_LEFT, TOUCH_PAD_CENTER, TOUCH_PAD_RIGHT};
+  const uint32_t idle[] = {idleL, idleC, idleR};
+  for (int i = 0; i < 4; i++) // let the smooth filter settle
+  {
+    for (int p = 0; p < 3; p++)
+      fed4TouchRead(pads[p]);
+    delay(5);
+  }
+  // A pad more than one wake threshold off its stored idle gets a real calibration
+  for (int p = 0; p < 3; p++)
+  {
+    const uint32_t raw = fed4TouchRead(pads[p]);
+    const uint32_t band = fed4TouchWakeThreshold(idle[p]);
+    if (raw > idle[p] + band || raw + band < idle[p])
+      return false;
+  }
+  fed4TouchIdleL = idleL;
+  fed4TouchIdleC = idleC;
+  fed4TouchIdleR = idleR;
+  return fed4TouchNgApplyThresholds(fed4TouchWakeThreshold(idleL),
+                                    fed4TouchWakeThreshold(idleC),
+                                    fed4TouchWakeThreshold(idleR));
+}
+
 bool fed4TouchEnableTouchpadWakeup(void)
 {
   return esp_sleep_enable_touchpad_wakeup() == ESP_OK;
@@ -290,6 +323,7 @@ bool FED4::capturePoke()
   resetTouchFlags();
   wakePad = 0;
   pokeDuration = 0.0f;
+  lastContact = FedContact::None;
 
   int padIndex = 0;
   for (int attempt = 0; attempt < 25 && padIndex == 0; attempt++)
@@ -300,13 +334,39 @@ bool FED4::capturePoke()
   if (padIndex == 0)
     return false;
 
+  return trackContact(padIndex);
+}
+
+static uint8_t fed4TouchPadPin(int padIndex)
+{
+  return padIndex == 1 ? TOUCH_PAD_LEFT : (padIndex == 2 ? TOUCH_PAD_CENTER : TOUCH_PAD_RIGHT);
+}
+
+static uint32_t fed4TouchPadIdle(int padIndex)
+{
+  return padIndex == 1 ? fed4TouchIdleL : (padIndex == 2 ? fed4TouchIdleC : fed4TouchIdleR);
+}
+
+/**
+ * Sample the identified pad every 1 ms until release (or 500 ms), streaming
+ * rise into the feature extractor, then classify and count the contact.
+ */
+bool FED4::trackContact(int padIndex)
+{
+  const uint8_t pin = fed4TouchPadPin(padIndex);
+  const uint32_t idle = fed4TouchPadIdle(padIndex);
+
   const unsigned long touchStartTime = millis();
   const unsigned long maxSamplingTime_ms = 500;
   const int minReleaseReadings = 2;
   int belowThresholdCount = 0;
 
+  FedContactExtractor extractor;
+  extractor.begin(touchStartTime, lastContactOnsetMs);
+
   while (millis() - touchStartTime < maxSamplingTime_ms)
   {
+    extractor.add(fed4TouchRiseQ12(fed4TouchRead(pin), idle), millis());
     if (fed4TouchPadsReleased(TOUCH_THRESHOLD))
     {
       belowThresholdCount++;
@@ -320,11 +380,18 @@ bool FED4::capturePoke()
     delay(1);
   }
 
-  pokeDuration = (float)(millis() - touchStartTime);
+  const unsigned long releaseTime = millis();
+  pokeDuration = (float)(releaseTime - touchStartTime);
+  lastContactFeatures = extractor.finish(releaseTime);
+  lastContact = fed4ClassifyContact(lastContactFeatures, contactThresholds);
+  lastContactOnsetMs = touchStartTime;
 
   const FedPad pad = static_cast<FedPad>(padIndex);
   wakePad = (uint8_t)padIndex;
 
+  if (lastContact == FedContact::Lick)
+    lickCount++;
+
   if (pad == FedPad::Left)
   {
     leftCount++;
@@ -344,6 +411,81 @@ bool FED4::capturePoke()
   return true;
 }
 
+String FED4::contactDetail() const
+{
+  char buf[96];
+  snprintf(buf, sizeof(buf), "contact=%s;dwell=%lu;peak=%.3f;slope=%.4f;ici=%lu",
+           fed4ContactName(lastContact),
+           (unsigned long)lastContactFeatures.dwellMs,
+           lastContactFeatures.peakRiseQ12 / 4096.0f,
+           lastContactFeatures.riseSlopeQ12 / 4096.0f,
+           (unsigned long)lastContactFeatures.intervalMs);
+  return String(buf);
+}
+
+/**
+ * Lick bout: poll pads while licks keep arriving on the same pad within
+ * lickBoutGapMs, then write one summary row instead of one row per lick.
+ * A bout is capped at 60 s so long sessions still land on SD periodically.
+ */
+bool FED4::captureLickBout()
+{
+  const unsigned long maxBoutMs = 60000;
+  const uint8_t boutPad = wakePad;
+  const unsigned long boutStart = lastContactOnsetMs;
+
+  uint32_t licks = 1;
+  uint32_t dwellSum = lastContactFeatures.dwellMs;
+  uint32_t peakSumQ12 = lastContactFeatures.peakRiseQ12;
+  uint32_t iliSum = 0;
+  uint32_t iliCount = 0;
+  unsigned long lastRelease = millis();
+  bool endedByGap = true;
+
+  while (millis() - lastRelease < lickBoutGapMs && millis() - boutStart < maxBoutMs)
+  {
+    const int padIndex = fed4TouchIdentifyWakePadIndex(TOUCH_THRESHOLD);
+    if (padIndex == 0)
+    {
+      delay(1);
+      continue;
+    }
+
+    resetTouchFlags();
+    trackContact(padIndex);
+    lastRelease = millis();
+
+    if (lastContact != FedContact::Lick || padIndex != boutPad)
+    {
+      endedByGap = false;
+      break;
+    }
+    licks++;
+    dwellSum += lastContactFeatures.dwellMs;
+    peakSumQ12 += lastContactFeatures.peakRiseQ12;
+    if (lastContactFeatures.intervalMs)
+    {
+      iliSum += lastContactFeatures.intervalMs;
+      iliCount++;
+    }
+  }
+
+  static const char *const padNames[] = {"None", "Left", "Center", "Right"};
+  char detail[128];
+  snprintf(detail, sizeof(detail), "pad=%s;licks=%lu;boutMs=%lu;meanDwell=%lu;meanIli=%lu;meanPeak=%.3f",
+           padNames[boutPad <= 3 ? boutPad : 0],
+           (unsigned long)licks,
+           (unsigned long)(lastRelease - boutStart),
+           (unsigned long)(dwellSum / licks),
+           (unsigned long)(iliCount ? iliSum / iliCount : 0),
+           (peakSumQ12 / licks) / 4096.0f);
+#if !FED4_DIAG_SKIP_SD_LOG
+  logData("LickBout", detail);
+#endif
+  Serial.printf("LickBout: %s\n", detail);
+  return endedByGap;
+}
+
 void FED4::resetTouchFlags()
 {
   leftTouch = false;
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdint.h>
+
+// Streaming touch-contact features + fixed-point lick/poke/hold classifier.
+// Pure integer math (no Arduino deps) so capturePoke() can run it per 1 ms sample.
+// Rise is expressed in Q12: (raw - idle) * 4096 / idle, so TOUCH_THRESHOLD 0.03 ≈ 123.
+
+/** Contact label from fed4ClassifyContact(). */
+enum class FedContact : uint8_t
+{
+    None = 0,
+    Lick,
+    Poke,
+    Hold
+};
+
+/** Per-contact features; filled by FedContactExtractor. */
+struct FedContactFeatures
+{
+    uint32_t peakRiseQ12 = 0;  // peak rise fraction (Q12)
+    uint32_t riseSlopeQ12 = 0; // peak rise / ms from onset to peak (Q12 per ms)
+    uint32_t dwellMs = 0;      // onset → release
+    uint32_t intervalMs = 0;   // onset → previous onset (0 = first contact / unknown)
+};
+
+/** Classifier tuning; defaults target mouse licks (~6–10 Hz, <100 ms tongue contacts). */
+struct FedContactThresholds
+{
+    uint16_t lickMaxDwellMs = 100;        // longer contacts are never licks
+    uint16_t holdMinDwellMs = 400;        // at/above this a contact is a hold
+    uint16_t lickMaxPeakQ12 = 1024;       // tongue contacts couple less than paws (0.25 rise)
+    uint16_t lickMaxIntervalMs = 250;     // rhythmic onsets within this are lick-like
+    uint16_t lickMinSlopeQ12PerMs = 40;   // licks reach peak quickly
+};
+
+/** Rise fraction above idle in Q12; 0 when below idle or idle unknown. */
+inline uint32_t fed4TouchRiseQ12(uint32_t raw, uint32_t idle)
+{
+    if (!idle || raw <= idle)
+        return 0;
+    return (uint32_t)(((uint64_t)(raw - idle) << 12) / idle);
+}
+
+/** Accumulates samples for one contact; call begin(), add() per sample, finish() on release. */
+class FedContactExtractor
+{
+public:
+    void begin(uint32_t onsetMs, uint32_t previousOnsetMs)
+    {
+        onset = onsetMs;
+        peakAtMs = onsetMs;
+        features = FedContactFeatures();
+        features.intervalMs = previousOnsetMs ? onsetMs - previousOnsetMs : 0;
+    }
+
+    void add(uint32_t riseQ12, uint32_t nowMs)
+    {
+        if (riseQ12 > features.peakRiseQ12)
+        {
+            features.peakRiseQ12 = riseQ12;
+            peakAtMs = nowMs;
+        }
+    }
+
+    const FedContactFeatures &finish(uint32_t releaseMs)
+    {
+        features.dwellMs = releaseMs - onset;
+        features.riseSlopeQ12 = features.peakRiseQ12 / (peakAtMs - onset + 1);
+        return features;
+    }
+
+    uint32_t onsetMs() const { return onset; }
+
+private:
+    uint32_t onset = 0;
+    uint32_t peakAtMs = 0;
+    FedContactFeatures features;
+};
+
+/**
+ * Dwell gates hold/poke; short contacts vote lick on low peak, fast rise and
+ * rhythmic interval (two of three).
+ */
+inline FedContact fed4ClassifyContact(const FedContactFeatures &f, const FedContactThresholds &t)
+{
+    if (f.dwellMs >= t.holdMinDwellMs)
+        return FedContact::Hold;
+    if (f.dwellMs > t.lickMaxDwellMs)
+        return FedContact::Poke;
+
+    uint8_t votes = 0;
+    if (f.peakRiseQ12 <= t.lickMaxPeakQ12)
+        votes++;
+    if (f.riseSlopeQ12 >= t.lickMinSlopeQ12PerMs)
+        votes++;
+    if (f.intervalMs && f.intervalMs <= t.lickMaxIntervalMs)
+        votes++;
+    return votes >= 2 ? FedContact::Lick : FedContact::Poke;
+}
+
+inline const char *fed4ContactName(FedContact c)
+{
+    switch (c)
+    {
+    case FedContact::Lick:
+        return "Lick";
+    case FedContact::Poke:
+        return "Poke";
+    case FedContact::Hold:
+        return "Hold";
+    default:
+        return "None";
+    }
+}
@@ -19,6 +19,8 @@ extern uint32_t fed4TouchIdleC;
 extern uint32_t fed4TouchIdleR;
 
 bool fed4TouchInitPads(void);
+/** Init with stored idle baselines (warm restart); false if the pads no longer sit near them. */
+bool fed4TouchInitPadsWithIdle(uint32_t idleL, uint32_t idleC, uint32_t idleR);
 uint32_t fed4TouchRead(uint8_t pin);
 float fed4TouchRiseFraction(uint32_t raw, uint32_t idle);
 uint32_t fed4TouchWakeThreshold(uint32_t idle);
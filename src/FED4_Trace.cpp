@@ -0,0 +1,78 @@
+#include "FED4.h"
+
+// ── Wake-path profiler ───────────────────────────────────────────────────────
+// Tracepoints (FED4_Trace.h) run from the Wake stamp in startSleep() through
+// wakeUp(), the poke log and update() to Ready at the end of waitUntil() (or
+// of sleep()). sleep(0) stamps Wake without sleeping, so every window has its
+// own start.
+// finishWakeTrace() turns that window into wake-to-ready stats and, when
+// asked, a per-stage breakdown on Serial and/or a "WakeTrace" CSV row.
+
+/** Ring index of the newest Wake stamp, or -1. */
+static int32_t fed4LastWakeIndex()
+{
+    for (int32_t i = (int32_t)gFedTrace.size() - 1; i >= 0; i--)
+    {
+        if (gFedTrace.at(i).id == (uint8_t)FedTracePoint::Wake)
+            return i;
+    }
+    return -1;
+}
+
+void FED4::finishWakeTrace()
+{
+    fed4Trace(FedTracePoint::Ready);
+    const int32_t w = fed4LastWakeIndex();
+    if (w < 0)
+        return;
+
+    const uint32_t mhz = ESP.getCpuFreqMHz();
+    const FedTraceEvent &ready = gFedTrace.at(gFedTrace.size() - 1);
+    lastWakeToReadyUs = (ready.cycles - gFedTrace.at(w).cycles) / mhz;
+    wakeTraceCount++;
+    wakeTraceTotalUs += lastWakeToReadyUs;
+    if (lastWakeToReadyUs > maxWakeToReadyUs)
+        maxWakeToReadyUs = lastWakeToReadyUs;
+
+    if (traceSerial)
+    {
+        Serial.printf("Wake %d: %lu us to ready (mean %lu, max %lu), update skipped ~%lu us\n", wakeCount,
+                      (unsigned long)lastWakeToReadyUs, (unsigned long)(wakeTraceTotalUs / wakeTraceCount),
+                      (unsigned long)maxWakeToReadyUs, (unsigned long)lastUpdateSavedUs);
+        for (uint32_t i = (uint32_t)w + 1; i < gFedTrace.size(); i++)
+        {
+            const FedTraceEvent &e = gFedTrace.at(i);
+            Serial.printf("  %-16s %8lu us\n", kFedTraceNames[e.id],
+                          (unsigned long)((e.cycles - gFedTrace.at(i - 1).cycles) / mhz));
+        }
+    }
+    if (traceLogging)
+        logData("WakeTrace", traceWakeDetail());
+}
+
+/** key=value per stage of the last wake (µs), led by wake_us and what update() skipped. */
+String FED4::traceWakeDetail() const
+{
+    const int32_t w = fed4LastWakeIndex();
+    if (w < 0)
+        return String();
+    const uint32_t mhz = ESP.getCpuFreqMHz();
+    String detail = "wake_us=" + String(lastWakeToReadyUs) + ";saved_us=" + String(lastUpdateSavedUs);
+    for (uint32_t i = (uint32_t)w + 1; i < gFedTrace.size(); i++)
+    {
+        const FedTraceEvent &e = gFedTrace.at(i);
+        detail += ";";
+        detail += kFedTraceNames[e.id];
+        detail += "=";
+        detail += String((e.cycles - gFedTrace.at(i - 1).cycles) / mhz);
+        if (e.id == (uint8_t)FedTracePoint::Ready)
+            break;
+    }
+    return detail;
+}
+
+/** Whole ring as Chrome trace JSON on Serial — save it and open in ui.perfetto.dev. */
+void FED4::traceDumpChrome()
+{
+    fed4TraceChromeJson(gFedTrace, (double)ESP.getCpuFreqMHz(), [](const char *s) { Serial.print(s); });
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Wake-path tracepoints: static ids stamped with the CPU cycle counter into a
+// flight-recorder ring (oldest overwritten). A tracepoint marks the END of a
+// stage, so a stage's cost is its stamp minus the previous one. Recording is a
+// CCOUNT read and one 12-byte store (~10 cycles); build with -DFED4_TRACE=0 to
+// compile every tracepoint out. The ring and the Chrome trace exporter have no
+// Arduino deps — on a host the clock is steady_clock in ns.
+
+#ifndef FED4_TRACE
+#define FED4_TRACE 1
+#endif
+
+#if defined(ESP_PLATFORM)
+#include <esp_cpu.h>
+#else
+#include <chrono>
+#endif
+
+// X(id): one line per stage, in wake order. Names are the ids.
+#define FED4_TRACE_POINTS(X) \
+    X(SleepEnter)            \
+    X(Wake)                  \
+    X(WakeVcom)              \
+    X(WakeRails)             \
+    X(WakePhotogates)        \
+    X(WakeSpi)               \
+    X(WakeI2c)               \
+    X(WakeExpander)          \
+    X(WakeAmp)               \
+    X(WakeInterrupts)        \
+    X(WakePoke)              \
+    X(WakeButtons)           \
+    X(WakeDone)              \
+    X(LateRetrieval)         \
+    X(SensorBatch)           \
+    X(PokeLogged)            \
+    X(UpdateTime)            \
+    X(UpdatePhotogates)      \
+    X(UpdateLanes)           \
+    X(UpdateOutputs)         \
+    X(UpdateSensors)         \
+    X(UpdateEnergy)          \
+    X(UpdateDisplay)         \
+    X(UpdateSerial)          \
+    X(UpdateHublink)         \
+    X(Ready)
+
+#define FED4_TRACE_ENUM(name) name,
+enum class FedTracePoint : uint8_t
+{
+    FED4_TRACE_POINTS(FED4_TRACE_ENUM) Count
+};
+#undef FED4_TRACE_ENUM
+
+#define FED4_TRACE_NAME(name) #name,
+inline constexpr const char *kFedTraceNames[] = {FED4_TRACE_POINTS(FED4_TRACE_NAME)};
+#undef FED4_TRACE_NAME
+
+struct FedTraceEvent
+{
+    uint32_t cycles;
+    uint32_t arg; // Wake: esp_timer ms (timeline anchor); otherwise caller-defined
+    uint8_t id;
+};
+
+/** Overwrite-oldest ring; single writer (loop context). N must be a power of two. */
+template <uint32_t N>
+class FedTraceRing
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "FedTraceRing size must be a power of two");
+
+public:
+    void record(uint8_t id, uint32_t cycles, uint32_t arg)
+    {
+        FedTraceEvent &e = buf[head & (N - 1)];
+        e.cycles = cycles;
+        e.arg = arg;
+        e.id = id;
+        head++;
+    }
+    /** Events held (≤ N). */
+    uint32_t size() const { return head < N ? head : N; }
+    /** i-th held event, oldest first. */
+    const FedTraceEvent &at(uint32_t i) const { return buf[(head - size() + i) & (N - 1)]; }
+    uint32_t recorded() const { return head; }
+    void clear() { head = 0; }
+
+private:
+    FedTraceEvent buf[N] = {};
+    uint32_t head = 0;
+};
+
+inline uint32_t fed4TraceCycles()
+{
+#if defined(ESP_PLATFORM)
+    return esp_cpu_get_cycle_count();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+inline FedTraceRing<256> gFedTrace;
+
+inline void fed4Trace(FedTracePoint point, uint32_t arg = 0)
+{
+#if FED4_TRACE
+    gFedTrace.record((uint8_t)point, fed4TraceCycles(), arg);
+#else
+    (void)point;
+    (void)arg;
+#endif
+}
+
+/**
+ * Chrome trace JSON (chrome://tracing, ui.perfetto.dev): one complete event per
+ * stage, laid out on the esp_timer timeline via each Wake's ms anchor (the cycle
+ * counter stops in light sleep). put() receives consecutive string pieces.
+ */
+template <uint32_t N, typename Put>
+void fed4TraceChromeJson(const FedTraceRing<N> &ring, double cyclesPerUs, Put put)
+{
+    char line[160];
+    put("{\"traceEvents\":[\n");
+    double baseUs = 0;
+    uint32_t baseCycles = 0;
+    bool first = true;
+    for (uint32_t i = 0; i < ring.size(); i++)
+    {
+        const FedTraceEvent &e = ring.at(i);
+        if (e.id >= (uint8_t)FedTracePoint::Count)
+            continue;
+        if (e.id == (uint8_t)FedTracePoint::Wake || i == 0)
+        {
+            baseUs = e.id == (uint8_t)FedTracePoint::Wake ? (double)e.arg * 1000.0 : 0.0;
+            baseCycles = e.cycles;
+            continue;
+        }
+        const FedTraceEvent &prev = ring.at(i - 1);
+        if (prev.id == (uint8_t)FedTracePoint::SleepEnter)
+            continue; // the sleep itself has no cycle stamps
+        const double startUs = baseUs + (double)(uint32_t)(prev.cycles - baseCycles) / cyclesPerUs;
+        const double durUs = (double)(uint32_t)(e.cycles - prev.cycles) / cyclesPerUs;
+        snprintf(line, sizeof(line),
+                 "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.1f,\"dur\":%.1f,\"args\":{\"arg\":%lu}}",
+                 first ? "" : ",\n", kFedTraceNames[e.id], startUs, durUs, (unsigned long)e.arg);
+        put(line);
+        first = false;
+    }
+    put("\n]}\n");
+}
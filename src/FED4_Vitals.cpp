@@ -96,58 +96,6 @@ bool FED4::getAllBME680Data(float &temp, float &hum, float &pres, float &gas)
     return true;
 }
 
-float FED4::getLux()
-//this function now uses the persistent light sensor object instead of creating a temporary one
-{
-    float luxValue = 0.0;
-    
-    // Read the lux value from the persistent light sensor
-    luxValue = lightSensor.readLux();
-    
-    // Check for invalid readings
-    if (isnan(luxValue) || luxValue < 0) {
-        return -1.0; // Return -1 to indicate invalid reading
-    }
-    
-    return luxValue;
-}
-
-float FED4::getWhite()
-//this function reads the raw white light value from the VEML7700 sensor
-{
-    float whiteValue = 0.0;
-    
-    // Read the raw white light value from the persistent light sensor
-    whiteValue = lightSensor.readWhite();
-    
-    // Check for invalid readings
-    if (isnan(whiteValue) || whiteValue < 0) {
-        return -1.0; // Return -1 to indicate invalid reading
-    }
-    
-    return whiteValue;
-}
-
-bool FED4::initializeLightSensor()
-{
-    // Initialize the light sensor on the primary I2C bus
-    if (!lightSensor.begin(&Wire)) {
-        Serial.println("Light sensor initialization failed");
-        return false;
-    }
-    
-    // Configure the sensor for optimal reading with more robust settings
-    lightSensor.setGain(VEML7700_GAIN_2);  // Maximum gain for dark room sensitivity
-    lightSensor.setIntegrationTime(VEML7700_IT_800MS);  // Longest integration time for maximum sensitivity
-    lightSensor.powerSaveEnable(false);  // Disable power saving for maximum sensitivity
-    lightSensor.enable(true);
-    
-    // Add a small delay for configuration to take effect
-    delay(5);
-    
-    return true;
-}
-
 // optionally integrate MAX1704X flags:
 // https://learn.adafruit.com/adafruit-max17048-lipoly-liion-fuel-gauge-and-battery-monitor/arduino
 // https://github.com/adafruit/Adafruit_MAX1704X/blob/main/Adafruit_MAX1704X.cpp
@@ -167,10 +115,7 @@ void FED4::startupPollSensors(){
          if (getAllBME680Data(temp, hum, pres, gas) && temp > 5) break;  // Valid reading obtained
          delay(10);
      }
-     if (temp > 5) temperature = temp;
-     if (hum > 5) humidity = hum;
-     if (pres > 0) pressure = pres;
-     if (gas > 0) gasResistance = gas;
+     storeEnvironment(temp > 5 ? temp : -1, hum > 5 ? hum : -1, pres, gas, millis());
 
      //get battery info with timeout
      startTime = millis();
@@ -187,166 +132,121 @@ void FED4::startupPollSensors(){
      if (cellPercent > 100) {
          cellPercent = 100;
      }
+     storeBattery(cellVoltage, cellPercent);
 
-     //get lux with timeout
-     startTime = millis();
-     float luxReading = -1;
-     int luxAttempts = 0;
-     while (millis() - startTime < 100) {  // 0.1 second timeout
-         luxReading = getLux();
-         if (luxReading >= 0) break;  // Valid reading obtained (lux can be 0)
-         delay(10);
-         luxAttempts++;
-     }
-     
-     // If lux sensor failed after multiple attempts, try reinitializing it
-     if (luxReading < 0 && luxAttempts > 10) {  // More than 500ms of failed attempts
-       if (reinitializeLightSensor()) {
-         // Try one more reading after reinitialization
-         delay(20);  // Give sensor time to stabilize (reduced from 50ms)
-         luxReading = getLux();
-       }
-     }
-     
-     if (luxReading >= 0) lux = luxReading; // Only update if we got a valid reading >= 0
-     
-     //get white with timeout
-     startTime = millis();
-     float whiteReading = -1;
-     int whiteAttempts = 0;
-     while (millis() - startTime < 100) {  // 0.1 second timeout
-         whiteReading = getWhite();
-         if (whiteReading >= 0) break;  // Valid reading obtained (white can be 0)
-         delay(10);
-         whiteAttempts++;
-     }
-     
-     // If white sensor failed after multiple attempts, try reinitializing it
-     if (whiteReading < 0 && whiteAttempts > 10) {  // More than 500ms of failed attempts
-       if (reinitializeLightSensor()) {
-         // Try one more reading after reinitialization
-         delay(20);  // Give sensor time to stabilize
-         whiteReading = getWhite();
-       }
-     }
-     
-     if (whiteReading >= 0) white = whiteReading; // Only update if we got a valid reading >= 0
-    
+     refreshLight(); // auto-ranged, reinitializes the sensor if it does not answer
 }
 
 /**
- * Refresh BME/battery/lux for the status UI. Called from update().
+ * Refresh BME/battery/lux for the status UI, all now and blocking. update()
+ * leaves these to the poll scheduler (FED4_Sensors.cpp), which uses the same
+ * battery/light reads and the split-phase BME680 below.
  * Does not auto-log Status (avoids SD flood when update() runs after every feed).
  * PIR/prox left to motion()/prox() — not required for the program header.
  */
 void FED4::refreshSensors() {
   lastPollTime = millis();
+  refreshEnvironment();
+  refreshBattery();
+  refreshLight();
+  pollSensorsTimer = millis();
+}
 
-  unsigned long startTime = millis();
-  float temp = -1;
-  float hum = -1;
-  float pres = -1;
-  float gas = -1;
+/** BME680 temperature/humidity/pressure/gas now: one measurement, waited out. */
+void FED4::refreshEnvironment() {
+  startEnvironmentReading();
+  collectEnvironmentReading(true);
+}
 
-  while (millis() - startTime < 100) {
-    if (getAllBME680Data(temp, hum, pres, gas) && temp > 1) break;
-    delay(1);
-  }
-  if (temp > 1) temperature = temp;
-  if (hum > 1) humidity = hum;
-  if (pres > 0) pressure = pres;
-  if (gas > 0) gasResistance = gas;
+// ── Split-phase BME680 ───────────────────────────────────────────────────────
+// performReading() sits in delay() for the whole TPH + gas heater cycle. Here
+// beginReading() only writes the forced-mode command; the sensor measures on
+// its own while the wake logs the poke, redraws and prints, and endReading()
+// runs once remainingReadingMillis() is 0. A reading still heating at the end
+// of update() stays in the sensor's registers for the next wake.
 
-  startTime = millis();
-  while (millis() - startTime < 100) {
-    cellVoltage = getBatteryVoltage();
-    cellPercent = getBatteryPercentage();
-    if (cellVoltage > 0) break;
-    delay(1);
-  }
-  if (cellVoltage <= 0) {
-    Serial.println("Warning: Battery voltage reading failed or invalid during sensor refresh");
+void FED4::startEnvironmentReading(bool withGas) {
+  if (bmePending) {
+    return;
   }
-  if (cellPercent > 100) {
-    cellPercent = 100;
+  if (withGas != bmeHeaterOn) {
+    bme.setGasHeater(withGas ? 320 : 0, withGas ? 150 : 0); // 0/0 = TPH only, no heater cycle
+    bmeHeaterOn = withGas;
   }
-  if (cellVoltage > 0 && cellVoltage < 3.5) {
-    displayLowBatteryWarning();
-    Serial.println("LOW BATTERY: Device halted to protect battery.");
-    while (1) {
-      delay(1000);
-    }
+  const uint32_t readyMs = bme.beginReading();
+  if (readyMs == 0) {
+    return; // sensor missing or I2C error; keep the cached values
   }
+  bmePending = true;
+  bmeReadyMs = readyMs;
+  bmeStartWake = wakeCount;
+  bmeWithGas = withGas;
+}
 
-  startTime = millis();
-  float luxReading = -1;
-  int luxAttempts = 0;
-  while (millis() - startTime < 100) {
-    luxReading = getLux();
-    if (luxReading >= 0) break;
-    delay(1);
-    luxAttempts++;
+bool FED4::collectEnvironmentReading(bool wait) {
+  if (!bmePending) {
+    return false;
   }
-  if (luxReading < 0 && luxAttempts > 2) {
-    if (reinitializeLightSensor()) {
-      delay(1);
-      luxReading = getLux();
-    }
+  const int remaining = bme.remainingReadingMillis();
+  if (remaining < 0) {
+    bmePending = false; // a blocking getter already consumed it
+    restoreGasHeater();
+    return false;
+  }
+  if (remaining > 0 && !wait) {
+    return false;
+  }
+  bmePending = false;
+  if (wakeCount != bmeStartWake) {
+    environmentDeferred++;
+  }
+  const bool ok = bme.endReading();
+  restoreGasHeater();
+  if (!ok) {
+    return false;
   }
-  if (luxReading >= 0) {
-    lux = luxReading;
+  return storeEnvironment(bme.temperature, bme.humidity, bme.pressure / 100.0,
+                          bmeWithGas ? bme.gas_resistance / 1000.0 : -1.0, bmeReadyMs);
+}
+
+/**
+ * A TPH-only reading turned the heater off. Put the default 320 °C / 150 ms
+ * profile back so the blocking getters (getGasResistance(), performReading())
+ * still measure gas; startEnvironmentReading() turns it off again when needed.
+ */
+void FED4::restoreGasHeater() {
+  if (bmeHeaterOn) {
+    return;
   }
+  bme.setGasHeater(320, 150);
+  bmeHeaterOn = true;
+}
 
-  startTime = millis();
-  float whiteReading = -1;
-  int whiteAttempts = 0;
+/** MAX17048 voltage/SOC; halts below 3.5 V to protect the cell. */
+void FED4::refreshBattery() {
+  unsigned long startTime = millis();
+  float voltage = 0;
+  float percent = 0;
   while (millis() - startTime < 100) {
-    whiteReading = getWhite();
-    if (whiteReading >= 0) break;
+    voltage = getBatteryVoltage();
+    percent = getBatteryPercentage();
+    if (voltage > 0) break;
     delay(1);
-    whiteAttempts++;
   }
-  if (whiteReading < 0 && whiteAttempts > 2) {
-    if (reinitializeLightSensor()) {
-      delay(1);
-      whiteReading = getWhite();
-    }
+  if (voltage <= 0) {
+    Serial.println("Warning: Battery voltage reading failed or invalid during sensor refresh");
   }
-  if (whiteReading >= 0) {
-    white = whiteReading;
+  storeBattery(voltage, percent); // keeps the last good values on a failed read
+  if (voltage > 0 && voltage < 3.5) {
+    displayLowBatteryWarning();
+    Serial.println("LOW BATTERY: Device halted to protect battery.");
+    while (1) {
+      delay(1000);
+    }
   }
-
-  pollSensorsTimer = millis();
 }
 
 void FED4::pollSensors(int minToUpdateSensors) {
   (void)minToUpdateSensors;
   refreshSensors();
 }
-
-/**
- * Attempts to reinitialize the light sensor if it's not responding
- */
-bool FED4::reinitializeLightSensor() {
-    // First, try to reset the I2C bus
-    Wire.end();
-    delay(1);  // Give bus time to reset (reduced from 50ms)
-    Wire.begin(SDA, SCL);
-    delay(1);  // Give bus time to stabilize (reduced from 50ms)
-    
-    // Try to initialize the sensor
-    if (initializeLightSensor()) {
-        // Test multiple readings to ensure stability
-        for (int i = 0; i < 3; i++) {
-            float testReading = lightSensor.readLux();
-            if (testReading < 0) {
-                return false;
-            }
-            delay(1);
-        }
-        
-        return true;
-    } else {
-        return false;
-    }
-}
@@ -1,9912 +1,3790 @@
 // Auto-generated — do not edit by hand.
-// python3 sounds/gen_startup_sound.py <source.mp3|wav>
+// python3 scripts/gen-adpcm-clip.py <source.wav> --header src/sounds/startup_sound.h --name STARTUP
+// IMA-ADPCM, 48 kHz mono, Microsoft block layout (see src/FED4_Adpcm.h)
 
 #pragma once
 
 #include <Arduino.h>
 
-static const uint32_t STARTUP_PCM_RATE = 48000;
-static const size_t STARTUP_PCM_SAMPLES = 118800;
+static const uint32_t STARTUP_ADPCM_RATE = 48000;
+static const uint32_t STARTUP_ADPCM_SAMPLES = 118800;
+static const uint16_t STARTUP_ADPCM_BLOCK_ALIGN = 256;
 
-static const int16_t STARTUP_PCM[] PROGMEM = {
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0,
-  0, 0, 0, 0, 1, 2, 2, 2, 1, 1, 1, 1,
-  1, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, -1,
-  -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -2, -2, -2,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -2, -2, -2, -2, -1, -1, -1,
-  0, 1, 1, 1, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -2, -2, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -2, -2, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -2, -2, -2, -2, -2, -1, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, 0, 0, 0, 0, 0,
-  -1, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -2, -2,
-  -2, -2, -2, -2, -1, 0, 0, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  1, 1, 0, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -2, -2, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
-  -2, -2, -1, 0, 0, 0, -1, -2, -2, -2, -2, -2,
-  -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 1, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
-  -2, -2, -2, -2, -1, 0, 0, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 1,
-  1, 1, 1, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1,
-  1, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0,
-  0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 1, 1, 0, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -2, -2, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -2, -1, 0, 0, -1, -2, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, -1,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1,
-  0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 0, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -2, -1, 0, 0, -1, -1, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -2, -1, 1,
-  1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-  -1, -1, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 1, 1, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, 0, 0, -1,
-  -1, 0, 0, -1, -2, -2, -1, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, -2,
-  -1, -2, -2, -1, 1, 1, 0, -1, -1, 0, 0, -1,
-  -2, -2, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, 0, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  0, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1,
-  -1, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, -1, -2, -1, 0, 1, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -2, -2, -1, 0, -1, -2, -2, -1, -1, -1, -1,
-  0, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0, 1,
-  0, -2, -2, -1, 0, 0, 0, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, 0, 0, 0, -1, -1, 0, 1, 1,
-  0, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 1, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, -1, -2, -2, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, -1, -2, -1, -1, -2, -2, -1,
-  1, 1, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0,
-  -1, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 1, 1, 0, -2, -2, -1,
-  0, -1, -1, 0, 1, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 1, 1, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 1, 1, 1, 0, 0, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -2, -1, 0, 1, 1, 0, 0,
-  1, 1, 0, -1, -1, 1, 2, 1, 0, 0, 1, 1,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0, -1,
-  -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, -1,
-  -1, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0,
-  0, 1, 1, 0, -1, 0, 1, 1, 0, 0, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -2, -2,
-  -1, 1, 1, 0, -1, -1, 0, 0, -1, -2, -2, 0,
-  1, 1, 0, 0, 0, 0, -1, -2, -2, -2, -2, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -2, -1,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 0,
-  -1, -1, 0, -1, -2, -2, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -2, -2, 0, 1, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, 0, 1, 2, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, -1, -1, -2, -1, 0, 1, 1, 0,
-  0, 0, 0, -2, -3, -3, -1, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, 0,
-  -1, -2, -2, -1, 0, 0, -1, -1, 0, 1, 0, -1,
-  -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2,
-  -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1,
-  -2, -2, -1, 0, 0, -1, -1, 0, 0, -1, -2, -3,
-  -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 1, 0, -1, -2, -1, 0, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -2, -1, 0, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, -1, -2, -2, -1, 0, 0, 0,
-  1, 1, 1, 1, 0, -1, -2, -2, -2, -1, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 1, 1, 1,
-  0, -1, -2, -2, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 1, 1, 1, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 1, 1, 0, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, 0, 1,
-  1, 0, 0, 0, 1, 2, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 1, 1, 0,
-  -1, -2, -1, 0, 0, -1, -1, 0, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  0, -1, -2, -1, 0, 0, -1, -2, -1, 0, 1, 0,
-  -1, -1, 0, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 1, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, -1, 0, 1, 1, 0, 0,
-  0, 0, -1, -2, -2, -1, 1, 1, 0, -1, -1, -1,
-  -1, -2, -2, -1, 0, 0, -1, -2, -1, 0, 0, -1,
-  -2, -1, 0, 0, -1, -2, -2, -2, -1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -2,
-  -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -2,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 0, -1, -1, 0, 0, -1, -2,
-  -2, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -2, -2, -2, -2, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -2, -2, -1, -1, -2, -2, -1, 0, 1,
-  1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1,
-  0, -1, -1, 0, 1, 1, -1, -2, -1, 0, 0, -1,
-  -2, -1, 0, 0, 0, 0, 1, 1, 0, -1, -2, -1,
-  -1, -1, -1, 0, 1, 0, -1, -2, -1, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, -1,
-  -1, 0, 1, 1, 0, -2, -2, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -2, -3, -2, 0, 1, 1, 0, -1, -1, -1,
-  0, 1, 1, 0, -1, -2, -1, 0, 0, -1, -2, -1,
-  0, 1, 0, -1, -1, 0, 0, 0, 0, 1, 1, 0,
-  -1, -2, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, 0, 0, -1, -2, -2, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1,
-  1, 2, 1, 0, 0, 1, 1, 0, -1, 0, 1, 2,
-  1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, 0, 1, 0, -1,
-  -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 1, 0, -1, -2, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2,
-  -2, -1, 0, -1, -2, -1, 0, 1, 0, -1, -1, 0,
-  0, -1, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  0, 0, -1, -2, -3, -2, 0, 1, 1, 0, -1, -2,
-  -2, -2, -2, -2, -1, 0, 0, 0, 0, 1, 1, 0,
-  -1, -1, -1, -1, -1, -2, -2, -1, 0, 1, 0, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, -1, -2, -2, 0,
-  0, -1, -2, -1, 1, 1, 0, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -1, 0, 1, 1, 1, 1, 1,
-  0, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2,
-  2, 1, 1, 1, 1, 0, -1, 0, 1, 2, 1, 0,
-  0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, 0, 1, 0, -1,
-  -2, -2, -1, -1, -2, -2, -1, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, 0, 1, 0, -2, -3, -3, -1, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2,
-  -1, 0, 0, 0, -1, -1, 0, 1, 0, -1, -1, -1,
-  -1, -2, -2, -1, 0, 0, 0, -1, -1, -1, -2, -3,
-  -3, -1, 1, 1, 0, -1, -1, -1, -1, 0, 1, 1,
-  0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  1, 1, 0, 0, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 1, 2, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 1, 2, 1, 0, -1, 0,
-  1, 1, 1, 1, 1, 0, -1, -2, -1, 1, 2, 2,
-  1, 0, -1, -1, 0, 1, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, -1, -1, 0, 1, 2, 2, 1, 0, -1,
-  -1, -1, -2, -2, -1, 0, 0, -1, -1, -1, -1, -2,
-  -2, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 1, 0, -1, -1, -1, -2, -2,
-  -1, 0, 0, -1, -1, 0, 1, 0, -1, -1, 0, 1,
-  0, -1, -1, 0, 0, -1, -2, -1, 0, 1, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -2, -2, -1, 0, 1,
-  0, -1, -2, -2, -1, 0, 0, 0, -1, -2, -2, -1,
-  0, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 0, 0,
-  0, 0, 0, -1, 0, 1, 1, 0, -1, 0, 1, 1,
-  0, -1, -1, 0, 1, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, -1, -2, -1, 0, 1, 1, 1, 1, 1, 0,
-  -1, -2, -2, -2, -1, 0, 0, 0, -1, -1, 0, 1,
-  2, 1, -1, -2, -2, 0, 1, 1, 1, 1, 0, -1,
-  -1, 0, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, -1, -2, -1, 0, 1, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 1, 0, 0, -1, -1, -1, 0, 1, 1, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, -1, -2, -2, -1, 0, 1, 1, 0, -1, -1,
-  -1, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 1, 0, -1, -1, 0, 1, 0,
-  -1, 0, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -2, -1, 0, 0, -1, -2, -2, 0, 1, 1,
-  0, -1, -2, -2, -2, -1, 0, 0, -1, -1, 0, 0,
-  -1, -1, 0, 1, 1, 1, 0, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, 0, 1, 1, 1,
-  0, -1, -1, -1, 0, 1, 1, 0, 0, 1, 2, 2,
-  1, 1, 0, -1, -2, -1, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, 0, 1, 2, 1, 0, 0, 0, 0, -1,
-  -1, -1, -1, 0, 0, 0, 0, 1, 0, -2, -2, 0,
-  2, 1, -1, -2, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 2, 2, 1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1,
-  0, -1, -1, -2, -2, -2, -1, 0, 0, -1, -1, 0,
-  1, 0, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1,
-  1, 1, 0, -2, -3, -2, 0, 0, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -2, -3, -2, 0,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -2,
-  -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2,
-  -3, -2, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0,
-  0, -1, -2, -1, -1, -2, -2, -1, 0, -1, -2, -2,
-  -1, 0, -1, -2, -3, -2, -1, 0, 0, 0, 0, -2,
-  -3, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -2, -3, -3, -1, 1, 1, 0,
-  0, 0, 0, -1, -2, -2, -1, -1, -2, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, -1, -1, 0, 1, 1, -1, -2,
-  -2, 0, 1, 1, 0, -1, -1, 0, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0,
-  0, 1, 2, 1, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1,
-  0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1, -1,
-  -2, -2, -2, -2, -1, -1, -1, -2, -3, -2, 0, 1,
-  0, -1, -2, -2, -1, 2, 3, 2, -1, -2, -2, -1,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, -1, -2, -1, 0, 1, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 2, 3, 2, 0, -2, -2, -1, 1, 2,
-  1, 0, 1, 2, 2, 1, 0, 1, 2, 2, 1, -1,
-  -2, -1, 1, 1, 0, -1, -1, -1, 0, 1, 2, 2,
-  1, 0, 0, 0, -1, -1, -1, 1, 2, 2, 1, 0,
-  1, 2, 2, 2, 1, 1, 1, 2, 1, 0, -1, 0,
-  1, 0, -1, -1, 0, 1, 2, 1, 0, -1, 0, 1,
-  1, 0, -1, -3, -3, -2, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -2, -2, -1, -1, -1, -2, -3, -3, -3,
-  -2, -2, -2, -1, -1, -1, -2, -2, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 1, 1, 0, 0, 0, 1, 1, 1, 2, 2, 2,
-  1, 1, 1, 1, 1, 1, 0, 0, 1, 2, 2, 1,
-  1, 1, 2, 2, 1, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, 0, 1, 0, -1, -1, -1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 1, 1, 1, 1, 2, 2, 2, 1, 0, -1,
-  0, 1, 1, 0, -1, -1, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, 1, 1, 0, -1, -1, -1, -1, 0, 1,
-  1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -2, -1, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -2, -2, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -2, -3, -2, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, -2, -3, -2, 0, 1, 1,
-  0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -2, -2,
-  -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -2, -2, -2, -1, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 1, 1, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1,
-  0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1, -2,
-  -3, -2, -1, 0, -1, -2, -2, -2, -1, 0, -1, -2,
-  -2, 0, 1, 0, -1, -2, -2, -2, -2, -2, -2, -1,
-  0, 0, -1, -1, -1, -1, -2, -2, -2, -3, -3, -2,
-  -1, -1, -1, -2, -2, -2, -2, -1, -1, -1, -2, -2,
-  -2, -2, -2, -2, -2, -2, -2, -3, -3, -3, -2, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 1, 1, 0, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 1, 2,
-  2, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1,
-  -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, -1, -2, -2, -1, -1, -1, -1, -1, -2, -3, -2,
-  -1, 0, -1, -2, -2, -2, -1, -1, -1, -2, -2, -2,
-  -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, -2, -3,
-  -3, -2, 0, 0, -1, -2, -2, -1, 0, 0, -1, -2,
-  -2, -1, -1, -1, -2, -2, -1, 0, 1, 1, 0, -1,
-  -1, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, 0, 1, 2, 1, 0, -1, -1, -1, 0,
-  0, -1, -2, -1, 1, 1, -1, -2, -2, -2, -2, -1,
-  0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -2, -2, -2, -2, -1, -1, -1, -2, -2, -1, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, -2, -2, -2, -1, 0, 1, 2, 2,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 1, 1, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -2, -2, -2,
-  -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -2, -2, -2, -2, -2, -2, -2,
-  -1, -1, -1, -1, -2, -3, -3, -3, -3, -3, -3, -3,
-  -3, -3, -3, -3, -4, -5, -5, -5, -4, -4, -4, -4,
-  -4, -4, -5, -6, -6, -6, -5, -5, -5, -5, -5, -4,
-  -3, -3, -4, -4, -3, -3, -3, -3, -3, -2, -2, -2,
-  -3, -3, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 2, 3, 3, 3, 2, 2,
-  2, 2, 1, 0, 1, 3, 4, 4, 3, 3, 4, 4,
-  3, 1, 1, 2, 3, 3, 2, 2, 3, 3, 3, 2,
-  2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4, 4,
-  3, 3, 2, 1, 1, 2, 2, 2, 1, 1, 1, 1,
-  1, 0, -1, -1, -1, -1, -2, -2, -2, -2, -3, -3,
-  -3, -3, -3, -3, -3, -3, -3, -3, -2, -1, -1, -1,
-  -2, -2, -1, 0, 1, 1, 0, -2, -2, 0, 1, 0,
-  -1, -1, 1, 3, 3, 2, 2, 3, 3, 2, 1, 2,
-  3, 4, 3, 2, 2, 2, 3, 3, 3, 3, 4, 6,
-  7, 6, 5, 5, 6, 7, 6, 4, 3, 6, 9, 10,
-  8, 6, 6, 7, 8, 7, 5, 5, 5, 5, 4, 3,
-  3, 3, 3, 3, 2, 2, 2, 3, 4, 4, 3, 3,
-  3, 3, 3, 2, 2, 2, 2, 1, -1, -1, 1, 2,
-  2, 0, -1, 0, 1, 1, 0, -2, -3, -3, -3, -2,
-  -2, -2, -2, -2, -3, -3, -3, -3, -3, -4, -5, -5,
-  -5, -5, -5, -6, -7, -8, -8, -8, -7, -7, -8, -9,
-  -10, -10, -9, -9, -10, -11, -11, -11, -11, -11, -11, -11,
-  -12, -12, -12, -11, -11, -12, -13, -13, -13, -13, -13, -12,
-  -11, -12, -13, -13, -11, -10, -11, -14, -14, -11, -8, -8,
-  -11, -12, -9, -6, -6, -8, -8, -6, -3, -3, -4, -4,
-  -3, -2, -2, -3, -3, -2, -1, -1, -1, -1, -1, 0,
-  0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  2, 3, 3, 2, 2, 2, 2, 1, 1, 3, 4, 4,
-  2, 2, 3, 5, 4, 2, 1, 3, 5, 6, 5, 5,
-  6, 6, 5, 4, 5, 7, 8, 8, 8, 9, 10, 11,
-  11, 12, 13, 13, 12, 12, 13, 14, 15, 15, 15, 15,
-  15, 16, 17, 18, 19, 18, 17, 16, 17, 18, 19, 19,
-  18, 16, 16, 18, 19, 18, 15, 12, 12, 13, 14, 13,
-  11, 11, 11, 10, 9, 8, 7, 6, 5, 5, 5, 4,
-  1, -1, -2, -2, -2, -4, -7, -8, -8, -8, -9, -12,
-  -14, -16, -18, -20, -20, -19, -19, -21, -24, -26, -25, -23,
-  -23, -26, -29, -29, -28, -28, -29, -30, -30, -30, -30, -31,
-  -31, -30, -29, -30, -32, -32, -31, -30, -32, -34, -34, -31,
-  -30, -32, -35, -35, -32, -29, -29, -32, -34, -33, -32, -32,
-  -33, -33, -33, -33, -34, -34, -32, -31, -31, -32, -33, -32,
-  -31, -31, -32, -32, -30, -28, -28, -28, -29, -29, -27, -25,
-  -25, -26, -26, -25, -24, -25, -26, -26, -25, -23, -23, -24,
-  -24, -22, -21, -22, -23, -22, -20, -19, -20, -21, -20, -18,
-  -17, -17, -17, -16, -14, -11, -10, -10, -9, -8, -7, -6,
-  -6, -6, -5, -4, -4, -3, 0, 4, 6, 5, 4, 6,
-  10, 13, 14, 13, 14, 18, 21, 22, 21, 22, 24, 26,
-  27, 29, 32, 33, 33, 33, 35, 38, 40, 41, 41, 42,
-  43, 43, 43, 43, 45, 47, 49, 51, 53, 55, 55, 54,
-  55, 58, 60, 61, 60, 61, 64, 66, 66, 64, 63, 66,
-  70, 72, 70, 68, 69, 72, 73, 72, 69, 68, 68, 68,
-  67, 65, 63, 62, 61, 59, 58, 58, 58, 56, 52, 50,
-  51, 52, 50, 44, 38, 37, 38, 37, 32, 26, 22, 21,
-  20, 17, 13, 9, 7, 4, 0, -4, -7, -10, -15, -21,
-  -26, -28, -28, -29, -34, -40, -44, -45, -47, -53, -58, -59,
-  -59, -62, -71, -79, -81, -79, -81, -89, -95, -94, -89, -89,
-  -96, -102, -102, -98, -96, -99, -104, -104, -101, -98, -98, -99,
-  -99, -99, -99, -98, -97, -95, -92, -90, -88, -87, -85, -83,
-  -81, -81, -80, -77, -72, -67, -64, -63, -62, -59, -53, -48,
-  -46, -44, -38, -30, -23, -19, -18, -16, -11, -4, 1, 4,
-  8, 13, 17, 20, 23, 28, 33, 36, 38, 40, 43, 47,
-  50, 52, 53, 55, 59, 62, 64, 66, 66, 69, 73, 75,
-  75, 73, 73, 74, 77, 78, 78, 80, 84, 87, 88, 87,
-  86, 86, 88, 89, 91, 90, 88, 88, 91, 93, 92, 89,
-  87, 90, 94, 95, 91, 87, 88, 91, 92, 91, 89, 89,
-  90, 90, 89, 90, 93, 93, 90, 87, 87, 90, 93, 93,
-  89, 86, 86, 89, 89, 85, 82, 82, 82, 80, 77, 74,
-  73, 71, 65, 58, 53, 51, 48, 42, 35, 31, 29, 24,
-  14, 5, -1, -4, -9, -16, -24, -32, -41, -50, -59, -67,
-  -75, -85, -96, -103, -104, -109, -121, -137, -148, -151, -154, -164,
-  -177, -186, -191, -198, -210, -224, -235, -244, -254, -264, -268, -271,
-  -279, -294, -309, -318, -322, -326, -334, -344, -352, -359, -368, -376,
-  -382, -387, -396, -407, -414, -413, -409, -413, -424, -433, -432, -428,
-  -430, -440, -449, -448, -439, -432, -434, -440, -444, -441, -433, -426,
-  -424, -426, -428, -427, -420, -409, -403, -404, -410, -414, -408, -395,
-  -384, -381, -384, -383, -373, -360, -352, -349, -346, -338, -328, -319,
-  -310, -299, -288, -278, -269, -256, -239, -221, -206, -193, -176, -154,
-  -134, -120, -107, -89, -68, -48, -29, -7, 16, 38, 55, 75,
-  101, 130, 152, 170, 191, 219, 250, 276, 297, 320, 347, 375,
-  402, 429, 458, 485, 509, 531, 558, 590, 621, 646, 671, 698,
-  727, 751, 771, 794, 824, 857, 885, 907, 930, 958, 988, 1016,
-  1038, 1062, 1090, 1122, 1158, 1195, 1231, 1263, 1292, 1323, 1359, 1398,
-  1432, 1456, 1473, 1491, 1512, 1537, 1561, 1577, 1584, 1584, 1589, 1603,
-  1618, 1620, 1604, 1585, 1577, 1579, 1573, 1550, 1518, 1489, 1464, 1435,
-  1401, 1366, 1331, 1293, 1248, 1203, 1165, 1128, 1081, 1019, 955, 900,
-  852, 795, 723, 647, 577, 514, 448, 373, 297, 225, 154, 80,
-  3, -73, -147, -224, -302, -376, -443, -510, -581, -653, -719, -775,
-  -832, -899, -972, -1037, -1087, -1128, -1172, -1222, -1275, -1327, -1373, -1409,
-  -1438, -1467, -1502, -1540, -1567, -1577, -1580, -1593, -1622, -1652, -1671, -1678,
-  -1682, -1689, -1697, -1703, -1709, -1714, -1713, -1709, -1710, -1717, -1725, -1720,
-  -1706, -1698, -1702, -1708, -1703, -1688, -1679, -1682, -1686, -1675, -1655, -1642,
-  -1642, -1644, -1636, -1620, -1607, -1603, -1603, -1599, -1590, -1581, -1573, -1566,
-  -1559, -1555, -1552, -1547, -1537, -1528, -1524, -1525, -1524, -1517, -1508, -1502,
-  -1499, -1494, -1482, -1464, -1449, -1439, -1430, -1413, -1385, -1353, -1326, -1308,
-  -1293, -1272, -1238, -1197, -1161, -1134, -1110, -1079, -1038, -991, -948, -913,
-  -883, -848, -804, -750, -693, -641, -594, -546, -491, -430, -368, -313,
-  -260, -202, -135, -65, 2, 65, 128, 194, 265, 337, 410, 483,
-  557, 633, 713, 794, 872, 947, 1023, 1104, 1187, 1264, 1336, 1409,
-  1490, 1579, 1669, 1757, 1844, 1934, 2026, 2122, 2223, 2325, 2418, 2502,
-  2586, 2681, 2784, 2877, 2949, 3011, 3080, 3162, 3246, 3318, 3376, 3427,
-  3478, 3525, 3568, 3602, 3620, 3620, 3609, 3605, 3614, 3624, 3613, 3577,
-  3532, 3499, 3478, 3457, 3421, 3365, 3294, 3221, 3160, 3113, 3061, 2982,
-  2873, 2759, 2663, 2586, 2508, 2409, 2294, 2178, 2074, 1979, 1883, 1773,
-  1647, 1507, 1370, 1245, 1129, 1006, 871, 733, 603, 484, 366, 245,
-  125, 13, -95, -205, -312, -407, -490, -568, -646, -723, -796, -863,
-  -926, -984, -1033, -1079, -1125, -1172, -1211, -1238, -1258, -1279, -1305, -1330,
-  -1349, -1361, -1371, -1382, -1393, -1403, -1410, -1410, -1406, -1408, -1420, -1437,
-  -1448, -1449, -1449, -1459, -1478, -1493, -1498, -1499, -1504, -1513, -1519, -1521,
-  -1528, -1544, -1563, -1575, -1579, -1584, -1597, -1617, -1635, -1646, -1652, -1660,
-  -1674, -1693, -1711, -1720, -1723, -1729, -1742, -1759, -1774, -1785, -1796, -1808,
-  -1819, -1827, -1836, -1851, -1869, -1880, -1883, -1885, -1895, -1912, -1925, -1931,
-  -1937, -1948, -1962, -1968, -1963, -1955, -1953, -1955, -1953, -1943, -1927, -1912,
-  -1899, -1889, -1878, -1863, -1843, -1822, -1802, -1786, -1769, -1747, -1718, -1685,
-  -1652, -1624, -1598, -1570, -1538, -1503, -1468, -1433, -1401, -1369, -1335, -1297,
-  -1254, -1209, -1169, -1136, -1101, -1055, -996, -935, -884, -841, -793, -733,
-  -668, -610, -558, -505, -444, -379, -315, -251, -183, -111, -44, 16,
-  77, 145, 217, 287, 354, 420, 489, 562, 638, 717, 798, 873,
-  943, 1013, 1092, 1178, 1262, 1336, 1405, 1477, 1556, 1637, 1715, 1788,
-  1861, 1938, 2018, 2100, 2182, 2262, 2336, 2404, 2469, 2534, 2601, 2665,
-  2724, 2779, 2834, 2890, 2947, 3000, 3049, 3093, 3134, 3173, 3205, 3233,
-  3264, 3300, 3335, 3358, 3367, 3367, 3371, 3384, 3400, 3413, 3416, 3408,
-  3392, 3372, 3350, 3324, 3284, 3227, 3159, 3089, 3020, 2950, 2877, 2798,
-  2711, 2616, 2514, 2413, 2316, 2220, 2117, 2002, 1879, 1757, 1638, 1523,
-  1404, 1275, 1138, 1001, 875, 761, 653, 540, 418, 296, 180, 69,
-  -43, -161, -281, -400, -516, -629, -740, -847, -950, -1050, -1148, -1243,
-  -1337, -1428, -1515, -1594, -1664, -1732, -1800, -1864, -1919, -1964, -2004, -2043,
-  -2083, -2118, -2147, -2171, -2187, -2193, -2194, -2196, -2203, -2205, -2196, -2179,
-  -2161, -2146, -2129, -2104, -2075, -2047, -2019, -1988, -1955, -1923, -1896, -1869,
-  -1841, -1815, -1792, -1770, -1744, -1716, -1693, -1675, -1656, -1633, -1611, -1595,
-  -1583, -1568, -1551, -1538, -1532, -1525, -1508, -1488, -1476, -1476, -1477, -1468,
-  -1452, -1441, -1441, -1444, -1441, -1434, -1431, -1434, -1438, -1442, -1448, -1459,
-  -1470, -1477, -1480, -1483, -1489, -1498, -1510, -1524, -1536, -1546, -1553, -1560,
-  -1569, -1575, -1578, -1579, -1579, -1578, -1573, -1564, -1556, -1549, -1539, -1524,
-  -1507, -1492, -1480, -1466, -1448, -1429, -1412, -1394, -1368, -1338, -1309, -1281,
-  -1251, -1213, -1171, -1129, -1089, -1046, -1000, -952, -905, -857, -806, -752,
-  -700, -651, -601, -545, -482, -419, -359, -301, -244, -183, -117, -48,
-  21, 86, 146, 202, 260, 325, 395, 465, 531, 594, 658, 726,
-  794, 860, 924, 990, 1059, 1128, 1192, 1255, 1324, 1396, 1464, 1523,
-  1579, 1640, 1704, 1766, 1826, 1887, 1949, 2009, 2063, 2119, 2182, 2247,
-  2301, 2345, 2392, 2455, 2528, 2592, 2640, 2682, 2729, 2781, 2830, 2875,
-  2924, 2977, 3028, 3075, 3121, 3172, 3225, 3272, 3310, 3345, 3385, 3424,
-  3460, 3494, 3531, 3570, 3605, 3631, 3652, 3674, 3692, 3699, 3689, 3663,
-  3628, 3589, 3545, 3496, 3439, 3376, 3306, 3232, 3156, 3076, 2990, 2900,
-  2807, 2710, 2606, 2497, 2386, 2277, 2166, 2046, 1918, 1789, 1666, 1548,
-  1430, 1309, 1186, 1061, 934, 807, 683, 564, 445, 314, 169, 21,
-  -113, -234, -356, -488, -625, -754, -873, -986, -1101, -1213, -1320, -1424,
-  -1527, -1621, -1699, -1764, -1827, -1895, -1961, -2017, -2062, -2105, -2148, -2183,
-  -2208, -2229, -2252, -2272, -2275, -2264, -2253, -2250, -2251, -2242, -2220, -2192,
-  -2166, -2143, -2117, -2088, -2056, -2023, -1990, -1959, -1932, -1907, -1877, -1840,
-  -1806, -1779, -1759, -1737, -1709, -1681, -1660, -1648, -1642, -1637, -1626, -1610,
-  -1593, -1585, -1588, -1592, -1586, -1572, -1562, -1564, -1574, -1581, -1579, -1578,
-  -1582, -1588, -1593, -1597, -1604, -1613, -1619, -1625, -1636, -1653, -1669, -1677,
-  -1681, -1688, -1702, -1719, -1732, -1745, -1762, -1782, -1800, -1815, -1828, -1842,
-  -1856, -1867, -1879, -1893, -1907, -1916, -1922, -1925, -1925, -1918, -1904, -1889,
-  -1878, -1868, -1856, -1838, -1818, -1797, -1774, -1751, -1730, -1708, -1678, -1639,
-  -1600, -1568, -1542, -1509, -1463, -1409, -1356, -1306, -1258, -1208, -1156, -1100,
-  -1039, -978, -924, -874, -817, -748, -677, -616, -561, -496, -416, -336,
-  -270, -213, -150, -75, -2, 64, 129, 205, 283, 348, 403, 464,
-  540, 619, 686, 742, 803, 872, 944, 1014, 1085, 1161, 1235, 1301,
-  1371, 1462, 1569, 1665, 1734, 1788, 1857, 1950, 2050, 2138, 2213, 2286,
-  2364, 2447, 2533, 2622, 2710, 2788, 2852, 2914, 2992, 3085, 3178, 3257,
-  3322, 3388, 3469, 3562, 3652, 3726, 3785, 3847, 3923, 4004, 4069, 4109,
-  4135, 4165, 4195, 4213, 4213, 4207, 4204, 4199, 4177, 4140, 4100, 4061,
-  4012, 3945, 3869, 3798, 3729, 3647, 3547, 3440, 3339, 3237, 3124, 2998,
-  2871, 2752, 2634, 2508, 2372, 2234, 2096, 1955, 1809, 1658, 1504, 1349,
-  1196, 1048, 902, 750, 589, 424, 265, 113, -37, -188, -336, -480,
-  -620, -757, -888, -1011, -1127, -1242, -1356, -1461, -1553, -1640, -1726, -1812,
-  -1887, -1949, -2005, -2057, -2102, -2136, -2165, -2196, -2225, -2243, -2247, -2249,
-  -2261, -2274, -2271, -2249, -2221, -2205, -2196, -2181, -2154, -2123, -2094, -2067,
-  -2036, -2003, -1969, -1929, -1882, -1834, -1798, -1773, -1746, -1708, -1665, -1630,
-  -1602, -1571, -1533, -1498, -1479, -1471, -1461, -1440, -1419, -1409, -1407, -1404,
-  -1396, -1390, -1396, -1406, -1409, -1402, -1399, -1416, -1446, -1471, -1482, -1491,
-  -1514, -1552, -1590, -1620, -1643, -1668, -1694, -1721, -1757, -1806, -1856, -1885,
-  -1889, -1896, -1932, -1988, -2030, -2044, -2050, -2074, -2115, -2153, -2176, -2187,
-  -2191, -2188, -2184, -2194, -2221, -2240, -2225, -2186, -2160, -2166, -2177, -2160,
-  -2120, -2094, -2099, -2104, -2074, -2018, -1972, -1949, -1922, -1869, -1802, -1747,
-  -1702, -1647, -1575, -1507, -1455, -1406, -1337, -1254, -1180, -1124, -1065, -987,
-  -900, -823, -755, -681, -597, -514, -443, -374, -296, -213, -140, -76,
-  -7, 74, 158, 239, 323, 418, 517, 603, 673, 748, 841, 942,
-  1033, 1114, 1202, 1306, 1413, 1507, 1590, 1682, 1789, 1897, 1994, 2090,
-  2202, 2329, 2452, 2558, 2655, 2756, 2863, 2974, 3093, 3224, 3356, 3471,
-  3572, 3682, 3821, 3971, 4099, 4197, 4284, 4377, 4467, 4536, 4587, 4635,
-  4683, 4717, 4734, 4747, 4767, 4784, 4779, 4753, 4721, 4690, 4649, 4592,
-  4520, 4440, 4347, 4243, 4141, 4055, 3973, 3867, 3729, 3580, 3445, 3324,
-  3195, 3048, 2892, 2740, 2588, 2432, 2276, 2121, 1963, 1795, 1624, 1461,
-  1304, 1138, 955, 773, 611, 466, 314, 145, -25, -176, -305, -435,
-  -577, -722, -847, -947, -1036, -1135, -1246, -1353, -1442, -1512, -1577, -1649,
-  -1732, -1810, -1866, -1891, -1895, -1905, -1938, -1989, -2025, -2024, -1997, -1978,
-  -1993, -2027, -2042, -2018, -1971, -1936, -1933, -1947, -1950, -1923, -1876, -1833,
-  -1808, -1798, -1779, -1736, -1679, -1632, -1610, -1604, -1592, -1565, -1531, -1500,
-  -1474, -1448, -1422, -1398, -1374, -1343, -1306, -1276, -1261, -1257, -1256, -1260,
-  -1275, -1289, -1286, -1270, -1267, -1297, -1340, -1364, -1360, -1364, -1403, -1468,
-  -1525, -1560, -1586, -1620, -1664, -1711, -1769, -1839, -1905, -1946, -1966, -1996,
-  -2052, -2113, -2149, -2161, -2175, -2207, -2248, -2282, -2310, -2335, -2351, -2357,
-  -2366, -2391, -2423, -2439, -2436, -2439, -2464, -2496, -2506, -2490, -2475, -2482,
-  -2500, -2500, -2476, -2443, -2415, -2389, -2356, -2314, -2266, -2215, -2163, -2117,
-  -2077, -2030, -1964, -1884, -1809, -1753, -1709, -1655, -1581, -1494, -1410, -1338,
-  -1276, -1212, -1136, -1049, -966, -899, -850, -799, -732, -653, -577, -508,
-  -433, -339, -232, -133, -55, 15, 96, 196, 300, 393, 475, 560,
-  663, 783, 911, 1035, 1154, 1265, 1374, 1488, 1615, 1753, 1892, 2024,
-  2159, 2312, 2482, 2646, 2785, 2913, 3061, 3243, 3433, 3600, 3751, 3916,
-  4108, 4297, 4448, 4560, 4661, 4767, 4872, 4967, 5060, 5158, 5246, 5309,
-  5358, 5417, 5487, 5527, 5514, 5468, 5438, 5435, 5431, 5398, 5340, 5274,
-  5198, 5104, 5003, 4911, 4818, 4698, 4543, 4382, 4247, 4127, 3991, 3827,
-  3651, 3470, 3274, 3058, 2844, 2652, 2469, 2265, 2033, 1799, 1583, 1375,
-  1159, 940, 732, 529, 311, 83, -124, -295, -457, -641, -833, -993,
-  -1110, -1223, -1369, -1531, -1666, -1764, -1856, -1971, -2092, -2192, -2264, -2323,
-  -2373, -2405, -2429, -2471, -2532, -2573, -2562, -2524, -2514, -2548, -2580, -2564,
-  -2506, -2451, -2419, -2395, -2362, -2320, -2273, -2208, -2121, -2037, -1979, -1936,
-  -1868, -1761, -1650, -1572, -1524, -1472, -1396, -1311, -1236, -1174, -1118, -1068,
-  -1023, -972, -911, -857, -831, -832, -834, -821, -805, -806, -821, -836,
-  -845, -856, -873, -886, -894, -914, -962, -1026, -1084, -1134, -1197, -1276,
-  -1345, -1386, -1421, -1484, -1570, -1639, -1675, -1713, -1792, -1901, -1989, -2039,
-  -2085, -2163, -2264, -2354, -2427, -2507, -2602, -2686, -2743, -2792, -2861, -2942,
-  -3002, -3034, -3063, -3116, -3177, -3215, -3223, -3224, -3238, -3254, -3253, -3236,
-  -3217, -3202, -3180, -3142, -3092, -3040, -2993, -2950, -2907, -2856, -2789, -2707,
-  -2623, -2552, -2493, -2429, -2346, -2249, -2159, -2086, -2025, -1962, -1890, -1807,
-  -1713, -1607, -1493, -1381, -1279, -1177, -1056, -916, -781, -675, -594, -507,
-  -395, -263, -128, 12, 162, 315, 455, 582, 719, 884, 1064, 1230,
-  1376, 1522, 1691, 1885, 2088, 2284, 2469, 2646, 2835, 3058, 3322, 3609,
-  3891, 4160, 4423, 4679, 4906, 5096, 5266, 5440, 5612, 5769, 5920, 6098,
-  6311, 6515, 6661, 6759, 6858, 6970, 7045, 7043, 6997, 6984, 7025, 7062,
-  7032, 6946, 6859, 6793, 6712, 6581, 6418, 6261, 6112, 5937, 5726, 5515,
-  5335, 5160, 4927, 4619, 4292, 4008, 3766, 3511, 3206, 2881, 2588, 2339,
-  2093, 1817, 1518, 1221, 928, 621, 296, -21, -308, -567, -815, -1058,
-  -1285, -1486, -1668, -1842, -2008, -2165, -2325, -2497, -2673, -2828, -2950, -3049,
-  -3141, -3225, -3289, -3337, -3384, -3437, -3476, -3488, -3487, -3498, -3518, -3521,
-  -3492, -3449, -3415, -3385, -3335, -3265, -3204, -3167, -3128, -3049, -2927, -2798,
-  -2688, -2592, -2483, -2349, -2204, -2064, -1939, -1831, -1733, -1634, -1516, -1372,
-  -1213, -1057, -913, -782, -659, -541, -431, -339, -277, -240, -201, -140,
-  -66, -8, 26, 52, 86, 112, 103, 64, 25, -2, -47, -129,
-  -228, -299, -345, -412, -532, -680, -809, -908, -1005, -1119, -1241, -1363,
-  -1489, -1627, -1760, -1877, -1993, -2136, -2308, -2478, -2616, -2721, -2816, -2916,
-  -3029, -3147, -3256, -3340, -3405, -3478, -3570, -3661, -3730, -3789, -3861, -3938,
-  -3980, -3977, -3975, -4011, -4051, -4039, -3984, -3952, -3965, -3968, -3912, -3834,
-  -3794, -3775, -3708, -3581, -3464, -3405, -3357, -3260, -3137, -3052, -2994, -2882,
-  -2703, -2543, -2467, -2417, -2294, -2104, -1941, -1846, -1752, -1595, -1402, -1236,
-  -1093, -925, -735, -571, -445, -308, -126, 67, 242, 435, 692, 976,
-  1204, 1361, 1531, 1774, 2044, 2263, 2437, 2663, 3008, 3441, 3887, 4305,
-  4695, 5064, 5412, 5742, 6056, 6338, 6572, 6778, 7011, 7309, 7653, 7980,
-  8239, 8424, 8574, 8729, 8883, 8984, 8995, 8940, 8887, 8874, 8867, 8812,
-  8695, 8539, 8356, 8134, 7885, 7642, 7420, 7176, 6875, 6540, 6229, 5957,
-  5672, 5327, 4927, 4508, 4092, 3694, 3334, 3014, 2697, 2348, 1988, 1674,
-  1415, 1150, 830, 481, 156, -145, -454, -759, -1008, -1200, -1399, -1638,
-  -1856, -1985, -2071, -2228, -2477, -2714, -2855, -2958, -3137, -3385, -3582, -3659,
-  -3696, -3807, -3988, -4137, -4202, -4240, -4329, -4463, -4575, -4630, -4656, -4684,
-  -4710, -4712, -4695, -4676, -4654, -4602, -4512, -4405, -4302, -4181, -3999, -3747,
-  -3476, -3244, -3050, -2838, -2573, -2294, -2059, -1872, -1673, -1415, -1107, -782,
-  -457, -130, 180, 443, 661, 863, 1055, 1195, 1261, 1296, 1372, 1504,
-  1636, 1721, 1767, 1798, 1805, 1759, 1665, 1552, 1422, 1259, 1078, 930,
-  832, 715, 508, 237, -8, -195, -395, -667, -963, -1193, -1360, -1553,
-  -1812, -2065, -2238, -2381, -2600, -2910, -3199, -3384, -3510, -3671, -3871, -4027,
-  -4099, -4149, -4242, -4365, -4458, -4522, -4605, -4730, -4854, -4938, -4990, -5037,
-  -5069, -5070, -5047, -5020, -4979, -4904, -4825, -4801, -4834, -4856, -4820, -4775,
-  -4785, -4817, -4783, -4676, -4594, -4583, -4550, -4401, -4200, -4098, -4109, -4078,
-  -3898, -3658, -3505, -3430, -3311, -3120, -2953, -2845, -2692, -2434, -2192, -2088,
-  -2017, -1753, -1277, -829, -573, -372, -14, 451, 785, 924, 1071, 1378,
-  1747, 2052, 2395, 2967, 3724, 4424, 4974, 5527, 6168, 6716, 6990, 7129,
-  7420, 7884, 8275, 8508, 8815, 9377, 10000, 10378, 10527, 10707, 10969, 11064,
-  10877, 10679, 10753, 10968, 10977, 10741, 10558, 10566, 10518, 10180, 9707, 9400,
-  9236, 8934, 8442, 8056, 7965, 7932, 7618, 7049, 6533, 6190, 5827, 5298,
-  4737, 4334, 4041, 3700, 3321, 3049, 2883, 2640, 2230, 1790, 1457, 1149,
-  703, 151, -321, -639, -919, -1255, -1583, -1818, -2011, -2263, -2560, -2830,
-  -3106, -3494, -3987, -4434, -4751, -5033, -5377, -5700, -5863, -5910, -6034, -6294,
-  -6534, -6626, -6667, -6824, -7066, -7206, -7167, -7058, -6979, -6880, -6696, -6503,
-  -6410, -6357, -6174, -5830, -5479, -5212, -4900, -4386, -3748, -3218, -2882, -2595,
-  -2221, -1820, -1511, -1270, -970, -571, -133, 327, 858, 1415, 1823, 1992,
-  2070, 2254, 2514, 2644, 2585, 2514, 2588, 2739, 2828, 2879, 2988, 3088,
-  2998, 2733, 2542, 2557, 2573, 2331, 1910, 1618, 1542, 1441, 1141, 794,
-  613, 517, 274, -101, -350, -394, -483, -832, -1294, -1598, -1762, -2026,
-  -2429, -2722, -2778, -2820, -3092, -3477, -3681, -3695, -3822, -4212, -4638, -4839,
-  -4894, -5058, -5350, -5539, -5534, -5539, -5749, -6064, -6260, -6322, -6419, -6612,
-  -6756, -6749, -6691, -6725, -6818, -6840, -6801, -6843, -7010, -7152, -7118, -6946,
-  -6782, -6658, -6476, -6181, -5853, -5593, -5400, -5212, -5020, -4855, -4699, -4477,
-  -4160, -3815, -3524, -3274, -2971, -2551, -2044, -1541, -1108, -740, -379, 16,
-  411, 725, 926, 1090, 1339, 1737, 2278, 2962, 3813, 4792, 5759, 6582,
-  7260, 7854, 8348, 8668, 8853, 9105, 9578, 10207, 10829, 11426, 12101, 12828,
-  13390, 13622, 13624, 13597, 13586, 13505, 13379, 13355, 13457, 13487, 13278, 12918,
-  12582, 12234, 11694, 10972, 10339, 9986, 9788, 9515, 9143, 8793, 8444, 7919,
-  7167, 6361, 5656, 5011, 4368, 3865, 3666, 3662, 3546, 3215, 2870, 2651,
-  2378, 1809, 1031, 367, -56, -422, -883, -1323, -1593, -1801, -2165, -2668,
-  -3087, -3364, -3725, -4343, -5065, -5630, -6030, -6477, -7053, -7599, -7982, -8295,
-  -8670, -9062, -9339, -9520, -9741, -10009, -10158, -10106, -9987, -9944, -9899, -9676,
-  -9286, -8931, -8712, -8497, -8130, -7633, -7104, -6511, -5743, -4829, -3954, -3217,
-  -2522, -1773, -1071, -582, -271, 92, 641, 1271, 1838, 2381, 3017, 3700,
-  4225, 4497, 4635, 4770, 4843, 4733, 4496, 4346, 4374, 4436, 4361, 4190,
-  4071, 4008, 3839, 3478, 3060, 2760, 2580, 2392, 2149, 1926, 1778, 1649,
-  1478, 1289, 1111, 892, 582, 264, 95, 97, 129, 78, -16, -86,
-  -206, -501, -941, -1367, -1706, -2053, -2481, -2905, -3208, -3429, -3690, -4009,
-  -4322, -4674, -5212, -5942, -6640, -7122, -7488, -7938, -8430, -8733, -8804, -8890,
-  -9161, -9450, -9514, -9426, -9468, -9680, -9788, -9629, -9393, -9299, -9217, -8882,
-  -8359, -7993, -7876, -7664, -7074, -6332, -5862, -5681, -5404, -4829, -4213, -3850,
-  -3648, -3345, -2958, -2725, -2662, -2499, -2116, -1755, -1610, -1452, -943, -207,
-  251, 222, 79, 217, 484, 461, 159, 112, 728, 1839, 3027, 4145,
-  5299, 6454, 7391, 8035, 8563, 9086, 9456, 9594, 9835, 10659, 12089, 13575,
-  14586, 15108, 15474, 15839, 16052, 15967, 15662, 15285, 14892, 14533, 14354, 14409,
-  14433, 14007, 13020, 11842, 10931, 10349, 9801, 9072, 8301, 7766, 7528, 7379,
-  7070, 6493, 5671, 4695, 3734, 2999, 2605, 2465, 2385, 2284, 2248, 2356,
-  2505, 2472, 2144, 1596, 966, 315, -332, -895, -1289, -1572, -1928, -2458,
-  -3043, -3513, -3903, -4424, -5179, -6011, -6723, -7347, -8064, -8900, -9638, -10115,
-  -10446, -10847, -11307, -11595, -11606, -11506, -11483, -11465, -11248, -10817, -10363, -9968,
-  -9466, -8699, -7791, -7000, -6363, -5670, -4786, -3842, -2997, -2177, -1183, -16,
-  1087, 1957, 2676, 3378, 3990, 4318, 4338, 4264, 4298, 4437, 4576, 4715,
-  4943, 5248, 5462, 5428, 5165, 4813, 4455, 4052, 3551, 3013, 2603, 2448,
-  2530, 2705, 2833, 2877, 2879, 2881, 2882, 2876, 2866, 2839, 2762, 2649,
-  2591, 2654, 2743, 2657, 2307, 1838, 1462, 1216, 953, 558, 91, -332,
-  -705, -1129, -1687, -2386, -3211, -4151, -5143, -6072, -6857, -7507, -8065, -8523,
-  -8864, -9128, -9401, -9719, -10049, -10362, -10661, -10922, -11076, -11081, -10965, -10753,
-  -10413, -9942, -9457, -9084, -8778, -8369, -7825, -7349, -7095, -6919, -6546, -5966,
-  -5469, -5240, -5111, -4818, -4380, -4039, -3885, -3764, -3564, -3388, -3333, -3279,
-  -3083, -2869, -2892, -3132, -3234, -2962, -2504, -2190, -2016, -1680, -1030, -281,
-  272, 560, 668, 643, 558, 674, 1301, 2450, 3810, 5137, 6541, 8249,
-  10152, 11769, 12661, 12816, 12598, 12443, 12624, 13179, 13947, 14678, 15223, 15638,
-  16040, 16367, 16340, 15733, 14646, 13479, 12618, 12151, 11866, 11482, 10876, 10093,
-  9196, 8171, 7006, 5828, 4883, 4344, 4188, 4292, 4583, 5007, 5396, 5497,
-  5199, 4643, 4055, 3525, 3051, 2720, 2701, 3003, 3373, 3546, 3517, 3448,
-  3344, 2980, 2189, 1110, 39, -903, -1838, -2889, -3989, -4993, -5871, -6692,
-  -7467, -8128, -8674, -9226, -9858, -10446, -10809, -10982, -11212, -11617, -11974, -11951,
-  -11531, -11034, -10697, -10369, -9732, -8736, -7643, -6668, -5744, -4713, -3602, -2584,
-  -1731, -971, -276, 267, 638, 987, 1455, 1965, 2339, 2579, 2894, 3396,
-  3913, 4187, 4170, 4029, 3890, 3709, 3409, 3027, 2690, 2489, 2454, 2590,
-  2889, 3289, 3692, 4027, 4276, 4456, 4582, 4661, 4688, 4670, 4652, 4713,
-  4887, 5085, 5171, 5098, 4945, 4782, 4571, 4246, 3835, 3417, 2988, 2455,
-  1759, 931, -19, -1143, -2413, -3628, -4561, -5200, -5709, -6185, -6567, -6829,
-  -7112, -7557, -8105, -8610, -9091, -9693, -10368, -10784, -10691, -10263, -9910, -9794,
-  -9702, -9418, -9027, -8746, -8588, -8369, -8020, -7671, -7415, -7139, -6734, -6348,
-  -6228, -6342, -6364, -6112, -5819, -5795, -5920, -5748, -5135, -4509, -4346, -4549,
-  -4619, -4364, -4131, -4239, -4476, -4404, -3980, -3541, -3218, -2747, -1986, -1283,
-  -1018, -994, -669, 66, 738, 1044, 1338, 2094, 3123, 3762, 3754, 3511,
-  3428, 3351, 3002, 2622, 2814, 3824, 5344, 7019, 8761, 10441, 11648, 12073,
-  11946, 11761, 11627, 11256, 10612, 10237, 10688, 11870, 13146, 13990, 14274, 14055,
-  13404, 12531, 11765, 11239, 10735, 10051, 9347, 8915, 8665, 8138, 7080, 5762,
-  4611, 3741, 3064, 2684, 2870, 3604, 4423, 4865, 4888, 4703, 4342, 3655,
-  2690, 1808, 1306, 1109, 979, 904, 1066, 1429, 1616, 1300, 583, -161,
-  -759, -1381, -2223, -3220, -4159, -4975, -5782, -6653, -7503, -8214, -8770, -9193,
-  -9425, -9395, -9169, -8943, -8832, -8756, -8587, -8345, -8167, -8096, -7988, -7664,
-  -7075, -6306, -5450, -4554, -3637, -2695, -1685, -595, 458, 1274, 1767, 2072,
-  2363, 2611, 2618, 2325, 1956, 1799, 1906, 2136, 2423, 2845, 3399, 3880,
-  4094, 4087, 4015, 3857, 3450, 2860, 2489, 2654, 3198, 3697, 4021, 4446,
-  5164, 5912, 6274, 6197, 6009, 5954, 5946, 5823, 5606, 5363, 4974, 4255,
-  3279, 2352, 1623, 916, 42, -854, -1454, -1710, -1956, -2551, -3535, -4686,
-  -5808, -6850, -7831, -8742, -9526, -10070, -10222, -9922, -9338, -8804, -8543, -8497,
-  -8449, -8296, -8129, -8088, -8207, -8400, -8531, -8473, -8169, -7702, -7275, -7050,
-  -6986, -6883, -6610, -6247, -5986, -5919, -5973, -6032, -6060, -6080, -6087, -6056,
-  -6015, -6019, -6018, -5835, -5338, -4619, -3901, -3293, -2713, -2106, -1606, -1368,
-  -1309, -1171, -855, -536, -368, -214, 193, 870, 1526, 1895, 1984, 1980,
-  2041, 2255, 2645, 3070, 3229, 2944, 2405, 1947, 1577, 953, -44, -943,
-  -1068, -183, 1448, 3520, 5888, 8297, 10264, 11463, 12009, 12131, 11756, 10772,
-  9625, 9198, 9909, 11227, 12327, 12993, 13558, 14133, 14338, 13850, 12793, 11428,
-  9802, 8028, 6601, 5956, 5731, 4983, 3329, 1511, 536, 515, 714, 627,
-  554, 1044, 2135, 3374, 4327, 4805, 4740, 4183, 3427, 2838, 2498, 2201,
-  1877, 1795, 2174, 2766, 3057, 2829, 2289, 1647, 822, -358, -1836, -3391,
-  -4884, -6291, -7561, -8608, -9426, -10057, -10415, -10302, -9692, -8845, -8071, -7438,
-  -6849, -6291, -5854, -5531, -5174, -4687, -4126, -3524, -2760, -1719, -528, 519,
-  1270, 1839, 2396, 2952, 3390, 3619, 3637, 3473, 3149, 2656, 1951, 1012,
-  -16, -792, -1020, -723, -181, 418, 1155, 2129, 3142, 3796, 3879, 3563,
-  3199, 3032, 3138, 3502, 4042, 4622, 5176, 5775, 6468, 7066, 7227, 6830,
-  6136, 5482, 4880, 4062, 2875, 1479, 121, -1131, -2333, -3459, -4409, -5199,
-  -5939, -6608, -7000, -7017, -6905, -7020, -7404, -7738, -7776, -7654, -7681, -7914,
-  -8108, -8023, -7631, -7006, -6188, -5277, -4534, -4205, -4245, -4396, -4552, -4914,
-  -5665, -6608, -7308, -7560, -7550, -7535, -7528, -7411, -7224, -7125, -7092, -6898,
-  -6459, -6013, -5785, -5595, -5070, -4218, -3528, -3344, -3376, -3063, -2322, -1600,
-  -1182, -797, -123, 604, 864, 622, 411, 554, 660, 196, -703, -1363,
-  -1435, -1242, -1220, -1392, -1552, -1660, -1692, -1376, -514, 464, 773, 258,
-  -325, -338, -208, -847, -2240, -3205, -2673, -751, 1764, 4476, 7477, 10578,
-  13090, 14498, 14888, 14488, 13249, 11279, 9399, 8647, 9196, 10204, 10869, 11226,
-  11670, 12090, 11961, 11098, 9834, 8442, 6887, 5317, 4297, 4107, 4076, 3181,
-  1352, -291, -688, 29, 933, 1547, 2274, 3644, 5558, 7384, 8519, 8681,
-  7904, 6543, 5159, 4122, 3297, 2339, 1301, 699, 835, 1298, 1348, 718,
-  -227, -1080, -1889, -2962, -4384, -5913, -7272, -8356, -9160, -9672, -9897, -9874,
-  -9589, -8922, -7782, -6276, -4694, -3331, -2324, -1631, -1114, -675, -352, -302,
-  -600, -1057, -1293, -1062, -488, 69, 374, 516, 751, 1216, 1782, 2167,
-  2156, 1752, 1142, 525, -48, -638, -1227, -1573, -1343, -418, 968, 2432,
-  3774, 5050, 6289, 7242, 7510, 6972, 5990, 5120, 4629, 4368, 4096, 3800,
-  3640, 3674, 3747, 3660, 3327, 2761, 2000, 1128, 258, -582, -1516, -2657,
-  -3880, -4894, -5564, -6041, -6496, -6838, -6807, -6316, -5557, -4787, -4139, -3664,
-  -3421, -3422, -3595, -3912, -4469, -5295, -6118, -6520, -6379, -6001, -5734, -5592,
-  -5383, -5094, -4921, -4973, -5169, -5473, -6009, -6783, -7477, -7740, -7597, -7354,
-  -7126, -6710, -5978, -5125, -4361, -3614, -2769, -2049, -1787, -1869, -1781, -1352,
-  -1080, -1439, -2138, -2459, -2223, -1952, -2023, -2142, -1924, -1581, -1602, -1941,
-  -2064, -1829, -1781, -2349, -3151, -3485, -3243, -2896, -2695, -2382, -1744, -971,
-  -240, 606, 1600, 2175, 1721, 535, -371, -558, -700, -1421, -1990, -832,
-  2615, 7067, 10612, 12423, 13035, 13262, 13316, 12910, 11805, 10122, 8416, 7586,
-  8379, 10579, 12797, 13473, 12301, 10473, 9369, 9175, 8987, 8116, 6907, 6164,
-  6097, 6123, 5569, 4276, 2521, 735, -542, -719, 386, 2173, 3704, 4629,
-  5427, 6525, 7450, 7228, 5589, 3414, 1844, 1194, 905, 365, -477, -1214,
-  -1416, -986, -351, -331, -1482, -3406, -4940, -5353, -5209, -5735, -7300, -8893,
-  -9265, -8334, -7178, -6774, -7036, -7114, -6338, -4751, -2920, -1453, -639, -337,
-  -176, 47, 131, -261, -1090, -1802, -1811, -1048, 44, 1013, 1767, 2427,
-  2967, 3162, 2858, 2193, 1469, 890, 482, 245, 247, 528, 978, 1448,
-  1965, 2735, 3852, 5060, 5899, 6106, 5805, 5308, 4768, 4104, 3228, 2253,
-  1470, 1132, 1265, 1658, 2001, 2054, 1747, 1154, 407, -380, -1114, -1747,
-  -2317, -2945, -3712, -4524, -5143, -5400, -5366, -5247, -5130, -4892, -4391, -3701,
-  -3090, -2780, -2785, -2987, -3287, -3651, -4073, -4560, -5115, -5648, -5924, -5738,
-  -5198, -4719, -4602, -4696, -4612, -4286, -4138, -4580, -5482, -6288, -6587, -6433,
-  -6095, -5717, -5305, -4871, -4397, -3742, -2824, -1930, -1560, -1808, -2097, -1817,
-  -1157, -974, -1717, -2788, -3252, -3005, -2830, -3297, -4015, -4220, -3794, -3304,
-  -3173, -3283, -3445, -3774, -4315, -4665, -4457, -4014, -3999, -4352, -4152, -2811,
-  -971, 261, 677, 1005, 1682, 2226, 1999, 1012, -360, -1938, -3407, -3764,
-  -1979, 1608, 5279, 7740, 9463, 11665, 14310, 15843, 14989, 12224, 9258, 7523,
-  7419, 8553, 10123, 11284, 11719, 11948, 12632, 13457, 13220, 11316, 8756, 7214,
-  7171, 7508, 6936, 5386, 3761, 2730, 2194, 1772, 1370, 1171, 1356, 2031,
-  3212, 4649, 5752, 5951, 5197, 3998, 2873, 1881, 769, -508, -1602, -2126,
-  -2072, -1762, -1492, -1339, -1320, -1534, -2067, -2856, -3813, -4997, -6455, -7887,
-  -8686, -8510, -7700, -6940, -6502, -6027, -5096, -3822, -2731, -2145, -1849, -1387,
-  -570, 336, 872, 823, 431, 178, 320, 665, 876, 947, 1225, 1927,
-  2800, 3373, 3451, 3222, 2930, 2640, 2330, 2014, 1700, 1363, 1094, 1128,
-  1602, 2347, 3100, 3852, 4738, 5588, 5853, 5196, 3972, 2873, 2155, 1461,
-  466, -561, -1028, -728, -71, 362, 323, -79, -653, -1305, -1990, -2667,
-  -3323, -3972, -4575, -5010, -5173, -5114, -5001, -4944, -4854, -4524, -3876, -3091,
-  -2477, -2188, -2122, -2097, -2120, -2402, -3103, -4090, -5003, -5551, -5710, -5631,
-  -5422, -5064, -4521, -3882, -3342, -3089, -3199, -3630, -4239, -4831, -5234, -5387,
-  -5312, -4994, -4361, -3432, -2465, -1831, -1705, -1932, -2235, -2491, -2745, -3019,
-  -3250, -3410, -3571, -3817, -4154, -4556, -4991, -5350, -5426, -5117, -4591, -4125,
-  -3784, -3412, -2974, -2723, -2889, -3332, -3678, -3713, -3448, -2855, -1812, -411,
-  934, 1863, 2382, 2542, 2017, 429, -1815, -3422, -3317, -1686, 415, 2416,
-  4823, 8308, 12480, 15861, 17044, 15785, 13094, 10481, 9062, 9031, 9758, 10471,
-  10988, 11772, 13173, 14693, 15183, 13885, 11229, 8530, 6880, 6308, 5960, 5033,
-  3517, 2053, 1142, 605, -115, -1192, -2123, -2206, -1191, 580, 2493, 3974,
-  4604, 4268, 3280, 2171, 1178, 85, -1298, -2597, -3105, -2575, -1557, -839,
-  -698, -861, -1073, -1470, -2378, -3910, -5813, -7567, -8625, -8723, -8101, -7335,
-  -6780, -6229, -5233, -3752, -2319, -1496, -1284, -1169, -665, 273, 1314, 2081,
-  2420, 2471, 2522, 2746, 3046, 3198, 3156, 3133, 3333, 3686, 3943, 3964,
-  3787, 3429, 2767, 1748, 616, -183, -358, 20, 664, 1374, 2162, 3100,
-  4104, 4870, 5043, 4480, 3380, 2149, 1138, 471, 83, -138, -249, -240,
-  -82, 168, 292, -7, -850, -2021, -3121, -3931, -4552, -5170, -5750, -6061,
-  -5986, -5681, -5396, -5217, -5054, -4805, -4427, -3885, -3159, -2360, -1747, -1520,
-  -1634, -1905, -2260, -2785, -3492, -4165, -4512, -4425, -3990, -3316, -2498, -1748,
-  -1378, -1533, -2031, -2595, -3190, -3955, -4825, -5399, -5301, -4558, -3522, -2520,
-  -1694, -1125, -899, -1024, -1415, -2014, -2768, -3469, -3793, -3673, -3506, -3746,
-  -4353, -4844, -4908, -4730, -4639, -4682, -4702, -4633, -4462, -4060, -3399, -2890,
-  -3094, -3953, -4617, -4313, -3189, -2009, -1199, -535, 299, 1233, 1968, 2194,
-  1534, -265, -2651, -4115, -3366, -710, 2262, 4543, 6774, 10077, 14177, 17260,
-  17694, 15517, 12221, 9517, 8399, 8901, 10257, 11468, 12145, 12799, 14019, 15350,
-  15430, 13438, 10145, 7234, 5687, 5104, 4508, 3461, 2260, 1326, 698, 117,
-  -593, -1300, -1667, -1430, -594, 575, 1714, 2507, 2749, 2398, 1599, 570,
-  -567, -1769, -2827, -3296, -2878, -1849, -897, -474, -465, -596, -976, -2012,
-  -3838, -6045, -7958, -9038, -9036, -8060, -6632, -5464, -4864, -4433, -3588, -2389,
-  -1578, -1670, -2241, -2335, -1477, -67, 1201, 2055, 2707, 3418, 4188, 4831,
-  5155, 5087, 4738, 4390, 4305, 4461, 4540, 4257, 3665, 3060, 2610, 2210,
-  1721, 1240, 1015, 1134, 1440, 1774, 2162, 2655, 3054, 2989, 2323, 1345,
-  482, -98, -463, -595, -334, 283, 837, 897, 481, -38, -503, -1210,
-  -2474, -4103, -5491, -6127, -5899, -5021, -3941, -3311, -3655, -4788, -5756, -5704,
-  -4836, -4223, -4532, -5213, -5131, -3884, -2216, -1195, -1231, -1951, -2735, -3153,
-  -3080, -2699, -2441, -2652, -3169, -3379, -2851, -1901, -1334, -1623, -2441, -3079,
-  -3220, -3157, -3282, -3527, -3465, -2897, -2166, -1763, -1783, -1927, -2030, -2315,
-  -2985, -3781, -4220, -4233, -4254, -4586, -4978, -5053, -4911, -4950, -5171, -5114,
-  -4616, -4208, -4410, -4903, -4880, -4178, -3559, -3664, -4086, -3846, -2587, -908,
-  424, 1176, 1489, 1435, 1009, 305, -610, -1867, -3415, -4468, -3768, -713,
-  3907, 8546, 12172, 14717, 16409, 17077, 16353, 14350, 11880, 9972, 9278, 9869,
-  11366, 13178, 14749, 15731, 15957, 15258, 13445, 10625, 7435, 4746, 2991, 1872,
-  826, -303, -1195, -1586, -1649, -1765, -2057, -2314, -2293, -1912, -1184, -192,
-  754, 1153, 760, -56, -626, -713, -743, -1205, -1974, -2423, -2127, -1293,
-  -495, -215, -658, -1778, -3281, -4714, -5789, -6617, -7465, -8253, -8512, -7914,
-  -6703, -5429, -4358, -3329, -2146, -913, 103, 791, 1295, 1857, 2641, 3594,
-  4415, 4744, 4571, 4371, 4672, 5448, 6144, 6330, 6130, 5875, 5545, 4833,
-  3666, 2359, 1219, 294, -353, -444, 155, 1026, 1525, 1504, 1377, 1431,
-  1409, 1009, 468, 276, 443, 494, 224, 36, 313, 804, 950, 639,
-  232, -66, -463, -1113, -1787, -2243, -2664, -3402, -4419, -5307, -5825, -6082,
-  -6179, -5982, -5427, -4761, -4246, -3802, -3232, -2678, -2512, -2759, -2975, -2840,
-  -2567, -2518, -2603, -2393, -1741, -999, -578, -540, -690, -848, -912, -832,
-  -723, -861, -1363, -1942, -2195, -2108, -2044, -2229, -2489, -2608, -2697, -2999,
-  -3505, -3993, -4362, -4684, -4975, -5208, -5542, -6200, -6973, -7204, -6572, -5659,
-  -5299, -5479, -5379, -4622, -3932, -4170, -5066, -5477, -4824, -3700, -2919, -2470,
-  -1771, -637, 494, 1136, 1065, 88, -1905, -4360, -5953, -5593, -3452, -612,
-  2240, 5311, 8831, 12177, 14277, 14665, 13776, 12317, 10791, 9696, 9673, 11086,
-  13539, 16085, 17873, 18476, 17772, 15893, 13311, 10661, 8271, 6030, 3870, 2170,
-  1394, 1413, 1492, 986, -175, -1717, -3363, -4734, -5182, -4250, -2360, -663,
-  31, 5, 78, 455, 457, -552, -2263, -3608, -3728, -2610, -924, 512,
-  1137, 847, -10, -967, -1954, -3392, -5553, -7842, -9040, -8453, -6696, -5090,
-  -4320, -3940, -3207, -2104, -1303, -1273, -1738, -2019, -1663, -641, 810, 2333,
-  3538, 4254, 4712, 5303, 6089, 6720, 6916, 6853, 6894, 7044, 6915, 6212,
-  5060, 3807, 2686, 1797, 1216, 915, 672, 332, 127, 457, 1249, 1777,
-  1400, 356, -461, -527, -240, -325, -923, -1469, -1376, -611, 391, 1115,
-  1229, 696, -164, -830, -1048, -1156, -1742, -2919, -4098, -4620, -4497, -4346,
-  -4628, -5136, -5319, -4958, -4388, -4106, -4280, -4665, -4914, -4899, -4748, -4610,
-  -4427, -3968, -3101, -1987, -956, -224, 200, 374, 308, 31, -332, -652,
-  -884, -984, -810, -286, 345, 619, 292, -435, -1218, -1956, -2736, -3505,
-  -4068, -4413, -4803, -5441, -6193, -6792, -7176, -7438, -7556, -7408, -7015, -6549,
-  -6052, -5435, -4844, -4751, -5392, -6268, -6524, -5811, -4523, -3191, -1985, -904,
-  -59, 502, 954, 1221, 550, -1797, -5223, -7715, -7582, -5103, -2023, 494,
-  2926, 6311, 10588, 14349, 16030, 15105, 12344, 9354, 7787, 8418, 10631, 12987,
-  14573, 15718, 17173, 18736, 19091, 17161, 13397, 9515, 7012, 6039, 5634, 4814,
-  3399, 1909, 817, -8, -1113, -2729, -4308, -4928, -4177, -2575, -1101, -381,
-  -377, -757, -1360, -2250, -3417, -4540, -5083, -4642, -3265, -1496, -64, 597,
-  604, 392, 173, -379, -1798, -4113, -6475, -7659, -7101, -5438, -3948, -3439,
-  -3697, -3954, -3714, -3079, -2462, -2193, -2309, -2465, -2037, -578, 1604, 3517,
-  4358, 4315, 4301, 4909, 5880, 6631, 7019, 7364, 7865, 8313, 8375, 7924,
-  7027, 5801, 4424, 3147, 2167, 1526, 1230, 1358, 1868, 2393, 2450, 1897,
-  1011, 47, -1063, -2418, -3716, -4374, -4114, -3230, -2250, -1466, -885, -473,
-  -282, -390, -833, -1606, -2602, -3550, -4143, -4296, -4222, -4162, -4104, -3842,
-  -3328, -2863, -2875, -3496, -4406, -5110, -5382, -5403, -5463, -5575, -5474, -4970,
-  -4205, -3478, -2901, -2331, -1640, -898, -262, 211, 559, 778, 829, 754,
-  656, 564, 390, 91, -238, -523, -881, -1482, -2246, -2847, -3139, -3463,
-  -4345, -5842, -7331, -8077, -7952, -7509, -7371, -7661, -8009, -7982, -7436, -6600,
-  -5950, -5894, -6334, -6562, -5838, -4213, -2597, -1804, -1677, -1404, -645, -26,
-  -447, -2172, -4663, -6942, -7862, -6455, -2676, 2145, 6169, 8683, 10519, 12559,
-  14210, 13963, 11402, 8079, 6193, 6764, 9251, 12454, 15329, 17224, 17980, 17912,
-  17312, 15900, 13215, 9695, 6856, 5875, 6200, 6066, 4414, 1875, -210, -1289,
-  -1824, -2388, -2980, -3194, -2719, -1639, -479, 6, -628, -2042, -3340, -3911,
-  -3919, -3829, -3659, -2950, -1462, 384, 1802, 2238, 1633, 331, -1136, -2313,
-  -3121, -3860, -4782, -5671, -5976, -5410, -4312, -3356, -2983, -3116, -3342, -3302,
-  -2989, -2723, -2775, -2936, -2568, -1243, 691, 2368, 3285, 3818, 4747, 6375,
-  8207, 9451, 9701, 9172, 8418, 7872, 7541, 7059, 6128, 4966, 4243, 4424,
-  5190, 5639, 5120, 3795, 2318, 1081, -89, -1510, -3120, -4485, -5249, -5439,
-  -5304, -4962, -4319, -3307, -2125, -1174, -784, -1005, -1626, -2333, -2866, -3115,
-  -3120, -2961, -2628, -2024, -1136, -192, 419, 414, -222, -1312, -2648, -4047,
-  -5311, -6255, -6755, -6745, -6199, -5223, -4157, -3442, -3269, -3391, -3353, -2931,
-  -2276, -1681, -1272, -931, -434, 336, 1244, 1930, 2112, 1907, 1755, 1901,
-  2041, 1649, 613, -635, -1668, -2516, -3482, -4679, -5944, -7091, -8017, -8581,
-  -8682, -8530, -8592, -9082, -9667, -9839, -9488, -8903, -8323, -7751, -7155, -6524,
-  -5645, -4225, -2482, -1314, -1457, -2557, -3517, -3773, -3762, -3897, -3531, -1469,
-  2561, 7334, 11107, 12880, 12732, 11370, 9661, 8302, 7534, 7179, 7214, 8209,
-  10789, 14530, 17752, 18761, 17254, 14367, 11476, 9239, 7674, 6686, 6220, 6076,
-  5897, 5396, 4468, 3089, 1292, -652, -2167, -2672, -2039, -766, 323, 577,
-  -160, -1584, -3208, -4617, -5542, -5797, -5243, -3846, -1786, 498, 2371, 3218,
-  2734, 1104, -1121, -3362, -5230, -6454, -6761, -6027, -4525, -2872, -1619, -954,
-  -831, -1272, -2349, -3900, -5416, -6302, -6230, -5231, -3566, -1608, 246, 1700,
-  2685, 3329, 3814, 4284, 4857, 5627, 6582, 7554, 8303, 8660, 8576, 8090,
-  7302, 6393, 5620, 5252, 5435, 6036, 6611, 6614, 5752, 4167, 2240, 258,
-  -1636, -3211, -4063, -3922, -2974, -1765, -785, -233, -142, -553, -1451, -2640,
-  -3813, -4730, -5241, -5189, -4448, -3134, -1672, -552, -18, -10, -342, -859,
-  -1457, -2065, -2659, -3238, -3756, -4109, -4232, -4195, -4161, -4240, -4374, -4348,
-  -3945, -3134, -2160, -1398, -1099, -1255, -1683, -2154, -2422, -2250, -1599, -769,
-  -162, 166, 572, 1299, 2001, 2004, 1043, -459, -1893, -3027, -3951, -4663,
-  -5003, -4994, -4976, -5288, -5952, -6773, -7601, -8343, -8849, -9008, -8908, -8680,
-  -8163, -7021, -5354, -3948, -3582, -4154, -4803, -4978, -5074, -5757, -6880, -7414,
-  -6443, -3983, -734, 2648, 5806, 8425, 10106, 10604, 9998, 8558, 6677, 5038,
-  4610, 6049, 9032, 12380, 14977, 16450, 16959, 16595, 15297, 13241, 10942, 8845,
-  7074, 5725, 5108, 5340, 5787, 5381, 3719, 1629, 369, 383, 1030, 1443,
-  1309, 789, 37, -921, -2010, -3098, -4145, -5085, -5537, -4918, -3063, -605,
-  1440, 2433, 2361, 1470, -65, -2047, -4089, -5747, -6748, -6964, -6279, -4712,
-  -2721, -1169, -773, -1567, -2944, -4222, -5118, -5732, -6184, -6331, -5805, -4348,
-  -2125, 251, 2078, 3014, 3233, 3192, 3275, 3618, 4169, 4817, 5469, 6069,
-  6552, 6812, 6755, 6442, 6149, 6174, 6568, 7080, 7406, 7399, 6981, 5985,
-  4262, 1990, -257, -1882, -2662, -2730, -2269, -1370, -220, 755, 1061, 453,
-  -943, -2752, -4494, -5689, -6028, -5562, -4653, -3635, -2568, -1400, -304, 305,
-  160, -572, -1477, -2285, -2981, -3572, -3932, -3952, -3731, -3497, -3371, -3314,
-  -3279, -3296, -3370, -3372, -3166, -2805, -2529, -2534, -2777, -3029, -3083, -2898,
-  -2551, -2105, -1535, -798, 54, 850, 1396, 1550, 1205, 288, -1108, -2570,
-  -3512, -3626, -3181, -2786, -2838, -3272, -3807, -4310, -4857, -5547, -6349, -7063,
-  -7335, -6833, -5635, -4425, -4050, -4693, -5628, -5974, -5626, -5282, -5565, -6343,
-  -6915, -6624, -5167, -2614, 552, 3489, 5473, 6489, 7132, 7807, 8194, 7741,
-  6569, 5618, 5854, 7510, 10098, 12892, 15274, 16819, 17349, 16908, 15548, 13211,
-  10071, 6939, 4965, 4629, 5169, 5278, 4406, 3158, 2410, 2249, 1965, 952,
-  -589, -1875, -2321, -2072, -1841, -2245, -3242, -4165, -4345, -3708, -2761, -1992,
-  -1386, -565, 650, 1891, 2444, 1809, 130, -1822, -3179, -3615, -3531, -3525,
-  -3706, -3622, -2916, -1892, -1290, -1567, -2534, -3663, -4583, -5226, -5682, -6024,
-  -6191, -5911, -4825, -2895, -675, 1030, 1889, 2326, 2969, 3922, 4749, 5102,
-  5175, 5447, 6138, 7032, 7759, 8133, 8230, 8277, 8488, 8873, 9143, 8876,
-  7892, 6430, 4879, 3361, 1704, -131, -1735, -2536, -2386, -1766, -1360, -1499,
-  -2055, -2768, -3515, -4278, -4987, -5489, -5632, -5312, -4515, -3413, -2382, -1794,
-  -1708, -1838, -1873, -1781, -1729, -1767, -1742, -1545, -1339, -1423, -1900, -2533,
-  -2938, -2899, -2504, -2027, -1718, -1682, -1896, -2274, -2682, -2968, -3071, -3127,
-  -3347, -3709, -3853, -3423, -2503, -1575, -1020, -835, -900, -1304, -2178, -3271,
-  -4009, -4074, -3745, -3530, -3612, -3791, -3863, -3839, -3851, -4057, -4605, -5437,
-  -6076, -5907, -4931, -4014, -4082, -5082, -6086, -6466, -6628, -7348, -8592, -9321,
-  -8461, -5863, -2323, 1047, 3429, 4591, 4866, 4816, 4716, 4410, 3815, 3511,
-  4512, 7283, 11094, 14497, 16426, 16775, 16059, 14802, 13295, 11708, 10193, 8876,
-  7890, 7417, 7518, 7851, 7691, 6446, 4246, 1924, 331, -349, -581, -859,
-  -1237, -1478, -1544, -1745, -2384, -3350, -4142, -4268, -3579, -2299, -823, 491,
-  1432, 1941, 2010, 1590, 653, -638, -1868, -2586, -2628, -2182, -1544, -871,
-  -216, 258, 211, -648, -2264, -4192, -5825, -6718, -6764, -6154, -5208, -4214,
-  -3316, -2508, -1727, -985, -430, -215, -262, -201, 398, 1670, 3326, 4884,
-  6008, 6647, 6940, 7077, 7224, 7496, 7934, 8484, 8995, 9184, 8680, 7259,
-  5139, 2993, 1495, 815, 607, 475, 343, 313, 281, -122, -1184, -2808,
-  -4555, -5921, -6566, -6427, -5756, -4989, -4453, -4134, -3797, -3327, -2882, -2678,
-  -2700, -2693, -2395, -1738, -891, -197, -4, -408, -1103, -1563, -1449, -836,
-  -71, 507, 697, 442, -150, -851, -1520, -2229, -3039, -3693, -3758, -3188,
-  -2526, -2354, -2653, -2938, -2947, -2916, -3133, -3523, -3867, -4173, -4544, -4804,
-  -4626, -4053, -3581, -3569, -3809, -3872, -3697, -3586, -3748, -4125, -4619, -5157,
-  -5488, -5312, -4797, -4669, -5425, -6607, -7258, -7085, -6721, -6652, -6278, -4479,
-  -1055, 2734, 5145, 5324, 3812, 1998, 1165, 1756, 3267, 4924, 6614, 9025,
-  12595, 16399, 18482, 17584, 14412, 11021, 8998, 8405, 8364, 8282, 8301, 8716,
-  9298, 9303, 8105, 5775, 3101, 1081, 290, 562, 1186, 1411, 874, -326,
-  -1865, -3458, -4906, -5954, -6202, -5281, -3197, -510, 1878, 3201, 3191, 2098,
-  435, -1328, -2903, -4130, -4802, -4612, -3348, -1249, 888, 2120, 2013, 931,
-  -370, -1438, -2423, -3700, -5272, -6608, -7047, -6367, -4960, -3506, -2481, -1903,
-  -1485, -987, -439, -53, 75, 147, 514, 1352, 2494, 3623, 4568, 5376,
-  6134, 6832, 7433, 7987, 8559, 9069, 9295, 9049, 8296, 7115, 5636, 4081,
-  2766, 1932, 1579, 1498, 1463, 1307, 860, -64, -1510, -3265, -4955, -6242,
-  -6929, -6969, -6475, -5708, -4934, -4309, -3916, -3862, -4170, -4579, -4643, -4168,
-  -3447, -2901, -2558, -2063, -1196, -192, 551, 902, 1039, 1153, 1278, 1346,
-  1227, 758, -91, -998, -1467, -1346, -1084, -1259, -1899, -2461, -2535, -2382,
-  -2652, -3632, -4916, -5824, -6033, -5767, -5464, -5355, -5330, -5141, -4699, -4194,
-  -3947, -4101, -4443, -4547, -4187, -3611, -3332, -3579, -4025, -4171, -3995, -4055,
-  -4871, -6274, -7496, -7823, -7044, -5371, -3197, -1030, 607, 1461, 1721, 1722,
-  1562, 1207, 951, 1447, 3114, 5662, 8382, 10757, 12618, 13826, 14161, 13601,
-  12490, 11291, 10328, 9852, 10086, 10889, 11500, 11005, 9232, 7012, 5377, 4602,
-  4144, 3423, 2463, 1746, 1577, 1639, 1196, -252, -2399, -4260, -4970, -4498,
-  -3535, -2699, -2000, -1120, -49, 730, 666, -346, -1812, -2923, -3084, -2352,
-  -1395, -852, -717, -478, 105, 562, 217, -998, -2450, -3458, -3842, -3859,
-  -3847, -4015, -4358, -4597, -4356, -3622, -2959, -2996, -3671, -4201, -3870, -2704,
-  -1292, -138, 653, 1234, 1826, 2642, 3752, 4927, 5808, 6339, 6885, 7760,
-  8747, 9266, 8993, 8142, 7139, 6217, 5423, 4845, 4608, 4658, 4686, 4350,
-  3499, 2195, 593, -1134, -2806, -4236, -5261, -5772, -5769, -5420, -5021, -4810,
-  -4821, -4934, -5063, -5224, -5412, -5473, -5181, -4433, -3353, -2216, -1298, -755,
-  -524, -327, 145, 951, 1808, 2351, 2483, 2409, 2306, 2073, 1474, 479,
-  -643, -1560, -2116, -2338, -2332, -2243, -2232, -2393, -2705, -3170, -3939, -5145,
-  -6587, -7710, -8014, -7477, -6522, -5680, -5313, -5508, -6001, -6247, -5818, -4864,
-  -4017, -3730, -3817, -3796, -3559, -3487, -3955, -4945, -6135, -7088, -7278, -6226,
-  -3924, -1006, 1694, 3688, 4785, 4706, 3253, 974, -801, -955, 486, 2677,
-  5008, 7488, 10160, 12567, 13996, 14012, 12648, 10385, 8130, 6886, 7003, 7824,
-  8449, 8759, 9282, 10023, 10038, 8533, 6023, 3893, 2921, 2689, 2411, 1823,
-  1114, 442, -153, -621, -1071, -1826, -2934, -3742, -3459, -2219, -1120, -976,
-  -1427, -1624, -1480, -1726, -2766, -3993, -4421, -3695, -2257, -795, 208, 555,
-  315, -254, -972, -1945, -3285, -4639, -5272, -4766, -3483, -2186, -1333, -924,
-  -882, -1265, -2044, -2897, -3396, -3322, -2727, -1777, -635, 550, 1648, 2555,
-  3177, 3459, 3519, 3681, 4239, 5160, 6113, 6787, 7119, 7192, 7065, 6763,
-  6345, 5876, 5390, 4964, 4750, 4768, 4703, 4104, 2839, 1244, -256, -1541,
-  -2706, -3744, -4517, -4989, -5247, -5268, -4931, -4376, -4129, -4575, -5418, -5931,
-  -5787, -5371, -5150, -4988, -4341, -3023, -1462, -190, 665, 1262, 1673, 1845,
-  1802, 1666, 1477, 1222, 1023, 1044, 1145, 906, 187, -549, -805, -813,
-  -1350, -2696, -4179, -4994, -5202, -5525, -6308, -7126, -7479, -7434, -7342, -7271,
-  -7059, -6759, -6588, -6489, -6149, -5528, -4993, -4731, -4437, -3915, -3698, -4505,
-  -6091, -7199, -6832, -5209, -3178, -1114, 1118, 3325, 4771, 4971, 4250, 3220,
-  2098, 904, 138, 708, 3067, 6682, 10407, 13157, 14209, 13363, 11186, 8882,
-  7451, 6934, 6731, 6637, 7145, 8552, 10144, 10670, 9563, 7383, 5104, 3283,
-  2008, 1283, 1143, 1459, 1902, 2112, 1806, 798, -841, -2581, -3627, -3538,
-  -2592, -1446, -505, 217, 694, 647, -149, -1455, -2668, -3319, -3353, -2943,
-  -2187, -1140, -40, 661, 594, -256, -1571, -2966, -4167, -5002, -5314, -4991,
-  -4093, -2915, -1899, -1427, -1629, -2328, -3157, -3785, -4047, -3883, -3207, -1949,
-  -274, 1370, 2543, 3177, 3548, 3853, 3975, 3774, 3520, 3814, 4984, 6670,
-  8094, 8698, 8474, 7765, 6914, 6105, 5389, 4753, 4198, 3795, 3587, 3408,
-  2869, 1703, 106, -1392, -2460, -3247, -4048, -4793, -5091, -4795, -4343, -4372,
-  -5051, -5940, -6506, -6625, -6489, -6173, -5512, -4411, -3115, -2012, -1274, -782,
-  -360, 62, 509, 981, 1355, 1427, 1203, 1048, 1294, 1744, 1818, 1251,
-  420, -181, -568, -1114, -1922, -2717, -3357, -4059, -4946, -5704, -6021, -6121,
-  -6472, -7043, -7316, -7093, -6816, -6825, -6720, -5920, -4662, -3875, -4061, -4793,
-  -5473, -6074, -6782, -7281, -6963, -5730, -4054, -2244, -190, 1978, 3506, 3757,
-  3041, 2198, 1519, 658, -333, -478, 1173, 4366, 7783, 10229, 11360, 11416,
-  10751, 9722, 8642, 7568, 6389, 5328, 5101, 6203, 8099, 9530, 9691, 8872,
-  7833, 6878, 5771, 4363, 2957, 2025, 1770, 2012, 2310, 2187, 1427, 317,
-  -520, -684, -350, 18, 209, 361, 559, 566, 76, -892, -1973, -2778,
-  -3130, -3033, -2545, -1760, -845, -52, 331, 78, -850, -2229, -3670, -4814,
-  -5432, -5383, -4622, -3359, -2145, -1600, -1930, -2753, -3469, -3794, -3882, -3958,
-  -3943, -3494, -2406, -891, 518, 1354, 1518, 1297, 1129, 1321, 1913, 2758,
-  3710, 4714, 5736, 6614, 7075, 6939, 6323, 5595, 5090, 4879, 4814, 4752,
-  4686, 4642, 4502, 3993, 2920, 1393, -181, -1376, -2036, -2303, -2416, -2535,
-  -2733, -3090, -3672, -4454, -5313, -6099, -6648, -6734, -6169, -5040, -3772, -2793,
-  -2142, -1549, -895, -414, -330, -455, -352, 155, 819, 1314, 1540, 1533,
-  1291, 856, 424, 145, -135, -686, -1449, -2034, -2264, -2490, -3157, -4200,
-  -5142, -5707, -6076, -6503, -6973, -7364, -7684, -7909, -7769, -7038, -6016, -5389,
-  -5499, -6000, -6394, -6666, -7126, -7725, -7889, -7085, -5334, -3069, -727, 1359,
-  2862, 3559, 3552, 3191, 2718, 2172, 1736, 1968, 3448, 6126, 9130, 11313,
-  12023, 11453, 10358, 9445, 8909, 8478, 7857, 7154, 6810, 7120, 7838, 8306,
-  7981, 6868, 5505, 4508, 4066, 3806, 3217, 2238, 1342, 948, 842, 365,
-  -763, -2001, -2485, -1889, -663, 483, 1159, 1370, 1272, 981, 540, -83,
-  -897, -1723, -2179, -1977, -1225, -306, 519, 1230, 1738, 1665, 658, -1131,
-  -3048, -4439, -5066, -5038, -4545, -3783, -3028, -2582, -2580, -2929, -3464, -4085,
-  -4714, -5163, -5150, -4482, -3227, -1720, -376, 525, 936, 997, 945, 1056,
-  1586, 2636, 4032, 5412, 6458, 7029, 7094, 6658, 5850, 5010, 4503, 4423,
-  4576, 4780, 5039, 5338, 5398, 4824, 3506, 1750, -19, -1542, -2706, -3397,
-  -3552, -3318, -3026, -2979, -3299, -3959, -4837, -5713, -6316, -6471, -6192, -5606,
-  -4807, -3853, -2843, -1916, -1154, -528, 25, 509, 866, 1040, 1063, 1075,
-  1228, 1512, 1689, 1501, 979, 461, 222, 157, -87, -692, -1507, -2302,
-  -3067, -3958, -5048, -6197, -7152, -7719, -7885, -7836, -7827, -7921, -7880, -7453,
-  -6798, -6470, -6872, -7785, -8591, -8893, -8765, -8354, -7465, -5731, -3179, -439,
-  1669, 2727, 2908, 2683, 2451, 2381, 2501, 2855, 3603, 4988, 7128, 9754,
-  12131, 13399, 13138, 11693, 9902, 8476, 7609, 7129, 6894, 6926, 7238, 7665,
-  7929, 7793, 7132, 5988, 4634, 3485, 2766, 2261, 1553, 574, -243, -486,
-  -311, -282, -667, -1090, -981, -240, 667, 1199, 1191, 860, 494, 203,
-  -103, -556, -1093, -1368, -996, 14, 1115, 1643, 1409, 794, 245, -248,
-  -1087, -2509, -4192, -5447, -5745, -5090, -3955, -2931, -2423, -2533, -3131, -3981,
-  -4852, -5556, -5925, -5766, -4936, -3501, -1839, -460, 347, 696, 901, 1136,
-  1372, 1642, 2197, 3275, 4755, 6147, 6946, 6955, 6303, 5309, 4379, 3906,
-  4062, 4651, 5255, 5559, 5479, 4987, 3955, 2288, 200, -1778, -3087, -3473,
-  -3079, -2316, -1647, -1384, -1581, -2119, -2891, -3879, -5012, -5996, -6388, -5890,
-  -4593, -2927, -1406, -351, 206, 422, 442, 312, 84, -48, 134, 596,
-  1008, 1081, 893, 757, 786, 764, 465, -50, -579, -1096, -1761, -2651,
-  -3652, -4634, -5586, -6513, -7323, -7894, -8171, -8110, -7647, -6877, -6192, -6050,
-  -6574, -7537, -8712, -10005, -11098, -11268, -9931, -7370, -4618, -2468, -812, 894,
-  2657, 3711, 3322, 1686, -4, -348, 1307, 4471, 7931, 10641, 12354, 13397,
-  13914, 13514, 11834, 9328, 7217, 6522, 7199, 8300, 8913, 8868, 8603, 8469,
-  8257, 7392, 5602, 3364, 1618, 957, 1126, 1359, 1137, 554, -16, -380,
-  -595, -732, -765, -650, -360, 136, 788, 1315, 1306, 631, -323, -945,
-  -944, -547, -170, -5, 73, 305, 788, 1321, 1443, 742, -740, -2419,
-  -3625, -4182, -4438, -4704, -4820, -4424, -3576, -2904, -3039, -3979, -5110, -5808,
-  -5929, -5733, -5442, -4977, -4088, -2707, -1152, 6, 359, 28, -370, -188,
-  752, 2117, 3452, 4564, 5471, 6114, 6274, 5844, 5086, 4500, 4415, 4754,
-  5188, 5449, 5466, 5215, 4563, 3343, 1633, -99, -1250, -1556, -1292, -979,
-  -921, -1091, -1401, -1910, -2687, -3579, -4268, -4524, -4316, -3726, -2891, -2048,
-  -1458, -1182, -1042, -871, -711, -642, -545, -262, 70, 128, -77, -80,
-  410, 966, 857, -21, -973, -1355, -1312, -1475, -2123, -2934, -3500, -3792,
-  -4091, -4671, -5616, -6738, -7564, -7647, -7087, -6598, -6791, -7443, -7797, -7619,
-  -7615, -8544, -10118, -11117, -10595, -8702, -6316, -4134, -2308, -775, 400, 1039,
-  1055, 588, 52, 80, 1231, 3554, 6432, 8995, 10718, 11626, 11987, 11970,
-  11620, 11017, 10315, 9653, 9156, 9002, 9322, 9937, 10293, 9844, 8555, 6958,
-  5682, 4923, 4410, 3793, 3000, 2205, 1552, 979, 339, -363, -888, -972,
-  -611, -98, 257, 414, 572, 849, 1085, 1012, 567, -29, -475, -606,
-  -416, 30, 649, 1348, 1994, 2365, 2142, 1096, -620, -2416, -3657, -4146,
-  -4156, -4014, -3810, -3553, -3430, -3698, -4376, -5218, -6004, -6667, -7089, -6977,
-  -6141, -4820, -3557, -2739, -2379, -2294, -2300, -2165, -1578, -383, 1197, 2718,
-  3879, 4626, 4954, 4813, 4308, 3824, 3759, 4189, 4879, 5603, 6290, 6826,
-  6904, 6203, 4721, 2862, 1193, 115, -309, -306, -177, -57, 101, 293,
-  255, -395, -1763, -3462, -4851, -5459, -5219, -4389, -3342, -2357, -1516, -781,
-  -214, -41, -390, -1008, -1405, -1336, -1006, -699, -380, 143, 764, 1060,
-  790, 173, -437, -981, -1590, -2207, -2578, -2656, -2748, -3182, -3987, -4993,
-  -6060, -7032, -7639, -7708, -7444, -7264, -7335, -7521, -7831, -8605, -9958, -11267,
-  -11593, -10660, -9101, -7616, -6178, -4338, -2137, -378, 118, -653, -1806, -2211,
-  -1216, 1028, 3756, 6179, 8056, 9673, 11207, 12244, 12150, 10931, 9501, 8901,
-  9352, 10179, 10622, 10552, 10376, 10407, 10468, 10075, 8932, 7239, 5556, 4375,
-  3767, 3426, 3001, 2380, 1695, 1126, 761, 580, 492, 387, 215, 49,
-  21, 164, 350, 417, 345, 255, 262, 367, 501, 641, 856, 1244,
-  1807, 2371, 2613, 2257, 1300, 50, -1104, -1971, -2589, -3018, -3178, -2971,
-  -2527, -2229, -2429, -3156, -4148, -5125, -5984, -6691, -7096, -6966, -6221, -5093,
-  -4010, -3308, -3042, -3004, -2892, -2503, -1837, -1053, -289, 468, 1314, 2227,
-  3011, 3471, 3637, 3758, 4065, 4575, 5093, 5376, 5297, 4902, 4354, 3800,
-  3275, 2744, 2219, 1788, 1507, 1282, 927, 321, -488, -1312, -1931, -2222,
-  -2260, -2274, -2438, -2689, -2819, -2747, -2610, -2538, -2443, -2147, -1644, -1105,
-  -652, -284, -32, -19, -251, -475, -427, -153, 66, 95, 65, 92,
-  43, -307, -993, -1855, -2735, -3533, -4153, -4567, -4929, -5437, -6037, -6423,
-  -6470, -6494, -6923, -7768, -8631, -9230, -9693, -10224, -10645, -10455, -9348, -7562,
-  -5731, -4435, -3836, -3634, -3349, -2753, -2046, -1539, -1141, -275, 1578, 4269,
-  6996, 8938, 9826, 9964, 9828, 9716, 9674, 9648, 9653, 9820, 10276, 10940,
-  11482, 11545, 11023, 10118, 9119, 8163, 7207, 6180, 5119, 4170, 3479, 3076,
-  2813, 2446, 1827, 1060, 436, 180, 241, 351, 286, 62, -135, -172,
-  -109, -89, -150, -157, 60, 533, 1122, 1643, 1991, 2150, 2110, 1818,
-  1209, 307, -699, -1499, -1829, -1658, -1225, -884, -893, -1323, -2110, -3136,
-  -4240, -5216, -5859, -6060, -5856, -5401, -4885, -4463, -4206, -4102, -4088, -4083,
-  -4004, -3752, -3222, -2351, -1198, 9, 956, 1425, 1481, 1444, 1631, 2110,
-  2706, 3237, 3672, 4050, 4310, 4300, 3947, 3345, 2680, 2113, 1745, 1597,
-  1578, 1517, 1316, 1035, 763, 414, -208, -1127, -2070, -2712, -2974, -3002,
-  -2902, -2630, -2155, -1611, -1196, -1012, -1038, -1220, -1455, -1571, -1441, -1157,
-  -950, -883, -731, -295, 246, 449, 110, -496, -945, -1143, -1357, -1838,
-  -2534, -3196, -3643, -3897, -4130, -4552, -5249, -6050, -6602, -6726, -6697, -7037,
-  -7961, -9105, -9882, -10022, -9653, -8945, -7884, -6486, -5041, -3973, -3461, -3313,
-  -3191, -2845, -2120, -912, 763, 2690, 4565, 6193, 7530, 8557, 9211, 9467,
-  9411, 9217, 9117, 9368, 10122, 11191, 12012, 12012, 11113, 9802, 8659, 7873,
-  7234, 6518, 5759, 5144, 4745, 4410, 3887, 3052, 2036, 1145, 610, 390,
-  250, 44, -123, -42, 311, 705, 869, 718, 376, 58, -49, 162,
-  671, 1335, 1970, 2426, 2596, 2409, 1886, 1200, 594, 191, -80, -332,
-  -562, -701, -782, -966, -1376, -2001, -2768, -3632, -4518, -5230, -5557, -5487,
-  -5227, -4976, -4759, -4541, -4406, -4482, -4697, -4751, -4409, -3730, -2940, -2150,
-  -1325, -508, 113, 442, 646, 973, 1444, 1868, 2153, 2434, 2845, 3286,
-  3545, 3552, 3386, 3082, 2605, 2052, 1678, 1600, 1613, 1437, 1069, 720,
-  413, -91, -897, -1701, -2109, -2113, -2048, -2088, -2046, -1739, -1349, -1227,
-  -1457, -1806, -2065, -2238, -2340, -2240, -1829, -1249, -773, -508, -358, -282,
-  -407, -822, -1389, -1879, -2225, -2495, -2661, -2570, -2238, -2029, -2372, -3296,
-  -4357, -5086, -5436, -5736, -6249, -6912, -7496, -7886, -8090, -8036, -7563, -6682,
-  -5719, -5064, -4807, -4725, -4595, -4361, -3957, -3181, -1917, -399, 981, 2124,
-  3296, 4688, 6088, 7128, 7708, 7997, 8134, 8191, 8390, 9041, 10072, 10888,
-  10949, 10392, 9811, 9495, 9189, 8627, 7956, 7400, 6790, 5806, 4575, 3655,
-  3330, 3253, 2940, 2376, 1879, 1562, 1262, 928, 732, 701, 575, 220,
-  -52, 143, 679, 1055, 1082, 1113, 1477, 1967, 2136, 1920, 1674, 1624,
-  1587, 1309, 860, 502, 321, 165, -97, -426, -754, -1114, -1574, -2146,
-  -2804, -3532, -4265, -4854, -5161, -5190, -5064, -4904, -4778, -4727, -4769, -4863,
-  -4934, -4934, -4806, -4421, -3671, -2678, -1799, -1306, -1109, -888, -466, 66,
-  586, 1109, 1674, 2199, 2567, 2791, 2942, 2974, 2782, 2418, 2104, 1963,
-  1897, 1800, 1732, 1741, 1615, 1050, 78, -885, -1467, -1685, -1764, -1798,
-  -1742, -1640, -1626, -1718, -1804, -1866, -2022, -2254, -2294, -1978, -1569, -1475,
-  -1677, -1729, -1382, -951, -885, -1155, -1336, -1233, -1105, -1222, -1479, -1620,
-  -1686, -1971, -2591, -3323, -3886, -4207, -4345, -4368, -4431, -4820, -5679, -6707,
-  -7356, -7401, -7146, -6976, -6862, -6484, -5746, -4943, -4382, -4043, -3714, -3298,
-  -2819, -2209, -1300, -54, 1359, 2777, 4174, 5498, 6531, 7102, 7359, 7641,
-  8054, 8393, 8541, 8716, 9147, 9674, 9937, 9881, 9773, 9664, 9160, 7979,
-  6493, 5406, 4940, 4678, 4248, 3814, 3688, 3728, 3452, 2684, 1752, 1053,
-  693, 627, 855, 1256, 1471, 1273, 963, 1056, 1562, 1902, 1682, 1288,
-  1406, 2128, 2824, 2919, 2486, 1977, 1632, 1348, 981, 557, 179, -78,
-  -188, -220, -395, -933, -1774, -2586, -3142, -3584, -4166, -4821, -5187, -5076,
-  -4733, -4549, -4630, -4768, -4782, -4720, -4716, -4765, -4704, -4365, -3725, -2925,
-  -2188, -1668, -1342, -1058, -705, -326, -33, 156, 345, 625, 966, 1260,
-  1439, 1530, 1601, 1681, 1698, 1528, 1136, 679, 394, 349, 345, 150,
-  -207, -474, -517, -506, -688, -1047, -1323, -1332, -1164, -1037, -1052, -1171,
-  -1343, -1535, -1668, -1641, -1470, -1287, -1172, -1059, -877, -742, -868, -1295,
-  -1801, -2127, -2233, -2264, -2336, -2448, -2583, -2779, -3059, -3363, -3620, -3868,
-  -4225, -4764, -5438, -6111, -6610, -6763, -6484, -5883, -5250, -4846, -4679, -4533,
-  -4214, -3751, -3336, -3084, -2892, -2493, -1653, -339, 1246, 2756, 3880, 4512,
-  4801, 5042, 5466, 6100, 6798, 7402, 7881, 8283, 8613, 8792, 8776, 8633,
-  8464, 8258, 7908, 7379, 6788, 6273, 5850, 5448, 5036, 4640, 4241, 3778,
-  3266, 2837, 2585, 2438, 2274, 2100, 2026, 2058, 2050, 1920, 1788, 1812,
-  1955, 2028, 1973, 1949, 2107, 2362, 2486, 2356, 2035, 1645, 1263, 947,
-  742, 614, 437, 134, -239, -595, -963, -1440, -1995, -2470, -2795, -3123,
-  -3608, -4136, -4407, -4308, -4092, -4098, -4369, -4649, -4702, -4524, -4253, -3995,
-  -3799, -3697, -3645, -3479, -3055, -2451, -1923, -1620, -1428, -1155, -802, -528,
-  -401, -303, -123, 81, 185, 189, 206, 287, 364, 370, 331, 289,
-  209, 37, -204, -409, -512, -534, -538, -567, -631, -721, -810, -863,
-  -859, -795, -681, -564, -543, -690, -945, -1125, -1102, -932, -773, -713,
-  -744, -866, -1111, -1432, -1677, -1750, -1746, -1845, -2114, -2469, -2798, -3039,
-  -3153, -3150, -3165, -3384, -3837, -4340, -4716, -4992, -5257, -5404, -5206, -4671,
-  -4136, -3888, -3825, -3618, -3157, -2672, -2414, -2362, -2272, -1900, -1117, 37,
-  1313, 2365, 3037, 3517, 4064, 4624, 4893, 4806, 4768, 5229, 6124, 6921,
-  7213, 7116, 7022, 7123, 7263, 7192, 6820, 6263, 5732, 5403, 5291, 5227,
-  5018, 4664, 4352, 4201, 4089, 3812, 3375, 3026, 2960, 3098, 3185, 3081,
-  2866, 2699, 2642, 2646, 2648, 2635, 2634, 2661, 2708, 2734, 2681, 2498,
-  2162, 1699, 1185, 725, 406, 237, 148, 38, -168, -507, -974, -1529,
-  -2093, -2588, -2986, -3309, -3577, -3786, -3936, -4052, -4150, -4191, -4136, -4017,
-  -3934, -3934, -3947, -3863, -3659, -3415, -3206, -3018, -2792, -2502, -2167, -1817,
-  -1465, -1130, -843, -629, -503, -462, -481, -508, -496, -444, -387, -341,
-  -278, -184, -113, -146, -307, -545, -796, -1029, -1209, -1284, -1244, -1165,
-  -1142, -1187, -1223, -1191, -1101, -975, -807, -625, -538, -649, -907, -1116,
-  -1116, -923, -668, -461, -344, -343, -479, -717, -966, -1160, -1315, -1489,
-  -1712, -1980, -2272, -2551, -2769, -2917, -3062, -3268, -3511, -3715, -3894, -4153,
-  -4517, -4824, -4892, -4742, -4560, -4412, -4115, -3480, -2603, -1843, -1499, -1563,
-  -1755, -1730, -1260, -349, 753, 1719, 2412, 2978, 3621, 4301, 4763, 4864,
-  4782, 4827, 5108, 5467, 5715, 5848, 5977, 6122, 6153, 5941, 5518, 5065,
-  4749, 4570, 4400, 4150, 3882, 3743, 3774, 3847, 3773, 3493, 3121, 2852,
-  2827, 3060, 3423, 3723, 3831, 3777, 3696, 3670, 3658, 3598, 3517, 3498,
-  3556, 3610, 3584, 3469, 3262, 2920, 2422, 1851, 1337, 920, 524, 82,
-  -385, -817, -1214, -1620, -2038, -2418, -2732, -3024, -3348, -3701, -4022, -4261,
-  -4396, -4404, -4264, -4005, -3727, -3515, -3359, -3178, -2950, -2758, -2674, -2624,
-  -2448, -2084, -1652, -1319, -1130, -1012, -918, -875, -902, -950, -971, -982,
-  -1018, -1077, -1148, -1275, -1493, -1730, -1851, -1837, -1828, -1935, -2074, -2062,
-  -1860, -1620, -1519, -1597, -1763, -1866, -1758, -1386, -879, -482, -306, -210,
-  -8, 257, 366, 229, 19, -53, 22, 104, 101, 4, -195, -493,
-  -786, -943, -1001, -1173, -1587, -2129, -2608, -2985, -3326, -3587, -3619, -3409,
-  -3180, -3183, -3462, -3861, -4181, -4273, -4082, -3713, -3406, -3292, -3182, -2744,
-  -1930, -1104, -671, -651, -729, -624, -299, 177, 767, 1423, 2023, 2457,
-  2739, 2945, 3099, 3200, 3326, 3585, 3944, 4204, 4220, 4081, 4005, 4079,
-  4181, 4165, 4055, 4016, 4151, 4368, 4458, 4301, 3995, 3777, 3804, 4012,
-  4183, 4164, 3980, 3796, 3774, 3978, 4323, 4602, 4621, 4384, 4111, 4023,
-  4093, 4099, 3919, 3682, 3595, 3669, 3721, 3592, 3292, 2917, 2530, 2156,
-  1824, 1544, 1279, 991, 691, 390, 34, -435, -949, -1336, -1506, -1552,
-  -1624, -1764, -1930, -2133, -2426, -2781, -3060, -3165, -3134, -3063, -2974, -2839,
-  -2677, -2547, -2455, -2382, -2374, -2523, -2802, -3011, -2972, -2725, -2465, -2308,
-  -2214, -2123, -2060, -2087, -2212, -2406, -2650, -2889, -3008, -2922, -2687, -2453,
-  -2307, -2240, -2236, -2307, -2410, -2425, -2287, -2080, -1918, -1790, -1609, -1387,
-  -1231, -1158, -1035, -787, -543, -475, -544, -547, -408, -267, -271, -370,
-  -437, -473, -587, -797, -977, -1038, -1051, -1145, -1332, -1518, -1644, -1761,
-  -1936, -2160, -2369, -2499, -2516, -2412, -2220, -2041, -1982, -2063, -2183, -2217,
-  -2146, -2051, -1985, -1878, -1618, -1202, -755, -396, -143, 29, 103, 78,
-  63, 213, 555, 961, 1326, 1678, 2037, 2265, 2224, 2035, 2026, 2346,
-  2775, 2995, 2951, 2825, 2753, 2751, 2862, 3159, 3532, 3670, 3439, 3134,
-  3157, 3493, 3728, 3610, 3382, 3416, 3699, 3866, 3712, 3430, 3319, 3434,
-  3621, 3774, 3903, 3988, 3944, 3745, 3501, 3333, 3256, 3231, 3266, 3380,
-  3479, 3381, 3025, 2597, 2350, 2325, 2292, 2028, 1584, 1217, 1064, 984,
-  752, 353, -12, -191, -248, -341, -513, -699, -863, -1045, -1254, -1417,
-  -1483, -1486, -1475, -1438, -1352, -1279, -1311, -1434, -1528, -1521, -1469, -1455,
-  -1486, -1536, -1627, -1771, -1879, -1840, -1708, -1691, -1908, -2226, -2423, -2460,
-  -2498, -2666, -2910, -3096, -3161, -3127, -3032, -2920, -2862, -2902, -2976, -2963,
-  -2829, -2672, -2578, -2497, -2311, -2011, -1712, -1503, -1348, -1158, -938, -795,
-  -802, -889, -906, -776, -575, -468, -550, -768, -974, -1049, -1004, -964,
-  -1063, -1352, -1757, -2118, -2288, -2234, -2065, -1954, -2014, -2215, -2425, -2524,
-  -2484, -2361, -2233, -2130, -2013, -1831, -1589, -1365, -1240, -1213, -1205, -1131,
-  -949, -660, -285, 106, 398, 497, 439, 373, 424, 589, 771, 914,
-  1033, 1152, 1235, 1232, 1150, 1056, 1017, 1062, 1177, 1323, 1441, 1485,
-  1464, 1432, 1428, 1443, 1467, 1547, 1750, 2058, 2340, 2467, 2440, 2382,
-  2408, 2532, 2705, 2907, 3146, 3386, 3529, 3500, 3344, 3201, 3176, 3267,
-  3396, 3509, 3592, 3633, 3583, 3405, 3122, 2819, 2598, 2516, 2560, 2643,
-  2655, 2536, 2325, 2111, 1925, 1723, 1478, 1270, 1223, 1335, 1442, 1370,
-  1110, 817, 639, 591, 588, 555, 483, 400, 339, 303, 259, 159,
-  -5, -164, -239, -240, -285, -459, -708, -892, -950, -959, -1011, -1103,
-  -1181, -1254, -1396, -1620, -1824, -1910, -1912, -1941, -2036, -2115, -2111, -2074,
-  -2092, -2160, -2184, -2126, -2056, -2052, -2086, -2062, -1952, -1817, -1723, -1670,
-  -1626, -1581, -1546, -1515, -1481, -1464, -1477, -1474, -1381, -1207, -1079, -1131,
-  -1351, -1580, -1653, -1545, -1374, -1290, -1360, -1524, -1643, -1621, -1498, -1407,
-  -1438, -1539, -1589, -1542, -1472, -1455, -1471, -1438, -1331, -1214, -1156, -1151,
-  -1145, -1114, -1087, -1093, -1115, -1107, -1041, -936, -852, -851, -950, -1084,
-  -1135, -1022, -793, -594, -540, -603, -669, -672, -650, -662, -682, -617,
-  -425, -174, 19, 102, 110, 113, 152, 230, 320, 388, 429, 478,
-  578, 726, 859, 927, 949, 985, 1062, 1162, 1261, 1359, 1446, 1482,
-  1442, 1368, 1341, 1406, 1544, 1708, 1852, 1933, 1918, 1840, 1789, 1826,
-  1907, 1953, 1964, 2026, 2170, 2305, 2319, 2229, 2147, 2124, 2110, 2069,
-  2073, 2193, 2358, 2397, 2253, 2064, 1992, 2025, 2009, 1869, 1708, 1672,
-  1746, 1764, 1600, 1317, 1095, 1039, 1087, 1106, 1026, 877, 707, 531,
-  368, 281, 316, 406, 400, 232, 13, -88, -45, 17, -6, -78,
-  -122, -153, -234, -341, -383, -368, -431, -631, -813, -790, -617, -554,
-  -724, -954, -1016, -929, -891, -957, -974, -865, -805, -994, -1311, -1388,
-  -1037, -494, -187, -314, -705, -1038, -1107, -919, -653, -532, -650, -859,
-  -884, -629, -340, -376, -807, -1306, -1470, -1207, -778, -510, -540, -800,
-  -1144, -1439, -1590, -1558, -1384, -1167, -1013, -994, -1129, -1355, -1540, -1564,
-  -1428, -1243, -1104, -1012, -941, -928, -1013, -1115, -1080, -874, -650, -572,
-  -619, -663, -668, -710, -777, -717, -462, -196, -168, -373, -569, -608,
-  -596, -666, -727, -600, -332, -184, -303, -538, -665, -663, -644, -609,
-  -447, -166, 35, 5, -148, -186, -26, 207, 369, 444, 480, 496,
-  506, 557, 677, 807, 875, 904, 982, 1106, 1161, 1064, 900, 821,
-  859, 903, 862, 781, 767, 837, 895, 840, 673, 497, 430, 514,
-  679, 786, 740, 580, 448, 451, 553, 635, 644, 654, 751, 904,
-  983, 914, 774, 697, 732, 810, 852, 858, 875, 910, 922, 891,
-  845, 810, 769, 696, 609, 548, 524, 508, 489, 495, 533, 551,
-  495, 384, 295, 252, 206, 128, 79, 132, 254, 318, 267, 184,
-  171, 211, 206, 140, 111, 178, 250, 202, 67, 14, 130, 296,
-  333, 220, 87, 39, 49, 51, 52, 87, 123, 86, -22, -105,
-  -103, -69, -89, -160, -195, -153, -78, -34, -38, -75, -141, -209,
-  -225, -175, -138, -211, -352, -401, -269, -77, -27, -165, -353, -450,
-  -466, -484, -511, -483, -398, -351, -419, -560, -665, -679, -631, -556,
-  -463, -367, -314, -330, -379, -404, -394, -382, -369, -316, -206, -97,
-  -76, -164, -296, -390, -419, -404, -374, -351, -354, -396, -473, -560,
-  -624, -642, -620, -583, -560, -552, -530, -468, -388, -340, -346, -358,
-  -309, -191, -64, 13, 38, 56, 97, 154, 205, 234, 243, 246,
-  260, 285, 301, 275, 204, 116, 43, -15, -74, -138, -194, -233,
-  -262, -276, -263, -220, -182, -191, -246, -304, -321, -291, -237, -173,
-  -96, -5, 85, 160, 222, 280, 326, 339, 307, 256, 225, 238,
-  273, 289, 263, 218, 187, 175, 154, 89, -18, -138, -241, -311,
-  -344, -347, -335, -333, -355, -395, -427, -423, -371, -284, -193, -125,
-  -80, -30, 47, 141, 222, 272, 307, 353, 414, 483, 553, 614,
-  642, 616, 547, 487, 477, 504, 524, 506, 458, 395, 320, 238,
-  168, 133, 137, 159, 173, 164, 116, 31, -60, -105, -65, 49,
-  183, 282, 307, 260, 189, 159, 206, 292, 347, 348, 346, 394,
-  461, 461, 362, 241, 197, 233, 263, 225, 151, 105, 83, 23,
-  -90, -183, -178, -101, -53, -91, -173, -223, -234, -252, -294, -316,
-  -273, -180, -94, -47, -39, -59, -104, -152, -166, -130, -69, -16,
-  18, 29, 0, -81, -170, -203, -167, -125, -146, -223, -290, -305,
-  -287, -272, -271, -279, -297, -323, -337, -321, -286, -258, -243, -216,
-  -165, -112, -85, -75, -55, -12, 38, 84, 128, 172, 199, 193,
-  170, 159, 167, 169, 142, 96, 68, 80, 104, 87, -1, -129,
-  -226, -249, -224, -214, -254, -318, -358, -353, -332, -335, -375, -431,
-  -465, -451, -392, -321, -273, -257, -261, -268, -281, -308, -339, -351,
-  -330, -283, -230, -188, -173, -205, -291, -397, -468, -474, -435, -400,
-  -392, -399, -401, -405, -427, -461, -477, -456, -419, -390, -360, -299,
-  -210, -147, -159, -213, -215, -115, 31, 117, 107, 65, 72, 132,
-  188, 198, 179, 174, 191, 201, 182, 146, 119, 113, 118, 115,
-  94, 58, 20, -10, -28, -38, -39, -20, 22, 71, 96, 85,
-  62, 64, 103, 154, 194, 218, 235, 243, 232, 214, 220, 264,
-  321, 347, 333, 305, 285, 260, 211, 153, 126, 149, 196, 223,
-  215, 183, 137, 83, 31, -2, -9, -4, 7, 30, 71, 109,
-  106, 48, -30, -76, -63, -5, 57, 86, 75, 45, 29, 34,
-  46, 49, 52, 71, 106, 136, 146, 148, 151, 152, 147, 152,
-  184, 227, 241, 214, 177, 167, 181, 197, 209, 231, 256, 249,
-  192, 115, 67, 68, 98, 134, 164, 175, 157, 112, 66, 36,
-  15, -1, 7, 52, 107, 121, 77, 15, -24, -47, -78, -104,
-  -88, -31, 16, 7, -41, -79, -88, -91, -101, -103, -86, -69,
-  -75, -94, -98, -88, -91, -115, -128, -104, -58, -38, -67, -124,
-  -179, -212, -211, -169, -102, -62, -85, -148, -189, -178, -143, -120,
-  -96, -37, 44, 83, 46, -21, -37, 23, 102, 144, 154, 174,
-  215, 244, 239, 230, 254, 299, 312, 264, 194, 167, 196, 237,
-  240, 207, 178, 171, 163, 120, 50, -4, -7, 32, 77, 102,
-  104, 88, 60, 30, 19, 43, 98, 155, 193, 207, 198, 169,
-  129, 108, 133, 195, 242, 232, 181, 138, 129, 127, 91, 29,
-  -10, -1, 27, 23, -21, -74, -108, -124, -132, -123, -88, -50,
-  -45, -82, -119, -119, -87, -62, -55, -42, -7, 30, 40, 29,
-  29, 46, 54, 44, 40, 63, 88, 73, 25, 0, 35, 97,
-  123, 99, 61, 38, 24, 8, 1, 18, 45, 58, 62, 81,
-  106, 88, 3, -94, -112, -27, 91, 151, 127, 55, -19, -76,
-  -105, -93, -41, 21, 56, 46, -2, -72, -142, -188, -192, -160,
-  -124, -104, -99, -104, -132, -193, -262, -294, -269, -216, -175, -158,
-  -154, -167, -210, -274, -315, -298, -240, -182, -147, -132, -133, -163,
-  -218, -261, -254, -194, -120, -66, -48, -58, -86, -113, -121, -108,
-  -88, -64, -27, 24, 59, 43, -13, -52, -40, 9, 54, 76,
-  85, 85, 69, 48, 50, 81, 112, 115, 99, 101, 131, 164,
-  169, 145, 116, 103, 111, 135, 159, 159, 124, 68, 21, 4,
-  12, 29, 41, 36, 9, -32, -64, -76, -78, -87, -96, -86,
-  -55, -25, -20, -34, -42, -32, -13, 7, 27, 42, 43, 32,
-  31, 58, 101, 128, 122, 92, 59, 31, 17, 25, 55, 82,
-  68, 9, -55, -83, -75, -70, -87, -108, -105, -83, -75, -97,
-  -128, -141, -130, -108, -84, -63, -54, -61, -72, -61, -24, 10,
-  18, 8, 7, 21, 31, 27, 28, 46, 64, 57, 41, 52,
-  91, 107, 62, -11, -45, -16, 33, 52, 43, 38, 44, 34,
-  -6, -50, -62, -38, -4, 16, 16, -1, -25, -43, -41, -32,
-  -42, -77, -105, -90, -42, -14, -38, -86, -109, -98, -90, -111,
-  -137, -130, -92, -66, -76, -106, -126, -135, -149, -167, -162, -118,
-  -66, -46, -66, -96, -106, -102, -97, -90, -63, -16, 27, 40,
-  30, 21, 24, 34, 42, 58, 85, 115, 133, 140, 145, 148,
-  145, 141, 150, 171, 180, 156, 117, 102, 123, 148, 140, 109,
-  92, 102, 113, 95, 58, 38, 48, 69, 78, 73, 66, 56,
-  40, 24, 23, 41, 63, 74, 76, 74, 66, 44, 19, 11,
-  29, 54, 65, 64, 67, 76, 70, 40, 8, 4, 30, 56,
-  60, 52, 52, 52, 35, 1, -17, -1, 28, 34, 19, 14,
-  33, 50, 31, -16, -45, -31, 4, 23, 15, 2, 2, 12,
-  18, 14, 4, -8, -18, -13, 6, 23, 23, 9, 4, 17,
-  24, 6, -23, -28, -1, 25, 20, -10, -30, -27, -19, -27,
-  -44, -50, -46, -49, -64, -75, -70, -59, -59, -71, -79, -77,
-  -73, -77, -84, -86, -81, -76, -75, -77, -81, -90, -103, -111,
-  -106, -91, -80, -81, -89, -95, -99, -110, -126, -142, -148, -147,
-  -146, -146, -143, -137, -135, -142, -151, -154, -145, -133, -123, -115,
-  -107, -97, -89, -85, -79, -71, -61, -51, -40, -28, -14, -1,
-  8, 18, 29, 41, 51, 57, 60, 62, 67, 76, 87, 98,
-  104, 104, 99, 93, 90, 94, 104, 115, 119, 115, 107, 100,
-  90, 78, 69, 67, 73, 77, 74, 67, 61, 52, 40, 29,
-  28, 37, 46, 45, 35, 25, 18, 13, 8, 3, 0, 0,
-  0, -1, -4, -10, -19, -24, -19, -7, 3, 3, -6, -16,
-  -23, -29, -35, -37, -31, -25, -26, -33, -40, -42, -42, -43,
-  -44, -44, -41, -39, -40, -43, -44, -42, -39, -36, -34, -33,
-  -33, -34, -32, -29, -24, -18, -13, -9, -7, -6, -5, -1,
-  5, 9, 12, 14, 15, 13, 9, 5, 1, -1, 0, 2,
-  4, 3, -1, -6, -11, -14, -15, -14, -12, -8, -6, -7,
-  -8, -7, -5, -3, -3, -4, -7, -12, -19, -27, -34, -40,
-  -45, -51, -58, -66, -73, -80, -88, -95, -101, -105, -109, -112,
-  -113, -111, -105, -98, -93, -90, -87, -80, -72, -64, -55, -45,
-  -35, -27, -22, -17, -10, 0, 11, 19, 24, 28, 31, 33,
-  35, 40, 46, 52, 56, 57, 56, 54, 54, 56, 59, 61,
-  61, 61, 64, 70, 78, 86, 94, 100, 103, 102, 101, 102,
-  107, 113, 118, 120, 119, 117, 113, 109, 107, 108, 110, 110,
-  105, 96, 86, 77, 69, 62, 57, 53, 50, 47, 42, 37,
-  33, 30, 26, 21, 17, 14, 14, 14, 14, 13, 11, 9,
-  7, 5, 5, 7, 10, 13, 12, 8, 2, -4, -9, -14,
-  -18, -21, -22, -23, -26, -31, -35, -38, -40, -42, -45, -46,
-  -45, -43, -41, -41, -40, -37, -32, -27, -24, -21, -17, -13,
-  -9, -7, -4, 1, 7, 12, 14, 13, 12, 12, 12, 11,
-  11, 12, 15, 17, 15, 12, 10, 11, 14, 16, 17, 18,
-  19, 18, 13, 7, 3, 3, 4, 4, 1, -2, -5, -8,
-  -14, -21, -27, -31, -36, -43, -53, -63, -70, -74, -78, -82,
-  -84, -84, -83, -84, -86, -88, -88, -86, -84, -83, -81, -77,
-  -71, -66, -62, -58, -53, -46, -40, -36, -33, -28, -20, -13,
-  -9, -6, -2, 4, 9, 11, 12, 14, 18, 20, 19, 15,
-  13, 14, 15, 15, 15, 18, 24, 31, 35, 35, 34, 35,
-  38, 40, 41, 43, 47, 51, 53, 51, 50, 52, 56, 59,
-  58, 55, 53, 52, 49, 43, 36, 32, 32, 31, 25, 17,
-  11, 8, 5, -1, -8, -12, -13, -14, -18, -24, -28, -28,
-  -28, -31, -36, -39, -38, -36, -39, -46, -51, -52, -49, -48,
-  -51, -54, -54, -53, -55, -61, -66, -64, -59, -56, -56, -57,
-  -54, -49, -46, -46, -46, -42, -37, -34, -35, -35, -30, -23,
-  -18, -17, -19, -18, -14, -9, -9, -11, -10, -5, 0, 0,
-  -3, -3, 0, 0, -6, -14, -17, -14, -11, -14, -21, -25,
-  -26, -29, -36, -44, -47, -47, -48, -55, -64, -71, -73, -74,
-  -78, -83, -85, -83, -80, -80, -83, -84, -82, -78, -76, -77,
-  -79, -78, -74, -71, -69, -67, -63, -56, -48, -41, -32, -21,
-  -12, -7, -5, -1, 9, 21, 31, 38, 44, 53, 63, 71,
-  76, 80, 85, 89, 89, 87, 86, 87, 88, 87, 85, 87,
-  91, 92, 86, 80, 82, 87, 86, 74, 62, 64, 76, 83,
-  76, 67, 68, 77, 79, 69, 57, 59, 68, 67, 52, 38,
-  38, 47, 45, 30, 13, 6, 7, 5, -4, -12, -16, -19,
-  -25, -34, -39, -38, -36, -36, -40, -44, -46, -45, -42, -38,
-  -39, -43, -48, -48, -43, -39, -41, -47, -50, -46, -40, -39,
-  -42, -46, -46, -42, -40, -40, -37, -30, -22, -20, -24, -28,
-  -24, -11, 0, 3, 0, 1, 8, 14, 15, 13, 14, 19,
-  23, 23, 22, 25, 30, 31, 25, 17, 17, 25, 34, 35,
-  28, 19, 14, 13, 12, 10, 9, 9, 9, 4, -4, -11,
-  -11, -6, -1, -2, -7, -12, -15, -18, -22, -25, -23, -19,
-  -20, -27, -34, -35, -29, -23, -24, -32, -39, -42, -42, -41,
-  -43, -48, -52, -53, -49, -43, -39, -38, -36, -31, -25, -20,
-  -14, -4, 6, 10, 6, 5, 15, 35, 53, 65, 77, 96,
-  114, 122, 117, 110, 106, 99, 85, 72, 73, 91, 110, 109,
-  88, 62, 54, 66, 82, 82, 68, 58, 63, 72, 68, 51,
-  44, 57, 66, 44, 5, -10, 20, 56, 55, 21, 5, 29,
-  57, 41, -9, -37, -16, 16, 11, -22, -32, -1, 28, 9,
-  -43, -70, -43, 1, 11, -18, -45, -41, -19, -12, -27, -40,
-  -32, -17, -17, -33, -42, -26, 1, 14, 5, -11, -17, -12,
-  -9, -11, -8, 8, 24, 22, 2, -14, -10, 10, 27, 28,
-  18, 9, 9, 13, 16, 17, 20, 26, 31, 29, 22, 15,
-  13, 17, 21, 19, 11, 3, 0, 3, 5, 3, 0, 2,
-  9, 12, 4, -12, -23, -19, -5, 4, 0, -12, -19, -19,
-  -20, -24, -25, -19, -13, -16, -30, -41, -41, -34, -32, -36,
-  -40, -40, -40, -43, -47, -47, -43, -42, -45, -48, -46, -42,
-  -41, -39, -34, -28, -26, -29, -30, -21, -8, 0, 2, 7,
-  19, 34, 43, 46, 49, 57, 65, 71, 74, 79, 85, 88,
-  87, 81, 76, 75, 76, 75, 72, 66, 61, 58, 58, 57,
-  55, 51, 47, 44, 43, 42, 40, 40, 39, 38, 36, 35,
-  38, 42, 42, 38, 32, 29, 29, 28, 26, 22, 20, 17,
-  13, 10, 9, 6, 0, -5, -6, -3, 0, -2, -6, -6,
-  -4, -6, -12, -16, -14, -10, -10, -12, -11, -5, -2, -5,
-  -11, -12, -9, -9, -15, -23, -27, -28, -31, -35, -36, -32,
-  -28, -28, -32, -34, -33, -31, -30, -28, -25, -21, -20, -21,
-  -19, -14, -9, -7, -7, -7, -5, -7, -12, -16, -17, -13,
-  -12, -15, -18, -20, -23, -26, -28, -23, -18, -20, -31, -42,
-  -43, -37, -32, -34, -37, -37, -36, -38, -40, -38, -35, -37,
-  -45, -51, -50, -46, -46, -51, -52, -48, -43, -44, -50, -52,
-  -49, -42, -38, -38, -40, -39, -36, -30, -24, -18, -15, -13,
-  -10, -4, 2, 7, 10, 15, 21, 26, 26, 24, 25, 31,
-  38, 41, 39, 38, 41, 45, 45, 39, 32, 31, 36, 41,
-  42, 41, 40, 40, 39, 36, 32, 30, 32, 38, 42, 42,
-  40, 40, 43, 44, 40, 35, 33, 36, 38, 35, 29, 26,
-  28, 31, 29, 21, 15, 14, 14, 13, 10, 9, 12, 15,
-  12, 8, 6, 6, 5, 3, 1, -2, -3, -2, -1, 0,
-  -2, -8, -13, -13, -11, -15, -24, -30, -27, -19, -19, -29,
-  -39, -39, -31, -27, -33, -42, -44, -39, -36, -40, -47, -49,
-  -48, -46, -48, -51, -50, -46, -42, -41, -41, -41, -37, -31,
-  -28, -28, -31, -32, -29, -24, -22, -25, -29, -29, -26, -26,
-  -29, -31, -26, -18, -14, -17, -20, -16, -5, 4, 5, 1,
-  0, 3, 6, 6, 4, 3, 3, 4, 2, -2, -5, -6,
-  -5, -5, -6, -12, -18, -20, -18, -16, -18, -22, -25, -23,
-  -21, -21, -23, -23, -19, -14, -13, -16, -17, -12, -3, 4,
-  4, 1, -2, -1, 2, 2, -1, -2, -1, 2, 3, 3,
-  6, 13, 22, 28, 29, 28, 29, 34, 39, 41, 39, 36,
-  35, 37, 40, 42, 40, 40, 43, 47, 50, 51, 52, 56,
-  61, 62, 58, 56, 57, 60, 60, 58, 54, 55, 59, 61,
-  58, 54, 53, 54, 56, 54, 49, 44, 42, 41, 40, 36,
-  29, 21, 15, 12, 9, 4, -3, -11, -16, -19, -24, -29,
-  -34, -38, -41, -43, -44, -44, -44, -45, -48, -50, -48, -45,
-  -46, -49, -50, -47, -43, -41, -44, -48, -49, -49, -50, -50,
-  -48, -46, -45, -48, -50, -47, -42, -41, -46, -51, -51, -48,
-  -47, -48, -46, -41, -36, -37, -40, -36, -24, -13, -10, -12,
-  -9, 0, 7, 6, 3, 6, 14, 15, 8, 3, 9, 21,
-  25, 14, -1, -4, 7, 19, 21, 14, 11, 16, 23, 22,
-  15, 7, 7, 13, 17, 13, 3, -6, -12, -17, -24, -31,
-  -36, -36, -36, -39, -43, -45, -44, -41, -40, -39, -37, -31,
-  -23, -17, -14, -13, -12, -8, -3, 1, 4, 12, 22, 30,
-  27, 13, 2, 6, 20, 31, 26, 13, 7, 14, 24, 27,
-  22, 17, 21, 29, 36, 34, 29, 28, 33, 41, 45, 45,
-  42, 39, 34, 25, 18, 17, 22, 27, 30, 31, 33, 36,
-  34, 31, 28, 26, 21, 16, 17, 22, 21, 7, -13, -22,
-  -16, -8, -12, -23, -23, -13, -5, -9, -16, -13, -6, -7,
-  -18, -26, -21, -12, -10, -13, -11, -2, 1, -7, -16, -11,
-  6, 18, 20, 19, 25, 34, 38, 34, 30, 30, 32, 31,
-  29, 29, 27, 22, 15, 10, 12, 16, 22, 29, 36, 39,
-  32, 18, 7, 5, 13, 19, 14, -1, -15, -16, -9, -6,
-  -14, -26, -25, -10, -1, -13, -38, -55, -52, -38, -31, -36,
-  -47, -54, -56, -56, -58, -59, -59, -57, -52, -49, -48, -49,
-  -49, -49, -53, -63, -73, -72, -60, -49, -49, -58, -63, -59,
-  -51, -47, -43, -31, -12, 5, 7, -2, -11, -8, 5, 11,
-  6, -1, 10, 36, 51, 31, -12, -33, -10, 36, 57, 38,
-  12, 11, 32, 45, 37, 26, 29, 42, 48, 45, 42, 43,
-  39, 29, 21, 25, 31, 27, 14, 9, 23, 38, 35, 14,
-  2, 15, 40, 45, 19, -10, -9, 20, 45, 37, 11, 7,
-  35, 66, 63, 31, 3, 4, 22, 32, 27, 18, 14, 15,
-  16, 18, 24, 35, 48, 57, 56, 39, 18, 11, 25, 40,
-  35, 14, 4, 22, 46, 45, 15, -10, -1, 33, 56, 45,
-  14, -3, 10, 40, 54, 41, 16, 7, 24, 44, 42, 14,
-  -13, -16, 3, 22, 24, 13, 1, -4, -3, 6, 25, 47,
-  54, 35, -1, -28, -21, 13, 40, 27, -19, -57, -54, -21,
-  2, -10, -41, -60, -55, -41, -30, -23, -20, -28, -46, -51,
-  -29, -2, -5, -41, -69, -56, -22, -10, -26, -40, -29, -20,
-  -39, -71, -77, -48, -21, -25, -42, -42, -20, -6, -11, -22,
-  -22, -15, -13, -9, 6, 24, 20, -8, -33, -33, -13, 0,
-  -4, -16, -22, -23, -23, -19, -8, 1, 0, -8, -17, -26,
-  -39, -54, -53, -27, 8, 23, 13, -6, -13, -13, -17, -23,
-  -18, 0, 8, -14, -57, -90, -97, -85, -71, -57, -41, -29,
-  -36, -57, -66, -43, 2, 33, 25, -10, -36, -32, -6, 18,
-  24, 14, -1, -19, -39, -52, -45, -18, 2, -10, -48, -74,
-  -63, -32, -19, -35, -42, -8, 55, 94, 79, 31, -10, -24,
-  -20, -5, 24, 57, 59, 8, -71, -123, -114, -66, -23, -8,
-  -17, -36, -58, -70, -59, -31, -8, -5, -9, -4, 2, -10,
-  -35, -35, 7, 56, 62, 21, -18, -19, 3, 10, -8, -21,
-  -12, 8, 16, 11, 0, -20, -53, -81, -80, -50, -24, -32,
-  -59, -73, -62, -43, -30, -19, -9, -9, -22, -26, -6, 18,
-  2, -56, -103, -93, -41, -9, -33, -89, -131, -134, -102, -52,
-  -8, -4, -49, -100, -95, -27, 38, 33, -16, -30, 21, 67,
-  38, -36, -69, -45, -51, -147, -270, -296, -180, 15, 195, 277,
-  183, -108, -448, -572, -367, -44, 84, -26, -122, -27, 135, 195,
-  258, 568, 1118, 1667, 2130, 2676, 3264, 3388, 2683, 1641, 1253, 1759,
-  2169, 1410, -276, -1525, -1471, -707, -424, -959, -1594, -1642, -1232, -928,
-  -929, -955, -728, -276, 226, 659, 945, 1024, 924, 772, 640, 500,
-  376, 413, 619, 655, 105, -987, -2011, -2325, -1820, -932, -228, -57,
-  -429, -1021, -1324, -1033, -376, 97, 123, -34, -56, -58, -351, -818,
-  -937, -522, -106, -292, -924, -1289, -1105, -901, -1223, -1805, -1884, -1228,
-  -441, -183, -387, -458, -59, 546, 899, 873, 733, 813, 1171, 1489,
-  1320, 550, -374, -817, -633, -319, -374, -669, -682, -264, 150, 177,
-  48, 270, 914, 1533, 1754, 1665, 1530, 1390, 1139, 816, 586, 484,
-  392, 263, 165, 74, -156, -499, -664, -463, -152, -134, -377, -410,
-  22, 587, 812, 702, 645, 794, 880, 689, 420, 388, 546, 576,
-  347, 42, -170, -334, -497, -526, -339, -142, -211, -485, -603, -393,
-  -101, -44, -222, -411, -489, -478, -358, -88, 173, 135, -240, -614,
-  -688, -567, -519, -509, -270, 182, 430, 212, -181, -272, -33, 126,
-  -48, -360, -520, -518, -507, -505, -426, -319, -351, -553, -745, -741,
-  -490, -19, 597, 1137, 1289, 958, 430, 131, 288, 899, 1818, 2670,
-  2833, 1935, 459, -539, -549, -161, -215, -645, -712, -288, -248, -1218,
-  -2431, -2459, -952, 907, 1804, 1629, 1189, 1051, 1168, 1404, 1770, 2046,
-  1731, 712, -347, -735, -648, -927, -1809, -2440, -1940, -646, 183, -150,
-  -981, -1154, -361, 655, 1104, 982, 803, 781, 585, -97, -979, -1391,
-  -1042, -409, -282, -946, -1935, -2559, -2549, -2133, -1614, -1070, -482, 49,
-  333, 302, 89, -75, 21, 456, 1055, 1393, 1114, 333, -435, -829,
-  -1003, -1241, -1403, -1069, -309, 95, -507, -1701, -2299, -1609, -157, 948,
-  1142, 703, 182, -120, -122, 191, 662, 897, 594, -61, -521, -471,
-  -164, -84, -381, -729, -721, -286, 270, 571, 489, 211, 20, 23,
-  101, 122, 149, 334, 638, 789, 607, 279, 162, 331, 458, 238,
-  -194, -429, -346, -331, -813, -1658, -2191, -1884, -907, 67, 539, 545,
-  391, 245, 134, 166, 507, 1026, 1223, 723, -204, -827, -728, -250,
-  -49, -334, -725, -818, -669, -607, -729, -780, -501, 46, 554, 774,
-  667, 352, 7, -183, -101, 223, 600, 776, 553, -113, -1033, -1802,
-  -2022, -1617, -948, -505, -486, -681, -766, -611, -297, 51, 380, 693,
-  1018, 1365, 1624, 1523, 846, -232, -1127, -1320, -868, -369, -402, -990,
-  -1597, -1598, -810, 329, 1086, 1064, 594, 412, 875, 1579, 1875, 1635,
-  1306, 1236, 1235, 944, 415, 43, 14, 108, 76, -17, 50, 319,
-  635, 851, 904, 813, 765, 1096, 1900, 2681, 2717, 1908, 988, 675,
-  835, 816, 452, 247, 483, 657, 177, -682, -1027, -503, 279, 624,
-  628, 816, 1222, 1330, 916, 445, 410, 643, 637, 350, 236, 443,
-  442, -252, -1249, -1584, -859, 238, 696, 244, -523, -906, -733, -265,
-  207, 510, 524, 236, -160, -398, -415, -398, -490, -591, -535, -384,
-  -385, -645, -989, -1171, -1123, -898, -497, 92, 678, 864, 437, -259,
-  -497, 142, 1263, 1947, 1636, 690, -24, -54, 263, 366, 185, 111,
-  347, 599, 504, 136, -116, -66, 160, 463, 929, 1516, 1851, 1607,
-  974, 512, 506, 727, 844, 829, 760, 493, -151, -900, -1099, -436,
-  590, 1145, 926, 365, 23, 32, 185, 341, 536, 769, 922, 905,
-  749, 500, 151, -232, -437, -301, 23, 165, -83, -542, -874, -908,
-  -699, -365, -18, 181, 83, -260, -548, -514, -202, 95, 150, -31,
-  -323, -628, -869, -968, -935, -904, -995, -1132, -1129, -953, -794, -813,
-  -908, -814, -428, 56, 335, 263, -59, -391, -522, -407, -207, -173,
-  -425, -824, -1103, -1117, -962, -833, -812, -807, -680, -412, -122, 60,
-  125, 180, 308, 448, 460, 286, 25, -178, -274, -323, -399, -509,
-  -592, -560, -378, -144, -58, -215, -431, -372, 64, 585, 803, 666,
-  461, 416, 445, 358, 187, 140, 300, 519, 635, 641, 570, 361,
-  -17, -391, -482, -227, 146, 379, 426, 368, 230, 9, -156, -49,
-  342, 719, 752, 433, 56, -96, -10, 115, 99, -46, -139, -26,
-  211, 283, 10, -396, -482, -60, 543, 823, 611, 162, -204, -353,
-  -263, 59, 454, 583, 251, -299, -613, -549, -376, -347, -373, -287,
-  -200, -348, -652, -728, -396, 41, 193, 82, 55, 286, 554, 550,
-  239, -139, -288, -68, 395, 724, 553, -80, -663, -705, -278, 85,
-  41, -191, -194, 78, 265, 96, -282, -509, -414, -137, 87, 176,
-  239, 404, 629, 685, 401, -79, -370, -274, -57, -174, -713, -1265,
-  -1387, -1082, -706, -514, -457, -393, -297, -185, 0, 267, 422, 237,
-  -209, -538, -511, -327, -361, -671, -931, -864, -574, -373, -394, -507,
-  -547, -473, -299, -36, 234, 327, 138, -183, -357, -291, -159, -160,
-  -286, -403, -461, -514, -563, -523, -394, -326, -429, -563, -463, -77,
-  326, 442, 258, 36, -12, 80, 174, 250, 390, 573, 616, 388,
-  13, -235, -228, -86, 27, 105, 230, 364, 344, 113, -149, -196,
-  35, 375, 605, 615, 447, 259, 247, 480, 779, 830, 517, 86,
-  -86, 107, 405, 493, 324, 114, 79, 233, 405, 416, 252, 118,
-  259, 685, 1081, 1093, 712, 310, 245, 485, 674, 531, 119, -266,
-  -390, -270, -114, -97, -172, -113, 195, 546, 605, 335, 114, 286,
-  701, 891, 677, 396, 400, 548, 426, -17, -346, -237, 75, 142,
-  -60, -118, 169, 456, 297, -223, -570, -424, -25, 200, 142, -7,
-  -135, -337, -635, -806, -643, -292, -147, -398, -805, -993, -877, -694,
-  -660, -728, -723, -614, -556, -663, -842, -897, -747, -496, -309, -283,
-  -432, -726, -1076, -1331, -1370, -1215, -1023, -923, -914, -925, -923, -892,
-  -775, -525, -233, -101, -212, -392, -405, -253, -188, -388, -727, -932,
-  -893, -732, -586, -439, -223, 22, 179, 216, 237, 337, 474, 505,
-  361, 123, -49, -52, 104, 330, 522, 595, 534, 430, 456, 711,
-  1074, 1267, 1125, 806, 648, 800, 1049, 1068, 799, 526, 537, 796,
-  991, 865, 469, 84, -57, 60, 279, 441, 489, 432, 300, 176,
-  217, 544, 1038, 1339, 1155, 600, 108, -20, 88, 90, -122, -328,
-  -324, -189, -140, -221, -277, -205, -81, -2, 68, 199, 321, 299,
-  156, 87, 198, 347, 335, 183, 78, 68, -5, -226, -396, -262,
-  103, 345, 255, 9, -117, -111, -133, -158, 43, 512, 923, 947,
-  692, 548, 647, 716, 538, 328, 445, 834, 1018, 680, 55, -350,
-  -304, 12, 324, 529, 655, 712, 702, 686, 753, 926, 1143, 1299,
-  1288, 1053, 681, 402, 392, 564, 640, 485, 254, 153, 143, 25,
-  -226, -367, -213, 101, 295, 307, 311, 402, 436, 271, 13, -116,
-  -78, -39, -91, -140, -133, -202, -460, -742, -764, -523, -331, -393,
-  -547, -541, -422, -426, -551, -529, -270, -77, -237, -593, -769, -742,
-  -867, -1283, -1607, -1433, -933, -690, -965, -1423, -1619, -1503, -1304, -1113,
-  -857, -600, -598, -963, -1439, -1646, -1467, -1112, -852, -795, -886, -1011,
-  -1078, -1083, -1095, -1153, -1167, -1017, -739, -552, -617, -855, -1036, -1011,
-  -783, -442, -111, 54, -26, -232, -326, -214, -53, -27, -109, -150,
-  -122, -135, -217, -249, -159, -48, -11, 51, 285, 606, 725, 513,
-  183, 61, 245, 577, 861, 993, 931, 713, 511, 547, 845, 1155,
-  1216, 1058, 949, 1053, 1248, 1323, 1249, 1164, 1151, 1153, 1119, 1130,
-  1285, 1529, 1695, 1729, 1763, 1909, 2051, 1960, 1625, 1348, 1424, 1807,
-  2159, 2223, 2031, 1767, 1541, 1392, 1389, 1566, 1777, 1773, 1505, 1248,
-  1314, 1674, 1977, 1948, 1673, 1470, 1536, 1760, 1852, 1612, 1111, 656,
-  556, 829, 1143, 1095, 617, 52, -171, 36, 357, 406, 98, -298,
-  -443, -275, -69, -158, -584, -1043, -1213, -1092, -961, -1027, -1206, -1316,
-  -1391, -1640, -2094, -2449, -2407, -2089, -1953, -2242, -2675, -2788, -2514, -2259,
-  -2390, -2795, -3067, -3021, -2854, -2813, -2888, -2923, -2909, -2977, -3142, -3229,
-  -3137, -3033, -3152, -3432, -3522, -3190, -2647, -2371, -2626, -3186, -3558, -3446,
-  -3002, -2644, -2631, -2817, -2831, -2498, -2034, -1801, -1909, -2122, -2157, -1973,
-  -1757, -1664, -1674, -1672, -1587, -1419, -1178, -875, -581, -422, -458, -573,
-  -533, -237, 131, 270, 105, -118, -136, 2, 50, -27, 58, 534,
-  1251, 1882, 2349, 2815, 3292, 3528, 3426, 3324, 3588, 4036, 4102, 3627,
-  3163, 3286, 3838, 4156, 3970, 3704, 3801, 4115, 4237, 4209, 4502, 5240,
-  5851, 5738, 5110, 4780, 5144, 5684, 5649, 5007, 4450, 4487, 4862, 4964,
-  4622, 4214, 4098, 4185, 4171, 3973, 3730, 3471, 3043, 2427, 1943, 1943,
-  2361, 2704, 2549, 1970, 1424, 1246, 1329, 1285, 879, 257, -244, -461,
-  -532, -662, -872, -1059, -1230, -1519, -1940, -2275, -2342, -2262, -2289, -2425,
-  -2435, -2304, -2430, -3147, -4165, -4794, -4746, -4468, -4544, -4945, -5152, -4917,
-  -4622, -4750, -5212, -5458, -5181, -4687, -4471, -4602, -4713, -4550, -4321, -4395,
-  -4773, -5057, -4963, -4685, -4625, -4848, -4979, -4689, -4120, -3720, -3734, -3981,
-  -4106, -3921, -3494, -3022, -2709, -2668, -2828, -2967, -2912, -2706, -2506, -2380,
-  -2304, -2334, -2572, -2899, -2962, -2594, -2142, -2067, -2244, -1986, -953, 215,
-  541, -87, -719, -502, 284, 629, 45, -955, -1618, -1746, -1521, -898,
-  336, 1961, 3300, 4009, 4549, 5516, 6666, 7078, 6317, 5023, 4142, 3904,
-  3884, 3840, 3973, 4380, 4762, 4931, 5195, 5832, 6437, 6342, 5694, 5523,
-  6447, 7707, 7959, 6878, 5469, 4815, 4982, 5372, 5703, 6168, 6822, 7337,
-  7482, 7461, 7525, 7473, 6841, 5553, 4148, 3287, 3166, 3427, 3545, 3283,
-  2896, 2905, 3529, 4272, 4266, 3201, 1805, 1159, 1520, 2040, 1737, 539,
-  -802, -1627, -1918, -1987, -1981, -1897, -1844, -1963, -2128, -2024, -1660, -1558,
-  -2215, -3420, -4373, -4534, -4200, -4101, -4544, -5114, -5206, -4701, -4039, -3733,
-  -3934, -4410, -4825, -4981, -4888, -4698, -4583, -4625, -4756, -4814, -4682, -4410,
-  -4183, -4132, -4162, -4015, -3546, -2924, -2484, -2396, -2522, -2647, -2742, -2921,
-  -3176, -3318, -3206, -2906, -2554, -2159, -1670, -1195, -975, -1099, -1353, -1470,
-  -1432, -1418, -1493, -1503, -1312, -1058, -1062, -1486, -2115, -2485, -2269, -1587,
-  -968, -898, -1344, -1769, -1712, -1320, -1181, -1631, -2373, -2834, -2777, -2430,
-  -2140, -2102, -2414, -3084, -3822, -4026, -3300, -2011, -1054, -879, -907, -152,
-  1549, 3143, 3350, 1992, 231, -544, 23, 1117, 1735, 1642, 1343, 1328,
-  1597, 1915, 2220, 2551, 2742, 2605, 2467, 3082, 4626, 6032, 5942, 4413,
-  3137, 3534, 5014, 5727, 4947, 3944, 4222, 5580, 6583, 6580, 6321, 6474,
-  6484, 5574, 4251, 3872, 4741, 5582, 5278, 4393, 4285, 5117, 5649, 5024,
-  3921, 3524, 3940, 4287, 4057, 3638, 3436, 3178, 2468, 1556, 1038, 955,
-  776, 264, -132, 21, 450, 553, 232, -91, -221, -491, -1161, -1919,
-  -2286, -2298, -2378, -2612, -2587, -2104, -1664, -1891, -2637, -3082, -2780, -2241,
-  -2258, -2894, -3449, -3387, -2941, -2719, -2951, -3364, -3655, -3762, -3669, -3252,
-  -2541, -1965, -2001, -2546, -2909, -2619, -2077, -2090, -2798, -3385, -3065, -2084,
-  -1400, -1454, -1719, -1573, -1192, -1129, -1326, -1163, -573, -373, -1092, -1948,
-  -1761, -686, -195, -1064, -2202, -2118, -1006, -432, -1061, -1783, -1479, -734,
-  -911, -2044, -2788, -2483, -2150, -2892, -4127, -4351, -3299, -2305, -2432, -3139,
-  -3298, -2831, -2619, -3082, -3674, -3871, -3930, -4316, -4828, -4791, -3971, -2855,
-  -2030, -1578, -1171, -544, 241, 851, 959, 582, 161, 120, 348, 369,
-  84, 2, 473, 1054, 1121, 932, 1416, 2760, 3891, 3846, 3171, 3221,
-  4230, 4964, 4477, 3453, 3180, 3772, 4251, 4216, 4453, 5562, 6818, 7091,
-  6479, 6167, 6706, 7244, 6780, 5555, 4647, 4548, 4774, 4794, 4699, 4764,
-  4882, 4799, 4622, 4652, 4851, 4862, 4569, 4257, 4120, 3955, 3531, 2971,
-  2506, 2059, 1424, 769, 551, 849, 1145, 974, 508, 212, 117, -183,
-  -850, -1517, -1822, -1907, -2139, -2512, -2659, -2403, -2006, -1818, -1900, -2113,
-  -2353, -2566, -2644, -2540, -2429, -2547, -2859, -3068, -3013, -2899, -3002, -3287,
-  -3470, -3381, -3087, -2691, -2223, -1807, -1714, -2063, -2563, -2749, -2505, -2189,
-  -2175, -2415, -2541, -2324, -1880, -1459, -1179, -1016, -934, -908, -854, -678,
-  -404, -215, -283, -575, -852, -886, -682, -477, -521, -817, -1095, -1062,
-  -720, -408, -509, -1095, -1858, -2385, -2500, -2390, -2411, -2762, -3302, -3681,
-  -3662, -3324, -2964, -2834, -2999, -3366, -3734, -3845, -3573, -3192, -3272, -4061,
-  -5012, -5221, -4458, -3507, -3232, -3484, -3295, -2134, -578, 443, 686, 562,
-  329, -128, -692, -775, -74, 795, 933, 371, 154, 1031, 2465, 3266,
-  3005, 2408, 2397, 3106, 3983, 4521, 4650, 4539, 4342, 4210, 4306, 4661,
-  5065, 5238, 5152, 5122, 5536, 6449, 7431, 7849, 7405, 6427, 5587, 5285,
-  5331, 5264, 4899, 4476, 4309, 4436, 4648, 4736, 4629, 4348, 3982, 3696,
-  3639, 3756, 3764, 3409, 2754, 2124, 1757, 1571, 1306, 862, 393, 100,
-  2, -29, -80, -158, -309, -639, -1157, -1678, -2025, -2253, -2539, -2851,
-  -2902, -2553, -2106, -2003, -2266, -2484, -2379, -2172, -2229, -2517, -2672, -2536,
-  -2363, -2414, -2596, -2676, -2673, -2779, -2961, -2927, -2557, -2144, -2022, -2112,
-  -2070, -1792, -1558, -1617, -1852, -1978, -1916, -1797, -1682, -1483, -1174, -894,
-  -749, -648, -460, -246, -191, -332, -489, -508, -436, -396, -404, -402,
-  -411, -497, -613, -604, -426, -257, -308, -583, -912, -1175, -1404, -1665,
-  -1967, -2315, -2745, -3223, -3567, -3607, -3419, -3318, -3555, -4023, -4317, -4118,
-  -3530, -3064, -3214, -3969, -4769, -5030, -4746, -4483, -4710, -5231, -5383, -4744,
-  -3494, -2121, -1010, -368, -310, -708, -1056, -835, -158, 219, -236, -1040,
-  -1089, 107, 1788, 2708, 2424, 1657, 1434, 2069, 3043, 3692, 3832, 3725,
-  3672, 3772, 4011, 4353, 4664, 4679, 4280, 3827, 4008, 5147, 6695, 7636,
-  7474, 6705, 6204, 6262, 6385, 6018, 5208, 4486, 4242, 4420, 4740, 4999,
-  5088, 4886, 4349, 3663, 3180, 3094, 3239, 3252, 2944, 2469, 2141, 2096,
-  2155, 2005, 1511, 850, 349, 207, 345, 508, 474, 193, -231, -665,
-  -1055, -1448, -1890, -2313, -2552, -2501, -2225, -1894, -1618, -1415, -1311, -1396,
-  -1694, -2046, -2223, -2158, -2013, -1964, -1991, -1959, -1853, -1839, -2037, -2318,
-  -2406, -2181, -1810, -1550, -1481, -1465, -1365, -1220, -1170, -1271, -1424, -1512,
-  -1512, -1459, -1316, -995, -523, -116, -11, -206, -441, -482, -376, -366,
-  -562, -778, -733, -381, 17, 153, -47, -404, -671, -692, -455, -105,
-  95, -69, -549, -1030, -1244, -1276, -1465, -1978, -2606, -3029, -3183, -3258,
-  -3380, -3495, -3568, -3706, -3965, -4172, -4136, -3983, -4043, -4382, -4654, -4571,
-  -4341, -4433, -4959, -5535, -5768, -5635, -5289, -4706, -3793, -2699, -1768, -1146,
-  -690, -327, -245, -544, -921, -953, -634, -326, -165, 144, 817, 1549,
-  1897, 1912, 2048, 2442, 2704, 2577, 2464, 2931, 3839, 4398, 4149, 3550,
-  3372, 3767, 4244, 4439, 4561, 4983, 5696, 6364, 6763, 6914, 6821, 6360,
-  5542, 4712, 4290, 4333, 4480, 4371, 4036, 3819, 3956, 4305, 4480, 4194,
-  3495, 2707, 2199, 2140, 2389, 2587, 2415, 1868, 1287, 1060, 1235, 1455,
-  1332, 856, 386, 239, 364, 455, 298, -95, -629, -1245, -1832, -2155,
-  -2046, -1670, -1434, -1537, -1681, -1388, -623, 41, -24, -800, -1622, -1866,
-  -1553, -1198, -1161, -1336, -1431, -1379, -1304, -1228, -1040, -779, -722, -1029,
-  -1415, -1412, -983, -652, -916, -1626, -2132, -2009, -1479, -1069, -984, -959,
-  -663, -113, 350, 431, 154, -225, -487, -626, -743, -845, -814, -580,
-  -267, -60, 6, 46, 89, -4, -302, -607, -653, -494, -481, -794,
-  -1183, -1330, -1326, -1549, -2096, -2606, -2749, -2658, -2680, -2847, -2909, -2842,
-  -2993, -3558, -4192, -4408, -4234, -4140, -4341, -4502, -4311, -4021, -4119, -4602,
-  -4983, -5046, -5188, -5757, -6318, -6003, -4583, -2834, -1677, -1220, -883, -304,
-  237, 311, -53, -462, -638, -553, -167, 629, 1683, 2459, 2511, 2049,
-  1794, 2186, 2914, 3314, 3146, 2798, 2784, 3213, 3804, 4227, 4301, 3993,
-  3461, 3124, 3447, 4482, 5679, 6344, 6319, 6087, 6147, 6413, 6336, 5583,
-  4425, 3439, 2964, 2943, 3171, 3497, 3754, 3706, 3271, 2741, 2552, 2754,
-  2853, 2366, 1473, 904, 1107, 1702, 1918, 1467, 786, 421, 437, 556,
-  637, 762, 890, 779, 343, -119, -304, -370, -760, -1542, -2202, -2225,
-  -1719, -1235, -1076, -1026, -788, -452, -342, -556, -845, -970, -956, -941,
-  -909, -747, -496, -380, -531, -804, -945, -897, -823, -841, -868, -776,
-  -635, -673, -987, -1408, -1672, -1686, -1554, -1380, -1149, -811, -394, 2,
-  292, 439, 426, 246, -70, -446, -780, -964, -915, -659, -369, -220,
-  -214, -197, -110, -104, -323, -660, -864, -879, -895, -1027, -1123, -1023,
-  -876, -989, -1380, -1713, -1737, -1612, -1662, -1947, -2248, -2440, -2638, -2965,
-  -3370, -3755, -4147, -4577, -4890, -4861, -4487, -4030, -3740, -3671, -3790, -4088,
-  -4497, -4830, -4982, -5105, -5385, -5640, -5363, -4283, -2742, -1376, -497, 33,
-  415, 638, 646, 545, 471, 377, 172, 31, 311, 1067, 1835, 2102,
-  1902, 1759, 2039, 2560, 2915, 3009, 3080, 3288, 3519, 3636, 3718, 3896,
-  4068, 4004, 3728, 3610, 3968, 4692, 5386, 5797, 5961, 5957, 5710, 5143,
-  4389, 3714, 3249, 2937, 2722, 2677, 2864, 3166, 3350, 3273, 2950, 2479,
-  1968, 1554, 1346, 1320, 1313, 1208, 1086, 1106, 1273, 1385, 1248, 889,
-  519, 337, 377, 512, 542, 331, -84, -514, -807, -1001, -1249, -1563,
-  -1742, -1597, -1185, -734, -373, -62, 197, 237, -56, -498, -743, -687,
-  -591, -695, -849, -693, -196, 214, 138, -301, -633, -644, -584, -742,
-  -1010, -1071, -904, -838, -1057, -1287, -1155, -737, -492, -642, -866, -736,
-  -303, -5, -73, -259, -247, -113, -179, -494, -726, -610, -310, -173,
-  -246, -253, -52, 105, -94, -563, -885, -849, -705, -797, -1074, -1171,
-  -947, -712, -815, -1172, -1403, -1393, -1455, -1855, -2388, -2648, -2626, -2744,
-  -3246, -3806, -3976, -3843, -3925, -4409, -4826, -4677, -4152, -3905, -4184, -4556,
-  -4603, -4555, -4920, -5637, -6024, -5657, -4923, -4443, -4153, -3385, -1848, -173,
-  764, 817, 587, 551, 559, 299, -73, -79, 407, 980, 1286, 1504,
-  2024, 2776, 3207, 2973, 2434, 2260, 2660, 3198, 3379, 3227, 3148, 3370,
-  3717, 3917, 3965, 4045, 4232, 4443, 4680, 5114, 5796, 6397, 6432, 5789,
-  4883, 4210, 3816, 3370, 2711, 2142, 2076, 2504, 2983, 3119, 2932, 2679,
-  2461, 2154, 1673, 1159, 820, 691, 645, 618, 693, 934, 1199, 1242,
-  996, 694, 628, 816, 946, 719, 192, -273, -424, -416, -609, -1110,
-  -1623, -1779, -1539, -1173, -900, -686, -425, -170, -67, -134, -237, -302,
-  -402, -573, -671, -534, -230, -10, -6, -103, -153, -191, -337, -566,
-  -726, -774, -841, -1019, -1211, -1274, -1239, -1232, -1247, -1136, -860, -602,
-  -538, -582, -503, -253, -51, -108, -373, -613, -679, -609, -501, -388,
-  -251, -98, 25, 87, 86, 30, -92, -299, -582, -867, -1040, -1054,
-  -989, -974, -1035, -1063, -973, -840, -841, -1062, -1443, -1874, -2284, -2635,
-  -2906, -3141, -3426, -3775, -4059, -4143, -4065, -3994, -4031, -4122, -4178, -4189,
-  -4182, -4170, -4224, -4486, -4977, -5444, -5570, -5339, -5036, -4818, -4442, -3571,
-  -2244, -876, 167, 804, 1083, 1016, 711, 454, 439, 520, 437, 297,
-  542, 1369, 2373, 2972, 3047, 2954, 2971, 2990, 2837, 2623, 2601, 2770,
-  2899, 2913, 3040, 3462, 3973, 4178, 3991, 3792, 4005, 4627, 5254, 5524,
-  5449, 5284, 5161, 4953, 4487, 3807, 3147, 2685, 2415, 2268, 2263, 2435,
-  2662, 2691, 2402, 1943, 1556, 1304, 1066, 763, 492, 400, 517, 761,
-  1041, 1273, 1359, 1258, 1088, 1033, 1108, 1099, 817, 368, 46, -34,
-  -61, -258, -573, -773, -764, -700, -735, -804, -745, -566, -459, -542,
-  -684, -666, -451, -205, -78, -46, 0, 77, 99, 12, -131, -246,
-  -325, -418, -537, -630, -665, -705, -854, -1136, -1438, -1600, -1554, -1375,
-  -1199, -1098, -1038, -937, -764, -569, -448, -459, -578, -709, -753, -677,
-  -529, -378, -264, -189, -137, -102, -89, -129, -259, -476, -684, -758,
-  -684, -605, -664, -825, -917, -873, -836, -963, -1196, -1354, -1397, -1499,
-  -1788, -2166, -2463, -2691, -2999, -3397, -3708, -3836, -3922, -4130, -4373, -4425,
-  -4261, -4113, -4134, -4205, -4163, -4083, -4158, -4361, -4475, -4449, -4512, -4783,
-  -4966, -4639, -3787, -2827, -2069, -1400, -605, 206, 712, 828, 781, 728,
-  566, 255, 126, 568, 1482, 2292, 2606, 2646, 2883, 3378, 3723, 3611,
-  3221, 2943, 2911, 2976, 3049, 3226, 3529, 3737, 3633, 3366, 3354, 3806,
-  4444, 4819, 4821, 4759, 4933, 5243, 5311, 4930, 4274, 3677, 3295, 3066,
-  2920, 2899, 3033, 3196, 3184, 2924, 2545, 2202, 1900, 1511, 967, 384,
-  -1, -16, 301, 723, 1011, 1098, 1119, 1222, 1377, 1404, 1204, 891,
-  647, 509, 364, 140, -84, -215, -294, -431, -619, -721, -664, -557,
-  -562, -683, -779, -749, -645, -570, -544, -506, -422, -336, -300, -322,
-  -371, -417, -429, -371, -244, -123, -104, -205, -350, -480, -661, -1008,
-  -1504, -1931, -2066, -1902, -1638, -1436, -1250, -961, -623, -466, -627, -966,
-  -1219, -1290, -1294, -1317, -1266, -1017, -641, -345, -217, -137, -5, 76,
-  -64, -375, -595, -580, -492, -586, -876, -1130, -1197, -1176, -1228, -1337,
-  -1383, -1375, -1452, -1643, -1794, -1825, -1927, -2341, -3005, -3578, -3853, -3975,
-  -4162, -4367, -4372, -4156, -3929, -3815, -3687, -3449, -3291, -3472, -3915, -4258,
-  -4327, -4353, -4608, -4987, -5119, -4816, -4213, -3500, -2704, -1816, -940, -223,
-  302, 655, 788, 660, 409, 290, 418, 708, 1097, 1676, 2470, 3249,
-  3725, 3892, 3944, 3891, 3510, 2781, 2157, 2130, 2610, 3012, 2997, 2877,
-  3150, 3797, 4300, 4304, 4033, 3955, 4225, 4607, 4842, 4919, 4944, 4909,
-  4719, 4375, 4030, 3818, 3701, 3537, 3284, 3090, 3131, 3375, 3552, 3373,
-  2794, 2039, 1391, 963, 674, 412, 180, 101, 287, 718, 1222, 1594,
-  1745, 1726, 1621, 1438, 1148, 804, 543, 443, 413, 315, 145, 38,
-  61, 89, -49, -344, -617, -733, -757, -835, -991, -1105, -1063, -882,
-  -666, -493, -378, -310, -279, -267, -252, -236, -258, -344, -465, -554,
-  -574, -573, -647, -856, -1153, -1410, -1521, -1496, -1440, -1429, -1436, -1389,
-  -1279, -1182, -1175, -1273, -1450, -1677, -1872, -1888, -1621, -1159, -733, -488,
-  -352, -176, 41, 154, 73, -138, -374, -602, -804, -891, -806, -657,
-  -635, -784, -947, -992, -975, -1019, -1126, -1222, -1331, -1561, -1897, -2187,
-  -2375, -2614, -3030, -3481, -3711, -3694, -3645, -3685, -3685, -3513, -3294, -3236,
-  -3330, -3390, -3385, -3502, -3832, -4189, -4364, -4408, -4509, -4651, -4627, -4368,
-  -4057, -3827, -3517, -2894, -2004, -1157, -577, -246, -75, -39, -74, -3,
-  280, 641, 893, 1123, 1635, 2512, 3390, 3806, 3684, 3344, 3076, 2864,
-  2575, 2248, 2075, 2155, 2393, 2681, 3041, 3528, 4039, 4327, 4263, 4012,
-  3896, 4065, 4347, 4465, 4363, 4260, 4373, 4644, 4814, 4733, 4513, 4356,
-  4301, 4213, 3993, 3706, 3474, 3296, 3038, 2602, 2049, 1551, 1234, 1072,
-  936, 747, 569, 544, 735, 1028, 1243, 1309, 1300, 1291, 1245, 1082,
-  831, 623, 531, 484, 370, 196, 79, 94, 182, 219, 134, -49,
-  -264, -459, -633, -820, -1038, -1231, -1291, -1166, -943, -758, -649, -552,
-  -448, -433, -578, -776, -830, -705, -587, -635, -776, -814, -721, -695,
-  -893, -1224, -1462, -1519, -1504, -1524, -1529, -1416, -1214, -1083, -1127, -1279,
-  -1398, -1445, -1491, -1561, -1554, -1359, -1021, -720, -554, -426, -200, 71,
-  174, 22, -206, -276, -197, -180, -320, -465, -461, -404, -508, -773,
-  -969, -985, -1025, -1326, -1801, -2138, -2237, -2350, -2701, -3141, -3353, -3314,
-  -3335, -3601, -3885, -3863, -3602, -3492, -3711, -3947, -3823, -3422, -3212, -3435,
-  -3806, -3909, -3761, -3757, -4109, -4539, -4634, -4350, -3987, -3713, -3336, -2623,
-  -1709, -1005, -731, -695, -587, -371, -254, -324, -347, -18, 683, 1475,
-  2085, 2513, 2913, 3311, 3510, 3324, 2841, 2377, 2181, 2230, 2341, 2422,
-  2557, 2854, 3284, 3710, 4013, 4151, 4141, 4039, 3942, 3933, 4008, 4084,
-  4117, 4168, 4321, 4558, 4771, 4879, 4880, 4785, 4579, 4286, 4004, 3805,
-  3627, 3343, 2943, 2574, 2368, 2276, 2131, 1850, 1506, 1221, 1049, 974,
-  974, 1040, 1151, 1274, 1384, 1454, 1437, 1296, 1051, 772, 518, 308,
-  161, 121, 202, 342, 446, 470, 420, 283, 7, -414, -876, -1240,
-  -1446, -1515, -1456, -1248, -918, -591, -393, -343, -379, -475, -654, -885,
-  -1047, -1048, -942, -854, -821, -768, -671, -635, -756, -981, -1164, -1251,
-  -1316, -1396, -1409, -1288, -1132, -1110, -1232, -1330, -1295, -1240, -1332, -1536,
-  -1621, -1450, -1146, -924, -817, -665, -370, -52, 91, 28, -75, -76,
-  -27, -85, -282, -464, -486, -400, -385, -518, -683, -753, -784, -951,
-  -1303, -1696, -1984, -2210, -2498, -2839, -3070, -3103, -3061, -3122, -3302, -3453,
-  -3476, -3434, -3440, -3515, -3582, -3570, -3471, -3327, -3210, -3196, -3314, -3512,
-  -3702, -3856, -4014, -4191, -4313, -4263, -3972, -3459, -2815, -2182, -1700, -1419,
-  -1247, -1058, -843, -722, -758, -811, -644, -156, 518, 1157, 1650, 2023,
-  2334, 2578, 2705, 2673, 2491, 2215, 1940, 1775, 1812, 2078, 2490, 2880,
-  3111, 3202, 3300, 3495, 3686, 3691, 3497, 3320, 3385, 3692, 4061, 4366,
-  4619, 4850, 5005, 5032, 4976, 4914, 4815, 4580, 4217, 3883, 3701, 3605,
-  3444, 3181, 2912, 2688, 2445, 2129, 1820, 1642, 1581, 1515, 1398, 1337,
-  1428, 1586, 1627, 1497, 1332, 1260, 1228, 1093, 849, 654, 625, 680,
-  653, 511, 381, 354, 357, 255, 24, -249, -504, -769, -1044, -1232,
-  -1244, -1142, -1091, -1147, -1188, -1086, -891, -782, -847, -983, -1047, -1018,
-  -982, -985, -979, -918, -837, -805, -825, -842, -841, -881, -1017, -1210,
-  -1348, -1370, -1325, -1301, -1320, -1331, -1293, -1244, -1254, -1329, -1394, -1371,
-  -1267, -1154, -1067, -964, -786, -549, -344, -254, -273, -334, -388, -437,
-  -494, -544, -562, -560, -580, -631, -669, -677, -732, -941, -1308, -1695,
-  -1978, -2184, -2428, -2716, -2908, -2903, -2795, -2764, -2839, -2878, -2795, -2703,
-  -2758, -2926, -3024, -2972, -2894, -2915, -2989, -2991, -2939, -2981, -3170, -3372,
-  -3451, -3447, -3486, -3553, -3479, -3166, -2718, -2315, -2015, -1759, -1509, -1308,
-  -1193, -1121, -1028, -901, -758, -580, -304, 101, 578, 1010, 1299, 1434,
-  1486, 1530, 1563, 1509, 1335, 1132, 1049, 1134, 1306, 1483, 1694, 1992,
-  2317, 2528, 2592, 2638, 2796, 3017, 3152, 3170, 3219, 3445, 3809, 4141,
-  4335, 4434, 4525, 4621, 4663, 4613, 4490, 4335, 4157, 3951, 3731, 3534,
-  3380, 3248, 3089, 2875, 2626, 2398, 2228, 2112, 2023, 1948, 1893, 1868,
-  1874, 1902, 1935, 1936, 1865, 1714, 1523, 1356, 1249, 1193, 1167, 1163,
-  1183, 1210, 1211, 1164, 1068, 921, 711, 436, 139, -110, -267, -354,
-  -423, -491, -531, -508, -439, -387, -408, -498, -602, -669, -688, -693,
-  -711, -732, -722, -667, -604, -579, -604, -646, -676, -703, -749, -803,
-  -822, -791, -747, -739, -769, -804, -834, -890, -991, -1103, -1175, -1201,
-  -1226, -1276, -1315, -1290, -1204, -1114, -1061, -1023, -956, -865, -808, -831,
-  -909, -978, -1003, -1015, -1051, -1109, -1152, -1175, -1215, -1311, -1450, -1596,
-  -1740, -1904, -2089, -2251, -2346, -2394, -2449, -2525, -2589, -2614, -2636, -2707,
-  -2818, -2903, -2919, -2892, -2873, -2871, -2859, -2826, -2789, -2762, -2728, -2688,
-  -2679, -2737, -2830, -2871, -2805, -2663, -2512, -2376, -2221, -2030, -1836, -1694,
-  -1619, -1589, -1580, -1587, -1601, -1592, -1528, -1392, -1196, -967, -737, -527,
-  -326, -119, 78, 204, 214, 150, 115, 171, 280, 372, 453, 596,
-  831, 1091, 1299, 1464, 1649, 1857, 2019, 2094, 2155, 2302, 2534, 2749,
-  2882, 2975, 3101, 3255, 3364, 3394, 3400, 3443, 3512, 3551, 3547, 3541,
-  3572, 3625, 3663, 3665, 3635, 3577, 3492, 3397, 3312, 3242, 3181, 3131,
-  3111, 3126, 3158, 3185, 3212, 3243, 3247, 3179, 3037, 2873, 2739, 2632,
-  2524, 2420, 2362, 2359, 2354, 2290, 2176, 2058, 1943, 1776, 1525, 1249,
-  1049, 957, 906, 822, 706, 619, 587, 558, 468, 316, 157, 31,
-  -74, -179, -269, -306, -288, -263, -279, -333, -390, -436, -498, -595,
-  -706, -790, -833, -864, -908, -961, -1001, -1030, -1077, -1171, -1303, -1436,
-  -1535, -1589, -1613, -1624, -1632, -1634, -1626, -1608, -1587, -1574, -1579, -1607,
-  -1651, -1698, -1737, -1765, -1787, -1810, -1839, -1883, -1951, -2042, -2146, -2253,
-  -2359, -2469, -2580, -2681, -2762, -2820, -2861, -2891, -2920, -2964, -3030, -3113,
-  -3190, -3242, -3265, -3273, -3274, -3263, -3227, -3164, -3094, -3045, -3031, -3045,
-  -3076, -3118, -3169, -3214, -3230, -3208, -3163, -3108, -3030, -2898, -2712, -2519,
-  -2363, -2245, -2130, -2003, -1889, -1814, -1760, -1684, -1568, -1433, -1294, -1145,
-  -971, -781, -596, -419, -232, -37, 135, 258, 350, 456, 601, 766,
-  911, 1024, 1126, 1256, 1436, 1657, 1888, 2093, 2261, 2415, 2591, 2805,
-  3036, 3244, 3401, 3513, 3609, 3723, 3854, 3971, 4033, 4039, 4029, 4049,
-  4106, 4170, 4217, 4249, 4281, 4312, 4332, 4335, 4324, 4295, 4234, 4138,
-  4029, 3930, 3849, 3772, 3693, 3617, 3556, 3507, 3452, 3377, 3282, 3184,
-  3105, 3050, 2992, 2902, 2772, 2629, 2494, 2356, 2189, 1995, 1813, 1667,
-  1539, 1397, 1246, 1121, 1029, 928, 780, 607, 473, 398, 341, 250,
-  126, 5, -98, -199, -302, -377, -402, -401, -425, -493, -573, -628,
-  -665, -724, -825, -955, -1084, -1191, -1265, -1301, -1312, -1323, -1359, -1419,
-  -1480, -1524, -1555, -1594, -1658, -1748, -1850, -1933, -1969, -1954, -1921, -1915,
-  -1954, -2010, -2045, -2050, -2046, -2068, -2129, -2222, -2329, -2427, -2508, -2578,
-  -2654, -2743, -2836, -2914, -2969, -3011, -3050, -3093, -3137, -3181, -3221, -3249,
-  -3265, -3277, -3292, -3313, -3329, -3340, -3354, -3377, -3398, -3397, -3369, -3338,
-  -3328, -3344, -3367, -3384, -3401, -3432, -3473, -3493, -3466, -3386, -3265, -3105,
-  -2898, -2648, -2388, -2163, -1996, -1875, -1780, -1697, -1614, -1514, -1388, -1249,
-  -1118, -990, -839, -649, -454, -305, -217, -148, -38, 138, 356, 574,
-  759, 902, 1020, 1148, 1316, 1513, 1691, 1813, 1900, 2018, 2214, 2477,
-  2756, 3013, 3248, 3481, 3716, 3932, 4101, 4201, 4225, 4176, 4079, 3979,
-  3918, 3905, 3914, 3923, 3939, 3988, 4075, 4167, 4221, 4227, 4211, 4196,
-  4177, 4131, 4047, 3945, 3859, 3813, 3799, 3795, 3776, 3740, 3699, 3662,
-  3622, 3569, 3499, 3410, 3290, 3134, 2966, 2823, 2708, 2577, 2386, 2158,
-  1958, 1824, 1721, 1601, 1453, 1308, 1181, 1060, 937, 828, 743, 661,
-  559, 448, 361, 300, 231, 138, 45, -21, -77, -160, -272, -372,
-  -433, -480, -556, -670, -792, -900, -995, -1081, -1150, -1194, -1235, -1302,
-  -1396, -1489, -1552, -1590, -1633, -1702, -1785, -1848, -1868, -1859, -1862, -1911,
-  -1997, -2081, -2136, -2170, -2203, -2233, -2236, -2212, -2195, -2226, -2305, -2397,
-  -2474, -2543, -2629, -2731, -2829, -2905, -2967, -3029, -3089, -3138, -3184, -3249,
-  -3339, -3423, -3455, -3424, -3376, -3365, -3401, -3441, -3436, -3386, -3337, -3326,
-  -3351, -3380, -3391, -3386, -3381, -3390, -3420, -3468, -3512, -3526, -3495, -3426,
-  -3338, -3231, -3093, -2913, -2707, -2505, -2329, -2185, -2064, -1953, -1839, -1723,
-  -1612, -1515, -1421, -1304, -1144, -956, -781, -649, -552, -448, -294, -93,
-  117, 294, 422, 523, 628, 756, 906, 1063, 1213, 1355, 1508, 1705,
-  1966, 2270, 2558, 2783, 2947, 3096, 3269, 3467, 3660, 3814, 3914, 3965,
-  3992, 4020, 4057, 4084, 4077, 4034, 3990, 3975, 3994, 4028, 4056, 4079,
-  4101, 4121, 4136, 4146, 4160, 4179, 4196, 4195, 4168, 4114, 4045, 3981,
-  3930, 3884, 3826, 3748, 3658, 3570, 3485, 3402, 3317, 3225, 3122, 2998,
-  2857, 2712, 2568, 2411, 2223, 2007, 1793, 1610, 1466, 1350, 1250, 1173,
-  1126, 1098, 1067, 1014, 942, 862, 776, 671, 537, 378, 211, 57,
-  -72, -173, -257, -334, -410, -475, -524, -569, -637, -743, -868, -985,
-  -1087, -1192, -1310, -1422, -1500, -1541, -1564, -1590, -1633, -1701, -1797, -1906,
-  -1995, -2047, -2083, -2139, -2218, -2280, -2289, -2253, -2221, -2235, -2304, -2400,
-  -2488, -2538, -2551, -2565, -2625, -2739, -2863, -2944, -2976, -3005, -3073, -3183,
-  -3306, -3413, -3483, -3509, -3497, -3472, -3461, -3468, -3471, -3448, -3411, -3389,
-  -3397, -3429, -3464, -3480, -3462, -3414, -3362, -3333, -3328, -3321, -3297, -3277,
-  -3291, -3339, -3380, -3385, -3358, -3318, -3255, -3138, -2957, -2740, -2526, -2330,
-  -2158, -2025, -1951, -1918, -1870, -1764, -1604, -1433, -1275, -1113, -915, -683,
-  -459, -286, -177, -108, -34, 79, 237, 418, 590, 736, 864, 1000,
-  1159, 1340, 1526, 1702, 1860, 2003, 2152, 2332, 2550, 2787, 3008, 3201,
-  3381, 3566, 3748, 3897, 3986, 4014, 3995, 3946, 3888, 3846, 3843, 3874,
-  3917, 3958, 4007, 4077, 4151, 4192, 4185, 4151, 4124, 4113, 4102, 4084,
-  4065, 4050, 4024, 3976, 3909, 3832, 3736, 3604, 3454, 3340, 3302, 3316,
-  3312, 3243, 3127, 3015, 2927, 2833, 2696, 2505, 2284, 2073, 1904, 1788,
-  1707, 1629, 1531, 1424, 1336, 1282, 1253, 1222, 1167, 1076, 956, 830,
-  727, 653, 576, 461, 311, 172, 71, -12, -119, -250, -366, -446,
-  -515, -612, -730, -824, -874, -910, -978, -1081, -1191, -1284, -1370, -1458,
-  -1542, -1607, -1660, -1720, -1791, -1850, -1880, -1888, -1905, -1948, -2004, -2044,
-  -2058, -2058, -2067, -2102, -2162, -2238, -2315, -2391, -2467, -2550, -2633, -2708,
-  -2767, -2818, -2869, -2920, -2963, -2998, -3040, -3101, -3176, -3245, -3302, -3358,
-  -3416, -3456, -3456, -3424, -3392, -3377, -3353, -3296, -3222, -3183, -3204, -3258,
-  -3302, -3325, -3343, -3357, -3355, -3336, -3324, -3328, -3326, -3295, -3251, -3229,
-  -3234, -3213, -3119, -2952, -2755, -2563, -2382, -2211, -2048, -1893, -1739, -1595,
-  -1475, -1374, -1249, -1071, -864, -693, -588, -510, -402, -248, -82, 62,
-  187, 309, 441, 586, 751, 922, 1067, 1163, 1239, 1362, 1570, 1828,
-  2062, 2230, 2356, 2495, 2680, 2900, 3117, 3295, 3430, 3545, 3670, 3806,
-  3919, 3968, 3945, 3876, 3798, 3738, 3710, 3723, 3778, 3854, 3927, 3984,
-  4036, 4095, 4153, 4186, 4180, 4141, 4090, 4043, 4009, 3988, 3968, 3934,
-  3873, 3783, 3679, 3589, 3526, 3478, 3417, 3317, 3190, 3070, 2980, 2908,
-  2821, 2698, 2551, 2407, 2280, 2168, 2067, 1972, 1874, 1758, 1626, 1505,
-  1424, 1380, 1339, 1274, 1190, 1108, 1034, 950, 843, 716, 580, 439,
-  294, 158, 45, -51, -156, -285, -421, -529, -606, -680, -777, -882,
-  -958, -995, -1029, -1102, -1212, -1318, -1390, -1443, -1508, -1598, -1700, -1792,
-  -1873, -1945, -2001, -2036, -2063, -2103, -2159, -2206, -2221, -2222, -2256, -2347,
-  -2467, -2564, -2619, -2655, -2702, -2764, -2819, -2857, -2888, -2928, -2981, -3041,
-  -3103, -3165, -3228, -3282, -3323, -3350, -3364, -3368, -3372, -3385, -3406, -3421,
-  -3416, -3394, -3373, -3364, -3359, -3337, -3298, -3259, -3240, -3244, -3261, -3280,
-  -3293, -3298, -3296, -3293, -3292, -3289, -3268, -3218, -3144, -3053, -2940, -2794,
-  -2610, -2401, -2196, -2019, -1880, -1768, -1659, -1534, -1394, -1257, -1130, -1001,
-  -847, -667, -498, -374, -298, -232, -132, 14, 184, 347, 489, 616,
-  747, 894, 1052, 1212, 1367, 1525, 1698, 1893, 2109, 2331, 2538, 2708,
-  2838, 2955, 3095, 3273, 3458, 3606, 3704, 3775, 3842, 3897, 3912, 3880,
-  3831, 3795, 3778, 3775, 3795, 3849, 3928, 4001, 4048, 4082, 4130, 4187,
-  4227, 4229, 4203, 4167, 4124, 4066, 3989, 3907, 3827, 3744, 3655, 3568,
-  3493, 3429, 3359, 3275, 3179, 3075, 2957, 2823, 2685, 2559, 2453, 2355,
-  2249, 2137, 2027, 1926, 1836, 1757, 1683, 1605, 1514, 1423, 1355, 1318,
-  1288, 1224, 1106, 952, 800, 670, 555, 434, 289, 125, -34, -161,
-  -246, -310, -391, -509, -643, -756, -828, -876, -931, -1014, -1120, -1224,
-  -1307, -1365, -1412, -1467, -1537, -1612, -1677, -1731, -1787, -1862, -1956, -2052,
-  -2136, -2204, -2266, -2323, -2371, -2405, -2431, -2465, -2517, -2581, -2638, -2673,
-  -2689, -2704, -2732, -2771, -2814, -2858, -2908, -2961, -3011, -3057, -3104, -3152,
-  -3188, -3205, -3214, -3234, -3270, -3303, -3318, -3320, -3324, -3332, -3333, -3329,
-  -3335, -3358, -3383, -3385, -3365, -3339, -3321, -3306, -3286, -3262, -3238, -3210,
-  -3179, -3160, -3157, -3152, -3115, -3039, -2953, -2877, -2791, -2653, -2453, -2236,
-  -2054, -1922, -1812, -1694, -1558, -1417, -1286, -1170, -1061, -937, -780, -596,
-  -420, -287, -199, -117, 14, 213, 451, 669, 828, 945, 1078, 1263,
-  1478, 1667, 1799, 1902, 2029, 2207, 2420, 2632, 2812, 2951, 3060, 3172,
-  3320, 3506, 3688, 3820, 3893, 3938, 3985, 4033, 4056, 4045, 4009, 3966,
-  3936, 3943, 3997, 4083, 4161, 4203, 4218, 4234, 4269, 4310, 4332, 4325,
-  4288, 4230, 4164, 4097, 4023, 3927, 3800, 3655, 3516, 3403, 3313, 3233,
-  3151, 3058, 2951, 2836, 2726, 2623, 2518, 2398, 2268, 2147, 2043, 1945,
-  1842, 1739, 1644, 1554, 1456, 1354, 1262, 1191, 1132, 1067, 985, 882,
-  757, 618, 484, 370, 259, 119, -60, -243, -385, -482, -569, -674,
-  -791, -894, -966, -1009, -1033, -1056, -1104, -1194, -1309, -1406, -1466, -1513,
-  -1592, -1709, -1825, -1897, -1922, -1940, -1987, -2068, -2163, -2243, -2294, -2322,
-  -2349, -2393, -2451, -2496, -2509, -2505, -2520, -2574, -2646, -2701, -2720, -2721,
-  -2732, -2769, -2822, -2874, -2912, -2931, -2940, -2953, -2982, -3025, -3063, -3080,
-  -3083, -3097, -3138, -3197, -3244, -3262, -3258, -3250, -3246, -3242, -3231, -3217,
-  -3206, -3192, -3167, -3136, -3114, -3112, -3123, -3126, -3111, -3087, -3069, -3063,
-  -3059, -3043, -3005, -2945, -2871, -2785, -2681, -2543, -2364, -2158, -1957, -1783,
-  -1636, -1496, -1351, -1211, -1094, -1005, -923, -812, -653, -462, -281, -146,
-  -57, 32, 175, 383, 611, 802, 938, 1055, 1203, 1400, 1617, 1803,
-  1934, 2027, 2135, 2303, 2529, 2759, 2936, 3049, 3142, 3272, 3453, 3649,
-  3813, 3926, 4003, 4064, 4122, 4177, 4220, 4233, 4204, 4145, 4092, 4080,
-  4109, 4153, 4192, 4236, 4297, 4364, 4413, 4431, 4433, 4434, 4420, 4367,
-  4276, 4174, 4079, 3979, 3856, 3716, 3583, 3463, 3344, 3213, 3089, 2991,
-  2909, 2810, 2678, 2540, 2425, 2327, 2217, 2082, 1946, 1833, 1739, 1642,
-  1533, 1422, 1320, 1223, 1124, 1027, 933, 835, 720, 600, 498, 420,
-  340, 219, 49, -137, -294, -402, -480, -570, -697, -853, -992, -1072,
-  -1089, -1091, -1133, -1230, -1344, -1430, -1472, -1498, -1556, -1673, -1829, -1973,
-  -2054, -2070, -2067, -2104, -2195, -2301, -2373, -2395, -2398, -2420, -2475, -2543,
-  -2598, -2622, -2624, -2625, -2641, -2675, -2710, -2734, -2747, -2757, -2769, -2785,
-  -2806, -2831, -2860, -2892, -2931, -2980, -3024, -3043, -3032, -3022, -3042, -3083,
-  -3105, -3084, -3049, -3040, -3061, -3077, -3069, -3049, -3040, -3039, -3030, -3018,
-  -3018, -3027, -3011, -2958, -2897, -2869, -2875, -2875, -2843, -2800, -2780, -2780,
-  -2773, -2746, -2712, -2683, -2637, -2549, -2419, -2267, -2105, -1924, -1725, -1534,
-  -1376, -1243, -1115, -990, -890, -820, -743, -616, -442, -274, -153, -62,
-  53, 217, 407, 588, 750, 907, 1072, 1246, 1426, 1605, 1764, 1887,
-  1982, 2096, 2269, 2491, 2701, 2852, 2954, 3060, 3206, 3380, 3538, 3657,
-  3747, 3838, 3953, 4084, 4200, 4269, 4286, 4282, 4292, 4319, 4337, 4329,
-  4308, 4307, 4334, 4374, 4407, 4434, 4462, 4491, 4510, 4511, 4488, 4434,
-  4349, 4250, 4155, 4057, 3925, 3750, 3564, 3421, 3335, 3266, 3174, 3057,
-  2946, 2862, 2794, 2717, 2614, 2478, 2319, 2165, 2045, 1961, 1868, 1723,
-  1544, 1393, 1313, 1270, 1194, 1053, 883, 733, 622, 531, 432, 310,
-  164, 9, -126, -221, -294, -388, -527, -683, -808, -885, -942, -1011,
-  -1101, -1201, -1296, -1375, -1432, -1470, -1512, -1583, -1683, -1787, -1874, -1948,
-  -2028, -2118, -2212, -2306, -2398, -2481, -2538, -2564, -2580, -2611, -2659, -2705,
-  -2736, -2754, -2770, -2794, -2836, -2898, -2960, -2989, -2972, -2941, -2947, -3004,
-  -3071, -3097, -3078, -3052, -3056, -3089, -3127, -3149, -3149, -3133, -3117, -3117,
-  -3141, -3170, -3173, -3135, -3081, -3054, -3073, -3113, -3129, -3102, -3053, -3021,
-  -3021, -3031, -3019, -2972, -2910, -2857, -2819, -2783, -2738, -2687, -2636, -2595,
-  -2563, -2534, -2499, -2450, -2396, -2349, -2308, -2250, -2152, -2022, -1887, -1758,
-  -1617, -1444, -1248, -1062, -909, -788, -689, -603, -507, -380, -224, -81,
-  19, 100, 226, 422, 639, 814, 943, 1080, 1262, 1469, 1660, 1815,
-  1935, 2029, 2118, 2238, 2413, 2612, 2774, 2875, 2966, 3105, 3285, 3446,
-  3555, 3638, 3736, 3854, 3971, 4083, 4195, 4289, 4335, 4341, 4359, 4419,
-  4484, 4497, 4456, 4426, 4451, 4511, 4553, 4560, 4551, 4533, 4496, 4445,
-  4406, 4386, 4351, 4263, 4133, 4006, 3900, 3784, 3632, 3463, 3318, 3207,
-  3110, 3015, 2926, 2841, 2734, 2593, 2443, 2316, 2209, 2087, 1935, 1782,
-  1657, 1550, 1432, 1293, 1156, 1035, 921, 797, 667, 538, 404, 261,
-  123, 9, -87, -195, -328, -463, -565, -632, -696, -778, -873, -963,
-  -1047, -1132, -1222, -1315, -1416, -1525, -1628, -1702, -1741, -1769, -1813, -1880,
-  -1955, -2017, -2059, -2096, -2146, -2221, -2312, -2392, -2444, -2482, -2530, -2596,
-  -2658, -2692, -2704, -2713, -2729, -2745, -2757, -2777, -2809, -2840, -2855, -2864,
-  -2890, -2937, -2983, -3005, -3012, -3024, -3050, -3078, -3095, -3104, -3107, -3098,
-  -3077, -3057, -3055, -3069, -3079, -3074, -3055, -3034, -3010, -2984, -2963, -2958,
-  -2965, -2965, -2945, -2912, -2887, -2880, -2875, -2850, -2799, -2736, -2683, -2644,
-  -2606, -2558, -2501, -2436, -2362, -2285, -2221, -2188, -2170, -2128, -2041, -1937,
-  -1857, -1801, -1723, -1585, -1403, -1221, -1064, -921, -780, -648, -530, -415,
-  -292, -169, -60, 47, 177, 328, 468, 581, 694, 845, 1030, 1209,
-  1360, 1500, 1656, 1825, 1983, 2121, 2246, 2365, 2486, 2621, 2782, 2952,
-  3095, 3199, 3295, 3422, 3570, 3695, 3771, 3826, 3899, 4002, 4118, 4229,
-  4325, 4395, 4437, 4471, 4524, 4588, 4620, 4595, 4547, 4533, 4560, 4578,
-  4545, 4478, 4419, 4387, 4359, 4316, 4264, 4210, 4147, 4061, 3957, 3843,
-  3718, 3575, 3422, 3279, 3155, 3033, 2900, 2768, 2657, 2567, 2473, 2354,
-  2211, 2061, 1917, 1783, 1661, 1540, 1402, 1247, 1093, 964, 857, 742,
-  605, 462, 338, 233, 124, 2, -126, -250, -376, -511, -641, -751,
-  -845, -940, -1043, -1141, -1224, -1301, -1389, -1486, -1578, -1661, -1741, -1824,
-  -1897, -1950, -1994, -2046, -2108, -2164, -2208, -2251, -2311, -2390, -2468, -2525,
-  -2557, -2580, -2618, -2682, -2759, -2817, -2836, -2825, -2817, -2834, -2870, -2903,
-  -2924, -2941, -2965, -2998, -3039, -3081, -3111, -3107, -3071, -3033, -3028, -3057,
-  -3084, -3081, -3060, -3050, -3061, -3072, -3065, -3049, -3038, -3029, -3007, -2973,
-  -2947, -2936, -2919, -2870, -2795, -2734, -2712, -2715, -2706, -2669, -2623, -2589,
-  -2571, -2552, -2520, -2472, -2410, -2334, -2254, -2193, -2159, -2130, -2067, -1965,
-  -1868, -1818, -1806, -1772, -1680, -1557, -1461, -1407, -1347, -1232, -1063, -880,
-  -715, -571, -439, -316, -191, -54, 91, 215, 297, 362, 465, 626,
-  803, 934, 1014, 1103, 1253, 1459, 1663, 1819, 1935, 2047, 2185, 2345,
-  2500, 2624, 2711, 2785, 2887, 3041, 3229, 3400, 3515, 3585, 3654, 3761,
-  3897, 4016, 4083, 4107, 4131, 4194, 4298, 4408, 4479, 4495, 4486, 4497,
-  4552, 4625, 4665, 4644, 4585, 4534, 4514, 4507, 4480, 4418, 4328, 4235,
-  4161, 4120, 4101, 4062, 3962, 3799, 3622, 3485, 3393, 3301, 3167, 2997,
-  2829, 2691, 2580, 2480, 2378, 2260, 2112, 1944, 1790, 1681, 1598, 1486,
-  1310, 1099, 914, 789, 698, 596, 463, 314, 173, 55, -35, -114,
-  -214, -363, -545, -708, -810, -867, -934, -1050, -1200, -1337, -1431, -1493,
-  -1554, -1637, -1747, -1865, -1962, -2023, -2063, -2115, -2205, -2319, -2418, -2476,
-  -2501, -2523, -2566, -2627, -2687, -2726, -2744, -2765, -2814, -2893, -2969, -3011,
-  -3017, -3020, -3045, -3089, -3131, -3157, -3168, -3168, -3164, -3172, -3206, -3249,
-  -3262, -3228, -3184, -3181, -3220, -3250, -3231, -3183, -3150, -3144, -3142, -3128,
-  -3113, -3103, -3086, -3054, -3027, -3024, -3025, -2987, -2908, -2837, -2809, -2801,
-  -2769, -2705, -2640, -2590, -2541, -2483, -2434, -2408, -2386, -2339, -2272, -2215,
-  -2175, -2122, -2036, -1942, -1869, -1814, -1744, -1651, -1558, -1481, -1402, -1306,
-  -1206, -1125, -1051, -952, -823, -694, -591, -498, -380, -227, -65, 83,
-  216, 344, 467, 586, 706, 831, 954, 1066, 1176, 1303, 1450, 1595,
-  1720, 1833, 1956, 2101, 2257, 2409, 2551, 2683, 2808, 2930, 3057, 3184,
-  3292, 3370, 3440, 3536, 3667, 3803, 3905, 3970, 4027, 4102, 4190, 4268,
-  4328, 4381, 4434, 4483, 4524, 4557, 4589, 4614, 4620, 4604, 4582, 4569,
-  4560, 4540, 4499, 4445, 4388, 4328, 4257, 4176, 4096, 4016, 3926, 3817,
-  3703, 3605, 3522, 3424, 3282, 3107, 2935, 2792, 2671, 2544, 2398, 2240,
-  2088, 1951, 1832, 1721, 1605, 1471, 1322, 1178, 1054, 940, 808, 645,
-  468, 310, 182, 61, -79, -235, -383, -506, -613, -725, -847, -969,
-  -1087, -1202, -1314, -1416, -1507, -1602, -1710, -1820, -1908, -1972, -2041, -2132,
-  -2230, -2303, -2352, -2410, -2498, -2595, -2667, -2711, -2751, -2799, -2843, -2873,
-  -2904, -2951, -3001, -3029, -3039, -3058, -3100, -3143, -3162, -3166, -3182, -3217,
-  -3248, -3260, -3267, -3288, -3314, -3324, -3318, -3316, -3327, -3332, -3312, -3285,
-  -3280, -3303, -3329, -3334, -3320, -3301, -3281, -3254, -3224, -3195, -3159, -3105,
-  -3037, -2981, -2949, -2925, -2880, -2809, -2734, -2680, -2648, -2619, -2578, -2522,
-  -2452, -2375, -2304, -2251, -2207, -2152, -2075, -1986, -1905, -1833, -1757, -1671,
-  -1578, -1490, -1407, -1329, -1254, -1181, -1104, -1015, -910, -796, -684, -582,
-  -491, -404, -311, -201, -80, 32, 123, 206, 313, 465, 649, 831,
-  983, 1104, 1214, 1343, 1501, 1670, 1809, 1894, 1949, 2027, 2163, 2335,
-  2486, 2585, 2653, 2743, 2882, 3054, 3216, 3338, 3420, 3487, 3570, 3678,
-  3793, 3881, 3930, 3960, 4013, 4104, 4210, 4291, 4327, 4337, 4354, 4394,
-  4442, 4472, 4475, 4463, 4455, 4456, 4457, 4449, 4433, 4415, 4397, 4371,
-  4330, 4273, 4202, 4120, 4033, 3944, 3853, 3750, 3628, 3496, 3371, 3262,
-  3156, 3032, 2888, 2741, 2609, 2488, 2359, 2207, 2035, 1862, 1705, 1571,
-  1451, 1328, 1189, 1037, 887, 753, 636, 523, 399, 258, 108, -36,
-  -162, -274, -392, -536, -703, -870, -1006, -1105, -1187, -1279, -1392, -1509,
-  -1609, -1683, -1748, -1823, -1918, -2022, -2113, -2182, -2233, -2282, -2343, -2416,
-  -2492, -2555, -2598, -2631, -2667, -2713, -2758, -2791, -2815, -2848, -2902, -2972,
-  -3036, -3082, -3109, -3130, -3153, -3186, -3223, -3252, -3260, -3251, -3243, -3255,
-  -3284, -3306, -3305, -3294, -3299, -3326, -3357, -3373, -3374, -3374, -3379, -3380,
-  -3369, -3349, -3329, -3304, -3268, -3222, -3186, -3167, -3147, -3102, -3031, -2963,
-  -2921, -2896, -2858, -2793, -2719, -2658, -2610, -2561, -2503, -2446, -2391, -2327,
-  -2245, -2155, -2078, -2017, -1954, -1876, -1786, -1701, -1626, -1553, -1475, -1394,
-  -1310, -1223, -1129, -1030, -931, -837, -746, -652, -549, -431, -310, -205,
-  -123, -45, 58, 189, 318, 417, 494, 583, 703, 846, 996, 1147,
-  1300, 1443, 1568, 1687, 1821, 1970, 2104, 2200, 2278, 2372, 2493, 2617,
-  2720, 2806, 2892, 2988, 3093, 3205, 3324, 3444, 3551, 3640, 3716, 3785,
-  3837, 3868, 3888, 3919, 3968, 4023, 4072, 4115, 4160, 4203, 4242, 4276,
-  4310, 4339, 4348, 4333, 4310, 4294, 4281, 4255, 4214, 4172, 4140, 4107,
-  4057, 3990, 3926, 3873, 3814, 3728, 3617, 3499, 3384, 3262, 3122, 2976,
-  2842, 2725, 2605, 2473, 2342, 2230, 2129, 2012, 1868, 1717, 1584, 1466,
-  1339, 1192, 1039, 898, 774, 656, 538, 420, 298, 167, 28, -106,
-  -227, -342, -464, -589, -706, -808, -905, -1004, -1110, -1219, -1330, -1442,
-  -1548, -1642, -1733, -1838, -1964, -2094, -2203, -2287, -2362, -2446, -2531, -2598,
-  -2637, -2667, -2712, -2779, -2851, -2911, -2959, -3006, -3058, -3106, -3143, -3175,
-  -3208, -3236, -3245, -3234, -3221, -3221, -3219, -3197, -3163, -3151, -3173, -3204,
-  -3211, -3197, -3193, -3209, -3224, -3215, -3194, -3185, -3189, -3183, -3160, -3139,
-  -3131, -3125, -3107, -3087, -3078, -3069, -3033, -2972, -2925, -2917, -2918, -2889,
-  -2831, -2782, -2755, -2716, -2644, -2564, -2514, -2485, -2435, -2346, -2252, -2178,
-  -2099, -1979, -1835, -1725, -1671, -1628, -1546, -1436, -1348, -1297, -1245, -1164,
-  -1077, -1022, -992, -936, -828, -700, -599, -530, -462, -370, -265, -169,
-  -89, -16, 52, 113, 176, 256, 356, 466, 576, 688, 808, 932,
-  1053, 1168, 1283, 1400, 1518, 1636, 1762, 1902, 2048, 2184, 2304, 2417,
-  2531, 2643, 2748, 2848, 2944, 3029, 3092, 3139, 3190, 3262, 3348, 3429,
-  3498, 3572, 3668, 3777, 3874, 3940, 3978, 4000, 4013, 4016, 4013, 4011,
-  4017, 4030, 4050, 4083, 4131, 4186, 4231, 4258, 4270, 4269, 4250, 4205,
-  4135, 4054, 3979, 3914, 3854, 3796, 3740, 3692, 3654, 3622, 3586, 3533,
-  3457, 3363, 3259, 3149, 3025, 2882, 2727, 2578, 2443, 2316, 2185, 2050,
-  1914, 1775, 1623, 1458, 1296, 1148, 1004, 849, 683, 534, 422, 333,
-  230, 95, -50, -169, -253, -333, -441, -583, -739, -888, -1021, -1137,
-  -1243, -1348, -1463, -1586, -1697, -1776, -1828, -1880, -1957, -2050, -2134, -2192,
-  -2241, -2312, -2413, -2518, -2594, -2646, -2707, -2804, -2911, -2976, -2982, -2967,
-  -2984, -3038, -3095, -3128, -3147, -3174, -3209, -3248, -3302, -3383, -3464, -3489,
-  -3444, -3389, -3390, -3436, -3454, -3407, -3339, -3310, -3322, -3333, -3327, -3319,
-  -3301, -3234, -3131, -3073, -3114, -3179, -3118, -2885, -2603, -2432, -2418, -2497,
-  -2614, -2762, -2915, -3008, -3014, -2994, -3000, -2974, -2808, -2514, -2257, -2166,
-  -2175, -2115, -1930, -1743, -1689, -1766, -1866, -1916, -1918, -1881, -1783, -1630,
-  -1476, -1362, -1252, -1088, -879, -711, -638, -621, -584, -504, -419, -362,
-  -322, -275, -213, -141, -52, 52, 152, 221, 260, 296, 355, 435,
-  514, 577, 618, 645, 683, 761, 885, 1025, 1138, 1209, 1263, 1336,
-  1438, 1550, 1650, 1733, 1807, 1891, 1999, 2129, 2257, 2360, 2440, 2528,
-  2639, 2757, 2849, 2907, 2952, 2998, 3032, 3042, 3043, 3066, 3128, 3209,
-  3282, 3333, 3368, 3394, 3423, 3464, 3512, 3539, 3519, 3461, 3411, 3405,
-  3432, 3444, 3416, 3372, 3359, 3394, 3451, 3484, 3472, 3426, 3375, 3337,
-  3306, 3256, 3171, 3061, 2959, 2892, 2855, 2823, 2775, 2709, 2634, 2556,
-  2474, 2386, 2288, 2172, 2035, 1891, 1761, 1651, 1550, 1447, 1346, 1258,
-  1177, 1084, 971, 846, 720, 585, 437, 295, 182, 92, -5, -127,
-  -251, -341, -393, -443, -521, -624, -734, -845, -962, -1081, -1191, -1292,
-  -1398, -1511, -1608, -1667, -1701, -1739, -1791, -1840, -1868, -1885, -1913, -1968,
-  -2045, -2136, -2229, -2306, -2359, -2397, -2444, -2502, -2545, -2553, -2541, -2542,
-  -2566, -2588, -2590, -2585, -2601, -2640, -2683, -2715, -2739, -2761, -2776, -2774,
-  -2763, -2755, -2748, -2729, -2699, -2673, -2664, -2665, -2663, -2650, -2632, -2609,
-  -2579, -2544, -2511, -2481, -2441, -2387, -2333, -2293, -2263, -2227, -2180, -2140,
-  -2118, -2104, -2076, -2031, -1985, -1952, -1921, -1874, -1807, -1735, -1671, -1620,
-  -1575, -1535, -1495, -1454, -1412, -1375, -1341, -1302, -1251, -1190, -1125, -1061,
-  -996, -931, -871, -818, -761, -695, -628, -570, -516, -455, -384, -316,
-  -264, -218, -162, -97, -41, -4, 32, 85, 152, 211, 249, 284,
-  341, 424, 513, 588, 649, 707, 762, 810, 851, 893, 944, 1000,
-  1054, 1105, 1160, 1221, 1284, 1348, 1414, 1486, 1567, 1654, 1740, 1818,
-  1880, 1920, 1946, 1972, 2011, 2058, 2099, 2132, 2168, 2215, 2269, 2322,
-  2372, 2420, 2466, 2505, 2538, 2576, 2624, 2669, 2686, 2673, 2656, 2660,
-  2680, 2693, 2684, 2668, 2671, 2698, 2734, 2754, 2747, 2717, 2677, 2644,
-  2626, 2616, 2599, 2572, 2547, 2531, 2520, 2497, 2457, 2407, 2357, 2304,
-  2246, 2191, 2151, 2120, 2082, 2024, 1950, 1874, 1803, 1738, 1674, 1612,
-  1547, 1473, 1390, 1309, 1235, 1164, 1087, 1005, 926, 859, 801, 743,
-  679, 601, 509, 414, 335, 278, 225, 157, 71, -12, -80, -139,
-  -206, -284, -363, -435, -502, -569, -632, -691, -756, -830, -903, -959,
-  -999, -1047, -1114, -1186, -1242, -1283, -1331, -1396, -1466, -1523, -1564, -1600,
-  -1635, -1664, -1689, -1723, -1774, -1825, -1859, -1875, -1891, -1921, -1958, -1984,
-  -1998, -2009, -2025, -2043, -2059, -2077, -2103, -2130, -2147, -2151, -2154, -2168,
-  -2187, -2200, -2202, -2199, -2199, -2199, -2195, -2189, -2191, -2205, -2224, -2238,
-  -2237, -2225, -2205, -2178, -2148, -2118, -2087, -2053, -2018, -1989, -1973, -1964,
-  -1944, -1902, -1847, -1799, -1770, -1755, -1736, -1704, -1661, -1621, -1592, -1577,
-  -1563, -1528, -1463, -1380, -1312, -1282, -1280, -1272, -1227, -1153, -1081, -1032,
-  -1000, -960, -899, -830, -773, -736, -709, -676, -630, -580, -533, -487,
-  -438, -382, -317, -242, -164, -91, -37, -5, 18, 51, 102, 161,
-  211, 246, 272, 300, 340, 393, 451, 504, 548, 592, 646, 712,
-  775, 820, 850, 876, 906, 936, 961, 984, 1014, 1047, 1079, 1112,
-  1154, 1204, 1243, 1259, 1262, 1282, 1335, 1397, 1438, 1450, 1454, 1472,
-  1499, 1517, 1521, 1522, 1535, 1560, 1586, 1608, 1629, 1651, 1670, 1680,
-  1683, 1687, 1689, 1684, 1665, 1642, 1630, 1634, 1641, 1639, 1624, 1609,
-  1600, 1595, 1591, 1593, 1603, 1610, 1602, 1579, 1559, 1551, 1548, 1526,
-  1482, 1431, 1394, 1375, 1365, 1352, 1335, 1310, 1280, 1250, 1229, 1213,
-  1188, 1141, 1081, 1028, 992, 962, 919, 863, 806, 758, 719, 681,
-  643, 602, 554, 499, 444, 402, 376, 352, 312, 252, 190, 148,
-  125, 100, 52, -15, -75, -110, -126, -144, -180, -229, -274, -308,
-  -334, -362, -399, -449, -510, -570, -615, -638, -652, -679, -727, -780,
-  -816, -832, -845, -874, -922, -972, -1006, -1020, -1026, -1040, -1071, -1114,
-  -1154, -1179, -1185, -1179, -1175, -1180, -1197, -1218, -1231, -1236, -1243, -1263,
-  -1292, -1317, -1327, -1327, -1328, -1336, -1347, -1357, -1362, -1353, -1321, -1275,
-  -1240, -1236, -1251, -1256, -1240, -1224, -1229, -1250, -1261, -1249, -1226, -1208,
-  -1196, -1180, -1162, -1145, -1127, -1102, -1070, -1045, -1032, -1023, -1009, -994,
-  -985, -975, -951, -914, -882, -863, -844, -809, -758, -717, -700, -698,
-  -692, -673, -642, -601, -551, -503, -468, -444, -417, -381, -348, -333,
-  -332, -323, -296, -258, -225, -202, -183, -161, -132, -94, -47, -4,
-  25, 41, 57, 85, 118, 139, 145, 150, 165, 191, 218, 244,
-  272, 300, 325, 344, 364, 391, 422, 449, 470, 492, 522, 557,
-  586, 599, 599, 597, 603, 619, 641, 661, 675, 684, 692, 704,
-  723, 746, 766, 778, 780, 781, 790, 808, 820, 817, 806, 801,
-  806, 807, 797, 785, 791, 822, 861, 882, 881, 871, 866, 865,
-  862, 855, 851, 852, 853, 849, 840, 830, 821, 810, 801, 802,
-  819, 845, 865, 867, 854, 833, 812, 795, 781, 767, 751, 734,
-  723, 721, 723, 717, 698, 677, 666, 666, 663, 652, 638, 633,
-  637, 638, 627, 604, 575, 550, 534, 528, 530, 534, 529, 515,
-  495, 473, 454, 439, 428, 417, 407, 397, 387, 374, 352, 322,
-  292, 272, 262, 249, 229, 207, 190, 173, 147, 111, 79, 60,
-  47, 26, -9, -44, -70, -85, -95, -104, -118, -151, -206, -265,
-  -294, -280, -245, -228, -250, -297, -343, -370, -379, -379, -382, -399,
-  -433, -472, -494, -490, -477, -481, -518, -572, -612, -617, -593, -570,
-  -576, -611, -651, -664, -647, -628, -638, -684, -736, -762, -751, -719,
-  -693, -692, -716, -749, -773, -779, -769, -753, -741, -734, -731, -725,
-  -712, -695, -682, -684, -697, -708, -703, -680, -652, -632, -626, -632,
-  -646, -659, -662, -650, -627, -603, -582, -561, -541, -528, -524, -525,
-  -523, -514, -502, -485, -462, -438, -422, -419, -418, -404, -373, -332,
-  -294, -266, -257, -267, -286, -295, -278, -242, -205, -180, -162, -139,
-  -113, -93, -85, -84, -83, -78, -62, -32, 4, 27, 24, 10,
-  10, 38, 77, 97, 92, 77, 75, 92, 116, 134, 143, 145,
-  142, 141, 148, 168, 195, 214, 216, 208, 197, 191, 183, 172,
-  165, 173, 198, 228, 248, 250, 240, 231, 232, 244, 263, 281,
-  289, 291, 291, 292, 292, 285, 273, 261, 252, 246, 247, 257,
-  274, 288, 287, 271, 249, 231, 222, 220, 229, 253, 288, 316,
-  320, 298, 260, 223, 202, 206, 238, 291, 345, 382, 395, 394,
-  390, 381, 360, 332, 314, 320, 341, 358, 359, 352, 351, 361,
-  377, 388, 388, 380, 367, 361, 367, 384, 403, 415, 417, 413,
-  405, 393, 375, 360, 356, 362, 372, 377, 378, 381, 387, 387,
-  370, 336, 303, 292, 309, 338, 360, 366, 361, 352, 339, 313,
-  275, 238, 214, 210, 222, 242, 260, 264, 251, 225, 197, 173,
-  152, 133, 119, 115, 116, 109, 89, 63, 44, 36, 34, 31,
-  28, 25, 20, 12, 3, -5, -17, -45, -83, -112, -107, -71,
-  -30, -11, -17, -33, -51, -79, -118, -154, -167, -155, -132, -115,
-  -104, -95, -94, -110, -141, -168, -179, -179, -182, -191, -194, -181,
-  -156, -134, -128, -142, -170, -200, -222, -233, -236, -232, -217, -193,
-  -169, -161, -171, -188, -200, -211, -226, -241, -242, -217, -177, -144,
-  -134, -147, -174, -207, -233, -244, -235, -215, -198, -190, -186, -178,
-  -169, -167, -177, -195, -212, -214, -201, -179, -162, -162, -174, -186,
-  -186, -178, -176, -183, -188, -181, -168, -163, -166, -167, -158, -149,
-  -150, -153, -141, -112, -87, -89, -116, -146, -155, -141, -114, -91,
-  -84, -90, -96, -92, -79, -73, -81, -92, -86, -63, -37, -22,
-  -20, -29, -50, -76, -90, -75, -38, -3, 9, 0, -16, -28,
-  -31, -23, -2, 22, 33, 20, -6, -21, -12, 14, 41, 53,
-  52, 48, 48, 50, 54, 61, 81, 108, 119, 97, 51, 17,
-  23, 63, 105, 133, 149, 154, 138, 94, 47, 35, 67, 111,
-  128, 117, 106, 107, 106, 83, 52, 47, 78, 121, 136, 114,
-  79, 63, 78, 112, 141, 152, 153, 154, 151, 120, 50, -25,
-  -50, 1, 92, 157, 164, 136, 112, 100, 76, 31, -13, -21,
-  11, 53, 75, 81, 89, 103, 102, 69, 16, -21, -23, 2,
-  36, 72, 98, 96, 55, 9, 7, 57, 104, 95, 47, 21,
-  36, 46, 11, -42, -54, -16, 29, 45, 48, 59, 67, 53,
-  32, 37, 65, 79, 54, 13, -12, -20, -32, -45, -43, -24,
-  -13, -23, -37, -34, -16, -4, -10, -30, -57, -85, -104, -99,
-  -70, -38, -31, -56, -93, -111, -97, -65, -47, -58, -76, -77,
-  -69, -97, -175, -251, -262, -210, -157, -144, -146, -125, -96, -110,
-  -178, -262, -324, -359, -365, -321, -228, -148, -146, -214, -265, -239,
-  -175, -165, -237, -327, -350, -281, -161, -54, -6, -31, -110, -205,
-  -275, -308, -316, -310, -285, -228, -141, -52, -7, -34, -122, -216,
-  -258, -234, -192, -190, -223, -205, -46, 242, 544, 760, 937, 1238,
-  1744, 2283, 2459, 1914, 601, -1120, -2611, -3236, -2660, -1050, 957, 2541,
-  3084, 2436, 926, -837, -2239, -2902, -2790, -2139, -1251, -352, 398, 820,
-  761, 263, -402, -927, -1214, -1345, -1336, -1049, -419, 299, 654, 437,
-  -77, -397, -294, 31, 228, 158, -55, -240, -346, -401, -423, -423,
-  -453, -572, -749, -855, -803, -641, -493, -420, -370, -262, -83, 106,
-  211, 160, -61, -383, -676, -822, -759, -489, -78, 296, 387, 90,
-  -372, -590, -383, -1, 190, 186, 329, 768, 1109, 801, -158, -1092,
-  -1288, -696, 124, 662, 908, 1123, 1324, 1172, 406, -695, -1427, -1281,
-  -425, 494, 1009, 1182, 1261, 1157, 526, -581, -1444, -1322, -330, 615,
-  814, 532, 535, 1042, 1466, 1222, 486, -60, -59, 228, 428, 537,
-  730, 900, 676, -56, -830, -935, -60, 1399, 2614, 2893, 2081, 587,
-  -916, -1842, -1872, -940, 751, 2582, 3568, 2905, 760, -1556, -2482, -1530,
-  283, 1399, 1164, 312, 39, 717, 1563, 1532, 393, -1061, -1784, -1351,
-  -170, 994, 1617, 1645, 1304, 771, 58, -793, -1470, -1498, -749, 234,
-  666, 393, 125, 531, 1207, 963, -658, -2467, -2693, -981, 1059, 1531,
-  235, -1281, -1505, -450, 622, 547, -824, -2676, -3744, -2961, -287, 2792,
-  4003, 2168, -1497, -4265, -4267, -1957, 720, 2229, 2334, 1495, 92, -1544,
-  -2749, -2719, -1207, 1109, 2984, 3318, 1769, -946, -3257, -3658, -1881, 757,
-  2403, 2204, 847, -348, -687, -488, -454, -834, -1139, -619, 868, 2349,
-  2325, 256, -2470, -3431, -1459, 1974, 3901, 2592, -807, -3318, -2778, 382,
-  3662, 4618, 2734, -421, -2642, -2861, -1734, -700, -452, -298, 952, 3372,
-  5205, 4102, -453, -5863, -8030, -4852, 1660, 6883, 7317, 3043, -2891, -6846,
-  -6575, -2205, 3608, 6910, 5263, 63, -4541, -5574, -3710, -1454, 254, 2305,
-  4579, 4793, 1380, -3530, -5782, -3857, -425, 1243, 1049, 1144, 2186, 2316,
-  73, -3195, -4766, -3613, -1001, 1504, 3351, 4217, 3222, -19, -3952, -5738,
-  -3785, 597, 4173, 4332, 993, -3398, -5574, -3767, 899, 5137, 5958, 2811,
-  -2284, -6327, -7053, -3882, 1748, 6752, 7954, 4338, -1923, -6925, -7805, -4392,
-  1186, 5886, 7052, 3688, -2444, -7217, -6843, -1131, 5851, 8806, 5421, -1893,
-  -7985, -8842, -4315, 2182, 6513, 6834, 4266, 989, -1905, -4432, -6140, -5552,
-  -1785, 3690, 7625, 7530, 3505, -2098, -6270, -6811, -3434, 1683, 4905, 3913,
-  -30, -3079, -2544, 570, 2940, 2463, -9, -2162, -2687, -2036, -1291, -836,
-  -181, 1159, 2718, 3147, 1540, -1238, -2979, -2353, -473, 360, -554, -1507,
-  -673, 1470, 2763, 2067, 402, -722, -1164, -1696, -2341, -2143, -618, 1411,
-  2745, 2995, 2391, 907, -1588, -4294, -5378, -3508, 589, 4422, 5658, 3796,
-  263, -2804, -3941, -3052, -1128, 687, 1867, 2459, 2411, 1286, -1067, -3616,
-  -4393, -2141, 2107, 5359, 5024, 1252, -3074, -4811, -3146, 147, 2681, 3320,
-  2257, 80, -2461, -4010, -3056, 394, 3948, 4573, 1580, -2482, -4216, -2522,
-  735, 2808, 2394, 205, -2015, -2751, -1574, 591, 2071, 1818, 388, -653,
-  -425, 370, 385, -745, -2022, -2216, -1044, 833, 2555, 3456, 2955, 719,
-  -2648, -5304, -5162, -1679, 3261, 6473, 5810, 1740, -3109, -5889, -5327, -2183,
-  1577, 4061, 4379, 2845, 531, -1447, -2416, -2220, -1084, 469, 1730, 2127,
-  1591, 569, -386, -944, -955, -337, 731, 1627, 1700, 983, 201, -161,
-  -521, -1490, -2579, -2238, 388, 3964, 5747, 4063, -69, -3796, -4765, -2760,
-  478, 2716, 2796, 1294, -134, -267, 621, 1212, 624, -730, -1761, -1874,
-  -1238, -176, 1181, 2506, 3056, 2291, 629, -793, -1202, -826, -426, -432,
-  -655, -598, 109, 1402, 2605, 2707, 1232, -1027, -2452, -2048, -381, 1051,
-  1274, 521, -309, -480, 216, 1442, 2369, 2077, 395, -1647, -2567, -1841,
-  -417, 328, 40, -318, 430, 2374, 4230, 4291, 1862, -1966, -4946, -5359,
-  -3308, -395, 1860, 3146, 3946, 4370, 3780, 1603, -1726, -4740, -5844, -4356,
-  -979, 2573, 4652, 4725, 3473, 1841, 139, -1766, -3561, -4284, -3216, -756,
-  1855, 3534, 3891, 3011, 1260, -582, -1532, -1236, -488, -469, -1379, -2118,
-  -1511, 383, 2369, 3332, 3092, 2148, 972, -274, -1568, -2791, -3618, -3516,
-  -2009, 784, 3816, 5583, 5145, 2777, -315, -2810, -3887, -3455, -2110, -761,
-  105, 881, 2257, 4013, 4683, 2900, -905, -4494, -5703, -4195, -1323, 1394,
-  3300, 4307, 4237, 2873, 503, -1963, -3563, -3879, -3068, -1478, 586, 2720,
-  4190, 4109, 2120, -949, -3333, -3607, -1925, 114, 997, 643, 159, 411,
-  1116, 1356, 675, -525, -1473, -1637, -935, 278, 1290, 1376, 394, -958,
-  -1676, -1338, -399, 371, 604, 441, 139, -170, -374, -291, 102, 429,
-  161, -785, -1765, -1908, -964, 403, 1225, 1096, 401, -252, -641, -907,
-  -1098, -994, -456, 243, 612, 472, 133, -14, 29, -98, -627, -1312,
-  -1595, -1089, 81, 1328, 1968, 1657, 634, -450, -1045, -1147, -1181, -1392,
-  -1444, -788, 549, 1762, 2014, 1305, 397, -123, -401, -816, -1181, -872,
-  203, 1169, 1034, -148, -1279, -1392, -538, 560, 1389, 1848, 1783, 868,
-  -797, -2272, -2422, -1064, 756, 1767, 1649, 1102, 852, 799, 237, -1161,
-  -2685, -3008, -1375, 1528, 3891, 4139, 2149, -736, -2862, -3449, -2804, -1678,
-  -601, 272, 1014, 1765, 2557, 3078, 2718, 1097, -1361, -3535, -4430, -3838,
-  -2176, 65, 2452, 4272, 4554, 2788, -395, -3458, -4972, -4436, -2321, 399,
-  2712, 3904, 3785, 2660, 993, -889, -2704, -3947, -3985, -2562, -119, 2444,
-  4251, 4658, 3322, 471, -2806, -4921, -4840, -2890, -387, 1525, 2601, 3124,
-  3129, 2253, 360, -1891, -3283, -2953, -1116, 1055, 2288, 2094, 961, -191,
-  -749, -738, -593, -668, -893, -810, -21, 1272, 2189, 1840, 259, -1422,
-  -1913, -933, 633, 1678, 1782, 1200, 283, -732, -1502, -1570, -837, 170,
-  754, 744, 550, 554, 662, 510, -71, -918, -1683, -1924, -1199, 566,
-  2678, 3898, 3328, 1148, -1559, -3592, -4209, -3210, -939, 1627, 3191, 3002,
-  1521, -4, -729, -861, -1071, -1488, -1561, -842, 374, 1337, 1597, 1295,
-  776, 174, -540, -1244, -1615, -1419, -766, -13, 543, 839, 943, 835,
-  363, -558, -1715, -2572, -2539, -1365, 618, 2578, 3570, 3030, 1118, -1328,
-  -3204, -3725, -2801, -1019, 733, 1736, 1752, 1025, 40, -800, -1317, -1502,
-  -1377, -969, -371, 261, 804, 1207, 1370, 1028, -52, -1683, -3111, -3437,
-  -2315, -279, 1634, 2613, 2509, 1701, 638, -450, -1500, -2379, -2787, -2432,
-  -1313, 180, 1469, 2141, 2120, 1576, 730, -239, -1162, -1858, -2166, -1982,
-  -1272, -135, 1082, 1835, 1721, 849, -176, -772, -881, -893, -1082, -1234,
-  -910, -19, 1010, 1646, 1719, 1395, 799, -153, -1483, -2829, -3510, -2950,
-  -1096, 1468, 3689, 4472, 3284, 644, -2032, -3335, -2859, -1393, -119, 345,
-  191, -45, -5, 382, 1002, 1574, 1670, 965, -416, -1877, -2735, -2649,
-  -1698, -211, 1368, 2536, 2892, 2366, 1251, -66, -1345, -2420, -2984, -2658,
-  -1358, 466, 2090, 2990, 3056, 2383, 1053, -784, -2674, -3896, -3843, -2430,
-  -145, 2248, 4044, 4737, 4062, 2106, -565, -3002, -4313, -4132, -2740, -764,
-  1187, 2636, 3210, 2742, 1474, 30, -974, -1357, -1360, -1262, -1068, -593,
-  240, 1259, 2128, 2487, 2062, 802, -972, -2594, -3347, -2858, -1304, 677,
-  2288, 2968, 2668, 1821, 937, 169, -698, -1773, -2666, -2688, -1503, 464,
-  2291, 3208, 3018, 2024, 688, -611, -1609, -2072, -1790, -743, 695, 1798,
-  1925, 1071, -63, -635, -367, 312, 781, 788, 502, 184, -51, -183,
-  -160, 62, 419, 745, 882, 753, 361, -192, -699, -932, -783, -319,
-  332, 1074, 1769, 2124, 1791, 690, -786, -1953, -2274, -1673, -502, 735,
-  1631, 1987, 1803, 1219, 443, -313, -887, -1169, -1100, -689, -30, 687,
-  1219, 1361, 1046, 384, -380, -969, -1173, -895, -185, 753, 1576, 1901,
-  1489, 416, -884, -1800, -1872, -1079, 130, 1098, 1355, 878, 55, -593,
-  -738, -411, 90, 458, 587, 545, 380, 24, -563, -1174, -1395, -952,
-  -29, 824, 1129, 835, 265, -219, -457, -465, -310, -72, 114, 91,
-  -197, -607, -881, -826, -439, 112, 607, 879, 866, 609, 215, -194,
-  -511, -624, -421, 108, 731, 1005, 597, -348, -1219, -1434, -928, -140,
-  491, 888, 1187, 1352, 1137, 433, -484, -1164, -1363, -1149, -681, -36,
-  723, 1431, 1863, 1854, 1339, 370, -775, -1564, -1517, -673, 348, 874,
-  773, 449, 290, 279, 179, -57, -229, -176, 35, 246, 413, 584,
-  746, 791, 637, 297, -180, -744, -1282, -1552, -1305, -491, 619, 1543,
-  1848, 1397, 439, -536, -1104, -1157, -906, -648, -533, -499, -369, -1,
-  594, 1191, 1416, 974, -90, -1324, -2114, -2064, -1241, -123, 708, 922,
-  611, 142, -192, -385, -582, -785, -786, -414, 214, 771, 1010, 906,
-  545, -1, -632, -1149, -1350, -1197, -813, -329, 202, 701, 1001, 973,
-  708, 454, 375, 391, 297, -22, -491, -890, -960, -540, 273, 1090,
-  1464, 1227, 581, -137, -721, -1087, -1091, -573, 367, 1248, 1527, 1077,
-  295, -289, -454, -359, -257, -230, -181, 6, 331, 664, 810, 628,
-  154, -387, -741, -828, -761, -653, -437, 34, 699, 1203, 1175, 618,
-  -55, -402, -351, -204, -270, -548, -757, -639, -210, 239, 380, 112,
-  -330, -551, -343, 102, 359, 172, -295, -628, -546, -112, 386, 656,
-  537, 33, -665, -1220, -1318, -890, -158, 547, 986, 1065, 767, 146,
-  -611, -1193, -1331, -981, -341, 303, 745, 912, 809, 478, 21, -388,
-  -578, -510, -327, -227, -265, -293, -136, 195, 479, 487, 174, -285,
-  -632, -674, -376, 114, 545, 726, 639, 399, 102, -226, -536, -697,
-  -605, -324, -31, 183, 371, 569, 657, 486, 97, -286, -494, -546,
-  -499, -285, 166, 674, 857, 510, -117, -523, -438, -36, 311, 394,
-  273, 102, -35, -140, -227, -280, -261, -137, 88, 354, 552, 590,
-  446, 185, -75, -209, -136, 103, 337, 366, 114, -306, -665, -760,
-  -517, -35, 440, 653, 527, 244, 68, 96, 188, 173, 36, -119,
-  -224, -277, -244, -58, 236, 424, 328, 27, -208, -224, -127, -88,
-  -98, -11, 203, 368, 293, -7, -342, -526, -496, -277, 53, 361,
-  496, 404, 183, -14, -144, -276, -428, -479, -295, 65, 341, 323,
-  75, -124, -73, 161, 339, 306, 106, -104, -212, -194, -61, 160,
-  400, 542, 489, 239, -98, -363, -430, -267, 28, 282, 369, 308,
-  228, 226, 269, 255, 130, -67, -257, -374, -359, -177, 133, 440,
-  588, 506, 241, -97, -396, -561, -535, -335, -55, 191, 327, 326,
-  189, -41, -240, -248, -5, 349, 539, 361, -144, -713, -1035, -961,
-  -570, -77, 327, 540, 502, 173, -397, -974, -1224, -964, -328, 334,
-  717, 729, 462, 72, -294, -557, -739, -901, -1011, -892, -427, 204,
-  577, 409, -145, -638, -769, -611, -436, -396, -435, -427, -324, -162,
-  4, 139, 219, 227, 120, -157, -602, -1057, -1251, -996, -382, 278,
-  684, 739, 527, 193, -133, -363, -465, -477, -442, -337, -118, 166,
-  361, 347, 163, -57, -224, -333, -380, -341, -231, -111, 3, 179,
-  435, 635, 601, 346, 84, -34, -83, -203, -328, -219, 231, 814,
-  1192, 1191, 865, 357, -202, -662, -846, -656, -157, 469, 1027, 1358,
-  1356, 1035, 567, 185, -1, -45, -13, 145, 509, 992, 1315, 1218,
-  695, 9, -499, -618, -357, 88, 468, 638, 650, 678, 822, 959,
-  846, 383, -213, -534, -317, 320, 972, 1265, 1111, 686, 237, -81,
-  -229, -229, -122, 60, 297, 570, 814, 920, 811, 533, 248, 121,
-  207, 429, 645, 743, 708, 614, 553, 533, 475, 332, 191, 213,
-  432, 671, 705, 498, 236, 129, 216, 392, 569, 738, 874, 873,
-  641, 253, -58, -82, 183, 553, 820, 874, 706, 375, 15, -187,
-  -107, 177, 422, 443, 291, 171, 205, 316, 374, 355, 327, 299,
-  190, -31, -253, -320, -207, -33, 77, 87, 3, -187, -466, -721,
-  -821, -758, -648, -563, -438, -207, 14, -4, -342, -807, -1119, -1182,
-  -1088, -933, -725, -504, -431, -628, -999, -1287, -1342, -1259, -1208, -1213,
-  -1165, -1010, -845, -797, -895, -1074, -1258, -1393, -1429, -1348, -1218, -1157,
-  -1236, -1414, -1594, -1707, -1742, -1721, -1685, -1668, -1653, -1569, -1368, -1112,
-  -943, -946, -1073, -1225, -1362, -1495, -1605, -1624, -1521, -1353, -1199, -1087,
-  -1013, -996, -1070, -1218, -1369, -1450, -1438, -1338, -1183, -1047, -1016, -1102,
-  -1198, -1177, -1046, -940, -957, -1038, -1031, -848, -539, -232, -67, -147,
-  -485, -959, -1349, -1483, -1349, -1071, -772, -501, -253, -35, 115, 146,
-  46, -123, -234, -188, -21, 119, 120, 13, -80, -92, -57, -23,
-  28, 141, 314, 491, 608, 627, 548, 429, 391, 529, 789, 968,
-  888, 576, 259, 181, 434, 924, 1459, 1864, 2064, 2114, 2144, 2241,
-  2385, 2501, 2563, 2618, 2706, 2786, 2774, 2655, 2521, 2499, 2635, 2885,
-  3175, 3448, 3653, 3729, 3652, 3486, 3343, 3270, 3236, 3223, 3303, 3529,
-  3785, 3840, 3606, 3275, 3128, 3228, 3403, 3498, 3548, 3626, 3647, 3432,
-  2968, 2467, 2151, 2062, 2127, 2310, 2583, 2797, 2743, 2399, 2013, 1847,
-  1876, 1835, 1554, 1154, 874, 793, 777, 656, 377, -2, -380, -637,
-  -670, -480, -191, 33, 107, 17, -255, -732, -1331, -1850, -2126, -2183,
-  -2156, -2090, -1904, -1585, -1320, -1354, -1723, -2218, -2585, -2719, -2641, -2413,
-  -2140, -1976, -2019, -2174, -2233, -2123, -1999, -2032, -2156, -2142, -1902, -1623,
-  -1542, -1664, -1793, -1797, -1743, -1748, -1805, -1829, -1804, -1798, -1812, -1730,
-  -1466, -1120, -882, -806, -763, -651, -581, -747, -1133, -1463, -1486, -1240,
-  -973, -835, -765, -675, -626, -723, -901, -957, -807, -613, -595, -769,
-  -973, -1092, -1164, -1237, -1254, -1155, -1042, -1111, -1409, -1732, -1831, -1679,
-  -1479, -1427, -1526, -1636, -1666, -1670, -1772, -2043, -2415, -2724, -2819, -2675,
-  -2411, -2188, -2089, -2097, -2175, -2322, -2526, -2708, -2767, -2697, -2607, -2600,
-  -2669, -2745, -2790, -2804, -2736, -2501, -2124, -1801, -1741, -1938, -2174, -2257,
-  -2204, -2142, -2102, -2005, -1818, -1617, -1483, -1397, -1313, -1252, -1249, -1234,
-  -1084, -818, -624, -630, -718, -660, -427, -233, -253, -408, -484, -378,
-  -137, 192, 595, 971, 1119, 965, 709, 624, 738, 842, 829, 889,
-  1249, 1817, 2215, 2195, 1902, 1670, 1673, 1830, 2005, 2157, 2314, 2513,
-  2822, 3338, 4035, 4676, 4963, 4833, 4519, 4294, 4215, 4160, 4075, 4048,
-  4166, 4372, 4545, 4635, 4656, 4598, 4436, 4254, 4250, 4536, 4985, 5323,
-  5392, 5260, 5086, 4934, 4753, 4496, 4197, 3954, 3858, 3953, 4199, 4475,
-  4619, 4538, 4263, 3915, 3596, 3322, 3058, 2792, 2588, 2527, 2605, 2690,
-  2625, 2374, 2059, 1838, 1757, 1743, 1696, 1550, 1275, 884, 458, 104,
-  -143, -362, -637, -940, -1169, -1272, -1276, -1210, -1078, -947, -954, -1156,
-  -1438, -1649, -1811, -2079, -2489, -2859, -3007, -2961, -2875, -2806, -2697, -2557,
-  -2505, -2580, -2626, -2481, -2226, -2104, -2219, -2419, -2508, -2476, -2434, -2415,
-  -2334, -2149, -1942, -1806, -1712, -1565, -1351, -1159, -1072, -1073, -1105, -1157,
-  -1249, -1351, -1373, -1266, -1088, -932, -804, -620, -334, -27, 168, 208,
-  175, 159, 158, 112, 1, -133, -246, -328, -384, -404, -373, -295,
-  -195, -87, 25, 131, 195, 165, 1, -281, -598, -844, -972, -1028,
-  -1073, -1112, -1122, -1128, -1196, -1332, -1455, -1521, -1613, -1839, -2144, -2338,
-  -2331, -2277, -2381, -2632, -2811, -2775, -2628, -2571, -2666, -2813, -2928, -3036,
-  -3180, -3321, -3402, -3447, -3522, -3609, -3594, -3433, -3252, -3219, -3330, -3389,
-  -3242, -2964, -2774, -2784, -2897, -2953, -2896, -2780, -2666, -2583, -2556, -2575,
-  -2546, -2362, -2056, -1809, -1730, -1704, -1553, -1313, -1203, -1300, -1388, -1249,
-  -969, -804, -790, -693, -390, -97, -64, -190, -162, 66, 203, 82,
-  -27, 216, 705, 994, 913, 793, 978, 1346, 1529, 1465, 1453, 1663,
-  1891, 1917, 1873, 2007, 2228, 2178, 1784, 1448, 1536, 1894, 2101, 2087,
-  2216, 2755, 3509, 4113, 4471, 4707, 4822, 4693, 4410, 4314, 4562, 4852,
-  4795, 4457, 4282, 4488, 4782, 4759, 4415, 4089, 4029, 4212, 4530, 4921,
-  5260, 5337, 5110, 4851, 4846, 4996, 4917, 4472, 4001, 3922, 4229, 4556,
-  4649, 4574, 4463, 4284, 3980, 3675, 3527, 3442, 3152, 2628, 2232, 2296,
-  2661, 2824, 2535, 2075, 1863, 1935, 1969, 1745, 1401, 1179, 1074, 878,
-  505, 100, -196, -450, -818, -1259, -1532, -1495, -1313, -1279, -1467, -1665,
-  -1672, -1571, -1626, -1938, -2317, -2524, -2556, -2619, -2830, -3069, -3152, -3076,
-  -3000, -3025, -3077, -3043, -2928, -2826, -2776, -2733, -2672, -2647, -2693, -2729,
-  -2625, -2368, -2105, -1992, -2028, -2052, -1919, -1657, -1446, -1427, -1548, -1610,
-  -1486, -1260, -1124, -1163, -1270, -1291, -1180, -975, -704, -392, -134, -29,
-  -20, 95, 402, 694, 683, 375, 95, 97, 271, 325, 176, 9,
-  -19, 33, 51, 70, 181, 324, 319, 137, -27, -11, 82, 14,
-  -269, -573, -717, -729, -759, -870, -1016, -1160, -1316, -1473, -1570, -1588,
-  -1609, -1728, -1940, -2159, -2326, -2446, -2555, -2680, -2863, -3118, -3366, -3453,
-  -3317, -3104, -3028, -3141, -3279, -3290, -3219, -3228, -3376, -3560, -3669, -3696,
-  -3688, -3651, -3577, -3512, -3520, -3569, -3538, -3359, -3110, -2937, -2895, -2915,
-  -2900, -2811, -2661, -2493, -2372, -2347, -2383, -2364, -2211, -1992, -1858, -1861,
-  -1876, -1751, -1473, -1171, -948, -789, -633, -470, -340, -251, -168, -79,
-  -27, -33, -31, 77, 297, 514, 624, 655, 728, 902, 1102, 1221,
-  1258, 1305, 1409, 1496, 1478, 1383, 1335, 1394, 1491, 1547, 1613, 1813,
-  2160, 2497, 2655, 2627, 2519, 2386, 2200, 1973, 1833, 1899, 2143, 2457,
-  2826, 3329, 3951, 4488, 4731, 4706, 4634, 4662, 4716, 4653, 4471, 4301,
-  4249, 4301, 4384, 4434, 4387, 4211, 3991, 3919, 4120, 4500, 4823, 4951,
-  4961, 4994, 5062, 5042, 4827, 4444, 4037, 3771, 3744, 3918, 4126, 4192,
-  4084, 3933, 3872, 3881, 3814, 3574, 3215, 2881, 2675, 2592, 2537, 2398,
-  2123, 1788, 1555, 1526, 1632, 1691, 1595, 1408, 1257, 1163, 1014, 704,
-  251, -238, -669, -1017, -1289, -1489, -1635, -1768, -1917, -2037, -2048, -1934,
-  -1795, -1774, -1914, -2122, -2273, -2345, -2434, -2637, -2943, -3233, -3381, -3349,
-  -3211, -3069, -2966, -2860, -2700, -2505, -2361, -2337, -2414, -2521, -2598, -2623,
-  -2581, -2463, -2301, -2154, -2044, -1924, -1744, -1536, -1393, -1354, -1356, -1303,
-  -1185, -1069, -1016, -1012, -994, -925, -830, -761, -735, -698, -558, -279,
-  64, 347, 508, 588, 646, 671, 596, 395, 128, -96, -196, -160,
-  -48, 46, 69, 64, 120, 238, 289, 150, -131, -360, -412, -365,
-  -393, -571, -822, -1035, -1172, -1257, -1318, -1376, -1458, -1566, -1664, -1714,
-  -1748, -1844, -2030, -2241, -2383, -2422, -2397, -2379, -2443, -2618, -2849, -2998,
-  -2970, -2833, -2762, -2829, -2915, -2867, -2717, -2657, -2798, -3038, -3212, -3282,
-  -3319, -3334, -3258, -3083, -2921, -2860, -2823, -2668, -2404, -2214, -2236, -2386,
-  -2466, -2389, -2256, -2199, -2231, -2253, -2182, -2027, -1856, -1714, -1590, -1439,
-  -1245, -1044, -878, -748, -626, -507, -422, -380, -344, -279, -206, -161,
-  -119, -13, 157, 304, 381, 451, 592, 753, 800, 707, 610, 630,
-  720, 754, 725, 756, 923, 1157, 1356, 1518, 1687, 1820, 1809, 1643,
-  1476, 1461, 1573, 1653, 1611, 1542, 1601, 1811, 2025, 2075, 1938, 1746,
-  1656, 1716, 1866, 2040, 2246, 2535, 2911, 3317, 3692, 4009, 4235, 4295,
-  4150, 3897, 3720, 3704, 3746, 3705, 3605, 3608, 3768, 3909, 3837, 3601,
-  3449, 3517, 3680, 3764, 3799, 3950, 4217, 4371, 4235, 3925, 3708, 3669,
-  3650, 3518, 3363, 3361, 3515, 3650, 3633, 3500, 3345, 3178, 2948, 2660,
-  2382, 2169, 2013, 1891, 1799, 1724, 1650, 1581, 1550, 1548, 1503, 1361,
-  1153, 945, 736, 464, 120, -214, -482, -727, -993, -1210, -1277, -1239,
-  -1282, -1484, -1674, -1640, -1422, -1292, -1428, -1716, -1922, -1976, -2007, -2136,
-  -2345, -2555, -2726, -2827, -2800, -2633, -2438, -2356, -2387, -2381, -2249, -2091,
-  -2072, -2207, -2350, -2382, -2327, -2264, -2199, -2075, -1888, -1706, -1583, -1505,
-  -1430, -1363, -1340, -1376, -1443, -1506, -1537, -1512, -1420, -1293, -1201, -1170,
-  -1141, -1029, -824, -615, -480, -398, -278, -81, 116, 188, 83, -140,
-  -364, -494, -512, -463, -412, -384, -355, -295, -219, -179, -201, -264,
-  -338, -416, -489, -525, -510, -507, -588, -720, -779, -724, -688, -815,
-  -1041, -1162, -1115, -1078, -1213, -1409, -1433, -1285, -1235, -1445, -1731, -1806,
-  -1681, -1632, -1789, -1951, -1885, -1670, -1579, -1694, -1817, -1787, -1719, -1820,
-  -2072, -2248, -2225, -2133, -2147, -2240, -2244, -2113, -1990, -2000, -2069, -2039,
-  -1889, -1767, -1769, -1805, -1718, -1513, -1369, -1418, -1577, -1651, -1570, -1451,
-  -1422, -1457, -1424, -1272, -1102, -1031, -1043, -1014, -869, -673, -537, -485,
-  -433, -313, -171, -114, -165, -216, -144, 36, 180, 186, 130, 178,
-  375, 572, 588, 420, 252, 258, 428, 612, 690, 693, 739, 898,
-  1111, 1258, 1286, 1269, 1320, 1443, 1515, 1441, 1294, 1233, 1284, 1302,
-  1184, 1056, 1118, 1346, 1485, 1391, 1251, 1341, 1625, 1783, 1656, 1478,
-  1563, 1863, 2028, 1882, 1633, 1561, 1653, 1692, 1628, 1656, 1918, 2278,
-  2507, 2584, 2677, 2865, 3002, 2910, 2619, 2345, 2270, 2393, 2576, 2691,
-  2712, 2708, 2763, 2881, 2970, 2933, 2782, 2640, 2609, 2661, 2678, 2581,
-  2419, 2313, 2340, 2462, 2559, 2541, 2417, 2268, 2146, 2043, 1952, 1935,
-  2058, 2275, 2417, 2355, 2128, 1876, 1663, 1421, 1090, 755, 592, 684,
-  924, 1126, 1188, 1155, 1113, 1069, 945, 683, 339, 37, -148, -250,
-  -335, -413, -451, -448, -456, -512, -595, -679, -778, -910, -1023, -1039,
-  -970, -944, -1059, -1261, -1411, -1458, -1485, -1571, -1677, -1702, -1621, -1508,
-  -1434, -1413, -1448, -1560, -1720, -1810, -1744, -1609, -1593, -1733, -1829, -1689,
-  -1412, -1302, -1478, -1707, -1677, -1376, -1086, -1023, -1124, -1203, -1205, -1214,
-  -1279, -1361, -1439, -1550, -1687, -1739, -1616, -1392, -1240, -1226, -1236, -1123,
-  -887, -681, -651, -798, -988, -1080, -1048, -997, -1026, -1110, -1144, -1096,
-  -1058, -1105, -1175, -1156, -1062, -1010, -1036, -1030, -921, -816, -862, -1035,
-  -1173, -1216, -1261, -1363, -1417, -1340, -1238, -1277, -1419, -1463, -1357, -1298,
-  -1435, -1623, -1620, -1451, -1377, -1505, -1611, -1460, -1162, -1021, -1123, -1247,
-  -1222, -1171, -1282, -1483, -1525, -1358, -1216, -1276, -1395, -1324, -1078, -919,
-  -983, -1104, -1066, -902, -802, -822, -826, -729, -622, -606, -628, -581,
-  -504, -521, -627, -653, -508, -322, -277, -366, -431, -396, -340, -337,
-  -339, -281, -189, -112, -6, 184, 379, 420, 302, 236, 390, 647,
-  727, 539, 292, 238, 386, 539, 553, 479, 465, 586, 787, 946,
-  967, 850, 711, 701, 863, 1074, 1170, 1132, 1088, 1124, 1144, 1001,
-  723, 527, 559, 723, 816, 807, 852, 1022, 1153, 1056, 826, 767,
-  993, 1250, 1233, 991, 864, 1037, 1309, 1396, 1312, 1309, 1483, 1628,
-  1531, 1264, 1081, 1092, 1179, 1206, 1190, 1206, 1242, 1241, 1232, 1301,
-  1447, 1567, 1601, 1615, 1687, 1763, 1721, 1550, 1380, 1329, 1374, 1417,
-  1403, 1342, 1264, 1201, 1207, 1306, 1435, 1497, 1493, 1532, 1673, 1799,
-  1741, 1496, 1246, 1153, 1195, 1244, 1247, 1254, 1310, 1401, 1509, 1639,
-  1749, 1740, 1561, 1311, 1143, 1095, 1068, 998, 958, 1036, 1169, 1192,
-  1047, 858, 770, 773, 742, 626, 532, 585, 763, 900, 856, 663,
-  477, 410, 411, 345, 169, -6, -48, 30, 90, 53, -13, -26,
-  -38, -163, -377, -502, -439, -320, -347, -520, -638, -563, -401, -344,
-  -433, -560, -638, -692, -773, -875, -977, -1070, -1115, -1030, -819, -653,
-  -729, -1014, -1245, -1219, -1024, -911, -987, -1119, -1141, -1057, -991, -1012,
-  -1073, -1101, -1096, -1110, -1174, -1279, -1382, -1437, -1417, -1343, -1266, -1225,
-  -1204, -1164, -1097, -1055, -1100, -1230, -1358, -1375, -1262, -1124, -1095, -1186,
-  -1264, -1204, -1052, -976, -1067, -1241, -1355, -1369, -1340, -1304, -1245, -1183,
-  -1186, -1255, -1275, -1160, -1026, -1088, -1370, -1622, -1585, -1289, -1004, -921,
-  -978, -1007, -953, -890, -899, -1002, -1193, -1423, -1560, -1481, -1235, -1058,
-  -1125, -1335, -1421, -1254, -965, -763, -723, -794, -911, -1008, -991, -815,
-  -596, -524, -626, -719, -658, -541, -564, -723, -824, -771, -686, -693,
-  -712, -597, -408, -351, -460, -524, -383, -172, -130, -255, -324, -210,
-  -41, 32, 56, 147, 253, 200, -24, -198, -154, -20, -50, -273,
-  -423, -267, 112, 423, 513, 490, 511, 530, 370, 11, -296, -280,
-  32, 338, 429, 409, 497, 671, 668, 367, 23, -6, 300, 595,
-  603, 432, 382, 527, 650, 565, 375, 325, 488, 702, 797, 794,
-  822, 907, 913, 740, 500, 436, 632, 890, 957, 848, 821, 1002,
-  1167, 1038, 716, 605, 861, 1132, 1009, 611, 448, 725, 1046, 969,
-  620, 519, 869, 1297, 1371, 1120, 896, 880, 945, 952, 940, 988,
-  1056, 1082, 1121, 1242, 1356, 1283, 1005, 731, 670, 822, 1038, 1196,
-  1262, 1237, 1158, 1123, 1192, 1261, 1124, 748, 406, 419, 768, 1076,
-  1039, 797, 764, 1095, 1451, 1398, 946, 540, 507, 683, 695, 487,
-  363, 506, 708, 702, 574, 622, 862, 958, 721, 438, 500, 834,
-  981, 718, 358, 301, 492, 549, 333, 130, 221, 483, 573, 402,
-  234, 304, 506, 560, 373, 129, 37, 105, 187, 190, 145, 146,
-  256, 465, 655, 638, 332, -84, -277, -132, 82, 27, -256, -385,
-  -162, 133, 104, -220, -430, -301, -62, -31, -177, -230, -105, 15,
-  -8, -94, -143, -202, -321, -396, -328, -243, -339, -550, -585, -356,
-  -163, -314, -698, -925, -822, -599, -521, -607, -720, -799, -861, -883,
-  -810, -675, -591, -610, -675, -734, -786, -828, -830, -827, -921, -1127,
-  -1284, -1222, -989, -793, -754, -796, -809, -776, -723, -649, -605, -708,
-  -960, -1129, -994, -700, -653, -998, -1386, -1408, -1120, -929, -1019, -1136,
-  -1011, -744, -611, -654, -694, -689, -803, -1069, -1219, -1026, -667, -540,
-  -759, -1016, -984, -686, -389, -282, -362, -545, -718, -722, -483, -187,
-  -187, -588, -1037, -1079, -695, -337, -364, -602, -575, -132, 326, 295,
-  -259, -878, -1092, -844, -438, -190, -189, -309, -358, -235, -39, -13,
-  -289, -655, -708, -337, 59, -1, -469, -798, -626, -243, -198, -600,
-  -1008, -997, -591, -82, 341, 617, 646, 349, -122, -460, -521, -434,
-  -346, -241, -93, -22, -136, -292, -244, 4, 164, 46, -216, -373,
-  -361, -257, -86, 174, 425, 508, 428, 361, 381, 339, 106, -173,
-  -239, -55, 169, 270, 315, 430, 580, 604, 421, 122, -117, -153,
-  31, 306, 501, 563, 607, 718, 782, 635, 367, 305, 587, 890,
-  753, 162, -349, -263, 343, 891, 924, 554, 268, 376, 701, 811,
-  509, 58, -92, 224, 735, 1038, 1007, 834, 730, 699, 629, 509,
-  423, 383, 292, 140, 106, 346, 731, 932, 811, 597, 585, 735,
-  733, 441, 123, 136, 494, 874, 1003, 912, 774, 643, 444, 169,
-  -44, -20, 280, 699, 969, 916, 662, 545, 735, 970, 839, 347,
-  10, 223, 727, 923, 657, 376, 449, 651, 555, 237, 217, 699,
-  1207, 1158, 588, 80, 42, 307, 475, 431, 377, 469, 592, 529,
-  255, -10, -35, 171, 376, 382, 242, 177, 289, 453, 497, 407,
-  281, 143, -63, -297, -374, -178, 153, 348, 293, 118, 14, 51,
-  158, 232, 213, 120, 50, 87, 193, 225, 114, -31, -76, -66,
-  -158, -340, -371, -88, 325, 505, 328, 5, -242, -416, -575, -587,
-  -287, 164, 343, 90, -225, -175, 117, 118, -346, -781, -658, -135,
-  157, -26, -253, -84, 291, 338, -82, -569, -747, -645, -441, -139,
-  278, 572, 443, -22, -387, -403, -297, -400, -675, -785, -546, -125,
-  194, 276, 179, 63, 83, 234, 298, 82, -268, -358, -57, 271,
-  201, -210, -556, -656, -677, -691, -472, 46, 421, 184, -444, -714,
-  -293, 309, 399, -70, -567, -688, -492, -218, 1, 71, -91, -375,
-  -469, -246, -27, -205, -673, -885, -540, 22, 224, -98, -593, -822,
-  -627, -155, 275, 323, -139, -803, -1094, -733, -91, 171, -134, -503,
-  -376, 130, 331, -169, -928, -1169, -739, -283, -390, -801, -748, -8,
-  722, 652, -135, -828, -860, -445, -111, -50, -104, -179, -339, -541,
-  -582, -407, -253, -338, -541, -552, -287, 25, 152, 100, 10, -63,
-  -187, -413, -650, -694, -399, 118, 474, 349, -133, -488, -428, -208,
-  -253, -549, -650, -314, 133, 238, 32, -38, 261, 628, 603, 87,
-  -583, -970, -840, -274, 388, 749, 661, 351, 154, 146, 142, 23,
-  -93, -82, -48, -173, -423, -548, -380, -5, 362, 536, 404, -21,
-  -493, -633, -313, 119, 205, -55, -210, -2, 241, 63, -420, -596,
-  -181, 352, 357, -150, -517, -281, 318, 723, 719, 495, 234, -63,
-  -355, -443, -229, 96, 280, 309, 319, 298, 153, -4, 80, 325,
-  262, -319, -889, -742, 37, 606, 461, 71, 119, 475, 430, -170,
-  -623, -364, 231, 429, 169, 32, 273, 470, 260, -67, -42, 245,
-  312, 66, -62, 200, 546, 570, 334, 176, 156, 43, -196, -283,
-  -80, 155, 145, 18, 99, 387, 527, 323, 26, -11, 207, 361,
-  255, 29, -61, 42, 168, 140, -38, -219, -280, -215, -72, 155,
-  485, 800, 846, 497, -24, -303, -159, 186, 378, 295, 94, -7,
-  98, 367, 625, 646, 353, -55, -279, -255, -191, -240, -304, -253,
-  -158, -139, -86, 193, 565, 634, 311, 40, 220, 611, 641, 232,
-  -96, 1, 207, 81, -231, -236, 93, 235, -65, -337, -54, 538,
-  691, 190, -324, -190, 439, 853, 679, 202, -128, -180, -72, 98,
-  262, 272, 36, -260, -280, 58, 438, 487, 176, -189, -313, -165,
-  51, 103, -57, -214, -81, 338, 643, 469, -9, -217, 73, 408,
-  261, -185, -262, 225, 657, 452, -95, -202, 312, 781, 610, 23,
-  -325, -210, 44, 149, 162, 193, 165, 28, -33, 153, 448, 568,
-  454, 286, 176, 98, 87, 217, 316, 8, -723, -1270, -1037, -238,
-  292, 146, -169, 11, 573, 815, 445, -36, -53, 274, 360, -9,
-  -402, -348, 56, 311, 156, -157, -240, -41, 160, 128, -78, -238,
-  -224, -68, 130, 241, 134, -207, -552, -580, -247, 109, 150, -52,
-  -136, 50, 277, 292, 140, -12, -177, -446, -667, -546, -108, 204,
-  55, -346, -521, -319, 8, 219, 301, 231, -119, -681, -1024, -789,
-  -195, 163, 48, -182, -125, 127, 204, 41, -55, 114, 348, 336,
-  66, -183, -191, -14, 116, 26, -233, -414, -308, 0, 163, -16,
-  -284, -193, 302, 700, 518, -117, -614, -586, -209, 76, 48, -181,
-  -364, -302, 54, 511, 673, 286, -406, -813, -622, -145, 71, -84,
-  -227, -71, 162, 58, -377, -691, -546, -129, 137, 126, 77, 180,
-  306, 243, 32, -115, -150, -259, -539, -790, -752, -459, -185, -88,
-  -70, -14, 17, -76, -213, -233, -148, -120, -203, -270, -256, -283,
-  -414, -450, -172, 256, 382, 14, -510, -713, -504, -172, 13, 34,
-  -14, -83, -152, -196, -245, -356, -458, -369, -81, 117, -14, -270,
-  -218, 185, 439, 130, -489, -784, -504, 3, 317, 408, 461, 494,
-  394, 206, 88, -10, -325, -826, -1043, -608, 171, 568, 308, -120,
-  -136, 200, 398, 296, 208, 316, 314, -53, -429, -263, 317, 539,
-  52, -508, -375, 256, 515, 124, -245, -38, 337, 197, -281, -294,
-  300, 639, 88, -753, -807, 39, 834, 862, 435, 225, 312, 292,
-  32, -167, -97, 68, 96, 6, -61, -58, 12, 164, 298, 215,
-  -62, -148, 231, 753, 810, 329, -82, 35, 346, 218, -365, -748,
-  -468, 177, 542, 375, -43, -322, -303, -45, 290, 505, 475, 261,
-  56, -18, -9, -13, -35, -19, 30, 37, -55, -189, -191, 96,
-  592, 902, 647, -48, -545, -365, 217, 456, 22, -643, -898, -593,
-  -38, 475, 818, 838, 413, -211, -483, -157, 379, 579, 386, 151,
-  43, -93, -266, -164, 330, 753, 563, -95, -491, -230, 253, 308,
-  -84, -342, -100, 314, 313, -189, -627, -414, 360, 960, 792, 105,
-  -253, 155, 787, 791, 129, -350, -76, 409, 180, -709, -1147, -425,
-  721, 956, 37, -876, -689, 306, 897, 484, -305, -561, -216, 76,
-  -58, -257, -63, 343, 375, -90, -450, -151, 538, 810, 346, -282,
-  -340, 156, 532, 353, -78, -201, 71, 327, 233, -80, -263, -181,
-  3, 102, 110, 134, 184, 135, -83, -317, -307, -24, 209, 81,
-  -268, -379, -108, 101, -196, -750, -848, -276, 320, 247, -335, -674,
-  -437, -61, -18, -170, -103, 176, 258, -26, -361, -386, -93, 291,
-  566, 548, 105, -548, -817, -376, 244, 184, -571, -1024, -456, 543,
-  796, 95, -590, -465, 118, 332, 25, -294, -346, -327, -320, -57,
-  476, 718, 225, -587, -866, -387, 223, 345, 26, -312, -429, -318,
-  -37, 216, 111, -365, -649, -231, 538, 786, 307, -110, 185, 744,
-  691, 15, -468, -343, -94, -182, -290, 36, 477, 327, -370, -764,
-  -394, 180, 222, -157, -294, -11, 209, 47, -163, 19, 454, 614,
-  287, -180, -335, -109, 189, 233, -6, -264, -289, -133, -68, -191,
-  -264, -94, 112, 29, -202, -67, 519, 880, 413, -461, -695, 17,
-  749, 499, -494, -1034, -483, 499, 859, 435, -27, 22, 277, 161,
-  -271, -405, 22, 469, 290, -349, -623, -107, 665, 884, 446, -77,
-  -280, -311, -372, -301, 53, 375, 256, -119, -157, 207, 298, -289,
-  -920, -697, 226, 751, 322, -336, -298, 246, 380, -114, -459, -140,
-  255, -61, -793, -904, -137, 543, 305, -352, -324, 487, 1005, 519,
-  -295, -348, 283, 452, -388, -1304, -1072, 143, 918, 389, -648, -772,
-  260, 1248, 1085, 62, -640, -453, 38, 75, -240, -234, 255, 605,
-  304, -279, -383, 94, 488, 338, 14, 101, 506, 627, 286, -32,
-  22, 107, -200, -613, -502, 79, 346, -64, -471, -92, 763, 1030,
-  331, -545, -759, -458, -315, -430, -282, 296, 710, 396, -361, -757,
-  -440, 156, 412, 175, -213, -329, -54, 331, 387, -24, -505, -516,
-  -43, 340, 208, -174, -277, -87, -49, -271, -266, 257, 773, 559,
-  -233, -672, -298, 229, 50, -674, -967, -374, 458, 676, 292, -25,
-  24, 40, -318, -724, -611, -15, 423, 281, -119, -176, 222, 610,
-  569, 184, -162, -239, -76, 217, 519, 626, 381, -48, -211, 97,
-  476, 340, -311, -803, -599, 31, 366, 145, -207, -242, -55, 13,
-  -38, 99, 464, 667, 400, -106, -352, -181, 98, 139, -63, -270,
-  -288, -113, 109, 190, 65, -104, -78, 132, 232, 57, -135, 4,
-  349, 394, -26, -429, -326, 79, 171, -174, -414, -151, 276, 312,
-  10, -102, 131, 244, -87, -475, -345, 199, 482, 207, -167, -146,
-  73, -41, -486, -672, -276, 281, 433, 251, 238, 489, 515, 39,
-  -455, -318, 308, 589, 101, -575, -609, -11, 415, 154, -392, -499,
-  -53, 402, 406, 75, -178, -152, 25, 137, 82, -86, -193, -74,
-  213, 364, 161, -194, -275, 14, 286, 182, -146, -265, -66, 134,
-  84, -89, -170, -206, -338, -413, -107, 548, 1044, 963, 489, 155,
-  178, 252, 12, -490, -858, -784, -311, 248, 558, 479, 169, -49,
-  13, 209, 233, -2, -258, -270, -71, 81, 40, -76, -92, 3,
-  93, 128, 163, 200, 111, -192, -559, -686, -457, -113, 10, -103,
-  -134, 134, 490, 537, 219, -99, -110, 60, 76, -113, -233, -113,
-  77, 114, 55, 104, 247, 235, -28, -277, -197, 155, 386, 202,
-  -252, -534, -351, 131, 421, 199, -318, -583, -340, 57, 90, -245,
-  -439, -172, 245, 303, -5, -205, -28, 250, 235, -67, -337, -379,
-  -248, -46, 155, 216, 15, -280, -280, 107, 452, 305, -178, -425,
-  -206, 103, 110, -54, -36, 132, 95, -209, -370, -102, 296, 319,
-  -37, -275, -97, 199, 178, -113, -228, 45, 377, 321, -122, -514,
-  -501, -195, 33, 20, -39, 100, 374, 474, 246, -84, -157, 102,
-  403, 432, 178, -114, -236, -182, -57, 59, 145, 196, 213, 186,
-  94, -48, -128, -29, 182, 246, 17, -277, -265, 70, 308, 116,
-  -303, -466, -248, 1, -26, -188, -177, 4, 85, -16, -47, 174,
-  454, 454, 131, -220, -314, -116, 195, 373, 223, -219, -576, -431,
-  136, 481, 116, -613, -857, -309, 402, 521, 91, -219, -74, 169,
-  105, -113, -97, 119, 122, -207, -466, -325, -24, -23, -317, -437,
-  -120, 326, 462, 285, 139, 189, 248, 130, -61, -99, 31, 148,
-  143, 89, 99, 172, 235, 238, 158, -17, -237, -379, -359, -259,
-  -228, -261, -179, 102, 368, 312, -47, -300, -117, 302, 413, -5,
-  -538, -625, -235, 136, 123, -82, -96, 95, 184, 68, -9, 97,
-  139, -123, -435, -315, 216, 533, 192, -460, -698, -313, 211, 377,
-  215, 59, 44, 56, 24, 7, 13, -58, -228, -354, -320, -193,
-  -97, -33, 65, 159, 148, 50, 6, 69, 117, 41, -76, -78,
-  22, 35, -141, -353, -341, -44, 303, 387, 144, -150, -154, 158,
-  444, 371, 8, -260, -193, 53, 182, 131, 50, 12, -59, -159,
-  -118, 129, 336, 204, -189, -423, -250, 108, 273, 168, 13, -49,
-  -81, -117, -47, 144, 226, 19, -249, -162, 272, 539, 288, -135,
-  -120, 345, 619, 280, -282, -393, -12, 264, 62, -282, -277, 11,
-  110, -131, -333, -147, 264, 479, 351, 92, -76, -106, -20, 153,
-  264, 100, -309, -584, -407, 45, 273, 78, -201, -175, 81, 178,
-  -12, -197, -119, 63, 31, -192, -241, 50, 348, 231, -219, -474,
-  -233, 179, 250, -45, -235, -25, 290, 237, -163, -401, -159, 258,
-  320, -50, -389, -288, 119, 349, 152, -230, -376, -156, 165, 250,
-  63, -122, -56, 184, 295, 128, -129, -197, -68, 20, -64, -162,
-  -83, 97, 141, 18, -35, 150, 409, 459, 265, 59, 1, 8,
-  -43, -103, -57, 43, 37, -89, -149, -20, 186, 296, 297, 270,
-  181, -63, -361, -427, -169, 115, 82, -170, -211, 134, 512, 494,
-  137, -106, 12, 248, 239, -33, -269, -256, -89, 18, -12, -85,
-  -90, -19, 39, -12, -164, -278, -210, 15, 194, 171, 14, -90,
-  -92, -114, -221, -277, -135, 109, 188, 0, -234, -240, -18, 165,
-  109, -105, -243, -190, -37, 62, 41, -68, -189, -233, -131, 97,
-  299, 303, 94, -140, -187, -28, 164, 217, 112, -50, -163, -173,
-  -73, 73, 129, 1, -222, -305, -119, 178, 294, 128, -117, -195,
-  -99, -19, -62, -112, -23, 159, 249, 175, 59, 37, 77, 58,
-  -36, -112, -136, -174, -230, -180, 25, 189, 80, -198, -263, 43,
-  391, 382, 94, -34, 158, 334, 189, -88, -123, 38, 0, -321,
-  -489, -160, 369, 522, 205, -130, -150, -13, 2, -63, -18, 83,
-  36, -112, -92, 131, 232, 3, -303, -321, -87, 67, 26, -10,
-  46, 0, -227, -324, -6, 464, 527, 96, -270, -111, 308, 377,
-  -16, -354, -219, 144, 192, -168, -478, -353, 14, 140, -88, -270,
-  -51, 366, 459, 86, -306, -277, 15, 70, -204, -356, -87, 269,
-  222, -117, -181, 186, 453, 178, -313, -387, -10, 249, 73, -195,
-  -143, 103, 160, -8, -112, -56, -29, -99, -99, -3, -44, -261,
-  -274, 149, 565, 355, -317, -584, -56, 578, 460, -255, -639, -277,
-  265, 354, 154, 201, 470, 404, -162, -613, -351, 363, 706, 332,
-  -236, -323, 61, 323, 92, -339, -428, -61, 364, 450, 225, 6,
-  -8, 105, 172, 119, -22, -161, -182, -22, 199, 257, 114, 4,
-  99, 187, -49, -462, -511, -34, 369, 86, -571, -666, 84, 827,
-  674, -96, -419, 94, 666, 469, -264, -642, -350, 41, -20, -334,
-  -364, -39, 213, 111, -138, -204, -77, 20, -16, -73, -47, 10,
-  -8, -100, -154, -61, 169, 372, 347, 60, -260, -300, -9, 310,
-  297, -84, -502, -584, -263, 171, 331, 92, -266, -301, 114, 594,
-  631, 193, -228, -226, 26, 77, -137, -225, 43, 351, 276, -95,
-  -290, -117, 123, 130, 29, 90, 265, 273, 86, -12, 134, 290,
-  180, -113, -273, -188, -30, 42, 57, 80, 88, 63, 64, 92,
-  22, -188, -319, -134, 238, 381, 115, -253, -321, -100, 64, -9,
-  -144, -127, -19, -12, -111, -132, 15, 189, 204, 64, -65, -50,
-  78, 172, 103, -113, -312, -311, -108, 89, 76, -104, -211, -104,
-  98, 186, 128, 47, -3, -100, -258, -314, -147, 77, 73, -148,
-  -216, 109, 534, 528, 8, -493, -446, 39, 364, 178, -242, -375,
-  -88, 263, 287, -6, -262, -195, 112, 320, 221, -47, -177, -62,
-  107, 117, -1, -85, -108, -162, -222, -122, 131, 243, 17, -291,
-  -260, 94, 284, 25, -343, -313, 96, 387, 263, -53, -197, -96,
-  122, 373, 561, 473, 41, -388, -367, 26, 226, -44, -369, -253,
-  135, 228, -62, -217, 60, 363, 215, -171, -205, 171, 408, 202,
-  -64, 24, 230, 61, -395, -533, -134, 286, 214, -145, -235, 32,
-  226, 83, -173, -258, -221, -203, -120, 137, 364, 262, -65, -198,
-  -13, 123, -77, -362, -314, 12, 195, 105, 69, 291, 484, 313,
-  -51, -156, 70, 231, 60, -220, -280, -145, -70, -103, -65, 94,
-  179, 61, -127, -197, -163, -153, -171, -125, -17, 58, 75, 98,
-  118, 46, -90, -107, 65, 219, 128, -109, -187, -43, 51, -96,
-  -293, -231, 72, 305, 286, 139, 38, -24, -103, -117, 16, 166,
-  117, -96, -186, -14, 189, 128, -152, -333, -244, -28, 109, 126,
-  79, -22, -148, -169, -8, 180, 172, 3, -44, 134, 257, 57,
-  -286, -329, 16, 325, 219, -126, -227, 60, 365, 301, -75, -375,
-  -330, -22, 274, 339, 144, -151, -310, -206, 47, 198, 116, -81,
-  -179, -80, 130, 285, 264, 84, -87, -63, 138, 248, 47, -310,
-  -422, -123, 285, 384, 126, -177, -279, -225, -151, -63, 74, 166,
-  87, -98, -173, -58, 91, 99, -20, -130, -156, -108, 1, 144,
-  239, 220, 146, 112, 87, -27, -183, -200, -64, -5, -153, -255,
-  -17, 381, 431, 23, -321, -137, 314, 413, 45, -283, -222, -21,
-  -35, -144, -33, 193, 138, -199, -336, -42, 270, 163, -148, -139,
-  194, 353, 148, -32, 77, 132, -208, -569, -320, 385, 665, 140,
-  -465, -314, 358, 609, 140, -347, -232, 164, 161, -240, -426, -131,
-  224, 233, 80, 145, 350, 297, -68, -337, -238, -7, 13, -122,
-  -109, 88, 181, 25, -148, -97, 54, 29, -149, -177, 52, 254,
-  166, -58, -71, 135, 199, -77, -409, -382, 0, 332, 320, 74,
-  -117, -133, -48, 43, 79, 12, -130, -184, -8, 277, 366, 152,
-  -114, -132, 79, 246, 203, 29, -134, -237, -245, -92, 173, 315,
-  152, -174, -310, -109, 189, 246, 2, -287, -330, -93, 191, 248,
-  48, -146, -70, 193, 281, 12, -336, -363, -61, 184, 116, -94,
-  -136, 25, 187, 211, 117, -40, -179, -144, 125, 371, 242, -182,
-  -374, -53, 364, 310, -117, -293, -6, 237, 14, -341, -251, 202,
-  391, 92, -212, -105, 155, 116, -126, -128, 139, 220, -71, -317,
-  -127, 251, 291, -39, -259, -92, 195, 246, 114, 76, 182, 223,
-  98, -46, -54, 22, 29, -82, -212, -222, -67, 141, 194, 22,
-  -156, -57, 263, 395, 111, -267, -244, 155, 382, 103, -335, -378,
-  -9, 271, 142, -151, -190, 62, 275, 207, -48, -221, -162, 46,
-  190, 139, -17, -61, 51, 84, -140, -391, -263, 211, 464, 121,
-  -406, -404, 161, 542, 213, -415, -563, -126, 269, 160, -204, -330,
-  -145, 65, 129, 98, -11, -232, -399, -232, 220, 493, 276, -138,
-  -218, 95, 358, 270, 26, -62, -19, -58, -189, -229, -145, -96,
-  -129, -94, 70, 174, 71, -92, -69, 107, 189, 91, -18, -8,
-  37, 29, 50, 159, 195, -9, -296, -316, -7, 280, 232, -48,
-  -240, -228, -148, -102, -48, 32, 66, 50, 82, 166, 141, -50,
-  -177, -13, 267, 255, -106, -370, -183, 219, 314, 3, -291, -214,
-  92, 269, 213, 84, 1, -55, -83, -47, -15, -104, -231, -149,
-  160, 347, 151, -179, -203, 61, 163, -74, -267, -85, 198, 118,
-  -214, -241, 160, 431, 155, -312, -370, -51, 116, -36, -105, 138,
-  345, 173, -120, -74, 222, 284, 19, -153, -25, 64, -132, -263,
-  61, 518, 433, -183, -552, -209, 338, 351, -130, -449, -298, -19,
-  38, -18, 44, 162, 157, 67, 21, -50, -264, -445, -292, 116,
-  322, 103, -211, -219, 12, 135, 72, 37, 96, 47, -178, -337,
-  -251, -115, -163, -243, -35, 386, 550, 247, -148, -176, 97, 246,
-  113, -47, -35, -10, -169, -372, -325, -36, 164, 72, -139, -191,
-  -62, 63, 95, 123, 193, 194, 24, -211, -282, -109, 132, 203,
-  66, -79, -42, 125, 176, -13, -251, -250, -14, 144, 23, -185,
-  -169, 50, 158, 28, -94, 14, 209, 226, 104, 69, 96, -63,
-  -373, -403, 46, 516, 430, -98, -407, -212, 75, 35, -144, -66,
-  189, 206, -65, -225, -59, 156, 126, -24, -41, 7, -95, -269,
-  -233, 24, 208, 184, 123, 124, 30, -201, -280, -22, 271, 201,
-  -100, -176, 25, 91, -112, -161, 196, 490, 182, -439, -565, -24,
-  461, 293, -211, -374, -100, 157, 143, 50, 60, 74, 2, -38,
-  28, 67, -11, -55, 46, 107, -59, -267, -193, 95, 201, 11,
-  -124, 49, 292, 258, 23, -95, -65, -119, -268, -254, -36, 69,
-  -98, -219, 18, 365, 320, -114, -401, -241, 45, 56, -96, -41,
-  220, 315, 100, -119, -42, 206, 298, 138, -105, -294, -415, -435,
-  -293, -66, 46, -12, -59, 44, 160, 93, -78, -88, 90, 169,
-  -15, -195, -30, 338, 388, -74, -572, -527, -4, 372, 227, -138,
-  -223, 16, 225, 231, 217, 308, 313, 56, -243, -217, 109, 315,
-  164, -102, -168, -94, -123, -225, -143, 134, 283, 126, -82, -43,
-  131, 121, -68, -117, 65, 171, -15, -236, -137, 168, 247, 1,
-  -173, 18, 322, 288, -107, -450, -424, -127, 143, 208, 69, -163,
-  -289, -133, 226, 446, 287, -65, -211, -42, 157, 117, -86, -190,
-  -110, 17, 49, -21, -133, -231, -260, -198, -102, -45, -15, 54,
-  125, 84, -58, -120, -12, 102, 43, -91, -58, 128, 179, -42,
-  -275, -212, 75, 247, 164, 21, 13, 72, 26, -115, -177, -59,
-  143, 238, 114, -144, -290, -146, 153, 262, 45, -189, -84, 237,
-  292, -70, -398, -241, 194, 302, -79, -446, -301, 200, 486, 277,
-  -152, -364, -220, 76, 241, 166, -20, -100, -10, 96, 72, 2,
-  60, 185, 120, -179, -383, -217, 132, 251, 56, -150, -150, -70,
-  -63, -45, 94, 214, 136, -31, -46, 39, -42, -261, -242, 142,
-  448, 254, -180, -246, 126, 368, 137, -187, -124, 156, 121, -275,
-  -498, -228, 182, 241, -23, -206, -136, -10, 8, 2, 63, 118,
-  91, 49, 63, 58, -29, -79, 42, 219, 199, -40, -237, -193,
-  -2, 139, 169, 116, -28, -220, -283, -102, 139, 137, -104, -254,
-  -100, 199, 387, 427, 380, 183, -185, -460, -344, 1, 81, -216,
-  -399, -91, 357, 340, -98, -320, -31, 321, 267, -9, -59, 102,
-  102, -96, -140, 60, 127, -123, -298, -36, 340, 281, -100, -152,
-  276, 526, 104, -539, -629, -158, 202, 117, -54, 15, 102, -66,
-  -251, -86, 256, 280, -27, -147, 129, 326, 16, -471, -495, -27,
-  338, 246, -18, -90, -43, -100, -162, -14, 199, 115, -239, -396,
-  -130, 189, 144, -106, -97, 197, 313, 21, -309, -254, 41, 124,
-  -72, -154, 86, 329, 229, -47, -61, 215, 333, 36, -323, -246,
-  221, 545, 414, 91, -32, 23, -42, -283, -410, -243, 15, 86,
-  11, 24, 141, 144, -22, -113, 41, 216, 85, -267, -402, -117,
-  258, 281, -49, -325, -250, 56, 261, 190, -61, -248, -174, 133,
-  392, 310, -55, -294, -109, 286, 410, 101, -308, -434, -260, -27,
-  109, 131, 18, -200, -295, -29, 417, 491, -48, -678, -651, 55,
-  635, 411, -348, -780, -458, 190, 466, 183, -256, -392, -158, 167,
-  285, 134, -120, -256, -184, 20, 228, 373, 419, 293, -35, -402,
-  -502, -204, 224, 345, 46, -309, -292, 77, 367, 273, -18, -88,
-  160, 383, 250, -130, -363, -272, -86, -80, -199, -177, 51, 219,
-  84, -233, -364, -115, 322, 572, 450, 96, -179, -171, 49, 219,
-  144, -108, -285, -228, -26, 122, 127, 48, -48, -141, -192, -127,
-  34, 134, 51, -116, -150, -5, 137, 121, 35, 74, 244, 339,
-  209, -40, -177, -117, 8, 15, -139, -331, -379, -199, 88, 229,
-  76, -205, -260, 59, 463, 509, 128, -258, -195, 265, 593, 370,
-  -256, -721, -622, -88, 386, 416, 36, -385, -489, -233, 105, 209,
-  34, -156, -94, 170, 310, 111, -242, -358, -100, 248, 318, 86,
-  -131, -86, 119, 212, 81, -159, -367, -491, -488, -295, 40, 301,
-  316, 154, 25, -2, -23, -70, -40, 67, 60, -137, -245, 30,
-  479, 546, 95, -306, -111, 418, 536, 52, -416, -316, 89, 171,
-  -152, -359, -133, 220, 275, 75, -52, -12, 7, -82, -139, -63,
-  57, 130, 169, 151, -21, -289, -361, -72, 304, 355, 66, -196,
-  -201, -97, -70, -58, 27, 54, -94, -226, -80, 207, 231, -47,
-  -188, 70, 383, 316, 2, -85, 112, 161, -136, -409, -315, -77,
-  -79, -205, -41, 368, 474, 59, -350, -187, 335, 510, 99, -406,
-  -496, -220, 72, 242, 344, 331, 99, -222, -327, -137, 77, 53,
-  -155, -343, -439, -452, -299, 86, 499, 595, 337, 109, 212, 417,
-  229, -422, -982, -867, -125, 594, 681, 108, -613, -897, -542, 132,
-  561, 443, 34, -122, 180, 528, 387, -207, -629, -420, 141, 399,
-  144, -184, -136, 184, 340, 171, -101, -280, -408, -508, -409, -31,
-  341, 358, 121, 87, 421, 704, 467, -165, -608, -517, -114, 187,
-  244, 184, 119, 60, 16, 36, 132, 253, 333, 297, 88, -208,
-  -315, -51, 345, 380, -68, -488, -325, 281, 610, 239, -442, -734,
-  -437, 45, 275, 212, 59, -43, -74, -41, 27, 46, -20, -95,
-  -121, -179, -344, -452, -232, 261, 576, 378, -84, -277, -81, 72,
-  -149, -467, -373, 145, 560, 503, 193, 27, 5, -132, -339, -225,
-  299, 689, 398, -338, -683, -243, 403, 416, -250, -803, -584, 183,
-  708, 538, -29, -350, -123, 370, 591, 275, -331, -720, -624, -251,
-  -19, -107, -315, -332, -51, 371, 658, 600, 213, -208, -290, 38,
-  433, 518, 322, 177, 199, 154, -115, -356, -269, -8, -7, -300,
-  -409, -13, 540, 671, 343, 44, 67, 150, -45, -409, -557, -356,
-  -35, 180, 262, 232, 75, -124, -151, 67, 299, 268, 8, -226,
-  -309, -326, -307, -148, 127, 254, 68, -187, -147, 135, 216, -108,
-  -462, -375, 70, 330, 111, -270, -360, -165, -71, -252, -419, -251,
-  128, 272, -15, -400, -408, 26, 475, 486, 44, -435, -515, -132,
-  365, 518, 146, -453, -714, -309, 468, 907, 570, -234, -756, -597,
-  -82, 171, -49, -395, -435, -114, 286, 478, 387, 119, -127, -157,
-  64, 312, 274, -90, -436, -409, -74, 149, -1, -304, -359, -86,
-  195, 196, 16, -27, 181, 402, 336, -24, -380, -432, -153, 191,
-  297, 99, -161, -173, 90, 296, 111, -355, -591, -238, 449, 819,
-  505, -203, -698, -655, -219, 271, 562, 538, 212, -200, -340, -43,
-  415, 569, 289, -87, -205, -132, -183, -408, -470, -117, 415, 634,
-  376, -12, -112, 66, 163, 20, -60, 277, 835, 934, 215, -788,
-  -1165, -714, -217, -426, -1061, -1154, -305, 878, 1673, 2069, 2322, 2110,
-  873, -1012, -2134, -1608, -239, 434, 32, -418, -120, 390, 202, -525,
-  -821, -395, -77, -587, -1499, -1849, -1370, -610, -43, 357, 673, 720,
-  436, 171, 255, 496, 493, 276, 202, 260, -8, -726, -1246, -934,
-  -137, 138, -455, -1079, -749, 436, 1465, 1659, 1323, 1093, 1043, 761,
-  112, -494, -667, -549, -525, -604, -426, 94, 478, 268, -302, -552,
-  -257, 51, -162, -657, -730, -187, 385, 407, 36, -126, 155, 559,
-  739, 692, 518, 151, -423, -881, -820, -295, 162, 138, -232, -514,
-  -489, -281, -96, -24, -52, -92, 8, 309, 607, 583, 222, -68,
-  77, 492, 646, 287, -285, -632, -676, -640, -618, -443, -10, 478,
-  689, 525, 214, 36, 59, 135, 120, 50, 104, 390, 782, 1007,
-  925, 649, 379, 161, -87, -337, -409, -227, 17, 102, 94, 249,
-  576, 723, 425, -75, -269, -14, 291, 249, -24, -84, 232, 617,
-  706, 480, 161, -115, -351, -484, -379, -79, 144, 101, -41, 32,
-  338, 539, 368, -35, -315, -324, -211, -137, -81, 34, 152, 139,
-  -23, -223, -382, -524, -660, -696, -532, -209, 106, 264, 231, 56,
-  -195, -438, -585, -587, -484, -368, -292, -225, -96, 106, 286, 304,
-  110, -172, -333, -279, -108, 24, 79, 131, 208, 229, 135, -1,
-  -49, 23, 135, 213, 241, 214, 134, 80, 188, 463, 678, 573,
-  157, -282, -484, -446, -316, -165, 32, 240, 333, 249, 83, -33,
-  -63, -43, 19, 127, 212, 179, 59, 19, 152, 332, 341, 119,
-  -191, -415, -488, -402, -153, 194, 446, 430, 185, -62, -158, -169,
-  -216, -267, -210, -74, -48, -220, -419, -424, -255, -136, -179, -258,
-  -239, -199, -288, -446, -444, -221, -24, -109, -380, -485, -250, 141,
-  403, 481, 512, 548, 482, 254, -4, -110, -57, -9, -81, -221,
-  -302, -278, -180, -34, 164, 374, 497, 463, 322, 208, 211, 299,
-  365, 334, 216, 66, -66, -152, -178, -146, -81, -17, 35, 88,
-  141, 156, 105, 12, -56, -68, -63, -81, -98, -47, 86, 229,
-  301, 296, 271, 260, 240, 180, 101, 42, 12, -20, -69, -106,
-  -92, -30, 35, 65, 52, 0, -76, -134, -102, 58, 273, 394,
-  331, 155, 22, 16, 70, 68, -17, -103, -113, -59, -7, 13,
-  35, 91, 158, 180, 125, 16, -91, -150, -146, -92, -18, 42,
-  72, 76, 80, 103, 135, 145, 115, 57, 3, -41, -87, -138,
-  -157, -112, -29, 22, -2, -67, -107, -105, -91, -90, -85, -59,
-  -42, -70, -119, -121, -56, 10, 2, -70, -122, -109, -68, -37,
-  24, 174, 376, 490, 418, 215, 17, -108, -193, -277, -332, -311,
-  -231, -147, -74, 20, 138, 215, 194, 112, 66, 96, 151, 158,
-  107, 42, -8, -50, -102, -160, -209, -233, -222, -170, -89, -9,
-  42, 59, 54, 34, -4, -60, -119, -156, -154, -105, -30, 30,
-  38, -2, -51, -78, -91, -119, -159, -177, -156, -120, -103, -104,
-  -96, -73, -62, -82, -113, -121, -110, -109, -121, -108, -47, 21,
-  32, -24, -96, -133, -139, -142, -146, -139, -128, -137, -156, -145,
-  -93, -43, -30, -20, 47, 148, 181, 92, -30, -47, 67, 197,
-  225, 147, 49, -6, -20, -14, 8, 37, 51, 39, 26, 40,
-  66, 65, 25, -9, 8, 69, 129, 161, 174, 189, 199, 176,
-  113, 29, -46, -98, -120, -110, -73, -26, 16, 63, 129, 204,
-  243, 223, 176, 163, 207, 266, 293, 288, 284, 289, 275, 215,
-  123, 38, -4, 13, 73, 123, 110, 31, -45, -44, 29, 98,
-  112, 94, 91, 98, 77, 26, -8, -6, -11, -66, -137, -146,
-  -72, 20, 56, 26, -25, -58, -75, -96, -140, -221, -331, -416,
-  -398, -256, -68, 45, 39, -19, -33, 23, 92, 110, 68, 6,
-  -34, -35, -12, -6, -59, -174, -288, -325, -272, -192, -156, -163,
-  -152, -84, 14, 86, 100, 55, -35, -149, -251, -306, -312, -293,
-  -267, -223, -155, -79, -18, 24, 56, 79, 81, 65, 44, 23,
-  -5, -31, -23, 37, 118, 171, 178, 162, 147, 132, 107, 81,
-  64, 53, 42, 45, 75, 119, 141, 124, 90, 78, 95, 117,
-  123, 123, 145, 200, 258, 265, 194, 75, -31, -101, -167, -255,
-  -332, -340, -271, -179, -105, -37, 36, 74, 22, -101, -220, -298,
-  -371, -467, -539, -529, -451, -371, -305, -204, -62, 29, -16, -158,
-  -266, -271, -228, -212, -231, -244, -247, -268, -308, -335, -340, -359,
-  -411, -448, -402, -272, -130, -52, -58, -124, -205, -258, -274, -293,
-  -377, -525, -639, -611, -439, -228, -79, -4, 42, 84, 120, 137,
-  117, 23, -141, -260, -185, 87, 352, 404, 271, 183, 284, 465,
-  519, 389, 207, 108, 117, 191, 293, 358, 303, 137, 22, 114,
-  351, 496, 427, 302, 358, 611, 839, 857, 705, 539, 437, 363,
-  270, 155, 15, -148, -270, -222, 69, 520, 964, 1319, 1639, 1993,
-  2336, 2546, 2570, 2498, 2450, 2437, 2356, 2138, 1854, 1639, 1526, 1434,
-  1313, 1246, 1351, 1600, 1828, 1916, 1898, 1855, 1801, 1722, 1688, 1788,
-  1962, 2022, 1895, 1753, 1810, 2013, 2084, 1875, 1560, 1415, 1473, 1493,
-  1242, 718, 97, -436, -771, -878, -829, -780, -837, -918, -816, -440,
-  48, 369, 391, 221, 60, 2, -40, -240, -695, -1309, -1839, -2091,
-  -2095, -2065, -2159, -2316, -2341, -2138, -1793, -1460, -1235, -1159, -1230, -1374,
-  -1442, -1356, -1231, -1268, -1485, -1642, -1522, -1198, -953, -946, -1073, -1155,
-  -1161, -1175, -1233, -1310, -1420, -1601, -1790, -1820, -1636, -1408, -1345, -1420,
-  -1404, -1162, -819, -595, -550, -589, -636, -721, -877, -1077, -1291, -1528,
-  -1765, -1896, -1845, -1703, -1659, -1781, -1945, -2008, -1999, -2063, -2247, -2445,
-  -2539, -2536, -2524, -2546, -2592, -2662, -2765, -2857, -2860, -2774, -2718, -2788,
-  -2931, -3012, -3003, -3015, -3128, -3281, -3371, -3408, -3465, -3527, -3497, -3362,
-  -3242, -3214, -3187, -3056, -2900, -2888, -3019, -3091, -2987, -2840, -2799, -2782,
-  -2607, -2314, -2142, -2159, -2139, -1904, -1620, -1531, -1541, -1319, -822, -419,
-  -367, -413, -162, 317, 568, 424, 265, 480, 952, 1312, 1526, 1863,
-  2371, 2750, 2881, 3108, 3707, 4314, 4297, 3656, 3130, 3242, 3614, 3544,
-  3059, 2974, 3940, 5809, 8043, 10346, 12605, 14514, 15742, 16397, 16860, 17024,
-  16142, 13797, 10737, 8282, 6939, 6044, 4876, 3670, 3236, 3899, 5231, 6681,
-  7963, 8819, 8946, 8466, 8081, 8282, 8579, 7991, 6340, 4577, 3637, 3366,
-  2933, 1996, 1000, 411, 186, 108, 164, 262, -82, -1279, -2986, -4356,
-  -5032, -5517, -6341, -7226, -7435, -6741, -5638, -4632, -3754, -2912, -2344, -2364,
-  -2865, -3444, -3997, -4856, -6207, -7686, -8743, -9234, -9396, -9351, -8953, -8145,
-  -7155, -6175, -5053, -3560, -1877, -546, 122, 363, 605, 946, 1146, 1016,
-  629, 173, -179, -226, 207, 1034, 1855, 2342, 2631, 3124, 3892, 4475,
-  4386, 3669, 2826, 2279, 2088, 2107, 2217, 2332, 2397, 2506, 2878, 3539,
-  4113, 4152, 3667, 3151, 2987, 3009, 2753, 2019, 1017, 41, -795, -1490,
-  -2041, -2496, -2953, -3389, -3561, -3261, -2635, -2117, -2003, -2212, -2496, -2751,
-  -3060, -3510, -4102, -4770, -5387, -5749, -5708, -5366, -5067, -5091, -5404, -5737,
-  -5890, -5889, -5895, -6009, -6177, -6219, -5962, -5422, -4862, -4618, -4798, -5162,
-  -5328, -5091, -4559, -4012, -3659, -3478, -3260, -2846, -2356, -2139, -2417, -2983,
-  -3361, -3271, -2838, -2354, -1949, -1582, -1221, -878, -520, -134, 131, 62,
-  -286, -529, -376, 7, 235, 207, 158, 218, 204, -40, -336, -434,
-  -421, -579, -885, -975, -668, -273, -193, -436, -749, -1050, -1438, -1823,
-  -1920, -1706, -1554, -1701, -1832, -1514, -898, -616, -953, -1496, -1721, -1600,
-  -1410, -1206, -874, -568, -627, -996, -1127, -695, -93, 106, 2, 275,
-  1272, 2591, 3657, 4346, 4789, 4903, 4546, 4006, 3863, 4263, 4717, 4866,
-  5165, 6437, 8823, 11493, 13437, 14280, 14268, 13772, 13024, 12161, 11188, 9937,
-  8329, 6748, 5916, 6171, 6979, 7371, 6905, 6088, 5818, 6493, 7680, 8564,
-  8661, 8144, 7568, 7295, 7139, 6558, 5206, 3318, 1559, 513, 266, 415,
-  418, 10, -629, -1100, -1235, -1332, -1888, -3068, -4496, -5624, -6237, -6522,
-  -6714, -6819, -6730, -6464, -6164, -5917, -5682, -5423, -5200, -5096, -5111, -5186,
-  -5289, -5430, -5618, -5869, -6246, -6793, -7385, -7691, -7406, -6523, -5355, -4222,
-  -3156, -1945, -475, 1012, 2069, 2431, 2249, 1928, 1787, 1884, 2097, 2293,
-  2422, 2541, 2809, 3358, 4091, 4654, 4733, 4409, 4109, 4138, 4355, 4386,
-  4089, 3687, 3453, 3426, 3482, 3542, 3574, 3496, 3258, 3007, 2986, 3203,
-  3315, 2985, 2284, 1582, 1069, 527, -349, -1537, -2678, -3436, -3735, -3696,
-  -3467, -3174, -2940, -2818, -2737, -2607, -2509, -2680, -3234, -3932, -4345, -4288,
-  -4048, -4080, -4505, -4972, -5073, -4798, -4508, -4494, -4695, -4858, -4841, -4667,
-  -4400, -4130, -4047, -4293, -4683, -4745, -4237, -3517, -3177, -3312, -3370, -2835,
-  -1870, -1095, -858, -970, -1114, -1234, -1388, -1502, -1510, -1608, -2039, -2598,
-  -2688, -2036, -1159, -803, -1042, -1212, -792, -29, 452, 416, 112, -235,
-  -647, -1090, -1319, -1252, -1235, -1604, -2095, -2056, -1328, -570, -510, -1092,
-  -1637, -1717, -1550, -1538, -1759, -2038, -2288, -2516, -2646, -2596, -2509, -2648,
-  -2998, -3160, -2796, -2049, -1397, -1153, -1223, -1319, -1277, -1185, -1264, -1622,
-  -2044, -2081, -1489, -565, 117, 349, 498, 1006, 1846, 2630, 3111, 3368,
-  3590, 3932, 4556, 5496, 6369, 6561, 5953, 5271, 5371, 6223, 6992, 7160,
-  7244, 8210, 10390, 13191, 15672, 17145, 17382, 16637, 15522, 14534, 13539, 11947,
-  9614, 7332, 6160, 6318, 6995, 7213, 6672, 5763, 5081, 5032, 5606, 6285,
-  6351, 5572, 4529, 3981, 3927, 3569, 2305, 449, -1178, -2120, -2499, -2574,
-  -2476, -2391, -2582, -3057, -3481, -3664, -3966, -4914, -6483, -8052, -9095, -9633,
-  -9902, -9896, -9485, -8811, -8209, -7738, -7107, -6177, -5283, -4848, -4853, -4911,
-  -4800, -4672, -4721, -4932, -5232, -5649, -6100, -6211, -5631, -4513, -3389, -2511,
-  -1568, -216, 1348, 2587, 3281, 3670, 3960, 4038, 3815, 3556, 3579, 3794,
-  3858, 3754, 3861, 4365, 4921, 5126, 5079, 5147, 5306, 5128, 4460, 3747,
-  3442, 3387, 3079, 2444, 1953, 1972, 2307, 2544, 2555, 2443, 2197, 1720,
-  1151, 796, 660, 313, -573, -1731, -2590, -2974, -3253, -3795, -4497, -4969,
-  -4991, -4642, -4106, -3560, -3225, -3271, -3599, -3878, -3922, -3934, -4244, -4844,
-  -5347, -5413, -5090, -4679, -4383, -4196, -4057, -3956, -3875, -3761, -3623, -3584,
-  -3717, -3865, -3749, -3284, -2715, -2360, -2277, -2240, -2043, -1711, -1397, -1168,
-  -969, -765, -601, -514, -481, -511, -693, -1067, -1461, -1601, -1408, -1102,
-  -944, -935, -856, -586, -261, -90, -118, -232, -333, -428, -555, -743,
-  -1032, -1451, -1908, -2198, -2195, -2028, -1964, -2108, -2292, -2309, -2185, -2148,
-  -2341, -2662, -2894, -2939, -2863, -2762, -2672, -2621, -2660, -2798, -2931, -2946,
-  -2877, -2870, -2954, -2939, -2639, -2155, -1800, -1720, -1742, -1666, -1563, -1607,
-  -1683, -1428, -736, -4, 337, 392, 650, 1287, 1918, 2143, 2078, 2142,
-  2490, 2951, 3449, 4098, 4817, 5204, 5087, 4940, 5383, 6306, 6945, 6946,
-  7006, 8142, 10488, 13140, 15136, 16222, 16633, 16515, 15839, 14669, 13154, 11318,
-  9194, 7216, 6123, 6204, 6820, 6968, 6327, 5521, 5301, 5706, 6151, 6156,
-  5754, 5260, 4860, 4519, 4098, 3433, 2387, 1001, -407, -1423, -1901, -2064,
-  -2224, -2453, -2617, -2675, -2815, -3265, -4056, -5050, -6134, -7288, -8436, -9339,
-  -9720, -9504, -8894, -8204, -7626, -7138, -6585, -5855, -5026, -4368, -4155, -4401,
-  -4795, -4946, -4759, -4542, -4693, -5259, -5821, -5832, -5086, -3884, -2732, -1876,
-  -1127, -115, 1290, 2789, 3880, 4249, 3996, 3529, 3266, 3346, 3573, 3624,
-  3398, 3181, 3387, 4113, 4965, 5416, 5295, 4879, 4517, 4276, 3979, 3494,
-  2871, 2250, 1759, 1518, 1595, 1886, 2113, 2053, 1770, 1522, 1425, 1315,
-  972, 405, -163, -590, -963, -1460, -2117, -2820, -3464, -4031, -4499, -4770,
-  -4743, -4457, -4070, -3696, -3326, -2953, -2705, -2763, -3136, -3611, -3967, -4182,
-  -4361, -4495, -4425, -4059, -3536, -3095, -2835, -2689, -2595, -2585, -2668, -2753,
-  -2743, -2660, -2582, -2493, -2285, -1931, -1573, -1375, -1331, -1273, -1053, -680,
-  -291, -26, 62, 22, -61, -161, -342, -675, -1127, -1561, -1835, -1886,
-  -1735, -1460, -1195, -1078, -1112, -1134, -994, -776, -751, -1080, -1630, -2119,
-  -2409, -2581, -2778, -3056, -3374, -3642, -3745, -3611, -3315, -3085, -3105, -3320,
-  -3476, -3368, -3043, -2765, -2781, -3092, -3413, -3419, -3075, -2721, -2737, -3123,
-  -3483, -3459, -3082, -2650, -2370, -2221, -2095, -1896, -1536, -1033, -665, -786,
-  -1335, -1698, -1318, -399, 295, 375, 304, 778, 1851, 2923, 3481, 3554,
-  3474, 3516, 3854, 4536, 5272, 5476, 4900, 4141, 4126, 4999, 5878, 5960,
-  5636, 6163, 8280, 11449, 14444, 16384, 17106, 16898, 16199, 15390, 14477, 12987,
-  10543, 7677, 5741, 5647, 6792, 7581, 7057, 5774, 5002, 5314, 6163, 6631,
-  6271, 5250, 4059, 3219, 3010, 3160, 2906, 1692, -104, -1384, -1443, -728,
-  -320, -753, -1576, -2071, -2113, -2185, -2743, -3833, -5248, -6753, -8071, -8864,
-  -8973, -8605, -8134, -7687, -7089, -6209, -5219, -4407, -3842, -3383, -2971, -2746,
-  -2824, -3077, -3250, -3266, -3318, -3623, -4141, -4551, -4500, -3879, -2880, -1816,
-  -863, 45, 1073, 2248, 3363, 4109, 4295, 3988, 3479, 3115, 3084, 3293,
-  3475, 3473, 3418, 3578, 4020, 4480, 4603, 4290, 3746, 3215, 2740, 2204,
-  1534, 818, 231, -83, -72, 204, 577, 855, 966, 1008, 1093, 1153,
-  960, 398, -349, -957, -1303, -1583, -2069, -2817, -3643, -4324, -4743, -4868,
-  -4741, -4486, -4237, -3963, -3468, -2671, -1852, -1458, -1645, -2115, -2473, -2640,
-  -2793, -3027, -3228, -3276, -3171, -2923, -2478, -1891, -1445, -1399, -1647, -1820,
-  -1740, -1607, -1655, -1800, -1771, -1506, -1216, -1079, -1065, -1084, -1138, -1213,
-  -1155, -843, -419, -170, -197, -336, -462, -698, -1217, -1943, -2580, -2913,
-  -2939, -2751, -2419, -2041, -1766, -1667, -1658, -1633, -1665, -1943, -2512, -3147,
-  -3547, -3614, -3501, -3424, -3453, -3494, -3430, -3267, -3129, -3134, -3277, -3453,
-  -3554, -3519, -3326, -3042, -2855, -2938, -3203, -3313, -3087, -2799, -2886, -3353,
-  -3681, -3442, -2816, -2317, -2143, -2037, -1756, -1357, -970, -575, -201, -107,
-  -416, -720, -434, 372, 901, 592, -101, -238, 456, 1337, 1722, 1640,
-  1587, 1874, 2487, 3326, 4197, 4689, 4499, 3971, 3898, 4558, 5224, 5042,
-  4246, 4117, 5624, 8430, 11344, 13468, 14675, 15233, 15385, 15231, 14663, 13302,
-  10879, 7917, 5729, 5298, 6171, 6828, 6287, 5088, 4526, 5153, 6311, 6985,
-  6753, 5890, 4926, 4316, 4245, 4399, 4010, 2547, 469, -1012, -1146, -468,
-  -158, -704, -1471, -1622, -1120, -668, -891, -1867, -3333, -4988, -6495, -7499,
-  -7889, -7938, -7957, -7845, -7213, -5971, -4582, -3603, -3122, -2811, -2463, -2243,
-  -2381, -2813, -3249, -3512, -3666, -3828, -3984, -4031, -3895, -3558, -3015, -2281,
-  -1421, -527, 372, 1304, 2249, 3052, 3495, 3493, 3189, 2859, 2696, 2699,
-  2769, 2863, 3030, 3306, 3629, 3883, 3979, 3871, 3522, 2943, 2248, 1593,
-  1040, 531, 44, -295, -326, -52, 349, 695, 902, 914, 675, 233,
-  -207, -474, -635, -902, -1315, -1646, -1690, -1567, -1618, -2046, -2734, -3392,
-  -3795, -3855, -3609, -3214, -2884, -2703, -2513, -2079, -1416, -870, -801, -1196,
-  -1653, -1753, -1427, -961, -689, -701, -825, -842, -698, -539, -580, -931,
-  -1489, -1967, -2066, -1702, -1093, -595, -387, -350, -271, -117, -48, -187,
-  -469, -727, -861, -876, -822, -778, -865, -1167, -1618, -2045, -2335, -2516,
-  -2641, -2693, -2651, -2591, -2615, -2693, -2709, -2654, -2702, -3009, -3510, -3974,
-  -4224, -4241, -4106, -3930, -3817, -3805, -3798, -3650, -3379, -3242, -3494, -4072,
-  -4582, -4636, -4197, -3609, -3296, -3407, -3690, -3711, -3268, -2627, -2292, -2515,
-  -3045, -3374, -3214, -2698, -2204, -2040, -2217, -2413, -2168, -1298, -202, 400,
-  196, -314, -319, 398, 1224, 1455, 1064, 619, 582, 923, 1355, 1671,
-  1794, 1755, 1821, 2430, 3702, 5066, 5723, 5550, 5264, 5477, 5852, 5548,
-  4419, 3405, 3608, 5264, 7774, 10453, 12920, 14923, 16243, 16859, 16857, 16035,
-  13946, 10681, 7364, 5382, 5021, 5230, 4890, 4026, 3531, 3954, 4935, 5746,
-  5973, 5629, 4967, 4422, 4408, 4812, 4832, 3702, 1645, -222, -1051, -1108,
-  -1274, -1938, -2664, -2835, -2338, -1561, -1038, -1207, -2270, -4009, -5802, -7076,
-  -7778, -8270, -8740, -8890, -8281, -6888, -5172, -3674, -2649, -2060, -1769, -1670,
-  -1714, -1894, -2225, -2699, -3262, -3825, -4291, -4574, -4636, -4502, -4209, -3711,
-  -2893, -1717, -324, 1048, 2225, 3120, 3652, 3757, 3509, 3134, 2814, 2541,
-  2238, 1990, 2012, 2369, 2841, 3144, 3213, 3178, 3098, 2851, 2312, 1551,
-  769, 105, -413, -762, -869, -700, -339, 97, 555, 1015, 1363, 1411,
-  1077, 515, -25, -437, -826, -1325, -1913, -2445, -2820, -3077, -3309, -3548,
-  -3749, -3843, -3778, -3513, -3039, -2420, -1792, -1289, -976, -844, -863, -1013,
-  -1250, -1490, -1636, -1620, -1426, -1066, -582, -68, 314, 409, 168, -305,
-  -812, -1192, -1404, -1503, -1543, -1508, -1335, -1007, -614, -318, -228, -306,
-  -392, -344, -157, 39, 89, -84, -443, -894, -1361, -1846, -2395, -3005,
-  -3532, -3754, -3558, -3071, -2560, -2205, -1984, -1811, -1713, -1836, -2279, -2971,
-  -3698, -4232, -4430, -4297, -3982, -3687, -3507, -3352, -3088, -2745, -2534, -2622,
-  -2910, -3097, -2971, -2621, -2346, -2368, -2626, -2848, -2820, -2593, -2429, -2526,
-  -2807, -2997, -2878, -2478, -2020, -1749, -1746, -1852, -1739, -1197, -422, 79,
-  12, -280, -109, 775, 1828, 2277, 1950, 1376, 1135, 1308, 1596, 1725,
-  1588, 1228, 921, 1160, 2192, 3539, 4313, 4203, 3911, 4296, 5258, 5813,
-  5320, 4272, 3751, 4382, 6052, 8365, 10944, 13350, 15159, 16278, 16878, 16822,
-  15488, 12557, 8842, 5859, 4441, 4077, 3763, 3195, 2872, 3248, 4172, 5147,
-  5768, 5837, 5389, 4819, 4712, 5197, 5562, 4880, 3068, 1072, -146, -583,
-  -992, -1899, -3076, -3903, -3975, -3346, -2448, -1909, -2239, -3428, -4883, -5957,
-  -6542, -7040, -7735, -8351, -8325, -7396, -5846, -4234, -3008, -2329, -2113, -2182,
-  -2420, -2817, -3369, -3947, -4364, -4558, -4640, -4721, -4760, -4638, -4313, -3805,
-  -3100, -2156, -1014, 216, 1475, 2730, 3788, 4303, 4113, 3515, 3013, 2797,
-  2619, 2234, 1805, 1723, 2127, 2751, 3218, 3353, 3183, 2816, 2408, 2116,
-  1938, 1659, 1105, 447, 113, 318, 805, 1144, 1197, 1175, 1268, 1387,
-  1303, 917, 317, -364, -1025, -1582, -2000, -2362, -2792, -3251, -3506, -3418,
-  -3195, -3196, -3453, -3526, -2984, -1966, -1111, -887, -1114, -1256, -1072, -840,
-  -961, -1499, -2177, -2649, -2642, -2006, -887, 132, 372, -229, -898, -821,
-  -125, 206, -474, -1621, -2069, -1322, -8, 922, 1111, 814, 360, -65,
-  -253, -36, 360, 358, -309, -1135, -1357, -916, -594, -1100, -2229, -3132,
-  -3281, -2898, -2475, -2156, -1766, -1258, -855, -752, -892, -1145, -1578, -2343,
-  -3325, -4086, -4267, -3990, -3719, -3742, -3894, -3839, -3539, -3294, -3341, -3542,
-  -3565, -3282, -2881, -2588, -2415, -2256, -2125, -2165, -2403, -2628, -2623, -2459,
-  -2426, -2637, -2845, -2747, -2433, -2342, -2704, -3167, -3152, -2536, -1797, -1417,
-  -1327, -1093, -520, 168, 718, 1115, 1363, 1263, 724, 155, 173, 821,
-  1399, 1298, 812, 813, 1682, 2882, 3653, 3848, 3891, 4126, 4477, 4684,
-  4575, 4091, 3324, 2717, 3016, 4734, 7626, 10824, 13552, 15614, 17163, 18159,
-  18162, 16681, 13702, 9932, 6513, 4334, 3460, 3205, 2864, 2385, 2288, 2954,
-  4125, 5129, 5490, 5258, 4841, 4637, 4755, 4909, 4577, 3422, 1687, 71,
-  -906, -1404, -2009, -2974, -3845, -3942, -3138, -2077, -1602, -2058, -3125, -4268,
-  -5246, -6197, -7298, -8401, -9013, -8634, -7162, -5036, -3010, -1708, -1263, -1313,
-  -1380, -1344, -1532, -2288, -3460, -4414, -4615, -4169, -3700, -3710, -4106, -4346,
-  -3963, -2941, -1630, -414, 577, 1480, 2465, 3479, 4219, 4408, 4065, 3495,
-  3019, 2756, 2650, 2606, 2570, 2538, 2569, 2722, 2912, 2880, 2426, 1683,
-  1033, 710, 585, 415, 200, 144, 342, 668, 996, 1349, 1733, 1971,
-  1857, 1433, 936, 500, 24, -623, -1426, -2283, -3119, -3830, -4253, -4314,
-  -4181, -4093, -4049, -3828, -3311, -2640, -2004, -1454, -1041, -951, -1261, -1673,
-  -1776, -1582, -1532, -1842, -2117, -1844, -1085, -368, 22, 256, 446, 319,
-  -319, -1103, -1489, -1480, -1557, -1859, -1870, -1155, -57, 701, 912, 974,
-  1142, 1158, 789, 311, 116, 85, -253, -993, -1712, -2109, -2404, -2885,
-  -3361, -3402, -2969, -2425, -1935, -1262, -281, 588, 740, 43, -1110, -2274,
-  -3242, -3924, -4275, -4454, -4752, -5145, -5112, -4220, -2837, -1961, -2208, -3152,
-  -3789, -3528, -2618, -1760, -1501, -1941, -2746, -3339, -3286, -2708, -2247, -2442,
-  -3112, -3459, -2874, -1596, -525, -410, -1233, -2309, -2907, -2798, -2310, -1946,
-  -1917, -1984, -1716, -911, 173, 1007, 1216, 885, 493, 512, 1031, 1697,
-  2025, 1819, 1355, 1148, 1497, 2195, 2718, 2736, 2466, 2473, 3087, 4012,
-  4542, 4175, 3042, 1823, 1315, 2042, 4060, 6943, 9999, 12661, 14818, 16669,
-  18177, 18710, 17462, 14339, 10335, 6870, 4712, 3604, 2906, 2369, 2196, 2524,
-  3167, 3893, 4657, 5401, 5821, 5648, 5118, 4812, 4905, 4846, 4030, 2586,
-  1191, 177, -760, -1861, -2734, -2845, -2339, -1931, -1989, -2169, -2139, -2275,
-  -3251, -5101, -7050, -8296, -8643, -8297, -7400, -6029, -4456, -3048, -1932, -1011,
-  -370, -397, -1305, -2685, -3757, -4081, -3915, -3855, -4237, -4876, -5284, -5095,
-  -4346, -3432, -2734, -2228, -1497, -184, 1553, 3103, 3920, 3953, 3582, 3204,
-  2925, 2614, 2157, 1651, 1360, 1516, 2120, 2897, 3458, 3561, 3279, 2894,
-  2590, 2263, 1684, 881, 250, 186, 637, 1143, 1345, 1327, 1398, 1630,
-  1770, 1566, 1027, 337, -323, -820, -1069, -1157, -1399, -2054, -2976, -3687,
-  -3876, -3722, -3628, -3721, -3748, -3408, -2677, -1798, -1103, -860, -1135, -1678,
-  -2048, -1997, -1727, -1643, -1869, -2100, -1982, -1505, -974, -689, -770, -1173,
-  -1695, -1980, -1734, -1067, -480, -355, -510, -418, 144, 828, 1134, 931,
-  461, -11, -356, -486, -360, -178, -321, -927, -1633, -1958, -1893, -1880,
-  -2175, -2473, -2295, -1608, -828, -300, -17, 130, 85, -256, -827, -1477,
-  -2197, -3036, -3832, -4243, -4163, -3922, -3924, -4185, -4373, -4250, -3896, -3505,
-  -3148, -2823, -2570, -2388, -2134, -1707, -1314, -1368, -2038, -2999, -3715, -3908,
-  -3695, -3339, -3011, -2754, -2541, -2313, -2055, -1882, -1954, -2243, -2439, -2222,
-  -1612, -953, -554, -400, -254, 47, 440, 713, 684, 393, 160, 370,
-  1058, 1735, 1816, 1251, 630, 545, 973, 1394, 1452, 1340, 1537, 2313,
-  3464, 4387, 4391, 3220, 1522, 612, 1423, 3599, 5860, 7423, 8857, 11307,
-  14945, 18398, 19770, 18165, 14320, 10003, 6846, 5401, 4962, 4315, 2926, 1531,
-  1419, 3022, 5258, 6434, 5805, 4246, 3395, 4174, 6047, 7575, 7625, 6173,
-  4113, 2393, 1306, 496, -498, -1735, -2792, -3089, -2350, -938, 218, 202,
-  -1202, -3347, -5314, -6631, -7377, -7718, -7562, -6758, -5427, -3903, -2440, -1178,
-  -362, -360, -1263, -2599, -3643, -4037, -4041, -4161, -4636, -5301, -5826, -6002,
-  -5831, -5439, -4927, -4227, -3108, -1403, 714, 2699, 3955, 4254, 3859, 3253,
-  2735, 2240, 1541, 648, -12, 121, 1176, 2605, 3578, 3695, 3259, 2840,
-  2650, 2456, 2035, 1516, 1221, 1268, 1495, 1692, 1781, 1764, 1640, 1456,
-  1314, 1223, 1023, 587, 88, -124, 12, 55, -538, -1799, -3147, -3914,
-  -3927, -3577, -3376, -3478, -3580, -3255, -2398, -1412, -902, -1151, -1872, -2482,
-  -2621, -2395, -2181, -2240, -2494, -2602, -2261, -1538, -916, -914, -1555, -2247,
-  -2328, -1732, -1036, -823, -1081, -1260, -877, 26, 965, 1464, 1414, 1098,
-  913, 1028, 1237, 1142, 523, -417, -1170, -1325, -931, -485, -513, -1069,
-  -1640, -1636, -996, -258, 19, -173, -387, -286, 0, 78, -301, -1112,
-  -2144, -3080, -3604, -3636, -3465, -3471, -3656, -3636, -3184, -2645, -2586, -3120,
-  -3773, -4037, -3845, -3449, -3046, -2704, -2494, -2458, -2471, -2371, -2259, -2453,
-  -3046, -3685, -3942, -3771, -3432, -3088, -2725, -2409, -2290, -2278, -2013, -1380,
-  -820, -829, -1261, -1479, -1177, -698, -465, -460, -480, -554, -695, -487,
-  493, 1824, 2392, 1716, 680, 504, 1227, 1769, 1405, 615, 325, 861,
-  1953, 3285, 4486, 4889, 4067, 2671, 2045, 2629, 3276, 2734, 1536, 1738,
-  4678, 9490, 13982, 16555, 17019, 16056, 14491, 12913, 11365, 9241, 6031, 2457,
-  430, 1302, 4188, 6525, 6475, 4557, 2829, 2784, 4243, 5968, 6868, 6639,
-  5725, 4939, 4846, 5117, 4597, 2408, -874, -3401, -3693, -2043, -132, 640,
-  235, -521, -1104, -1711, -2733, -4206, -5803, -7060, -7493, -6764, -5031, -3079,
-  -1806, -1491, -1700, -1941, -2208, -2755, -3543, -4190, -4453, -4512, -4679, -4996,
-  -5267, -5401, -5523, -5736, -5882, -5612, -4644, -2976, -923, 1005, 2333, 2871,
-  2757, 2279, 1655, 985, 351, -97, -171, 273, 1236, 2483, 3568, 4037,
-  3740, 2932, 2048, 1369, 902, 561, 378, 492, 963, 1637, 2219, 2475,
-  2366, 2018, 1620, 1365, 1410, 1771, 2204, 2295, 1776, 772, -345, -1336,
-  -2230, -3073, -3700, -3872, -3561, -2963, -2251, -1503, -890, -707, -1053, -1613,
-  -1963, -2090, -2351, -2892, -3330, -3211, -2629, -2152, -2147, -2414, -2549, -2445,
-  -2282, -2171, -2056, -1923, -1874, -1902, -1800, -1446, -1044, -898, -966, -867,
-  -373, 277, 662, 678, 586, 607, 649, 465, -40, -747, -1458, -1967,
-  -2085, -1750, -1168, -693, -510, -472, -334, -75, 101, 52, -147, -369,
-  -622, -980, -1394, -1705, -1856, -1963, -2143, -2346, -2438, -2405, -2380, -2461,
-  -2605, -2735, -2860, -3011, -3098, -2973, -2645, -2349, -2315, -2485, -2556, -2319,
-  -1905, -1668, -1848, -2353, -2881, -3203, -3351, -3520, -3804, -4038, -3936, -3388,
-  -2565, -1752, -1141, -819, -842, -1146, -1433, -1363, -965, -682, -826, -1106,
-  -931, -164, 694, 1138, 1183, 1096, 889, 463, 94, 258, 848, 1072,
-  489, -196, 107, 1443, 2721, 3120, 3044, 3331, 3991, 4300, 3926, 3282,
-  2768, 2361, 2286, 3466, 6558, 10737, 14124, 15588, 15596, 15120, 14250, 12371,
-  9383, 6107, 3487, 1905, 1383, 1960, 3483, 5323, 6742, 7528, 7970, 8265,
-  8265, 7882, 7369, 6990, 6605, 5810, 4427, 2676, 942, -442, -1258, -1504,
-  -1473, -1508, -1581, -1308, -532, 264, 333, -610, -2172, -3740, -4930, -5613,
-  -5758, -5424, -4789, -4035, -3253, -2537, -2090, -2109, -2611, -3452, -4445, -5365,
-  -5938, -6049, -5953, -6044, -6341, -6424, -6022, -5396, -4916, -4438, -3490, -2039,
-  -637, 308, 1012, 1774, 2274, 1912, 760, -328, -692, -529, -335, -75,
-  645, 1744, 2547, 2619, 2309, 2218, 2418, 2534, 2432, 2433, 2803, 3352,
-  3688, 3670, 3425, 3068, 2638, 2278, 2230, 2572, 3044, 3236, 2913, 2152,
-  1216, 328, -489, -1371, -2352, -3123, -3166, -2259, -817, 391, 886, 775,
-  439, 64, -430, -1136, -1985, -2821, -3500, -3896, -3923, -3655, -3365, -3319,
-  -3502, -3624, -3422, -2923, -2394, -2061, -1959, -2010, -2174, -2447, -2741, -2878,
-  -2741, -2398, -2014, -1643, -1184, -568, 59, 406, 285, -249, -979, -1674,
-  -2147, -2269, -2021, -1532, -993, -511, -82, 296, 552, 608, 489, 309,
-  158, 52, -36, -130, -264, -478, -797, -1205, -1659, -2074, -2307, -2229,
-  -1879, -1497, -1314, -1314, -1287, -1142, -1082, -1389, -2067, -2812, -3292, -3375,
-  -3109, -2637, -2207, -2109, -2433, -2924, -3237, -3344, -3508, -3797, -3856, -3355,
-  -2527, -1980, -1980, -2206, -2321, -2464, -2909, -3450, -3535, -3021, -2417, -2183,
-  -2118, -1756, -1133, -766, -885, -1119, -1078, -869, -758, -628, -170, 474,
-  746, 441, 58, 147, 594, 872, 849, 974, 1646, 2707, 3620, 3912,
-  3389, 2264, 1247, 1220, 2424, 4087, 5273, 6097, 7700, 10787, 14507, 17056,
-  17244, 15271, 12216, 9232, 7151, 6225, 5899, 5216, 3938, 3155, 4236, 7036,
-  9604, 10032, 8400, 6571, 6125, 6880, 7482, 7028, 5770, 4464, 3511, 2846,
-  2293, 1694, 866, -184, -960, -749, 508, 1813, 1917, 569, -1317, -2793,
-  -3863, -5089, -6486, -7309, -6964, -5721, -4289, -3021, -1893, -1077, -1024, -1874,
-  -3199, -4515, -5760, -6966, -7761, -7678, -6929, -6366, -6468, -6752, -6470, -5632,
-  -4888, -4523, -4060, -2999, -1538, -280, 499, 930, 1046, 653, -209, -1048,
-  -1396, -1294, -1047, -652, 195, 1511, 2762, 3359, 3241, 2820, 2461, 2228,
-  2086, 2100, 2349, 2799, 3365, 4022, 4724, 5275, 5403, 5014, 4285, 3505,
-  2867, 2439, 2199, 2039, 1783, 1331, 786, 359, 139, 2, -190, -371,
-  -320, 82, 693, 1202, 1355, 1088, 513, -187, -869, -1501, -2136, -2812,
-  -3455, -3885, -3941, -3608, -3059, -2576, -2395, -2561, -2907, -3204, -3339, -3361,
-  -3359, -3357, -3333, -3303, -3282, -3189, -2884, -2363, -1862, -1655, -1754, -1901,
-  -1873, -1735, -1726, -1940, -2227, -2393, -2388, -2250, -1965, -1490, -907, -421,
-  -149, -3, 148, 235, 48, -458, -1009, -1273, -1217, -1113, -1202, -1416,
-  -1501, -1316, -941, -527, -140, 204, 434, 436, 156, -354, -974, -1563,
-  -1982, -2161, -2158, -2088, -1980, -1780, -1540, -1497, -1806, -2246, -2401, -2206,
-  -2092, -2422, -2918, -2964, -2460, -2053, -2324, -3022, -3419, -3274, -3046, -3098,
-  -3136, -2738, -2106, -1831, -2010, -2100, -1792, -1543, -1875, -2461, -2460, -1709,
-  -1032, -1147, -1681, -1692, -932, -133, -32, -521, -915, -722, 46, 1068,
-  1901, 2128, 1713, 1225, 1330, 1974, 2367, 2044, 1692, 2582, 5221, 8818,
-  12044, 14020, 14571, 13994, 12862, 11730, 10592, 8764, 5830, 2767, 1553, 3184,
-  6350, 8565, 8643, 7637, 7307, 8151, 9233, 9551, 8997, 8047, 7121, 6489,
-  6339, 6446, 5988, 4265, 1732, -104, -156, 1086, 2142, 2165, 1620, 1348,
-  1388, 1021, -244, -2090, -3789, -4867, -5241, -4964, -4123, -2970, -1917, -1300,
-  -1208, -1584, -2407, -3662, -5193, -6677, -7791, -8397, -8545, -8352, -7901, -7262,
-  -6582, -6099, -5971, -6063, -5963, -5325, -4229, -3134, -2425, -2085, -1847, -1617,
-  -1584, -1912, -2435, -2772, -2670, -2159, -1396, -509, 365, 1016, 1265, 1141,
-  885, 765, 913, 1349, 2066, 3001, 3977, 4751, 5175, 5273, 5149, 4881,
-  4524, 4186, 3990, 3944, 3881, 3601, 3057, 2386, 1788, 1402, 1298, 1494,
-  1937, 2499, 3049, 3527, 3889, 4001, 3671, 2870, 1864, 1018, 439, -88,
-  -768, -1471, -1869, -1869, -1790, -2022, -2597, -3203, -3570, -3720, -3795, -3810,
-  -3687, -3475, -3335, -3304, -3220, -3003, -2879, -3146, -3745, -4230, -4259, -3981,
-  -3817, -3939, -4130, -4163, -4131, -4290, -4679, -5039, -5092, -4773, -4174, -3380,
-  -2457, -1560, -925, -724, -943, -1396, -1848, -2128, -2195, -2098, -1871, -1477,
-  -904, -302, 78, 125, -14, -115, -118, -97, -56, 105, 381, 587,
-  560, 366, 157, -71, -405, -719, -691, -232, 293, 446, 225, -28,
-  -171, -441, -1013, -1647, -1980, -2010, -1999, -1982, -1712, -1159, -749, -855,
-  -1265, -1490, -1475, -1642, -2171, -2628, -2569, -2233, -2233, -2654, -2905, -2560,
-  -1975, -1791, -2055, -2214, -1911, -1393, -1072, -1009, -1039, -1130, -1282, -1213,
-  -571, 485, 1247, 1260, 923, 1009, 1649, 2121, 1698, 491, -645, -831,
-  307, 2587, 5435, 8145, 10300, 11998, 13496, 14550, 14396, 12599, 9762, 7113,
-  5409, 4517, 4053, 4044, 4724, 5956, 7242, 8242, 8940, 9284, 9062, 8367,
-  7838, 8015, 8532, 8403, 7231, 5766, 4999, 4940, 4695, 3686, 2403, 1775,
-  2080, 2721, 2950, 2503, 1551, 350, -894, -1982, -2786, -3360, -3819, -4071,
-  -3817, -2921, -1735, -939, -1012, -1891, -3131, -4331, -5378, -6353, -7299, -8121,
-  -8650, -8752, -8416, -7797, -7159, -6711, -6436, -6140, -5713, -5281, -5009, -4796,
-  -4354, -3633, -3036, -3002, -3441, -3773, -3602, -3160, -2931, -2982, -2899, -2375,
-  -1627, -1079, -815, -546, -64, 522, 1058, 1630, 2409, 3299, 3983, 4334,
-  4585, 4984, 5405, 5474, 5061, 4483, 4143, 4076, 3970, 3594, 3079, 2772,
-  2889, 3353, 3906, 4311, 4488, 4534, 4632, 4842, 4982, 4763, 4109, 3305,
-  2747, 2532, 2369, 1921, 1174, 405, -165, -581, -1001, -1442, -1763, -1873,
-  -1852, -1818, -1790, -1760, -1845, -2227, -2882, -3501, -3788, -3804, -3867, -4125,
-  -4377, -4395, -4295, -4418, -4892, -5502, -6021, -6460, -6866, -7057, -6787, -6129,
-  -5447, -4923, -4359, -3579, -2834, -2529, -2657, -2796, -2734, -2771, -3228, -3891,
-  -4247, -4183, -4077, -4149, -4062, -3441, -2530, -1957, -1874, -1714, -986, -27,
-  364, -31, -528, -374, 347, 850, 606, -88, -537, -436, -73, 153,
-  186, 235, 402, 556, 560, 447, 296, 22, -533, -1263, -1694, -1400,
-  -506, 336, 590, 381, 292, 608, 930, 640, -332, -1397, -1968, -2065,
-  -2119, -2321, -2425, -2224, -1939, -1901, -2008, -1801, -1141, -502, -392, -670,
-  -713, -237, 356, 523, 234, -104, -180, 30, 486, 1156, 1783, 1920,
-  1448, 873, 790, 1096, 1091, 473, -29, 712, 3069, 6322, 9387, 11623,
-  12932, 13421, 13200, 12377, 10996, 8994, 6479, 4082, 2781, 3122, 4622, 6107,
-  6721, 6555, 6340, 6612, 7252, 7736, 7725, 7397, 7233, 7533, 8107, 8421,
-  8042, 6962, 5565, 4361, 3718, 3710, 4086, 4399, 4296, 3751, 3001, 2229,
-  1360, 207, -1233, -2682, -3721, -4011, -3437, -2228, -953, -227, -273, -794,
-  -1360, -1912, -2760, -4101, -5692, -7064, -7959, -8434, -8633, -8636, -8521, -8418,
-  -8345, -8115, -7525, -6636, -5756, -5132, -4764, -4555, -4545, -4879, -5566, -6358,
-  -6906, -6983, -6580, -5842, -4961, -4091, -3317, -2713, -2413, -2536, -2988, -3399,
-  -3403, -2965, -2342, -1680, -803, 459, 1845, 2803, 3107, 3141, 3424, 3970,
-  4328, 4202, 3781, 3385, 3018, 2493, 1873, 1506, 1580, 1918, 2342, 3020,
-  4181, 5553, 6420, 6372, 5784, 5349, 5266, 5125, 4579, 3862, 3495, 3648,
-  4000, 4159, 4008, 3623, 3051, 2341, 1674, 1251, 1037, 769, 290, -229,
-  -512, -541, -582, -846, -1254, -1566, -1658, -1583, -1446, -1347, -1423, -1803,
-  -2454, -3171, -3801, -4399, -5072, -5706, -6005, -5824, -5349, -4886, -4542, -4249,
-  -4003, -3936, -4108, -4374, -4553, -4629, -4691, -4718, -4570, -4217, -3865, -3766,
-  -3944, -4173, -4220, -4047, -3784, -3572, -3443, -3322, -3120, -2848, -2642, -2648,
-  -2846, -3035, -3015, -2764, -2397, -1972, -1434, -774, -165, 160, 154, 3,
-  -117, -247, -522, -886, -1061, -875, -502, -262, -195, -2, 514, 1114,
-  1379, 1251, 1106, 1231, 1438, 1344, 913, 493, 317, 229, 4, -256,
-  -269, -26, 169, 156, 156, 431, 843, 981, 687, 247, 28, 96,
-  272, 452, 679, 991, 1337, 1666, 1952, 2081, 1843, 1172, 331, -258,
-  -382, -140, 313, 1008, 2044, 3314, 4468, 5165, 5312, 5037, 4524, 3922,
-  3370, 2998, 2871, 2965, 3223, 3606, 4056, 4449, 4622, 4493, 4136, 3741,
-  3483, 3420, 3494, 3605, 3704, 3814, 3959, 4091, 4108, 3971, 3783, 3717,
-  3843, 4070, 4257, 4357, 4397, 4362, 4151, 3695, 3082, 2495, 2053, 1752,
-  1581, 1603, 1882, 2337, 2749, 2931, 2852, 2579, 2146, 1551, 842, 133,
-  -491, -1021, -1449, -1702, -1726, -1612, -1529, -1517, -1432, -1166, -865, -820,
-  -1135, -1621, -2031, -2322, -2595, -2850, -2951, -2821, -2552, -2263, -1958, -1625,
-  -1414, -1549, -2033, -2565, -2844, -2892, -2966, -3181, -3343, -3192, -2707, -2117,
-  -1649, -1350, -1137, -916, -641, -328, -74, -21, -243, -654, -1071, -1368,
-  -1530, -1583, -1520, -1335, -1066, -757, -422, -81, 167, 203, 25, -232,
-  -451, -644, -845, -943, -753, -268, 247, 507, 489, 397, 370, 331,
-  160, -121, -384, -569, -706, -793, -766, -623, -492, -483, -544, -527,
-  -397, -272, -258, -318, -358, -379, -457, -614, -773, -874, -949, -1059,
-  -1184, -1253, -1239, -1177, -1101, -1012, -913, -825, -736, -594, -414, -347,
-  -558, -1013, -1453, -1637, -1560, -1390, -1243, -1087, -867, -610, -379, -191,
-  -58, -56, -239, -490, -563, -344, 0, 201, 175, 56, -39, -162,
-  -419, -783, -1107, -1279, -1286, -1138, -818, -346, 164, 558, 745, 736,
-  603, 446, 346, 310, 252, 89, -141, -308, -344, -329, -384, -531,
-  -684, -760, -725, -556, -252, 72, 202, 11, -377, -703, -846, -919,
-  -1054, -1194, -1154, -878, -522, -277, -181, -157, -162, -223, -334, -414,
-  -418, -436, -593, -882, -1141, -1233, -1183, -1114, -1068, -966, -733, -405,
-  -104, 67, 72, -78, -338, -613, -781, -763, -566, -263, 67, 367,
-  609, 783, 886, 887, 728, 407, 50, -156, -124, 45, 183, 239,
-  306, 455, 618, 677, 619, 557, 588, 691, 795, 892, 1025, 1169,
-  1213, 1086, 876, 751, 782, 885, 957, 1017, 1165, 1406, 1595, 1574,
-  1338, 1038, 827, 747, 753, 804, 888, 996, 1097, 1158, 1173, 1159,
-  1137, 1124, 1138, 1192, 1299, 1452, 1603, 1665, 1566, 1341, 1130, 1073,
-  1176, 1326, 1429, 1514, 1656, 1835, 1924, 1831, 1618, 1430, 1340, 1309,
-  1290, 1316, 1432, 1586, 1664, 1624, 1561, 1577, 1655, 1695, 1666, 1658,
-  1760, 1928, 2024, 1967, 1795, 1592, 1402, 1224, 1067, 951, 887, 877,
-  933, 1062, 1224, 1332, 1312, 1166, 946, 704, 474, 295, 198, 183,
-  216, 274, 369, 495, 594, 592, 486, 344, 209, 47, -194, -483,
-  -721, -856, -936, -1021, -1081, -1037, -879, -704, -611, -595, -593, -603,
-  -700, -923, -1197, -1402, -1492, -1506, -1490, -1446, -1377, -1320, -1312, -1332,
-  -1324, -1283, -1260, -1303, -1391, -1471, -1528, -1587, -1672, -1774, -1868, -1931,
-  -1949, -1915, -1844, -1763, -1687, -1611, -1545, -1528, -1582, -1672, -1733, -1751,
-  -1778, -1851, -1933, -1960, -1930, -1900, -1907, -1932, -1946, -1955, -1979, -2000,
-  -1988, -1959, -1960, -1998, -2010, -1937, -1808, -1707, -1678, -1680, -1658, -1610,
-  -1573, -1573, -1599, -1626, -1639, -1631, -1598, -1550, -1506, -1470, -1430, -1375,
-  -1315, -1268, -1229, -1176, -1104, -1034, -981, -937, -892, -862, -879, -944,
-  -1010, -1027, -990, -927, -852, -757, -644, -544, -492, -479, -467, -439,
-  -423, -446, -487, -494, -442, -362, -300, -265, -233, -187, -136, -96,
-  -69, -45, -16, 19, 52, 76, 87, 91, 108, 156, 231, 320,
-  412, 502, 580, 625, 633, 624, 620, 608, 571, 523, 518, 593,
-  727, 868, 990, 1111, 1242, 1357, 1419, 1426, 1415, 1414, 1421, 1425,
-  1436, 1482, 1575, 1697, 1814, 1909, 1987, 2060, 2130, 2184, 2210, 2216,
-  2224, 2254, 2303, 2359, 2407, 2448, 2489, 2533, 2579, 2621, 2654, 2679,
-  2702, 2727, 2751, 2762, 2754, 2730, 2698, 2661, 2616, 2567, 2529, 2517,
-  2536, 2578, 2625, 2667, 2691, 2690, 2657, 2592, 2495, 2374, 2246, 2128,
-  2029, 1946, 1873, 1813, 1770, 1741, 1711, 1666, 1600, 1517, 1422, 1320,
-  1213, 1101, 986, 873, 776, 705, 655, 616, 578, 545, 520, 491,
-  444, 369, 274, 169, 60, -51, -157, -243, -303, -340, -363, -380,
-  -388, -392, -398, -417, -451, -491, -528, -562, -601, -649, -695, -729,
-  -747, -764, -792, -829, -867, -901, -937, -981, -1030, -1077, -1125, -1177,
-  -1229, -1273, -1304, -1331, -1358, -1381, -1391, -1392, -1400, -1424, -1461, -1504,
-  -1552, -1612, -1687, -1765, -1834, -1889, -1934, -1975, -2008, -2025, -2028, -2024,
-  -2023, -2030, -2041, -2050, -2055, -2058, -2064, -2070, -2074, -2074, -2069, -2060,
-  -2049, -2038, -2030, -2025, -2020, -2007, -1988, -1969, -1951, -1929, -1896, -1852,
-  -1804, -1757, -1709, -1663, -1619, -1579, -1543, -1508, -1475, -1446, -1422, -1399,
-  -1373, -1343, -1315, -1289, -1265, -1239, -1210, -1181, -1153, -1124, -1092, -1058,
-  -1023, -989, -956, -922, -888, -859, -835, -813, -788, -760, -736, -725,
-  -725, -726, -723, -718, -715, -714, -708, -689, -656, -614, -566, -515,
-  -466, -425, -392, -363, -341, -330, -331, -334, -326, -301, -264, -226,
-  -190, -154, -115, -73, -34, -1, 30, 62, 94, 126, 160, 201,
-  248, 296, 339, 376, 416, 462, 511, 555, 594, 632, 673, 712,
-  741, 761, 776, 788, 798, 810, 830, 861, 901, 949, 1005, 1071,
-  1145, 1212, 1262, 1295, 1313, 1320, 1313, 1293, 1269, 1249, 1244, 1256,
-  1286, 1331, 1389, 1453, 1514, 1565, 1601, 1623, 1633, 1632, 1622, 1601,
-  1577, 1562, 1562, 1577, 1600, 1624, 1651, 1680, 1711, 1737, 1751, 1751,
-  1739, 1722, 1707, 1698, 1692, 1688, 1687, 1693, 1709, 1729, 1744, 1748,
-  1741, 1725, 1701, 1669, 1630, 1590, 1552, 1520, 1492, 1467, 1447, 1432,
-  1418, 1400, 1376, 1347, 1317, 1283, 1241, 1190, 1134, 1079, 1030, 983,
-  936, 892, 854, 821, 792, 762, 731, 695, 651, 601, 548, 495,
-  442, 388, 335, 285, 242, 204, 169, 133, 96, 54, 8, -38,
-  -81, -120, -155, -188, -218, -245, -270, -294, -321, -353, -390, -432,
-  -475, -518, -560, -601, -642, -682, -719, -752, -784, -813, -839, -864,
-  -888, -908, -923, -935, -950, -972, -1001, -1033, -1066, -1101, -1138, -1174,
-  -1204, -1227, -1241, -1249, -1254, -1262, -1275, -1295, -1321, -1352, -1385, -1417,
-  -1447, -1471, -1487, -1494, -1493, -1489, -1487, -1492, -1503, -1518, -1534, -1550,
-  -1565, -1577, -1584, -1584, -1577, -1563, -1546, -1529, -1515, -1502, -1488, -1472,
-  -1457, -1446, -1438, -1432, -1425, -1416, -1404, -1389, -1372, -1351, -1325, -1292,
-  -1255, -1215, -1176, -1139, -1104, -1072, -1041, -1013, -988, -968, -953, -940,
-  -926, -911, -895, -877, -857, -832, -801, -763, -722, -680, -639, -601,
-  -567, -538, -514, -498, -489, -487, -487, -487, -485, -479, -469, -454,
-  -434, -410, -383, -356, -331, -311, -298, -290, -284, -278, -272, -265,
-  -256, -243, -225, -202, -174, -144, -114, -85, -57, -31, -8, 10,
-  23, 31, 36, 42, 51, 67, 90, 121, 161, 209, 264, 323,
-  380, 431, 474, 507, 531, 548, 559, 568, 579, 594, 617, 648,
-  685, 726, 768, 807, 842, 871, 894, 912, 926, 938, 950, 965,
-  985, 1009, 1035, 1061, 1085, 1107, 1126, 1141, 1152, 1158, 1160, 1159,
-  1156, 1155, 1155, 1158, 1163, 1173, 1187, 1206, 1230, 1257, 1284, 1310,
-  1334, 1354, 1369, 1378, 1380, 1375, 1365, 1352, 1340, 1332, 1329, 1333,
-  1344, 1361, 1383, 1406, 1426, 1442, 1451, 1453, 1448, 1440, 1430, 1420,
-  1412, 1405, 1399, 1394, 1391, 1388, 1385, 1380, 1374, 1366, 1355, 1341,
-  1323, 1300, 1272, 1240, 1205, 1170, 1137, 1106, 1078, 1052, 1027, 1002,
-  974, 942, 904, 859, 808, 753, 695, 637, 580, 524, 472, 424,
-  381, 342, 306, 271, 236, 198, 157, 113, 66, 16, -36, -89,
-  -142, -193, -242, -289, -333, -375, -413, -448, -479, -506, -529, -550,
-  -571, -593, -617, -644, -675, -708, -742, -775, -807, -836, -861, -883,
-  -904, -925, -947, -970, -994, -1018, -1040, -1060, -1078, -1093, -1105, -1115,
-  -1124, -1135, -1149, -1165, -1182, -1200, -1219, -1239, -1258, -1275, -1290, -1301,
-  -1310, -1316, -1318, -1318, -1316, -1315, -1314, -1314, -1316, -1320, -1326, -1332,
-  -1335, -1334, -1329, -1319, -1304, -1286, -1264, -1241, -1218, -1198, -1182, -1171,
-  -1165, -1163, -1163, -1164, -1165, -1163, -1156, -1143, -1124, -1098, -1067, -1034,
-  -1001, -970, -941, -917, -898, -884, -873, -863, -852, -840, -826, -808,
-  -788, -767, -746, -725, -704, -684, -665, -647, -628, -609, -591, -576,
-  -563, -549, -532, -514, -496, -478, -459, -438, -417, -396, -375, -352,
-  -330, -310, -292, -276, -263, -252, -243, -233, -222, -209, -192, -172,
-  -149, -124, -97, -71, -46, -22, 0, 22, 46, 71, 96, 119,
-  143, 168, 192, 214, 236, 258, 279, 299, 320, 343, 367, 391,
-  415, 439, 465, 492, 519, 543, 567, 593, 619, 642, 660, 678,
-  698, 718, 736, 751, 764, 779, 798, 817, 834, 848, 863, 880,
-  897, 910, 922, 935, 950, 967, 984, 1000, 1015, 1029, 1044, 1058,
-  1070, 1079, 1086, 1092, 1099, 1109, 1118, 1127, 1137, 1149, 1165, 1184,
-  1202, 1218, 1233, 1250, 1268, 1284, 1297, 1310, 1322, 1334, 1342, 1344,
-  1343, 1344, 1348, 1351, 1351, 1350, 1353, 1356, 1355, 1349, 1341, 1334,
-  1325, 1308, 1284, 1258, 1236, 1219, 1203, 1186, 1168, 1153, 1139, 1124,
-  1107, 1087, 1065, 1040, 1009, 975, 942, 910, 876, 836, 792, 751,
-  715, 680, 641, 598, 556, 519, 482, 442, 399, 357, 318, 279,
-  239, 199, 160, 123, 85, 45, 3, -41, -86, -131, -175, -219,
-  -265, -310, -350, -385, -416, -447, -480, -512, -539, -563, -583, -600,
-  -618, -641, -667, -691, -709, -725, -745, -766, -780, -783, -782, -788,
-  -801, -814, -821, -825, -835, -850, -862, -868, -870, -873, -878, -885,
-  -891, -896, -899, -900, -898, -899, -904, -910, -914, -916, -920, -926,
-  -932, -937, -939, -938, -935, -932, -930, -930, -929, -924, -919, -916,
-  -911, -903, -893, -887, -888, -890, -889, -885, -881, -881, -877, -865,
-  -845, -826, -816, -814, -816, -816, -816, -818, -822, -823, -818, -809,
-  -800, -790, -781, -773, -768, -764, -753, -732, -707, -690, -683, -676,
-  -662, -644, -630, -621, -609, -589, -567, -551, -540, -528, -510, -490,
-  -473, -460, -443, -422, -398, -377, -359, -342, -322, -303, -285, -271,
-  -255, -233, -205, -173, -145, -124, -108, -93, -76, -60, -47, -35,
-  -17, 8, 38, 64, 81, 94, 111, 134, 156, 171, 182, 196,
-  214, 233, 246, 256, 271, 293, 317, 336, 348, 360, 375, 393,
-  409, 420, 429, 442, 460, 478, 491, 501, 513, 526, 539, 547,
-  554, 562, 572, 581, 588, 594, 601, 603, 601, 601, 608, 622,
-  636, 643, 646, 653, 667, 683, 697, 703, 702, 698, 695, 698,
-  703, 706, 707, 710, 719, 728, 729, 726, 726, 730, 730, 722,
-  715, 719, 730, 736, 736, 737, 743, 743, 729, 710, 701, 702,
-  701, 691, 681, 682, 686, 683, 675, 673, 678, 676, 659, 637,
-  627, 626, 621, 607, 591, 584, 579, 567, 548, 533, 526, 521,
-  510, 492, 472, 449, 425, 406, 392, 376, 349, 314, 285, 269,
-  260, 241, 208, 167, 133, 109, 94, 83, 72, 57, 38, 20,
-  10, 8, 7, 2, -5, -9, -10, -11, -15, -22, -32, -45,
-  -56, -60, -58, -63, -79, -97, -103, -98, -97, -104, -110, -107,
-  -110, -136, -175, -196, -181, -157, -157, -181, -198, -194, -190, -211,
-  -245, -267, -268, -271, -289, -311, -323, -331, -347, -363, -360, -338,
-  -326, -341, -356, -328, -247, -147, -63, -4, 38, 64, 72, 81,
-  124, 213, 315, 367, 328, 193, -17, -281, -583, -904, -1218, -1500,
-  -1735, -1924, -2072, -2170, -2189, -2096, -1890, -1630, -1406, -1266, -1187, -1112,
-  -1021, -955, -958, -1006, -1026, -965, -846, -732, -665, -648, -674, -740,
-  -829, -905, -939, -941, -944, -961, -966, -931, -851, -742, -622, -520,
-  -467, -482, -540, -594, -622, -642, -682, -737, -782, -804, -799, -751,
-  -632, -438, -210, -3, 158, 284, 398, 509, 616, 701, 743, 732,
-  680, 611, 541, 479, 428, 385, 318, 188, 2, -169, -263, -300,
-  -354, -440, -490, -442, -334, -244, -177, -63, 125, 301, 360, 305,
-  233, 201, 168, 71, -78, -212, -295, -342, -360, -321, -206, -56,
-  53, 87, 83, 113, 208, 326, 399, 396, 364, 368, 403, 385,
-  256, 84, 6, 64, 149, 139, 61, 54, 173, 319, 379, 369,
-  375, 398, 353, 240, 206, 364, 614, 740, 666, 535, 495, 496,
-  384, 137, -87, -154, -103, -51, -15, 99, 324, 563, 704, 757,
-  823, 937, 1011, 943, 744, 538, 430, 419, 424, 406, 409, 489,
-  620, 703, 686, 631, 643, 745, 872, 985, 1126, 1323, 1490, 1481,
-  1267, 985, 794, 688, 529, 239, -83, -267, -262, -180, -139, -106,
-  69, 453, 908, 1184, 1158, 947, 779, 762, 812, 776, 598, 341,
-  97, -83, -184, -201, -130, 20, 217, 387, 426, 276, 22, -145,
-  -102, 81, 232, 272, 264, 269, 254, 184, 128, 171, 249, 196,
-  -28, -254, -330, -351, -534, -893, -1166, -1116, -808, -503, -330, -163,
-  156, 566, 805, 644, 97, -584, -1100, -1336, -1413, -1493, -1542, -1361,
-  -896, -423, -277, -432, -494, -184, 317, 612, 565, 357, 129, -170,
-  -511, -614, -281, 189, 213, -401, -1199, -1606, -1514, -1220, -936, -646,
-  -408, -442, -771, -987, -670, 33, 497, 343, -120, -315, -78, 236,
-  254, -15, -306, -425, -345, -104, 224, 474, 457, 164, -164, -239,
-  5, 358, 548, 469, 205, -116, -461, -849, -1217, -1368, -1124, -527,
-  146, 598, 721, 609, 421, 271, 191, 112, -140, -712, -1516, -2186,
-  -2318, -1814, -972, -264, 7, -93, -220, -53, 387, 741, 685, 319,
-  71, 191, 437, 381, -48, -493, -621, -470, -300, -261, -343, -520,
-  -727, -755, -413, 126, 371, 56, -476, -639, -294, 132, 203, -97,
-  -567, -1128, -1685, -1848, -1192, 70, 1008, 875, -22, -615, -275, 525,
-  844, 377, -289, -428, 71, 751, 1166, 1217, 1000, 545, -155, -955,
-  -1525, -1556, -1015, -195, 486, 812, 953, 1261, 1800, 2134, 1739, 687,
-  -267, -490, -238, -369, -1200, -1955, -1604, -130, 1346, 1751, 1129, 417,
-  387, 1007, 1676, 1778, 1062, -160, -1053, -827, 450, 1724, 1937, 1139,
-  345, 293, 665, 664, 79, -554, -706, -400, 36, 397, 618, 613,
-  388, 214, 421, 955, 1335, 1162, 537, -86, -357, -261, 12, 243,
-  273, 65, -222, -279, 118, 851, 1417, 1264, 320, -769, -1115, -474,
-  431, 683, 211, -239, -208, -154, -641, -1234, -829, 815, 2459, 2720,
-  1670, 605, 347, 397, -61, -904, -1319, -1026, -628, -640, -709, -155,
-  961, 1773, 1639, 883, 312, 232, 217, -150, -630, -631, -53, 467,
-  295, -373, -692, -186, 665, 1027, 741, 412, 501, 686, 390, -298,
-  -614, -98, 776, 1141, 724, 43, -302, -244, -117, -167, -371, -573,
-  -626, -429, -42, 266, 255, 55, 51, 342, 499, 96, -630, -945,
-  -474, 355, 857, 808, 440, -71, -699, -1177, -1011, -130, 739, 778,
-  83, -420, -115, 595, 904, 628, 279, 262, 387, 252, -211, -757,
-  -1145, -1240, -957, -358, 225, 452, 365, 329, 510, 662, 546, 327,
-  291, 339, 112, -359, -527, -64, 544, 500, -271, -932, -717, 131,
-  669, 394, -201, -294, 251, 756, 620, 82, -102, 353, 845, 612,
-  -301, -1061, -1026, -433, 20, 54, 2, 184, 457, 496, 296, 160,
-  273, 496, 557, 299, -245, -850, -1184, -1064, -709, -520, -546, -367,
-  262, 897, 863, 184, -373, -304, -17, -170, -655, -750, -198, 382,
-  369, -17, -117, 187, 361, 67, -369, -498, -381, -381, -530, -493,
-  -142, 169, 55, -409, -791, -781, -422, 58, 444, 583, 384, -125,
-  -779, -1329, -1521, -1212, -513, 189, 517, 438, 240, 131, 18, -248,
-  -560, -682, -611, -581, -688, -746, -613, -453, -477, -583, -484, -152,
-  136, 226, 292, 495, 651, 469, -1, -419, -620, -739, -842, -715,
-  -223, 320, 422, -4, -541, -780, -682, -417, -79, 252, 359, 92,
-  -309, -379, 0, 380, 268, -273, -701, -636, -224, 128, 234, 225,
-  292, 450, 550, 444, 129, -234, -441, -416, -255, -89, 30, 82,
-  2, -220, -395, -279, 71, 268, 64, -254, -184, 308, 687, 533,
-  102, -20, 309, 644, 586, 265, 40, -57, -291, -708, -929, -592,
-  160, 776, 850, 494, 175, 226, 508, 561, 117, -527, -765, -380,
-  174, 338, 171, 202, 584, 773, 306, -404, -510, 106, 615, 385,
-  -123, -10, 738, 1155, 592, -418, -883, -587, -155, -61, -102, 50,
-  263, 241, 109, 239, 585, 642, 201, -245, -119, 454, 824, 670,
-  300, 71, -80, -301, -387, -90, 300, 201, -354, -530, 212, 1195,
-  1242, 239, -608, -307, 629, 907, 187, -552, -446, 113, 173, -352,
-  -600, -61, 679, 789, 348, 177, 658, 1231, 1191, 610, 169, 252,
-  531, 482, 65, -275, -201, 104, 161, -206, -612, -525, 87, 639,
-  576, 42, -272, 56, 669, 884, 493, -51, -236, -60, 95, 1,
-  -170, -124, 161, 400, 339, 55, -126, -18, 209, 261, 126, 83,
-  274, 447, 285, -119, -342, -196, 27, -31, -336, -563, -517, -260,
-  72, 325, 259, -229, -761, -692, 101, 903, 957, 400, 44, 237,
-  443, 95, -538, -733, -310, 184, 255, 15, -149, -115, -32, 1,
-  4, 6, 75, 334, 731, 909, 588, 26, -251, -184, -274, -785,
-  -1250, -1112, -553, -213, -223, -89, 398, 730, 469, 0, -25, 299,
-  272, -295, -759, -631, -277, -256, -395, -149, 378, 492, 49, -181,
-  332, 935, 624, -449, -1060, -561, 229, 156, -718, -1294, -960, -321,
-  -235, -640, -731, -101, 734, 1000, 555, -44, -227, 9, 188, -87,
-  -695, -1096, -876, -203, 313, 249, -188, -422, -166, 282, 414, 75,
-  -425, -696, -636, -432, -294, -252, -183, -4, 185, 167, -121, -435,
-  -457, -216, -127, -467, -911, -857, -210, 414, 431, 13, -202, 6,
-  215, 83, -129, -23, 238, 126, -415, -782, -511, 88, 355, 126,
-  -181, -212, -65, 11, -32, -127, -264, -402, -378, -135, 86, 26,
-  -195, -221, 12, 210, 219, 273, 533, 695, 405, -111, -244, 149,
-  501, 275, -337, -712, -569, -156, 180, 287, 127, -246, -536, -371,
-  207, 654, 532, 43, -287, -305, -273, -311, -232, -12, -8, -426,
-  -832, -620, 146, 741, 674, 249, 62, 267, 535, 563, 324, -72,
-  -466, -616, -359, 103, 319, 110, -225, -337, -254, -218, -269, -297,
-  -373, -651, -928, -702, 119, 887, 910, 308, -178, -150, 62, 27,
-  -201, -335, -351, -396, -392, -140, 212, 242, -101, -290, 71, 608,
-  615, 12, -518, -429, 28, 217, -27, -268, -120, 260, 414, 144,
-  -304, -555, -481, -240, -23, 157, 387, 642, 758, 646, 415, 196,
-  -36, -333, -526, -364, 79, 383, 300, 98, 143, 324, 205, -277,
-  -663, -614, -350, -207, -67, 367, 893, 901, 242, -438, -480, -29,
-  275, 190, 34, 41, 23, -158, -214, 137, 598, 581, 35, -408,
-  -252, 220, 361, 42, -236, -85, 243, 259, -39, -163, 147, 501,
-  353, -215, -501, -77, 594, 677, 31, -555, -326, 483, 918, 484,
-  -255, -386, 227, 812, 654, -50, -482, -237, 223, 241, -135, -236,
-  239, 705, 457, -284, -558, 54, 803, 763, 84, -266, 100, 483,
-  208, -346, -334, 268, 622, 271, -221, -148, 319, 474, 142, -142,
-  -16, 194, 26, -425, -680, -521, -151, 180, 375, 368, 114, -210,
-  -276, -26, 182, 38, -255, -232, 206, 650, 705, 407, 31, -294,
-  -578, -731, -586, -203, 82, 40, -151, -134, 158, 403, 299, -61,
-  -318, -274, -79, 43, 90, 222, 438, 491, 219, -142, -167, 213,
-  528, 285, -388, -813, -542, 98, 409, 176, -119, 5, 379, 449,
-  71, -293, -232, 58, 98, -187, -401, -274, 8, 158, 176, 183,
-  91, -220, -520, -419, 5, 182, -164, -526, -274, 409, 703, 263,
-  -327, -370, 56, 351, 244, -22, -225, -401, -485, -213, 366, 661,
-  221, -531, -723, -160, 428, 392, -2, -81, 225, 357, 37, -307,
-  -204, 154, 213, -129, -398, -224, 178, 352, 172, -120, -305, -362,
-  -308, -125, 92, 126, -69, -221, -85, 167, 146, -155, -240, 248,
-  959, 1192, 724, 33, -330, -327, -257, -271, -306, -348, -444, -477,
-  -266, 62, 109, -186, -326, 68, 586, 521, -58, -268, 334, 1018,
-  816, -115, -712, -462, 9, 2, -232, -43, 480, 596, 83, -380,
-  -218, 215, 224, -179, -379, -144, 80, -48, -233, -90, 181, 113,
-  -237, -328, 22, 326, 143, -241, -209, 309, 731, 576, 16, -421,
-  -448, -169, 148, 270, 86, -270, -425, -129, 375, 533, 147, -350,
-  -423, -93, 148, 25, -205, -194, 7, 76, -78, -203, -75, 217,
-  418, 393, 191, -71, -258, -246, -59, 55, -131, -501, -651, -351,
-  153, 404, 224, -159, -392, -304, 9, 265, 181, -212, -474, -187,
-  428, 618, 33, -676, -576, 298, 906, 558, -167, -255, 314, 554,
-  -98, -966, -1040, -285, 405, 406, 16, -110, 221, 656, 751, 330,
-  -413, -953, -780, 31, 725, 655, 89, -119, 324, 752, 507, -128,
-  -360, -33, 200, -116, -583, -565, -87, 268, 192, -33, -61, 59,
-  90, -20, -158, -262, -317, -252, -72, -6, -259, -613, -568, 9,
-  614, 683, 285, -29, 5, 80, -115, -377, -299, 68, 229, -41,
-  -337, -193, 221, 301, -120, -491, -301, 190, 313, -40, -256, 81,
-  521, 355, -351, -788, -479, 124, 322, 73, -131, -65, 12, -76,
-  -131, 0, 96, -54, -221, -76, 216, 192, -142, -222, 223, 688,
-  603, 179, 74, 378, 510, 157, -232, -192, 11, -159, -576, -575,
-  -16, 397, 100, -491, -531, 83, 605, 463, -55, -291, -60, 272,
-  365, 246, 103, 6, -83, -169, -211, -219, -254, -328, -332, -102,
-  361, 750, 661, 63, -529, -553, -80, 242, 4, -446, -497, -97,
-  253, 249, 145, 229, 324, 107, -280, -346, 29, 365, 207, -286,
-  -577, -429, -86, 109, 70, -79, -186, -147, 35, 203, 175, 11,
-  -16, 206, 401, 265, -68, -165, 76, 245, 2, -380, -342, 175,
-  570, 327, -321, -650, -299, 344, 609, 250, -365, -665, -396, 187,
-  564, 402, -143, -554, -445, 48, 415, 311, -94, -348, -228, 61,
-  177, 49, -77, 35, 300, 376, 63, -388, -485, -71, 394, 316,
-  -260, -612, -219, 502, 664, 53, -580, -496, 109, 472, 305, 42,
-  64, 196, 138, -4, 19, 89, -77, -343, -258, 205, 505, 323,
-  42, 115, 305, 108, -317, -297, 217, 381, -318, -1125, -947, 97,
-  780, 423, -267, -321, 164, 366, 48, -184, 83, 440, 329, -123,
-  -354, -214, -85, -216, -356, -178, 208, 413, 283, 52, 0, 134,
-  233, 118, -166, -408, -443, -313, -221, -288, -408, -395, -227, -69,
-  -52, -116, -106, 34, 203, 248, 95, -172, -343, -258, 5, 178,
-  112, -44, -53, 84, 157, 86, 30, 71, 13, -326, -735, -784,
-  -398, -14, -29, -292, -336, -31, 251, 166, -125, -174, 167, 556,
-  586, 249, -82, -90, 160, 345, 264, 47, -30, 107, 236, 114,
-  -190, -331, -73, 397, 616, 322, -248, -568, -343, 183, 461, 207,
-  -283, -440, -48, 502, 642, 266, -175, -217, 84, 288, 159, -50,
-  13, 289, 364, 45, -337, -344, -22, 146, -80, -324, -101, 457,
-  712, 368, -97, -93, 258, 310, -144, -558, -424, -8, 88, -163,
-  -210, 166, 471, 249, -187, -198, 225, 462, 202, -142, -128, 38,
-  -79, -357, -261, 277, 624, 286, -402, -707, -407, 62, 244, 107,
-  -133, -303, -308, -104, 178, 270, 104, -37, 108, 363, 335, 0,
-  -233, -101, 134, 83, -209, -355, -180, 104, 272, 354, 415, 342,
-  58, -199, -132, 125, 95, -351, -682, -360, 357, 644, 186, -371,
-  -267, 342, 637, 304, -66, 88, 426, 250, -360, -573, -32, 545,
-  369, -277, -443, 129, 694, 613, 151, -128, -223, -437, -602, -267,
-  392, 559, -77, -733, -542, 270, 754, 574, 307, 387, 459, 88,
-  -392, -318, 270, 604, 220, -452, -686, -314, 231, 470, 265, -185,
-  -459, -190, 517, 994, 664, -199, -672, -272, 417, 464, -231, -817,
-  -559, 276, 762, 414, -303, -564, -146, 386, 419, 40, -139, 163,
-  501, 314, -284, -631, -379, 93, 227, -43, -362, -445, -248, 165,
-  585, 596, -9, -709, -646, 245, 937, 546, -459, -863, -361, 118,
-  -121, -518, -218, 498, 569, -221, -839, -459, 409, 720, 334, -30,
-  5, 70, -81, -71, 361, 694, 290, -549, -858, -323, 282, 199,
-  -293, -377, 99, 451, 165, -424, -619, -229, 305, 481, 218, -166,
-  -281, -16, 311, 251, -206, -478, -88, 570, 570, -286, -984, -503,
-  740, 1237, 290, -1019, -1149, -31, 916, 626, -380, -871, -506, -20,
-  -7, -190, -53, 288, 304, -86, -365, -161, 235, 316, 51, -142,
-  -10, 259, 374, 313, 239, 227, 233, 221, 182, 66, -146, -342,
-  -371, -250, -128, -47, 84, 238, 202, -66, -234, 2, 395, 389,
-  -74, -381, -105, 305, 120, -545, -759, -54, 833, 856, 11, -718,
-  -658, -152, 124, 63, 10, 74, 45, -125, -206, -108, -21, -2,
-  170, 510, 551, -18, -694, -675, -20, 323, -168, -788, -577, 313,
-  825, 463, -146, -263, 9, 145, 61, 12, -48, -354, -650, -348,
-  459, 817, 165, -732, -721, 151, 720, 332, -353, -438, -16, 200,
-  4, -177, -122, -94, -225, -223, 57, 253, 60, -201, -46, 386,
-  521, 218, -64, -31, 54, -71, -173, 35, 308, 208, -158, -269,
-  -16, 126, -109, -327, -117, 245, 189, -242, -412, -19, 464, 451,
-  9, -317, -231, 59, 216, 154, 22, -12, 77, 145, 35, -169,
-  -158, 161, 387, 92, -456, -480, 219, 780, 338, -693, -1002, -118,
-  848, 604, -600, -1261, -562, 630, 950, 262, -338, -73, 561, 601,
-  -38, -505, -219, 363, 405, -165, -586, -291, 385, 693, 400, -77,
-  -324, -345, -293, -167, 29, 82, -131, -312, -84, 351, 347, -233,
-  -646, -226, 581, 716, 0, -527, -60, 744, 628, -447, -1128, -538,
-  454, 410, -629, -1159, -328, 827, 812, -232, -731, 73, 1062, 850,
-  -231, -638, 121, 766, 125, -1079, -1166, 103, 1072, 398, -1091, -1436,
-  -77, 1448, 1450, 83, -1048, -881, 64, 604, 316, -230, -362, -43,
-  284, 304, 97, -63, -27, 149, 311, 345, 253, 157, 197, 343,
-  347, 18, -442, -535, -82, 411, 280, -390, -726, -158, 711, 755,
-  -198, -1059, -842, 49, 395, -169, -669, -175, 843, 1070, 90, -993,
-  -906, 209, 983, 503, -609, -993, -198, 814, 849, -105, -919, -722,
-  93, 457, 5, -558, -507, -67, 33, -272, -273, 362, 905, 528,
-  -408, -693, 37, 680, 164, -953, -1129, 22, 1103, 796, -348, -705,
-  129, 797, 146, -1074, -1203, 36, 1115, 730, -509, -947, -53, 985,
-  866, -225, -981, -616, 324, 794, 498, 49, 85, 513, 739, 445,
-  -52, -243, -49, 141, 14, -278, -354, -121, 118, 60, -224, -394,
-  -217, 196, 508, 447, 58, -306, -297, 32, 240, 19, -374, -401,
-  43, 439, 304, -155, -290, 124, 574, 458, -143, -551, -298, 307,
-  524, 29, -669, -757, -80, 579, 383, -487, -970, -463, 362, 461,
-  -134, -397, 145, 668, 295, -495, -501, 392, 964, 432, -404, -395,
-  214, 232, -558, -1021, -430, 381, 317, -265, -155, 709, 1020, 120,
-  -839, -492, 683, 964, -156, -1202, -745, 652, 1236, 349, -873, -1070,
-  -219, 621, 662, 71, -451, -408, 109, 554, 428, -148, -451, 9,
-  753, 794, -81, -895, -663, 291, 698, -6, -920, -855, 128, 831,
-  483, -367, -696, -330, 38, -32, -123, 299, 964, 1080, 430, -256,
-  -232, 297, 456, -152, -944, -1069, -379, 483, 807, 456, -128, -365,
-  -43, 469, 539, -19, -610, -497, 206, 576, 96, -554, -392, 418,
-  701, -18, -704, -243, 832, 934, -335, -1471, -1053, 321, 873, 76,
-  -726, -306, 762, 1017, 171, -617, -432, 230, 342, -216, -646, -427,
-  83, 289, 144, 34, 147, 274, 178, -68, -160, 84, 463, 502,
-  -33, -705, -712, 122, 878, 502, -753, -1405, -564, 778, 910, -342,
-  -1308, -678, 740, 1127, 107, -833, -455, 595, 831, -4, -743, -524,
-  146, 344, 30, -162, -34, 3, -205, -229, 162, 479, 196, -367,
-  -437, 71, 404, 75, -441, -435, -12, 145, -148, -319, 31, 481,
-  438, 34, -115, 101, 116, -348, -703, -301, 512, 720, 20, -679,
-  -458, 345, 579, -132, -837, -532, 485, 1001, 459, -393, -542, 48,
-  570, 483, 48, -236, -277, -280, -283, -140, 143, 356, 377, 297,
-  201, 51, -114, -93, 168, 350, 127, -317, -437, -57, 325, 152,
-  -460, -845, -581, 65, 487, 361, -127, -499, -379, 187, 712, 691,
-  156, -320, -301, -12, 52, -113, -45, 360, 500, -83, -837, -749,
-  240, 941, 372, -894, -1361, -477, 697, 869, 84, -538, -350, 127,
-  156, -138, -93, 372, 568, 71, -551, -466, 227, 533, -119, -1036,
-  -1070, -61, 949, 958, 137, -488, -280, 369, 645, 289, -192, -209,
-  200, 471, 245, -145, -93, 437, 740, 227, -703, -1020, -348, 466,
-  381, -449, -823, -87, 911, 865, -253, -1075, -562, 651, 1047, 133,
-  -997, -1081, -208, 474, 296, -226, -292, 95, 328, 197, 118, 317,
-  361, -132, -697, -513, 369, 885, 305, -751, -1076, -409, 346, 401,
-  17, -81, 228, 414, 142, -311, -517, -404, -178, -15, 9, -113,
-  -239, -134, 197, 394, 199, -108, -65, 257, 307, -93, -387, -73,
-  477, 451, -253, -837, -652, -13, 300, 52, -302, -316, -12, 337,
-  537, 496, 191, -203, -341, -73, 323, 465, 312, 110, 4, -65,
-  -94, 28, 218, 157, -244, -552, -295, 351, 700, 393, -185, -434,
-  -250, 3, 31, -138, -330, -387, -170, 312, 717, 610, 55, -283,
-  94, 800, 967, 359, -310, -315, 154, 324, -84, -534, -474, -77,
-  52, -281, -635, -512, 67, 632, 750, 363, -215, -523, -270, 371,
-  809, 548, -259, -881, -758, -109, 336, 188, -205, -277, 22, 229,
-  47, -264, -301, -85, 32, -82, -190, -123, -50, -133, -190, 0,
-  223, 82, -294, -283, 285, 697, 278, -532, -662, 83, 666, 252,
-  -607, -765, -96, 423, 186, -255, -183, 178, 128, -304, -382, 141,
-  572, 308, -244, -263, 286, 615, 240, -409, -630, -323, 69, 212,
-  130, -42, -228, -295, -84, 327, 584, 455, 147, 53, 233, 344,
-  121, -245, -339, -62, 206, 86, -283, -366, 76, 605, 599, 64,
-  -330, -123, 296, 193, -492, -1008, -753, -19, 441, 352, 113, 128,
-  334, 450, 394, 276, 159, 57, 39, 114, 113, -88, -289, -196,
-  63, -6, -526, -920, -614, 121, 471, 165, -202, -62, 334, 351,
-  -80, -412, -299, -16, 47, -79, -123, -30, 60, 108, 151, 94,
-  -139, -317, -123, 272, 291, -202, -559, -241, 288, 158, -548, -749,
-  74, 975, 762, -316, -865, -260, 566, 537, -81, -241, 270, 587,
-  147, -453, -366, 269, 555, 108, -474, -484, -5, 329, 182, -179,
-  -334, -202, -15, 13, -96, -140, 25, 308, 427, 204, -185, -328,
-  -17, 450, 519, -16, -685, -764, -98, 606, 525, -251, -744, -290,
-  548, 696, 27, -457, -62, 593, 510, -171, -390, 170, 523, -105,
-  -964, -749, 484, 1300, 826, -176, -524, -176, 64, -76, -121, 118,
-  169, -209, -465, -97, 470, 443, -154, -531, -300, 51, 25, -158,
-  -73, 126, 2, -327, -267, 298, 713, 442, -147, -290, 143, 539,
-  411, -31, -299, -287, -258, -345, -351, -116, 170, 178, -93, -259,
-  -33, 357, 432, 104, -198, -147, -6, -186, -510, -393, 183, 436,
-  -115, -750, -414, 706, 1231, 439, -676, -727, 191, 739, 252, -468,
-  -467, 55, 279, 55, -85, 48, 47, -251, -403, -122, 159, -36,
-  -403, -304, 192, 370, -22, -374, -163, 254, 231, -163, -304, -18,
-  210, 92, 18, 355, 707, 418, -377, -756, -197, 686, 892, 283,
-  -305, -174, 376, 501, -79, -726, -697, -64, 418, 273, -139, -162,
-  284, 637, 452, -70, -404, -340, -97, 60, 77, 27, -5, 56,
-  203, 251, 27, -305, -347, -45, 109, -268, -776, -642, 197, 879,
-  690, -26, -370, -63, 341, 338, 78, -66, -104, -265, -460, -357,
-  42, 290, 76, -337, -455, -180, 112, 74, -219, -394, -219, 142,
-  291, 45, -302, -266, 208, 591, 409, -100, -266, 97, 426, 215,
-  -271, -417, -172, -51, -267, -406, -155, 130, 11, -222, 63, 741,
-  901, 143, -692, -599, 181, 487, -98, -667, -321, 542, 818, 238,
-  -348, -225, 289, 466, 212, 30, 170, 322, 189, -49, -36, 230,
-  390, 166, -345, -754, -689, -137, 447, 504, 10, -407, -213, 290,
-  335, -203, -531, -29, 790, 896, 150, -502, -342, 166, 129, -459,
-  -747, -292, 299, 250, -305, -545, -103, 473, 477, -65, -501, -365,
-  127, 411, 206, -231, -437, -234, 103, 190, -8, -143, 48, 355,
-  349, -12, -278, -109, 207, 115, -404, -729, -426, 120, 208, -184,
-  -334, 189, 828, 722, -109, -720, -445, 270, 514, 81, -384, -314,
-  115, 375, 275, 30, -151, -223, -155, 62, 235, 96, -287, -454,
-  -103, 461, 648, 281, -230, -399, -172, 123, 156, -110, -395, -351,
-  40, 334, 92, -469, -585, 79, 832, 728, -172, -804, -444, 415,
-  804, 512, 136, 119, 270, 257, 69, -172, -435, -581, -325, 252,
-  491, -24, -657, -416, 572, 1005, 172, -936, -906, 152, 815, 393,
-  -215, -26, 540, 407, -433, -886, -387, 335, 400, -26, -212, -13,
-  111, -16, -77, 29, -37, -362, -452, 17, 545, 451, -102, -346,
-  -82, 42, -378, -789, -498, 231, 523, 161, -150, 130, 612, 617,
-  171, -120, 30, 271, 214, -60, -228, -166, 6, 134, 125, -32,
-  -210, -216, -77, -93, -410, -694, -521, -10, 276, 123, -50, 144,
-  432, 314, -120, -267, 98, 485, 395, -11, -240, -176, -82, -76,
-  -25, 57, -33, -232, -141, 313, 537, 33, -711, -691, 228, 964,
-  580, -463, -902, -319, 415, 394, -196, -517, -249, 167, 298, 213,
-  143, 79, -48, -96, 64, 225, 100, -179, -196, 80, 166, -196,
-  -538, -282, 357, 568, 64, -477, -331, 299, 594, 211, -373, -567,
-  -318, 74, 397, 540, 344, -183, -627, -527, 3, 347, 166, -190,
-  -217, 72, 282, 256, 206, 251, 216, -11, -217, -165, 30, 74,
-  -61, -116, 50, 270, 308, 124, -162, -393, -411, -136, 274, 458,
-  224, -212, -466, -400, -162, 75, 201, 84, -297, -608, -382, 335,
-  854, 640, 35, -197, 89, 293, 25, -323, -235, 108, 137, -189,
-  -301, 100, 571, 537, 20, -478, -576, -245, 309, 661, 332, -624,
-  -1295, -767, 591, 1294, 538, -703, -910, 0, 702, 391, -215, -139,
-  390, 445, -64, -304, 57, 285, -208, -802, -513, 484, 990, 415,
-  -453, -562, 71, 588, 487, 65, -212, -261, -219, -128, -4, 66,
-  83, 204, 429, 458, 130, -176, 0, 409, 281, -526, -1065, -479,
-  685, 988, -17, -1104, -933, 192, 778, 170, -648, -502, 386, 851,
-  459, -31, 55, 330, 76, -548, -707, -153, 400, 323, -82, -168,
-  47, 31, -299, -410, -53, 253, -4, -485, -435, 213, 711, 515,
-  -35, -258, 12, 396, 546, 411, 82, -266, -327, 58, 523, 457,
-  -189, -692, -448, 200, 408, -39, -505, -448, -118, -59, -282, -326,
-  -8, 322, 297, 8, -210, -225, -156, -97, -7, 131, 199, 58,
-  -231, -354, -15, 633, 929, 387, -537, -740, 152, 1069, 730, -564,
-  -1142, -196, 991, 742, -651, -1301, -380, 746, 538, -544, -843, 45,
-  833, 559, -126, -181, 242, 280, -138, -275, 65, 205, -186, -460,
-  -61, 477, 331, -284, -435, 69, 450, 285, 154, 542, 872, 393,
-  -468, -566, 240, 765, 164, -867, -1078, -327, 413, 453, 76, -141,
-  -65, 129, 328, 405, 150, -362, -613, -253, 297, 311, -229, -555,
-  -167, 495, 672, 261, -187, -245, -27, 127, 56, -173, -375, -337,
-  -7, 345, 373, 103, -82, -18, 1, -237, -401, -100, 364, 276,
-  -400, -781, -228, 671, 799, -18, -801, -709, -25, 381, 165, -265,
-  -433, -288, -59, 58, 0, -161, -230, -67, 198, 298, 214, 205,
-  372, 450, 235, -14, 73, 366, 362, -62, -451, -448, -286, -319,
-  -398, -140, 329, 435, -8, -469, -421, -13, 265, 272, 212, 154,
-  15, -52, 214, 613, 548, -88, -567, -259, 412, 515, -67, -526,
-  -352, -8, -64, -280, -115, 262, 226, -199, -286, 184, 439, -96,
-  -750, -503, 426, 772, 38, -762, -560, 258, 506, -68, -516, -132,
-  607, 828, 417, -64, -230, -160, -21, 95, 21, -325, -594, -303,
-  400, 731, 310, -233, -158, 261, 171, -456, -675, -26, 638, 365,
-  -426, -522, 255, 746, 169, -712, -721, 47, 482, 130, -271, -48,
-  423, 412, -28, -239, 8, 283, 244, 62, -25, -84, -194, -171,
-  97, 333, 245, 10, -5, 143, 78, -212, -316, -99, 24, -214,
-  -420, -154, 304, 338, -18, -156, 50, -7, -575, -890, -254, 721,
-  771, -201, -869, -303, 719, 841, 18, -538, -155, 426, 240, -528,
-  -923, -565, -8, 185, 112, 134, 265, 295, 226, 237, 308, 234,
-  11, -94, 35, 134, -68, -422, -550, -369, -164, -130, -111, 76,
-  289, 264, 50, -25, 144, 251, 22, -345, -400, -41, 343, 360,
-  66, -160, -76, 195, 343, 190, -147, -360, -248, 42, 144, -84,
-  -338, -233, 168, 384, 141, -245, -252, 182, 559, 379, -305, -904,
-  -836, -104, 618, 611, -80, -598, -269, 500, 687, 30, -564, -251,
-  551, 737, 61, -570, -412, 140, 267, -91, -325, -178, -38, -201,
-  -396, -277, 50, 262, 286, 242, 133, -62, -157, 15, 240, 173,
-  -94, -135, 108, 186, -92, -232, 203, 767, 630, -206, -788, -456,
-  294, 497, -50, -647, -613, -7, 573, 621, 150, -355, -394, 6,
-  270, -13, -481, -440, 129, 478, 156, -310, -175, 416, 660, 277,
-  -129, -26, 317, 350, 56, -187, -271, -388, -512, -394, -91, 0,
-  -209, -272, 71, 369, 101, -448, -522, -20, 336, 90, -253, -34,
-  515, 597, 53, -375, -99, 513, 691, 260, -283, -499, -417, -247,
-  -95, -24, -112, -262, -208, 77, 209, -107, -538, -478, 64, 366,
-  -21, -573, -451, 292, 697, 171, -678, -807, -65, 665, 632, 80,
-  -218, 45, 484, 653, 536, 373, 276, 188, 80, -7, -62, -102,
-  -104, -62, -86, -286, -534, -529, -199, 133, 140, -55, -47, 240,
-  391, 94, -352, -381, 68, 455, 374, 86, 85, 358, 410, 45,
-  -270, -32, 535, 673, 49, -775, -980, -426, 238, 354, -65, -464,
-  -403, 17, 341, 250, -126, -359, -168, 269, 475, 188, -306, -457,
-  -65, 465, 554, 96, -450, -602, -372, -143, -135, -185, -83, 80,
-  72, -86, -133, 0, 47, -164, -339, -91, 424, 581, 111, -472,
-  -502, -3, 402, 341, 78, -3, 72, 63, -27, 1, 157, 222,
-  98, -74, -174, -223, -197, 5, 265, 218, -203, -468, -74, 619,
-  703, -50, -748, -507, 340, 663, 46, -662, -485, 423, 1014, 641,
-  -250, -750, -516, -7, 162, -90, -318, -161, 213, 353, 135, -92,
-  -24, 164, 123, -98, -131, 100, 223, 24, -169, 1, 316, 287,
-  -65, -237, -52, 90, -78, -231, -70, 65, -254, -653, -367, 481,
-  818, 132, -674, -521, 288, 579, 108, -163, 291, 663, 128, -716,
-  -654, 277, 781, 196, -585, -494, 211, 502, 120, -275, -278, -194,
-  -266, -221, 80, 208, -127, -436, -128, 463, 467, -191, -611, -214,
-  449, 582, 253, 85, 197, 143, -218, -466, -324, -70, -2, 16,
-  187, 346, 290, 204, 317, 375, 2, -555, -660, -284, -118, -455,
-  -645, -131, 547, 481, -191, -454, 38, 485, 255, -145, 19, 462,
-  372, -217, -444, 1, 413, 243, -74, 36, 278, 64, -341, -152,
-  556, 752, -21, -863, -779, -80, 196, -130, -286, 67, 278, -144,
-  -620, -350, 416, 709, 258, -172, 42, 533, 583, 126, -325, -435,
-  -272, 40, 387, 448, -42, -695, -703, 56, 609, 107, -893, -1052,
-  -105, 716, 382, -490, -566, 263, 761, 178, -692, -715, -21, 334,
-  -3, -281, 60, 515, 400, -10, 77, 650, 832, 225, -423, -274,
-  400, 653, 227, -209, -168, -27, -288, -699, -620, -44, 346, 150,
-  -216, -177, 182, 337, 126, -64, 57, 261, 179, -120, -231, 6,
-  261, 150, -251, -474, -222, 253, 421, 96, -304, -240, 268, 602,
-  284, -375, -604, -123, 482, 482, -99, -567, -463, -67, 103, -7,
-  -60, 63, 97, -95, -205, 85, 544, 600, 128, -319, -215, 226,
-  313, -210, -792, -751, -112, 422, 290, -312, -712, -545, -104, 85,
-  -98, -291, -182, 78, 140, 12, 79, 486, 778, 441, -327, -740,
-  -399, 185, 278, -130, -404, -189, 171, 251, 149, 208, 403, 421,
-  247, 209, 369, 307, -234, -809, -783, -224, 155, -32, -377, -354,
-  -84, -41, -238, -199, 263, 697, 656, 339, 248, 405, 358, -55,
-  -363, -121, 395, 505, 46, -397, -266, 234, 421, 11, -562, -732,
-  -458, -165, -152, -290, -294, -113, 82, 180, 240, 324, 372, 323,
-  253, 269, 313, 216, -37, -237, -228, -118, -101, -148, -67, 134,
-  178, -95, -415, -375, 32, 382, 355, 108, -1, 103, 176, 45,
-  -175, -273, -197, -46, 72, 89, -25, -198, -230, 7, 354, 467,
-  205, -184, -332, -153, 108, 178, 18, -211, -339, -297, -118, 82,
-  167, 87, -48, -68, 56, 147, 9, -305, -478, -254, 224, 509,
-  315, -146, -404, -265, 5, 51, -154, -357, -368, -208, 35, 293,
-  437, 322, 21, -138, 54, 389, 488, 304, 144, 174, 183, -32,
-  -277, -221, 88, 251, 71, -193, -230, -94, -58, -190, -301, -228,
-  -15, 194, 279, 161, -119, -330, -232, 101, 305, 181, -58, -120,
-  -38, -24, -64, 29, 184, 77, -320, -536, -233, 246, 310, -33,
-  -209, 60, 383, 357, 154, 140, 214, 26, -318, -326, 64, 275,
-  -34, -373, -125, 460, 568, 30, -400, -129, 434, 498, -25, -518,
-  -565, -328, -69, 203, 436, 350, -119, -495, -291, 285, 550, 231,
-  -257, -467, -434, -377, -256, 49, 353, 369, 200, 217, 438, 415,
-  -95, -687, -798, -413, -1, 110, -26, -259, -496, -553, -236, 264,
-  422, 65, -263, 0, 572, 635, 16, -492, -231, 367, 396, -200,
-  -531, -61, 579, 466, -312, -750, -297, 413, 439, -212, -644, -274,
-  444, 676, 280, -96, 75, 531, 614, 116, -495, -666, -349, 67,
-  253, 202, 87, 16, 4, 71, 249, 493, 634, 502, 113, -259,
-  -288, 49, 374, 273, -206, -549, -353, 176, 444, 149, -401, -659,
-  -404, 105, 422, 295, -146, -476, -350, 95, 310, -23, -529, -563,
-  -95, 188, -165, -648, -434, 417, 918, 445, -376, -469, 259, 813,
-  440, -406, -701, -160, 510, 572, 83, -367, -433, -262, -95, 47,
-  205, 244, -17, -461, -684, -422, 83, 294, -16, -464, -447, 158,
-  790, 799, 191, -351, -239, 351, 718, 467, -74, -332, -177, 42,
-  20, -179, -343, -398, -343, -121, 219, 356, 12, -554, -694, -166,
-  484, 591, 234, 55, 316, 565, 384, 31, 7, 263, 315, 72,
-  15, 395, 710, 379, -343, -608, -103, 508, 436, -274, -900, -926,
-  -479, 23, 301, 260, -69, -458, -530, -133, 409, 587, 284, -109,
-  -178, 51, 234, 166, -12, -51, 86, 226, 221, 96, -44, -158,
-  -260, -319, -264, -133, -84, -192, -306, -239, -74, -74, -257, -297,
-  -10, 245, -26, -675, -923, -320, 586, 857, 312, -302, -282, 238,
-  618, 510, 65, -425, -719, -544, 202, 1049, 1176, 348, -604, -668,
-  95, 597, 120, -795, -1111, -607, 5, 141, -7, 8, 185, 230,
-  143, 196, 356, 206, -377, -814, -463, 462, 1010, 605, -248, -596,
-  -180, 352, 357, -20, -170, 83, 248, -85, -596, -602, 5, 521,
-  293, -427, -760, -283, 469, 682, 215, -338, -415, -40, 378, 548,
-  458, 234, 28, -20, 107, 224, 125, -145, -329, -278, -110, 19,
-  119, 225, 209, -43, -341, -345, -38, 170, -20, -367, -385, 19,
-  436, 496, 283, 134, 191, 299, 267, 96, -39, 36, 299, 459,
-  180, -477, -968, -817, -251, 11, -320, -677, -391, 354, 710, 308,
-  -253, -244, 216, 411, 104, -144, 158, 671, 673, 78, -419, -246,
-  316, 511, 35, -657, -947, -719, -350, -198, -259, -314, -231, -67,
-  76, 155, 164, 95, -21, -101, -96, -78, -146, -240, -179, 71,
-  275, 198, -52, -125, 109, 373, 363, 158, 68, 149, 143, -58,
-  -162, 94, 446, 379, -122, -430, -89, 500, 528, -153, -780, -633,
-  70, 493, 238, -273, -478, -361, -247, -194, 18, 375, 516, 276,
-  23, 163, 491, 424, -149, -626, -489, 6, 214, 0, -157, 67,
-  381, 377, 154, 113, 286, 279, -102, -501, -487, -145, 51, -115,
-  -346, -239, 207, 575, 471, -65, -569, -590, -181, 125, -50, -414,
-  -357, 186, 556, 246, -354, -463, 21, 436, 377, 258, 551, 937,
-  751, 78, -253, 140, 607, 413, -205, -450, -155, 68, -120, -265,
-  68, 486, 331, -250, -429, 88, 582, 331, -358, -615, -228, 145,
-  14, -265, -128, 281, 325, -124, -446, -177, 258, 121, -542, -866,
-  -304, 601, 886, 389, -112, 30, 531, 676, 318, -31, -29, 28,
-  -251, -661, -649, -147, 253, 65, -435, -581, -192, 234, 194, -213,
-  -496, -415, -182, -91, -162, -245, -292, -357, -377, -166, 285, 640,
-  522, 14, -338, -114, 467, 778, 511, -1, -247, -141, -21, -116,
-  -265, -204, 42, 208, 141, -41, -126, -13, 241, 485, 552, 407,
-  225, 222, 350, 291, -107, -520, -471, 45, 490, 413, -41, -377,
-  -369, -204, -90, -12, 81, 79, -103, -272, -150, 220, 449, 263,
-  -167, -455, -429, -219, -13, 126, 195, 189, 148, 148, 182, 137,
-  -11, -96, 18, 167, 60, -290, -502, -334, -56, -97, -403, -465,
-  -56, 355, 176, -494, -942, -739, -253, -118, -418, -675, -526, -123,
-  200, 353, 440, 467, 357, 186, 161, 316, 421, 301, 97, 56,
-  170, 207, 74, -44, 33, 218, 295, 208, 105, 107, 191, 272,
-  281, 149, -171, -560, -736, -529, -122, 113, 39, -112, -79, 84,
-  120, -47, -203, -145, 43, 124, 29, -82, -62, 48, 129, 160,
-  196, 219, 138, -41, -160, -83, 108, 206, 143, 77, 172, 367,
-  441, 302, 108, 68, 162, 154, -93, -393, -401, -35, 355, 326,
-  -141, -571, -508, -47, 277, 123, -265, -396, -132, 197, 266, 142,
-  112, 261, 397, 350, 179, 34, -56, -145, -217, -197, -102, -53,
-  -103, -155, -100, 22, 76, 16, -69, -88, -45, 4, 31, 42,
-  44, 54, 90, 129, 97, -28, -137, -102, 34, 76, -73, -255,
-  -255, -92, -4, -122, -301, -331, -231, -195, -297, -393, -343, -194,
-  -72, 18, 168, 369, 485, 446, 352, 317, 307, 225, 107, 104,
-  253, 383, 324, 119, -42, -65, -37, -71, -161, -214, -183, -102,
-  -25, 23, 38, 24, -18, -93, -198, -293, -313, -233, -117, -42,
-  -7, 49, 140, 206, 218, 241, 333, 425, 404, 281, 183, 167,
-  141, 10, -167, -265, -282, -323, -402, -402, -272, -147, -169, -264,
-  -244, -96, -32, -180, -375, -364, -155, -3, -55, -160, -98, 116,
-  268, 245, 165, 177, 255, 266, 173, 72, 44, 62, 56, 20,
-  -12, -30, -50, -51, 4, 100, 149, 97, 0, -31, 41, 138,
-  159, 78, -38, -103, -81, -9, 38, 21, -21, -13, 60, 126,
-  108, 20, -52, -56, -23, -11, -19, -6, 41, 87, 106, 117,
-  144, 171, 148, 66, -22, -53, -22, 21, 28, -1, -21, -5,
-  29, 44, 30, 25, 65, 140, 208, 238, 239, 238, 241, 239,
-  228, 220, 218, 205, 171, 129, 104, 108, 125, 135, 135, 129,
-  119, 92, 40, -32, -101, -141, -154, -160, -180, -211, -230, -221,
-  -183, -122, -47, 21, 47, 10, -60, -109, -118, -138, -221, -336,
-  -378, -289, -136, -46, -64, -122, -138, -109, -86, -79, -62, -37,
-  -41, -78, -78, 1, 93, 83, -40, -161, -186, -151, -152, -199,
-  -217, -167, -112, -124, -186, -231, -240, -258, -316, -383, -417, -409,
-  -373, -311, -223, -128, -52, 4, 50, 88, 102, 92, 75, 56,
-  30, 8, 18, 71, 134, 164, 162, 158, 158, 144, 110, 78,
-  60, 47, 32, 39, 77, 108, 86, 20, -35, -51, -59, -84,
-  -95, -46, 46, 117, 140, 154, 187, 209, 174, 100, 48, 39,
-  34, 9, 4, 69, 185, 273, 282, 240, 206, 189, 155, 91,
-  27, 4, 14, 18, -2, -24, -17, 11, 22, -5, -46, -62,
-  -36, 6, 25, 0, -59, -122, -157, -153, -124, -97, -85, -77,
-  -57, -18, 37, 100, 156, 181, 162, 127, 124, 168, 213, 210,
-  164, 131, 138, 146, 112, 55, 39, 74, 97, 50, -43, -108,
-  -125, -137, -168, -173, -100, 16, 78, 42, -33, -65, -54, -54,
-  -85, -106, -91, -69, -73, -86, -66, -31, -48, -130, -208, -211,
-  -166, -152, -192, -219, -178, -103, -65, -77, -92, -86, -91, -130,
-  -167, -154, -101, -64, -58, -28, 65, 178, 221, 172, 100, 79,
-  100, 98, 43, -17, -20, 33, 88, 106, 99, 93, 84, 55,
-  15, -7, 0, 8, -8, -32, -41, -43, -75, -142, -198, -206,
-  -185, -175, -187, -191, -174, -163, -184, -217, -226, -210, -203, -220,
-  -241, -251, -257, -266, -254, -194, -112, -67, -83, -120, -129, -109,
-  -99, -119, -152, -173, -175, -161, -133, -102, -91, -104, -110, -83,
-  -40, -29, -63, -104, -117, -111, -113, -114, -83, -25, 10, -6,
-  -35, -25, 10, 17, -22, -52, -24, 37, 69, 57, 47, 77,
-  123, 146, 142, 134, 126, 102, 70, 72, 134, 222, 277, 282,
-  271, 275, 280, 258, 219, 199, 210, 227, 222, 203, 195, 203,
-  203, 174, 134, 119, 141, 174, 189, 188, 189, 200, 206, 200,
-  199, 221, 256, 277, 280, 290, 329, 379, 417, 440, 467, 496,
-  500, 471, 440, 445, 484, 521, 535, 541, 549, 552, 542, 534,
-  545, 560, 556, 542, 551, 591, 621, 604, 553, 516, 514, 528,
-  531, 520, 509, 509, 527, 568, 618, 651, 659, 673, 721, 786,
-  824, 830, 845, 896, 942, 935, 887, 852, 847, 830, 774, 710,
-  675, 651, 594, 505, 437, 404, 355, 250, 123, 35, -23, -117,
-  -264, -403, -478, -519, -592, -694, -766, -793, -828, -906, -982, -1000,
-  -989, -1026, -1117, -1173, -1137, -1071, -1072, -1134, -1162, -1108, -1036, -1024,
-  -1060, -1073, -1048, -1033, -1056, -1075, -1050, -1013, -1019, -1065, -1095, -1083,
-  -1068, -1087, -1122, -1137, -1137, -1155, -1194, -1217, -1208, -1197, -1214, -1248,
-  -1270, -1284, -1316, -1359, -1368, -1323, -1267, -1251, -1267, -1261, -1212, -1159,
-  -1144, -1153, -1136, -1083, -1031, -1011, -1002, -967, -906, -857, -845, -854,
-  -853, -829, -796, -773, -763, -760, -756, -750, -749, -761, -784, -804,
-  -812, -814, -824, -839, -845, -838, -835, -850, -869, -869, -861, -878,
-  -935, -1000, -1038, -1052, -1062, -1072, -1063, -1034, -1013, -1016, -1019, -996,
-  -964, -962, -991, -1010, -986, -936, -891, -856, -810, -746, -680, -624,
-  -576, -526, -477, -426, -360, -277, -192, -118, -42, 54, 160, 251,
-  325, 407, 514, 629, 737, 850, 989, 1145, 1284, 1400, 1517, 1651,
-  1781, 1886, 1991, 2141, 2347, 2577, 2803, 3041, 3313, 3608, 3885, 4115,
-  4313, 4508, 4711, 4912, 5100, 5280, 5476, 5719, 6030, 6406, 6812, 7199,
-  7522, 7754, 7883, 7904, 7814, 7621, 7352, 7064, 6812, 6623, 6475, 6327,
-  6156, 5964, 5751, 5489, 5141, 4701, 4196, 3666, 3141, 2639, 2166, 1723,
-  1302, 889, 479, 74, -324, -712, -1092, -1457, -1801, -2113, -2389, -2630,
-  -2844, -3036, -3218, -3400, -3581, -3747, -3881, -3986, -4090, -4209, -4317, -4367,
-  -4344, -4285, -4235, -4198, -4155, -4106, -4079, -4094, -4139, -4204, -4296, -4403,
-  -4472, -4445, -4334, -4215, -4138, -4070, -3963, -3835, -3754, -3742, -3747, -3717,
-  -3663, -3615, -3549, -3412, -3205, -3000, -2846, -2705, -2513, -2268, -2031, -1828,
-  -1618, -1359, -1073, -809, -570, -332, -106, 65, 185, 331, 568, 856,
-  1107, 1298, 1496, 1752, 2020, 2208, 2290, 2317, 2327, 2310, 2258, 2211,
-  2207, 2217, 2179, 2085, 1994, 1947, 1896, 1769, 1555, 1317, 1102, 894,
-  660, 410, 180, -28, -246, -490, -728, -929, -1112, -1328, -1594, -1872,
-  -2112, -2302, -2474, -2652, -2825, -2967, -3072, -3157, -3236, -3313, -3385, -3467,
-  -3572, -3687, -3769, -3793, -3780, -3770, -3764, -3721, -3623, -3507, -3431, -3406,
-  -3391, -3356, -3315, -3289, -3262, -3200, -3104, -3003, -2908, -2792, -2637, -2479,
-  -2370, -2313, -2260, -2168, -2049, -1937, -1844, -1760, -1675, -1594, -1512, -1421,
-  -1320, -1225, -1150, -1083, -1001, -891, -765, -646, -550, -476, -414, -354,
-  -297, -250, -203, -127, 0, 162, 317, 444, 560, 694, 837, 948,
-  1000, 1019, 1060, 1164, 1331, 1536, 1748, 1945, 2126, 2306, 2506, 2729,
-  2953, 3155, 3333, 3522, 3776, 4123, 4524, 4876, 5088, 5162, 5199, 5302,
-  5488, 5705, 5931, 6217, 6635, 7186, 7788, 8339, 8751, 8964, 8950, 8756,
-  8501, 8292, 8147, 8014, 7881, 7823, 7915, 8128, 8322, 8354, 8168, 7801,
-  7329, 6823, 6329, 5841, 5321, 4759, 4222, 3802, 3504, 3222, 2836, 2330,
-  1781, 1263, 787, 334, -107, -548, -1013, -1496, -1924, -2220, -2407, -2617,
-  -2948, -3353, -3696, -3913, -4068, -4256, -4478, -4660, -4753, -4769, -4741, -4678,
-  -4596, -4553, -4606, -4736, -4847, -4876, -4860, -4887, -4964, -4992, -4873, -4629,
-  -4376, -4197, -4076, -3971, -3890, -3866, -3876, -3852, -3778, -3717, -3708, -3686,
-  -3551, -3306, -3071, -2936, -2856, -2729, -2534, -2329, -2151, -1965, -1735, -1494,
-  -1290, -1113, -918, -697, -496, -336, -173, 52, 341, 659, 979, 1294,
-  1590, 1843, 2059, 2260, 2445, 2577, 2643, 2692, 2782, 2900, 2989, 3030,
-  3069, 3138, 3199, 3191, 3124, 3062, 3028, 2962, 2811, 2600, 2395, 2204,
-  1975, 1683, 1381, 1132, 921, 687, 411, 141, -85, -299, -563, -886,
-  -1219, -1521, -1807, -2107, -2420, -2714, -2972, -3203, -3417, -3608, -3767, -3903,
-  -4032, -4157, -4261, -4335, -4390, -4449, -4527, -4619, -4698, -4737, -4736, -4719,
-  -4706, -4685, -4626, -4522, -4400, -4286, -4179, -4062, -3934, -3815, -3701, -3563,
-  -3388, -3208, -3067, -2958, -2834, -2672, -2506, -2386, -2303, -2202, -2055, -1887,
-  -1733, -1585, -1414, -1229, -1078, -981, -900, -794, -679, -608, -581, -535,
-  -428, -295, -198, -128, -27, 116, 246, 328, 412, 556, 717, 806,
-  821, 870, 1013, 1172, 1242, 1252, 1320, 1469, 1583, 1586, 1555, 1605,
-  1713, 1768, 1768, 1844, 2054, 2268, 2343, 2326, 2387, 2558, 2696, 2705,
-  2697, 2835, 3108, 3366, 3545, 3724, 3951, 4143, 4221, 4276, 4467, 4814,
-  5189, 5526, 5920, 6464, 7074, 7553, 7805, 7889, 7889, 7816, 7674, 7535,
-  7484, 7521, 7586, 7660, 7777, 7929, 8012, 7916, 7620, 7189, 6698, 6191,
-  5697, 5226, 4764, 4297, 3850, 3462, 3117, 2738, 2269, 1738, 1209, 698,
-  183, -328, -792, -1203, -1619, -2072, -2507, -2849, -3112, -3387, -3722, -4055,
-  -4312, -4499, -4678, -4862, -5000, -5057, -5063, -5056, -5021, -4925, -4787, -4689,
-  -4681, -4737, -4788, -4802, -4788, -4753, -4674, -4520, -4285, -3991, -3676, -3387,
-  -3171, -3054, -3028, -3052, -3085, -3105, -3102, -3066, -2985, -2854, -2674, -2461,
-  -2247, -2081, -1991, -1951, -1900, -1795, -1655, -1523, -1409, -1281, -1107, -896,
-  -686, -498, -326, -153, 32, 242, 491, 772, 1053, 1301, 1520, 1736,
-  1961, 2178, 2359, 2493, 2588, 2670, 2768, 2886, 2995, 3054, 3063, 3071,
-  3117, 3179, 3203, 3175, 3128, 3083, 3005, 2855, 2655, 2449, 2235, 1967,
-  1644, 1338, 1106, 912, 681, 402, 138, -83, -316, -624, -986, -1329,
-  -1630, -1930, -2254, -2563, -2815, -3027, -3248, -3483, -3695, -3867, -4025, -4193,
-  -4345, -4448, -4511, -4568, -4634, -4687, -4714, -4732, -4754, -4769, -4759, -4727,
-  -4683, -4620, -4523, -4399, -4278, -4171, -4061, -3929, -3785, -3649, -3513, -3361,
-  -3193, -3026, -2863, -2690, -2508, -2341, -2202, -2075, -1939, -1805, -1693, -1591,
-  -1463, -1307, -1158, -1035, -909, -752, -592, -477, -405, -328, -228, -150,
-  -123, -102, -24, 99, 197, 249, 311, 425, 550, 616, 634, 674,
-  760, 838, 870, 898, 983, 1106, 1193, 1219, 1240, 1302, 1378, 1419,
-  1437, 1482, 1563, 1636, 1677, 1726, 1822, 1944, 2047, 2136, 2268, 2467,
-  2691, 2885, 3040, 3171, 3269, 3319, 3357, 3462, 3675, 3971, 4325, 4757,
-  5297, 5895, 6437, 6832, 7062, 7151, 7118, 6997, 6866, 6813, 6867, 7000,
-  7196, 7464, 7782, 8061, 8189, 8118, 7874, 7505, 7056, 6584, 6149, 5777,
-  5450, 5151, 4894, 4685, 4469, 4163, 3741, 3246, 2727, 2192, 1646, 1128,
-  671, 250, -183, -625, -1019, -1345, -1665, -2046, -2473, -2871, -3209, -3522,
-  -3841, -4134, -4351, -4496, -4604, -4682, -4707, -4682, -4670, -4736, -4874, -5026,
-  -5153, -5258, -5346, -5378, -5301, -5105, -4831, -4534, -4246, -3992, -3809, -3725,
-  -3720, -3741, -3739, -3705, -3642, -3527, -3336, -3080, -2815, -2586, -2400, -2249,
-  -2133, -2055, -1982, -1871, -1714, -1548, -1396, -1239, -1052, -861, -715, -617,
-  -516, -375, -208, -38, 150, 385, 647, 882, 1072, 1253, 1454, 1639,
-  1763, 1840, 1928, 2049, 2167, 2249, 2315, 2400, 2501, 2593, 2671, 2759,
-  2857, 2923, 2923, 2873, 2806, 2726, 2605, 2439, 2264, 2117, 2000, 1893,
-  1786, 1677, 1556, 1400, 1202, 976, 735, 477, 199, -84, -352, -600,
-  -842, -1090, -1348, -1613, -1883, -2148, -2391, -2606, -2804, -2995, -3169, -3311,
-  -3433, -3574, -3752, -3939, -4092, -4207, -4311, -4411, -4476, -4484, -4462, -4452,
-  -4454, -4430, -4375, -4335, -4335, -4328, -4247, -4098, -3959, -3876, -3808, -3691,
-  -3528, -3376, -3260, -3134, -2956, -2746, -2551, -2377, -2187, -1971, -1780, -1659,
-  -1592, -1515, -1391, -1245, -1115, -1003, -874, -703, -513, -346, -223, -123,
-  -22, 73, 132, 154, 183, 260, 364, 430, 446, 471, 564, 693,
-  781, 815, 865, 976, 1092, 1132, 1107, 1099, 1136, 1152, 1098, 1038,
-  1069, 1188, 1291, 1320, 1329, 1384, 1454, 1461, 1406, 1388, 1479, 1642,
-  1809, 1970, 2157, 2358, 2498, 2538, 2520, 2515, 2548, 2621, 2778, 3096,
-  3596, 4199, 4789, 5297, 5709, 6012, 6177, 6197, 6125, 6037, 5988, 6011,
-  6148, 6430, 6829, 7235, 7532, 7678, 7710, 7661, 7510, 7230, 6846, 6441,
-  6084, 5790, 5547, 5348, 5175, 4983, 4722, 4391, 4035, 3676, 3281, 2800,
-  2241, 1671, 1160, 726, 347, -1, -331, -652, -970, -1292, -1627, -1998,
-  -2426, -2897, -3359, -3739, -3991, -4111, -4136, -4117, -4100, -4112, -4168, -4286,
-  -4484, -4754, -5045, -5279, -5393, -5352, -5160, -4859, -4525, -4233, -4017, -3874,
-  -3807, -3836, -3957, -4104, -4181, -4144, -4012, -3811, -3551, -3254, -2981, -2784,
-  -2642, -2501, -2355, -2253, -2213, -2167, -2037, -1839, -1663, -1550, -1448, -1299,
-  -1122, -971, -841, -678, -464, -250, -84, 64, 249, 472, 674, 826,
-  970, 1158, 1380, 1570, 1689, 1757, 1817, 1881, 1939, 1989, 2059, 2177,
-  2341, 2522, 2685, 2812, 2892, 2915, 2864, 2735, 2553, 2370, 2223, 2110,
-  2009, 1918, 1854, 1816, 1761, 1643, 1461, 1258, 1063, 855, 608, 336,
-  89, -121, -338, -608, -918, -1211, -1458, -1687, -1925, -2151, -2317, -2420,
-  -2515, -2653, -2826, -2998, -3173, -3387, -3651, -3903, -4075, -4163, -4218, -4263,
-  -4266, -4194, -4082, -4003, -3989, -4001, -4000, -3998, -4020, -4046, -4022, -3927,
-  -3796, -3663, -3516, -3330, -3128, -2970, -2874, -2797, -2693, -2570, -2461, -2365,
-  -2238, -2054, -1845, -1665, -1526, -1400, -1271, -1159, -1090, -1048, -987, -882,
-  -753, -638, -541, -428, -284, -146, -58, -14, 40, 128, 207, 227,
-  212, 234, 314, 391, 415, 427, 503, 642, 767, 835, 891, 980,
-  1057, 1049, 975, 931, 964, 1012, 1015, 1022, 1113, 1271, 1383, 1388,
-  1351, 1354, 1381, 1369, 1338, 1391, 1585, 1849, 2075, 2240, 2385, 2512,
-  2557, 2496, 2413, 2426, 2587, 2866, 3245, 3750, 4379, 5038, 5580, 5916,
-  6064, 6088, 6034, 5926, 5817, 5795, 5920, 6192, 6561, 6977, 7391, 7730,
-  7905, 7869, 7661, 7367, 7049, 6716, 6367, 6031, 5756, 5554, 5391, 5214,
-  4992, 4716, 4380, 3980, 3521, 3033, 2547, 2073, 1600, 1118, 648, 231,
-  -112, -411, -725, -1084, -1471, -1860, -2260, -2693, -3138, -3530, -3813, -3997,
-  -4116, -4171, -4146, -4071, -4043, -4150, -4385, -4666, -4931, -5168, -5367, -5468,
-  -5404, -5175, -4853, -4514, -4194, -3919, -3733, -3679, -3735, -3824, -3875, -3870,
-  -3818, -3713, -3529, -3273, -2996, -2755, -2563, -2402, -2258, -2132, -2021, -1908,
-  -1781, -1650, -1532, -1427, -1319, -1209, -1114, -1033, -941, -806, -631, -444,
-  -262, -76, 117, 301, 463, 620, 796, 988, 1158, 1289, 1403, 1525,
-  1636, 1694, 1705, 1724, 1796, 1908, 2020, 2131, 2263, 2410, 2519, 2543,
-  2490, 2403, 2293, 2149, 1978, 1821, 1713, 1639, 1561, 1467, 1373, 1280,
-  1164, 1008, 829, 650, 470, 269, 43, -186, -406, -633, -883, -1148,
-  -1398, -1619, -1818, -1996, -2145, -2265, -2379, -2512, -2663, -2810, -2947, -3094,
-  -3269, -3465, -3650, -3803, -3921, -4009, -4066, -4094, -4100, -4080, -4020, -3915,
-  -3792, -3696, -3647, -3625, -3598, -3560, -3526, -3495, -3444, -3350, -3212, -3041,
-  -2838, -2610, -2385, -2203, -2078, -1987, -1898, -1805, -1720, -1640, -1543, -1415,
-  -1262, -1096, -933, -789, -683, -612, -554, -490, -428, -383, -333, -243,
-  -109, 22, 115, 186, 262, 327, 338, 302, 278, 303, 340, 346,
-  348, 412, 542, 657, 700, 710, 751, 811, 822, 767, 712, 711,
-  726, 701, 659, 678, 780, 890, 943, 967, 1025, 1104, 1127, 1062,
-  973, 939, 971, 1029, 1109, 1253, 1484, 1752, 1981, 2136, 2232, 2288,
-  2310, 2310, 2344, 2485, 2782, 3225, 3758, 4320, 4870, 5378, 5791, 6042,
-  6109, 6053, 5985, 5985, 6073, 6252, 6538, 6924, 7340, 7673, 7859, 7910,
-  7850, 7659, 7322, 6899, 6514, 6248, 6074, 5916, 5742, 5569, 5389, 5143,
-  4786, 4338, 3864, 3392, 2896, 2362, 1832, 1373, 1002, 666, 304, -82,
-  -448, -774, -1102, -1486, -1932, -2397, -2840, -3257, -3646, -3970, -4173, -4244,
-  -4232, -4206, -4204, -4230, -4288, -4406, -4608, -4872, -5121, -5266, -5262, -5128,
-  -4919, -4662, -4358, -4033, -3768, -3644, -3649, -3689, -3694, -3676, -3660, -3600,
-  -3419, -3128, -2841, -2639, -2481, -2294, -2102, -2002, -2005, -1990, -1858, -1655,
-  -1495, -1399, -1286, -1113, -948, -856, -801, -699, -547, -416, -329, -221,
-  -37, 181, 355, 478, 612, 791, 982, 1143, 1272, 1386, 1477, 1529,
-  1559, 1599, 1658, 1721, 1790, 1889, 2017, 2137, 2213, 2244, 2242, 2193,
-  2082, 1936, 1808, 1719, 1641, 1557, 1491, 1461, 1433, 1350, 1205, 1040,
-  877, 695, 478, 261, 85, -66, -243, -455, -661, -838, -1026, -1268,
-  -1539, -1778, -1962, -2129, -2304, -2466, -2586, -2688, -2819, -2987, -3154, -3296,
-  -3436, -3600, -3767, -3889, -3943, -3953, -3948, -3932, -3900, -3860, -3828, -3805,
-  -3780, -3745, -3703, -3655, -3586, -3481, -3344, -3194, -3053, -2931, -2824, -2713,
-  -2590, -2458, -2327, -2193, -2040, -1860, -1677, -1519, -1392, -1273, -1153, -1047,
-  -970, -901, -803, -676, -561, -491, -446, -384, -299, -226, -191, -167,
-  -99, 22, 150, 232, 269, 299, 340, 362, 330, 267, 240, 284,
-  361, 409, 426, 470, 565, 653, 670, 632, 617, 659, 706, 707,
-  694, 726, 790, 806, 752, 702, 726, 792, 824, 817, 838, 909,
-  971, 976, 962, 991, 1056, 1106, 1151, 1265, 1468, 1675, 1795, 1834,
-  1863, 1907, 1940, 1978, 2106, 2384, 2785, 3254, 3775, 4340, 4872, 5255,
-  5441, 5490, 5478, 5431, 5373, 5387, 5555, 5871, 6242, 6604, 6964, 7307,
-  7541, 7563, 7382, 7109, 6836, 6560, 6256, 5958, 5730, 5580, 5444, 5264,
-  5042, 4806, 4542, 4203, 3775, 3295, 2822, 2371, 1920, 1451, 986, 561,
-  192, -139, -463, -801, -1156, -1529, -1921, -2325, -2725, -3103, -3440, -3715,
-  -3903, -3995, -4020, -4025, -4047, -4106, -4213, -4382, -4602, -4824, -4992, -5077,
-  -5078, -4989, -4790, -4493, -4163, -3887, -3707, -3606, -3555, -3550, -3585, -3623,
-  -3607, -3504, -3325, -3098, -2836, -2549, -2268, -2035, -1868, -1747, -1639, -1532,
-  -1437, -1355, -1272, -1168, -1043, -914, -791, -667, -536, -396, -256, -118,
-  20, 160, 293, 408, 501, 584, 671, 774, 895, 1025, 1151, 1271,
-  1387, 1493, 1571, 1604, 1604, 1603, 1622, 1656, 1691, 1734, 1801, 1881,
-  1928, 1910, 1834, 1733, 1611, 1457, 1280, 1123, 1016, 940, 856, 760,
-  668, 575, 445, 260, 53, -136, -307, -485, -663, -809, -918, -1040,
-  -1213, -1416, -1595, -1743, -1905, -2100, -2286, -2411, -2488, -2570, -2675, -2775,
-  -2846, -2909, -2994, -3092, -3167, -3208, -3243, -3294, -3349, -3389, -3413, -3427,
-  -3424, -3390, -3328, -3254, -3163, -3035, -2876, -2732, -2641, -2587, -2522, -2434,
-  -2355, -2304, -2247, -2134, -1966, -1791, -1641, -1495, -1329, -1163, -1041, -978,
-  -938, -880, -801, -724, -662, -598, -512, -400, -283, -187, -132, -109,
-  -93, -64, -29, -5, 11, 46, 118, 207, 271, 300, 315, 338,
-  351, 326, 266, 221, 230, 283, 329, 344, 354, 395, 459, 496,
-  483, 449, 444, 469, 485, 474, 471, 512, 571, 589, 559, 533,
-  551, 583, 580, 547, 529, 539, 541, 518, 514, 565, 643, 697,
-  738, 819, 945, 1048, 1076, 1060, 1065, 1106, 1164, 1267, 1486, 1843,
-  2276, 2711, 3140, 3579, 3985, 4272, 4421, 4501, 4587, 4695, 4824, 5021,
-  5338, 5746, 6150, 6484, 6765, 7017, 7200, 7249, 7174, 7057, 6964, 6883,
-  6773, 6637, 6517, 6419, 6295, 6092, 5817, 5519, 5222, 4899, 4513, 4072,
-  3627, 3217, 2833, 2446, 2054, 1686, 1359, 1041, 680, 259, -200, -679,
-  -1180, -1704, -2212, -2642, -2959, -3168, -3294, -3362, -3408, -3481, -3620, -3832,
-  -4102, -4410, -4728, -5008, -5193, -5250, -5190, -5045, -4837, -4594, -4364, -4201,
-  -4119, -4085, -4056, -4016, -3968, -3902, -3789, -3611, -3388, -3157, -2939, -2736,
-  -2547, -2378, -2231, -2091, -1938, -1770, -1611, -1482, -1377, -1271, -1146, -1015,
-  -902, -807, -707, -588, -467, -372, -306, -245, -173, -106, -56, 6,
-  129, 319, 517, 664, 761, 856, 961, 1031, 1025, 974, 952, 989,
-  1055, 1118, 1197, 1323, 1473, 1582, 1615, 1598, 1578, 1554, 1488, 1368,
-  1226, 1107, 1022, 950, 870, 785, 706, 640, 579, 508, 417, 311,
-  196, 66, -94, -289, -493, -678, -847, -1023, -1206, -1369, -1488, -1587,
-  -1704, -1847, -1989, -2119, -2260, -2430, -2604, -2740, -2832, -2913, -3001, -3071,
-  -3101, -3114, -3150, -3214, -3277, -3313, -3332, -3348, -3353, -3319, -3242, -3140,
-  -3033, -2929, -2826, -2728, -2635, -2545, -2460, -2383, -2308, -2208, -2071, -1911,
-  -1755, -1606, -1441, -1253, -1073, -934, -830, -733, -632, -551, -510, -485,
-  -435, -346, -245, -160, -83, 6, 111, 206, 267, 289, 284, 267,
-  250, 242, 245, 250, 256, 276, 322, 374, 399, 395, 395, 420,
-  437, 402, 336, 308, 344, 377, 336, 253, 224, 277, 333, 317,
-  271, 284, 354, 385, 327, 256, 256, 299, 293, 225, 185, 233,
-  309, 318, 264, 222, 216, 200, 149, 124, 190, 320, 441, 527,
-  619, 732, 818, 842, 842, 887, 1003, 1184, 1446, 1830, 2325, 2845,
-  3304, 3679, 3990, 4232, 4388, 4482, 4580, 4732, 4940, 5204, 5555, 6006,
-  6488, 6884, 7138, 7285, 7372, 7389, 7302, 7133, 6959, 6822, 6702, 6569,
-  6446, 6365, 6297, 6163, 5922, 5614, 5298, 4974, 4594, 4138, 3643, 3161,
-  2712, 2291, 1893, 1522, 1164, 799, 411, 0, -438, -912, -1410, -1894,
-  -2325, -2686, -2970, -3165, -3266, -3312, -3373, -3501, -3688, -3902, -4135, -4397,
-  -4665, -4865, -4929, -4857, -4698, -4501, -4283, -4058, -3864, -3741, -3694, -3689,
-  -3686, -3666, -3627, -3555, -3433, -3259, -3061, -2869, -2697, -2537, -2375, -2207,
-  -2047, -1911, -1803, -1712, -1618, -1519, -1428, -1359, -1296, -1203, -1068, -914,
-  -776, -660, -548, -446, -381, -357, -323, -218, -47, 133, 295, 480,
-  721, 965, 1109, 1125, 1091, 1089, 1110, 1101, 1078, 1125, 1277, 1455,
-  1560, 1593, 1628, 1684, 1685, 1569, 1392, 1265, 1222, 1191, 1102, 976,
-  879, 812, 710, 535, 330, 165, 48, -71, -224, -383, -505, -598,
-  -720, -912, -1147, -1366, -1544, -1707, -1881, -2051, -2173, -2241, -2300, -2392,
-  -2507, -2604, -2672, -2749, -2863, -2986, -3066, -3092, -3105, -3135, -3160, -3148,
-  -3101, -3059, -3041, -3023, -2978, -2915, -2866, -2836, -2797, -2727, -2630, -2528,
-  -2426, -2316, -2189, -2051, -1911, -1781, -1667, -1568, -1471, -1374, -1286, -1217,
-  -1155, -1076, -977, -877, -794, -715, -614, -493, -383, -302, -235, -163,
-  -91, -44, -21, 2, 39, 80, 105, 120, 138, 165, 190, 205,
-  214, 221, 224, 223, 230, 251, 273, 275, 261, 249, 245, 227,
-  177, 112, 63, 40, 14, -35, -85, -95, -63, -29, -23, -24,
-  6, 58, 89, 77, 57, 59, 62, 21, -53, -92, -60, 2,
-  37, 50, 88, 155, 196, 178, 140, 130, 138, 133, 137, 220,
-  390, 566, 670, 714, 751, 784, 775, 746, 792, 978, 1279, 1646,
-  2089, 2640, 3243, 3764, 4116, 4333, 4492, 4621, 4713, 4811, 5003, 5330,
-  5740, 6165, 6599, 7051, 7470, 7756, 7861, 7842, 7787, 7731, 7649, 7532,
-  7409, 7313, 7230, 7115, 6942, 6720, 6471, 6185, 5830, 5401, 4947, 4529,
-  4154, 3768, 3333, 2883, 2485, 2141, 1773, 1320, 811, 311, -176, -708,
-  -1296, -1855, -2294, -2616, -2889, -3135, -3306, -3379, -3424, -3542, -3757, -4014,
-  -4265, -4514, -4767, -4984, -5101, -5097, -5000, -4851, -4670, -4472, -4286, -4140,
-  -4040, -3968, -3906, -3839, -3753, -3636, -3486, -3313, -3128, -2943, -2768, -2616,
-  -2489, -2380, -2275, -2162, -2038, -1904, -1762, -1610, -1446, -1274, -1110, -971,
-  -861, -768, -682, -607, -551, -507, -453, -370, -257, -121, 38, 222,
-  422, 623, 812, 980, 1111, 1190, 1219, 1225, 1232, 1238, 1233, 1233,
-  1269, 1345, 1430, 1496, 1547, 1596, 1625, 1599, 1514, 1413, 1331, 1249,
-  1125, 962, 810, 698, 597, 455, 272, 94, -53, -189, -347, -519,
-  -676, -814, -960, -1131, -1314, -1486, -1649, -1822, -2009, -2193, -2358, -2502,
-  -2631, -2751, -2858, -2946, -3011, -3046, -3056, -3054, -3049, -3040, -3026, -3020,
-  -3033, -3062, -3085, -3091, -3087, -3070, -3021, -2920, -2779, -2627, -2474, -2310,
-  -2144, -2008, -1923, -1866, -1801, -1729, -1678, -1646, -1590, -1480, -1341, -1214,
-  -1097, -957, -796, -666, -599, -562, -497, -400, -322, -288, -259, -184,
-  -69, 31, 86, 116, 151, 184, 191, 173, 166, 196, 253, 307,
-  345, 377, 420, 466, 486, 449, 363, 267, 205, 176, 142, 85,
-  40, 55, 117, 154, 124, 69, 52, 63, 27, -79, -179, -198,
-  -173, -201, -300, -374, -352, -299, -328, -431, -488, -431, -338, -325,
-  -380, -398, -348, -319, -382, -474, -485, -423, -399, -460, -510, -455,
-  -347, -315, -380, -419, -331, -165, -33, 58, 199, 411, 583, 611,
-  547, 532, 609, 696, 750, 888, 1268, 1874, 2513, 3033, 3468, 3928,
-  4390, 4704, 4805, 4831, 4973, 5264, 5584, 5866, 6194, 6655, 7162, 7517,
-  7652, 7704, 7817, 7944, 7930, 7754, 7585, 7563, 7614, 7552, 7323, 7056,
-  6853, 6648, 6317, 5869, 5437, 5083, 4721, 4258, 3740, 3302, 2983, 2689,
-  2328, 1925, 1553, 1209, 803, 275, -339, -963, -1559, -2118, -2605, -2955,
-  -3135, -3187, -3191, -3213, -3279, -3397, -3582, -3846, -4178, -4519, -4794, -4949,
-  -4983, -4927, -4811, -4655, -4489, -4360, -4297, -4277, -4254, -4208, -4151, -4085,
-  -3976, -3794, -3569, -3365, -3217, -3099, -2980, -2865, -2781, -2721, -2637, -2498,
-  -2322, -2141, -1962, -1763, -1540, -1314, -1107, -917, -736, -575, -447, -354,
-  -277, -199, -115, -15, 115, 286, 491, 721, 976, 1240, 1468, 1615,
-  1684, 1724, 1771, 1800, 1776, 1723, 1708, 1754, 1805, 1801, 1759, 1737,
-  1734, 1683, 1550, 1401, 1316, 1278, 1199, 1040, 866, 740, 623, 432,
-  163, -95, -284, -448, -649, -867, -1030, -1124, -1220, -1374, -1556, -1712,
-  -1853, -2026, -2233, -2418, -2554, -2675, -2816, -2953, -3039, -3080, -3132, -3216,
-  -3295, -3330, -3337, -3349, -3359, -3327, -3247, -3155, -3081, -3012, -2927, -2833,
-  -2763, -2728, -2705, -2661, -2579, -2463, -2330, -2194, -2054, -1891, -1698, -1510,
-  -1374, -1297, -1229, -1136, -1039, -984, -959, -908, -814, -725, -684, -655,
-  -566, -415, -272, -184, -120, -29, 76, 134, 119, 71, 42, 40,
-  52, 81, 144, 237, 330, 398, 437, 443, 414, 362, 314, 285,
-  264, 242, 235, 268, 323, 347, 312, 246, 191, 144, 70, -35,
-  -131, -174, -174, -174, -196, -220, -226, -224, -246, -308, -390, -463,
-  -516, -567, -636, -710, -756, -757, -745, -760, -796, -807, -771, -729,
-  -734, -772, -780, -733, -685, -686, -703, -662, -560, -467, -429, -400,
-  -323, -218, -159, -153, -130, -40, 76, 164, 255, 425, 667, 881,
-  990, 1028, 1072, 1123, 1132, 1113, 1174, 1407, 1792, 2251, 2754, 3319,
-  3918, 4442, 4803, 5021, 5186, 5346, 5493, 5642, 5860, 6202, 6629, 7045,
-  7395, 7684, 7917, 8064, 8098, 8051, 7981, 7919, 7857, 7799, 7759, 7713,
-  7599, 7375, 7076, 6754, 6406, 5983, 5485, 4989, 4550, 4137, 3689, 3224,
-  2825, 2514, 2212, 1840, 1421, 1024, 636, 156, -465, -1144, -1757, -2275,
-  -2747, -3174, -3469, -3572, -3548, -3534, -3599, -3709, -3823, -3970, -4196, -4478,
-  -4726, -4871, -4920, -4911, -4860, -4761, -4633, -4519, -4450, -4415, -4378, -4316,
-  -4226, -4104, -3939, -3727, -3483, -3237, -3017, -2837, -2700, -2601, -2533, -2482,
-  -2428, -2350, -2233, -2073, -1872, -1640, -1392, -1145, -911, -687, -472, -276,
-  -117, 6, 119, 242, 372, 486, 582, 684, 816, 975, 1143, 1311,
-  1480, 1649, 1808, 1944, 2053, 2124, 2149, 2136, 2111, 2085, 2044, 1972,
-  1882, 1799, 1716, 1604, 1459, 1322, 1221, 1127, 996, 842, 720, 631,
-  498, 257, -52, -340, -588, -856, -1175, -1479, -1688, -1822, -1963, -2142,
-  -2307, -2422, -2531, -2696, -2895, -3050, -3133, -3204, -3309, -3422, -3487, -3510,
-  -3550, -3627, -3695, -3710, -3685, -3660, -3630, -3558, -3433, -3296, -3182, -3077,
-  -2949, -2799, -2662, -2557, -2459, -2341, -2206, -2078, -1963, -1841, -1697, -1538,
-  -1382, -1236, -1090, -934, -778, -643, -535, -441, -338, -228, -141, -100,
-  -92, -83, -58, -41, -51, -64, -39, 28, 103, 163, 230, 320,
-  399, 416, 375, 331, 319, 302, 237, 149, 112, 142, 182, 183,
-  175, 209, 266, 274, 215, 154, 140, 132, 62, -55, -126, -112,
-  -88, -136, -233, -290, -287, -306, -406, -534, -596, -587, -588, -641,
-  -688, -664, -603, -596, -676, -779, -835, -861, -917, -1013, -1087, -1088,
-  -1039, -1002, -1002, -1005, -970, -907, -861, -855, -855, -809, -715, -631,
-  -601, -600, -567, -492, -429, -416, -408, -335, -202, -94, -58, -36,
-  52, 192, 300, 347, 407, 545, 717, 827, 854, 863, 898, 914,
-  876, 858, 994, 1327, 1776, 2252, 2765, 3363, 3997, 4530, 4875, 5076,
-  5233, 5387, 5518, 5656, 5885, 6251, 6686, 7081, 7410, 7725, 8036, 8258,
-  8312, 8240, 8171, 8169, 8177, 8110, 7970, 7812, 7645, 7402, 7039, 6592,
-  6128, 5658, 5149, 4612, 4124, 3741, 3422, 3080, 2696, 2332, 2033, 1754,
-  1402, 946, 437, -73, -592, -1148, -1721, -2241, -2659, -2982, -3226, -3375,
-  -3412, -3378, -3365, -3428, -3547, -3673, -3798, -3954, -4141, -4301, -4373, -4355,
-  -4295, -4233, -4170, -4106, -4052, -4021, -3996, -3945, -3851, -3717, -3550, -3348,
-  -3118, -2888, -2696, -2564, -2495, -2475, -2483, -2494, -2486, -2448, -2373, -2247,
-  -2055, -1802, -1525, -1266, -1028, -793, -553, -335, -158, -6, 151, 310,
-  446, 552, 663, 809, 969, 1109, 1236, 1399, 1617, 1847, 2036, 2182,
-  2318, 2442, 2519, 2533, 2514, 2491, 2442, 2331, 2169, 2005, 1855, 1683,
-  1454, 1198, 971, 790, 627, 457, 289, 133, -39, -264, -544, -850,
-  -1165, -1500, -1860, -2216, -2523, -2765, -2959, -3135, -3304, -3456, -3577, -3668,
-  -3740, -3804, -3849, -3858, -3827, -3778, -3743, -3726, -3709, -3691, -3693, -3720,
-  -3737, -3692, -3576, -3424, -3265, -3081, -2853, -2601, -2375, -2196, -2039, -1879,
-  -1734, -1627, -1542, -1435, -1295, -1153, -1042, -945, -825, -675, -521, -382,
-  -251, -122, -4, 93, 179, 267, 343, 382, 386, 383, 393, 405,
-  405, 400, 407, 418, 414, 399, 395, 409, 413, 385, 341, 315,
-  313, 309, 289, 263, 239, 202, 131, 37, -49, -117, -182, -252,
-  -309, -327, -313, -296, -299, -328, -381, -456, -546, -636, -720, -805,
-  -892, -960, -994, -1005, -1017, -1040, -1059, -1070, -1089, -1129, -1168, -1185,
-  -1198, -1245, -1325, -1381, -1374, -1341, -1345, -1384, -1382, -1305, -1212, -1176,
-  -1181, -1142, -1041, -958, -955, -978, -932, -818, -726, -700, -663, -536,
-  -360, -243, -205, -155, -28, 114, 182, 198, 272, 443, 624, 724,
-  760, 811, 885, 915, 863, 793, 787, 854, 941, 1022, 1119, 1230,
-  1300, 1274, 1164, 1029, 910, 823, 804, 929, 1251, 1742, 2316, 2892,
-  3431, 3903, 4277, 4540, 4719, 4866, 5022, 5224, 5516, 5928, 6427, 6921,
-  7326, 7622, 7846, 8023, 8149, 8214, 8236, 8245, 8255, 8257, 8231, 8143,
-  7951, 7631, 7212, 6761, 6324, 5899, 5458, 4993, 4521, 4052, 3586, 3130,
-  2696, 2283, 1879, 1483, 1117, 778, 413, -51, -631, -1271, -1897, -2468,
-  -2955, -3314, -3507, -3550, -3514, -3461, -3412, -3380, -3402, -3509, -3673, -3814,
-  -3872, -3853, -3793, -3711, -3613, -3527, -3498, -3540, -3612, -3655, -3643, -3586,
-  -3485, -3324, -3092, -2824, -2584, -2420, -2332, -2289, -2261, -2246, -2251, -2272,
-  -2285, -2272, -2240, -2208, -2177, -2121, -2014, -1858, -1663, -1420, -1112, -761,
-  -437, -190, -9, 160, 331, 469, 549, 609, 719, 904, 1123, 1337,
-  1542, 1760, 1986, 2194, 2374, 2539, 2695, 2815, 2867, 2847, 2779, 2676,
-  2526, 2317, 2064, 1802, 1554, 1317, 1075, 824, 570, 318, 62, -205,
-  -480, -755, -1024, -1294, -1573, -1868, -2184, -2521, -2870, -3218, -3544, -3834,
-  -4078, -4270, -4398, -4456, -4454, -4412, -4351, -4275, -4183, -4077, -3962, -3849,
-  -3743, -3648, -3563, -3483, -3396, -3297, -3185, -3058, -2908, -2725, -2510, -2274,
-  -2030, -1794, -1577, -1382, -1204, -1030, -860, -703, -573, -466, -373, -292,
-  -235, -204, -188, -169, -133, -72, 19, 147, 302, 458, 588, 685,
-  749, 782, 773, 723, 647, 571, 510, 467, 435, 409, 394, 389,
-  390, 384, 367, 344, 320, 292, 247, 185, 121, 66, 8, -68,
-  -156, -225, -269, -318, -399, -496, -567, -603, -641, -706, -767, -779,
-  -751, -735, -760, -796, -818, -848, -927, -1044, -1147, -1212, -1267, -1338,
-  -1397, -1401, -1358, -1315, -1297, -1278, -1233, -1182, -1160, -1168, -1181, -1190,
-  -1206, -1227, -1229, -1202, -1160, -1108, -1023, -892, -752, -649, -579, -498,
-  -393, -312, -286, -274, -217, -120, -38, 18, 101, 237, 366, 421,
-  431, 479, 573, 628, 591, 537, 571, 681, 759, 754, 736, 773,
-  816, 767, 629, 504, 453, 429, 376, 340, 397, 518, 572, 492,
-  349, 244, 171, 67, -31, 33, 375, 944, 1597, 2253, 2912, 3553,
-  4080, 4426, 4634, 4812, 5014, 5237, 5509, 5908, 6459, 7059, 7553, 7880,
-  8104, 8295, 8438, 8482, 8435, 8370, 8335, 8308, 8238, 8101, 7890, 7586,
-  7173, 6682, 6182, 5707, 5224, 4681, 4073, 3455, 2879, 2358, 1883, 1454,
-  1092, 807, 579, 360, 91, -278, -768, -1353, -1972, -2546, -3006, -3306,
-  -3435, -3413, -3287, -3118, -2961, -2858, -2835, -2895, -3009, -3124, -3183, -3157,
-  -3062, -2941, -2836, -2773, -2769, -2832, -2955, -3107, -3241, -3328, -3361, -3339,
-  -3252, -3100, -2923, -2783, -2706, -2662, -2609, -2540, -2487, -2468, -2468, -2463,
-  -2446, -2417, -2370, -2288, -2163, -1984, -1732, -1395, -992, -570, -173, 185,
-  498, 764, 991, 1201, 1409, 1608, 1792, 1977, 2189, 2412, 2593, 2695,
-  2746, 2793, 2843, 2866, 2853, 2832, 2827, 2809, 2735, 2593, 2404, 2170,
-  1873, 1505, 1095, 680, 270, -145, -563, -964, -1328, -1652, -1944, -2206,
-  -2441, -2653, -2844, -3017, -3185, -3369, -3579, -3795, -3991, -4155, -4291, -4395,
-  -4445, -4430, -4369, -4288, -4193, -4072, -3927, -3788, -3672, -3555, -3400, -3203,
-  -3005, -2846, -2718, -2589, -2455, -2345, -2278, -2228, -2153, -2040, -1906, -1757,
-  -1576, -1361, -1147, -966, -812, -651, -478, -327, -220, -135, -40, 64,
-  146, 194, 226, 255, 280, 308, 364, 459, 571, 672, 769, 887,
-  1016, 1108, 1140, 1140, 1138, 1123, 1061, 958, 861, 786, 699, 566,
-  416, 299, 222, 135, 9, -125, -224, -297, -390, -521, -655, -761,
-  -855, -975, -1122, -1250, -1327, -1377, -1442, -1523, -1580, -1588, -1574, -1580,
-  -1612, -1632, -1611, -1561, -1507, -1444, -1345, -1211, -1075, -971, -897, -837,
-  -799, -802, -841, -874, -864, -813, -743, -653, -527, -366, -213, -106,
-  -43, 2, 32, 28, -11, -52, -69, -77, -97, -116, -95, -36,
-  11, 19, 26, 85, 173, 213, 181, 139, 149, 183, 176, 130,
-  119, 174, 236, 246, 227, 236, 257, 215, 98, -9, -37, -21,
-  -28, -38, 22, 156, 268, 287, 242, 190, 121, -7, -169, -288,
-  -338, -362, -388, -386, -360, -392, -548, -762, -887, -865, -747, -546,
-  -155, 514, 1385, 2273, 3077, 3808, 4460, 4943, 5222, 5427, 5729, 6143,
-  6545, 6895, 7317, 7907, 8547, 9003, 9198, 9277, 9392, 9519, 9545, 9458,
-  9356, 9275, 9126, 8825, 8423, 8018, 7589, 7018, 6269, 5476, 4789, 4186,
-  3524, 2747, 1977, 1368, 939, 598, 285, 20, -192, -421, -747, -1166,
-  -1624, -2096, -2605, -3130, -3565, -3806, -3849, -3785, -3699, -3614, -3513, -3394,
-  -3277, -3178, -3101, -3038, -2971, -2879, -2756, -2626, -2534, -2517, -2582, -2716,
-  -2895, -3088, -3274, -3452, -3626, -3778, -3863, -3846, -3737, -3584, -3430, -3287,
-  -3150, -3016, -2890, -2781, -2700, -2650, -2610, -2536, -2392, -2181, -1928, -1642,
-  -1305, -901, -439, 65, 605, 1167, 1717, 2214, 2653, 3059, 3435, 3746,
-  3955, 4079, 4169, 4249, 4289, 4251, 4141, 3992, 3821, 3616, 3374, 3120,
-  2877, 2637, 2369, 2063, 1740, 1407, 1030, 567, 22, -551, -1111, -1666,
-  -2237, -2806, -3321, -3743, -4072, -4317, -4471, -4535, -4543, -4540, -4530, -4487,
-  -4412, -4353, -4344, -4356, -4325, -4231, -4109, -3990, -3871, -3738, -3604, -3478,
-  -3334, -3145, -2937, -2767, -2646, -2523, -2354, -2170, -2040, -1981, -1945, -1893,
-  -1835, -1795, -1766, -1734, -1713, -1727, -1752, -1726, -1624, -1483, -1347, -1200,
-  -994, -718, -425, -166, 52, 246, 417, 559, 687, 830, 994, 1152,
-  1292, 1436, 1608, 1793, 1946, 2044, 2106, 2154, 2181, 2176, 2137, 2074,
-  1980, 1837, 1649, 1440, 1222, 976, 683, 361, 49, -238, -516, -798,
-  -1071, -1314, -1530, -1730, -1913, -2063, -2183, -2295, -2409, -2500, -2540, -2543,
-  -2552, -2578, -2582, -2522, -2406, -2274, -2147, -2010, -1848, -1672, -1502, -1339,
-  -1176, -1022, -893, -780, -643, -458, -264, -132, -82, -59, -1, 84,
-  136, 130, 104, 111, 154, 199, 234, 271, 298, 275, 201, 142,
-  155, 197, 173, 67, -20, -1, 84, 127, 102, 94, 160, 249,
-  285, 284, 312, 358, 335, 222, 122, 121, 159, 110, -29, -121,
-  -86, -22, -68, -207, -297, -276, -243, -299, -400, -430, -383, -359,
-  -410, -451, -400, -303, -276, -333, -367, -316, -259, -304, -423, -479,
-  -399, -263, -183, -168, -143, -82, -54, -120, -233, -266, -119, 229,
-  767, 1496, 2403, 3419, 4423, 5312, 6044, 6628, 7074, 7390, 7618, 7850,
-  8182, 8628, 9088, 9444, 9666, 9812, 9923, 9937, 9766, 9429, 9053, 8743,
-  8473, 8152, 7751, 7318, 6873, 6358, 5733, 5046, 4356, 3628, 2766, 1776,
-  807, 2, -644, -1225, -1737, -2057, -2112, -1998, -1887, -1863, -1904, -1999,
-  -2194, -2494, -2806, -3018, -3110, -3136, -3109, -2987, -2769, -2552, -2447, -2472,
-  -2558, -2649, -2737, -2813, -2840, -2789, -2692, -2606, -2559, -2556, -2625, -2811,
-  -3122, -3497, -3859, -4177, -4446, -4642, -4725, -4691, -4570, -4383, -4112, -3745,
-  -3323, -2907, -2513, -2099, -1640, -1171, -739, -334, 96, 577, 1078, 1561,
-  2018, 2458, 2865, 3211, 3495, 3751, 4001, 4233, 4437, 4635, 4849, 5055,
-  5184, 5185, 5046, 4778, 4383, 3874, 3284, 2648, 1984, 1305, 658, 90,
-  -407, -899, -1423, -1933, -2357, -2693, -2994, -3290, -3551, -3749, -3914, -4080,
-  -4224, -4298, -4310, -4323, -4360, -4360, -4266, -4117, -3998, -3933, -3857, -3699,
-  -3454, -3158, -2841, -2523, -2240, -2023, -1864, -1751, -1708, -1772, -1929, -2106,
-  -2246, -2363, -2485, -2612, -2730, -2860, -3023, -3168, -3211, -3152, -3086, -3071,
-  -3026, -2834, -2514, -2210, -2004, -1822, -1557, -1226, -920, -654, -350, 22,
-  387, 674, 935, 1259, 1629, 1936, 2138, 2328, 2603, 2925, 3170, 3288,
-  3331, 3343, 3287, 3109, 2833, 2525, 2210, 1859, 1458, 1040, 636, 224,
-  -224, -683, -1097, -1440, -1737, -2013, -2256, -2449, -2608, -2768, -2935, -3079,
-  -3178, -3238, -3269, -3255, -3180, -3050, -2897, -2734, -2545, -2310, -2039, -1761,
-  -1488, -1209, -913, -614, -337, -98, 110, 293, 446, 559, 634, 680,
-  703, 696, 650, 569, 468, 358, 239, 115, -1, -89, -134, -134,
-  -103, -61, -22, 12, 50, 93, 129, 146, 149, 156, 174, 186,
-  182, 176, 193, 238, 294, 353, 432, 539, 653, 742, 802, 860,
-  919, 951, 931, 875, 808, 717, 557, 312, 31, -226, -448, -661,
-  -877, -1076, -1237, -1367, -1479, -1575, -1652, -1726, -1816, -1901, -1937, -1904,
-  -1840, -1800, -1794, -1777, -1700, -1558, -1383, -1206, -1034, -847, -618, -345,
-  -60, 189, 375, 517, 659, 831, 1031, 1227, 1376, 1443, 1422, 1352,
-  1272, 1182, 1051, 916, 920, 1224, 1859, 2697, 3595, 4502, 5418, 6282,
-  6995, 7527, 7952, 8336, 8669, 8949, 9270, 9711, 10175, 10432, 10378, 10159,
-  9968, 9791, 9461, 8943, 8420, 8049, 7760, 7391, 6931, 6492, 6078, 5534,
-  4790, 3994, 3306, 2643, 1788, 736, -249, -961, -1487, -2022, -2547, -2858,
-  -2887, -2809, -2804, -2840, -2806, -2735, -2759, -2867, -2884, -2714, -2478, -2342,
-  -2294, -2209, -2087, -2075, -2262, -2554, -2818, -3030, -3233, -3399, -3449, -3396,
-  -3350, -3370, -3402, -3398, -3424, -3576, -3822, -4045, -4196, -4336, -4493, -4587,
-  -4542, -4413, -4301, -4193, -3971, -3588, -3141, -2721, -2268, -1660, -891, -87,
-  663, 1399, 2170, 2915, 3521, 3974, 4359, 4725, 5007, 5139, 5163, 5185,
-  5235, 5242, 5146, 4983, 4816, 4648, 4414, 4080, 3669, 3210, 2692, 2099,
-  1458, 824, 207, -433, -1117, -1804, -2439, -3014, -3562, -4084, -4520, -4813,
-  -4970, -5031, -5009, -4889, -4685, -4459, -4248, -4010, -3693, -3326, -3009, -2788,
-  -2602, -2380, -2158, -2042, -2057, -2099, -2072, -1999, -1966, -1986, -1989, -1948,
-  -1937, -2021, -2161, -2266, -2328, -2436, -2641, -2879, -3059, -3191, -3360, -3598,
-  -3826, -3944, -3938, -3861, -3744, -3558, -3272, -2907, -2515, -2120, -1698, -1219,
-  -690, -157, 345, 820, 1286, 1731, 2105, 2369, 2544, 2682, 2805, 2897,
-  2951, 2996, 3051, 3089, 3066, 2976, 2855, 2707, 2493, 2183, 1810, 1428,
-  1048, 639, 189, -286, -774, -1286, -1807, -2284, -2677, -2998, -3264, -3443,
-  -3486, -3412, -3304, -3209, -3092, -2905, -2681, -2488, -2334, -2159, -1935, -1712,
-  -1544, -1412, -1267, -1105, -960, -831, -671, -461, -252, -99, 14, 139,
-  280, 381, 402, 369, 331, 296, 231, 119, -27, -189, -358, -520,
-  -641, -696, -688, -634, -526, -350, -121, 110, 300, 453, 598, 747,
-  883, 993, 1090, 1202, 1331, 1449, 1525, 1549, 1539, 1522, 1513, 1506,
-  1485, 1445, 1396, 1340, 1267, 1166, 1041, 901, 726, 492, 215, -51,
-  -295, -589, -996, -1460, -1837, -2060, -2204, -2360, -2490, -2485, -2355, -2242,
-  -2224, -2211, -2101, -1956, -1915, -1956, -1885, -1608, -1286, -1124, -1096, -1004,
-  -782, -579, -516, -503, -391, -213, -111, -71, 83, 420, 749, 861,
-  827, 898, 1153, 1387, 1375, 1147, 911, 795, 771, 779, 806, 819,
-  749, 604, 502, 528, 592, 547, 443, 563, 1162, 2219, 3489, 4736,
-  5865, 6865, 7744, 8519, 9197, 9718, 10000, 10101, 10259, 10667, 11198, 11478,
-  11260, 10677, 10046, 9508, 8950, 8249, 7456, 6696, 6007, 5358, 4760, 4226,
-  3665, 2933, 2054, 1263, 738, 349, -208, -1033, -1904, -2542, -2905, -3140,
-  -3319, -3361, -3192, -2869, -2504, -2149, -1826, -1598, -1515, -1500, -1385, -1101,
-  -762, -530, -441, -425, -468, -654, -1041, -1561, -2089, -2573, -3022, -3423,
-  -3730, -3952, -4175, -4458, -4748, -4959, -5091, -5219, -5364, -5446, -5390, -5234,
-  -5068, -4900, -4644, -4253, -3788, -3332, -2880, -2358, -1743, -1089, -425, 296,
-  1139, 2084, 3033, 3910, 4698, 5384, 5913, 6221, 6316, 6270, 6143, 5941,
-  5648, 5272, 4836, 4339, 3755, 3079, 2351, 1629, 942, 284, -342, -913,
-  -1412, -1854, -2271, -2665, -3014, -3303, -3538, -3734, -3886, -3987, -4051, -4101,
-  -4128, -4084, -3923, -3652, -3312, -2929, -2504, -2046, -1595, -1207, -910, -691,
-  -526, -409, -349, -352, -414, -536, -743, -1068, -1517, -2040, -2565, -3054,
-  -3517, -3957, -4320, -4538, -4612, -4621, -4629, -4612, -4512, -4338, -4153, -3977,
-  -3748, -3414, -3031, -2694, -2402, -2058, -1612, -1141, -743, -397, 9, 509,
-  1003, 1393, 1715, 2066, 2454, 2780, 2979, 3098, 3194, 3224, 3091, 2789,
-  2414, 2039, 1629, 1131, 592, 120, -247, -581, -948, -1315, -1604, -1805,
-  -1972, -2134, -2254, -2289, -2260, -2210, -2150, -2057, -1938, -1837, -1781, -1737,
-  -1657, -1536, -1410, -1301, -1194, -1069, -936, -824, -754, -715, -688, -662,
-  -645, -644, -661, -693, -748, -838, -962, -1097, -1208, -1286, -1340, -1382,
-  -1403, -1397, -1377, -1361, -1336, -1266, -1134, -961, -772, -557, -289, 23,
-  332, 596, 826, 1060, 1317, 1579, 1820, 2024, 2180, 2275, 2311, 2304,
-  2264, 2183, 2051, 1883, 1714, 1562, 1410, 1235, 1029, 802, 565, 341,
-  158, 26, -85, -218, -365, -483, -563, -662, -831, -1032, -1172, -1216,
-  -1224, -1245, -1241, -1159, -1038, -983, -1023, -1067, -1035, -968, -957, -990,
-  -962, -840, -731, -745, -844, -904, -892, -905, -1017, -1154, -1195, -1145,
-  -1134, -1232, -1346, -1342, -1227, -1133, -1127, -1114, -971, -737, -567, -522,
-  -473, -274, 39, 313, 497, 705, 1025, 1370, 1610, 1764, 1955, 2192,
-  2332, 2301, 2233, 2287, 2408, 2393, 2183, 1948, 1846, 1821, 1729, 1557,
-  1430, 1444, 1622, 2020, 2718, 3672, 4690, 5637, 6575, 7597, 8583, 9279,
-  9605, 9746, 9902, 10071, 10153, 10149, 10111, 9973, 9590, 8973, 8307, 7693,
-  6988, 6046, 5005, 4180, 3679, 3281, 2750, 2118, 1576, 1170, 764, 270,
-  -232, -657, -1058, -1526, -2012, -2368, -2554, -2674, -2796, -2816, -2597, -2170,
-  -1723, -1389, -1138, -892, -671, -545, -500, -436, -308, -197, -213, -378,
-  -655, -1060, -1653, -2416, -3215, -3909, -4470, -4938, -5303, -5503, -5546, -5547,
-  -5602, -5663, -5600, -5377, -5082, -4790, -4451, -3978, -3392, -2812, -2311, -1845,
-  -1333, -770, -198, 376, 989, 1640, 2270, 2830, 3347, 3870, 4380, 4800,
-  5083, 5266, 5398, 5462, 5374, 5068, 4562, 3941, 3295, 2659, 2010, 1318,
-  595, -97, -707, -1252, -1794, -2355, -2875, -3261, -3470, -3512, -3418, -3220,
-  -2969, -2727, -2513, -2285, -2010, -1730, -1520, -1377, -1208, -946, -659, -487,
-  -495, -613, -744, -867, -1023, -1231, -1450, -1641, -1819, -2031, -2296, -2598,
-  -2923, -3273, -3635, -3966, -4223, -4406, -4560, -4713, -4840, -4892, -4851, -4751,
-  -4624, -4441, -4135, -3682, -3148, -2633, -2167, -1684, -1115, -477, 148, 709,
-  1225, 1723, 2162, 2465, 2607, 2627, 2560, 2398, 2144, 1872, 1665, 1504,
-  1280, 929, 524, 185, -64, -310, -609, -908, -1112, -1214, -1286, -1378,
-  -1470, -1528, -1575, -1646, -1719, -1719, -1614, -1472, -1383, -1356, -1299, -1129,
-  -871, -631, -478, -380, -267, -124, 4, 76, 81, 6, -176, -444,
-  -706, -887, -1039, -1295, -1696, -2107, -2364, -2464, -2553, -2741, -2984, -3152,
-  -3172, -3048, -2820, -2534, -2253, -2003, -1721, -1307, -766, -250, 88, 270,
-  473, 820, 1246, 1577, 1723, 1751, 1789, 1900, 2047, 2149, 2152, 2055,
-  1911, 1803, 1788, 1827, 1794, 1591, 1272, 1009, 919, 925, 836, 567,
-  235, 14, -53, -78, -179, -367, -572, -719, -756, -668, -501, -364,
-  -330, -345, -275, -63, 192, 341, 338, 269, 236, 255, 259, 161,
-  -71, -390, -687, -871, -957, -1052, -1251, -1535, -1797, -1957, -2034, -2096,
-  -2179, -2249, -2245, -2129, -1914, -1662, -1452, -1330, -1261, -1158, -967, -727,
-  -537, -444, -378, -218, 63, 356, 522, 548, 558, 668, 864, 1032,
-  1100, 1108, 1143, 1241, 1371, 1479, 1519, 1473, 1373, 1319, 1403, 1592,
-  1722, 1654, 1449, 1321, 1401, 1582, 1635, 1478, 1272, 1228, 1365, 1507,
-  1501, 1389, 1361, 1590, 2145, 3003, 4058, 5131, 6070, 6875, 7672, 8497,
-  9175, 9496, 9511, 9532, 9799, 10216, 10460, 10323, 9848, 9188, 8436, 7604,
-  6687, 5680, 4591, 3523, 2660, 2112, 1755, 1338, 769, 213, -118, -216,
-  -256, -385, -602, -840, -1041, -1153, -1139, -1042, -986, -1035, -1079, -954,
-  -673, -456, -485, -698, -872, -878, -783, -721, -736, -790, -877, -1053,
-  -1357, -1763, -2230, -2765, -3386, -4040, -4590, -4945, -5158, -5369, -5641, -5884,
-  -5965, -5869, -5690, -5490, -5213, -4777, -4192, -3534, -2828, -2034, -1161, -327,
-  357, 926, 1509, 2144, 2706, 3067, 3262, 3450, 3718, 3995, 4154, 4149,
-  4020, 3811, 3540, 3226, 2897, 2552, 2157, 1703, 1261, 911, 644, 353,
-  -46, -514, -925, -1201, -1382, -1564, -1786, -1992, -2093, -2055, -1911, -1725,
-  -1542, -1362, -1150, -872, -541, -237, -57, -23, -48, -22, 66, 98,
-  -60, -417, -855, -1263, -1649, -2096, -2647, -3246, -3789, -4207, -4487, -4652,
-  -4758, -4864, -4981, -5033, -4921, -4632, -4274, -3972, -3732, -3447, -3031, -2522,
-  -2039, -1655, -1345, -1032, -681, -320, 5, 268, 472, 634, 769, 896,
-  1026, 1146, 1209, 1163, 1003, 785, 566, 351, 94, -223, -552, -819,
-  -1009, -1165, -1319, -1451, -1532, -1572, -1592, -1565, -1426, -1164, -856, -588,
-  -364, -125, 154, 420, 600, 677, 686, 659, 603, 509, 362, 143,
-  -157, -511, -865, -1185, -1475, -1745, -1983, -2172, -2321, -2451, -2552, -2598,
-  -2593, -2578, -2567, -2517, -2389, -2207, -2037, -1892, -1727, -1520, -1321, -1175,
-  -1041, -830, -528, -230, -27, 105, 261, 480, 697, 836, 897, 946,
-  1029, 1140, 1242, 1312, 1336, 1289, 1162, 983, 804, 654, 503, 318,
-  124, 4, 19, 134, 244, 281, 269, 285, 362, 464, 542, 592,
-  661, 791, 970, 1136, 1235, 1266, 1263, 1243, 1179, 1041, 841, 633,
-  441, 247, 35, -168, -328, -466, -628, -802, -927, -997, -1109, -1342,
-  -1626, -1799, -1811, -1789, -1873, -2033, -2119, -2065, -1960, -1914, -1925, -1918,
-  -1864, -1786, -1675, -1486, -1221, -964, -781, -622, -383, -52, 247, 399,
-  423, 440, 527, 643, 705, 690, 638, 581, 501, 379, 236, 113,
-  12, -94, -206, -267, -235, -150, -97, -98, -81, 26, 210, 404,
-  601, 856, 1177, 1477, 1669, 1776, 1896, 2062, 2201, 2256, 2268, 2307,
-  2363, 2358, 2262, 2128, 2004, 1880, 1764, 1765, 2027, 2583, 3320, 4102,
-  4885, 5683, 6489, 7258, 7945, 8514, 8932, 9211, 9443, 9720, 9995, 10077,
-  9809, 9214, 8431, 7555, 6605, 5621, 4660, 3709, 2697, 1679, 891, 497,
-  330, 38, -473, -896, -909, -591, -315, -270, -294, -186, 20, 191,
-  363, 642, 915, 889, 496, 72, -40, 42, -116, -675, -1281, -1509,
-  -1395, -1351, -1635, -2105, -2505, -2815, -3178, -3609, -3964, -4193, -4445, -4839,
-  -5238, -5394, -5293, -5206, -5342, -5560, -5533, -5139, -4591, -4139, -3756, -3212,
-  -2399, -1465, -616, 124, 860, 1610, 2246, 2671, 2956, 3228, 3481, 3602,
-  3554, 3443, 3362, 3246, 2960, 2496, 1997, 1575, 1187, 736, 249, -131,
-  -310, -342, -354, -410, -487, -537, -531, -461, -349, -244, -183, -141,
-  -45, 131, 320, 429, 427, 359, 265, 155, 31, -94, -234, -450,
-  -773, -1143, -1459, -1713, -2016, -2465, -3012, -3516, -3904, -4223, -4530, -4788,
-  -4916, -4921, -4890, -4871, -4794, -4579, -4259, -3951, -3695, -3398, -2962, -2414,
-  -1882, -1441, -1063, -707, -401, -194, -67, 48, 158, 184, 74, -105,
-  -229, -271, -330, -501, -755, -974, -1082, -1108, -1125, -1159, -1186, -1175,
-  -1122, -1037, -927, -803, -689, -597, -499, -345, -118, 129, 318, 419,
-  479, 566, 683, 771, 784, 742, 703, 679, 626, 497, 293, 38,
-  -253, -574, -913, -1250, -1588, -1942, -2296, -2604, -2838, -3019, -3168, -3258,
-  -3229, -3067, -2821, -2548, -2257, -1933, -1573, -1194, -801, -402, -25, 299,
-  582, 859, 1117, 1271, 1247, 1084, 887, 717, 542, 322, 78, -136,
-  -304, -452, -581, -673, -732, -791, -842, -818, -668, -441, -243, -114,
-  5, 182, 399, 594, 740, 873, 1026, 1191, 1341, 1466, 1572, 1658,
-  1726, 1783, 1835, 1863, 1839, 1752, 1614, 1436, 1224, 989, 752, 522,
-  296, 75, -140, -360, -618, -911, -1178, -1344, -1411, -1452, -1512, -1547,
-  -1484, -1333, -1189, -1122, -1111, -1089, -1028, -950, -885, -846, -846, -890,
-  -951, -981, -969, -968, -1033, -1150, -1235, -1222, -1123, -1006, -937, -932,
-  -948, -909, -777, -610, -513, -513, -497, -324, 6, 335, 520, 571,
-  590, 633, 677, 705, 739, 767, 725, 601, 506, 555, 683, 673,
-  428, 121, 12, 142, 313, 352, 318, 380, 586, 845, 1087, 1336,
-  1596, 1786, 1862, 1935, 2160, 2508, 2763, 2793, 2712, 2714, 2808, 2808,
-  2600, 2288, 2069, 2048, 2237, 2652, 3290, 4050, 4772, 5406, 6038, 6710,
-  7301, 7678, 7896, 8150, 8522, 8886, 9091, 9105, 8926, 8465, 7655, 6633,
-  5650, 4795, 3924, 2941, 2010, 1362, 972, 596, 129, -257, -397, -376,
-  -367, -322, -33, 508, 1010, 1237, 1301, 1476, 1787, 1983, 1892, 1622,
-  1337, 1012, 525, -82, -622, -1044, -1511, -2140, -2783, -3203, -3396, -3602,
-  -3998, -4487, -4851, -4992, -4967, -4853, -4678, -4474, -4286, -4104, -3853, -3514,
-  -3185, -2985, -2902, -2794, -2546, -2174, -1779, -1449, -1200, -991, -754, -436,
-  -52, 309, 568, 730, 879, 1074, 1289, 1449, 1504, 1461, 1365, 1272,
-  1212, 1164, 1067, 885, 651, 426, 239, 85, -33, -97, -116, -131,
-  -145, -90, 94, 355, 578, 715, 834, 994, 1155, 1231, 1209, 1140,
-  1023, 784, 404, -17, -367, -677, -1079, -1620, -2185, -2639, -2979, -3302,
-  -3652, -3967, -4184, -4317, -4395, -4387, -4237, -3969, -3694, -3480, -3283, -3014,
-  -2663, -2308, -2018, -1788, -1565, -1325, -1080, -858, -685, -594, -611, -730,
-  -903, -1078, -1234, -1388, -1574, -1810, -2070, -2284, -2385, -2383, -2357, -2362,
-  -2361, -2256, -2009, -1684, -1367, -1082, -796, -492, -176, 157, 521, 886,
-  1161, 1287, 1313, 1341, 1393, 1380, 1215, 930, 641, 424, 252, 59,
-  -186, -468, -760, -1043, -1291, -1480, -1622, -1765, -1941, -2126, -2258, -2297,
-  -2268, -2235, -2232, -2225, -2147, -1969, -1736, -1523, -1364, -1226, -1058, -848,
-  -619, -396, -181, 20, 182, 287, 354, 405, 420, 349, 194, 33,
-  -61, -112, -209, -380, -546, -617, -601, -580, -595, -602, -550, -447,
-  -325, -182, 7, 224, 417, 579, 770, 1030, 1301, 1469, 1498, 1468,
-  1473, 1512, 1513, 1424, 1276, 1137, 1035, 954, 873, 788, 705, 617,
-  516, 420, 351, 310, 257, 158, 34, -47, -49, -14, -13, -68,
-  -131, -153, -146, -168, -252, -377, -500, -596, -657, -680, -672, -659,
-  -665, -693, -723, -739, -752, -797, -901, -1048, -1173, -1207, -1148, -1077,
-  -1087, -1170, -1221, -1166, -1054, -997, -1020, -1042, -985, -866, -745, -622,
-  -460, -278, -139, -44, 108, 369, 627, 727, 688, 707, 902, 1141,
-  1204, 1071, 942, 961, 1046, 1022, 859, 669, 521, 381, 226, 110,
-  56, -16, -173, -307, -235, 54, 342, 443, 438, 568, 925, 1341,
-  1598, 1661, 1682, 1819, 2109, 2470, 2752, 2827, 2681, 2463, 2359, 2405,
-  2437, 2284, 2006, 1887, 2193, 2925, 3815, 4544, 4979, 5248, 5604, 6190,
-  6893, 7449, 7694, 7738, 7856, 8196, 8601, 8718, 8302, 7407, 6332, 5378,
-  4648, 4014, 3264, 2314, 1302, 495, 60, -87, -192, -426, -714, -823,
-  -595, -98, 450, 861, 1100, 1257, 1453, 1749, 2092, 2323, 2278, 1918,
-  1371, 822, 340, -155, -778, -1545, -2352, -3073, -3640, -4066, -4421, -4784,
-  -5190, -5572, -5788, -5730, -5422, -5021, -4681, -4438, -4192, -3820, -3304, -2764,
-  -2356, -2136, -2014, -1845, -1567, -1247, -1006, -906, -911, -930, -879, -725,
-  -509, -331, -266, -286, -275, -145, 72, 256, 339, 372, 455, 614,
-  776, 864, 879, 879, 892, 889, 847, 797, 799, 867, 946, 984,
-  985, 985, 1003, 1026, 1055, 1106, 1169, 1191, 1130, 1022, 940, 889,
-  769, 471, -4, -529, -981, -1342, -1692, -2105, -2577, -3037, -3414, -3683,
-  -3866, -3991, -4075, -4115, -4085, -3942, -3650, -3229, -2775, -2405, -2155, -1945,
-  -1665, -1296, -940, -720, -665, -707, -764, -816, -895, -1045, -1290, -1626,
-  -2007, -2351, -2580, -2692, -2774, -2918, -3114, -3232, -3139, -2835, -2463, -2169,
-  -1958, -1704, -1303, -779, -257, 165, 481, 738, 978, 1218, 1452, 1640,
-  1706, 1608, 1402, 1206, 1085, 965, 724, 330, -111, -473, -728, -945,
-  -1189, -1460, -1717, -1918, -2040, -2073, -2035, -1971, -1923, -1881, -1795, -1638,
-  -1437, -1236, -1054, -880, -711, -545, -373, -189, -30, 47, 36, 4,
-  21, 72, 78, 4, -103, -183, -243, -324, -428, -510, -559, -614,
-  -690, -733, -694, -615, -592, -635, -634, -494, -257, -52, 67, 171,
-  348, 590, 824, 1007, 1144, 1241, 1293, 1324, 1387, 1490, 1557, 1506,
-  1358, 1220, 1154, 1105, 978, 763, 530, 346, 224, 154, 134, 149,
-  154, 128, 113, 167, 278, 362, 368, 347, 381, 477, 558, 568,
-  521, 459, 381, 250, 65, -129, -301, -472, -669, -870, -1015, -1083,
-  -1128, -1217, -1348, -1454, -1478, -1443, -1412, -1405, -1375, -1285, -1160, -1061,
-  -997, -918, -796, -677, -621, -602, -534, -385, -234, -178, -214, -249,
-  -235, -215, -241, -279, -251, -154, -71, -45, -11, 116, 298, 399,
-  356, 266, 276, 399, 518, 543, 510, 503, 535, 555, 542, 521,
-  487, 393, 249, 176, 285, 510, 662, 655, 630, 780, 1103, 1394,
-  1476, 1390, 1325, 1424, 1683, 1994, 2221, 2260, 2112, 1930, 1907, 2070,
-  2206, 2093, 1797, 1686, 2081, 2925, 3827, 4428, 4704, 4917, 5327, 5974,
-  6670, 7165, 7339, 7304, 7336, 7626, 8053, 8207, 7737, 6703, 5554, 4718,
-  4223, 3729, 2921, 1834, 801, 139, -111, -176, -334, -682, -1050, -1130,
-  -744, -19, 705, 1162, 1374, 1577, 1951, 2449, 2843, 2928, 2674, 2226,
-  1779, 1418, 1048, 487, -336, -1293, -2180, -2911, -3567, -4245, -4914, -5457,
-  -5808, -5996, -6044, -5913, -5573, -5090, -4594, -4154, -3734, -3276, -2778, -2276,
-  -1790, -1327, -926, -642, -468, -323, -151, -26, -84, -358, -689, -862,
-  -810, -675, -642, -752, -873, -855, -669, -411, -189, -34, 99, 276,
-  539, 881, 1237, 1513, 1649, 1678, 1705, 1805, 1938, 1987, 1884, 1688,
-  1515, 1417, 1345, 1233, 1075, 919, 789, 660, 504, 334, 183, 52,
-  -94, -285, -510, -736, -941, -1127, -1317, -1541, -1823, -2146, -2453, -2681,
-  -2814, -2894, -2972, -3053, -3096, -3053, -2913, -2710, -2506, -2355, -2264, -2175,
-  -2017, -1791, -1583, -1493, -1529, -1609, -1656, -1683, -1764, -1940, -2183, -2438,
-  -2676, -2892, -3068, -3189, -3262, -3309, -3320, -3239, -3020, -2690, -2326, -1977,
-  -1620, -1213, -760, -307, 117, 515, 887, 1197, 1407, 1525, 1595, 1629,
-  1581, 1398, 1090, 737, 418, 154, -93, -368, -684, -1007, -1279, -1439,
-  -1475, -1439, -1412, -1428, -1431, -1322, -1062, -732, -467, -345, -315, -258,
-  -102, 111, 258, 249, 96, -95, -217, -244, -252, -348, -570, -839,
-  -1021, -1041, -960, -920, -1006, -1156, -1228, -1136, -941, -779, -729, -749,
-  -735, -624, -446, -284, -206, -213, -240, -204, -73, 101, 220, 244,
-  239, 321, 532, 788, 968, 1038, 1072, 1163, 1311, 1431, 1450, 1382,
-  1305, 1273, 1267, 1224, 1105, 932, 757, 618, 521, 440, 346, 227,
-  113, 68, 127, 243, 309, 263, 172, 174, 329, 535, 638, 591,
-  498, 476, 527, 552, 468, 278, 37, -204, -416, -586, -724, -881,
-  -1090, -1317, -1478, -1528, -1518, -1531, -1579, -1596, -1526, -1396, -1274, -1179,
-  -1067, -894, -686, -515, -422, -389, -362, -316, -264, -246, -289, -389,
-  -505, -580, -584, -542, -523, -574, -667, -716, -653, -487, -295, -146,
-  -41, 73, 243, 471, 713, 909, 1023, 1053, 1032, 1011, 1026, 1071,
-  1091, 1030, 883, 717, 620, 628, 689, 709, 641, 524, 460, 532,
-  751, 1038, 1264, 1347, 1329, 1359, 1561, 1889, 2145, 2164, 1987, 1834,
-  1880, 2092, 2263, 2217, 1967, 1701, 1640, 1886, 2361, 2875, 3276, 3578,
-  3950, 4538, 5295, 5989, 6396, 6509, 6536, 6700, 7025, 7311, 7313, 6951,
-  6360, 5739, 5173, 4589, 3877, 3032, 2167, 1423, 868, 488, 229, 28,
-  -146, -260, -227, 6, 379, 755, 1062, 1358, 1736, 2170, 2515, 2666,
-  2666, 2615, 2512, 2236, 1710, 1011, 288, -395, -1090, -1839, -2598, -3284,
-  -3880, -4416, -4890, -5250, -5467, -5580, -5608, -5487, -5130, -4562, -3942, -3412,
-  -2961, -2473, -1911, -1379, -1004, -792, -637, -466, -315, -270, -359, -539,
-  -757, -994, -1238, -1460, -1637, -1778, -1899, -1969, -1921, -1722, -1427, -1116,
-  -809, -444, 23, 542, 1005, 1351, 1613, 1858, 2113, 2342, 2498, 2551,
-  2498, 2358, 2166, 1950, 1708, 1414, 1060, 690, 374, 143, -30, -198,
-  -391, -598, -786, -915, -971, -977, -983, -1016, -1055, -1063, -1033, -1005,
-  -1021, -1089, -1188, -1286, -1366, -1425, -1481, -1566, -1686, -1809, -1892, -1938,
-  -1996, -2100, -2235, -2360, -2461, -2556, -2656, -2753, -2843, -2939, -3035, -3106,
-  -3146, -3194, -3284, -3377, -3383, -3266, -3087, -2927, -2792, -2615, -2357, -2062,
-  -1800, -1594, -1406, -1191, -936, -645, -344, -85, 68, 99, 72, 72,
-  114, 117, 1, -217, -421, -514, -509, -513, -618, -810, -989, -1057,
-  -991, -843, -692, -585, -516, -433, -277, -39, 217, 397, 454, 442,
-  459, 555, 675, 714, 616, 416, 198, 25, -101, -225, -387, -595,
-  -816, -999, -1107, -1140, -1131, -1121, -1128, -1137, -1108, -1011, -853, -685,
-  -562, -493, -430, -317, -149, 24, 142, 192, 204, 214, 236, 265,
-  290, 294, 263, 209, 180, 216, 302, 371, 372, 330, 320, 390,
-  511, 612, 658, 666, 687, 746, 831, 904, 925, 885, 810, 752,
-  742, 762, 760, 701, 603, 528, 516, 552, 576, 544, 466, 395,
-  379, 411, 444, 429, 362, 281, 227, 211, 200, 149, 35, -118,
-  -266, -374, -449, -525, -628, -754, -865, -923, -919, -879, -848, -849,
-  -869, -876, -846, -784, -717, -661, -614, -572, -538, -512, -489, -468,
-  -468, -517, -616, -723, -784, -779, -739, -715, -732, -772, -798, -777,
-  -700, -577, -435, -308, -200, -78, 108, 361, 606, 749, 767, 744,
-  787, 917, 1052, 1098, 1041, 946, 882, 871, 887, 883, 815, 685,
-  557, 531, 639, 799, 887, 874, 871, 1002, 1268, 1541, 1686, 1687,
-  1646, 1692, 1879, 2137, 2311, 2285, 2103, 1951, 1983, 2164, 2295, 2238,
-  2084, 2085, 2433, 3082, 3793, 4316, 4569, 4689, 4913, 5367, 5937, 6348,
-  6421, 6260, 6162, 6318, 6597, 6646, 6205, 5328, 4339, 3569, 3107, 2764,
-  2260, 1493, 649, 63, -86, 59, 165, 29, -241, -342, -61, 543,
-  1207, 1668, 1847, 1873, 1961, 2227, 2561, 2689, 2406, 1776, 1075, 534,
-  131, -344, -1039, -1898, -2741, -3440, -3978, -4396, -4731, -5019, -5280, -5459,
-  -5423, -5082, -4511, -3914, -3433, -3030, -2578, -2035, -1487, -1025, -650, -332,
-  -97, -7, -50, -134, -210, -356, -678, -1146, -1582, -1842, -1946, -2017,
-  -2120, -2204, -2200, -2092, -1890, -1576, -1136, -634, -178, 201, 582, 1049,
-  1558, 1971, 2197, 2279, 2322, 2377, 2407, 2348, 2160, 1835, 1404, 944,
-  537, 206, -103, -449, -819, -1132, -1332, -1435, -1491, -1526, -1542, -1540,
-  -1510, -1420, -1244, -1021, -847, -780, -775, -740, -654, -598, -649, -791,
-  -942, -1066, -1203, -1396, -1619, -1811, -1965, -2138, -2362, -2591, -2750, -2828,
-  -2892, -2994, -3106, -3157, -3130, -3073, -3036, -3002, -2927, -2807, -2685, -2581,
-  -2451, -2245, -1984, -1749, -1587, -1448, -1248, -985, -748, -618, -565, -490,
-  -351, -216, -173, -225, -294, -330, -367, -457, -591, -714, -805, -897,
-  -1008, -1091, -1093, -1038, -1001, -1005, -978, -850, -655, -494, -406, -322,
-  -161, 59, 247, 347, 389, 424, 447, 408, 290, 128, -34, -189,
-  -350, -511, -646, -750, -844, -948, -1048, -1112, -1129, -1122, -1101, -1043,
-  -912, -715, -510, -353, -234, -101, 71, 238, 328, 332, 313, 344,
-  424, 484, 459, 351, 218, 121, 79, 73, 62, 18, -49, -81,
-  -9, 175, 388, 521, 549, 565, 683, 915, 1150, 1264, 1242, 1182,
-  1187, 1272, 1358, 1356, 1242, 1071, 932, 871, 862, 827, 709, 532,
-  381, 329, 362, 399, 368, 277, 202, 206, 274, 329, 313, 238,
-  167, 147, 165, 169, 116, 6, -124, -235, -312, -378, -468, -595,
-  -727, -813, -833, -815, -810, -835, -865, -865, -831, -788, -758, -733,
-  -696, -649, -615, -603, -601, -590, -576, -587, -631, -676, -681, -641,
-  -582, -530, -482, -427, -367, -300, -204, -65, 90, 209, 290, 386,
-  545, 732, 859, 887, 866, 857, 861, 834, 762, 678, 610, 542,
-  454, 371, 334, 347, 364, 355, 349, 389, 479, 593, 728, 908,
-  1127, 1318, 1429, 1494, 1616, 1832, 2048, 2134, 2074, 1995, 2024, 2148,
-  2236, 2187, 2026, 1864, 1802, 1888, 2114, 2420, 2720, 2964, 3210, 3578,
-  4107, 4673, 5087, 5291, 5411, 5619, 5941, 6233, 6335, 6203, 5905, 5529,
-  5117, 4673, 4177, 3609, 2968, 2305, 1718, 1280, 970, 703, 426, 184,
-  61, 87, 221, 419, 674, 982, 1299, 1566, 1779, 1981, 2179, 2289,
-  2211, 1931, 1531, 1097, 640, 121, -477, -1138, -1831, -2520, -3149, -3663,
-  -4062, -4402, -4726, -4981, -5059, -4901, -4565, -4174, -3805, -3444, -3034, -2547,
-  -2025, -1543, -1156, -867, -644, -467, -352, -330, -421, -613, -880, -1188,
-  -1501, -1789, -2031, -2221, -2354, -2421, -2418, -2345, -2189, -1925, -1544, -1083,
-  -604, -137, 336, 842, 1366, 1859, 2272, 2577, 2760, 2833, 2840, 2819,
-  2742, 2517, 2104, 1589, 1127, 779, 464, 75, -382, -797, -1081, -1236,
-  -1315, -1348, -1348, -1330, -1283, -1157, -915, -611, -373, -275, -259, -206,
-  -81, 31, 18, -144, -396, -653, -871, -1062, -1280, -1582, -1974, -2378,
-  -2690, -2875, -2999, -3150, -3348, -3531, -3616, -3569, -3424, -3257, -3143, -3099,
-  -3061, -2933, -2688, -2402, -2186, -2077, -2009, -1897, -1719, -1524, -1379, -1325,
-  -1353, -1411, -1423, -1342, -1201, -1095, -1085, -1134, -1147, -1069, -933, -819,
-  -770, -765, -757, -708, -608, -466, -317, -204, -148, -120, -61, 64,
-  225, 354, 406, 405, 411, 463, 549, 626, 664, 652, 594, 504,
-  413, 350, 312, 254, 133, -37, -189, -270, -290, -301, -337, -399,
-  -464, -511, -518, -466, -372, -288, -256, -261, -244, -168, -53, 53,
-  117, 135, 110, 53, 2, -4, 29, 39, -32, -162, -262, -257,
-  -157, -47, -2, -41, -114, -140, -62, 109, 294, 398, 397, 362,
-  405, 568, 779, 903, 858, 693, 553, 554, 678, 788, 758, 592,
-  411, 343, 411, 526, 571, 497, 354, 255, 286, 431, 580, 617,
-  528, 413, 376, 432, 497, 484, 372, 212, 79, 15, 6, -8,
-  -91, -248, -412, -508, -524, -515, -539, -595, -648, -673, -677, -669,
-  -656, -650, -670, -711, -737, -712, -651, -612, -635, -700, -751, -753,
-  -723, -699, -704, -725, -738, -723, -680, -619, -562, -524, -500, -456,
-  -353, -194, -37, 50, 62, 68, 132, 237, 313, 326, 325, 369,
-  448, 497, 490, 466, 472, 504, 526, 531, 548, 603, 698, 827,
-  981, 1125, 1202, 1203, 1205, 1308, 1514, 1702, 1740, 1632, 1522, 1568,
-  1784, 2011, 2047, 1840, 1562, 1479, 1705, 2085, 2353, 2400, 2386, 2570,
-  3055, 3705, 4269, 4569, 4607, 4560, 4671, 5051, 5547, 5830, 5695, 5283,
-  4951, 4895, 4942, 4742, 4138, 3308, 2583, 2161, 2004, 1924, 1742, 1401,
-  1003, 748, 775, 1025, 1283, 1377, 1345, 1382, 1628, 2029, 2395, 2568,
-  2519, 2319, 2063, 1817, 1587, 1310, 896, 317, -340, -935, -1399, -1795,
-  -2220, -2695, -3151, -3513, -3761, -3898, -3905, -3774, -3556, -3330, -3108, -2821,
-  -2420, -1967, -1592, -1358, -1212, -1078, -953, -888, -894, -944, -1034, -1214,
-  -1511, -1855, -2127, -2282, -2381, -2503, -2643, -2721, -2666, -2475, -2188, -1855,
-  -1522, -1210, -895, -505, -4, 547, 1010, 1288, 1412, 1501, 1634, 1782,
-  1839, 1721, 1432, 1067, 747, 529, 358, 117, -249, -657, -947, -1030,
-  -967, -896, -903, -954, -951, -818, -560, -263, -36, 61, 66, 88,
-  194, 332, 374, 235, -40, -326, -538, -692, -871, -1143, -1506, -1893,
-  -2215, -2417, -2519, -2601, -2731, -2900, -3029, -3035, -2912, -2737, -2606, -2555,
-  -2535, -2466, -2306, -2092, -1909, -1827, -1843, -1885, -1870, -1774, -1654, -1603,
-  -1662, -1781, -1864, -1849, -1765, -1692, -1691, -1754, -1815, -1804, -1697, -1536,
-  -1401, -1346, -1345, -1311, -1171, -947, -740, -631, -605, -578, -483, -331,
-  -183, -83, -33, -10, 10, 44, 103, 172, 204, 162, 68, -7,
-  -16, 19, 26, -29, -118, -187, -218, -228, -234, -232, -224, -223,
-  -235, -232, -178, -78, 20, 71, 79, 83, 118, 183, 252, 292,
-  287, 243, 195, 177, 192, 203, 166, 78, -22, -87, -104, -90,
-  -67, -51, -48, -46, -15, 69, 194, 312, 385, 427, 489, 602,
-  738, 848, 906, 925, 928, 921, 904, 875, 837, 783, 708, 613,
-  519, 446, 398, 365, 333, 303, 288, 298, 330, 375, 429, 494,
-  566, 625, 655, 666, 682, 715, 736, 707, 620, 503, 387, 285,
-  193, 104, 0, -144, -323, -483, -557, -544, -524, -572, -676, -753,
-  -738, -648, -548, -488, -477, -493, -497, -447, -333, -217, -192, -295,
-  -454, -548, -523, -444, -429, -536, -706, -824, -816, -717, -628, -622,
-  -674, -695, -622, -462, -272, -106, 0, 36, 45, 112, 288, 510,
-  634, 589, 468, 429, 523, 645, 664, 565, 436, 364, 375, 454,
-  567, 654, 653, 579, 550, 683, 954, 1198, 1271, 1203, 1169, 1314,
-  1619, 1918, 2041, 1958, 1805, 1779, 1962, 2236, 2382, 2297, 2110, 2079,
-  2357, 2850, 3304, 3516, 3494, 3438, 3579, 3976, 4449, 4715, 4646, 4408,
-  4327, 4564, 4933, 5062, 4737, 4103, 3522, 3251, 3238, 3215, 2953, 2456,
-  1955, 1704, 1778, 2007, 2123, 1986, 1704, 1541, 1672, 2034, 2377, 2482,
-  2340, 2131, 2048, 2119, 2193, 2081, 1720, 1204, 691, 280, -40, -347,
-  -717, -1167, -1649, -2080, -2385, -2545, -2615, -2679, -2772, -2847, -2815, -2627,
-  -2314, -1977, -1715, -1573, -1523, -1484, -1388, -1234, -1102, -1095, -1242, -1468,
-  -1653, -1739, -1779, -1877, -2089, -2359, -2567, -2623, -2534, -2383, -2254, -2162,
-  -2057, -1870, -1571, -1187, -785, -435, -166, 51, 278, 542, 801, 970,
-  1001, 926, 818, 720, 622, 491, 304, 60, -223, -498, -697, -785,
-  -801, -822, -881, -924, -870, -704, -496, -332, -237, -168, -69, 74,
-  227, 340, 368, 300, 170, 33, -85, -225, -451, -780, -1147, -1462,
-  -1695, -1896, -2121, -2363, -2565, -2688, -2747, -2776, -2789, -2778, -2743, -2693,
-  -2620, -2504, -2349, -2198, -2086, -2005, -1921, -1839, -1801, -1826, -1870, -1878,
-  -1866, -1903, -2014, -2130, -2167, -2130, -2104, -2143, -2209, -2229, -2181, -2091,
-  -1986, -1867, -1752, -1667, -1600, -1485, -1278, -1033, -866, -815, -796, -699,
-  -524, -368, -307, -316, -330, -319, -299, -276, -234, -184, -173, -223,
-  -288, -294, -235, -177, -176, -214, -229, -199, -150, -103, -46, 28,
-  84, 81, 38, 31, 97, 188, 221, 171, 91, 41, 40, 68,
-  103, 112, 63, -43, -133, -129, -42, 22, -29, -160, -255, -242,
-  -160, -86, -57, -62, -85, -108, -86, 15, 150, 216, 168, 87,
-  98, 222, 358, 400, 358, 318, 338, 394, 437, 447, 436, 413,
-  384, 360, 360, 385, 416, 431, 428, 427, 446, 488, 526, 533,
-  513, 505, 533, 567, 551, 486, 432, 435, 454, 405, 273, 144,
-  90, 90, 67, 2, -57, -80, -100, -148, -190, -176, -132, -137,
-  -210, -262, -214, -99, -31, -62, -129, -151, -120, -87, -80, -88,
-  -103, -137, -186, -213, -190, -148, -151, -219, -294, -294, -195, -64,
-  6, -13, -50, -2, 150, 312, 377, 345, 315, 370, 483, 580,
-  623, 625, 594, 530, 486, 538, 678, 773, 703, 545, 515, 722,
-  1023, 1177, 1122, 1033, 1111, 1375, 1670, 1848, 1886, 1863, 1869, 1950,
-  2098, 2250, 2314, 2235, 2066, 1959, 2050, 2320, 2585, 2666, 2582, 2558,
-  2790, 3224, 3596, 3716, 3665, 3681, 3891, 4201, 4445, 4541, 4508, 4381,
-  4203, 4043, 3954, 3869, 3640, 3217, 2753, 2469, 2404, 2382, 2215, 1911,
-  1639, 1538, 1597, 1700, 1750, 1727, 1686, 1699, 1801, 1945, 2033, 1993,
-  1837, 1639, 1450, 1266, 1043, 745, 372, -35, -409, -702, -942, -1210,
-  -1544, -1881, -2110, -2196, -2208, -2223, -2234, -2181, -2048, -1882, -1728, -1583,
-  -1427, -1277, -1169, -1100, -1038, -973, -950, -1008, -1130, -1266, -1393, -1524,
-  -1665, -1789, -1874, -1934, -1991, -2030, -2002, -1886, -1718, -1548, -1387, -1204,
-  -970, -682, -370, -80, 145, 291, 400, 526, 670, 756, 714, 560,
-  386, 260, 160, 22, -175, -395, -596, -764, -889, -957, -971, -972,
-  -991, -1000, -932, -775, -599, -487, -443, -406, -336, -267, -259, -322,
-  -420, -524, -645, -803, -993, -1193, -1388, -1582, -1777, -1961, -2118, -2242,
-  -2331, -2380, -2390, -2372, -2347, -2316, -2261, -2170, -2058, -1958, -1887, -1836,
-  -1789, -1752, -1737, -1743, -1761, -1794, -1854, -1935, -2007, -2049, -2076, -2118,
-  -2172, -2197, -2168, -2104, -2042, -1982, -1893, -1766, -1628, -1505, -1390, -1255,
-  -1099, -948, -826, -729, -648, -583, -532, -480, -421, -368, -346, -355,
-  -363, -341, -289, -234, -201, -193, -197, -184, -132, -41, 52, 99,
-  93, 73, 89, 154, 229, 260, 220, 132, 57, 45, 91, 128,
-  85, -37, -161, -208, -175, -128, -131, -193, -275, -333, -332, -272,
-  -190, -154, -198, -274, -289, -206, -89, -35, -75, -151, -193, -183,
-  -147, -119, -125, -173, -248, -303, -296, -237, -184, -176, -200, -211,
-  -185, -129, -57, 22, 84, 107, 108, 142, 243, 364, 432, 424,
-  391, 388, 410, 421, 410, 388, 356, 297, 222, 171, 166, 169,
-  130, 53, -5, -8, 20, 36, 30, 27, 46, 80, 115, 149,
-  184, 218, 247, 270, 283, 283, 273, 262, 254, 233, 188, 129,
-  76, 25, -37, -103, -144, -154, -170, -220, -271, -263, -185, -93,
-  -40, -9, 47, 134, 212, 259, 302, 361, 407, 406, 375, 371,
-  414, 452, 421, 327, 245, 243, 313, 396, 438, 444, 460, 533,
-  664, 805, 907, 967, 1027, 1128, 1270, 1422, 1555, 1657, 1722, 1758,
-  1791, 1853, 1936, 1989, 1985, 1984, 2093, 2347, 2649, 2873, 3009, 3173,
-  3453, 3796, 4064, 4193, 4252, 4345, 4492, 4625, 4673, 4607, 4433, 4175,
-  3893, 3655, 3461, 3224, 2875, 2474, 2177, 2072, 2087, 2077, 1985, 1875,
-  1842, 1922, 2094, 2301, 2458, 2490, 2417, 2363, 2426, 2533, 2494, 2213,
-  1798, 1426, 1142, 851, 472, 32, -414, -857, -1289, -1633, -1813, -1879,
-  -1983, -2186, -2356, -2311, -2035, -1695, -1455, -1321, -1193, -1011, -795, -601,
-  -472, -447, -553, -756, -958, -1081, -1157, -1296, -1574, -1937, -2244, -2385,
-  -2367, -2298, -2280, -2315, -2298, -2115, -1762, -1349, -997, -729, -477, -171,
-  183, 526, 793, 941, 958, 878, 776, 703, 626, 453, 150, -201,
-  -478, -650, -799, -994, -1202, -1331, -1349, -1302, -1240, -1151, -1005, -813,
-  -620, -444, -271, -102, 33, 113, 158, 192, 178, 58, -169, -420,
-  -622, -795, -1022, -1344, -1703, -2000, -2187, -2294, -2379, -2482, -2594, -2666,
-  -2638, -2493, -2293, -2136, -2069, -2041, -1958, -1788, -1589, -1456, -1431, -1489,
-  -1573, -1639, -1677, -1720, -1818, -1993, -2203, -2361, -2411, -2388, -2373, -2403,
-  -2439, -2415, -2310, -2158, -1995, -1826, -1651, -1484, -1341, -1213, -1074, -921,
-  -790, -716, -701, -716, -734, -747, -757, -768, -794, -852, -933, -988,
-  -966, -868, -760, -707, -710, -705, -624, -466, -288, -162, -114, -114,
-  -103, -48, 28, 67, 25, -85, -209, -292, -315, -303, -306, -364,
-  -476, -584, -622, -571, -487, -445, -458, -477, -445, -360, -260, -183,
-  -138, -130, -156, -191, -193, -143, -85, -84, -158, -251, -288, -249,
-  -174, -121, -119, -153, -170, -118, 9, 155, 247, 267, 272, 332,
-  450, 568, 639, 659, 649, 621, 593, 599, 650, 697, 674, 584,
-  515, 533, 605, 639, 602, 553, 555, 600, 636, 648, 663, 691,
-  701, 678, 651, 653, 666, 646, 585, 521, 480, 447, 403, 357,
-  328, 307, 276, 242, 233, 246, 243, 211, 190, 218, 269, 279,
-  237, 201, 214, 245, 236, 181, 125, 96, 74, 45, 34, 61,
-  92, 79, 35, 39, 135, 268, 349, 359, 366, 437, 565, 689,
-  762, 789, 797, 810, 845, 909, 980, 1012, 978, 910, 874, 907,
-  973, 1002, 973, 933, 950, 1039, 1159, 1259, 1325, 1377, 1440, 1531,
-  1652, 1781, 1880, 1920, 1923, 1955, 2061, 2215, 2343, 2400, 2413, 2445,
-  2530, 2639, 2722, 2750, 2736, 2724, 2753, 2833, 2933, 3000, 2998, 2932,
-  2853, 2818, 2844, 2884, 2865, 2752, 2604, 2526, 2563, 2649, 2662, 2553,
-  2390, 2278, 2262, 2304, 2331, 2288, 2164, 1994, 1856, 1817, 1853, 1847,
-  1697, 1431, 1189, 1077, 1063, 1024, 870, 626, 380, 204, 117, 83,
-  34, -92, -295, -492, -578, -535, -458, -466, -586, -730, -793, -763,
-  -713, -719, -803, -933, -1064, -1165, -1218, -1239, -1272, -1363, -1504, -1631,
-  -1676, -1639, -1584, -1568, -1590, -1604, -1569, -1483, -1367, -1253, -1165, -1112,
-  -1072, -1008, -908, -801, -737, -732, -756, -771, -772, -776, -798, -836,
-  -883, -936, -985, -1009, -998, -975, -974, -998, -1010, -973, -901, -840,
-  -816, -803, -760, -681, -614, -603, -642, -687, -706, -709, -733, -797,
-  -890, -988, -1073, -1141, -1196, -1252, -1327, -1428, -1531, -1595, -1596, -1561,
-  -1542, -1574, -1637, -1680, -1664, -1600, -1550, -1567, -1652, -1742, -1768, -1722,
-  -1667, -1681, -1783, -1918, -2012, -2030, -1997, -1976, -2015, -2109, -2198, -2216,
-  -2148, -2048, -1989, -1996, -2026, -2010, -1913, -1756, -1607, -1540, -1568, -1618,
-  -1577, -1410, -1217, -1142, -1216, -1321, -1320, -1210, -1104, -1083, -1123, -1154,
-  -1147, -1113, -1051, -956, -873, -868, -930, -949, -834, -643, -527, -551,
-  -620, -602, -482, -361, -323, -353, -390, -405, -409, -400, -371, -344,
-  -363, -437, -513, -534, -510, -496, -525, -575, -603, -599, -576, -545,
-  -513, -490, -488, -497, -492, -467, -441, -435, -442, -449, -456, -470,
-  -475, -450, -405, -390, -435, -498, -506, -438, -354, -319, -335, -345,
-  -307, -233, -159, -105, -73, -52, -33, 3, 70, 156, 223, 244,
-  233, 238, 291, 374, 434, 436, 405, 401, 455, 536, 578, 555,
-  503, 479, 503, 547, 571, 564, 544, 537, 563, 619, 684, 725,
-  732, 729, 753, 818, 897, 949, 955, 932, 917, 940, 1000, 1062,
-  1079, 1042, 989, 975, 1012, 1060, 1076, 1057, 1034, 1027, 1042, 1084,
-  1156, 1235, 1273, 1256, 1234, 1276, 1380, 1462, 1450, 1367, 1300, 1302,
-  1349, 1388, 1396, 1375, 1334, 1283, 1261, 1308, 1407, 1484, 1486, 1450,
-  1466, 1572, 1724, 1844, 1900, 1912, 1919, 1950, 2017, 2102, 2165, 2188,
-  2207, 2287, 2433, 2577, 2662, 2711, 2784, 2876, 2922, 2906, 2904, 2984,
-  3094, 3117, 3023, 2908, 2858, 2848, 2797, 2690, 2581, 2489, 2382, 2256,
-  2188, 2231, 2312, 2300, 2165, 2028, 2019, 2126, 2222, 2203, 2073, 1914,
-  1807, 1778, 1784, 1728, 1535, 1237, 966, 827, 785, 705, 501, 224,
-  -5, -120, -148, -154, -189, -274, -398, -509, -540, -473, -382, -374,
-  -479, -613, -670, -638, -614, -695, -875, -1065, -1187, -1248, -1308, -1402,
-  -1513, -1610, -1679, -1726, -1741, -1710, -1639, -1563, -1513, -1479, -1422, -1322,
-  -1200, -1103, -1054, -1036, -1014, -981, -964, -991, -1055, -1123, -1183, -1255,
-  -1356, -1449, -1480, -1454, -1444, -1499, -1570, -1561, -1449, -1322, -1274, -1289,
-  -1279, -1201, -1108, -1060, -1046, -1022, -998, -1032, -1139, -1239, -1260, -1238,
-  -1286, -1445, -1617, -1677, -1624, -1574, -1621, -1726, -1787, -1760, -1693, -1647,
-  -1626, -1608, -1592, -1595, -1602, -1581, -1539, -1534, -1612, -1736, -1820, -1825,
-  -1801, -1820, -1892, -1971, -2007, -1994, -1957, -1922, -1906, -1908, -1905, -1867,
-  -1789, -1712, -1680, -1691, -1691, -1640, -1563, -1521, -1541, -1583, -1588, -1545,
-  -1498, -1487, -1507, -1521, -1502, -1451, -1385, -1318, -1263, -1231, -1215, -1184,
-  -1106, -994, -903, -876, -895, -896, -842, -758, -708, -724, -777, -815,
-  -800, -738, -665, -625, -639, -681, -694, -639, -534, -444, -419, -441,
-  -456, -424, -356, -291, -259, -268, -309, -360, -391, -385, -359, -357,
-  -410, -493, -542, -510, -422, -348, -331, -343, -325, -254, -163, -93,
-  -46, 5, 63, 103, 123, 157, 232, 309, 319, 253, 186, 191,
-  252, 288, 258, 201, 178, 195, 218, 239, 281, 340, 373, 358,
-  345, 405, 535, 652, 683, 650, 642, 710, 810, 866, 848, 794,
-  760, 764, 784, 793, 783, 760, 727, 687, 659, 666, 706, 742,
-  733, 693, 683, 745, 850, 925, 937, 928, 958, 1032, 1105, 1138,
-  1144, 1154, 1175, 1187, 1179, 1163, 1158, 1163, 1164, 1145, 1105, 1064,
-  1053, 1087, 1146, 1183, 1181, 1170, 1198, 1266, 1333, 1372, 1399, 1432,
-  1449, 1427, 1400, 1433, 1527, 1586, 1531, 1413, 1367, 1451, 1575, 1615,
-  1558, 1500, 1515, 1594, 1682, 1756, 1808, 1824, 1798, 1774, 1813, 1915,
-  1996, 1971, 1851, 1738, 1732, 1846, 2004, 2111, 2143, 2164, 2254, 2422,
-  2593, 2690, 2716, 2727, 2756, 2786, 2804, 2820, 2829, 2782, 2649, 2478,
-  2347, 2261, 2143, 1953, 1761, 1660, 1643, 1620, 1553, 1502, 1532, 1622,
-  1697, 1724, 1730, 1745, 1764, 1775, 1773, 1735, 1623, 1441, 1251, 1110,
-  994, 827, 582, 312, 75, -115, -265, -366, -418, -467, -560, -666,
-  -686, -579, -429, -361, -401, -456, -438, -361, -310, -341, -444, -578,
-  -718, -857, -984, -1097, -1211, -1343, -1489, -1615, -1680, -1675, -1627, -1581,
-  -1558, -1536, -1470, -1346, -1200, -1090, -1036, -1005, -960, -906, -876, -886,
-  -918, -951, -991, -1057, -1149, -1245, -1326, -1389, -1438, -1469, -1486, -1496,
-  -1497, -1469, -1401, -1316, -1264, -1262, -1273, -1251, -1192, -1145, -1147, -1191,
-  -1248, -1309, -1378, -1445, -1494, -1531, -1592, -1693, -1792, -1821, -1768, -1700,
-  -1692, -1735, -1752, -1693, -1596, -1535, -1531, -1538, -1522, -1502, -1517, -1556,
-  -1585, -1606, -1663, -1773, -1880, -1918, -1899, -1893, -1938, -1994, -2003, -1965,
-  -1917, -1869, -1806, -1738, -1705, -1718, -1720, -1656, -1556, -1504, -1536, -1599,
-  -1623, -1605, -1585, -1585, -1591, -1601, -1629, -1665, -1662, -1597, -1512, -1475,
-  -1492, -1499, -1438, -1318, -1202, -1141, -1133, -1143, -1134, -1091, -1026, -968,
-  -942, -949, -974, -998, -999, -958, -886, -836, -861, -937, -962, -875,
-  -736, -671, -715, -772, -740, -642, -576, -573, -571, -527, -497, -539,
-  -601, -575, -462, -398, -478, -615, -633, -494, -347, -333, -411, -423,
-  -308, -170, -124, -152, -146, -66, 17, 41, 38, 81, 169, 221,
-  193, 141, 145, 211, 266, 259, 219, 217, 276, 357, 411, 431,
-  452, 507, 591, 668, 702, 701, 710, 757, 818, 845, 826, 801,
-  810, 839, 847, 824, 811, 837, 881, 900, 895, 910, 964, 1025,
-  1053, 1058, 1086, 1149, 1203, 1203, 1162, 1134, 1151, 1191, 1211, 1199,
-  1178, 1171, 1182, 1209, 1256, 1311, 1349, 1354, 1358, 1412, 1522, 1621,
-  1635, 1574, 1521, 1537, 1597, 1629, 1608, 1565, 1533, 1505, 1469, 1447,
-  1465, 1497, 1486, 1429, 1404, 1477, 1607, 1687, 1671, 1629, 1651, 1735,
-  1808, 1824, 1821, 1851, 1897, 1903, 1859, 1824, 1845, 1891, 1885, 1807,
-  1730, 1732, 1802, 1855, 1838, 1790, 1781, 1816, 1842, 1852, 1912, 2071,
-  2261, 2360, 2356, 2375, 2506, 2665, 2685, 2541, 2387, 2353, 2383, 2332,
-  2181, 2049, 1999, 1940, 1776, 1572, 1477, 1500, 1494, 1363, 1219, 1229,
-  1381, 1503, 1490, 1423, 1429, 1495, 1509, 1432, 1342, 1290, 1223, 1071,
-  871, 717, 629, 529, 362, 174, 33, -65, -172, -296, -380, -394,
-  -372, -356, -337, -289, -228, -203, -222, -241, -237, -250, -317, -411,
-  -472, -494, -540, -658, -814, -940, -1016, -1076, -1146, -1210, -1251, -1281,
-  -1310, -1314, -1265, -1183, -1124, -1113, -1105, -1046, -949, -891, -920, -998,
-  -1049, -1049, -1043, -1076, -1141, -1195, -1227, -1266, -1327, -1384, -1402, -1392,
-  -1399, -1434, -1455, -1421, -1348, -1296, -1292, -1303, -1290, -1264, -1269, -1319,
-  -1382, -1419, -1431, -1450, -1496, -1556, -1603, -1627, -1644, -1672, -1710, -1738,
-  -1741, -1722, -1699, -1681, -1667, -1654, -1647, -1650, -1651, -1638, -1626, -1643,
-  -1696, -1749, -1771, -1770, -1780, -1813, -1848, -1866, -1874, -1886, -1889, -1868,
-  -1837, -1832, -1855, -1864, -1819, -1737, -1678, -1676, -1710, -1731, -1717, -1683,
-  -1656, -1647, -1651, -1657, -1655, -1641, -1619, -1603, -1604, -1621, -1639, -1638,
-  -1606, -1555, -1508, -1489, -1491, -1483, -1437, -1360, -1292, -1259, -1246, -1211,
-  -1139, -1060, -1013, -999, -985, -958, -936, -937, -941, -919, -883, -877,
-  -915, -949, -925, -859, -817, -824, -826, -762, -647, -554, -520, -505,
-  -455, -372, -300, -257, -225, -195, -187, -212, -237, -222, -179, -165,
-  -203, -248, -241, -174, -96, -45, -18, 9, 44, 94, 170, 269,
-  350, 372, 353, 360, 430, 523, 562, 524, 461, 435, 455, 495,
-  531, 560, 573, 571, 575, 620, 713, 815, 884, 916, 941, 987,
-  1055, 1129, 1185, 1198, 1160, 1102, 1080, 1118, 1182, 1213, 1192, 1155,
-  1144, 1174, 1233, 1304, 1366, 1400, 1410, 1437, 1518, 1631, 1705, 1696,
-  1643, 1622, 1658, 1707, 1715, 1682, 1644, 1619, 1590, 1551, 1526, 1534,
-  1554, 1545, 1510, 1505, 1574, 1683, 1756, 1759, 1738, 1756, 1813, 1859,
-  1862, 1850, 1859, 1876, 1862, 1816, 1781, 1781, 1781, 1735, 1657, 1605,
-  1604, 1615, 1593, 1556, 1551, 1585, 1612, 1608, 1607, 1648, 1707, 1719,
-  1668, 1620, 1635, 1685, 1699, 1658, 1618, 1620, 1629, 1588, 1508, 1461,
-  1477, 1503, 1473, 1407, 1389, 1459, 1563, 1607, 1563, 1481, 1433, 1448,
-  1500, 1543, 1544, 1511, 1484, 1496, 1548, 1601, 1620, 1590, 1513, 1405,
-  1305, 1263, 1290, 1323, 1275, 1142, 1015, 981, 1014, 1002, 887, 732,
-  636, 619, 629, 625, 620, 623, 597, 514, 423, 407, 470, 511,
-  436, 276, 145, 109, 116, 82, -18, -148, -275, -387, -465, -486,
-  -468, -477, -549, -637, -661, -614, -568, -584, -644, -696, -727, -758,
-  -788, -797, -805, -875, -1027, -1180, -1236, -1212, -1221, -1326, -1452, -1486,
-  -1425, -1371, -1396, -1456, -1473, -1442, -1425, -1445, -1458, -1428, -1387, -1394,
-  -1445, -1487, -1488, -1477, -1504, -1567, -1628, -1661, -1675, -1687, -1703, -1723,
-  -1749, -1771, -1770, -1741, -1705, -1694, -1711, -1727, -1719, -1703, -1706, -1736,
-  -1771, -1792, -1797, -1793, -1787, -1781, -1784, -1792, -1793, -1774, -1743, -1719,
-  -1713, -1718, -1723, -1726, -1731, -1729, -1715, -1701, -1714, -1754, -1789, -1793,
-  -1782, -1789, -1822, -1848, -1832, -1782, -1733, -1706, -1696, -1690, -1681, -1663,
-  -1628, -1580, -1543, -1530, -1529, -1513, -1477, -1448, -1444, -1454, -1457, -1454,
-  -1457, -1464, -1452, -1415, -1383, -1382, -1399, -1392, -1346, -1293, -1270, -1272,
-  -1261, -1210, -1134, -1064, -1018, -989, -959, -914, -855, -802, -775, -779,
-  -792, -793, -781, -780, -803, -834, -847, -838, -827, -821, -802, -750,
-  -675, -605, -547, -479, -380, -265, -165, -91, -26, 44, 108, 148,
-  161, 156, 134, 93, 47, 18, 13, 6, -21, -49, -34, 37,
-  133, 222, 308, 413, 532, 636, 716, 785, 851, 892, 883, 840,
-  799, 775, 743, 673, 573, 481, 428, 417, 435, 468, 513, 572,
-  660, 783, 932, 1078, 1197, 1293, 1383, 1469, 1533, 1560, 1551, 1516,
-  1464, 1403, 1349, 1318, 1304, 1280, 1230, 1176, 1159, 1203, 1289, 1377,
-  1447, 1507, 1578, 1666, 1758, 1835, 1887, 1913, 1917, 1906, 1890, 1873,
-  1841, 1774, 1673, 1576, 1527, 1533, 1557, 1554, 1526, 1516, 1559, 1639,
-  1705, 1726, 1718, 1722, 1762, 1824, 1871, 1875, 1844, 1801, 1768, 1739,
-  1693, 1620, 1546, 1499, 1487, 1488, 1480, 1470, 1469, 1471, 1454, 1426,
-  1419, 1453, 1495, 1495, 1455, 1425, 1440, 1466, 1443, 1365, 1285, 1249,
-  1236, 1201, 1138, 1087, 1076, 1085, 1082, 1073, 1088, 1133, 1176, 1193,
-  1194, 1207, 1237, 1266, 1282, 1293, 1308, 1312, 1284, 1227, 1173, 1146,
-  1133, 1100, 1035, 967, 937, 950, 966, 944, 897, 872, 890, 912,
-  885, 811, 753, 753, 777, 754, 674, 597, 570, 559, 494, 371,
-  264, 229, 233, 197, 107, 25, 4, 19, 6, -49, -99, -111,
-  -114, -154, -230, -301, -346, -384, -432, -476, -496, -507, -545, -617,
-  -689, -732, -757, -795, -843, -867, -857, -847, -870, -918, -952, -962,
-  -987, -1057, -1150, -1217, -1243, -1267, -1330, -1427, -1511, -1556, -1579, -1612,
-  -1663, -1700, -1698, -1666, -1639, -1636, -1636, -1607, -1549, -1499, -1489, -1504,
-  -1503, -1475, -1457, -1492, -1570, -1643, -1677, -1681, -1687, -1705, -1726, -1743,
-  -1757, -1764, -1758, -1741, -1726, -1716, -1697, -1655, -1604, -1573, -1568, -1570,
-  -1566, -1564, -1577, -1599, -1616, -1629, -1656, -1698, -1737, -1753, -1754, -1759,
-  -1775, -1788, -1779, -1747, -1705, -1669, -1645, -1629, -1610, -1577, -1538, -1511,
-  -1507, -1513, -1509, -1490, -1471, -1470, -1482, -1490, -1486, -1474, -1462, -1449,
-  -1432, -1422, -1427, -1437, -1427, -1387, -1336, -1300, -1276, -1239, -1178, -1125,
-  -1113, -1134, -1143, -1113, -1061, -1018, -984, -937, -879, -839, -838, -855,
-  -856, -839, -826, -824, -808, -761, -700, -658, -637, -607, -548, -480,
-  -431, -404, -375, -330, -281, -251, -245, -250, -252, -246, -237, -228,
-  -220, -219, -228, -240, -237, -207, -158, -117, -91, -59, 6, 99,
-  176, 207, 208, 224, 271, 320, 341, 341, 358, 402, 441, 442,
-  416, 399, 411, 430, 438, 446, 481, 551, 634, 705, 765, 819,
-  866, 902, 936, 982, 1031, 1054, 1043, 1024, 1030, 1055, 1062, 1033,
-  998, 988, 999, 1007, 1014, 1051, 1127, 1214, 1278, 1325, 1385, 1465,
-  1537, 1579, 1600, 1619, 1635, 1631, 1602, 1559, 1510, 1460, 1413, 1381,
-  1362, 1343, 1323, 1324, 1361, 1414, 1453, 1486, 1553, 1668, 1788, 1858,
-  1874, 1876, 1883, 1874, 1820, 1730, 1631, 1539, 1457, 1400, 1386, 1403,
-  1413, 1400, 1388, 1407, 1443, 1466, 1479, 1528, 1628, 1727, 1765, 1753,
-  1760, 1807, 1825, 1738, 1569, 1422, 1360, 1341, 1292, 1209, 1157, 1177,
-  1238, 1290, 1320, 1350, 1386, 1411, 1413, 1402, 1398, 1402, 1412, 1420,
-  1405, 1345, 1245, 1152, 1099, 1066, 1002, 907, 852, 890, 980, 1033,
-  1033, 1050, 1139, 1253, 1295, 1258, 1230, 1273, 1335, 1317, 1205, 1095,
-  1066, 1085, 1050, 921, 767, 674, 652, 637, 585, 518, 487, 504,
-  534, 541, 536, 546, 573, 584, 550, 488, 433, 398, 354, 268,
-  154, 58, 5, -35, -111, -229, -340, -389, -379, -359, -362, -373,
-  -361, -325, -300, -311, -349, -395, -446, -515, -598, -668, -709, -737,
-  -787, -866, -949, -1003, -1029, -1048, -1075, -1100, -1104, -1082, -1050, -1022,
-  -1007, -1002, -1012, -1042, -1088, -1142, -1198, -1260, -1331, -1404, -1460, -1493,
-  -1512, -1527, -1529, -1510, -1482, -1473, -1489, -1504, -1487, -1443, -1409, -1407,
-  -1411, -1388, -1344, -1323, -1353, -1416, -1479, -1529, -1577, -1627, -1661, -1661,
-  -1638, -1611, -1583, -1545, -1494, -1445, -1409, -1385, -1362, -1338, -1317, -1303,
-  -1296, -1302, -1324, -1350, -1365, -1366, -1378, -1419, -1479, -1521, -1531, -1523,
-  -1520, -1520, -1499, -1450, -1390, -1341, -1310, -1286, -1262, -1239, -1228, -1240,
-  -1272, -1309, -1328, -1325, -1325, -1356, -1406, -1429, -1397, -1338, -1302, -1297,
-  -1276, -1205, -1111, -1050, -1032, -1016, -970, -919, -910, -939, -958, -942,
-  -922, -947, -1003, -1033, -1002, -939, -896, -884, -871, -831, -768, -693,
-  -607, -517, -447, -419, -423, -427, -423, -432, -464, -492, -480, -434,
-  -391, -371, -360, -341, -331, -350, -379, -371, -313, -243, -202, -172,
-  -98, 36, 170, 230, 206, 165, 166, 192, 180, 105, 19, -6,
-  43, 115, 168, 206, 259, 324, 373, 401, 431, 482, 531, 549,
-  548, 573, 641, 712, 738, 714, 680, 665, 660, 647, 622, 604,
-  609, 640, 697, 772, 850, 912, 960, 1010, 1065, 1101, 1094, 1056,
-  1018, 997, 974, 936, 910, 940, 1023, 1097, 1114, 1096, 1109, 1167,
-  1217, 1215, 1194, 1222, 1309, 1384, 1388, 1341, 1305, 1300, 1282, 1225,
-  1165, 1155, 1194, 1238, 1261, 1281, 1330, 1399, 1454, 1468, 1449, 1423,
-  1409, 1410, 1409, 1383, 1328, 1271, 1244, 1246, 1241, 1204, 1156, 1144,
-  1181, 1222, 1225, 1206, 1218, 1286, 1370, 1409, 1388, 1347, 1323, 1307,
-  1261, 1176, 1088, 1035, 1020, 1015, 1005, 999, 1010, 1032, 1042, 1035,
-  1024, 1026, 1039, 1045, 1034, 1014, 1000, 996, 986, 954, 902, 852,
-  823, 806, 782, 744, 710, 700, 710, 722, 733, 755, 790, 816,
-  813, 789, 768, 757, 740, 705, 664, 638, 623, 599, 562, 532,
-  520, 507, 469, 418, 395, 414, 434, 411, 360, 351, 419, 506,
-  521, 444, 347, 297, 269, 193, 56, -63, -95, -68, -56, -78,
-  -73, -2, 80, 85, 7, -73, -92, -84, -124, -216, -288, -284,
-  -235, -221, -275, -358, -414, -440, -468, -523, -593, -647, -674, -689,
-  -714, -752, -783, -785, -763, -756, -798, -878, -944, -970, -983, -1026,
-  -1088, -1101, -1030, -928, -887, -929, -985, -991, -964, -973, -1034, -1091,
-  -1091, -1054, -1037, -1054, -1068, -1057, -1053, -1093, -1163, -1211, -1208, -1179,
-  -1168, -1183, -1199, -1184, -1128, -1044, -965, -923, -931, -968, -1002, -1029,
-  -1076, -1155, -1236, -1270, -1248, -1210, -1191, -1184, -1164, -1137, -1133, -1161,
-  -1181, -1157, -1098, -1050, -1037, -1037, -1017, -979, -955, -964, -998, -1037,
-  -1071, -1104, -1139, -1171, -1190, -1184, -1150, -1101, -1058, -1025, -992, -952,
-  -916, -909, -928, -946, -940, -914, -891, -881, -880, -886, -902, -920,
-  -923, -907, -889, -886, -885, -852, -780, -707, -675, -686, -698, -680,
-  -644, -625, -644, -681, -706, -703, -679, -647, -614, -573, -516, -447,
-  -380, -332, -306, -292, -276, -259, -249, -243, -226, -192, -164, -169,
-  -200, -219, -201, -171, -169, -195, -201, -151, -65, 4, 36, 59,
-  102, 156, 189, 188, 169, 152, 149, 159, 187, 226, 261, 279,
-  279, 262, 230, 190, 167, 173, 196, 208, 218, 270, 383, 506,
-  565, 541, 495, 487, 508, 501, 439, 363, 330, 347, 377, 393,
-  404, 435, 486, 538, 576, 609, 652, 708, 762, 797, 811, 816,
-  825, 840, 847, 835, 808, 785, 775, 761, 723, 667, 628, 632,
-  668, 709, 750, 810, 900, 987, 1025, 1008, 974, 962, 968, 960,
-  926, 886, 858, 836, 797, 740, 691, 671, 680, 702, 731, 770,
-  821, 873, 911, 925, 918, 907, 904, 912, 919, 919, 919, 927,
-  935, 919, 876, 837, 832, 850, 850, 812, 770, 771, 818, 870,
-  897, 915, 958, 1020, 1058, 1041, 981, 911, 842, 763, 673, 598,
-  561, 561, 570, 570, 562, 552, 542, 537, 550, 593, 661, 730,
-  782, 815, 841, 863, 872, 859, 825, 781, 741, 708, 672, 622,
-  556, 487, 430, 391, 360, 333, 322, 342, 386, 428, 454, 478,
-  521, 573, 605, 600, 577, 564, 562, 548, 509, 460, 421, 384,
-  325, 239, 153, 104, 94, 95, 82, 61, 64, 105, 161, 199,
-  212, 225, 251, 271, 254, 202, 151, 123, 97, 36, -62, -151,
-  -197, -217, -262, -342, -417, -435, -400, -354, -330, -316, -290, -257,
-  -238, -238, -232, -209, -194, -223, -296, -372, -416, -439, -474, -529,
-  -577, -585, -554, -509, -475, -458, -449, -437, -410, -373, -347, -355,
-  -393, -439, -479, -525, -588, -659, -708, -729, -742, -765, -790, -795,
-  -781, -769, -772, -774, -758, -728, -703, -693, -697, -715, -755, -810,
-  -856, -875, -879, -891, -913, -917, -889, -850, -838, -858, -875, -853,
-  -790, -714, -647, -593, -560, -562, -609, -683, -758, -821, -879, -927,
-  -947, -922, -869, -821, -799, -792, -782, -766, -750, -726, -683, -630,
-  -592, -586, -598, -608, -614, -630, -657, -680, -685, -684, -693, -709,
-  -713, -695, -674, -662, -653, -632, -603, -588, -594, -603, -598, -588,
-  -594, -618, -636, -632, -615, -610, -622, -633, -621, -588, -551, -526,
-  -515, -505, -485, -454, -424, -412, -427, -454, -476, -489, -501, -515,
-  -512, -475, -411, -357, -336, -335, -320, -275, -221, -182, -157, -127,
-  -88, -66, -84, -137, -192, -220, -216, -195, -166, -131, -96, -67,
-  -49, -40, -36, -39, -48, -54, -43, -17, 10, 29, 40, 47,
-  42, 19, -15, -42, -51, -46, -33, -12, 26, 79, 130, 163,
-  175, 179, 189, 214, 253, 301, 350, 400, 453, 500, 524, 515,
-  479, 440, 412, 393, 382, 380, 394, 413, 420, 413, 412, 441,
-  496, 554, 596, 623, 644, 654, 633, 574, 499, 441, 423, 437,
-  463, 492, 526, 563, 590, 590, 568, 545, 532, 522, 508, 504,
-  536, 600, 658, 669, 632, 579, 538, 500, 443, 374, 329, 340,
-  402, 481, 550, 612, 679, 753, 816, 847, 838, 794, 728, 647,
-  558, 468, 393, 347, 332, 329, 317, 289, 262, 258, 280, 310,
-  341, 392, 485, 603, 699, 738, 737, 734, 739, 721, 657, 571,
-  509, 491, 492, 485, 476, 483, 508, 530, 537, 548, 584, 633,
-  660, 642, 597, 564, 563, 579, 584, 568, 547, 550, 582, 620,
-  629, 597, 546, 510, 500, 498, 480, 442, 399, 366, 342, 321,
-  309, 317, 344, 365, 358, 326, 291, 270, 255, 227, 185, 149,
-  139, 152, 166, 166, 160, 164, 181, 196, 191, 169, 140, 115,
-  90, 63, 46, 57, 98, 147, 180, 190, 182, 157, 107, 27,
-  -66, -145, -187, -189, -162, -114, -54, 8, 57, 82, 75, 40,
-  -15, -82, -155, -228, -288, -316, -305, -273, -244, -226, -205, -175,
-  -154, -169, -221, -278, -312, -328, -348, -382, -410, -413, -394, -373,
-  -364, -364, -367, -377, -402, -447, -503, -552, -577, -568, -527, -465,
-  -393, -321, -261, -228, -232, -265, -308, -351, -395, -444, -489, -519,
-  -535, -556, -589, -614, -603, -554, -492, -444, -406, -360, -311, -289,
-  -312, -359, -388, -382, -360, -349, -347, -338, -321, -318, -351, -415,
-  -493, -563, -614, -635, -621, -581, -529, -473, -410, -342, -282, -241,
-  -221, -215, -223, -244, -272, -298, -324, -367, -432, -497, -530, -526,
-  -509, -502, -503, -492, -466, -439, -421, -407, -386, -357, -332, -313,
-  -300, -291, -297, -328, -384, -451, -509, -548, -568, -578, -574, -544,
-  -479, -394, -323, -290, -292, -303, -306, -305, -309, -317, -316, -306,
-  -295, -291, -293, -298, -308, -320, -323, -306, -269, -224, -182, -137,
-  -89, -48, -29, -36, -52, -68, -88, -118, -151, -163, -144, -108,
-  -80, -73, -75, -69, -51, -31, -21, -18, -13, 0, 16, 22,
-  15, 6, 9, 25, 40, 41, 37, 50, 79, 100, 92, 70,
-  74, 121, 180, 203, 180, 152, 155, 179, 182, 144, 91, 65,
-  79, 110, 132, 137, 135, 133, 129, 117, 104, 106, 140, 203,
-  272, 317, 332, 334, 335, 320, 267, 184, 111, 85, 97, 110,
-  110, 118, 167, 253, 344, 411, 450, 472, 473, 443, 378, 297,
-  225, 180, 161, 160, 172, 193, 220, 241, 245, 233, 219, 224,
-  251, 284, 308, 321, 332, 342, 340, 321, 298, 291, 309, 339,
-  366, 386, 401, 406, 391, 345, 277, 209, 154, 116, 91, 83,
-  104, 161, 247, 339, 416, 471, 509, 536, 540, 506, 434, 345,
-  267, 212, 174, 149, 141, 154, 185, 224, 263, 294, 306, 287,
-  246, 208, 195, 207, 230, 260, 301, 352, 391, 397, 367, 321,
-  278, 237, 196, 165, 158, 176, 207, 237, 265, 290, 307, 311,
-  304, 296, 288, 272, 247, 218, 200, 194, 191, 188, 192, 211,
-  237, 251, 242, 212, 169, 119, 63, 7, -36, -59, -63, -56,
-  -41, -20, 7, 36, 64, 88, 106, 115, 117, 112, 100, 80,
-  60, 49, 51, 63, 76, 89, 110, 138, 158, 153, 121, 74,
-  25, -24, -75, -127, -170, -196, -199, -179, -145, -111, -89, -78,
-  -68, -53, -36, -24, -18, -20, -42, -93, -165, -232, -271, -278,
-  -263, -232, -183, -121, -68, -47, -62, -105, -164, -228, -285, -313,
-  -306, -273, -235, -202, -172, -144, -127, -128, -145, -167, -189, -213,
-  -245, -275, -292, -289, -272, -254, -244, -245, -253, -265, -283, -311,
-  -346, -379, -401, -413, -422, -426, -413, -374, -315, -255, -202, -154,
-  -110, -82, -88, -131, -188, -230, -243, -237, -228, -222, -217, -222,
-  -248, -296, -348, -384, -396, -393, -378, -347, -294, -237, -198, -186,
-  -186, -178, -162, -155, -169, -197, -229, -259, -288, -315, -338, -353,
-  -364, -371, -367, -341, -292, -235, -193, -175, -175, -176, -179, -195,
-  -233, -278, -303, -297, -278, -269, -277, -294, -307, -313, -312, -296,
-  -260, -211, -159, -115, -79, -51, -33, -24, -25, -36, -58, -86,
-  -113, -134, -146, -149, -143, -126, -108, -102, -108, -117, -120, -119,
-  -118, -112, -84, -32, 24, 53, 46, 18, -10, -34, -59, -81,
-  -89, -66, -15, 49, 105, 141, 148, 124, 74, 9, -56, -110,
-  -149, -168, -162, -134, -91, -47, -6, 37, 86, 136, 174, 192,
-  189, 168, 136, 101, 75, 68, 77, 93, 111, 131, 148, 142,
-  94, 9, -81, -141, -162, -160, -145, -112, -49, 36, 118, 176,
-  210, 232, 245, 242, 218, 186, 163, 153, 147, 133, 110, 89,
-  78, 79, 84, 87, 79, 61, 43, 40, 54, 77, 99, 124,
-  162, 213, 263, 300, 326, 350, 370, 367, 326, 252, 163, 82,
-  20, -17, -29, -18, 9, 44, 77, 100, 106, 95, 81, 83,
-  113, 164, 223, 282, 340, 390, 420, 421, 398, 365, 331, 294,
-  248, 195, 146, 110, 85, 64, 44, 28, 17, 7, -1, -2,
-  9, 33, 62, 82, 89, 92, 102, 121, 135, 131, 109, 83,
-  62, 39, 5, -35, -59, -51, -17, 22, 51, 68, 83, 96,
-  102, 92, 66, 29, -9, -38, -53, -54, -44, -24, 8, 53,
-  101, 135, 145, 126, 82, 26, -26, -66, -89, -98, -93, -70,
-  -29, 24, 76, 119, 145, 150, 133, 99, 62, 31, 3, -32,
-  -72, -108, -131, -136, -123, -93, -49, 1, 46, 82, 112, 129,
-  122, 82, 19, -37, -62, -57, -43, -39, -49, -59, -62, -56,
-  -42, -19, 12, 43, 63, 65, 52, 26, -13, -66, -123, -166,
-  -179, -159, -120, -75, -29, 22, 76, 124, 154, 163, 155, 133,
-  96, 41, -20, -69, -93, -93, -78, -53, -20, 19, 57, 88,
-  110, 118, 106, 70, 18, -34, -77, -114, -153, -186, -199, -180,
-  -132, -73, -22, 12, 26, 24, 14, -1, -20, -42, -56, -54,
-  -39, -21, -7, 4, 8, -3, -37, -88, -132, -154, -160, -164,
-  -167, -158, -134, -111, -101, -95, -71, -25, 21, 47, 52, 49,
-  43, 19, -27, -81, -123, -144, -157, -168, -173, -162, -136, -106,
-  -78, -53, -23, 20, 73, 127, 171, 195, 192, 165, 119, 62,
-  5, -41, -70, -78, -63, -29, 12, 37, 30, -10, -68, -123,
-  -164, -182, -166, -114, -33, 52, 120, 162, 175, 155, 105, 35,
-  -34, -86, -120, -137, -138, -120, -84, -46, -25, -27, -49, -76,
-  -101, -119, -124, -113, -85, -45, -3, 36, 70, 99, 122, 137,
-  138, 124, 105, 90, 86, 90, 90, 84, 76, 70, 64, 49,
-  27, 2, -21, -45, -70, -89, -94, -83, -63, -41, -16, 8,
-  26, 33, 34, 38, 53, 73, 91, 104, 112, 119, 127, 134,
-  138, 134, 120, 98, 74, 52, 31, 8, -11, -20, -18, -13,
-  -10, -9, -6, -4, -7, -10, 2, 37, 84, 121, 136, 129,
-  109, 77, 34, -17, -64, -99, -119, -125, -120, -107, -91, -79,
-  -77, -84, -101, -127, -153, -165, -149, -100, -28, 49, 114, 150,
-  147, 102, 28, -51, -116, -156, -175, -175, -154, -114, -71, -47,
-  -52, -77, -100, -111, -111, -107, -95, -71, -43, -29, -36, -51,
-  -57, -48, -35, -30, -32, -40, -55, -80, -107, -120, -111, -88,
-  -67, -54, -43, -33, -34, -54, -86, -105, -91, -42, 19, 65,
-  86, 87, 82, 72, 53, 22, -16, -49, -72, -88, -99, -102,
-  -90, -65, -39, -23, -18, -17, -15, -14, -18, -28, -38, -47,
-  -59, -73, -88, -96, -96, -84, -61, -28, 1, 15, 13, 6,
-  10, 25, 42, 50, 46, 32, 8, -23, -51, -68, -71, -65,
-  -51, -31, -4, 25, 50, 66, 73, 69, 57, 41, 23, -2,
-  -38, -79, -111, -119, -106, -88, -76, -70, -62, -49, -39, -35,
-  -30, -14, 17, 50, 75, 91, 111, 139, 162, 162, 133, 87,
-  39, -10, -60, -99, -111, -91, -58, -33, -21, -11, 3, 12,
-  7, -10, -23, -24, -17, -10, 0, 18, 42, 63, 73, 77,
-  77, 72, 55, 25, -11, -41, -66, -86, -98, -98, -83, -63,
-  -45, -29, -15, -4, 0, -3, -8, -11, -15, -19, -16, 2,
-  29, 50, 54, 43, 29, 23, 31, 56, 94, 133, 160, 168,
-  157, 133, 99, 64, 43, 45, 64, 89, 111, 132, 149, 154,
-  144, 127, 115, 108, 98, 77, 51, 28, 11, 0, -1, 17,
-  51, 88, 116, 130, 127, 101, 50, -13, -67, -95, -102, -97,
-  -80, -46, 3, 47, 67, 62, 45, 28, 11, -6, -17, -13,
-  5, 25, 30, 18, -7, -38, -69, -91, -97, -87, -66, -43,
-  -25, -14, -10, -13, -19, -25, -31, -39, -47, -47, -36, -19,
-  -7, -6, -12, -20, -28, -41, -61, -87, -113, -136, -152, -157,
-  -144, -110, -62, -11, 34, 70, 98, 116, 115, 93, 61, 36,
-  24, 18, 6, -7, -15, -20, -31, -52, -70, -66, -42, -14,
-  7, 22, 37, 46, 34, 0, -38, -61, -64, -57, -47, -32,
-  -13, 5, 14, 13, 5, -7, -20, -35, -48, -57, -59, -48,
-  -26, 0, 20, 29, 30, 27, 18, -3, -28, -42, -33, -3,
-  35, 68, 91, 101, 94, 71, 39, 3, -33, -65, -89, -94,
-  -83, -64, -42, -11, 31, 72, 94, 89, 65, 35, 6, -20,
-  -36, -34, -15, 5, 12, 6, -8, -32, -70, -113, -138, -129,
-  -94, -57, -32, -15, 0, 6, -3, -21, -32, -26, -10, 3,
-  10, 15, 19, 18, 12, 6, 5, 6, -2, -20, -43, -65,
-  -83, -96, -97, -80, -41, 12, 62, 96, 107, 101, 87, 74,
-  65, 64, 72, 86, 98, 104, 100, 92, 80, 69, 64, 73,
-  96, 119, 128, 117, 94, 68, 39, 5, -25, -35, -16, 25,
-  73, 114, 146, 166, 168, 144, 98, 43, -4, -38, -60, -73,
-  -73, -59, -36, -17, -14, -25, -41, -52, -57, -56, -46, -19,
-  26, 76, 112, 125, 117, 90, 40, -33, -115, -182, -210, -193,
-  -140, -67, 9, 67, 88, 62, -3, -83, -151, -192, -198, -167,
-  -105, -27, 50, 112, 148, 153, 129, 83, 28, -27, -79, -123,
-  -151, -145, -101, -30, 47, 109, 144, 146, 114, 55, -10, -65,
-  -97, -102, -83, -46, -1, 37, 61, 74, 82, 86, 81, 63,
-  34, 3, -21, -36, -42, -40, -31, -17, -1, 13, 19, 13,
-  -2, -18, -31, -40, -46, -50, -51, -47, -41, -34, -28, -19,
-  -5, 17, 47, 82, 118, 147, 165, 167, 149, 112, 60, 8,
-  -28, -40, -32, -17, -4, 6, 11, 8, -4, -23, -43, -60,
-  -75, -89, -98, -95, -79, -57, -34, -10, 18, 50, 76, 87,
-  82, 71, 63, 56, 39, 7, -35, -74, -103, -123, -134, -133,
-  -112, -76, -38, -15, -9, -13, -18, -22, -29, -40, -50, -53,
-  -48, -36, -16, 9, 30, 35, 23, 0, -25, -49, -74, -99,
-  -114, -110, -87, -58, -38, -30, -29, -30, -35, -46, -62, -73,
-  -72, -62, -51, -42, -31, -15, -1, 5, 2, -5, -14, -26,
-  -39, -45, -37, -14, 13, 31, 38, 31, 14, -8, -31, -52,
-  -69, -81, -81, -64, -34, -2, 19, 27, 29, 30, 32, 30,
-  24, 16, 8, 4, 10, 32, 68, 113, 157, 191, 202, 184,
-  139, 79, 17, -37, -77, -96, -89, -59, -18, 20, 49, 70,
-  88, 99, 101, 98, 100, 108, 113, 105, 87, 66, 44, 19,
-  -10, -34, -46, -42, -31, -16, 0, 13, 22, 26, 27, 23,
-  13, -1, -12, -12, 0, 14, 20, 16, 3, -20, -51, -85,
-  -114, -131, -136, -132, -112, -74, -23, 26, 57, 66, 61, 51,
-  40, 30, 26, 30, 44, 62, 77, 88, 94, 93, 79, 49,
-  8, -35, -65, -80, -82, -72, -54, -31, -7, 11, 21, 26,
-  32, 43, 57, 73, 87, 92, 87, 72, 49, 23, -4, -29,
-  -47, -56, -58, -59, -63, -64, -54, -28, 10, 50, 81, 100,
-  108, 106, 95, 82, 71, 72, 83, 97, 105, 102, 87, 60,
-  25, -15, -55, -89, -113, -126, -130, -124, -106, -75, -37, -6,
-  9, 7, -4, -20, -41, -64, -80, -81, -72, -63, -60, -60,
-  -60, -59, -63, -72, -82, -90, -95, -97, -90, -70, -37, 5,
-  50, 92, 122, 127, 103, 60, 16, -16, -36, -45, -42, -28,
-  -14, -10, -18, -34, -52, -71, -91, -102, -93, -65, -30, 2,
-  27, 46, 57, 53, 32, 4, -20, -31, -24, 3, 46, 90,
-  117, 115, 87, 40, -17, -78, -132, -167, -174, -151, -107, -51,
-  6, 56, 87, 96, 83, 56, 24, -5, -29, -44, -47, -35,
-  -7, 25, 48, 53, 41, 19, -7, -33, -59, -78, -81, -67,
-  -45, -22, -6, 3, 9, 14, 19, 27, 41, 59, 79, 96,
-  106, 104, 88, 59, 23, -10, -33, -48, -60, -67, -64, -48,
-  -25, -7, 1, 2, -1, -7, -19, -33, -41, -37, -20, 2,
-  21, 33, 34, 18, -12, -46, -68, -71, -58, -37, -16, 0,
-  10, 12, 5, -8, -19, -22, -17, -8, 6, 21, 31, 31,
-  24, 18, 17, 19, 17, 8, -6, -20, -36, -54, -70, -74,
-  -61, -34, 0, 33, 61, 82, 95, 98, 89, 72, 53, 38,
-  25, 13, 1, -6, -5, 2, 8, 8, 4, 2, 4, 6,
-  8, 9, 10, 13, 18, 25, 30, 32, 32, 31, 29, 23,
-  12, -1, -12, -19, -24, -27, -29, -31, -33, -42, -56, -71,
-  -81, -82, -72, -52, -27, -3, 19, 36, 46, 44, 27, -3,
-  -36, -67, -89, -97, -86, -55, -13, 29, 59, 74, 71, 50,
-  13, -29, -61, -72, -57, -23, 19, 57, 76, 73, 52, 21,
-  -8, -31, -46, -55, -56, -50, -41, -30, -20, -15, -12, -6,
-  10, 35, 61, 76, 76, 67, 57, 48, 34, 12, -16, -35,
-  -38, -28, -11, 8, 28, 47, 60, 65, 61, 55, 52, 54,
-  63, 78, 95, 109, 116, 113, 101, 81, 53, 25, 2, -13,
-  -19, -18, -14, -12, -16, -23, -31, -35, -41, -55, -74, -87,
-  -85, -70, -50, -32, -14, 2, 11, 5, -13, -33, -46, -49,
-  -41, -21, 6, 30, 43, 42, 31, 12, -13, -41, -63, -73,
-  -71, -61, -46, -29, -14, -5, -3, -3, -2, 2, 7, 8,
-  6, 0, -9, -18, -22, -16, -6, 2, 7, 11, 15, 19,
-  18, 11, -2, -18, -35, -49, -56, -57, -55, -49, -39, -25,
-  -9, 4, 12, 14, 15, 12, 4, -6, -16, -22, -23, -20,
-  -13, -3, 10, 23, 35, 43, 42, 30, 9, -16, -39, -56,
-  -61, -54, -40, -24, -7, 10, 26, 36, 35, 25, 13, 5,
-  4, 7, 12, 20, 29, 38, 45, 47, 42, 33, 27, 29,
-  37, 46, 51, 49, 44, 36, 25, 9, -7, -18, -23, -24,
-  -22, -16, -7, 2, 7, 9, 10, 9, 1, -17, -45, -74,
-  -96, -105, -100, -83, -57, -25, 9, 40, 63, 72, 64, 43,
-  15, -13, -36, -52, -58, -52, -36, -16, 4, 22, 38, 49,
-  53, 48, 38, 29, 24, 24, 29, 41, 57, 75, 92, 101,
-  97, 80, 54, 26, 2, -18, -33, -42, -42, -36, -31, -28,
-  -24, -17, -11, -11, -16, -19, -18, -16, -19, -25, -28, -23,
-  -14, -8, -6, -4, 0, 3, 4, 4, 3, -2, -12, -26,
-  -41, -56, -69, -78, -79, -71, -60, -50, -41, -32, -23, -17,
-  -13, -9, -3, 1, 1, -2, -2, 4, 14, 22, 26, 30,
-  34, 35, 29, 16, -2, -22, -41, -54, -56, -46, -29, -12,
-  1, 11, 19, 26, 32, 35, 36, 35, 33, 36, 47, 65,
-  80, 86, 86, 83, 78, 70, 60, 53, 51, 52, 52, 49,
-  49, 47, 38, 22, 5, -3, -1, 4, 7, 10, 12, 10,
-  1, -15, -32, -46, -55, -59, -55, -41, -24, -12, -9, -13,
-  -22, -37, -56, -76, -91, -97, -90, -72, -46, -20, -3, 3,
-  0, -6, -14, -22, -29, -34, -33, -29, -21, -7, 11, 28,
-  37, 36, 25, 9, -9, -26, -39, -44, -41, -28, -12, 0,
-  2, -7, -23, -40, -51, -50, -39, -21, 0, 18, 30, 35,
-  31, 21, 11, 6, 6, 10, 16, 24, 36, 49, 59, 65,
-  67, 66, 60, 46, 27, 8, -7, -16, -13, 3, 29, 53,
-  63, 55, 36, 14, -5, -18, -22, -16, -2, 17, 33, 42,
-  43, 33, 18, 2, -11, -23, -31, -33, -26, -12, 1, 8,
-  8, 5, -3, -14, -25, -29, -24, -12, 6, 28, 51, 68,
-  73, 64, 45, 20, -9, -40, -66, -80, -83, -77, -64, -46,
-  -28, -17, -16, -21, -28, -35, -40, -39, -27, -7, 13, 22,
-  19, 7, -10, -30, -52, -68, -73, -66, -53, -38, -21, -3,
-  14, 25, 29, 26, 17, 2, -16, -32, -39, -36, -27, -15,
-  -2, 11, 19, 20, 16, 10, 4, -2, -6, -5, 2, 10,
-  15, 17, 17, 16, 13, 7, 3, 6, 14, 25, 35, 45,
-  52, 54, 46, 31, 13, -5, -25, -41, -44, -27, 6, 42,
-  75, 100, 110, 98, 64, 19, -19, -39, -41, -30, -10, 20,
-  53, 81, 96, 97, 84, 59, 26, -8, -38, -60, -75, -83,
-  -83, -72, -52, -31, -14, -5, -1, 0, 2, 6, 11, 12,
-  6, -3, -10, -10, -4, 4, 15, 30, 47, 56, 50, 26,
-  -9, -45, -75, -92, -94, -81, -58, -31, -3, 23, 44, 56,
-  59, 56, 53, 51, 49, 45, 38, 31, 23, 15, 8, 2,
-  -5, -12, -15, -14, -10, -8, -9, -11, -11, -8, -4, 1,
-  7, 16, 23, 27, 31, 38, 45, 48, 43, 32, 16, -2,
-  -20, -38, -53, -64, -68, -66, -58, -46, -31, -16, -2, 7,
-  9, 8, 8, 10, 8, -1, -12, -19, -22, -25, -31, -36,
-  -33, -22, -11, -7, -9, -14, -18, -20, -21, -23, -22, -16,
-  -5, 11, 27, 36, 39, 39, 39, 37, 30, 15, -3, -21,
-  -36, -49, -58, -61, -59, -57, -55, -51, -44, -35, -27, -21,
-  -16, -12, -6, 0, 4, 5, 3, -2, -8, -16, -26, -37,
-  -44, -43, -36, -28, -19, -10, -2, 2, 2, -2, -8, -11,
-  -11, -6, 3, 16, 31, 44, 52, 55, 49, 35, 15, -7,
-  -29, -44, -45, -31, -9, 12, 24, 27, 25, 19, 11, 2,
-  -5, -7, -6, -3, 2, 8, 14, 16, 13, 9, 7, 6,
-  8, 13, 21, 31, 40, 45, 45, 40, 30, 19, 13, 14,
-  21, 29, 37, 44, 49, 49, 45, 38, 30, 23, 19, 17,
-  16, 17, 20, 25, 30, 35, 40, 42, 40, 30, 14, -4,
-  -15, -18, -18, -19, -21, -20, -14, -7, -2, 0, 0, -1,
-  -6, -16, -30, -44, -57, -66, -69, -64, -52, -36, -20, -5,
-  8, 16, 20, 19, 15, 8, 1, -5, -7, -4, 4, 13,
-  18, 17, 9, -5, -23, -40, -54, -64, -71, -72, -65, -49,
-  -25, 1, 23, 37, 43, 42, 38, 36, 37, 39, 37, 30,
-  20, 10, 0, -9, -17, -19, -13, 0, 14, 23, 25, 22,
-  15, 4, -5, -9, -7, 0, 10, 21, 30, 35, 35, 33,
-  29, 25, 18, 9, -1, -10, -18, -25, -28, -25, -17, -7,
-  2, 9, 11, 7, -5, -23, -40, -52, -55, -52, -45, -34,
-  -20, -5, 7, 12, 12, 9, 5, 2, 0, -2, -5, -8,
-  -11, -12, -9, -2, 7, 13, 15, 12, 6, -1, -6, -4,
-  4, 17, 29, 38, 43, 44, 42, 37, 29, 20, 10, 0,
-  -11, -22, -34, -46, -55, -58, -53, -42, -29, -17, -9, -5,
-  -7, -12, -15, -15, -13, -11, -8, -1, 7, 13, 11, 2,
-  -11, -22, -30, -34, -35, -32, -26, -17, -8, -1, 1, -3,
-  -11, -20, -28, -33, -33, -27, -18, -8, 0, 4, 3, -3,
-  -11, -17, -18, -13, -7, -3, -3, -5, -9, -11, -10, -4,
-  4, 14, 27, 43, 59, 71, 75, 72, 64, 55, 45, 36,
-  30, 27, 25, 22, 20, 22, 26, 29, 28, 25, 20, 14,
-  7, 1, -1, 2, 9, 17, 22, 22, 17, 8, -2, -14,
-  -28, -43, -54, -56, -50, -40, -30, -23, -19, -19, -19, -18,
-  -13, -6, 1, 7, 11, 15, 16, 13, 7, -1, -9, -14,
-  -15, -12, -8, -3, 4, 12, 18, 20, 15, 5, -6, -14,
-  -18, -18, -10, 6, 27, 46, 59, 63, 57, 41, 19, -2,
-  -19, -29, -31, -29, -24, -19, -13, -6, 3, 11, 15, 12,
-  8, 5, 3, -2, -8, -8, 0, 14, 27, 36, 38, 34,
-  26, 15, 2, -8, -15, -18, -20, -22, -26, -31, -35, -35,
-  -29, -18, -5, 8, 15, 14, 7, -3, -13, -20, -24, -25,
-  -22, -16, -8, -1, 5, 10, 13, 12, 7, -3, -15, -27,
-  -37, -44, -45, -40, -28, -11, 8, 24, 32, 31, 22, 9,
-  -4, -17, -27, -33, -33, -28, -18, -6, 7, 17, 21, 19,
-  13, 4, -7, -17, -26, -31, -32, -30, -28, -28, -28, -27,
-  -24, -20, -17, -15, -13, -12, -11, -9, -6, -2, 4, 11,
-  20, 29, 35, 36, 32, 25, 17, 10, 4, -1, -6, -13,
-  -21, -28, -31, -31, -30, -28, -22, -12, 1, 13, 23, 31,
-  36, 38, 37, 33, 28, 24, 21, 19, 18, 18, 17, 12,
-  5, -2, -6, -8, -7, -4, 3, 12, 21, 29, 34, 36,
-  33, 28, 24, 24, 29, 35, 37, 35, 28, 19, 9, -1,
-  -10, -17, -22, -23, -20, -13, -4, 3, 7, 10, 10, 7,
-  0, -8, -15, -17, -15, -8, 2, 14, 25, 31, 31, 25,
-  13, -2, -19, -32, -36, -32, -25, -19, -16, -14, -13, -12,
-  -13, -14, -15, -13, -9, -3, 2, 4, 2, -3, -8, -9,
-  -8, -7, -7, -8, -9, -8, -5, -1, 2, 5, 9, 14,
-  20, 25, 27, 25, 22, 21, 23, 24, 24, 21, 17, 12,
-  8, 6, 5, 4, 3, 2, 2, 1, -2, -7, -14, -20,
-  -24, -27, -29, -29, -27, -23, -16, -8, 0, 3, 0, -9,
-  -21, -31, -37, -39, -36, -30, -23, -16, -10, -6, -4, -5,
-  -8, -11, -14, -15, -15, -13, -10, -8, -9, -11, -13, -13,
-  -12, -9, -3, 4, 10, 13, 13, 12, 10, 8, 6, 2,
-  -3, -7, -9, -7, -3, 2, 7, 12, 17, 21, 22, 19,
-  13, 7, 4, 5, 10, 16, 20, 19, 15, 9, 4, 1,
-  -1, -1, 0, 3, 7, 10, 12, 12, 12, 12, 13, 16,
-  19, 21, 22, 22, 23, 23, 23, 21, 18, 13, 7, 1,
-  -2, -2, 3, 11, 19, 26, 30, 30, 26, 20, 13, 6,
-  0, -4, -5, -3, 1, 5, 8, 8, 5, 0, -7, -15,
-  -22, -28, -31, -33, -33, -33, -34, -35, -35, -32, -26, -17,
-  -7, 1, 6, 9, 10, 10, 9, 8, 6, 5, 4, 4,
-  4, 4, 4, 3, 3, 3, 4, 5, 7, 8, 7, 5,
-  2, 0, 1, 4, 8, 11, 11, 10, 7, 3, 0, -2,
-  -4, -6, -9, -12, -15, -21, -28, -35, -40, -40, -35, -25,
-  -12, -1, 7, 11, 10, 6, 1, -4, -8, -9, -8, -5,
-  -1, 4, 8, 12, 15, 17, 19, 20, 21, 21, 20, 20,
-  21, 22, 23, 22, 19, 14, 9, 6, 6, 7, 8, 8,
-  7, 5, 4, 3, 3, 2, 1, 1, 2, 4, 6, 7,
-  6, 5, 5, 5, 5, 3, 0, -4, -8, -8, -4, 4,
-  12, 19, 23, 24, 21, 16, 9, 2, -3, -6, -6, -5,
-  -4, -4, -4, -5, -7, -9, -10, -11, -12, -12, -12, -12,
-  -12, -11, -10, -9, -8, -9, -12, -16, -18, -18, -15, -11,
-  -8, -8, -10, -14, -18, -21, -23, -22, -18, -12, -4, 3,
-  8, 8, 5, 0, -5, -10, -14, -17, -18, -18, -15, -10,
-  -3, 4, 10, 13, 12, 10, 7, 5, 4, 6, 9, 13,
-  18, 23, 26, 26, 21, 12, 2, -8, -15, -18, -18, -14,
-  -8, 0, 8, 13, 15, 13, 10, 6, 4, 3, 3, 4,
-  4, 3, 0, -5, -11, -18, -23, -24, -20, -12, -2, 7,
-  13, 14, 10, 3, -6, -14, -18, -17, -12, -3, 7, 16,
-  22, 23, 20, 13, 3, -8, -19, -27, -32, -33, -30, -26,
-  -20, -14, -7, -2, 0, -2, -7, -13, -18, -20, -19, -16,
-  -13, -9, -6, -4, -3, -2, -2, -1, 0, 2, 5, 7,
-  8, 8, 9, 10, 10, 9, 7, 5, 5, 7, 12, 18,
-  24, 27, 27, 23, 15, 7, 0, -2, 1, 9, 21, 34,
-  45, 53, 56, 54, 46, 34, 21, 9, 1, -3, -5, -5,
-  -3, 0, 2, 3, 3, 1, -1, -3, -5, -5, -3, 1,
-  5, 9, 13, 16, 17, 17, 16, 14, 12, 10, 7, 1,
-  -7, -16, -23, -28, -30, -28, -23, -16, -7, 2, 11, 19,
-  25, 28, 28, 27, 26, 24, 20, 15, 9, 2, -5, -11,
-  -15, -16, -14, -12, -10, -10, -12, -15, -16, -14, -9, -2,
-  6, 12, 14, 13, 11, 8, 5, 1, -3, -7, -11, -14,
-  -15, -15, -14, -14, -15, -15, -13, -10, -5, 0, 4, 6,
-  6, 5, 3, 2, 0, -2, -5, -9, -13, -18, -22, -24,
-  -23, -19, -14, -9, -4, -1, 1, 1, 1, 0, 0, 0,
-  2, 5, 8, 10, 10, 9, 7, 4, 2, 0, -3, -6,
-  -8, -9, -8, -7, -6, -6, -6, -6, -5, -5, -5, -7,
-  -9, -11, -11, -9, -7, -5, -4, -3, -2, -2, -5, -10,
-  -15, -20, -22, -22, -19, -15, -10, -7, -5, -5, -6, -8,
-  -10, -11, -9, -6, -1, 4, 8, 11, 13, 13, 10, 5,
-  0, -4, -6, -4, 0, 4, 6, 5, 1, -4, -10, -14,
-  -15, -13, -9, -3, 2, 6, 10, 12, 13, 12, 9, 7,
-  6, 7, 9, 13, 17, 20, 21, 20, 18, 15, 12, 10,
-  8, 8, 8, 9, 11, 14, 16, 18, 18, 18, 17, 16,
-  16, 17, 17, 17, 16, 15, 13, 11, 8, 6, 4, 4,
-  4, 4, 4, 3, 0, -4, -7, -8, -8, -7, -6, -5,
-  -4, -4, -6, -8, -11, -14, -16, -17, -18, -18, -16, -13,
-  -10, -7, -3, 0, 1, 0, -3, -6, -8, -7, -5, -2,
-  1, 2, 1, -3, -8, -13, -16, -18, -19, -18, -14, -8,
-  0, 8, 13, 15, 13, 8, 1, -5, -8, -9, -9, -7,
-  -4, -1, 1, 3, 5, 6, 7, 7, 7, 7, 7, 7,
-  6, 5, 3, 1, 0, -1, -1, 0, 1, 1, 0, -1,
-  -3, -5, -6, -6, -5, -4, -2, 0, 2, 4, 6, 8,
-  8, 7, 3, -3, -10, -17, -22, -25, -25, -23, -18, -12,
-  -7, -3, 0, 1, 0, -1, -2, -3, -3, -3, -3, -3,
-  -2, -1, 1, 3, 4, 5, 5, 5, 5, 5, 4, 4,
-  5, 7, 9, 12, 14, 16, 17, 17, 15, 12, 8, 4,
-  0, -4, -7, -9, -9, -8, -6, -3, -2, -2, -4, -5,
-  -6, -6, -6, -5, -4, -2, 0, 3, 5, 5, 4, 1,
-  -2, -5, -7, -8, -8, -8, -7, -6, -5, -5, -5, -5,
-  -6, -7, -7, -6, -5, -3, 0, 3, 5, 4, 1, -4,
-  -8, -10, -10, -8, -6, -5, -5, -5, -5, -5, -6, -6,
-  -5, -2, 2, 8, 13, 17, 20, 21, 21, 20, 19, 18,
-  17, 16, 15, 14, 12, 10, 8, 5, 3, 1, 0, 0,
-  0, 1, 2, 3, 3, 3, 3, 4, 6, 7, 6, 3,
-  -1, -7, -12, -16, -17, -16, -15, -14, -13, -12, -11, -10,
-  -9, -8, -6, -4, -1, 1, 4, 6, 8, 8, 7, 6,
-  4, 2, 0, -2, -3, -4, -3, -1, 0, 0, -1, -3,
-  -4, -5, -4, -1, 4, 10, 15, 19, 19, 16, 10, 4,
-  -2, -6, -8, -8, -7, -6, -5, -5, -7, -9, -10, -9,
-  -6, -1, 4, 9, 13, 16, 18, 19, 18, 16, 13, 9,
-  6, 3, 2, 1, 0, -2, -4, -6, -8, -9, -8, -6,
-  -3, 0, 3, 4, 4, 3, 3, 2, 1, -1, -2, -3,
-  -3, -3, -3, -4, -4, -4, -5, -7, -9, -11, -13, -14,
-  -14, -12, -8, -3, 2, 6, 9, 9, 7, 3, -1, -5,
-  -7, -8, -7, -6, -5, -4, -4, -4, -3, -3, -3, -4,
-  -5, -7, -8, -9, -9, -8, -7, -6, -5, -6, -8, -10,
-  -12, -14, -15, -15, -15, -14, -12, -9, -6, -3, 0, 3,
-  6, 9, 10, 10, 8, 6, 4, 2, 0, -1, -2, -3,
-  -4, -5, -6, -7, -8, -9, -9, -8, -6, -2, 2, 6,
-  10, 12, 12, 10, 6, 3, 1, 1, 1, 2, 2, 1,
-  0, -1, -2, -1, 0, 2, 4, 6, 9, 11, 13, 14,
-  14, 14, 13, 13, 13, 13, 13, 12, 9, 6, 3, 1,
-  -1, -2, -1, 0, 2, 4, 5, 6, 7, 7, 7, 7,
-  6, 4, 2, -1, -4, -6, -6, -4, -1, 2, 5, 6,
-  4, 1, -2, -4, -6, -7, -6, -4, -2, 0, 1, 1,
-  -1, -3, -6, -9, -10, -10, -8, -6, -5, -4, -3, -3,
-  -3, -3, -2, -1, -1, -1, 0, 0, 1, 2, 2, 2,
-  1, -1, -2, -2, -2, -1, -1, 0, 0, 0, 0, 0,
-  1, 2, 4, 5, 5, 4, 2, -1, -3, -4, -5, -6,
-  -7, -8, -9, -10, -10, -9, -7, -5, -4, -4, -5, -5,
-  -5, -4, -3, -1, 1, 2, 2, 2, 2, 1, -1, -3,
-  -5, -7, -7, -6, -4, -2, 0, 1, 1, 1, 2, 2,
-  3, 4, 5, 6, 6, 6, 6, 5, 3, 1, 0, -1,
-  -1, 0, 0, 0, 0, 1, 2, 4, 6, 8, 9, 9,
-  9, 8, 8, 8, 9, 9, 9, 8, 6, 4, 3, 2,
-  2, 2, 3, 4, 4, 4, 5, 6, 7, 8, 9, 9,
-  10, 11, 11, 11, 10, 9, 8, 7, 5, 4, 3, 3,
-  4, 6, 8, 9, 9, 7, 5, 3, 3, 4, 5, 7,
-  8, 8, 8, 7, 6, 5, 3, 1, -2, -5, -7, -8,
-  -9, -9, -9, -9, -9, -10, -11, -12, -12, -12, -11, -8,
-  -5, -2, 1, 3, 3, 1, -1, -3, -4, -5, -4, -3,
-  -1, 0, -1, -2, -3, -3, -3, -2, -1, 0, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1,
-  1, 1, 0, -1, -3, -5, -7, -9, -10, -10, -10, -8,
-  -6, -3, -1, 0, -1, -3, -5, -6, -6, -5, -3, -2,
-  -1, 0, 1, 2, 3, 5, 6, 6, 6, 5, 5, 5,
-  5, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 1, 2, 3, 3, 4, 5, 6, 6,
-  5, 4, 4, 3, 2, 1, 0, -1, -1, 0, 1, 3,
-  5, 6, 6, 5, 4, 4, 4, 5, 6, 6, 5, 3,
-  2, 1, 0, -1, -1, -1, -2, -3, -5, -6, -7, -8,
-  -9, -9, -8, -7, -5, -4, -3, -3, -3, -3, -3, -2,
-  -2, -2, -3, -4, -5, -5, -4, -2, 1, 3, 4, 4,
-  4, 3, 3, 3, 2, 1, -1, -2, -3, -2, -1, 0,
-  1, 1, 1, 1, 0, -1, -1, 0, 2, 4, 5, 6,
-  6, 6, 5, 4, 2, 0, -2, -4, -5, -5, -5, -5,
-  -5, -5, -4, -3, -1, 1, 3, 4, 4, 4, 4, 4,
-  4, 3, 2, 0, -2, -4, -6, -7, -7, -6, -5, -3,
-  -2, -2, -2, -2, -3, -4, -5, -5, -4, -2, 0, 2,
-  3, 2, 0, -3, -5, -6, -6, -7, -8, -8, -8, -8,
-  -9, -9, -8, -7, -5, -3, -2, -1, 0, 0, -2, -4,
-  -5, -5, -4, -3, -2, -1, 0, 2, 3, 4, 4, 4,
-  4, 4, 3, 3, 3, 4, 4, 4, 3, 3, 3, 4,
-  5, 5, 4, 2, 1, 1, 1, 1, 2, 4, 5, 5,
-  5, 5, 5, 5, 4, 2, 1, 1, 2, 3, 3, 3,
-  2, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 2,
-  3, 4, 5, 5, 5, 4, 3, 2, 2, 1, 1, 1,
-  2, 2, 3, 4, 4, 3, 2, 0, -1, -1, -1, 0,
-  2, 4, 5, 5, 4, 3, 1, -2, -5, -8, -9, -10,
-  -9, -8, -6, -4, -3, -2, -1, -1, -2, -3, -4, -4,
-  -4, -4, -3, -2, -1, -1, -1, -1, -1, 0, 2, 3,
-  2, 1, 0, 1, 2, 3, 4, 5, 6, 7, 6, 4,
-  3, 3, 3, 1, -1, -1, 0, 1, 2, 2, 2, 2,
-  2, 1, 0, 0, 1, 3, 5, 6, 7, 6, 5, 3,
-  2, 1, 0, 0, 0, 0, 0, 1, 2, 3, 3, 2,
-  2, 2, 3, 4, 4, 5, 6, 7, 7, 6, 5, 4,
-  3, 3, 2, 0, -2, -4, -5, -6, -7, -7, -7, -6,
-  -6, -5, -4, -2, 0, 1, 0, -1, -1, -1, -2, -4,
-  -5, -5, -4, -3, -2, -2, -3, -5, -6, -6, -6, -5,
-  -4, -1, 1, 2, 2, 2, 2, 2, 1, 0, -1, -1,
-  0, 1, 0, -1, -2, -2, -2, -2, -2, -1, 1, 2,
-  2, 2, 2, 3, 5, 5, 4, 2, 1, 0, -1, -3,
-  -4, -4, -3, -2, -1, -1, -2, -2, -1, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -2, -4, -5, -6, -6,
-  -7, -8, -8, -7, -6, -4, -4, -5, -5, -5, -4, -4,
-  -3, -2, 0, 2, 2, 2, 2, 3, 3, 2, 1, 1,
-  1, 0, -2, -5, -6, -5, -4, -3, -2, -1, 0, 1,
-  1, 0, -1, -1, 0, 1, 1, 1, 1, 1, 2, 3,
-  2, -1, -4, -6, -6, -5, -4, -3, -1, 0, 1, 1,
-  1, 2, 3, 4, 4, 3, 3, 3, 3, 3, 3, 3,
-  3, 3, 2, 1, 0, 0, 1, 2, 3, 3, 4, 5,
-  6, 6, 5, 5, 5, 5, 5, 6, 6, 6, 5, 4,
-  3, 2, 2, 1, 1, 1, 2, 3, 4, 4, 3, 1,
-  -1, -1, 0, 0, 0, 1, 3, 5, 4, 2, 0, 0,
-  0, -1, -1, 0, 2, 3, 3, 2, 2, 2, 3, 3,
-  2, 1, 0, -1, -1, -1, -1, 0, 1, 3, 4, 4,
-  3, 3, 3, 2, 1, 1, 1, 1, 1, 1, 2, 3,
-  5, 6, 6, 5, 3, 2, 1, 1, 0, -1, -1, 0,
-  2, 3, 3, 3, 2, 1, 1, 1, 1, 1, 1, 0,
-  -1, 0, 1, 2, 2, 3, 3, 2, 1, 0, 0, -1,
-  -2, -3, -4, -4, -4, -3, -2, -2, -2, -3, -3, -2,
-  0, 2, 2, 1, -1, -2, -3, -4, -5, -4, -3, -2,
-  -1, -1, 0, 1, 2, 1, -1, -3, -3, -3, -3, -4,
-  -4, -3, -2, -1, -2, -4, -5, -5, -4, -4, -5, -5,
-  -4, -3, -2, -2, -3, -3, -3, -3, -3, -2, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 2, 3,
-  2, 2, 2, 3, 3, 2, 0, -1, -1, -2, -2, -1,
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3,
-  3, 3, 3, 3, 3, 3, 2, 1, 1, 2, 2, 2,
-  1, 1, 0, -1, 0, 1, 2, 1, 0, 0, 0, 0,
-  -1, -1, 1, 3, 4, 3, 3, 4, 5, 4, 2, 1,
-  0, -1, -1, 0, 1, 2, 2, 2, 1, 1, 2, 4,
-  5, 4, 3, 2, 3, 4, 5, 4, 3, 3, 3, 3,
-  2, 1, 0, 0, 1, 2, 2, 1, -1, -2, -2, -2,
-  -2, -1, 0, 1, 0, -1, -1, 0, 1, 0, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, -1, -1, -2, -2, -2, -1, -1, -1, -2, -2, -2,
-  -2, -2, -2, -3, -3, -3, -2, -1, -1, -1, -1, -1,
-  -1, -2, -2, -2, -2, -3, -3, -3, -2, -2, -2, -2,
-  -2, -2, -2, -3, -3, -2, 0, 1, 2, 2, 2, 1,
-  -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -2, -3, -4, -3, -2, -2, -2, -1, 1, 1, -1, -2,
-  -2, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, 0, 1, 2, 3, 4, 4, 4, 4, 4, 4, 3,
-  2, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0,
-  -1, -2, -4, -4, -3, -1, 0, 0, 1, 2, 2, 2,
-  2, 3, 3, 2, 1, 0, 0, 1, 2, 2, 2, 3,
-  3, 2, 2, 3, 3, 2, 1, 2, 3, 4, 3, 2,
-  2, 2, 2, 2, 2, 3, 4, 3, 2, 1, 1, 0,
-  0, 1, 2, 2, 1, 0, -1, -1, 0, 0, 0, 2,
-  3, 3, 1, 0, -1, -1, 0, -1, -1, -2, -2, -1,
-  0, -1, -1, 0, 0, -1, -2, -3, -2, 0, 0, -2,
-  -3, -2, -2, -2, -2, -3, -3, -2, -1, -1, -1, -1,
-  -1, -2, -1, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 1, 1, 2, 2, 1, 0, -1, -1, -1, -1, 0,
-  0, -1, -1, 0, 1, 2, 2, 2, 2, 1, 0, 0,
-  0, 0, 0, 0, 1, 2, 2, 1, -1, -1, 0, 0,
-  0, 0, 0, 0, 1, 2, 3, 2, 0, -1, -1, 0,
-  1, 2, 2, 1, 1, 1, 1, 1, 2, 3, 3, 3,
-  1, -1, -2, -1, 0, -1, -2, -1, 0, 0, -1, -1,
-  0, 1, 1, 0, -1, 0, 1, 2, 1, 0, 1, 2,
-  2, 1, 0, -1, -2, -2, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -2, -3, -3, -2, -2, -2, -2, -2, -2,
-  -1, 1, 1, -1, -3, -4, -4, -3, -3, -4, -4, -3,
-  -1, -1, -1, -1, -1, -2, -4, -4, -3, -2, -1, -1,
-  -1, -1, -1, -1, -2, -2, -2, -1, 0, 1, 2, 1,
-  1, 1, 2, 2, 2, 3, 3, 2, 0, 0, 0, 0,
-  0, 1, 2, 2, 1, 0, 1, 2, 3, 2, 1, 2,
-  3, 3, 2, 2, 2, 2, 0, -2, -2, -1, 0, 0,
-  0, 0, 0, 0, 1, 2, 2, 2, 2, 3, 3, 2,
-  1, 0, -1, -1, -1, -1, -1, 0, 1, 0, -1, -2,
-  -2, -1, 0, 1, 1, 1, 0, -1, -2, -2, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -1, 1, 1, 0,
-  -1, 0, 1, 1, 1, 1, 1, 2, 1, -1, -2, -1,
-  1, 1, 1, 1, 1, 0, -1, -1, 0, 0, 0, 1,
-  2, 3, 3, 2, 1, 1, 1, 0, -1, 0, 1, 1,
-  1, 1, 2, 2, 1, 0, 0, 0, 1, 2, 3, 2,
-  2, 3, 3, 2, 1, 0, 0, 0, 0, 0, 1, 2,
-  2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -2, -1, 0, 1, 1, 0, -1, -1, -1,
-  -2, -2, -1, 0, 0, -1, -2, -3, -2, 0, -1, -1,
-  -1, -1, 0, -1, -2, -1, 0, -1, -3, -3, -2, -1,
-  -1, -2, -2, -1, 1, 1, 0, 0, 1, 1, 1, 1,
-  0, -1, -1, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
-  3, 2, 1, -1, -1, 1, 2, 2, 1, 1, 2, 2,
-  1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1,
-  2, 2, 1, 0, 0, -1, 0, -1, -2, -2, -1, -1,
-  0, 0, 0, 1, 1, 1, 1, 2, 1, -1, -3, -3,
-  -3, -3, -3, -3, -2, 0, -1, -2, -2, -2, -2, -2,
-  -2, -2, -1, -1, -2, -2, -1, -1, -2, -2, -2, -1,
-  0, 0, 0, -1, -2, -4, -4, -2, 0, 0, -2, -2,
-  -1, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, -1,
-  -2, -2, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, 0, 1, 0, -2, -2, -1, 0, -1,
-  -3, -3, -1, -1, -2, -3, -3, -2, -1, -1, -1, -1,
-  -1, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -3,
-  -2, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 1, 2, 2, 2, 3, 4, 3, 2, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, 0, 0, 1, 1, 1, 1,
-  1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-  2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 1, 1,
-  1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1,
-  1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -2, -3, -3, -2,
-  -1, -1, -1, 0, 1, 1, -1, -3, -3, -2, -1, -1,
-  -1, -1, -1, -1, -2, -3, -3, -3, -3, -3, -3, -2,
-  -1, 0, 1, 1, 1, 0, -1, -1, 0, 1, 1, 0,
-  -1, -1, -1, -2, -3, -2, -1, 0, 0, 1, 1, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, -1, -2, -2, -1, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, 0, 1, 2, 1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 1, 1, 0, -1, 0, 1, 1,
-  1, 1, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, 0, 1, 2, 2,
-  1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 1, 1,
-  1, 0, -1, -1, -1, -1, -1, -2, -1, 0, 0, -1,
-  -2, -1, 1, 2, 2, 1, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 1, 2, 2, 1, 0,
-  0, 1, 1, 0, 0, 1, 3, 3, 2, 1, 1, 1,
-  0, 0, -1, -2, -1, 1, 2, 1, 0, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -2, -3, -2, -1, 0, 1, 1, 1, 1, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, -1, -2, -1, -1, -2, -2, -1, 0, -1, -2, -2,
-  -2, -2, -2, -2, -1, 0, 0, -1, -2, -2, -2, -2,
-  -3, -3, -2, -1, 0, 0, -1, -2, -2, -2, -3, -3,
-  -3, -2, -2, -2, -1, -1, -2, -3, -4, -3, -2, -1,
-  -2, -3, -2, -1, -1, -2, -3, -2, -1, -1, -2, -3,
-  -2, -1, -1, -2, -2, -1, -1, -1, -2, -2, -1, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2,
-  -2, -3, -3, -2, -2, -2, -2, -1, -1, -2, -3, -3,
-  -2, -1, -1, -2, -2, -1, -1, -3, -4, -3, -1, 0,
-  -1, -2, -1, 0, 0, -1, -1, 0, 0, -1, -2, -2,
-  -1, -1, -1, -1, 0, 0, -1, -2, -2, -1, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, -1, -1, 1, 2, 2,
-  1, 2, 3, 2, 0, -2, -2, -1, -1, -2, -3, -2,
-  -1, -1, -1, 0, 1, 1, 0, 0, 1, 1, 0, -1,
-  0, 2, 2, 0, -1, 0, 1, 0, -1, -1, -1, -1,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 1, 1, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, -1, 0,
-  1, 1, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0,
-  1, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 1,
-  1, 1, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, 0, 1, 2, 2, 2,
-  1, 0, 0, 0, 0, -1, -1, 0, 1, 1, 0, -1,
-  -1, 0, 0, 0, 0, 1, 2, 2, 1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1,
-  0, -1, -2, -2, -1, -1, -1, -1, 0, 1, 0, -1,
-  -2, -1, -1, -2, -2, -1, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2,
-  2, 1, 0, 0, 0, -1, -1, 0, 1, 2, 2, 2,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-  -1, -2, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 0, 0, -1, -1,
-  -1, 0, 1, 0, -1, -1, 0, 1, 0, -1, -1, 0,
-  0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0,
-  0, 0, 1, 1, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, -1, -1, 0, 1, 1, 0, -1, 0, 1, 1, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  1, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, -2, -2, -2, -1, -1,
-  0, 1, 1, 0, -1, -2, -2, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 1, 1, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -1,
-  0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0,
-  1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, -1,
-  -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0,
-  -1, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, 0, 1, 1, 1, 1, 2, 2, 1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, 0, 1, 2, 2, 1, 1, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-  0, 1, 2, 3, 2, 1, 1, 1, 1, 1, 1, 0,
-  0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -2,
-  -2, -2, -2, -2, -2, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -2, -2, -2,
-  -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 0, -1,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 1, 1, 1, 0, -1, -1, -1, -1, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 1, 1, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -2, -2, -2, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -2, -2, -2, -1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2,
-  -2, -2, -1, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, -2,
-  -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 2,
-  1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, 0,
-  0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, 0, 1, 1, 0, 0, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, -2, -2, -2, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, -3,
-  -2, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1, 1,
-  1, 1, 1, 1, 1, 0, -1, -2, -2, -1, 0, 1,
-  1, 0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1,
-  1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 0, -1, -2, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -2, -2, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2,
-  2, 1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 1, 1, 0, 0, 0, 0, -1, -1,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -2, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0,
-  -1, -1, 0, 1, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
-  -1, 0, 1, 1, 1, 1, 1, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 1, 1, 1, 1,
-  1, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 0, -1, -2, -1, 0, 0, -1,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, -1, -2, -2,
-  -1, -1, -1, -1, 0, 0, 0, -1, -2, -2, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -2, -2, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, 0, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 2, 1, 0, 0, 1, 1, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -1, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, -2,
-  -1, -1, -1, -1, -1, 0, 1, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, -1, -2, -2, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, 0, 1, 0, -1,
-  -2, -2, -1, -1, -1, -1, -1, 0, 1, 0, -1, -1,
-  -1, -1, -2, -2, -1, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-  0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 0, 0, 0, 1, 1, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 1, 1, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 1, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, -1,
-  -2, -2, -1, 0, 0, 0, 1, 1, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -2, -1, -1,
-  0, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -2, -2, -1, -1, -1, -2, -2, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -2, -2, 0, 1, 1, 0, 0, 0, 0, -1, -2,
-  -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0,
-  0, -1, -2, -2, -1, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -2,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  0, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 0, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -2, -2, -1,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0,
-  -1, -2, -2, -1, 0, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 1, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, 0, 1, 2, 1, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 1, 2,
-  1, 0, -1, -1, -1, -1, -2, -3, -3, -1, 0, 0,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1,
-  0, 0, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1,
-  0, 1, 0, -1, -2, -1, 0, 0, -1, -1, 0, 1,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -2, -1, 0, 0, -1, -2, -1, 0, 0, -1, -2,
-  -1, 0, 0, -1, -1, -1, -1, -2, -2, -1, 0, 0,
-  -1, 0, 1, 1, 0, -2, -2, -1, 0, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -2, -1, 0, 1,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, -1, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0,
-  1, 1, 0, -1, -1, 1, 2, 1, 0, 0, 0, 0,
-  -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -2, -2,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, 0, 0, -2, -3, -2, 0, 0,
-  -1, -2, -1, 0, 0, -1, -1, 0, 1, 0, -1, -1,
-  0, 0, -1, 0, 1, 1, 0, -1, 0, 1, 1, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -2, -1,
-  0, 1, 0, -1, -1, 0, 1, 0, -1, -2, -1, 0,
-  0, -1, -1, 0, 1, 1, 0, -1, -1, -1, -2, -2,
-  -1, 0, 0, -1, -1, -1, 0, 1, 0, -1, -2, -2,
-  -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -2, -2, -2, -2, -1, -1, -1,
-  -1, 0, 0, -1, -2, -2, -1, 0, -1, -2, -2, -1,
-  -1, -1, -1, 0, 0, -1, -2, -2, 0, 1, 1, 0,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 1, 1, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, -1, -1, 0, 1, 0, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, -1, -2, -2, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, -1, -2, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1,
-  -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, -1, -2, -1, 0, -1, -2, -2,
-  -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 1,
-  0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, 0, 1, 1, 0, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 1, 2, 1, 0, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 0, -1, -2, -1,
-  -1, -1, -2, -1, 0, 1, 1, 0, 0, 1, 1, 0,
-  -1, -2, -1, 0, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, -1, -2, -2, -1, 0, 0, -1, -1, 0, 0,
-  -1, -1, 0, 1, 0, -1, -1, 0, 1, 0, -1, -1,
-  1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 1, 1, 0, -1, 0, 1,
-  1, 0, 0, 1, 1, 0, -2, -2, -1, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2,
-  -2, -1, 0, 1, 0, -1, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, -1, -2, -2, -1, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 1, 0, -1, -2, -1, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, 0, 1, 0, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0,
-  -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 1, 2, 1, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 1, 2, 1, 0, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  0, 1, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -1,
-  0, 1, 1, 0, -1, -2, -2, -2, -2, -2, -2, -1,
-  0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  1, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, -1, -1, 0, 1, 1, 1, 1, 1, 1, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, -1, -1, 0, 0, -1, -2, -2, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -2, -2, -1, 0, 0,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -2, -2, -2, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -2, -2, -1, 0, 1, 0, -1, -1, 0,
-  1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0,
-  1, 1, 0, -1, -1, 0, 1, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -2, -2, -1, -1, -1, -1, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -2, -2, -1, -1, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  -1, -2, -2, -1, 0, -1, -2, -2, -1, 0, 0, -1,
-  -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1,
-  1, 0, -1, -1, 0, 0, 0, 0, 1, 1, 0, 0,
-  0, 0, 0, -1, -1, 0, 1, 1, 1, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1,
-  0, 1, 0, -1, -1, 0, 0, -1, -2, -2, -1, 0,
-  0, -1, -1, 0, 1, 1, 0, -1, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, 0, 0, -1, -2, -2, -2, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
-  0, -1, -1, -1, 0, 1, 2, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  0, -1, -2, -2, -1, -1, -1, -1, -1, -1, -2, -2,
-  -2, -2, -2, -2, -1, 0, 0, 0, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1,
-  -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -2, -2, -1, -1, -2, -2, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 1, 0, -1,
-  -1, 0, 1, 0, -1, -2, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, 0, 1, 1, 0, -1, 0, 1, 1, 0,
-  -1, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 0, -1, -2, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, -1, 0, 0, -1, -2, -2, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 1, 1, 1, 1, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 1, 1, 0, -1, -1, -1, -1, -2, -2, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -1, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2,
-  -2, -2, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, 0,
-  1, 1, 1, 0, -1, -2, -2, -2, -2, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -2,
-  -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -1,
-  0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, 0, 1, 0, -1, -2, -1, 0, 0, -1, -1,
-  0, 1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 1,
-  1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -2, -1, 0, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, 0, 0, -1, -1, 0, 1, 1, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -2, -2, -2,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -2, -3, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  -1, -1, -1, -2, -1, 0, 1, 0, -1, -1, 0, 1,
-  0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, -1,
-  0, 1, 1, 1, 1, 0, 0, 0, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 0, -1, -1, -1, -1, -2, -2, -1, 0,
-  0, -1, -1, 0, 0, -1, -2, -2, -1, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 1, 2, 1, 0, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, -1, -1, 0, 1, 2, 1, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -2, -1, 0, 0, -1, -1, -1, 0, 0,
-  -1, -1, 0, 1, 0, -1, -1, 0, 1, 1, 0, 0,
-  0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 1,
-  0, -1, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -2, -2, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 1, 1, 1, 2, 2,
-  2, 2, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -2, -2, -2,
-  -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -2, -2,
-  -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 1, 1, 1, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 1, 1, 1, 0, -1, -1, -1, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, -1, -2, -2, -2, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
-  1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -2, -2, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, -1, -1, -1, -2, -2, -2, -1, -1, -1,
-  -1, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2,
-  -2, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1,
-  -1, -2, -3, -3, -2, -2, -2, -2, -2, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0,
-  -1, -2, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 1, 0,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 0, -1, -1,
-  -1, -1, -2, -2, -1, 0, 0, 0, 0, 1, 1, 0,
-  0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2,
-  -2, -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 1,
-  1, 1, 0, -1, -1, -2, -2, -2, -2, -2, -2, -2,
-  -1, 0, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  1, 1, 1, 1, 1, 1, 1, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -2, -2, -2, -2, -2, -2, -1, -1, -1, -2, -2, -2,
-  -2, -2, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2,
-  -2, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2,
-  -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, 0, 1, 1, 1,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2,
-  -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
-  -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, -2, -2, -2, -1, -1, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2,
-  -2, -2, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, -1, -1,
-  -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  1, 1, 1, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0,
-  0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -2, -1, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, -1, -2, -3, -3, -2, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 0, -1, -1, -1, -1, -2, -2, -2, -1, -1, -2,
-  -2, -2, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
-  0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, -1, -2, -2, -2, -2, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -1,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2,
-  -2, -2, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1,
-  -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -2, -2, -2, -2, -2,
-  -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -2,
-  -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, -1,
-  -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -2,
-  -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  -1, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 0, 0, 1, 1, 0, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -2, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
-  0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -2, -2, -2, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1,
-  -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2,
-  -2, -2, -2, -2, -1, 0, 0, 0, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, -1,
-  -1, -1, -1, -1, -1, -1, 0, 1, 1, 1, 1, 1,
-  1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2,
-  2, 1, 1, 1, 2, 2, 1, 0, 0, 1, 1, 1,
-  1, 1, 2, 2, 2, 2, 1, 0, 0, 1, 1, 1,
-  0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -2, -2,
-  -1, 0, 0, 0, 0, 1, 1, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -2, -2, -2, -1, -1, -1, -2, -2, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -2, -2, -1, -1, -2, -2, -1,
-  0, 0, -1, -2, -1, 0, 0, -1, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
-  0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
-  1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1,
-  -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 0, -1, -2, -2, -1, -1,
-  -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, -1, -2, -2, -2, -1, -1, -1, -1,
-  -1, -1, -1, -2, -2, -1, -1, -1, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2,
-  -2, -2, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, -1, -1, -1, -1, -1,
-  -1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
-  0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
-  1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -2,
-  -2, -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -2, -2, -1,
-  -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -2, -3,
-  -3, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2,
-  -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 1,
-  1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 1, 1, 1, 1, 1, 1, 0,
-  0, 0, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 1, 1, 1, 0, -1, -1, -1,
-  0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 1, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1,
-  1, 1, 1, 1, 1, 0, 0, 0, 1, 2, 2, 2,
-  1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -2, -3, -3, -3,
-  -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -3,
-  -3, -3, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, 0,
-  0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1,
-  -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 1, 1, 1, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 1, 2,
-  2, 2, 1, 0, 0, 0, -1, -2, -2, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -3,
-  -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -1, -1,
-  -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
-  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
-  1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 0, 0, 0, -1, -1, -1, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-  1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 1, 1, 0, -1, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 1,
-  1, 1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, -1,
-  -1, -1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1,
-  -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1,
-  1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1,
-  -1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, -1, -1, -1, -1, 0, 1, 1, 1, 1, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1,
-  -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1,
-  -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+static const uint8_t STARTUP_ADPCM[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99,
+  0x00, 0x11, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x01, 0x90, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x90, 0x00, 0x90, 0x00, 0x11,
+  0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x99, 0x00, 0x10, 0x00, 0x90, 0x00, 0x00, 0x11, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x10, 0x00, 0x99, 0x00, 0x10, 0x00, 0x90, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90, 0x09, 0x00, 0x01,
+  0xff, 0xff, 0x00, 0x00, 0x11, 0x00, 0x99, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x00, 0x99, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x90,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x90, 0x09, 0x01, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x90, 0x09, 0x00, 0x10, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x01, 0x00, 0x90, 0x09, 0x10, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x90, 0x09, 0x01, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10,
+  0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x10, 0x01, 0x00, 0x90, 0x90, 0x09, 0x10, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09,
+  0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10,
+  0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x11,
+  0x99, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x99, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01,
+  0x09, 0x01, 0x90, 0x10, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x01,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x09, 0x01, 0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90,
+  0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x99, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x90, 0x00, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x99, 0x00, 0x00, 0x11, 0x00,
+  0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11,
+  0x00, 0x90, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11,
+  0x90, 0x00, 0x01, 0x99, 0x00, 0x11, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x01, 0x90, 0x00, 0x90, 0x00,
+  0x01, 0x01, 0x00, 0x99, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x99,
+  0x10, 0x01, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10,
+  0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x99, 0x10, 0x90, 0x00, 0x01,
+  0x00, 0x09, 0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90,
+  0x09, 0x11, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90,
+  0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x99, 0x11, 0x90, 0x19, 0x01, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x09, 0x01,
+  0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x99, 0x09, 0x11, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90,
+  0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90,
+  0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x90, 0x10, 0x90, 0x09, 0x00,
+  0x00, 0x11, 0x00, 0x99, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x19, 0x01,
+  0x09, 0x01, 0x09, 0x01, 0x90, 0x00, 0x01, 0x99, 0x11, 0x91, 0x09, 0x01, 0x09, 0x10, 0x90, 0x00,
+  0x01, 0x90, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x01, 0x00, 0x01, 0x99, 0x10,
+  0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x01, 0x90,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x99, 0x10, 0x90, 0x10, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x01, 0x90, 0x10, 0x01, 0x99, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x01, 0x09, 0x01,
+  0x99, 0x10, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x99, 0x10, 0x09, 0x11, 0x91, 0x09, 0x01,
+  0x99, 0x10, 0x00, 0x10, 0x01, 0x09, 0x00, 0x90, 0x09, 0x11, 0x00, 0x00, 0x90, 0x10, 0x01, 0x99,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x90, 0x09, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x01, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x00, 0x09, 0x01, 0x99, 0x11, 0x91,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x09, 0x10, 0x90, 0x09, 0x11, 0x99,
+  0x10, 0x00, 0x10, 0x91, 0x09, 0x11, 0x99, 0x10, 0x91, 0x99, 0x11, 0x00, 0x09, 0x00, 0x09, 0x10,
+  0x10, 0x00, 0x09, 0x11, 0x90, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x99, 0x11, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x99, 0x10, 0x00, 0x00, 0x09, 0x01, 0x99, 0x10, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x99, 0x01, 0x09, 0x11, 0x91, 0x00, 0x00, 0x99, 0x11, 0x90, 0x19,
+  0x01, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x99,
+  0xff, 0xff, 0x00, 0x00, 0x91, 0x10, 0x91, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x10, 0x90,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x90, 0x90, 0x00, 0x00, 0x11, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09,
+  0x01, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90, 0x00, 0x01, 0x00, 0x90, 0x00, 0x01, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x99, 0x11, 0x01, 0x09, 0x01, 0x99, 0x10, 0x01, 0x09, 0x01,
+  0x99, 0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x00, 0x99, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x10, 0x01, 0x09, 0x90, 0x19, 0x01, 0x09, 0x01, 0x90, 0x10, 0x01, 0x99,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x91, 0x09, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x99, 0x10, 0x00, 0x09, 0x11, 0x99, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x11,
+  0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x90, 0x10, 0x01, 0x00, 0x10, 0x90, 0x19, 0x01, 0x09, 0x01,
+  0x09, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x10, 0x90, 0x09, 0x01, 0x90, 0x10, 0x00,
+  0x09, 0x01, 0x09, 0x01, 0x09, 0x00, 0x00, 0x09, 0x11, 0x91, 0x09, 0x01, 0x99, 0x10, 0x11, 0x09,
+  0x00, 0x99, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x90, 0x10, 0x01, 0x00, 0x90,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x99, 0x11,
+  0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x99, 0x10, 0x99, 0x10, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x90, 0x09, 0x11, 0x90, 0x00, 0x00, 0x00,
+  0x90, 0x10, 0x11, 0x90, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x09, 0x10, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x11, 0x91, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x99, 0x00, 0x90, 0x11, 0x01, 0x09, 0x00, 0x99, 0x19, 0x11, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x91, 0x09, 0x11, 0x90, 0x10, 0x91, 0x99, 0x11, 0x90, 0x00, 0x01, 0x90, 0x09, 0x11, 0x90,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x99, 0x10, 0x01, 0x09, 0x01, 0x99, 0x19,
+  0x11, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x91, 0x99, 0x11,
+  0x91, 0x09, 0x10, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x19,
+  0x11, 0x99, 0x10, 0x00, 0x00, 0x01, 0x99, 0x19, 0x01, 0x10, 0x00, 0x90, 0x99, 0x00, 0x11, 0x00,
+  0x01, 0x90, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x01, 0x90, 0x99, 0x10, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x11, 0x00, 0x99, 0x00, 0x01, 0x90, 0x10, 0x01, 0x99, 0x10, 0x00, 0x09, 0x10,
+  0x00, 0x09, 0x10, 0x00, 0x09, 0x11, 0x90, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x09, 0x10, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x99, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x99,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x10, 0x90, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x90, 0x99, 0x11, 0x90, 0x10, 0x01, 0x99, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01,
+  0x99, 0x00, 0x11, 0x90, 0x00, 0x01, 0x90, 0x09, 0x01, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x11, 0x99, 0x19, 0x01,
+  0x99, 0x11, 0x91, 0x09, 0x11, 0x99, 0x10, 0x00, 0x09, 0x11, 0x99, 0x19, 0x01, 0x09, 0x01, 0x90,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10, 0x01, 0x09, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x11, 0x00, 0x99, 0x00, 0x01, 0x90, 0x00, 0x01,
+  0x00, 0x10, 0x00, 0x99, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x99, 0x10, 0x11, 0x99, 0x00, 0x90,
+  0xfe, 0xff, 0x00, 0x00, 0x11, 0x90, 0x19, 0x01, 0x99, 0x11, 0x90, 0x09, 0x10, 0x01, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x19, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x11, 0x99,
+  0x10, 0x90, 0x09, 0x11, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x01, 0x09, 0x11, 0x01, 0x99, 0x10, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x01, 0x99, 0x10, 0x91, 0x09,
+  0x11, 0x90, 0x09, 0x01, 0x99, 0x11, 0x00, 0x10, 0x90, 0x99, 0x01, 0x00, 0x11, 0x99, 0x19, 0x01,
+  0x00, 0x90, 0x00, 0x00, 0x09, 0x11, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x99,
+  0x10, 0x01, 0x09, 0x11, 0x90, 0x99, 0x01, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x01, 0x90, 0x99,
+  0x19, 0x11, 0x91, 0x09, 0x10, 0x01, 0x99, 0x19, 0x01, 0x99, 0x11, 0x91, 0x09, 0x01, 0x00, 0x01,
+  0x99, 0x19, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01,
+  0x09, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x99, 0x11, 0x01, 0x09, 0x01, 0x99, 0x11, 0x91, 0x09,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x11, 0x90, 0x09, 0x00, 0x90, 0x00, 0x11, 0x90, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x90, 0x00, 0x10, 0x01, 0x90, 0x09, 0x00, 0x10, 0x91, 0x99, 0x11, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x11, 0x99, 0x19, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x10, 0x91, 0x19, 0x11, 0x99, 0x10, 0x90, 0x10,
+  0x90, 0x09, 0x01, 0x00, 0x01, 0x99, 0x19, 0x11, 0x91, 0x99, 0x00, 0x00, 0x11, 0x00, 0x10, 0x90,
+  0x09, 0x00, 0x90, 0x10, 0x11, 0x99, 0x00, 0x00, 0x10, 0x01, 0x99, 0x19, 0x91, 0x19, 0x11, 0x99,
+  0x01, 0x90, 0x00, 0x90, 0x10, 0x11, 0x00, 0x00, 0x99, 0x09, 0x11, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x11, 0x90, 0x00, 0x90, 0x19, 0x11, 0x99, 0x00, 0x00, 0x10, 0x91, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x11, 0x99, 0x09, 0x01, 0x09, 0x11, 0x00, 0x90, 0x00, 0x00, 0x11, 0x99, 0x99, 0x11, 0x91, 0x10,
+  0x00, 0x09, 0x01, 0x99, 0x11, 0x00, 0x09, 0x11, 0x99, 0x00, 0x90, 0x10, 0x01, 0x90, 0x00, 0x99,
+  0x10, 0x02, 0x99, 0x00, 0x10, 0x01, 0x99, 0x10, 0x00, 0x09, 0x00, 0x11, 0x90, 0x09, 0x10, 0x00,
+  0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x09, 0x10, 0x00, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01, 0x09, 0x01, 0x99, 0x00, 0x01,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x11, 0x99, 0x00, 0x90, 0x00, 0x01, 0x00, 0x11,
+  0x99, 0x19, 0x01, 0x00, 0x90, 0x99, 0x11, 0x11, 0x99, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x90,
+  0x10, 0x11, 0x90, 0x99, 0x00, 0x09, 0x11, 0x90, 0x00, 0x90, 0x00, 0x11, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x01, 0x99, 0x00, 0x09, 0x11, 0x90, 0x10, 0x91, 0x09, 0x11, 0x99, 0x10, 0x90, 0x19,
+  0x11, 0x09, 0x00, 0x90, 0x00, 0x90, 0x10, 0x11, 0x99, 0x09, 0x11, 0x00, 0x99, 0x10, 0x91, 0x09,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x11, 0x90, 0x00, 0x00, 0x19, 0x01, 0x99, 0x11, 0x90, 0x09, 0x11, 0x09, 0x01, 0x99, 0x10,
+  0x90, 0x19, 0x11, 0x00, 0x00, 0x99, 0x09, 0x10, 0x01, 0x90, 0x10, 0x11, 0x99, 0x99, 0x11, 0x01,
+  0x90, 0x09, 0x11, 0x99, 0x10, 0x91, 0x09, 0x01, 0x90, 0x10, 0x90, 0x19, 0x11, 0x99, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x11, 0x00, 0x09, 0x09, 0x10, 0x01, 0x99,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x11, 0x01,
+  0x99, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x90, 0x00, 0x01, 0x09,
+  0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x99, 0x10, 0x00, 0x00, 0x10, 0x00, 0x99, 0x10, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x09, 0x10, 0x91, 0x09, 0x11, 0x99, 0x11, 0x90, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x10, 0x01, 0x90, 0x09, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x99, 0x11, 0x90, 0x09, 0x11, 0x91, 0x99, 0x00, 0x11, 0x90, 0x10, 0x90, 0x10, 0x01, 0x90, 0x09,
+  0x00, 0x01, 0x09, 0x10, 0x90, 0x10, 0x01, 0x90, 0x09, 0x10, 0x01, 0x09, 0x11, 0x90, 0x90, 0x99,
+  0x11, 0x91, 0x00, 0x90, 0x00, 0x11, 0x91, 0x09, 0x00, 0x09, 0x00, 0x01, 0x00, 0x91, 0x99, 0x21,
+  0x99, 0x09, 0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x00, 0x01, 0x09,
+  0x10, 0x01, 0x90, 0x00, 0x00, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x90, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10,
+  0x90, 0x10, 0x00, 0x99, 0x90, 0x00, 0x11, 0x90, 0x10, 0x91, 0x09, 0x00, 0x00, 0x90, 0x10, 0x11,
+  0x99, 0x09, 0x11, 0x09, 0x01, 0x09, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x90, 0x99,
+  0x11, 0x11, 0x99, 0x00, 0x01, 0x00, 0x99, 0x10, 0x01, 0x09, 0x01, 0x00, 0x99, 0x19, 0x01, 0x90,
+  0x10, 0x00, 0x10, 0x90, 0x19, 0x90, 0x10, 0x91, 0x09, 0x11, 0x99, 0x19, 0x11, 0x00, 0x90, 0x09,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x90, 0x09, 0x21,
+  0x90, 0x00, 0x90, 0x09, 0x01, 0x19, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x90,
+  0x09, 0x01, 0x00, 0x11, 0x00, 0x99, 0x10, 0x01, 0x99, 0x19, 0x11, 0x99, 0x10, 0x01, 0x09, 0x90,
+  0x00, 0x01, 0x09, 0x10, 0x01, 0x90, 0x00, 0x00, 0x90, 0x19, 0x01, 0x10, 0x91, 0x99, 0x00, 0x00,
+  0x11, 0x90, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x00, 0x99, 0x10, 0x00, 0x00, 0x09, 0x00, 0x01,
+  0x90, 0x19, 0x11, 0x90, 0x09, 0x21, 0x91, 0x9a, 0x10, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x90,
+  0x19, 0x11, 0x90, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x11, 0x01, 0xa9, 0x10,
+  0x11, 0x90, 0x11, 0x90, 0x19, 0x01, 0x99, 0x09, 0x11, 0x99, 0x00, 0x11, 0x01, 0x99, 0x00, 0x09,
+  0x10, 0x11, 0x99, 0x11, 0x00, 0x09, 0x10, 0x99, 0x19, 0x91, 0x09, 0x11, 0x91, 0x99, 0x11, 0x90,
+  0x99, 0x19, 0x11, 0x09, 0x10, 0x00, 0x99, 0x10, 0x00, 0x99, 0x00, 0x01, 0x10, 0x00, 0x09, 0x01,
+  0x00, 0x01, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x11, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x90, 0x00, 0x00, 0x90,
+  0x10, 0x01, 0x09, 0x10, 0x90, 0x09, 0x01, 0x90, 0x00, 0x09, 0x11, 0x99, 0x00, 0x01, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x10, 0x00, 0x99, 0x19, 0x01, 0x99, 0x10, 0x01, 0x99,
+  0x10, 0x00, 0x01, 0x99, 0x00, 0x10, 0x01, 0x09, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x11, 0x01, 0x99, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x11, 0x90, 0x00, 0x00, 0x00, 0x99, 0x10, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x09, 0x01, 0x00, 0x10, 0x00, 0x00, 0x99, 0x19, 0x11, 0x90, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x01, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00,
+  0x00, 0x90, 0x19, 0x11, 0x91, 0x00, 0x90, 0x09, 0x01, 0x90, 0x10, 0x01, 0x00, 0x90, 0x00, 0x01,
+  0x90, 0x09, 0x10, 0x01, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x09, 0x11, 0x00, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x99, 0x11, 0x90, 0x00, 0x90, 0x00, 0x01, 0x99, 0x11, 0x91, 0x09, 0x10, 0x91,
+  0x09, 0x11, 0x90, 0x09, 0x00, 0x00, 0x11, 0x90, 0x00, 0x90, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x01, 0x00, 0x90, 0x00, 0x01, 0x90,
+  0x10, 0x01, 0x99, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09,
+  0x01, 0x99, 0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x00, 0x00, 0x10, 0x90, 0x09, 0x10, 0x90, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x09, 0x01, 0x00, 0x90, 0x19, 0x11, 0x99, 0x00, 0x01,
+  0x90, 0x00, 0x10, 0x01, 0x09, 0x00, 0x00, 0x99, 0x10, 0x11, 0x99, 0x10, 0x01, 0x99, 0x10, 0x00,
+  0x09, 0x11, 0x01, 0x99, 0x10, 0x90, 0x10, 0x01, 0x09, 0x00, 0x09, 0x10, 0x11, 0x99, 0x09, 0x10,
+  0x90, 0x19, 0x11, 0x99, 0x09, 0x10, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01, 0x09, 0x00, 0x01, 0x90,
+  0x10, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x09, 0x00, 0x10, 0x90, 0x10, 0x01, 0x99,
+  0x09, 0x10, 0x11, 0x01, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+  0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x00, 0x90,
+  0x10, 0x01, 0x00, 0x00, 0x00, 0x99, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x99, 0x00, 0x01, 0x00, 0x10, 0x00, 0x99,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x10, 0x01, 0x09, 0x01, 0x00,
+  0x10, 0x00, 0x09, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x09, 0x00, 0x99,
+  0x11, 0x11, 0x09, 0x01, 0x99, 0x19, 0x01, 0x09, 0x01, 0x90, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
+  0x09, 0x99, 0x10, 0x00, 0x09, 0x00, 0x90, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0xff, 0x00, 0x00, 0x01, 0x90, 0x10, 0x11, 0x90, 0x99, 0x11, 0x90, 0x10, 0x02, 0x09, 0x01,
+  0x99, 0x11, 0x91, 0x09, 0x10, 0x00, 0x10, 0x11, 0x90, 0x10, 0x91, 0x99, 0x31, 0x91, 0x0a, 0x11,
+  0x99, 0x09, 0x90, 0x09, 0x00, 0x90, 0x00, 0x11, 0x90, 0x00, 0x00, 0x09, 0x00, 0x99, 0x19, 0x11,
+  0x99, 0x10, 0x90, 0x99, 0x09, 0x01, 0x00, 0x90, 0x00, 0x00, 0x99, 0x00, 0x00, 0x99, 0x09, 0x10,
+  0x90, 0x99, 0x10, 0x90, 0x09, 0x00, 0x00, 0x90, 0x00, 0x01, 0x99, 0x00, 0x00, 0x11, 0x99, 0x10,
+  0x01, 0x0a, 0x22, 0xa0, 0x29, 0x02, 0x99, 0x31, 0x90, 0x10, 0x01, 0x09, 0x11, 0x00, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x09, 0x11, 0x91, 0x19, 0x01, 0x99, 0x11,
+  0x01, 0x10, 0x90, 0x19, 0x11, 0x01, 0x11, 0x01, 0x11, 0x90, 0x10, 0x11, 0x00, 0x00, 0x11, 0x11,
+  0x99, 0x19, 0x11, 0x90, 0x99, 0x11, 0xa0, 0x0a, 0x11, 0x99, 0x09, 0x99, 0x99, 0x99, 0x00, 0xa9,
+  0x99, 0x09, 0xb9, 0x09, 0x90, 0x9a, 0x9a, 0x0a, 0x01, 0xb9, 0x09, 0x11, 0xaa, 0x10, 0x90, 0x09,
+  0x00, 0x09, 0x11, 0x99, 0x19, 0x91, 0x0a, 0x12, 0xb9, 0x20, 0x02, 0x9a, 0x10, 0x90, 0x00, 0x90,
+  0x10, 0x11, 0x99, 0x11, 0x90, 0x10, 0x02, 0x90, 0x10, 0x02, 0x09, 0x11, 0x99, 0x10, 0x11, 0x09,
+  0x11, 0x90, 0x11, 0x01, 0x19, 0x11, 0x01, 0x11, 0x13, 0x10, 0x11, 0x01, 0x10, 0x01, 0x21, 0x13,
+  0x90, 0x31, 0x13, 0x19, 0x23, 0x91, 0x11, 0x12, 0x31, 0x01, 0x10, 0x13, 0x11, 0x11, 0x00, 0x10,
+  0x12, 0x12, 0x02, 0x19, 0x12, 0x01, 0x21, 0x11, 0x99, 0x31, 0x92, 0x1a, 0x12, 0xa9, 0x09, 0x90,
+  0xa9, 0x99, 0x99, 0x09, 0xb9, 0x1a, 0x91, 0xbc, 0x00, 0xb9, 0xac, 0x90, 0xbb, 0x9b, 0xbb, 0xab,
+  0xf6, 0xff, 0x00, 0x00, 0xcb, 0x9a, 0x91, 0xcb, 0x0a, 0xba, 0x8c, 0xb0, 0xbd, 0x19, 0xd9, 0x0a,
+  0x02, 0xad, 0x10, 0xb1, 0x9b, 0x22, 0x90, 0x00, 0x10, 0x11, 0x13, 0x12, 0x21, 0x11, 0x21, 0x33,
+  0x13, 0x31, 0x43, 0x01, 0x63, 0x12, 0x10, 0x32, 0x23, 0x33, 0x33, 0x32, 0x33, 0x12, 0x33, 0x12,
+  0x21, 0x23, 0x21, 0x20, 0x13, 0x91, 0x19, 0x12, 0x10, 0x33, 0x91, 0x09, 0x11, 0x92, 0x99, 0x12,
+  0xa0, 0x19, 0x13, 0xba, 0x21, 0x91, 0x99, 0x01, 0x19, 0x02, 0xaa, 0x20, 0x02, 0xab, 0x20, 0xb0,
+  0x0a, 0x90, 0xab, 0x99, 0xbc, 0x9a, 0xbb, 0xad, 0xa8, 0xad, 0x9b, 0xba, 0xbc, 0xad, 0xcb, 0xba,
+  0xad, 0xa0, 0xcc, 0x8b, 0xb9, 0xbc, 0xb9, 0xcc, 0xbb, 0xbb, 0x9a, 0xdc, 0xac, 0x89, 0xbb, 0xab,
+  0xbc, 0xaa, 0xcc, 0x1a, 0xa1, 0xad, 0x10, 0xc9, 0x0b, 0x24, 0xa9, 0x2b, 0x35, 0x90, 0x18, 0x54,
+  0x01, 0x9b, 0x63, 0x03, 0x08, 0x63, 0x02, 0x21, 0x43, 0x33, 0x35, 0x42, 0x35, 0x33, 0x44, 0x33,
+  0x42, 0x34, 0x33, 0x35, 0x32, 0x35, 0x33, 0x63, 0x23, 0x33, 0x34, 0x43, 0x24, 0x23, 0x34, 0x24,
+  0x33, 0x43, 0x32, 0x44, 0x23, 0x33, 0x25, 0x23, 0x34, 0x35, 0x33, 0x33, 0x45, 0x22, 0x11, 0x32,
+  0x33, 0x00, 0x31, 0x03, 0xdc, 0x09, 0xd9, 0xad, 0xbb, 0xbd, 0xdb, 0xbb, 0xac, 0xcc, 0xcb, 0xba,
+  0xcc, 0xab, 0xdb, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xcb, 0xaa, 0xba, 0xcb,
+  0xab, 0xaa, 0xbb, 0x9b, 0xa8, 0xbd, 0x9a, 0x98, 0x99, 0x99, 0x11, 0xb8, 0x2b, 0x17, 0xa8, 0x42,
+  0x93, 0x49, 0x26, 0x88, 0x32, 0x04, 0x10, 0x32, 0x33, 0x13, 0x32, 0x27, 0x81, 0x20, 0x33, 0x31,
+  0x57, 0x22, 0x41, 0x45, 0x22, 0x31, 0x45, 0x23, 0x42, 0x53, 0x23, 0x32, 0x35, 0x25, 0x32, 0x34,
+  0x90, 0xfe, 0x16, 0x00, 0x43, 0x43, 0x43, 0x32, 0x34, 0x24, 0x24, 0x43, 0x33, 0x43, 0x43, 0x32,
+  0x43, 0x34, 0x33, 0x44, 0x42, 0x32, 0x33, 0x34, 0x24, 0x31, 0x43, 0x22, 0x23, 0x32, 0x12, 0x98,
+  0x18, 0x91, 0xbe, 0xab, 0xca, 0xce, 0xbb, 0xba, 0xce, 0xbb, 0xbb, 0xbd, 0xbc, 0xbb, 0xcc, 0xcb,
+  0xab, 0xbc, 0xcb, 0xba, 0xcb, 0xab, 0xac, 0xab, 0xab, 0xcb, 0xaa, 0xab, 0xba, 0xbb, 0xa9, 0xba,
+  0xba, 0xa9, 0xb9, 0x9a, 0x10, 0xd8, 0xac, 0x80, 0xea, 0x9a, 0x98, 0xa9, 0xa8, 0xbe, 0x9b, 0xc9,
+  0xcc, 0x99, 0xba, 0xbc, 0x9a, 0xc9, 0xbc, 0xaa, 0xbb, 0xbb, 0xce, 0x8a, 0xa8, 0xbc, 0x99, 0xbc,
+  0x19, 0x12, 0x19, 0x55, 0x33, 0x32, 0x55, 0x33, 0x33, 0x45, 0x34, 0x33, 0x34, 0x44, 0x32, 0x43,
+  0x43, 0x24, 0x23, 0x54, 0x23, 0x33, 0x44, 0x23, 0x43, 0x34, 0x33, 0x44, 0x22, 0x34, 0x42, 0x32,
+  0x34, 0x43, 0x33, 0x53, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x32, 0x43, 0x32, 0x33,
+  0x34, 0x33, 0x33, 0x24, 0x32, 0x43, 0x02, 0x00, 0x31, 0x11, 0xba, 0xbd, 0xdd, 0xbd, 0xad, 0xcb,
+  0xcb, 0xdb, 0xba, 0xcb, 0xbc, 0xbb, 0xbc, 0xcc, 0xba, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba,
+  0xac, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xac, 0xaa, 0xaa, 0xab, 0x9a, 0x09, 0x98, 0x10, 0x53, 0x22,
+  0x35, 0x34, 0x53, 0x23, 0x33, 0x24, 0x33, 0x34, 0x22, 0x34, 0x22, 0x32, 0x23, 0x51, 0x24, 0x08,
+  0x41, 0x82, 0x18, 0x02, 0x99, 0xaa, 0xaf, 0x9a, 0xb8, 0xdb, 0xbc, 0xaa, 0xba, 0x9b, 0x90, 0x31,
+  0x26, 0x42, 0x44, 0x23, 0x53, 0x43, 0x43, 0x35, 0x42, 0x34, 0x24, 0x34, 0x43, 0x43, 0x33, 0x34,
+  0x53, 0x33, 0x24, 0x34, 0x33, 0x34, 0x43, 0x33, 0x25, 0x33, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33,
+  0xf3, 0x05, 0x17, 0x00, 0x43, 0x33, 0x53, 0x32, 0x33, 0x44, 0x22, 0x42, 0x24, 0x22, 0x32, 0x43,
+  0x42, 0x23, 0x43, 0x33, 0x23, 0x24, 0x33, 0x34, 0x23, 0x32, 0x12, 0xca, 0xcd, 0xdb, 0xcb, 0xbc,
+  0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xba, 0xac, 0xcb, 0xab, 0xbc, 0xcb, 0xbb, 0xcb,
+  0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xbb, 0xca, 0xaa, 0xba, 0xaa, 0x9a, 0xaa, 0x10, 0x01, 0x18, 0x35,
+  0x34, 0x43, 0x34, 0x24, 0x23, 0x34, 0x24, 0x22, 0x43, 0x12, 0x01, 0x32, 0x23, 0x99, 0x42, 0x83,
+  0xbb, 0x01, 0xba, 0xac, 0xdb, 0xaa, 0xdd, 0xab, 0xa8, 0xcc, 0xba, 0xbc, 0xad, 0xaa, 0xab, 0xbb,
+  0xac, 0x99, 0x38, 0x45, 0x22, 0x63, 0x43, 0x43, 0x33, 0x45, 0x33, 0x43, 0x35, 0x34, 0x43, 0x33,
+  0x35, 0x23, 0x44, 0x33, 0x33, 0x36, 0x32, 0x43, 0x33, 0x53, 0x33, 0x42, 0x43, 0x32, 0x33, 0x35,
+  0x33, 0x34, 0x53, 0x34, 0x22, 0x52, 0x33, 0x32, 0x43, 0x34, 0x33, 0x23, 0x35, 0x24, 0x23, 0x34,
+  0x24, 0x22, 0x34, 0x22, 0x20, 0x11, 0x80, 0x88, 0xda, 0xbb, 0xdd, 0xcb, 0xca, 0xbc, 0xcb, 0xdb,
+  0xba, 0xac, 0xac, 0xac, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xac, 0xac, 0xab, 0xac, 0xab, 0xbb, 0xac,
+  0xba, 0xbb, 0xab, 0xbb, 0xaa, 0xaa, 0x9b, 0x09, 0xa9, 0x40, 0x24, 0x30, 0x44, 0x33, 0x44, 0x33,
+  0x26, 0x13, 0x42, 0x23, 0x33, 0x34, 0x11, 0x21, 0x23, 0x00, 0x12, 0xba, 0x28, 0xf1, 0xbe, 0x99,
+  0xeb, 0xbb, 0xbb, 0xcb, 0xdc, 0xab, 0x88, 0xcc, 0x9b, 0xa8, 0xdb, 0x99, 0x08, 0x90, 0xbb, 0x73,
+  0x82, 0x29, 0x34, 0x89, 0x64, 0x13, 0x42, 0x34, 0x33, 0x26, 0x23, 0x63, 0x22, 0x32, 0x25, 0x23,
+  0x34, 0x33, 0x34, 0x33, 0x34, 0x25, 0x43, 0x33, 0x43, 0x43, 0x33, 0x53, 0x33, 0x43, 0x24, 0x33,
+  0x9a, 0x08, 0x1b, 0x00, 0x35, 0x23, 0x34, 0x43, 0x43, 0x33, 0x53, 0x33, 0x23, 0x43, 0x12, 0x12,
+  0x11, 0x10, 0x81, 0xba, 0xcb, 0xcd, 0xcc, 0xcb, 0xab, 0xcc, 0xbc, 0xba, 0xcc, 0xbb, 0xcb, 0xcb,
+  0xbb, 0xbc, 0xcb, 0xac, 0xba, 0xcb, 0xab, 0xcb, 0xab, 0xab, 0xcb, 0xab, 0xaa, 0xcb, 0xab, 0x88,
+  0xa8, 0xbb, 0x20, 0xa2, 0x9c, 0x62, 0x02, 0x89, 0x53, 0x23, 0x20, 0x45, 0x13, 0x00, 0x33, 0x33,
+  0x24, 0x33, 0x35, 0x14, 0x80, 0xa8, 0x1a, 0x03, 0xcf, 0x0a, 0xc8, 0xbe, 0xa9, 0xba, 0xeb, 0xcb,
+  0x99, 0xc9, 0x9b, 0x89, 0xca, 0x9a, 0xaa, 0x88, 0xcb, 0x0a, 0xb8, 0x8e, 0x11, 0xa8, 0x48, 0x34,
+  0x53, 0x53, 0x43, 0x23, 0x44, 0x34, 0x22, 0x43, 0x44, 0x22, 0x42, 0x33, 0x23, 0x43, 0x34, 0x33,
+  0x45, 0x33, 0x32, 0x35, 0x33, 0x53, 0x53, 0x23, 0x43, 0x42, 0x33, 0x34, 0x34, 0x24, 0x33, 0x35,
+  0x33, 0x34, 0x34, 0x12, 0x23, 0x23, 0x43, 0x21, 0x22, 0x82, 0x9b, 0x88, 0xda, 0xcc, 0xbc, 0xcb,
+  0xcc, 0xac, 0xbb, 0xbc, 0xcc, 0xcb, 0xab, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xab, 0xbb, 0xac,
+  0xb9, 0xac, 0xaa, 0xbb, 0xab, 0xaa, 0x99, 0xca, 0x09, 0x02, 0xba, 0x61, 0x23, 0x21, 0x34, 0x64,
+  0x13, 0x32, 0x45, 0x12, 0x31, 0x43, 0x22, 0x22, 0x42, 0x13, 0x88, 0x11, 0x98, 0x99, 0xb9, 0x9a,
+  0xfc, 0xbd, 0xca, 0xbc, 0xa9, 0xdb, 0x9b, 0xca, 0xad, 0x9a, 0xdb, 0xab, 0xbb, 0xac, 0xba, 0xcb,
+  0x99, 0xbb, 0x8b, 0x90, 0x0a, 0x22, 0x42, 0x45, 0x34, 0x32, 0x54, 0x53, 0x22, 0x42, 0x43, 0x22,
+  0x33, 0x44, 0x53, 0x32, 0x43, 0x34, 0x22, 0x43, 0x43, 0x34, 0x43, 0x32, 0x44, 0x23, 0x43, 0x34,
+  0x33, 0x34, 0x44, 0x34, 0x33, 0x24, 0x23, 0x32, 0x33, 0x44, 0x23, 0x22, 0x22, 0x98, 0x18, 0xa2,
+  0x22, 0x1b, 0x18, 0x00, 0xbc, 0xfb, 0xbc, 0xda, 0xbb, 0xac, 0xdc, 0xbb, 0xca, 0xbb, 0xbc, 0xca,
+  0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xac, 0xba, 0xab, 0xbc, 0xbb, 0xab, 0xaa, 0xaa, 0xaa, 0x99, 0x80,
+  0x0a, 0x42, 0x23, 0x55, 0x13, 0x52, 0x35, 0x24, 0x43, 0x43, 0x33, 0x32, 0x44, 0x43, 0x33, 0x33,
+  0x24, 0x11, 0x21, 0x23, 0x12, 0x12, 0xb8, 0x9c, 0xec, 0xbb, 0xba, 0xcf, 0xaa, 0xbb, 0xcb, 0xbc,
+  0xbb, 0xbc, 0xbd, 0xab, 0xba, 0xcb, 0xab, 0xab, 0xbc, 0xaa, 0xcb, 0x0a, 0xa0, 0x0a, 0x24, 0x09,
+  0x54, 0x02, 0x64, 0x13, 0x31, 0x25, 0x41, 0x34, 0x12, 0x63, 0x13, 0x32, 0x35, 0x33, 0x34, 0x33,
+  0x44, 0x43, 0x34, 0x33, 0x52, 0x43, 0x31, 0x45, 0x24, 0x33, 0x33, 0x33, 0x33, 0x63, 0x33, 0x33,
+  0x22, 0x22, 0x88, 0x89, 0xa8, 0xdc, 0xcc, 0xcb, 0xbb, 0xbd, 0xac, 0xcb, 0xbc, 0xbc, 0xba, 0xcb,
+  0xab, 0xbb, 0xcc, 0xab, 0xcb, 0xaa, 0xba, 0xab, 0xb9, 0xbd, 0xaa, 0xdb, 0x9b, 0xa8, 0xcb, 0x89,
+  0xba, 0x9b, 0x99, 0x88, 0x10, 0x31, 0x47, 0x42, 0x45, 0x24, 0x33, 0x34, 0x24, 0x42, 0x43, 0x24,
+  0x33, 0x32, 0x22, 0x01, 0x32, 0x23, 0x11, 0x98, 0xdc, 0xcb, 0xbc, 0xaa, 0xce, 0xba, 0xda, 0xab,
+  0xba, 0xbc, 0xaa, 0xcc, 0x9c, 0xa9, 0xaa, 0x89, 0xaa, 0x9a, 0xbb, 0x9d, 0x99, 0x89, 0x11, 0x41,
+  0x13, 0x9a, 0x32, 0xb8, 0x73, 0x06, 0x50, 0x14, 0x00, 0x54, 0x11, 0x32, 0x23, 0x54, 0x13, 0x41,
+  0x37, 0x21, 0x43, 0x13, 0x31, 0x34, 0x73, 0x34, 0x33, 0x43, 0x11, 0x31, 0x14, 0x42, 0x24, 0x01,
+  0x02, 0xa9, 0x21, 0xb0, 0x8b, 0xf8, 0xad, 0xb8, 0xbc, 0x88, 0xeb, 0xab, 0xda, 0xab, 0xb9, 0xab,
+  0xa9, 0xcd, 0xaa, 0xdb, 0x9b, 0xba, 0xaa, 0xba, 0xbc, 0xdb, 0xbc, 0xab, 0xbb, 0x8a, 0xca, 0x9b,
+  0xf5, 0xe5, 0x24, 0x00, 0xca, 0x0a, 0x12, 0x42, 0x23, 0x51, 0x36, 0x43, 0x45, 0x13, 0x32, 0x23,
+  0x32, 0x45, 0x42, 0x33, 0x01, 0x31, 0x81, 0x19, 0x12, 0x21, 0xb2, 0xaf, 0x08, 0xec, 0x8a, 0xb9,
+  0xac, 0xb8, 0xad, 0x88, 0xdc, 0x8a, 0xca, 0x8a, 0xa8, 0xac, 0x90, 0xbd, 0x8a, 0xb9, 0x0b, 0xb8,
+  0xae, 0x98, 0xab, 0x00, 0xa8, 0x18, 0xe9, 0x0a, 0x34, 0x42, 0x36, 0x33, 0x32, 0x23, 0x55, 0x33,
+  0x33, 0x37, 0x24, 0x32, 0x33, 0x23, 0x32, 0x46, 0x35, 0x35, 0x33, 0x23, 0x11, 0x41, 0x53, 0x32,
+  0x34, 0x00, 0x08, 0x98, 0x18, 0xb0, 0xcc, 0xdb, 0xbd, 0x99, 0xa9, 0xab, 0xcd, 0xbc, 0xbb, 0x9a,
+  0x88, 0xab, 0xba, 0xcf, 0xab, 0xaa, 0xab, 0xb9, 0xbd, 0xb9, 0xbe, 0xab, 0xcb, 0xbb, 0xba, 0xbb,
+  0xb9, 0xab, 0x21, 0x00, 0x56, 0x23, 0x42, 0x35, 0x45, 0x43, 0x23, 0x24, 0x12, 0x22, 0x34, 0x42,
+  0x33, 0x02, 0x01, 0xa9, 0x09, 0x90, 0xaa, 0xb9, 0xdf, 0x9a, 0xaa, 0x9a, 0xaa, 0xbb, 0xdc, 0xab,
+  0x00, 0x99, 0xa9, 0xdf, 0xab, 0xcb, 0x9c, 0xaa, 0xba, 0xdc, 0xbc, 0xab, 0xbb, 0x9a, 0xb8, 0x8b,
+  0x80, 0xab, 0x63, 0x01, 0x56, 0x02, 0x51, 0x24, 0x20, 0x43, 0x02, 0x32, 0x11, 0x41, 0x13, 0x71,
+  0x24, 0x88, 0x10, 0xa0, 0x79, 0x45, 0x32, 0x24, 0x12, 0x11, 0x01, 0x64, 0x14, 0x01, 0x01, 0x88,
+  0xa9, 0x89, 0x08, 0xfa, 0xbc, 0xa9, 0xba, 0x9a, 0x99, 0xdc, 0xcb, 0xaa, 0x88, 0x08, 0x00, 0xb0,
+  0xbd, 0xbd, 0xaa, 0xb9, 0xdb, 0xba, 0xeb, 0xbb, 0xcb, 0xac, 0x9a, 0xaa, 0x0a, 0x00, 0x28, 0x35,
+  0x53, 0x54, 0x32, 0x42, 0x24, 0x33, 0x35, 0x23, 0x22, 0x82, 0x08, 0x10, 0x21, 0x22, 0xc0, 0xdb,
+  0xcb, 0xac, 0x09, 0x11, 0x00, 0x88, 0x80, 0x98, 0x9a, 0x31, 0xfb, 0xcf, 0xa9, 0xca, 0xab, 0xdb,
+  0xae, 0xf6, 0x2e, 0x00, 0xcd, 0xbb, 0xac, 0xa9, 0x99, 0xa9, 0xaa, 0xaa, 0x0a, 0x21, 0x55, 0x33,
+  0x32, 0x26, 0x11, 0x43, 0x23, 0x21, 0x34, 0x01, 0x22, 0x10, 0x33, 0xd8, 0x49, 0x26, 0x31, 0x37,
+  0x13, 0x80, 0x18, 0x66, 0x34, 0x53, 0x43, 0x01, 0x88, 0x10, 0x32, 0x21, 0x21, 0xc8, 0xcd, 0x9a,
+  0x99, 0xca, 0xcb, 0xbc, 0xab, 0x08, 0x21, 0x02, 0xca, 0xbb, 0xac, 0x20, 0x13, 0x98, 0xd8, 0xdf,
+  0xab, 0xcb, 0xcb, 0xaa, 0xab, 0xaa, 0xcb, 0x89, 0xb9, 0x0a, 0x53, 0x12, 0x55, 0x24, 0x33, 0x25,
+  0x22, 0x13, 0x12, 0x22, 0x22, 0x42, 0x23, 0x98, 0x99, 0xcc, 0xaa, 0x10, 0x53, 0x24, 0x12, 0x01,
+  0x80, 0x18, 0x43, 0x91, 0xbb, 0xdd, 0xbd, 0xdb, 0xcc, 0xcc, 0xcb, 0xaa, 0x99, 0x99, 0xa9, 0xba,
+  0xdb, 0xab, 0x30, 0x02, 0x31, 0x24, 0x21, 0x44, 0x31, 0x53, 0x80, 0x28, 0x03, 0x29, 0x67, 0x80,
+  0x18, 0x81, 0x0a, 0x34, 0x43, 0x45, 0x00, 0x41, 0x13, 0x42, 0x25, 0x90, 0x88, 0xb9, 0x71, 0x36,
+  0x24, 0x12, 0x88, 0x88, 0xaa, 0x62, 0x23, 0x80, 0xca, 0xaa, 0xb9, 0x9c, 0xb9, 0xce, 0xab, 0x8a,
+  0x30, 0x23, 0x90, 0xda, 0xbd, 0x99, 0x88, 0x21, 0xa0, 0xcd, 0xbb, 0xdc, 0xab, 0xbb, 0xbc, 0x9a,
+  0x09, 0x11, 0x00, 0x31, 0x11, 0x41, 0x47, 0x34, 0x34, 0x34, 0x24, 0x01, 0x11, 0x98, 0x99, 0x20,
+  0x32, 0x26, 0x01, 0x98, 0xcc, 0x1a, 0x24, 0x32, 0x36, 0x82, 0x89, 0x90, 0xb9, 0xec, 0xbd, 0xab,
+  0xbc, 0x8b, 0xb9, 0xbf, 0xcb, 0xba, 0xaa, 0x18, 0x32, 0x01, 0x10, 0x01, 0xa9, 0x09, 0x55, 0x13,
+  0x01, 0x43, 0x12, 0x98, 0x88, 0x00, 0x00, 0x58, 0x77, 0x33, 0x33, 0x13, 0x00, 0x33, 0x12, 0x65,
+  0x23, 0x00, 0x10, 0x53, 0x90, 0xad, 0xca, 0xae, 0x38, 0x47, 0x53, 0x12, 0x00, 0xa8, 0x8a, 0x41,
+  0x27, 0x30, 0x38, 0x00, 0x11, 0x02, 0xba, 0xce, 0xbb, 0x89, 0xda, 0x9c, 0x08, 0x08, 0x31, 0x24,
+  0x82, 0xba, 0xaa, 0xa9, 0x38, 0x15, 0xc9, 0xdb, 0xcd, 0xac, 0xbb, 0xba, 0x99, 0x20, 0x34, 0x32,
+  0x22, 0x22, 0x34, 0x44, 0x35, 0x24, 0x21, 0x12, 0x81, 0xa8, 0xdb, 0xbd, 0x9b, 0x22, 0x53, 0x34,
+  0x02, 0x99, 0x09, 0x42, 0x24, 0x53, 0x02, 0xc9, 0xbb, 0xec, 0xcb, 0xbb, 0xab, 0xab, 0x9b, 0x08,
+  0xa8, 0x8b, 0x81, 0xaa, 0x61, 0x45, 0x34, 0x81, 0x98, 0xe9, 0xbb, 0x09, 0x80, 0x10, 0x01, 0x51,
+  0x23, 0x51, 0x26, 0x81, 0x41, 0x23, 0x42, 0x04, 0x98, 0x10, 0xfb, 0x8a, 0x81, 0x98, 0x88, 0x72,
+  0x04, 0xa9, 0x18, 0xfb, 0x1b, 0x56, 0x43, 0x33, 0x01, 0xa8, 0xcb, 0x19, 0x21, 0x10, 0x81, 0xdb,
+  0xcc, 0x9b, 0x88, 0xea, 0x8b, 0x21, 0x21, 0x54, 0x23, 0xa0, 0xcb, 0xaa, 0xba, 0x0a, 0x01, 0xdb,
+  0xbb, 0xcd, 0xbc, 0xaa, 0x89, 0x18, 0x62, 0x34, 0x23, 0x12, 0x11, 0x90, 0x9a, 0x41, 0x13, 0x11,
+  0x44, 0x82, 0xcb, 0xac, 0xcb, 0x19, 0x65, 0x43, 0x32, 0x02, 0xb9, 0xab, 0x99, 0x99, 0x00, 0xb8,
+  0xdd, 0xbc, 0xbc, 0xcc, 0xaa, 0x99, 0x09, 0x32, 0x25, 0x02, 0x90, 0xc9, 0xbd, 0x09, 0x12, 0x20,
+  0x11, 0x98, 0xfb, 0xbc, 0x09, 0x21, 0x63, 0x24, 0x43, 0x03, 0x08, 0x22, 0xea, 0x19, 0x81, 0x18,
+  0x82, 0x9a, 0x02, 0xdf, 0x19, 0x11, 0x51, 0x43, 0x53, 0x91, 0xbc, 0x88, 0xbb, 0x76, 0x27, 0x01,
+  0x80, 0x88, 0xaa, 0x19, 0x34, 0x90, 0x9c, 0x88, 0xaa, 0x0a, 0x98, 0xdd, 0xab, 0x28, 0x35, 0x11,
+  0x23, 0xe8, 0xac, 0x88, 0x99, 0x8a, 0x21, 0xc8, 0xbe, 0x08, 0xc9, 0x9b, 0x33, 0x80, 0x38, 0x47,
+  0x22, 0x00, 0x00, 0xb9, 0x8a, 0x63, 0x23, 0x12, 0x91, 0xac, 0xab, 0x09, 0x32, 0x53, 0x45, 0x24,
+  0xda, 0x17, 0x35, 0x00, 0x99, 0xaa, 0xcc, 0x9a, 0x11, 0x01, 0xba, 0xcd, 0xba, 0xba, 0xcc, 0x8a,
+  0x08, 0x11, 0x53, 0x13, 0x90, 0xba, 0xbc, 0xad, 0x1a, 0x34, 0x80, 0x30, 0xd1, 0xaf, 0x09, 0x21,
+  0x22, 0x53, 0x44, 0x91, 0x08, 0x04, 0xeb, 0x19, 0xa0, 0x8b, 0x22, 0x91, 0xb8, 0xad, 0x41, 0xa8,
+  0x71, 0x37, 0x10, 0x11, 0xb8, 0xbd, 0x8c, 0x74, 0x23, 0x22, 0x14, 0xb9, 0xac, 0x28, 0x22, 0x00,
+  0x21, 0xe8, 0x9d, 0x08, 0xb8, 0xab, 0x98, 0x89, 0x20, 0x45, 0x12, 0xca, 0xab, 0xbc, 0x9b, 0x10,
+  0x10, 0x98, 0xdb, 0xdc, 0xcb, 0x0a, 0x22, 0x21, 0x44, 0x13, 0x21, 0x43, 0x82, 0x9a, 0x21, 0x01,
+  0x62, 0x24, 0x80, 0x9a, 0xaa, 0xba, 0x0b, 0x56, 0x43, 0x24, 0xb1, 0xbd, 0xab, 0xbc, 0x1a, 0x23,
+  0xa8, 0xbc, 0xad, 0xbb, 0xbb, 0x09, 0x01, 0x31, 0x57, 0x12, 0x08, 0x98, 0xcd, 0xab, 0x09, 0x21,
+  0x53, 0x13, 0xa9, 0xbd, 0x8a, 0x20, 0x55, 0x14, 0x80, 0x99, 0xa8, 0x89, 0xa9, 0xcb, 0xbb, 0x38,
+  0x36, 0x32, 0x14, 0xc8, 0x0b, 0x62, 0x46, 0x33, 0x01, 0xf9, 0xbc, 0x30, 0x44, 0x63, 0x24, 0x80,
+  0xab, 0x0a, 0x10, 0x11, 0x33, 0xc1, 0xbe, 0x8b, 0xa8, 0xbb, 0x9a, 0xca, 0x8a, 0x73, 0x33, 0x91,
+  0xba, 0xbb, 0xae, 0x19, 0x32, 0x88, 0xa8, 0xfc, 0xcb, 0x0a, 0x11, 0x21, 0x62, 0x22, 0x00, 0x21,
+  0x24, 0x00, 0x00, 0x11, 0x88, 0x31, 0x01, 0xc9, 0xde, 0xac, 0x18, 0x32, 0x53, 0x33, 0xa0, 0xbe,
+  0xab, 0x99, 0x08, 0x10, 0xa1, 0xcf, 0x9c, 0xaa, 0x99, 0x10, 0x01, 0x11, 0x43, 0x45, 0x02, 0x98,
+  0xb9, 0xbd, 0x09, 0x42, 0x25, 0x92, 0xba, 0xdb, 0xac, 0x30, 0x45, 0x12, 0x91, 0xa9, 0xbc, 0x09,
+  0x91, 0xbc, 0x00, 0x81, 0x08, 0x42, 0x27, 0xc9, 0x1b, 0x46, 0x12, 0x33, 0x12, 0xfb, 0x9f, 0x40,
+  0xd6, 0x08, 0x40, 0x00, 0x32, 0x44, 0x03, 0xca, 0x8b, 0x10, 0x02, 0x21, 0x03, 0xde, 0xaa, 0x88,
+  0x9a, 0x8a, 0xa9, 0x99, 0x21, 0x35, 0x11, 0xb9, 0xcc, 0xbb, 0x2a, 0x34, 0x01, 0xa8, 0xee, 0xac,
+  0x0a, 0x22, 0x13, 0x21, 0x24, 0xa0, 0x38, 0x27, 0x22, 0x21, 0x12, 0x98, 0x89, 0x10, 0xda, 0xbb,
+  0xca, 0x9b, 0x21, 0x43, 0x24, 0xd8, 0xae, 0x9a, 0x18, 0x23, 0xa0, 0xbc, 0xfc, 0xbc, 0x09, 0x32,
+  0x92, 0xbc, 0x48, 0x92, 0x0b, 0x47, 0x01, 0x9a, 0x09, 0x01, 0xa8, 0x39, 0x25, 0xc9, 0x8a, 0x90,
+  0x09, 0x54, 0x81, 0x88, 0xd9, 0xab, 0x88, 0xb9, 0x18, 0xb8, 0x61, 0x93, 0x0d, 0x25, 0xa8, 0x71,
+  0x26, 0x11, 0x98, 0xb9, 0xdc, 0x2a, 0x57, 0x33, 0x22, 0x90, 0xba, 0x9b, 0x40, 0x23, 0x02, 0xd9,
+  0xbe, 0xab, 0x9a, 0x9a, 0x88, 0x88, 0x09, 0x31, 0x44, 0x91, 0xbb, 0x80, 0xda, 0x1a, 0x25, 0xa1,
+  0xdd, 0xab, 0xaa, 0x8a, 0x52, 0x33, 0x34, 0x24, 0x12, 0x32, 0x43, 0x81, 0x19, 0x34, 0x91, 0xa9,
+  0xed, 0xac, 0xaa, 0x28, 0x23, 0x90, 0x80, 0xca, 0x19, 0xa0, 0x29, 0x06, 0xb9, 0xca, 0xbd, 0xba,
+  0xcd, 0xab, 0x89, 0x40, 0x33, 0x42, 0x03, 0x99, 0x20, 0x91, 0x72, 0x25, 0x88, 0x88, 0x00, 0xc9,
+  0x9c, 0x00, 0xb9, 0x98, 0xfb, 0xab, 0xaa, 0xba, 0xcf, 0x39, 0x15, 0x09, 0x24, 0xc8, 0x3a, 0x25,
+  0x31, 0x35, 0x01, 0xec, 0xac, 0x30, 0x36, 0x53, 0x23, 0x90, 0xaa, 0x89, 0x53, 0x24, 0x90, 0xda,
+  0xbb, 0xbb, 0x9b, 0x08, 0xb9, 0xbd, 0x9b, 0x62, 0x13, 0x08, 0x81, 0xeb, 0x8a, 0x42, 0x13, 0xa8,
+  0xbb, 0xce, 0xac, 0x31, 0x13, 0x11, 0x23, 0x90, 0x19, 0x55, 0x24, 0x01, 0x22, 0x11, 0x88, 0x91,
+  0xfb, 0xac, 0x9a, 0x99, 0x98, 0x41, 0x92, 0xae, 0x18, 0xa8, 0x0a, 0x54, 0x02, 0xca, 0x8a, 0xb8,
+  0x99, 0xf4, 0x30, 0x00, 0x9e, 0x00, 0xa9, 0x18, 0x23, 0xb9, 0x89, 0x12, 0x62, 0x56, 0x23, 0x01,
+  0x98, 0xa9, 0x89, 0x41, 0x14, 0xca, 0xad, 0xcb, 0x9a, 0xb9, 0xbc, 0x99, 0x19, 0x42, 0x53, 0x03,
+  0xcc, 0x39, 0x37, 0x33, 0x12, 0x12, 0xfb, 0xcf, 0x38, 0x33, 0x43, 0x35, 0x81, 0xbb, 0x0a, 0x34,
+  0x12, 0x23, 0xd1, 0xbe, 0x8b, 0x98, 0xaa, 0xa9, 0xba, 0x8d, 0x31, 0x23, 0x98, 0xb9, 0xbd, 0x2a,
+  0x45, 0x13, 0x80, 0x99, 0xed, 0xab, 0x40, 0x02, 0x88, 0x20, 0x01, 0x88, 0x72, 0x44, 0x00, 0x18,
+  0x12, 0x11, 0x11, 0xa0, 0xcc, 0xcc, 0xa9, 0x08, 0x21, 0xb0, 0xdb, 0xcc, 0x9b, 0x30, 0x33, 0x22,
+  0x80, 0xea, 0xcb, 0x8a, 0x00, 0x18, 0x33, 0xd0, 0xbd, 0x88, 0x88, 0x40, 0x34, 0x33, 0x34, 0x24,
+  0x11, 0x80, 0x89, 0xb9, 0xcb, 0xfb, 0xac, 0x99, 0xed, 0x9b, 0x00, 0x80, 0x09, 0x42, 0x02, 0x9a,
+  0x75, 0x13, 0x00, 0x22, 0xf9, 0xbc, 0x3a, 0x47, 0x23, 0x21, 0x01, 0xbc, 0x0a, 0x34, 0x24, 0x00,
+  0xa9, 0xdc, 0x8b, 0x08, 0xca, 0x9b, 0x89, 0x89, 0x21, 0x04, 0xc9, 0x9b, 0x00, 0x20, 0x46, 0x03,
+  0xb9, 0xac, 0xaa, 0xab, 0x29, 0x35, 0x80, 0x08, 0x11, 0x98, 0x73, 0x47, 0x01, 0x32, 0x33, 0x90,
+  0x9a, 0xa9, 0xdc, 0x09, 0x12, 0xda, 0xbc, 0xbb, 0xae, 0x89, 0x00, 0x32, 0x24, 0x81, 0xba, 0x9a,
+  0x18, 0x42, 0x36, 0x82, 0xea, 0xbc, 0xab, 0x89, 0x42, 0x33, 0x80, 0x20, 0x24, 0x22, 0x63, 0x24,
+  0x80, 0x19, 0xa0, 0xcf, 0xaa, 0xcb, 0xac, 0xaa, 0x18, 0xa8, 0x9a, 0x32, 0x34, 0x53, 0x54, 0x15,
+  0xa0, 0x9a, 0x80, 0x71, 0x47, 0x12, 0x90, 0xa9, 0x88, 0x28, 0x64, 0x12, 0xb9, 0xac, 0x99, 0x88,
+  0x88, 0xaa, 0xcc, 0x9a, 0x31, 0x02, 0xca, 0xbc, 0x8a, 0x51, 0x44, 0x22, 0xb9, 0xbd, 0x9b, 0x29,
+  0x53, 0xee, 0x38, 0x00, 0x24, 0x01, 0xb9, 0xbd, 0x0a, 0x53, 0x34, 0x23, 0x11, 0x11, 0x42, 0x23,
+  0x81, 0xca, 0xcb, 0x09, 0x33, 0xd8, 0xbf, 0xad, 0x9b, 0x20, 0x32, 0x01, 0xc9, 0xcb, 0x9b, 0x30,
+  0x45, 0x22, 0x98, 0xa9, 0xba, 0xab, 0x8a, 0x08, 0x98, 0x40, 0x57, 0x12, 0xa8, 0x9a, 0x41, 0x24,
+  0x21, 0x34, 0xe0, 0xcc, 0xaa, 0x8a, 0x08, 0xa9, 0xbc, 0xab, 0x08, 0x31, 0x77, 0x02, 0x99, 0x08,
+  0xba, 0x4a, 0x57, 0x43, 0x12, 0x80, 0xaa, 0x8b, 0x63, 0x24, 0x02, 0xa8, 0xcb, 0xab, 0x8b, 0x00,
+  0xd8, 0xac, 0x10, 0x80, 0x99, 0xcb, 0xbb, 0x9b, 0x72, 0x26, 0x01, 0xb9, 0xbc, 0x9b, 0x18, 0x44,
+  0x03, 0xb9, 0x9c, 0x99, 0x18, 0x55, 0x24, 0x01, 0x08, 0x10, 0x12, 0x12, 0x81, 0x99, 0x28, 0x14,
+  0xb0, 0xef, 0xcc, 0x8a, 0x08, 0x22, 0x02, 0xc9, 0xbd, 0x8a, 0x21, 0x32, 0x34, 0x82, 0xbb, 0xac,
+  0x9b, 0x18, 0x11, 0x00, 0x88, 0x28, 0x25, 0xb0, 0x8b, 0x53, 0x45, 0x54, 0x22, 0x90, 0xcd, 0xac,
+  0x18, 0x81, 0x9a, 0xba, 0xbc, 0x9c, 0x72, 0x12, 0xb9, 0x19, 0x91, 0xac, 0x71, 0x46, 0x23, 0x11,
+  0x01, 0xb8, 0x0a, 0x55, 0x24, 0x02, 0xa8, 0xdc, 0xab, 0x18, 0x98, 0xa9, 0x90, 0xca, 0x9b, 0x10,
+  0xc9, 0x8b, 0x42, 0x23, 0x53, 0x14, 0xe9, 0xab, 0x09, 0x88, 0x20, 0x14, 0xc8, 0xbb, 0xaa, 0x89,
+  0x61, 0x37, 0x23, 0x10, 0x23, 0x00, 0x21, 0x34, 0x01, 0x00, 0x13, 0xfa, 0xbe, 0xbc, 0xcb, 0x09,
+  0x01, 0x98, 0xba, 0xbb, 0x9a, 0x52, 0x35, 0x02, 0x88, 0x00, 0x08, 0x11, 0xd8, 0xac, 0x20, 0x14,
+  0x90, 0xcb, 0x8a, 0xa8, 0x9c, 0x65, 0x23, 0x81, 0xda, 0xad, 0x00, 0x81, 0x88, 0x08, 0xc9, 0xbd,
+  0x51, 0x83, 0xbc, 0x8a, 0xeb, 0x3a, 0x77, 0x22, 0x00, 0x80, 0x88, 0x18, 0x55, 0x23, 0x90, 0xa9,
+  0xbc, 0x2d, 0x3c, 0x00, 0xaa, 0x8a, 0x18, 0xc8, 0xbe, 0x9a, 0x98, 0x88, 0x88, 0xba, 0x8c, 0x53,
+  0x34, 0x12, 0x90, 0xeb, 0x9b, 0x18, 0x32, 0x22, 0xc8, 0xcf, 0x9b, 0x18, 0x32, 0x32, 0x23, 0x03,
+  0x00, 0x73, 0x27, 0x12, 0x00, 0x00, 0x21, 0x02, 0xfa, 0xbd, 0x9b, 0x88, 0x80, 0x98, 0xdc, 0xbb,
+  0x0a, 0x22, 0x12, 0x21, 0x03, 0x80, 0x53, 0x35, 0x90, 0xac, 0x40, 0x33, 0x90, 0xbc, 0xad, 0xac,
+  0x28, 0x13, 0xa9, 0x08, 0xc9, 0xab, 0xac, 0x52, 0x03, 0x8a, 0x11, 0xd9, 0xcc, 0x1a, 0x04, 0xed,
+  0x09, 0x81, 0x72, 0x37, 0x02, 0xb9, 0x08, 0x33, 0x63, 0x35, 0x92, 0xbc, 0x8a, 0x08, 0x18, 0x00,
+  0xeb, 0xac, 0x88, 0x01, 0xa9, 0xcb, 0xab, 0x39, 0x56, 0x13, 0x98, 0xbb, 0xbb, 0x09, 0x54, 0x14,
+  0xa0, 0xaa, 0xba, 0xad, 0x19, 0x34, 0x12, 0x11, 0x12, 0x00, 0x51, 0x44, 0x22, 0x22, 0x22, 0x32,
+  0xa1, 0xdd, 0xbd, 0xab, 0x88, 0x88, 0xc9, 0xce, 0xba, 0x09, 0x11, 0x13, 0x82, 0xa9, 0x20, 0x25,
+  0x22, 0x36, 0x13, 0x00, 0x00, 0xb8, 0xcf, 0x09, 0x81, 0xbb, 0x18, 0xfa, 0xbc, 0x18, 0x00, 0x10,
+  0x32, 0x91, 0x9a, 0x44, 0xa2, 0x9b, 0x81, 0xff, 0x8c, 0x41, 0x35, 0x12, 0x81, 0x88, 0x19, 0x56,
+  0x24, 0x12, 0x80, 0xaa, 0x8a, 0x20, 0x91, 0xcf, 0x9a, 0x98, 0x9a, 0x88, 0xd9, 0xbd, 0x08, 0x12,
+  0x22, 0x33, 0xc8, 0xad, 0x18, 0x23, 0x00, 0x23, 0xfa, 0xac, 0x09, 0x88, 0x99, 0x41, 0x02, 0xac,
+  0x52, 0x35, 0x21, 0x31, 0x34, 0x23, 0x42, 0x23, 0xd8, 0xbb, 0x9c, 0x09, 0x98, 0xec, 0xcc, 0xab,
+  0x9a, 0x00, 0x11, 0x88, 0x98, 0x88, 0x61, 0x44, 0x22, 0x10, 0x41, 0x23, 0x80, 0x98, 0xec, 0xbb,
+  0x8a, 0x08, 0x90, 0xba, 0xee, 0xbb, 0x19, 0x24, 0x81, 0x8a, 0x61, 0x12, 0x08, 0x00, 0xea, 0xbc,
+  0x92, 0xe3, 0x35, 0x00, 0x73, 0x35, 0x12, 0xb0, 0xcb, 0x38, 0x44, 0x33, 0x24, 0xa8, 0xdb, 0x09,
+  0x10, 0x10, 0x82, 0xec, 0x9b, 0x88, 0x98, 0x9a, 0x99, 0xca, 0x1b, 0x25, 0x90, 0x08, 0xd8, 0x8c,
+  0x51, 0x23, 0x80, 0xb9, 0xeb, 0x9b, 0x41, 0x23, 0x01, 0xc9, 0xaa, 0x20, 0x45, 0x33, 0x33, 0x00,
+  0x21, 0x36, 0x22, 0x88, 0xa9, 0xcb, 0x9a, 0x88, 0xfd, 0xbd, 0xba, 0xaa, 0x99, 0x10, 0x12, 0xda,
+  0x0a, 0x12, 0x50, 0x46, 0x22, 0x11, 0x00, 0x89, 0x89, 0x18, 0xda, 0x8c, 0xa8, 0xcf, 0x8a, 0xa8,
+  0x9a, 0x00, 0x18, 0x11, 0x30, 0x25, 0x12, 0x14, 0xfd, 0x0a, 0x44, 0x34, 0x33, 0x98, 0xaa, 0x9c,
+  0x71, 0x35, 0x12, 0xb8, 0xab, 0x89, 0x00, 0x34, 0xb1, 0xbe, 0x9c, 0x89, 0x10, 0x80, 0xdb, 0x9c,
+  0x28, 0x23, 0x12, 0xb8, 0xbd, 0x8a, 0x31, 0x35, 0x83, 0xcc, 0xbc, 0x99, 0x21, 0x25, 0x81, 0xba,
+  0x9a, 0x40, 0x46, 0x33, 0x11, 0x81, 0x88, 0x51, 0x36, 0x91, 0xa9, 0xab, 0xaa, 0x99, 0xb9, 0xdf,
+  0xbb, 0xa9, 0x9a, 0x11, 0xc0, 0xbb, 0x18, 0x51, 0x45, 0x22, 0x12, 0x11, 0x22, 0x90, 0x19, 0x04,
+  0xdc, 0xaa, 0xda, 0xab, 0xcb, 0x9b, 0x99, 0xab, 0x21, 0x00, 0x77, 0x82, 0xaa, 0xaa, 0x1a, 0x47,
+  0x43, 0x24, 0x90, 0x99, 0xba, 0x50, 0x37, 0x13, 0x88, 0x9a, 0xba, 0x8a, 0x63, 0x02, 0xa9, 0xbb,
+  0xbc, 0x8b, 0x10, 0xb8, 0xae, 0x18, 0x10, 0x10, 0xa8, 0xbf, 0x9b, 0x20, 0x44, 0x12, 0xc8, 0xbe,
+  0x9a, 0x28, 0x25, 0x92, 0xba, 0x88, 0x88, 0x63, 0x35, 0x02, 0x88, 0x30, 0x53, 0x43, 0x13, 0xb8,
+  0xab, 0x89, 0x88, 0x88, 0xee, 0xbd, 0xaa, 0x88, 0x88, 0xaa, 0xbc, 0xac, 0x20, 0x36, 0x23, 0x32,
+  0x01, 0x08, 0x34, 0x13, 0xa0, 0xbc, 0xaa, 0xdd, 0x8b, 0xc9, 0xae, 0x9a, 0x99, 0x9a, 0x09, 0x55,
+  0xf3, 0xea, 0x35, 0x00, 0x98, 0x99, 0xba, 0x48, 0x77, 0x22, 0x12, 0x88, 0x89, 0x09, 0x74, 0x23,
+  0x81, 0x9a, 0x89, 0xa9, 0x19, 0x22, 0xd9, 0xbc, 0x89, 0xba, 0x9c, 0x98, 0xbe, 0x29, 0x34, 0x02,
+  0x98, 0xb9, 0xbd, 0x09, 0x44, 0x32, 0x82, 0xde, 0xbb, 0x89, 0x21, 0x13, 0xa0, 0xca, 0xaa, 0x48,
+  0x37, 0x14, 0x01, 0x08, 0x41, 0x44, 0x12, 0x98, 0xaa, 0x8a, 0x10, 0x11, 0xc0, 0xdf, 0xac, 0x9a,
+  0x00, 0x00, 0xa9, 0xcb, 0x99, 0x31, 0x34, 0x35, 0x22, 0x22, 0x02, 0x00, 0x20, 0xa2, 0xbe, 0x89,
+  0xda, 0xbd, 0xbc, 0xcc, 0x9b, 0x08, 0x88, 0x20, 0x14, 0xda, 0x9b, 0x20, 0x75, 0x45, 0x12, 0x88,
+  0x80, 0x00, 0x41, 0x54, 0x13, 0xa8, 0xbb, 0x99, 0x08, 0x10, 0x81, 0xeb, 0xac, 0x9a, 0xba, 0x8b,
+  0x00, 0xba, 0x51, 0x15, 0x90, 0x9a, 0xb9, 0xab, 0x73, 0x16, 0xa8, 0xa9, 0xeb, 0xac, 0x18, 0x33,
+  0x81, 0xca, 0xba, 0x09, 0x64, 0x24, 0x02, 0x10, 0x00, 0x52, 0x34, 0x82, 0xc9, 0x9a, 0x20, 0x12,
+  0xb8, 0xee, 0xbc, 0x8a, 0x20, 0x01, 0x98, 0xcb, 0xac, 0x19, 0x45, 0x33, 0x01, 0x88, 0x88, 0x20,
+  0x02, 0x89, 0x08, 0xeb, 0xbb, 0xcd, 0xcc, 0xba, 0xaa, 0x09, 0x42, 0x03, 0xdb, 0xcd, 0x8a, 0x64,
+  0x33, 0x33, 0x23, 0xc9, 0x9b, 0x74, 0x33, 0x12, 0x80, 0xcb, 0x9b, 0x21, 0x81, 0x88, 0xb9, 0xcf,
+  0x9b, 0x00, 0x98, 0x99, 0x88, 0x08, 0x31, 0x43, 0xc8, 0xad, 0x10, 0x02, 0x10, 0x43, 0xc0, 0xdf,
+  0x9a, 0x88, 0x18, 0x23, 0xc8, 0xac, 0x18, 0x20, 0x54, 0x24, 0x91, 0x08, 0x53, 0x33, 0x23, 0xa0,
+  0xbb, 0x28, 0x13, 0xa0, 0xfe, 0xcc, 0x8a, 0x10, 0x88, 0xa8, 0xca, 0x9a, 0x21, 0x25, 0x12, 0x10,
+  0x00, 0x11, 0x03, 0x0a, 0x55, 0xe8, 0x9b, 0x90, 0xcb, 0xaa, 0xb9, 0xbf, 0x8b, 0x22, 0xc8, 0x09,
+  0x41, 0xe2, 0x2f, 0x00, 0xed, 0x1a, 0x45, 0x33, 0x22, 0x01, 0x99, 0x48, 0x47, 0x22, 0x01, 0x88,
+  0xa8, 0x99, 0x18, 0x12, 0xea, 0xac, 0x9a, 0xb9, 0xaa, 0xba, 0xbb, 0x28, 0x33, 0x11, 0x33, 0xe9,
+  0xad, 0x19, 0x34, 0x35, 0x91, 0xee, 0xbb, 0x09, 0x00, 0x01, 0xb9, 0xbc, 0xab, 0x50, 0x36, 0x11,
+  0x80, 0x30, 0x55, 0x33, 0x11, 0xa8, 0x89, 0x32, 0x34, 0x02, 0xfc, 0xad, 0x8a, 0x08, 0x00, 0x00,
+  0xdb, 0xbd, 0x08, 0x22, 0x33, 0x22, 0xa1, 0xab, 0x20, 0x23, 0x45, 0xa2, 0xbc, 0xcb, 0xab, 0x89,
+  0xfb, 0xcc, 0xaa, 0x18, 0x80, 0xa8, 0xfc, 0x8b, 0x52, 0x33, 0x45, 0x02, 0x99, 0x29, 0x46, 0x23,
+  0x22, 0x82, 0xbb, 0x19, 0x22, 0x98, 0x00, 0xfa, 0xbd, 0x9a, 0x99, 0xa9, 0x9a, 0x89, 0x98, 0x88,
+  0x11, 0x80, 0x09, 0x11, 0x43, 0x56, 0x23, 0xfb, 0xbd, 0xaa, 0x89, 0x11, 0x81, 0xcd, 0xbb, 0x9b,
+  0x40, 0x35, 0x12, 0x00, 0x41, 0x24, 0x43, 0x33, 0x12, 0x20, 0x33, 0x82, 0xcc, 0xac, 0xcb, 0x9a,
+  0xaa, 0xcd, 0xac, 0x09, 0x98, 0x89, 0x10, 0x00, 0x63, 0x24, 0x12, 0xa0, 0x09, 0x23, 0x80, 0x90,
+  0xef, 0xcc, 0xaa, 0x9a, 0xbb, 0x0a, 0xc8, 0xcd, 0xaa, 0xaa, 0x71, 0x35, 0x13, 0x10, 0x21, 0x12,
+  0x74, 0x35, 0x12, 0x80, 0x80, 0x08, 0x10, 0x22, 0xb0, 0xcc, 0xcb, 0xbb, 0xac, 0x89, 0xb9, 0xac,
+  0x09, 0x80, 0x99, 0x08, 0x90, 0x30, 0x56, 0x13, 0x81, 0xda, 0xbe, 0x9b, 0x20, 0x82, 0xea, 0xcc,
+  0xaa, 0x08, 0x31, 0x11, 0x81, 0x00, 0x52, 0x46, 0x24, 0x01, 0x08, 0x32, 0x22, 0x22, 0xb8, 0xcd,
+  0x9b, 0x09, 0xa8, 0xaa, 0xec, 0xcc, 0x9a, 0x00, 0x21, 0x33, 0x81, 0xa9, 0x19, 0x24, 0x20, 0x46,
+  0xa1, 0xad, 0x99, 0xeb, 0xab, 0x99, 0xdb, 0xac, 0x08, 0xea, 0xac, 0x00, 0x43, 0x35, 0x13, 0x00,
+  0xe3, 0xf4, 0x33, 0x00, 0x43, 0x46, 0x23, 0x13, 0x02, 0x88, 0x18, 0x43, 0x03, 0xdc, 0xab, 0xb9,
+  0xba, 0xa9, 0xda, 0xbc, 0x8a, 0x89, 0x09, 0x32, 0x91, 0xbb, 0x29, 0x57, 0x23, 0x90, 0xdb, 0xab,
+  0xa9, 0x99, 0x98, 0xcd, 0xbd, 0xbc, 0x09, 0x11, 0x11, 0x81, 0x8a, 0x73, 0x35, 0x43, 0x12, 0x20,
+  0x22, 0x22, 0x43, 0x01, 0xb9, 0xcd, 0x8a, 0xa0, 0xbb, 0xeb, 0xcd, 0x89, 0x00, 0x28, 0x12, 0xba,
+  0xaa, 0x18, 0x65, 0x22, 0x10, 0xc9, 0xbc, 0x9a, 0x09, 0x23, 0xfc, 0xae, 0x98, 0xa9, 0xaa, 0x09,
+  0x63, 0x33, 0x01, 0x10, 0x53, 0x37, 0x24, 0x42, 0x23, 0x01, 0x00, 0x21, 0x25, 0xa0, 0x9a, 0xaa,
+  0xbc, 0xeb, 0xbc, 0x88, 0xa9, 0x9a, 0xa9, 0x89, 0xa9, 0x2b, 0x26, 0x00, 0x53, 0xa1, 0x89, 0xb8,
+  0xbd, 0x99, 0xcb, 0xcb, 0xcc, 0xbc, 0xbc, 0x89, 0x01, 0x01, 0x98, 0x08, 0x51, 0x57, 0x22, 0x10,
+  0x31, 0x32, 0x34, 0x12, 0x81, 0xb9, 0x9c, 0x88, 0x09, 0xfa, 0xcf, 0x89, 0x88, 0x00, 0x88, 0x88,
+  0xa8, 0x38, 0x05, 0x89, 0x53, 0xa0, 0x1a, 0x91, 0xab, 0xd8, 0xcf, 0x9b, 0x88, 0xa8, 0xcf, 0x0a,
+  0x00, 0x20, 0x44, 0x12, 0x11, 0x33, 0x47, 0x43, 0x33, 0x23, 0x10, 0x21, 0x00, 0x33, 0x82, 0x99,
+  0xfd, 0xae, 0x98, 0x98, 0x88, 0xb8, 0xbc, 0x89, 0x21, 0x91, 0x0a, 0x25, 0xb9, 0x70, 0x03, 0xba,
+  0x9a, 0xbb, 0xbb, 0x88, 0xfa, 0xbe, 0xaa, 0xbb, 0x0a, 0x13, 0x99, 0x00, 0x90, 0x61, 0x56, 0x22,
+  0x11, 0x22, 0x12, 0x21, 0x24, 0x11, 0x00, 0xa0, 0xce, 0x8a, 0xa0, 0xac, 0x08, 0xda, 0x8a, 0x12,
+  0x98, 0xbb, 0x0a, 0x34, 0x32, 0x25, 0xfa, 0xae, 0x88, 0x88, 0x99, 0xcb, 0xba, 0xdc, 0xbd, 0x8a,
+  0x41, 0x33, 0x10, 0x52, 0x12, 0x41, 0x65, 0x34, 0x13, 0x10, 0x21, 0x32, 0x22, 0x12, 0x98, 0xa9,
+  0xe4, 0x1e, 0x28, 0x00, 0xbe, 0xac, 0xaa, 0xbb, 0xcc, 0xaa, 0x98, 0x8a, 0x80, 0xa9, 0x30, 0x91,
+  0x48, 0x15, 0xe9, 0xbc, 0xaa, 0xa9, 0xcc, 0xbb, 0xcd, 0xab, 0xca, 0xab, 0x11, 0xb0, 0x9b, 0x43,
+  0x33, 0x11, 0x73, 0x27, 0x11, 0x21, 0x12, 0x20, 0x12, 0x08, 0x11, 0x88, 0x99, 0xdd, 0x9a, 0x88,
+  0x98, 0xaa, 0x89, 0x52, 0x03, 0xdd, 0x0b, 0x33, 0x81, 0xfb, 0xbc, 0x88, 0xc9, 0xcc, 0x8a, 0x88,
+  0xfa, 0xbb, 0xaa, 0x29, 0x37, 0x01, 0x31, 0x15, 0x00, 0x73, 0x35, 0x14, 0x11, 0x12, 0x88, 0x52,
+  0x13, 0x88, 0x00, 0xa8, 0xbd, 0x99, 0x98, 0xbb, 0x99, 0xdc, 0x8a, 0x01, 0xa9, 0x8a, 0x08, 0x08,
+  0x10, 0x90, 0xdf, 0xcd, 0xaa, 0x99, 0xa8, 0xeb, 0xbc, 0xba, 0xaa, 0x99, 0x99, 0x08, 0x12, 0x88,
+  0x52, 0x34, 0x43, 0x44, 0x43, 0x23, 0x12, 0x81, 0x88, 0x11, 0x11, 0x22, 0xf8, 0xbc, 0xac, 0x09,
+  0x11, 0x99, 0x21, 0x44, 0x14, 0xda, 0x0b, 0x53, 0x22, 0xa8, 0xbd, 0xba, 0xda, 0xcb, 0xbb, 0xaa,
+  0xdb, 0xab, 0xdc, 0x9a, 0x22, 0x51, 0x56, 0x13, 0x98, 0x20, 0x37, 0x33, 0x22, 0x14, 0x00, 0x28,
+  0x12, 0x11, 0x01, 0xdb, 0xac, 0x99, 0xab, 0x0a, 0x91, 0xcd, 0x8a, 0x52, 0x12, 0x98, 0x80, 0x99,
+  0x18, 0x81, 0xfb, 0xdd, 0xcb, 0xba, 0xcb, 0xba, 0xcb, 0xab, 0xba, 0xbc, 0x9a, 0x10, 0x34, 0x23,
+  0x42, 0x13, 0x30, 0x57, 0x12, 0x10, 0x80, 0x88, 0x88, 0x99, 0xda, 0x9c, 0x80, 0xb9, 0x50, 0x14,
+  0xb9, 0x29, 0x57, 0x13, 0x10, 0x13, 0xaa, 0x19, 0x81, 0xd9, 0xbd, 0x99, 0xfa, 0xac, 0xab, 0x8a,
+  0x22, 0xc0, 0xbc, 0x28, 0x34, 0x11, 0x75, 0x14, 0x08, 0x10, 0x42, 0x33, 0x22, 0x11, 0x01, 0x43,
+  0x02, 0x99, 0x11, 0xa0, 0x39, 0x16, 0xea, 0x0a, 0x22, 0xb0, 0x8b, 0x64, 0x83, 0xca, 0x08, 0xb0,
+  0x62, 0x0e, 0x24, 0x00, 0x19, 0xa0, 0xcf, 0xcb, 0xba, 0xba, 0xcb, 0xcc, 0xac, 0x09, 0x89, 0xaa,
+  0xdb, 0x9a, 0x10, 0x11, 0x23, 0x11, 0xc0, 0xae, 0x30, 0x24, 0x11, 0x81, 0xda, 0xbc, 0x19, 0x34,
+  0x12, 0xa0, 0x8a, 0x54, 0x22, 0x34, 0x13, 0x62, 0x03, 0x88, 0x23, 0xa0, 0x9a, 0xec, 0x9a, 0xa8,
+  0xbc, 0xab, 0xcd, 0x9b, 0x28, 0x53, 0x90, 0x8a, 0x31, 0x31, 0x77, 0x24, 0x11, 0x80, 0x28, 0x44,
+  0x32, 0x14, 0xa0, 0x48, 0x24, 0x98, 0x09, 0x41, 0x05, 0xb9, 0x40, 0x92, 0x0b, 0x24, 0xca, 0x19,
+  0x23, 0x12, 0xd8, 0xac, 0x88, 0x20, 0xb2, 0xef, 0x89, 0xa8, 0xbc, 0x89, 0xcb, 0x9c, 0x88, 0xaa,
+  0xaa, 0xbb, 0x09, 0x18, 0x22, 0xc9, 0x0b, 0x02, 0xb9, 0xdd, 0x1b, 0x04, 0xde, 0x8a, 0xa8, 0xac,
+  0x09, 0x22, 0x80, 0x0a, 0x44, 0x22, 0x74, 0x23, 0x21, 0x23, 0xa0, 0x38, 0x16, 0xc9, 0x8b, 0x00,
+  0xf9, 0xbc, 0x0a, 0x12, 0xb8, 0x9c, 0x20, 0x22, 0x53, 0x34, 0x02, 0x18, 0x45, 0x35, 0x13, 0x98,
+  0x30, 0x23, 0x23, 0x82, 0xba, 0x29, 0x45, 0x13, 0x98, 0x18, 0x40, 0x77, 0x12, 0x88, 0x10, 0x33,
+  0x35, 0x82, 0xab, 0x29, 0x24, 0x11, 0xd9, 0xce, 0x8a, 0x10, 0x98, 0xbc, 0xca, 0xbb, 0x29, 0x92,
+  0xbf, 0x8b, 0x80, 0x9a, 0x99, 0xb8, 0xbe, 0x89, 0xd8, 0xad, 0x09, 0x99, 0x9a, 0xfb, 0x9a, 0x88,
+  0xa9, 0x00, 0x98, 0x29, 0x83, 0x19, 0x47, 0x12, 0x10, 0x11, 0x11, 0x09, 0x66, 0x92, 0xbd, 0x29,
+  0x23, 0xca, 0x0b, 0x24, 0xb9, 0x29, 0x02, 0x18, 0x46, 0x01, 0x18, 0x81, 0x09, 0x44, 0x03, 0xcd,
+  0x39, 0x37, 0x80, 0x89, 0x80, 0x28, 0x47, 0x12, 0x80, 0x20, 0x12, 0x11, 0x63, 0x13, 0x10, 0x32,
+  0x24, 0x13, 0xb9, 0x39, 0x67, 0x12, 0x98, 0x09, 0x12, 0x30, 0x36, 0xb0, 0x8a, 0x99, 0x60, 0x05,
+  0xcd, 0x08, 0x21, 0x00, 0x9c, 0x00, 0xdb, 0x18, 0xc0, 0xbd, 0x08, 0x90, 0xcb, 0xcb, 0x09, 0x82,
+  0xcc, 0x1a, 0x81, 0x9a, 0xa9, 0x9c, 0xa0, 0xcf, 0x30, 0xb0, 0x9d, 0x11, 0x89, 0x22, 0xee, 0x38,
+  0x17, 0xa8, 0x8b, 0x22, 0x91, 0x8a, 0x34, 0xf8, 0x9b, 0x42, 0x82, 0xbb, 0xab, 0x20, 0x24, 0xa0,
+  0xad, 0x28, 0x33, 0x21, 0xa8, 0x1b, 0x47, 0x81, 0x09, 0x99, 0x71, 0x04, 0xab, 0x08, 0x99, 0x72,
+  0x91, 0x9b, 0x08, 0x40, 0x25, 0xa8, 0x28, 0x25, 0x10, 0x08, 0x21, 0x14, 0x20, 0x13, 0xeb, 0x09,
+  0x91, 0x8a, 0x22, 0xfa, 0x9d, 0x32, 0x92, 0xbc, 0x20, 0x02, 0x40, 0x24, 0xca, 0x1a, 0x12, 0x10,
+  0x01, 0xaa, 0xba, 0xce, 0x9a, 0x88, 0x28, 0xc1, 0xaf, 0x99, 0xab, 0x72, 0x91, 0x8a, 0x81, 0x9a,
+  0x43, 0xfa, 0x39, 0x05, 0xba, 0x09, 0x08, 0x11, 0xe9, 0x0a, 0x91, 0x9b, 0x42, 0x82, 0xca, 0x8b,
+  0x32, 0xee, 0x49, 0x04, 0xca, 0x89, 0x98, 0x21, 0xa1, 0xbd, 0x28, 0x32, 0x24, 0x99, 0x09, 0x10,
+  0x73, 0x04, 0xda, 0x8a, 0x10, 0x80, 0xb9, 0xad, 0x18, 0x11, 0x00, 0x35, 0x02, 0x39, 0x57, 0x02,
+  0x10, 0x12, 0x01, 0x00, 0x11, 0xe9, 0xbc, 0xaa, 0xbb, 0xaa, 0x19, 0x24, 0xd8, 0x9b, 0x42, 0x44,
+  0x34, 0x33, 0x23, 0xa1, 0xac, 0x21, 0xa1, 0xbc, 0xa8, 0xef, 0xbb, 0x9a, 0x08, 0x90, 0xaa, 0x40,
+  0x36, 0x23, 0x42, 0x34, 0x12, 0x32, 0x25, 0x13, 0xc9, 0x8b, 0x11, 0xb9, 0xce, 0xbb, 0x89, 0x11,
+  0xc8, 0xbe, 0x2a, 0x55, 0x02, 0xa9, 0x18, 0x14, 0x80, 0x32, 0xe0, 0x9c, 0x01, 0xb9, 0x99, 0xfb,
+  0x0b, 0x13, 0xc9, 0x89, 0xa9, 0x28, 0x36, 0x02, 0xa9, 0x8b, 0x52, 0x23, 0xa0, 0xbf, 0x19, 0x92,
+  0xcc, 0x18, 0x80, 0x88, 0x9a, 0x41, 0x12, 0x62, 0x13, 0x11, 0x44, 0x32, 0x23, 0xa8, 0x19, 0xc0,
+  0x60, 0x00, 0x0f, 0x00, 0x1b, 0xa3, 0xff, 0x8f, 0x00, 0x99, 0x09, 0x80, 0xb9, 0x19, 0x53, 0x02,
+  0x88, 0xa8, 0x9a, 0x52, 0x24, 0xa1, 0xcf, 0x8a, 0x21, 0x08, 0x88, 0xa9, 0x19, 0x24, 0x63, 0x25,
+  0xa8, 0x68, 0x24, 0x98, 0x20, 0x02, 0x88, 0x01, 0xb9, 0x8a, 0x80, 0xdb, 0xac, 0x99, 0x28, 0x36,
+  0x82, 0x8a, 0x45, 0x13, 0x11, 0xa9, 0x51, 0x25, 0xa9, 0xa9, 0xcd, 0x19, 0x23, 0xa9, 0xbd, 0xac,
+  0x08, 0x20, 0x34, 0xe0, 0x9d, 0x20, 0x23, 0x99, 0x09, 0x00, 0x20, 0x35, 0x00, 0x00, 0x19, 0x46,
+  0xa1, 0x8c, 0x20, 0x21, 0x83, 0xff, 0x89, 0x11, 0x02, 0xb9, 0xbb, 0xa9, 0x51, 0x05, 0xca, 0x9a,
+  0xaa, 0x61, 0x82, 0xab, 0x09, 0x89, 0x22, 0xa9, 0x29, 0xd9, 0x4a, 0x16, 0xda, 0xab, 0x30, 0x26,
+  0xc9, 0x0a, 0x22, 0x51, 0x24, 0xba, 0x49, 0x24, 0x00, 0x13, 0x90, 0x52, 0xb0, 0x9e, 0x21, 0xa0,
+  0x8a, 0xc8, 0xae, 0x28, 0x22, 0xa0, 0xba, 0x39, 0x47, 0x11, 0xa8, 0x9b, 0x62, 0x82, 0xbb, 0x09,
+  0xdc, 0x0a, 0x82, 0xdb, 0x9a, 0x18, 0x33, 0xd1, 0x0b, 0x23, 0x11, 0x36, 0x90, 0x20, 0x90, 0x48,
+  0xa4, 0xae, 0x63, 0x91, 0xaa, 0x98, 0x29, 0x13, 0x30, 0xa4, 0xff, 0x29, 0x15, 0xa8, 0x9b, 0x09,
+  0x32, 0x82, 0xeb, 0xab, 0x28, 0x12, 0x80, 0xfa, 0xab, 0x41, 0x02, 0x80, 0xcc, 0x1a, 0x53, 0x11,
+  0xa8, 0xcb, 0x50, 0x33, 0x81, 0xaa, 0x19, 0x32, 0x55, 0x92, 0xac, 0x40, 0x12, 0x81, 0xa9, 0x30,
+  0x05, 0x0a, 0x53, 0xa0, 0xab, 0x41, 0x02, 0xed, 0x9a, 0x10, 0x81, 0xcb, 0x9b, 0x90, 0x19, 0x35,
+  0xa1, 0x29, 0x43, 0x33, 0xb0, 0x70, 0x25, 0xb8, 0xbb, 0x1a, 0x44, 0xf9, 0x9c, 0x00, 0x99, 0x20,
+  0xa0, 0xab, 0x41, 0x32, 0x91, 0x2a, 0x47, 0x80, 0x18, 0x81, 0x30, 0x93, 0x2b, 0x37, 0xfd, 0x19,
+  0x21, 0x00, 0x18, 0x00, 0x91, 0x00, 0xb9, 0x8c, 0x31, 0x02, 0xba, 0x0b, 0xa2, 0xbf, 0x61, 0xa2,
+  0x9c, 0x01, 0xaa, 0x50, 0x92, 0xab, 0xa8, 0x1b, 0x57, 0x91, 0x8a, 0x08, 0x31, 0x45, 0x80, 0x09,
+  0x11, 0x41, 0x23, 0x10, 0x80, 0x29, 0x15, 0xec, 0x29, 0x82, 0x9c, 0x10, 0xda, 0x1a, 0x12, 0x98,
+  0xba, 0x8b, 0x45, 0x01, 0x98, 0xcd, 0x28, 0x23, 0x18, 0x91, 0xcf, 0x28, 0x13, 0x89, 0xb0, 0xaf,
+  0x41, 0x90, 0x29, 0xb3, 0xbf, 0x31, 0x92, 0x89, 0x02, 0xa8, 0xab, 0x61, 0x03, 0x9b, 0x33, 0xde,
+  0x38, 0x94, 0xbb, 0x10, 0xc9, 0x19, 0xb9, 0x2b, 0x03, 0xad, 0x10, 0xb9, 0x28, 0x13, 0xb9, 0xdd,
+  0x2a, 0x24, 0xb0, 0xa9, 0xdc, 0x9b, 0x00, 0x18, 0x12, 0xbc, 0x49, 0x25, 0x23, 0x43, 0x21, 0x43,
+  0x53, 0x43, 0x23, 0x33, 0x25, 0x11, 0x20, 0x53, 0x23, 0xa0, 0x9b, 0x73, 0x12, 0xa9, 0xbb, 0xae,
+  0x10, 0x91, 0xba, 0xcc, 0x9b, 0x24, 0xc0, 0xbb, 0xb9, 0x9a, 0x09, 0xa9, 0xfb, 0x19, 0x24, 0xb0,
+  0xbb, 0xaa, 0x49, 0x93, 0xdb, 0x09, 0x09, 0x29, 0x01, 0x9a, 0x31, 0x12, 0x11, 0x19, 0x33, 0x24,
+  0x12, 0x11, 0x33, 0x33, 0x12, 0xb9, 0xbb, 0x1a, 0x21, 0xb9, 0xbb, 0x9b, 0x10, 0x23, 0x99, 0x11,
+  0x02, 0xa9, 0xdb, 0xbb, 0xaa, 0xdb, 0xbb, 0xcb, 0xba, 0xb9, 0x9a, 0x41, 0x23, 0x22, 0x34, 0x34,
+  0x35, 0x22, 0x31, 0x35, 0x23, 0x12, 0x11, 0x53, 0x12, 0x91, 0x09, 0x31, 0x11, 0x20, 0x63, 0x32,
+  0x12, 0x09, 0x30, 0x24, 0x91, 0xba, 0x9b, 0x10, 0xb1, 0xbe, 0xbb, 0xaa, 0x9a, 0xbb, 0xbb, 0xbb,
+  0xbb, 0x9b, 0x00, 0x99, 0x9a, 0x0a, 0x31, 0x92, 0xbb, 0xad, 0xa9, 0x99, 0xa9, 0xbb, 0x9b, 0xaa,
+  0x19, 0x21, 0x10, 0x32, 0x33, 0x33, 0x33, 0x31, 0x43, 0x12, 0x99, 0x09, 0x09, 0x21, 0x91, 0x9a,
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x11, 0x01, 0xcb, 0x0a, 0x01, 0xaa, 0xaa, 0xdb, 0x9b, 0xba, 0xbe,
+  0x9a, 0x9a, 0x19, 0x91, 0xa9, 0x10, 0x12, 0x31, 0x24, 0x22, 0x53, 0x12, 0x22, 0x34, 0x12, 0x43,
+  0x12, 0x10, 0x23, 0xb9, 0x09, 0x01, 0x20, 0x53, 0x82, 0x08, 0x12, 0x21, 0x33, 0x91, 0x19, 0x33,
+  0xa9, 0x99, 0xbb, 0xad, 0x80, 0xcb, 0x9b, 0xc9, 0xab, 0x90, 0xbb, 0x9b, 0xa9, 0xbb, 0x11, 0xd9,
+  0x0a, 0x01, 0xab, 0x10, 0xc9, 0x1a, 0x23, 0x90, 0x32, 0x03, 0x30, 0x33, 0x09, 0x53, 0x02, 0x09,
+  0x33, 0x91, 0x30, 0x13, 0x99, 0x02, 0xeb, 0x19, 0x91, 0xab, 0xa0, 0xbc, 0x1a, 0xc9, 0xac, 0x09,
+  0xba, 0x1a, 0x03, 0x9a, 0x31, 0x92, 0x09, 0x23, 0x21, 0x43, 0x43, 0x53, 0x22, 0x10, 0x35, 0x33,
+  0x42, 0x33, 0x13, 0x33, 0x91, 0x09, 0x91, 0x19, 0x13, 0xdb, 0x11, 0xe0, 0x0b, 0x14, 0xb9, 0x30,
+  0xd1, 0x0b, 0x03, 0xbf, 0x38, 0xc9, 0x9d, 0x80, 0xaa, 0x99, 0xba, 0x0a, 0x11, 0xbb, 0x09, 0x32,
+  0xb9, 0x9b, 0x33, 0xb9, 0x2b, 0x23, 0xba, 0x30, 0x11, 0x42, 0x13, 0xbb, 0x73, 0x03, 0x08, 0x22,
+  0x90, 0x31, 0x13, 0x20, 0x13, 0xdb, 0x38, 0x04, 0xcb, 0x99, 0x90, 0x09, 0xb0, 0xbd, 0x20, 0x92,
+  0xcb, 0x99, 0xab, 0x31, 0xc0, 0x8b, 0x53, 0xb8, 0x9b, 0x10, 0xb9, 0xab, 0x33, 0x23, 0x31, 0x25,
+  0x42, 0x23, 0x8a, 0x66, 0x23, 0x42, 0x23, 0x99, 0xa9, 0xbd, 0x50, 0x03, 0xbd, 0x2a, 0x03, 0xab,
+  0x31, 0xea, 0x39, 0xf2, 0x9d, 0x43, 0xb8, 0x3a, 0xa4, 0x9e, 0x21, 0xb8, 0x49, 0xa3, 0x9f, 0x31,
+  0xb1, 0x0a, 0x12, 0xaa, 0x22, 0xc0, 0x39, 0x16, 0xb8, 0x08, 0x81, 0x40, 0x84, 0xbc, 0x31, 0x04,
+  0xaa, 0x10, 0x01, 0x21, 0x92, 0xbc, 0x39, 0x93, 0xbd, 0x19, 0xa1, 0x1a, 0x15, 0xfb, 0x1a, 0x23,
+  0x00, 0x00, 0x06, 0x00, 0xbb, 0x80, 0x0a, 0x43, 0xf9, 0x0a, 0x11, 0xa9, 0x00, 0xaa, 0x30, 0xa1,
+  0x1a, 0x13, 0x32, 0x14, 0x0a, 0x55, 0x02, 0x41, 0x24, 0x00, 0x23, 0x12, 0x32, 0x01, 0xcb, 0x08,
+  0xa9, 0xcb, 0x09, 0xa9, 0xbb, 0x9a, 0x99, 0x99, 0x99, 0x19, 0x13, 0xbb, 0x9b, 0x99, 0xab, 0xba,
+  0x9a, 0xba, 0x8c, 0x21, 0xb9, 0x19, 0xb9, 0x0b, 0x03, 0x09, 0x33, 0xc9, 0x18, 0xb0, 0x9e, 0x98,
+  0x99, 0x32, 0xb0, 0x09, 0x11, 0x22, 0x13, 0x19, 0x43, 0x81, 0x10, 0xb9, 0x9b, 0x12, 0xaa, 0xb9,
+  0x9a, 0x33, 0xf9, 0x8a, 0x21, 0x99, 0x00, 0x9a, 0x21, 0xd9, 0x1b, 0x01, 0xab, 0x33, 0xb0, 0x2b,
+  0x24, 0x98, 0x20, 0x53, 0x12, 0x11, 0x43, 0x12, 0x43, 0x02, 0x1a, 0x53, 0x81, 0x18, 0x03, 0xdb,
+  0x29, 0x02, 0x99, 0x90, 0xba, 0x19, 0x33, 0x91, 0x20, 0xb1, 0xab, 0x12, 0xc9, 0x19, 0x91, 0xad,
+  0x08, 0x99, 0x19, 0xa3, 0x9b, 0x99, 0xa9, 0x9a, 0x11, 0x91, 0xac, 0x10, 0xdb, 0x1b, 0x84, 0xbc,
+  0x30, 0xb2, 0x9d, 0x12, 0xca, 0x19, 0x91, 0x1b, 0x33, 0x01, 0x30, 0x33, 0xa1, 0x29, 0x23, 0xba,
+  0x20, 0xa0, 0x39, 0x15, 0x99, 0x72, 0x02, 0x89, 0x11, 0x98, 0x00, 0x91, 0xbb, 0x19, 0x90, 0xdb,
+  0x19, 0x91, 0xab, 0x21, 0x90, 0x39, 0x13, 0x99, 0x53, 0x03, 0x9a, 0x31, 0xa0, 0x19, 0x12, 0x20,
+  0x44, 0x02, 0x19, 0x33, 0x92, 0x9b, 0x31, 0x91, 0x20, 0x23, 0x11, 0x33, 0xa1, 0x09, 0x02, 0xb9,
+  0x30, 0x91, 0x9b, 0x10, 0xb9, 0xbb, 0x99, 0xcb, 0xbb, 0xaa, 0xdb, 0xab, 0xa9, 0xbb, 0xbb, 0x99,
+  0x09, 0xa9, 0x19, 0x92, 0x9a, 0x32, 0x91, 0x9b, 0x99, 0x10, 0x12, 0x9a, 0x31, 0xb2, 0x9b, 0x11,
+  0x10, 0x43, 0x98, 0x73, 0x03, 0x08, 0x33, 0xa0, 0x53, 0xb0, 0x3a, 0x17, 0xdb, 0x28, 0x03, 0x9a,
+  0x10, 0x00, 0x04, 0x00, 0x93, 0xbb, 0x30, 0x93, 0xaf, 0xa9, 0xaa, 0x0a, 0xb0, 0x9b, 0x20, 0x11,
+  0x41, 0x33, 0x12, 0x31, 0x33, 0x53, 0x43, 0xd9, 0x1a, 0x24, 0xc9, 0x29, 0x03, 0xa9, 0x32, 0x94,
+  0x0a, 0x53, 0x82, 0x99, 0xeb, 0x8a, 0x12, 0x02, 0x21, 0xb9, 0x9a, 0xcb, 0x20, 0xf9, 0x9d, 0x20,
+  0xa9, 0x38, 0x92, 0x2b, 0x93, 0xaf, 0x31, 0x91, 0x40, 0xb1, 0x2c, 0x36, 0x90, 0x32, 0x91, 0x0a,
+  0x91, 0x99, 0xb9, 0xad, 0x11, 0x33, 0x15, 0xea, 0x9a, 0x13, 0xe9, 0x8b, 0x12, 0xcb, 0x50, 0xb2,
+  0xaf, 0x20, 0x81, 0x9b, 0x08, 0x88, 0x18, 0x12, 0x90, 0x00, 0xeb, 0x0b, 0x34, 0xb0, 0x2a, 0x33,
+  0x73, 0x25, 0x90, 0x0a, 0x14, 0xa9, 0x73, 0xb3, 0xaf, 0x42, 0xa2, 0x8a, 0x13, 0x99, 0x20, 0x81,
+  0x09, 0xb9, 0x1c, 0xa3, 0x9d, 0x44, 0xd8, 0x2a, 0x15, 0xbc, 0x48, 0x93, 0x9b, 0x45, 0xc8, 0x0a,
+  0x11, 0x98, 0x08, 0x00, 0x21, 0x24, 0xd8, 0x9c, 0x32, 0xc9, 0x4a, 0x84, 0xad, 0x41, 0x92, 0x9c,
+  0x41, 0x91, 0x8c, 0x22, 0xc8, 0x8c, 0x23, 0xa0, 0x9a, 0x20, 0x45, 0xb1, 0xaf, 0x30, 0x93, 0xbe,
+  0x30, 0x92, 0x9c, 0x10, 0x11, 0x90, 0xab, 0x36, 0xe8, 0x1a, 0x23, 0xaa, 0x21, 0xdc, 0x38, 0x84,
+  0x8a, 0x33, 0xa9, 0x10, 0x10, 0x45, 0xd9, 0x8b, 0x33, 0xa9, 0x89, 0x18, 0x24, 0xb0, 0xac, 0xbd,
+  0x70, 0x15, 0xa9, 0x08, 0x89, 0x40, 0xc1, 0xaf, 0x18, 0x11, 0x11, 0xb8, 0x49, 0x27, 0xa9, 0x0a,
+  0x32, 0x90, 0xba, 0xac, 0x51, 0xa3, 0xae, 0x31, 0xa1, 0x58, 0x27, 0xa9, 0x9b, 0x10, 0x33, 0xe0,
+  0xae, 0x20, 0x12, 0x98, 0x9a, 0x31, 0x03, 0x19, 0xa1, 0x0e, 0x55, 0xb0, 0x0b, 0x11, 0x9a, 0x21,
+  0x81, 0xca, 0xbe, 0x30, 0x94, 0x9b, 0x31, 0x22, 0x02, 0x8c, 0x54, 0xfa, 0x0c, 0x23, 0xd9, 0x8a,
+  0x9a, 0xff, 0x15, 0x00, 0x33, 0xc0, 0x0b, 0x36, 0xb8, 0x48, 0x92, 0x9e, 0x81, 0xbe, 0x49, 0x36,
+  0x91, 0xcf, 0x18, 0x04, 0x98, 0x21, 0x10, 0x75, 0x23, 0x34, 0xc0, 0x9e, 0x12, 0xfb, 0x0b, 0x11,
+  0xaa, 0x10, 0x01, 0x18, 0x33, 0x14, 0x91, 0x99, 0x99, 0x30, 0xf0, 0xef, 0x18, 0x22, 0x90, 0x9a,
+  0x31, 0x02, 0x89, 0xa0, 0x8d, 0x42, 0xd9, 0x09, 0xa1, 0x8c, 0x54, 0x80, 0x28, 0x23, 0x98, 0x31,
+  0xa3, 0xef, 0x09, 0x81, 0x89, 0x23, 0x88, 0x61, 0x13, 0x98, 0xa8, 0xab, 0x98, 0x9a, 0xc9, 0x9d,
+  0x32, 0xb0, 0x78, 0x15, 0x09, 0x10, 0xaa, 0x18, 0xb0, 0xbc, 0xaa, 0x38, 0x94, 0x9d, 0x43, 0xa0,
+  0x9b, 0x20, 0x37, 0xc9, 0x8c, 0x00, 0x30, 0x17, 0xb9, 0x28, 0xa1, 0x9c, 0x08, 0x00, 0x82, 0xcc,
+  0x40, 0x56, 0x12, 0xca, 0x19, 0x54, 0x03, 0xec, 0x0a, 0x81, 0x89, 0x01, 0xdc, 0x40, 0x14, 0x90,
+  0x08, 0x10, 0x91, 0xbd, 0x09, 0xc9, 0x2a, 0x26, 0xa9, 0x28, 0x15, 0x98, 0x90, 0xda, 0x19, 0x12,
+  0xcc, 0x0a, 0x31, 0x32, 0x23, 0x98, 0x1a, 0x45, 0xa2, 0xbe, 0x99, 0x89, 0x52, 0xb2, 0xaf, 0x52,
+  0x03, 0xa9, 0x88, 0x21, 0xa1, 0xac, 0x20, 0xa0, 0x0b, 0x54, 0x81, 0x9a, 0x00, 0x00, 0x42, 0xa1,
+  0x9c, 0x12, 0xfb, 0x09, 0xc8, 0xaf, 0x41, 0x14, 0x90, 0x88, 0x20, 0x12, 0xfb, 0x8a, 0x12, 0xa9,
+  0x19, 0x80, 0x28, 0x37, 0x91, 0xaa, 0x1a, 0x43, 0xb2, 0xdf, 0x8b, 0x31, 0x02, 0x89, 0x21, 0x24,
+  0x33, 0x33, 0xf9, 0xbf, 0x29, 0x82, 0xbb, 0x68, 0x24, 0xa0, 0x28, 0x13, 0xa9, 0x08, 0xdb, 0x8a,
+  0x00, 0x09, 0x53, 0x01, 0x88, 0x74, 0x85, 0xca, 0x09, 0x90, 0x19, 0xb0, 0x9e, 0x42, 0x01, 0x20,
+  0xa0, 0x0c, 0x81, 0x9a, 0x02, 0xef, 0x29, 0x14, 0xa9, 0x1a, 0x22, 0x82, 0xaa, 0x8a, 0x90, 0x09,
+  0x80, 0xfe, 0x24, 0x00, 0xc8, 0x9d, 0x20, 0x55, 0x04, 0xca, 0x49, 0x25, 0xb9, 0x8b, 0x11, 0x89,
+  0x21, 0xc8, 0x0a, 0x32, 0x46, 0x91, 0xac, 0x18, 0x81, 0xa8, 0xcf, 0x38, 0x15, 0xa8, 0x89, 0x01,
+  0x21, 0x00, 0xb9, 0xcc, 0x19, 0x13, 0xeb, 0x8a, 0x32, 0x23, 0xc9, 0x0c, 0x43, 0xa0, 0xcb, 0x9a,
+  0x00, 0xa9, 0x48, 0x82, 0x29, 0x77, 0x81, 0xb9, 0x08, 0x02, 0xdb, 0x8a, 0x11, 0x00, 0x42, 0x24,
+  0x01, 0x22, 0xc0, 0xad, 0x89, 0x99, 0x1a, 0x44, 0xa1, 0x0c, 0x57, 0x91, 0x89, 0x80, 0x8a, 0x32,
+  0x81, 0xc8, 0xbe, 0x39, 0x24, 0x80, 0xba, 0x2a, 0x37, 0xb0, 0x9d, 0x11, 0x98, 0x19, 0x04, 0xcc,
+  0x59, 0x24, 0xba, 0x9a, 0x30, 0x15, 0xeb, 0x09, 0x81, 0x18, 0x90, 0x9b, 0x45, 0x91, 0x38, 0x83,
+  0xdc, 0x29, 0x25, 0xd9, 0x8b, 0x32, 0xa8, 0x30, 0x91, 0xae, 0x21, 0x03, 0x21, 0x13, 0xde, 0x1a,
+  0x91, 0xbe, 0x28, 0x22, 0x00, 0x11, 0x43, 0xa1, 0xaf, 0x28, 0xb8, 0x0b, 0x24, 0xa0, 0x18, 0x63,
+  0x13, 0xdb, 0x09, 0x01, 0xaa, 0x98, 0x19, 0x23, 0xdb, 0x72, 0x07, 0xa8, 0x18, 0x10, 0x21, 0xc1,
+  0xad, 0x10, 0x11, 0x21, 0xc8, 0x9c, 0x44, 0x82, 0xb9, 0x30, 0x15, 0xbd, 0x2a, 0x13, 0xba, 0x28,
+  0x04, 0xbb, 0x73, 0x87, 0xaa, 0x28, 0x91, 0xcc, 0x08, 0x01, 0x08, 0x44, 0xb0, 0x2a, 0x25, 0xba,
+  0x10, 0xf9, 0x0a, 0x03, 0x8a, 0x43, 0xf9, 0x1a, 0x22, 0x98, 0xaa, 0xbb, 0x63, 0xa1, 0x9d, 0x20,
+  0x90, 0x10, 0x90, 0x9b, 0x73, 0x02, 0xda, 0xac, 0x28, 0x12, 0x08, 0x08, 0x63, 0x23, 0xb9, 0x38,
+  0xd1, 0xae, 0x20, 0x12, 0x34, 0x02, 0x10, 0x03, 0xfb, 0x8a, 0x33, 0x14, 0x99, 0x60, 0x24, 0xc9,
+  0x2a, 0x03, 0xcc, 0x30, 0x92, 0xbf, 0x08, 0x22, 0x90, 0xa9, 0x70, 0x24, 0xd9, 0x8b, 0x00, 0xaa,
+  0xbc, 0xfe, 0x28, 0x00, 0x01, 0x98, 0x21, 0x11, 0x33, 0xd8, 0x39, 0x83, 0xbc, 0xb0, 0xbf, 0x73,
+  0x92, 0x9a, 0x88, 0x48, 0x27, 0xa0, 0x08, 0x90, 0x1b, 0x17, 0xdb, 0x8a, 0x32, 0x11, 0x00, 0x18,
+  0x42, 0x82, 0xdc, 0x0b, 0x11, 0xba, 0x8a, 0xea, 0x29, 0x34, 0x08, 0x01, 0xeb, 0x09, 0x90, 0x08,
+  0xfa, 0x8b, 0x24, 0xa9, 0x20, 0xa8, 0x60, 0xb3, 0x9e, 0x98, 0xbd, 0x52, 0xa2, 0x8d, 0x10, 0x21,
+  0x02, 0xdc, 0x19, 0x23, 0x90, 0x89, 0x88, 0x88, 0x73, 0x92, 0xab, 0x40, 0x35, 0x81, 0x9b, 0x22,
+  0x90, 0x19, 0xb8, 0x38, 0x05, 0x72, 0x16, 0xca, 0x29, 0x43, 0x91, 0xaa, 0x40, 0x04, 0x99, 0x31,
+  0x91, 0x8a, 0x90, 0x60, 0x25, 0x00, 0x22, 0xf9, 0x0b, 0x35, 0xa0, 0xba, 0x8a, 0x43, 0xd0, 0x1b,
+  0x35, 0xb8, 0x1b, 0x13, 0xfc, 0x8c, 0x31, 0xd8, 0x9b, 0x21, 0xa0, 0x8d, 0x20, 0xd8, 0x9b, 0x10,
+  0xa8, 0x99, 0xfb, 0x8b, 0x23, 0xcc, 0x28, 0x92, 0xad, 0x10, 0x80, 0x08, 0xb9, 0x29, 0xb2, 0x9f,
+  0x74, 0x91, 0xac, 0x31, 0x82, 0x09, 0x63, 0x81, 0x8a, 0x22, 0x81, 0x18, 0x53, 0x34, 0x81, 0x09,
+  0x55, 0x90, 0x89, 0x01, 0x18, 0x67, 0x23, 0x32, 0x81, 0x28, 0x04, 0xbc, 0x50, 0x92, 0x1a, 0x12,
+  0x38, 0x57, 0xb8, 0x29, 0x83, 0xcc, 0x20, 0xa0, 0x8b, 0x80, 0xb9, 0xfb, 0xac, 0x38, 0x92, 0xbd,
+  0x09, 0xb8, 0xbe, 0x89, 0xa8, 0x99, 0xdb, 0x8b, 0x81, 0x0a, 0x91, 0xff, 0x8c, 0x81, 0x99, 0x11,
+  0xb8, 0x29, 0x14, 0x98, 0x31, 0xd9, 0x0a, 0x03, 0xaa, 0x65, 0x02, 0x8a, 0x41, 0x14, 0x90, 0x08,
+  0x22, 0x11, 0xc8, 0x8d, 0x44, 0x90, 0x72, 0x07, 0x99, 0x20, 0xa1, 0xac, 0x18, 0x62, 0x25, 0x11,
+  0x33, 0xb1, 0xad, 0x88, 0x00, 0x21, 0x10, 0x34, 0xc8, 0x69, 0x04, 0xcb, 0x0a, 0x11, 0x31, 0x02,
+  0x25, 0x1d, 0x2f, 0x00, 0x80, 0xfc, 0x9c, 0x08, 0x80, 0x89, 0x42, 0xc8, 0x9d, 0x20, 0xc9, 0x9c,
+  0x09, 0x08, 0x80, 0x09, 0x02, 0xfc, 0x8a, 0x00, 0xa9, 0x28, 0x14, 0xa9, 0x9a, 0x10, 0x81, 0x89,
+  0x41, 0x03, 0x28, 0x67, 0x82, 0x88, 0x98, 0x9a, 0x31, 0x44, 0x34, 0x91, 0x8a, 0x08, 0x88, 0x43,
+  0xf0, 0x9d, 0x40, 0x03, 0xba, 0x30, 0xc1, 0xae, 0x10, 0x02, 0xea, 0x9b, 0x64, 0x02, 0x20, 0x27,
+  0xa0, 0x9c, 0x30, 0x81, 0x88, 0x11, 0x11, 0x91, 0x48, 0x57, 0xb8, 0x0a, 0x24, 0xba, 0x41, 0x83,
+  0x08, 0xc0, 0x9d, 0x32, 0xb9, 0x48, 0xb2, 0x9d, 0x11, 0xa8, 0x99, 0xcc, 0x8a, 0xa9, 0x0a, 0x13,
+  0xbb, 0xb9, 0xef, 0x09, 0x98, 0x20, 0x93, 0x9e, 0x30, 0xb8, 0x0c, 0x22, 0xba, 0x9a, 0x41, 0x37,
+  0xb8, 0x2a, 0x84, 0xad, 0x61, 0x82, 0x09, 0x02, 0x19, 0x23, 0xce, 0x50, 0xb1, 0x8b, 0x15, 0xb9,
+  0x31, 0xe8, 0x1a, 0xa0, 0x8d, 0x33, 0xb8, 0x28, 0xb1, 0x8c, 0xb8, 0x8b, 0x57, 0x12, 0x21, 0x33,
+  0xa0, 0x8a, 0x82, 0x8a, 0x45, 0x90, 0x74, 0x84, 0x89, 0x33, 0xca, 0x29, 0x82, 0x61, 0x04, 0x99,
+  0x22, 0xea, 0x8a, 0x81, 0x08, 0x80, 0x88, 0x01, 0xba, 0x99, 0xdd, 0xba, 0xbc, 0x19, 0x92, 0xac,
+  0xa8, 0xbf, 0x89, 0xa9, 0x29, 0x23, 0xa9, 0xbb, 0x19, 0xa2, 0xaf, 0x10, 0xc9, 0x0a, 0x45, 0x34,
+  0xa0, 0x9d, 0x31, 0xa8, 0x39, 0x36, 0x12, 0x00, 0x20, 0x24, 0xc9, 0x8b, 0x33, 0xe8, 0x0b, 0x25,
+  0xf8, 0xac, 0x08, 0xa0, 0xbb, 0x20, 0x14, 0xba, 0x9c, 0x43, 0xf8, 0x8d, 0x42, 0x80, 0x50, 0x24,
+  0x81, 0x99, 0x8a, 0x53, 0xa0, 0x38, 0x27, 0xa8, 0x20, 0x23, 0x80, 0x89, 0x30, 0x13, 0x88, 0x75,
+  0x14, 0xc9, 0x9a, 0x80, 0x9a, 0x09, 0x11, 0xa9, 0xac, 0x18, 0xc0, 0xbf, 0x99, 0xb9, 0xab, 0x89,
+  0xb0, 0xff, 0x28, 0x00, 0xa8, 0xec, 0xab, 0xa9, 0x8b, 0x44, 0xa0, 0x09, 0x82, 0x9c, 0x21, 0xb8,
+  0x09, 0xda, 0x70, 0x13, 0x09, 0x24, 0xb8, 0x09, 0x12, 0x54, 0x13, 0x31, 0x03, 0xba, 0x18, 0x81,
+  0x80, 0xbc, 0x78, 0x94, 0xbd, 0xac, 0xcb, 0xbc, 0xad, 0x18, 0xa1, 0xad, 0x51, 0x93, 0xcd, 0x19,
+  0x91, 0x8b, 0x74, 0x34, 0x01, 0x99, 0x30, 0xa1, 0x8c, 0x56, 0x81, 0x89, 0x31, 0x02, 0x88, 0x10,
+  0x22, 0xc0, 0x0a, 0x77, 0x82, 0x8a, 0x08, 0xa9, 0x8b, 0x10, 0x01, 0xc8, 0xac, 0x19, 0xb0, 0xbb,
+  0x08, 0xf9, 0xac, 0x19, 0x81, 0xca, 0xbb, 0xdb, 0xaa, 0x20, 0x24, 0x11, 0xb9, 0x9d, 0x10, 0x81,
+  0x10, 0xc0, 0x9c, 0x63, 0x02, 0x10, 0x11, 0xaa, 0x89, 0x31, 0x77, 0x03, 0xa9, 0x18, 0xa8, 0x0a,
+  0x36, 0xa1, 0xac, 0x38, 0x24, 0xea, 0xab, 0x98, 0xce, 0x8a, 0x88, 0x89, 0xa9, 0x0a, 0x92, 0xbd,
+  0x21, 0xf8, 0x9d, 0x20, 0x54, 0x34, 0x12, 0x01, 0xa9, 0x28, 0x12, 0x73, 0x13, 0x10, 0x12, 0x98,
+  0x65, 0x92, 0x9a, 0x32, 0x01, 0x44, 0x14, 0x81, 0xdb, 0x9c, 0x18, 0xa8, 0x19, 0x12, 0xfa, 0x9c,
+  0x18, 0x80, 0xac, 0x09, 0x81, 0xbc, 0x08, 0xa1, 0xdc, 0xcb, 0x1a, 0x12, 0x98, 0x73, 0x84, 0xdb,
+  0x18, 0x81, 0x88, 0x00, 0x10, 0x02, 0xcb, 0x58, 0xa2, 0xae, 0x30, 0x12, 0x38, 0x35, 0xa0, 0xab,
+  0x9a, 0x19, 0x63, 0x02, 0x00, 0xd9, 0x8b, 0x82, 0xcd, 0x09, 0xfa, 0x8b, 0x80, 0x89, 0xa1, 0xbf,
+  0x19, 0x90, 0x2a, 0x93, 0xbe, 0x98, 0xcd, 0x72, 0x16, 0x01, 0x11, 0x88, 0x89, 0x10, 0x63, 0x82,
+  0x89, 0x31, 0x92, 0x0a, 0x43, 0x03, 0xda, 0x2a, 0x57, 0x81, 0x08, 0x00, 0xeb, 0x9a, 0x18, 0x10,
+  0x98, 0x9b, 0x01, 0xec, 0x1a, 0x12, 0xca, 0x0a, 0x00, 0x01, 0xd8, 0x9b, 0xb8, 0xbf, 0x38, 0x12,
+  0xfe, 0xfb, 0x2c, 0x00, 0x31, 0xa1, 0x9b, 0x08, 0x30, 0x24, 0xdb, 0x09, 0x81, 0x18, 0x83, 0xff,
+  0x89, 0x11, 0x32, 0x44, 0x02, 0xa0, 0xcb, 0xab, 0x30, 0x24, 0x08, 0x01, 0xcd, 0x8a, 0xa0, 0x19,
+  0xa3, 0xdf, 0x18, 0xa8, 0x9c, 0xba, 0xbd, 0xcb, 0x0b, 0x34, 0x03, 0xb9, 0xae, 0x99, 0xba, 0x74,
+  0x47, 0x11, 0x00, 0x08, 0x88, 0x88, 0x40, 0x13, 0x89, 0x41, 0x11, 0x10, 0x11, 0x20, 0x92, 0x9c,
+  0x75, 0x22, 0x81, 0xc9, 0xbc, 0x9a, 0x89, 0x21, 0x81, 0xeb, 0xbb, 0x0a, 0x98, 0x09, 0x22, 0xfa,
+  0xab, 0x10, 0xa0, 0xbf, 0xaa, 0xba, 0x2a, 0x36, 0x24, 0x01, 0xda, 0x0a, 0x91, 0x29, 0x36, 0xc8,
+  0x8a, 0x90, 0x8b, 0x12, 0xbc, 0x72, 0x81, 0x1a, 0x34, 0x99, 0x28, 0xd9, 0x1a, 0x14, 0x88, 0x23,
+  0xfc, 0x0a, 0x81, 0x9b, 0x33, 0xe9, 0x0a, 0xc9, 0xad, 0x90, 0xcc, 0x19, 0xc8, 0x1b, 0x24, 0xba,
+  0x08, 0xfc, 0x19, 0x24, 0x31, 0x57, 0x01, 0x08, 0x88, 0x89, 0x22, 0x11, 0x52, 0x81, 0x8b, 0x32,
+  0x81, 0x29, 0x14, 0x10, 0x22, 0x54, 0x26, 0xb0, 0xae, 0xa9, 0xab, 0x28, 0x13, 0xa9, 0xba, 0xbe,
+  0x8b, 0x88, 0x30, 0x13, 0xcc, 0x28, 0xb1, 0xcf, 0x09, 0xc9, 0x9b, 0x32, 0x22, 0x33, 0x81, 0x9a,
+  0xba, 0x4b, 0x27, 0x90, 0x98, 0xca, 0x8b, 0xb9, 0x9d, 0x81, 0x38, 0x37, 0x80, 0x41, 0x93, 0xbc,
+  0x19, 0x22, 0x33, 0x14, 0x98, 0xfb, 0xbd, 0x0a, 0x00, 0x89, 0x32, 0xf0, 0xcd, 0xab, 0xaa, 0xcb,
+  0x8b, 0x10, 0x99, 0x88, 0x00, 0xf9, 0xbf, 0x18, 0x13, 0x74, 0x35, 0x23, 0x00, 0x99, 0x08, 0x88,
+  0x71, 0x14, 0x80, 0x00, 0x99, 0x10, 0x00, 0x50, 0x13, 0xa9, 0x72, 0x13, 0x88, 0x99, 0xdc, 0xbb,
+  0x99, 0x10, 0x82, 0xdb, 0xab, 0xba, 0x9b, 0x41, 0x24, 0x91, 0x8b, 0x81, 0xde, 0x8b, 0x98, 0xac,
+  0x04, 0xfd, 0x28, 0x00, 0x80, 0x08, 0x23, 0xba, 0x60, 0x23, 0x10, 0x01, 0xca, 0xaa, 0xca, 0x9a,
+  0xe8, 0xcd, 0x09, 0x22, 0x11, 0x32, 0x24, 0xb0, 0x9b, 0x52, 0x24, 0x11, 0x00, 0xc9, 0xbe, 0x19,
+  0x91, 0xac, 0x11, 0xdc, 0x8b, 0xf9, 0xcb, 0xb9, 0xbc, 0x89, 0xbb, 0x38, 0x82, 0x09, 0xa2, 0xae,
+  0x90, 0xae, 0x75, 0x25, 0x32, 0x23, 0x00, 0x98, 0x9a, 0x74, 0x03, 0x10, 0x22, 0xa9, 0x8a, 0x01,
+  0x41, 0x92, 0x8b, 0x47, 0x82, 0x18, 0x03, 0xdc, 0xab, 0x8a, 0x18, 0x01, 0xdb, 0xbb, 0xdc, 0xbb,
+  0x20, 0x24, 0x00, 0x20, 0xa8, 0xad, 0x99, 0xbb, 0x9a, 0xca, 0x1a, 0x82, 0xab, 0x31, 0x03, 0x42,
+  0x23, 0xb9, 0x9a, 0x74, 0x04, 0xbb, 0xdc, 0xde, 0x8b, 0x21, 0x12, 0x53, 0x91, 0xac, 0x88, 0x00,
+  0x63, 0x03, 0x11, 0xa1, 0xad, 0x00, 0xd8, 0x8b, 0x80, 0x8a, 0x98, 0xbc, 0xa8, 0xff, 0x8d, 0x98,
+  0x09, 0x11, 0x01, 0x12, 0xe9, 0x8a, 0xa8, 0x9b, 0x73, 0x35, 0x34, 0x23, 0x02, 0x99, 0x08, 0x33,
+  0x47, 0x23, 0x00, 0xa8, 0xae, 0x28, 0x02, 0x18, 0x35, 0x98, 0x28, 0x23, 0x00, 0xa8, 0xbe, 0x8a,
+  0xba, 0x0b, 0x25, 0xfb, 0xae, 0x99, 0x99, 0x08, 0x43, 0x03, 0x90, 0xb9, 0xbc, 0x88, 0xa9, 0x0a,
+  0xb0, 0xbf, 0x09, 0xa9, 0x0a, 0x44, 0x22, 0x00, 0x00, 0x80, 0xca, 0x8b, 0xb0, 0xff, 0x9a, 0x10,
+  0x08, 0x20, 0x01, 0xda, 0xac, 0x48, 0x37, 0x11, 0x21, 0x91, 0xca, 0xba, 0x18, 0x02, 0xcb, 0x08,
+  0xb9, 0xba, 0xef, 0xaa, 0xda, 0x9c, 0x00, 0x88, 0x22, 0x90, 0x88, 0xf9, 0x9c, 0x88, 0x89, 0x34,
+  0x42, 0x47, 0x24, 0x10, 0x08, 0x10, 0x22, 0x51, 0x45, 0x81, 0x99, 0x99, 0x9a, 0x20, 0x42, 0x34,
+  0x82, 0x9a, 0x32, 0x91, 0x2a, 0x25, 0xb9, 0x9a, 0xda, 0xbc, 0xda, 0xdc, 0xab, 0x89, 0x9a, 0x28,
+  0x04, 0x04, 0x26, 0x00, 0x03, 0x08, 0xb9, 0xae, 0x99, 0xc9, 0x89, 0x02, 0xd9, 0xac, 0xbb, 0xbc,
+  0x39, 0x34, 0x22, 0x02, 0xdc, 0x28, 0x92, 0x9b, 0x03, 0xdf, 0x8b, 0x80, 0x10, 0x24, 0xa9, 0x9a,
+  0xa9, 0x70, 0x35, 0x12, 0x34, 0xa1, 0x8c, 0x00, 0xba, 0x10, 0xfa, 0x8b, 0xd8, 0xae, 0x98, 0xcb,
+  0x09, 0xb8, 0x0b, 0x14, 0xbb, 0x71, 0xa2, 0x8c, 0x81, 0xeb, 0x28, 0x23, 0x73, 0x25, 0x01, 0x00,
+  0x91, 0x20, 0x36, 0x23, 0x23, 0x91, 0xbc, 0x0a, 0x01, 0x32, 0x37, 0x11, 0x90, 0x09, 0x10, 0x10,
+  0x62, 0x12, 0xa0, 0xeb, 0xab, 0xca, 0xad, 0x9a, 0xb9, 0xbc, 0x9a, 0x10, 0x21, 0x13, 0xc8, 0xbe,
+  0xac, 0x8a, 0x21, 0x02, 0xb9, 0xef, 0xbb, 0x8a, 0x30, 0x34, 0x12, 0x99, 0xcb, 0x8a, 0x12, 0x11,
+  0x12, 0xec, 0x9b, 0x99, 0x38, 0x04, 0xab, 0x20, 0xfb, 0x3a, 0x27, 0x21, 0x44, 0x81, 0x89, 0x80,
+  0xcb, 0x28, 0xa8, 0x9c, 0xc8, 0xbf, 0xab, 0xdb, 0x8a, 0x91, 0xaa, 0x18, 0x98, 0x0a, 0x43, 0x03,
+  0xfb, 0xbb, 0xca, 0x1a, 0x66, 0x44, 0x12, 0x10, 0x11, 0x88, 0x51, 0x35, 0x23, 0x21, 0x00, 0xba,
+  0xab, 0x41, 0x35, 0x12, 0x21, 0x83, 0xbb, 0x71, 0x24, 0x23, 0x82, 0x98, 0xc9, 0xbe, 0x99, 0xba,
+  0xac, 0xdb, 0x9b, 0x89, 0x99, 0x31, 0xb1, 0x9c, 0xb9, 0xaf, 0x08, 0xb8, 0x8a, 0xa8, 0xcf, 0xbb,
+  0xac, 0x18, 0x91, 0x28, 0x24, 0xb9, 0x09, 0x81, 0x20, 0x04, 0x88, 0xa8, 0xef, 0x8a, 0x01, 0x88,
+  0x20, 0xb8, 0x0a, 0x36, 0x42, 0x45, 0x23, 0x98, 0x99, 0x9a, 0x08, 0xa9, 0x89, 0xfc, 0xef, 0x99,
+  0xaa, 0x89, 0x01, 0x89, 0x21, 0xb9, 0x1b, 0x82, 0x8a, 0x92, 0xef, 0x09, 0x98, 0x71, 0x34, 0x23,
+  0x32, 0x01, 0x21, 0x43, 0x45, 0x35, 0x02, 0x00, 0x80, 0xba, 0x19, 0x24, 0x44, 0x24, 0x00, 0x32,
+  0x50, 0x0c, 0x24, 0x00, 0x00, 0x45, 0x14, 0x01, 0x01, 0xa8, 0xba, 0xbd, 0xab, 0xca, 0xdb, 0xab,
+  0x9a, 0x99, 0x08, 0x10, 0xb0, 0xce, 0xab, 0x99, 0x00, 0x00, 0xca, 0xce, 0xbd, 0xbb, 0x89, 0x99,
+  0x20, 0x81, 0xcb, 0x8a, 0x88, 0x19, 0x42, 0x91, 0xaa, 0xca, 0x9b, 0x42, 0xa0, 0xbb, 0xee, 0xac,
+  0x98, 0x99, 0x50, 0x13, 0x22, 0x25, 0xb9, 0x9b, 0xa8, 0xac, 0xa9, 0xdf, 0xcb, 0xcb, 0xab, 0x99,
+  0x9a, 0x89, 0xdb, 0x8b, 0x01, 0x00, 0x22, 0x31, 0x03, 0xde, 0x29, 0x37, 0x43, 0x34, 0x13, 0x00,
+  0x88, 0x20, 0x46, 0x35, 0x32, 0x34, 0x01, 0x89, 0x21, 0x23, 0x55, 0x34, 0x32, 0x33, 0x11, 0x54,
+  0x23, 0x21, 0x33, 0x00, 0x30, 0x81, 0x18, 0x23, 0xa0, 0xcd, 0xad, 0xaa, 0x9a, 0x11, 0x12, 0x02,
+  0xfe, 0xac, 0xba, 0x9a, 0x88, 0xca, 0xbc, 0xce, 0xac, 0x89, 0xa9, 0x99, 0xa8, 0xcc, 0xaa, 0xaa,
+  0x19, 0x80, 0xba, 0xba, 0xce, 0x9a, 0xa8, 0x9a, 0xb9, 0xed, 0xab, 0x99, 0x80, 0x08, 0x10, 0x81,
+  0xca, 0xab, 0xaa, 0xba, 0xce, 0xcd, 0xcb, 0xbb, 0xbb, 0xaa, 0x99, 0xcb, 0xbd, 0x99, 0x88, 0x21,
+  0x35, 0x03, 0xa9, 0xcb, 0xab, 0x52, 0x63, 0x46, 0x24, 0x22, 0x22, 0x12, 0x42, 0x34, 0x34, 0x35,
+  0x42, 0x33, 0x12, 0x33, 0x25, 0x23, 0x53, 0x44, 0x22, 0x23, 0x44, 0x22, 0x12, 0x32, 0x22, 0x88,
+  0x21, 0x22, 0x21, 0x11, 0x90, 0xea, 0xcd, 0xbb, 0xca, 0xaa, 0xaa, 0xcc, 0xbb, 0xaa, 0xec, 0xbb,
+  0xcc, 0xcb, 0xab, 0xca, 0xaa, 0xba, 0xbd, 0x99, 0xba, 0xac, 0xbb, 0x9a, 0x90, 0xdb, 0x9a, 0xda,
+  0xbd, 0xaa, 0x09, 0xa8, 0xba, 0xaa, 0xda, 0xcc, 0x9b, 0x10, 0xa0, 0xab, 0x08, 0xea, 0xcd, 0xab,
+  0xbb, 0xbc, 0xab, 0xaa, 0xab, 0xac, 0x99, 0x99, 0x9a, 0xa9, 0xcb, 0x40, 0x23, 0xbb, 0xcb, 0xcd,
+  0x5b, 0xf2, 0x12, 0x00, 0x72, 0x46, 0x54, 0x23, 0x13, 0x12, 0x21, 0x43, 0x33, 0x54, 0x23, 0x21,
+  0x42, 0x35, 0x23, 0x22, 0x44, 0x22, 0x22, 0x54, 0x24, 0x33, 0x33, 0x23, 0x90, 0xba, 0x8a, 0x00,
+  0x21, 0x35, 0x02, 0x89, 0xb9, 0xce, 0x9b, 0x88, 0x99, 0xab, 0xcb, 0xcd, 0xdc, 0xcb, 0xaa, 0xbd,
+  0x9c, 0x9a, 0xbb, 0xbb, 0xbb, 0xbb, 0xcc, 0x9a, 0xbb, 0xac, 0xc9, 0xac, 0x9a, 0xcb, 0xbc, 0xbb,
+  0xaa, 0xb9, 0xae, 0xaa, 0xb9, 0xac, 0x09, 0xb0, 0xbe, 0x9a, 0x9a, 0x28, 0xb1, 0xcf, 0xba, 0xdb,
+  0xab, 0xaa, 0xab, 0xca, 0xad, 0x19, 0x11, 0xaa, 0x48, 0x03, 0xb9, 0x08, 0x90, 0xdc, 0x9b, 0x73,
+  0x44, 0x54, 0x43, 0x23, 0x22, 0x32, 0x33, 0x43, 0x45, 0x23, 0x22, 0x44, 0x24, 0x12, 0x22, 0x34,
+  0x33, 0x63, 0x44, 0x23, 0x22, 0x33, 0x24, 0x11, 0x00, 0x01, 0x98, 0x89, 0x20, 0x11, 0x11, 0x11,
+  0x11, 0x02, 0xfc, 0xac, 0xab, 0xeb, 0xcb, 0xba, 0xbc, 0xbc, 0xbd, 0xbc, 0xcc, 0xac, 0x9a, 0x9a,
+  0x88, 0x99, 0xba, 0xcb, 0xdc, 0xbb, 0xab, 0xaa, 0xab, 0x9a, 0xcc, 0xbc, 0xcb, 0xbb, 0x9b, 0x89,
+  0xca, 0xcc, 0x9b, 0xa9, 0xac, 0x28, 0x91, 0xdc, 0x9b, 0x88, 0xfb, 0xab, 0x89, 0xda, 0xbb, 0x8b,
+  0x10, 0x80, 0x18, 0x13, 0xb8, 0x9c, 0x61, 0x13, 0x01, 0x12, 0xe9, 0x0b, 0x32, 0x76, 0x35, 0x34,
+  0x23, 0x02, 0x31, 0x35, 0x34, 0x44, 0x23, 0x12, 0x31, 0x34, 0x34, 0x32, 0x44, 0x33, 0x24, 0x33,
+  0x45, 0x23, 0x33, 0x33, 0x02, 0x98, 0x9a, 0x28, 0x21, 0x53, 0x23, 0xa8, 0x99, 0xa8, 0xa9, 0xeb,
+  0xcd, 0xcc, 0xbc, 0x08, 0xa8, 0xcc, 0xaa, 0xdc, 0xbc, 0xaa, 0x99, 0xba, 0xaa, 0x98, 0xca, 0xbd,
+  0xba, 0xca, 0xbd, 0x9a, 0xcb, 0xab, 0xba, 0xbc, 0x8a, 0xdb, 0xbb, 0xcb, 0xab, 0xaa, 0xcb, 0x89,
+  0x8f, 0xf8, 0x17, 0x00, 0xba, 0x9b, 0x90, 0xfb, 0xdb, 0xab, 0xbc, 0xab, 0xab, 0xbb, 0xbb, 0xdd,
+  0xba, 0xca, 0x89, 0x22, 0x20, 0x54, 0x92, 0xab, 0x9a, 0x09, 0x12, 0x08, 0x54, 0x82, 0x72, 0x67,
+  0x32, 0x32, 0x33, 0x33, 0x42, 0x35, 0x23, 0x22, 0x35, 0x23, 0x43, 0x43, 0x24, 0x12, 0x53, 0x44,
+  0x21, 0x31, 0x34, 0x32, 0x31, 0x33, 0x91, 0xba, 0x9a, 0x21, 0x35, 0x32, 0x33, 0x82, 0xdb, 0xaa,
+  0x9a, 0xeb, 0xcd, 0xaa, 0xaa, 0xcd, 0xab, 0xba, 0xdc, 0xab, 0xbb, 0xca, 0xcb, 0xab, 0x99, 0xba,
+  0xbc, 0xdb, 0xbc, 0xbc, 0xcb, 0xaa, 0xdb, 0x9a, 0xaa, 0x9c, 0x99, 0xca, 0xab, 0xba, 0xeb, 0xaa,
+  0xab, 0x89, 0xba, 0x8b, 0xb8, 0xdf, 0x9b, 0xa9, 0xaa, 0x9a, 0xca, 0xcb, 0xbb, 0xbb, 0x99, 0x88,
+  0xb9, 0x1a, 0x43, 0x11, 0x73, 0x14, 0x98, 0x9a, 0x08, 0x00, 0x40, 0x67, 0x44, 0x44, 0x34, 0x23,
+  0x32, 0x43, 0x33, 0x53, 0x24, 0x13, 0x21, 0x35, 0x33, 0x43, 0x43, 0x43, 0x33, 0x35, 0x34, 0x22,
+  0x32, 0x34, 0x23, 0x22, 0x01, 0xa9, 0x89, 0x18, 0x73, 0x22, 0x11, 0x23, 0xa0, 0xca, 0xeb, 0xcb,
+  0xbb, 0xbc, 0xba, 0xbd, 0xbc, 0xbd, 0xbb, 0xbb, 0xbc, 0xac, 0xba, 0xca, 0xab, 0x9a, 0xeb, 0xbd,
+  0xbb, 0xcb, 0xbc, 0xab, 0xaa, 0xbc, 0x9c, 0xa9, 0xbb, 0xad, 0xa9, 0xb9, 0xcb, 0xaa, 0xeb, 0xab,
+  0xab, 0xba, 0x99, 0xca, 0xbc, 0x99, 0x99, 0xcb, 0xcb, 0xac, 0xbb, 0xbb, 0x99, 0xca, 0xab, 0x80,
+  0x89, 0x90, 0xbd, 0x49, 0x24, 0x31, 0x34, 0x44, 0x01, 0x41, 0x57, 0x42, 0x54, 0x24, 0x22, 0x31,
+  0x43, 0x22, 0x53, 0x43, 0x12, 0x22, 0x36, 0x33, 0x32, 0x44, 0x23, 0x31, 0x44, 0x33, 0x23, 0x42,
+  0x53, 0x02, 0x11, 0x00, 0x90, 0x99, 0x20, 0x34, 0x02, 0x11, 0x13, 0xb8, 0xbe, 0xcc, 0xcc, 0xbc,
+  0x4b, 0x0d, 0x1f, 0x00, 0xaa, 0xba, 0xcc, 0xba, 0xcb, 0xac, 0xab, 0xcb, 0xba, 0xcb, 0xab, 0xaa,
+  0xcc, 0xdb, 0xbb, 0xcb, 0xbd, 0xaa, 0xaa, 0xbb, 0x9b, 0x98, 0xda, 0xad, 0x99, 0xcb, 0x9c, 0x89,
+  0xb9, 0xac, 0x9a, 0x99, 0x9c, 0x09, 0xc8, 0xac, 0x09, 0xb8, 0xbc, 0x9a, 0x98, 0xdb, 0x9a, 0x98,
+  0xcd, 0x9b, 0x00, 0x00, 0x21, 0x21, 0x44, 0x02, 0x89, 0x42, 0x03, 0x31, 0x77, 0x43, 0x35, 0x46,
+  0x32, 0x32, 0x33, 0x32, 0x42, 0x44, 0x24, 0x11, 0x53, 0x43, 0x21, 0x42, 0x33, 0x13, 0x43, 0x35,
+  0x22, 0x22, 0x44, 0x22, 0x11, 0x11, 0x01, 0xa9, 0x8a, 0x22, 0x32, 0x44, 0x12, 0x80, 0xc9, 0xce,
+  0xbb, 0xdc, 0xba, 0xbb, 0xac, 0xab, 0xbd, 0xab, 0xdb, 0xbb, 0xba, 0xbc, 0xbb, 0xcb, 0xcb, 0xcb,
+  0xab, 0xcb, 0xcd, 0x9b, 0xaa, 0xcb, 0xab, 0x08, 0xc9, 0xbb, 0x8a, 0xdb, 0xae, 0x8a, 0x90, 0xca,
+  0x8a, 0x90, 0xba, 0x9a, 0x08, 0xb9, 0xab, 0x99, 0xaa, 0xdb, 0xdb, 0xdb, 0x9b, 0x01, 0xca, 0x2a,
+  0x04, 0x9a, 0x21, 0x01, 0x31, 0xa8, 0x75, 0x16, 0x08, 0x31, 0x01, 0x30, 0x43, 0x74, 0x45, 0x43,
+  0x34, 0x32, 0x32, 0x22, 0x42, 0x35, 0x13, 0x53, 0x43, 0x23, 0x34, 0x43, 0x22, 0x32, 0x54, 0x23,
+  0x21, 0x43, 0x23, 0x22, 0x43, 0x22, 0x00, 0x00, 0x81, 0x89, 0x32, 0x22, 0x33, 0x02, 0xec, 0xce,
+  0xca, 0xeb, 0xab, 0x9a, 0xca, 0xaa, 0xb9, 0xdb, 0xbc, 0xab, 0xca, 0xad, 0x8a, 0xba, 0xad, 0x9b,
+  0xbb, 0xbd, 0xab, 0xaa, 0xcd, 0x9a, 0xa9, 0xba, 0xbb, 0x9a, 0xca, 0xcc, 0xba, 0xbb, 0xcc, 0xba,
+  0x9a, 0x98, 0xab, 0x9a, 0xa9, 0xdc, 0xab, 0x21, 0xd8, 0x9c, 0x11, 0xa8, 0xab, 0x10, 0x82, 0xdb,
+  0x58, 0x24, 0xc9, 0x18, 0x24, 0x90, 0x51, 0x34, 0x22, 0x43, 0x33, 0x23, 0x63, 0x33, 0x53, 0x55,
+  0xa1, 0xf8, 0x1f, 0x00, 0x43, 0x44, 0x32, 0x22, 0x31, 0x53, 0x23, 0x32, 0x46, 0x22, 0x32, 0x25,
+  0x13, 0x12, 0x53, 0x33, 0x22, 0x53, 0x23, 0x22, 0x43, 0x32, 0x13, 0x00, 0x33, 0xa0, 0x2a, 0x25,
+  0x80, 0xb9, 0xad, 0xa9, 0xdf, 0xbb, 0xbc, 0xbd, 0xaa, 0xaa, 0xbb, 0xbe, 0xba, 0xdb, 0xbb, 0xca,
+  0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xac, 0x9a, 0xba, 0xac, 0xbb, 0xbc, 0xbc, 0x9b, 0xa8,
+  0xcb, 0xab, 0xaa, 0xcd, 0xab, 0xb9, 0xcb, 0x99, 0x88, 0x99, 0xb9, 0x9c, 0xb8, 0xbe, 0x89, 0xa9,
+  0xab, 0x89, 0x41, 0x03, 0xab, 0x51, 0x43, 0x24, 0x91, 0x30, 0x27, 0x10, 0x72, 0x24, 0x22, 0x53,
+  0x43, 0x33, 0x12, 0x72, 0x33, 0x42, 0x55, 0x33, 0x32, 0x24, 0x23, 0x24, 0x33, 0x35, 0x32, 0x44,
+  0x33, 0x24, 0x34, 0x22, 0x33, 0x53, 0x24, 0x22, 0x42, 0x22, 0x21, 0x33, 0x25, 0x12, 0x20, 0x13,
+  0xb9, 0x18, 0xa1, 0xbe, 0xa9, 0xbb, 0xbd, 0xbe, 0xcc, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xbd, 0xcc,
+  0xaa, 0xbb, 0xbd, 0xaa, 0xcb, 0xbb, 0xbb, 0xcc, 0xba, 0xbc, 0xab, 0xbb, 0xac, 0xca, 0xab, 0xcb,
+  0xba, 0xaa, 0xba, 0xbb, 0xdb, 0xad, 0x9b, 0xa8, 0xcc, 0x8a, 0x00, 0xa9, 0xaa, 0xa9, 0xbc, 0x9d,
+  0x38, 0x13, 0xcb, 0x20, 0x91, 0x19, 0x23, 0x51, 0x26, 0x11, 0x56, 0x03, 0x00, 0x32, 0x23, 0x31,
+  0x46, 0x44, 0x12, 0x31, 0x36, 0x01, 0x41, 0x25, 0x21, 0x44, 0x34, 0x33, 0x43, 0x33, 0x14, 0x22,
+  0x45, 0x12, 0x32, 0x45, 0x12, 0x22, 0x43, 0x22, 0x21, 0x35, 0x24, 0x11, 0x32, 0x23, 0x01, 0x43,
+  0x24, 0x80, 0x30, 0x23, 0xc9, 0x9a, 0xa8, 0xdd, 0xbb, 0x8a, 0xfa, 0xcc, 0x9b, 0xba, 0xbd, 0xab,
+  0xab, 0xcc, 0xcb, 0xa9, 0xda, 0xcb, 0x9a, 0xb9, 0xcb, 0xaa, 0xaa, 0xcd, 0xaa, 0x99, 0xcb, 0xab,
+  0x2b, 0xfa, 0x1e, 0x00, 0xb9, 0xdb, 0xaa, 0xa8, 0xdb, 0xaa, 0x98, 0xb9, 0xab, 0x98, 0xdc, 0x9b,
+  0x88, 0xb9, 0xab, 0x09, 0x90, 0xdc, 0x28, 0x04, 0xbb, 0x52, 0x02, 0x10, 0x02, 0x52, 0x03, 0x58,
+  0x37, 0x01, 0x41, 0x33, 0x42, 0x13, 0x31, 0x26, 0x32, 0x45, 0x22, 0x43, 0x33, 0x34, 0x34, 0x42,
+  0x35, 0x22, 0x44, 0x33, 0x24, 0x33, 0x43, 0x33, 0x43, 0x34, 0x43, 0x42, 0x33, 0x34, 0x32, 0x24,
+  0x23, 0x32, 0x35, 0x23, 0x31, 0x24, 0x22, 0x32, 0x21, 0x22, 0x90, 0x9a, 0xb9, 0xce, 0xbc, 0xcc,
+  0xcb, 0xdb, 0xbb, 0xca, 0xdc, 0xab, 0xba, 0xbc, 0xcb, 0xaa, 0xcb, 0xcb, 0xba, 0xdb, 0xbb, 0xbb,
+  0xbc, 0xac, 0xab, 0xac, 0xbb, 0xac, 0xba, 0xbc, 0xaa, 0xca, 0xbb, 0xaa, 0xcc, 0xaa, 0xa9, 0x9a,
+  0xba, 0xbb, 0xa8, 0xcc, 0x89, 0xb9, 0x8c, 0xa9, 0x9b, 0x01, 0x9a, 0x54, 0xb0, 0x9b, 0x42, 0x53,
+  0x24, 0x54, 0x34, 0x11, 0x53, 0x24, 0x11, 0x32, 0x35, 0x24, 0x22, 0x44, 0x33, 0x43, 0x34, 0x33,
+  0x33, 0x35, 0x44, 0x33, 0x33, 0x34, 0x35, 0x22, 0x44, 0x44, 0x22, 0x31, 0x34, 0x22, 0x21, 0x54,
+  0x22, 0x21, 0x53, 0x23, 0x12, 0x42, 0x32, 0x01, 0x42, 0x33, 0x11, 0x20, 0x13, 0x90, 0x08, 0x90,
+  0xba, 0xcb, 0xde, 0xbc, 0xbd, 0xcb, 0xcc, 0xba, 0xcb, 0xcb, 0xbb, 0xbc, 0xcc, 0xba, 0xba, 0xcb,
+  0xac, 0xba, 0xcb, 0xcb, 0xaa, 0xcb, 0xbc, 0xab, 0xaa, 0xcb, 0xab, 0xaa, 0xcc, 0xaa, 0xa9, 0xba,
+  0xac, 0x9a, 0xba, 0xba, 0xb9, 0xce, 0xaa, 0x8a, 0xaa, 0xab, 0x19, 0xa1, 0xac, 0x28, 0xd9, 0xbb,
+  0x80, 0x88, 0x52, 0x43, 0x36, 0x14, 0x41, 0x35, 0x13, 0x52, 0x43, 0x22, 0x33, 0x34, 0x45, 0x22,
+  0x33, 0x25, 0x33, 0x43, 0x24, 0x34, 0x33, 0x34, 0x34, 0x25, 0x22, 0x43, 0x33, 0x33, 0x45, 0x43,
+  0x14, 0x05, 0x21, 0x00, 0x33, 0x42, 0x43, 0x21, 0x32, 0x34, 0x22, 0x43, 0x53, 0x32, 0x22, 0x22,
+  0x01, 0x22, 0x43, 0x22, 0x33, 0x32, 0x13, 0xba, 0xaa, 0xfc, 0xba, 0xda, 0xbc, 0xbb, 0xce, 0xcb,
+  0xbc, 0xcb, 0xab, 0xbc, 0xab, 0xbc, 0xbc, 0xcb, 0xcb, 0xab, 0xbb, 0xbc, 0xdb, 0xba, 0xbb, 0xbc,
+  0xba, 0xcb, 0xac, 0xbb, 0xac, 0xcb, 0xac, 0xaa, 0xba, 0x9a, 0x9a, 0xbc, 0xab, 0xbb, 0xac, 0xaa,
+  0x9a, 0x11, 0x00, 0x63, 0xb1, 0x8b, 0x11, 0xbb, 0x42, 0x92, 0x51, 0x23, 0x41, 0x23, 0x72, 0x27,
+  0x00, 0x51, 0x12, 0x52, 0x14, 0x21, 0x35, 0x42, 0x44, 0x12, 0x21, 0x24, 0x21, 0x33, 0x22, 0x63,
+  0x34, 0x22, 0x53, 0x22, 0x23, 0x32, 0x44, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x53, 0x22, 0x33,
+  0x33, 0x33, 0x24, 0x21, 0x43, 0x33, 0x44, 0x43, 0x12, 0x00, 0x80, 0x00, 0x10, 0x43, 0x24, 0x12,
+  0xa8, 0xec, 0xcb, 0xab, 0xbb, 0xba, 0xba, 0xec, 0xbc, 0xcc, 0xdb, 0xab, 0xbb, 0xbc, 0xdb, 0xbb,
+  0xcb, 0xcb, 0xba, 0xb9, 0xdb, 0xaa, 0xba, 0xcc, 0xbb, 0xba, 0xcb, 0xcb, 0x9a, 0xa9, 0xac, 0x9a,
+  0xdb, 0xab, 0xaa, 0xbd, 0x8a, 0x91, 0xba, 0x9a, 0xaa, 0xcc, 0xbd, 0x29, 0x03, 0x9b, 0x73, 0x81,
+  0x09, 0x10, 0x55, 0x92, 0x3b, 0x77, 0x83, 0xa8, 0xaa, 0x8a, 0x81, 0x50, 0x27, 0x81, 0x30, 0x03,
+  0xa9, 0x09, 0x30, 0x36, 0x22, 0x44, 0x13, 0x10, 0x21, 0x12, 0x31, 0x43, 0x44, 0x11, 0x21, 0x43,
+  0x12, 0x21, 0x64, 0x33, 0x22, 0x52, 0x33, 0x32, 0x53, 0x34, 0x23, 0x43, 0x33, 0x13, 0x12, 0x00,
+  0x51, 0x34, 0x12, 0x21, 0x42, 0x91, 0xbc, 0x28, 0xa0, 0x9c, 0x63, 0x81, 0xcb, 0x9a, 0xdc, 0xad,
+  0x9a, 0xa9, 0xbb, 0xcc, 0xcb, 0xcc, 0xbb, 0xbb, 0xcb, 0xab, 0xbc, 0xcc, 0xbb, 0xbc, 0xaa, 0xbc,
+  0xab, 0xfe, 0x1e, 0x00, 0x99, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0x98, 0xaa, 0x99, 0xc9, 0xcc,
+  0xac, 0x99, 0xaa, 0x8a, 0x80, 0xa9, 0x00, 0xda, 0xbb, 0xaa, 0x0a, 0x11, 0x32, 0x37, 0x00, 0x28,
+  0x43, 0x44, 0x43, 0x63, 0x23, 0x22, 0x24, 0x02, 0x43, 0x24, 0x32, 0x37, 0x32, 0x22, 0x23, 0x24,
+  0x32, 0x45, 0x33, 0x34, 0x33, 0x44, 0x23, 0x43, 0x43, 0x22, 0x43, 0x22, 0x42, 0x43, 0x21, 0x63,
+  0x33, 0x33, 0x32, 0x33, 0x34, 0x34, 0x34, 0x34, 0x53, 0x43, 0x33, 0x13, 0x21, 0x42, 0x22, 0x42,
+  0x43, 0x33, 0x24, 0x22, 0x34, 0x91, 0x09, 0x12, 0xb8, 0x41, 0x16, 0xb8, 0xbc, 0x99, 0xca, 0xaa,
+  0xb9, 0xcf, 0xbb, 0xbc, 0xab, 0xdb, 0xbd, 0xbb, 0xcb, 0xcb, 0xbc, 0xba, 0xbc, 0xac, 0xba, 0xcb,
+  0xcc, 0x9a, 0xba, 0xbc, 0xba, 0xcb, 0xac, 0xbb, 0xca, 0xca, 0xab, 0xaa, 0xcc, 0x9a, 0xbb, 0xbc,
+  0xaa, 0xaa, 0xb9, 0xcd, 0x99, 0xa9, 0xba, 0x89, 0xaa, 0xab, 0xbd, 0x9a, 0xb0, 0xbb, 0x19, 0x00,
+  0x21, 0xe9, 0xbd, 0x30, 0x64, 0x33, 0x35, 0x33, 0x12, 0x72, 0x34, 0x02, 0x22, 0x34, 0x13, 0x51,
+  0x55, 0x12, 0x00, 0x42, 0x14, 0x12, 0x53, 0x12, 0x21, 0x32, 0x34, 0x43, 0x34, 0x25, 0x12, 0x21,
+  0x33, 0x24, 0x21, 0x53, 0x24, 0x32, 0x53, 0x23, 0x12, 0x23, 0x22, 0x43, 0x33, 0x45, 0x13, 0x28,
+  0x45, 0x02, 0x10, 0x22, 0x80, 0x32, 0x24, 0x33, 0x23, 0x00, 0x90, 0xbe, 0x1b, 0x81, 0xbc, 0x9a,
+  0x09, 0x33, 0xfb, 0x9e, 0xb8, 0xcf, 0x9a, 0x98, 0xa9, 0xac, 0x9a, 0xfb, 0xcb, 0x9a, 0xcb, 0xbb,
+  0xbb, 0xdb, 0xcb, 0xbb, 0xa9, 0xcc, 0xac, 0xa8, 0xdb, 0x9b, 0x99, 0xca, 0xab, 0xaa, 0xcc, 0xbc,
+  0x9b, 0xa9, 0xcc, 0x8a, 0xa9, 0xcc, 0x8a, 0x98, 0xcb, 0xab, 0x08, 0x80, 0xbb, 0x9a, 0xd9, 0xad,
+  0xd1, 0xfa, 0x0f, 0x00, 0x80, 0xa9, 0x99, 0x72, 0x25, 0x90, 0x28, 0x81, 0x9b, 0x42, 0x23, 0x43,
+  0x33, 0x46, 0x12, 0x21, 0x12, 0x52, 0x25, 0x22, 0x54, 0x13, 0x08, 0x32, 0x45, 0x33, 0x31, 0x43,
+  0x81, 0x31, 0x35, 0x22, 0x42, 0x44, 0x23, 0x21, 0x33, 0x13, 0x30, 0x35, 0x34, 0x34, 0x22, 0x44,
+  0x22, 0x43, 0x43, 0x81, 0x00, 0x42, 0x22, 0x21, 0x42, 0x34, 0x02, 0x28, 0x24, 0xa8, 0x19, 0xc0,
+  0x1b, 0x77, 0x02, 0x89, 0x88, 0x98, 0x00, 0xa8, 0xaa, 0xbb, 0x60, 0x26, 0xa0, 0xcb, 0xaa, 0xbb,
+  0x9c, 0x19, 0xda, 0xbb, 0x90, 0xca, 0x19, 0xb0, 0xef, 0x9a, 0x88, 0x80, 0xba, 0xad, 0xaa, 0xaa,
+  0xaa, 0xfb, 0xbc, 0x9a, 0xba, 0xac, 0xdb, 0xbc, 0x9a, 0xdb, 0xbb, 0x9a, 0xa9, 0xee, 0x9b, 0x30,
+  0xa1, 0xbd, 0x8a, 0x80, 0xca, 0x9c, 0x10, 0xd8, 0xbc, 0x28, 0x82, 0xbc, 0x2a, 0x92, 0xbf, 0x1a,
+  0x32, 0xb8, 0xac, 0x19, 0x13, 0x11, 0x31, 0x34, 0xc8, 0x1a, 0x46, 0x12, 0xa9, 0x9a, 0x53, 0x34,
+  0x33, 0x12, 0x08, 0x32, 0x46, 0x33, 0x00, 0x73, 0x25, 0x12, 0xa9, 0x28, 0x45, 0x21, 0x32, 0x02,
+  0x00, 0x31, 0x37, 0x83, 0x0a, 0x54, 0x92, 0x89, 0x42, 0x12, 0x88, 0x10, 0x54, 0x02, 0xa9, 0xa8,
+  0x9a, 0x72, 0x24, 0x90, 0x89, 0x42, 0x13, 0x00, 0x08, 0xca, 0xbb, 0x09, 0x73, 0x03, 0xcc, 0xab,
+  0x10, 0x46, 0x03, 0xea, 0xab, 0x31, 0x46, 0x02, 0x88, 0xa8, 0xaa, 0x21, 0x83, 0x09, 0x32, 0x03,
+  0xcb, 0x2a, 0x46, 0x11, 0xa9, 0xda, 0x8b, 0x21, 0x01, 0x21, 0xf0, 0xbf, 0x29, 0x33, 0x91, 0xaa,
+  0xce, 0xac, 0x00, 0x22, 0x90, 0xcc, 0xba, 0xaa, 0x08, 0xca, 0xbc, 0x89, 0x89, 0x98, 0xab, 0xdb,
+  0xdf, 0x0a, 0x53, 0x81, 0xa9, 0xcb, 0x9c, 0x21, 0x12, 0x01, 0xeb, 0x9a, 0x88, 0x89, 0x52, 0x03,
+  0x72, 0xff, 0x0c, 0x00, 0xbd, 0xaa, 0x00, 0x52, 0x13, 0xb9, 0xab, 0xbc, 0x60, 0x35, 0x90, 0xcb,
+  0x9b, 0x31, 0x13, 0x20, 0x02, 0xeb, 0x8b, 0x53, 0x83, 0xba, 0x20, 0xa0, 0x3a, 0x16, 0x89, 0x32,
+  0x90, 0x76, 0x03, 0xcc, 0x18, 0x33, 0x91, 0x19, 0x13, 0xbb, 0x72, 0x15, 0x90, 0xcb, 0x29, 0x36,
+  0x91, 0x9a, 0x18, 0x34, 0xa2, 0xad, 0x41, 0x14, 0x88, 0x08, 0x11, 0x54, 0xb1, 0xaf, 0x30, 0x24,
+  0x01, 0xda, 0x9b, 0x43, 0x81, 0x09, 0xb8, 0x9c, 0x54, 0xa1, 0x9b, 0x41, 0x13, 0x80, 0xd8, 0xcf,
+  0x29, 0x25, 0x90, 0x89, 0xa9, 0x9b, 0x43, 0x01, 0x20, 0xc8, 0xbd, 0x20, 0x33, 0x83, 0xbe, 0x58,
+  0x82, 0xab, 0x11, 0xdc, 0x28, 0x13, 0x10, 0xa1, 0x1b, 0x24, 0xdc, 0x8a, 0x99, 0x20, 0xa2, 0x0a,
+  0x24, 0xd9, 0xbc, 0x0a, 0x35, 0xb1, 0x9e, 0x31, 0xa2, 0x0a, 0xd1, 0xef, 0x28, 0x02, 0x18, 0x91,
+  0xdc, 0x9a, 0x28, 0x35, 0xb0, 0x2b, 0x13, 0xbe, 0x39, 0x37, 0x91, 0xca, 0x8a, 0x88, 0x31, 0x35,
+  0x92, 0xbd, 0x19, 0x01, 0x1a, 0x77, 0x26, 0x31, 0x45, 0xc1, 0xdf, 0x9a, 0x41, 0x43, 0x90, 0xcb,
+  0x9a, 0x10, 0x32, 0x12, 0x98, 0xac, 0x89, 0x10, 0x44, 0x81, 0x9b, 0x20, 0x81, 0xaa, 0x98, 0x08,
+  0xa8, 0x9c, 0x30, 0x14, 0x21, 0x44, 0x92, 0xcd, 0x9c, 0x31, 0x35, 0xb1, 0x9e, 0x31, 0x01, 0x51,
+  0xb3, 0xdf, 0x18, 0x23, 0x11, 0x80, 0xdd, 0x0a, 0x33, 0x03, 0x80, 0xec, 0x0b, 0x34, 0x90, 0x20,
+  0x92, 0xad, 0x10, 0x10, 0x10, 0xf9, 0x8b, 0x64, 0x03, 0xca, 0xac, 0x20, 0x35, 0x92, 0xbe, 0x19,
+  0x33, 0xa9, 0x28, 0x83, 0xcd, 0x19, 0x33, 0x02, 0xb9, 0xdb, 0x8a, 0x53, 0x81, 0x29, 0x93, 0xff,
+  0x38, 0x03, 0xba, 0x39, 0x83, 0xcd, 0x2a, 0x46, 0xa1, 0xad, 0x38, 0x13, 0x90, 0xba, 0x0b, 0x54,
+  0xa8, 0x0b, 0x3d, 0x00, 0xa0, 0xbd, 0x38, 0x24, 0xa8, 0x8a, 0x00, 0x89, 0x51, 0x03, 0xce, 0x29,
+  0x16, 0xc8, 0x0a, 0x43, 0xa1, 0xac, 0x28, 0x00, 0x20, 0x25, 0xf9, 0x9c, 0x42, 0x03, 0xdb, 0x0a,
+  0x43, 0x92, 0xac, 0x19, 0x12, 0x22, 0xc0, 0x9e, 0x21, 0x01, 0x18, 0xb0, 0x9d, 0x31, 0x23, 0x91,
+  0xce, 0x2a, 0x25, 0xb0, 0xac, 0x42, 0x04, 0xca, 0x8b, 0x62, 0x02, 0xca, 0x9a, 0x43, 0x12, 0xea,
+  0x0a, 0x43, 0x91, 0xad, 0x28, 0x14, 0x90, 0x9a, 0x9a, 0x40, 0x34, 0xb8, 0xbd, 0x20, 0x24, 0xc8,
+  0x89, 0x23, 0xb8, 0x8a, 0x10, 0x10, 0x33, 0xd1, 0xad, 0x30, 0x91, 0x2a, 0x25, 0xb9, 0x9a, 0xa9,
+  0x60, 0x24, 0x90, 0xeb, 0x9c, 0x62, 0x13, 0xba, 0x9c, 0x21, 0x12, 0x81, 0xd9, 0x8c, 0x72, 0x82,
+  0xcb, 0x19, 0x23, 0x91, 0xbb, 0x2b, 0x46, 0xb0, 0x9c, 0x41, 0x81, 0xaa, 0x29, 0x23, 0xb8, 0x0a,
+  0x02, 0xbc, 0x49, 0x26, 0x92, 0xdd, 0x8a, 0x45, 0x82, 0xbc, 0x0a, 0x43, 0x82, 0xa9, 0x9a, 0x10,
+  0x23, 0x90, 0xba, 0x89, 0x43, 0x03, 0xcb, 0x99, 0xcc, 0x70, 0x17, 0xc9, 0x9a, 0x32, 0x02, 0xaa,
+  0x10, 0x80, 0xbb, 0x28, 0x34, 0x14, 0xe9, 0x8a, 0x00, 0x80, 0x38, 0x44, 0xc0, 0x9e, 0x20, 0x02,
+  0x99, 0x18, 0x24, 0xe8, 0xab, 0x32, 0x81, 0x29, 0x47, 0xb8, 0xaf, 0x18, 0x33, 0x11, 0x80, 0xec,
+  0x9a, 0x41, 0x14, 0x90, 0xaa, 0xaa, 0x29, 0x44, 0x02, 0xb9, 0xab, 0x11, 0xb0, 0x2a, 0x47, 0x81,
+  0xa9, 0xbb, 0xbb, 0x60, 0x36, 0x93, 0xeb, 0x9a, 0x20, 0x11, 0x31, 0x23, 0xfd, 0x8b, 0x31, 0x23,
+  0x01, 0xcb, 0xac, 0x18, 0x43, 0x23, 0xd0, 0xbc, 0x38, 0x13, 0x98, 0x20, 0xa0, 0xbc, 0x38, 0x34,
+  0xc0, 0x9c, 0x30, 0x12, 0x99, 0x89, 0x20, 0xa2, 0xdf, 0x38, 0x15, 0xa0, 0x9a, 0x98, 0x30, 0x23,
+  0xd8, 0x01, 0x2d, 0x00, 0x9a, 0x90, 0xcd, 0x29, 0x47, 0x92, 0xbb, 0x8a, 0x98, 0x48, 0x37, 0xa0,
+  0xaa, 0x99, 0x19, 0x36, 0xd8, 0x8a, 0x42, 0x12, 0xb8, 0xbf, 0x38, 0x25, 0x98, 0x88, 0xc9, 0x8c,
+  0x73, 0x03, 0xcb, 0x8b, 0x20, 0x12, 0x12, 0x13, 0xe9, 0xbd, 0x09, 0x53, 0x33, 0xb0, 0xbf, 0x09,
+  0x33, 0x14, 0xa0, 0xbb, 0xac, 0x20, 0x36, 0x03, 0xea, 0xbb, 0x30, 0x24, 0x11, 0x98, 0xcc, 0x0a,
+  0x53, 0x81, 0xa9, 0x09, 0x80, 0x88, 0x53, 0x92, 0xbd, 0x29, 0x25, 0x98, 0xaa, 0x0b, 0x42, 0x02,
+  0x09, 0x90, 0xeb, 0x8b, 0x73, 0x16, 0xb8, 0xad, 0x19, 0x34, 0x82, 0xba, 0x89, 0x98, 0x20, 0x34,
+  0x91, 0xba, 0xcb, 0x09, 0x34, 0x13, 0x80, 0xdc, 0xad, 0x48, 0x36, 0x81, 0xcc, 0x8b, 0x31, 0x14,
+  0x90, 0xaa, 0x99, 0x20, 0x32, 0x22, 0xa1, 0xef, 0x8b, 0x62, 0x22, 0x98, 0xba, 0xaa, 0x09, 0x35,
+  0x14, 0x90, 0xbb, 0xbb, 0x09, 0x54, 0x24, 0xb8, 0xab, 0x88, 0x98, 0x62, 0x14, 0x90, 0xca, 0xbd,
+  0x1a, 0x47, 0x03, 0xd9, 0x9b, 0x20, 0x12, 0x88, 0x18, 0x21, 0xb0, 0xce, 0x89, 0x43, 0x33, 0x91,
+  0xcc, 0xab, 0x09, 0x45, 0x23, 0x98, 0xcc, 0x9c, 0x38, 0x35, 0x03, 0xd8, 0xcb, 0x0a, 0x32, 0x24,
+  0x91, 0xba, 0x8b, 0x08, 0x20, 0x34, 0x14, 0xe9, 0xbc, 0x19, 0x63, 0x12, 0x98, 0xaa, 0xba, 0x8b,
+  0x65, 0x13, 0xa8, 0xbb, 0x9b, 0x41, 0x34, 0xb0, 0x9c, 0x21, 0x01, 0xa9, 0x89, 0x10, 0x23, 0x91,
+  0xec, 0xaa, 0x31, 0x36, 0x23, 0xfa, 0xad, 0x18, 0x43, 0x02, 0x98, 0xbb, 0xaa, 0x30, 0x44, 0x02,
+  0xc9, 0xac, 0x18, 0x63, 0x03, 0xd9, 0xac, 0x38, 0x24, 0xa1, 0xab, 0x18, 0x23, 0x80, 0xb9, 0xbe,
+  0x39, 0x37, 0x90, 0xaa, 0x09, 0x20, 0x81, 0xcb, 0x0a, 0x54, 0x13, 0xa0, 0xbc, 0x8a, 0x61, 0x14,
+  0x55, 0x02, 0x2f, 0x00, 0xbd, 0x29, 0x24, 0x12, 0x91, 0xcd, 0x9a, 0x21, 0x53, 0x13, 0xb0, 0xce,
+  0x0a, 0x33, 0x82, 0x89, 0x88, 0x9a, 0x20, 0x22, 0x22, 0xb0, 0xde, 0xbc, 0x2a, 0x56, 0x13, 0xca,
+  0xab, 0x18, 0x01, 0x10, 0x52, 0x13, 0xfb, 0xac, 0x38, 0x24, 0x91, 0x9a, 0x98, 0x89, 0x53, 0x13,
+  0xb8, 0xcc, 0x9b, 0x31, 0x53, 0x23, 0xa8, 0x8a, 0x88, 0xdc, 0x8b, 0x73, 0x14, 0xb8, 0xbb, 0x8a,
+  0x64, 0x03, 0xc9, 0x8a, 0x00, 0x80, 0x31, 0x12, 0xda, 0xac, 0x08, 0x21, 0x54, 0x83, 0xdb, 0x0a,
+  0x81, 0xaa, 0x41, 0x04, 0xc9, 0x19, 0x14, 0xb9, 0x0b, 0x35, 0x82, 0xdd, 0x8a, 0x42, 0x14, 0x90,
+  0xdb, 0x8a, 0x31, 0x24, 0x81, 0xca, 0x9a, 0x10, 0x81, 0x28, 0x34, 0xc8, 0xad, 0x28, 0x35, 0x81,
+  0xba, 0xcb, 0x09, 0x43, 0x22, 0x03, 0xfa, 0x9b, 0x19, 0x62, 0x04, 0xca, 0x0a, 0x32, 0x80, 0x9a,
+  0x99, 0x09, 0x52, 0x24, 0xa0, 0xbc, 0x1a, 0x34, 0xc0, 0xbe, 0x28, 0x35, 0x92, 0xaa, 0x10, 0xa8,
+  0x9b, 0x09, 0x55, 0x92, 0xbc, 0x10, 0x80, 0x42, 0xa3, 0xce, 0x89, 0x43, 0x23, 0xb9, 0xab, 0xbb,
+  0x59, 0x27, 0xa8, 0x0a, 0x23, 0xb8, 0x9c, 0x38, 0x44, 0x82, 0xcd, 0x8a, 0x41, 0x03, 0x98, 0x18,
+  0xa8, 0xbd, 0x0a, 0x54, 0x14, 0xa9, 0xad, 0x0a, 0x42, 0x22, 0xa8, 0xbb, 0x58, 0x25, 0xea, 0x9c,
+  0x20, 0x24, 0x81, 0xda, 0x9c, 0x41, 0x23, 0xa0, 0xba, 0xaa, 0x99, 0x71, 0x24, 0xb9, 0x8c, 0x01,
+  0x80, 0x10, 0x21, 0x12, 0xa0, 0xde, 0x9c, 0x52, 0x33, 0x98, 0xba, 0x9a, 0x00, 0x31, 0x25, 0xb0,
+  0xbb, 0x8a, 0x30, 0x33, 0x47, 0x82, 0xbc, 0x99, 0xaa, 0x72, 0x27, 0xa0, 0xcb, 0x9b, 0x32, 0x36,
+  0x01, 0xca, 0x9a, 0x80, 0x41, 0x24, 0xc9, 0xbc, 0x18, 0x33, 0x01, 0x10, 0x92, 0xdf, 0x19, 0x53,
+  0xf1, 0x04, 0x31, 0x00, 0xa8, 0xaa, 0x09, 0x20, 0x22, 0x13, 0xc9, 0x9c, 0x21, 0x23, 0x99, 0x89,
+  0xc9, 0x0b, 0x46, 0xb0, 0x9c, 0x21, 0x33, 0x83, 0xde, 0x8b, 0x53, 0x02, 0xc9, 0x9c, 0x30, 0x02,
+  0x9a, 0x20, 0x81, 0x89, 0xfb, 0x9b, 0x32, 0x02, 0xda, 0xbd, 0x1a, 0x12, 0x62, 0x83, 0xce, 0x8a,
+  0x20, 0x22, 0xb1, 0xae, 0x19, 0x00, 0x20, 0x03, 0xca, 0xbb, 0x28, 0x23, 0xfb, 0xab, 0x08, 0x01,
+  0x20, 0x57, 0x82, 0xb9, 0xaa, 0x8a, 0x52, 0x23, 0x01, 0xd9, 0xab, 0x30, 0x25, 0xa1, 0x1b, 0x34,
+  0xb8, 0x70, 0x36, 0x92, 0xec, 0x9a, 0x21, 0x23, 0x33, 0x02, 0xba, 0x1a, 0x34, 0xa8, 0x8b, 0x11,
+  0x52, 0x45, 0x82, 0xa9, 0x49, 0x26, 0xd9, 0x9b, 0x54, 0x24, 0x01, 0x00, 0x11, 0x10, 0x11, 0xa8,
+  0x8b, 0x73, 0x34, 0x12, 0xb9, 0x9a, 0x88, 0x62, 0x04, 0xdb, 0x09, 0x22, 0x10, 0xd0, 0xbf, 0x8a,
+  0x10, 0x23, 0xd8, 0x9c, 0x80, 0xcb, 0x8b, 0x98, 0xdc, 0xab, 0x10, 0x24, 0x90, 0xfb, 0xbc, 0x89,
+  0x00, 0x31, 0x83, 0xcd, 0x8b, 0x20, 0x13, 0xa8, 0x29, 0x82, 0x0b, 0x47, 0x90, 0x89, 0x81, 0x89,
+  0x00, 0x28, 0x77, 0x11, 0x18, 0xa1, 0xbd, 0x38, 0x13, 0x11, 0xa1, 0x8c, 0x42, 0xb0, 0xac, 0x99,
+  0x28, 0xa3, 0xff, 0x18, 0x01, 0x89, 0x88, 0xd9, 0xbc, 0x29, 0x33, 0x01, 0xba, 0xcc, 0x18, 0x01,
+  0x9a, 0x89, 0x72, 0x37, 0xa0, 0x9a, 0x10, 0x20, 0x43, 0x22, 0x11, 0x00, 0x74, 0x02, 0x09, 0x34,
+  0xb8, 0x29, 0x46, 0x44, 0x90, 0x8a, 0x11, 0x18, 0x75, 0x01, 0x9a, 0x10, 0x11, 0x31, 0x73, 0x35,
+  0x81, 0x9a, 0x88, 0x09, 0x30, 0x02, 0x80, 0xcb, 0x50, 0x26, 0x80, 0x9a, 0xba, 0xbc, 0x19, 0x34,
+  0x92, 0xdc, 0xbb, 0xbb, 0x9b, 0x21, 0xe9, 0xac, 0x89, 0xa8, 0xcd, 0xbc, 0xaa, 0xbb, 0x9b, 0x00,
+  0xca, 0xfb, 0x22, 0x00, 0x02, 0xcd, 0xab, 0xec, 0x9a, 0x00, 0x11, 0x01, 0x98, 0x53, 0xa2, 0xab,
+  0x10, 0x20, 0x36, 0x23, 0x53, 0x23, 0x88, 0xa9, 0x9b, 0x64, 0x32, 0x73, 0x23, 0x80, 0x80, 0xa8,
+  0xbb, 0xaa, 0x18, 0x43, 0x44, 0x22, 0xe9, 0xcd, 0x9b, 0x88, 0x09, 0x98, 0xbb, 0xb9, 0xdf, 0x0a,
+  0x90, 0xac, 0x20, 0x90, 0xbb, 0xca, 0xab, 0xa9, 0x0b, 0x37, 0xb1, 0x49, 0x27, 0x98, 0x19, 0x22,
+  0x01, 0x18, 0x75, 0x12, 0x28, 0x23, 0x9a, 0x73, 0x01, 0x41, 0x13, 0x0a, 0x24, 0xaa, 0x65, 0x82,
+  0x29, 0x14, 0x88, 0x32, 0x80, 0x42, 0xf8, 0x1b, 0x23, 0x28, 0x57, 0x13, 0x11, 0xa9, 0x28, 0x82,
+  0x9c, 0x32, 0xc8, 0x8c, 0x41, 0x24, 0xa1, 0x8b, 0x92, 0xbf, 0x28, 0x13, 0x99, 0xda, 0xab, 0xd8,
+  0xad, 0x20, 0xb2, 0x9d, 0x00, 0xca, 0x8a, 0xca, 0xac, 0xca, 0xbb, 0x20, 0xa0, 0x0b, 0x91, 0xde,
+  0x89, 0xa8, 0x8b, 0x10, 0x98, 0x21, 0x13, 0x11, 0xa1, 0x69, 0x37, 0x82, 0x28, 0x35, 0xa0, 0x39,
+  0x25, 0xa8, 0x28, 0x55, 0x24, 0x81, 0x51, 0x83, 0xac, 0x28, 0x90, 0x8b, 0x01, 0x20, 0x84, 0xbc,
+  0x38, 0xfa, 0x9d, 0x88, 0xa9, 0xaa, 0xab, 0x88, 0xfb, 0xab, 0xaa, 0xda, 0xbc, 0x29, 0x14, 0xaa,
+  0x18, 0xc0, 0xac, 0x08, 0x11, 0x82, 0x09, 0x57, 0x02, 0x80, 0x32, 0x33, 0x91, 0x60, 0x15, 0x80,
+  0x62, 0x24, 0x11, 0x22, 0x11, 0x11, 0x80, 0x73, 0x13, 0x11, 0x53, 0x11, 0x20, 0x82, 0x9b, 0x32,
+  0x23, 0x77, 0x15, 0x98, 0xa8, 0x9b, 0x40, 0x44, 0x54, 0x12, 0x80, 0x08, 0x98, 0x8a, 0x01, 0x91,
+  0xcb, 0x39, 0x47, 0x81, 0x00, 0xa8, 0xbe, 0x8a, 0x22, 0x90, 0x9a, 0x90, 0xed, 0xab, 0x88, 0xca,
+  0xac, 0x00, 0x91, 0xab, 0xba, 0xdf, 0xcb, 0xaa, 0x99, 0x99, 0x89, 0x12, 0xa0, 0xbc, 0x99, 0xdd,
+  0x5f, 0xf3, 0x28, 0x00, 0x09, 0x21, 0x21, 0x43, 0x02, 0xb9, 0x99, 0x41, 0x25, 0x23, 0x35, 0x03,
+  0x10, 0x33, 0x02, 0x30, 0x34, 0x11, 0x77, 0x34, 0x11, 0x00, 0xb9, 0xbd, 0x09, 0x12, 0x81, 0x31,
+  0xc1, 0xbf, 0x19, 0xb9, 0xbd, 0x9a, 0x99, 0xb9, 0xaa, 0xc8, 0xbe, 0x8b, 0x00, 0xda, 0xad, 0x20,
+  0x91, 0x19, 0x14, 0xdc, 0x9a, 0x88, 0x41, 0x13, 0x31, 0x37, 0xa8, 0x19, 0x12, 0x88, 0x52, 0x24,
+  0x33, 0x45, 0x22, 0x21, 0x02, 0x21, 0x12, 0x41, 0x36, 0x11, 0x34, 0xa1, 0x0b, 0x13, 0x19, 0x77,
+  0x12, 0x22, 0xb8, 0x0b, 0x22, 0xa9, 0x72, 0x04, 0xba, 0x19, 0x53, 0x63, 0x34, 0x24, 0x02, 0xb9,
+  0x8a, 0x91, 0x89, 0x24, 0xd9, 0x0a, 0x23, 0x40, 0x16, 0xc9, 0x8b, 0x98, 0x0b, 0x33, 0xc8, 0xdb,
+  0xcc, 0xbb, 0x9a, 0xa9, 0x99, 0x88, 0xd9, 0xbd, 0xeb, 0xcb, 0xab, 0xbb, 0x08, 0xc8, 0x0b, 0x24,
+  0xea, 0x8a, 0xa8, 0xbb, 0xab, 0x40, 0x14, 0x08, 0x43, 0xb0, 0x8c, 0x11, 0x41, 0x35, 0x12, 0x12,
+  0x91, 0xba, 0x08, 0x45, 0x03, 0x41, 0x46, 0x11, 0x42, 0x13, 0xda, 0xab, 0x00, 0x01, 0x20, 0x12,
+  0xa9, 0xcb, 0x9b, 0x00, 0xed, 0x19, 0xc1, 0x9e, 0x00, 0xca, 0x38, 0xd0, 0x9c, 0x02, 0xba, 0x51,
+  0xa1, 0x0a, 0xa1, 0xaf, 0x10, 0x98, 0x38, 0x83, 0x1a, 0x35, 0x90, 0x73, 0x93, 0xab, 0x32, 0x91,
+  0x61, 0x14, 0x18, 0x63, 0x02, 0x21, 0x13, 0x99, 0x72, 0x02, 0x19, 0x35, 0xb0, 0x0c, 0x43, 0x01,
+  0x41, 0x34, 0x80, 0x30, 0xa2, 0x9d, 0x01, 0xdb, 0x61, 0x92, 0x2b, 0x26, 0xaa, 0x51, 0xa2, 0x9b,
+  0x01, 0x19, 0x47, 0x02, 0x21, 0x92, 0xbd, 0x29, 0x22, 0x00, 0x30, 0x93, 0xbd, 0x19, 0xb0, 0xae,
+  0x30, 0x83, 0xbd, 0xbb, 0x9a, 0x65, 0x92, 0xbc, 0xbc, 0xcc, 0x09, 0x23, 0x91, 0x88, 0xeb, 0xbc,
+  0x6c, 0xff, 0x27, 0x00, 0x99, 0x88, 0x88, 0xa8, 0xba, 0xac, 0x18, 0xc1, 0xaf, 0x88, 0xa9, 0x29,
+  0x23, 0x91, 0xcd, 0x1a, 0x04, 0xbb, 0x74, 0xa1, 0x0b, 0x45, 0x90, 0x88, 0x88, 0xa9, 0xba, 0x49,
+  0x25, 0x80, 0x62, 0x02, 0xba, 0x09, 0x81, 0x8b, 0x11, 0xb9, 0x50, 0x92, 0x60, 0x92, 0xae, 0x89,
+  0x9b, 0x42, 0xc9, 0x39, 0xd1, 0x0c, 0x13, 0xab, 0x74, 0x92, 0x0a, 0xa1, 0x8c, 0x23, 0xb9, 0x72,
+  0x93, 0x0a, 0x14, 0x08, 0x22, 0x80, 0x31, 0xd8, 0x59, 0x05, 0x99, 0x10, 0x80, 0x32, 0x52, 0x45,
+  0xa0, 0x39, 0x07, 0xba, 0x28, 0x02, 0x89, 0x63, 0x02, 0xba, 0x40, 0x24, 0x89, 0x00, 0xec, 0x0b,
+  0x13, 0x00, 0x24, 0xda, 0x38, 0x85, 0xab, 0x63, 0x80, 0x28, 0xa3, 0xad, 0x28, 0x80, 0x18, 0x08,
+  0x61, 0x02, 0x10, 0x92, 0xcd, 0x19, 0x00, 0xaa, 0x0a, 0x44, 0x82, 0x51, 0x93, 0xcf, 0x19, 0x80,
+  0x10, 0x31, 0x33, 0xf8, 0xac, 0x88, 0x89, 0x31, 0xd1, 0xab, 0x90, 0xab, 0x71, 0x82, 0xbc, 0x89,
+  0xc9, 0x8c, 0x11, 0x99, 0x88, 0xec, 0x1a, 0x82, 0xac, 0x41, 0xa1, 0x9b, 0xaa, 0xcb, 0x9b, 0x73,
+  0x94, 0xad, 0x20, 0x92, 0x8b, 0x12, 0x98, 0x09, 0xa9, 0xae, 0x0a, 0x33, 0x02, 0x42, 0xa2, 0xcf,
+  0x38, 0x13, 0xbb, 0x73, 0xa1, 0xac, 0x08, 0x11, 0x02, 0x9b, 0x46, 0xf9, 0x0b, 0x34, 0x81, 0x08,
+  0x81, 0xda, 0xac, 0x51, 0x92, 0x9b, 0x63, 0x02, 0x99, 0x89, 0x34, 0xa1, 0x2a, 0x82, 0xad, 0x21,
+  0x88, 0x54, 0xa1, 0x39, 0x06, 0x99, 0x42, 0x01, 0x22, 0xf9, 0x0a, 0x82, 0xad, 0x72, 0x12, 0x08,
+  0x98, 0xae, 0x30, 0x03, 0x00, 0x83, 0xdd, 0x38, 0x03, 0x8a, 0x12, 0xc9, 0x38, 0x14, 0x00, 0x82,
+  0xec, 0x28, 0x14, 0x8a, 0x33, 0xfa, 0x39, 0x93, 0x9f, 0x32, 0xc8, 0x49, 0x03, 0xaa, 0x18, 0x08,
+  0xdc, 0x03, 0x23, 0x00, 0x01, 0x30, 0xa3, 0xdf, 0x18, 0x13, 0x81, 0x89, 0x11, 0xfb, 0x8e, 0x23,
+  0xb0, 0x58, 0x83, 0xbd, 0x18, 0xa0, 0x29, 0x02, 0x0a, 0x15, 0xdb, 0x40, 0xb2, 0x8d, 0x11, 0xab,
+  0x41, 0xb1, 0x1a, 0x04, 0xdb, 0x19, 0x01, 0x09, 0x52, 0x03, 0xcf, 0x19, 0x81, 0x9b, 0x43, 0xc8,
+  0x1a, 0x03, 0x9a, 0x33, 0xa9, 0xa9, 0xac, 0x32, 0xfc, 0x48, 0xa2, 0x9f, 0x20, 0x80, 0x99, 0x89,
+  0x31, 0x82, 0x9a, 0x9a, 0x08, 0xfd, 0x0a, 0x25, 0x80, 0x18, 0x20, 0xb1, 0xbf, 0x52, 0xc0, 0x8c,
+  0x13, 0x98, 0x41, 0x92, 0x08, 0xea, 0x29, 0x15, 0xba, 0x40, 0x23, 0xb9, 0x0b, 0x45, 0xe0, 0x8b,
+  0x43, 0xa8, 0x50, 0x83, 0xbd, 0x19, 0x23, 0x90, 0x29, 0x02, 0xec, 0x38, 0x84, 0xac, 0x31, 0xc0,
+  0x0c, 0x53, 0x22, 0xa8, 0xac, 0x08, 0x10, 0x02, 0xa9, 0x50, 0xa2, 0xac, 0x20, 0x52, 0x13, 0x89,
+  0x88, 0xdd, 0x28, 0x13, 0x20, 0x02, 0xec, 0x8a, 0x42, 0x02, 0x11, 0xb1, 0x8e, 0x53, 0xf9, 0x0a,
+  0x43, 0xa0, 0x0a, 0x03, 0xda, 0x29, 0x25, 0x98, 0x09, 0x99, 0x88, 0xa9, 0x59, 0x15, 0xa8, 0x28,
+  0xd8, 0x0b, 0x44, 0x91, 0x99, 0xca, 0x0a, 0x54, 0x82, 0x8b, 0x31, 0xf9, 0x2b, 0x14, 0xaa, 0x20,
+  0xd8, 0x40, 0x84, 0xbc, 0x10, 0x81, 0x18, 0x91, 0xcb, 0x28, 0x84, 0x99, 0x31, 0xa1, 0xcb, 0xdc,
+  0x28, 0x25, 0xa8, 0x09, 0x11, 0xa0, 0x1a, 0x13, 0xbd, 0x09, 0xfb, 0x58, 0x16, 0xb9, 0xaa, 0x89,
+  0x54, 0xa1, 0x0a, 0x83, 0xce, 0x31, 0xa3, 0x2a, 0x04, 0xcc, 0x09, 0x22, 0x25, 0xc9, 0x8a, 0x80,
+  0x9b, 0x63, 0x12, 0x99, 0x20, 0xb0, 0x9e, 0x24, 0xc8, 0x9b, 0x80, 0x73, 0x92, 0x9d, 0x42, 0xb0,
+  0x8b, 0x21, 0x02, 0xc9, 0x28, 0xb3, 0x9f, 0x52, 0xa1, 0xab, 0x51, 0x03, 0xcc, 0x2a, 0x15, 0x9a,
+  0x88, 0xfe, 0x2e, 0x00, 0x13, 0xcc, 0x29, 0x93, 0x0b, 0x37, 0xc8, 0x8a, 0x12, 0x80, 0x98, 0x89,
+  0x21, 0xb9, 0x40, 0x24, 0x99, 0xa8, 0xbd, 0x58, 0x26, 0xb9, 0x0b, 0x82, 0x9b, 0x64, 0x90, 0x28,
+  0x84, 0xcd, 0x09, 0x53, 0x81, 0x99, 0x08, 0x99, 0x00, 0xb9, 0x3a, 0x46, 0x91, 0xcc, 0x28, 0x03,
+  0x9a, 0x32, 0xfa, 0x4a, 0x03, 0xac, 0x51, 0x82, 0x99, 0xab, 0x39, 0x33, 0x08, 0xa8, 0x1b, 0x97,
+  0xbf, 0x60, 0x82, 0x0a, 0x82, 0xbc, 0x42, 0xa1, 0x18, 0xa2, 0x8b, 0x04, 0xaa, 0x44, 0xb0, 0x89,
+  0xc9, 0x39, 0x03, 0x1a, 0x17, 0xca, 0x38, 0x91, 0xab, 0x32, 0xc9, 0x9c, 0x31, 0x46, 0x03, 0xec,
+  0x09, 0x13, 0x99, 0x19, 0x43, 0xc0, 0xac, 0x00, 0x88, 0x10, 0x00, 0x56, 0xb0, 0x1a, 0x05, 0xac,
+  0x20, 0xb9, 0x58, 0xb1, 0x3b, 0x17, 0xcb, 0x41, 0x92, 0xab, 0x18, 0x11, 0xb0, 0x8c, 0x44, 0xb0,
+  0x9b, 0x31, 0xb1, 0x3b, 0x47, 0xc9, 0x3a, 0xa3, 0x8d, 0x34, 0xd9, 0x38, 0x93, 0xad, 0x11, 0x81,
+  0x80, 0x99, 0x53, 0x91, 0xaa, 0x88, 0x22, 0xff, 0x1b, 0x25, 0x99, 0x31, 0xa1, 0x8c, 0x03, 0xcb,
+  0x30, 0xa3, 0x9b, 0x23, 0xb8, 0x0c, 0x43, 0xa2, 0xcf, 0x20, 0x04, 0x8a, 0x31, 0xa0, 0xba, 0xbd,
+  0x71, 0x82, 0x9c, 0x31, 0x02, 0xc8, 0x9f, 0x31, 0x82, 0x0a, 0x03, 0x99, 0x32, 0xe0, 0x8a, 0x22,
+  0xd9, 0x1a, 0x15, 0xba, 0x71, 0x93, 0xbd, 0x20, 0x82, 0xa9, 0x40, 0x15, 0xeb, 0x09, 0x12, 0x98,
+  0x21, 0xc9, 0x1b, 0x15, 0x80, 0x20, 0xa9, 0x8a, 0xda, 0x0b, 0x44, 0x00, 0x00, 0xa9, 0x28, 0xa0,
+  0x09, 0xd9, 0x78, 0x06, 0xda, 0x19, 0x22, 0x88, 0x88, 0x89, 0xa9, 0x62, 0x92, 0x0c, 0x16, 0xda,
+  0x2a, 0x33, 0x00, 0x90, 0x9a, 0xda, 0x9e, 0x63, 0x92, 0x8a, 0x12, 0x98, 0x81, 0xcc, 0x61, 0xb1,
+  0x04, 0xfe, 0x2e, 0x00, 0x50, 0xa1, 0x1a, 0x82, 0x8c, 0x15, 0xdb, 0x48, 0x03, 0x9a, 0x00, 0x9a,
+  0x10, 0x80, 0x09, 0x20, 0xa3, 0x8e, 0x64, 0xb0, 0x1b, 0x92, 0xae, 0x51, 0x92, 0xaa, 0x20, 0x22,
+  0xa8, 0x9a, 0x80, 0x08, 0x01, 0xcb, 0x70, 0x27, 0xda, 0x0a, 0x14, 0xbb, 0x2a, 0x25, 0x02, 0xdb,
+  0x19, 0x14, 0x99, 0x99, 0x19, 0x35, 0xe9, 0x1a, 0x03, 0x9b, 0x51, 0xb8, 0x1c, 0x26, 0xb8, 0x2a,
+  0x04, 0xac, 0x31, 0xea, 0x3a, 0x06, 0xba, 0x40, 0x92, 0x8c, 0x11, 0x89, 0x21, 0xc0, 0x2a, 0x15,
+  0xca, 0x38, 0x92, 0x9b, 0x32, 0xc9, 0x09, 0x12, 0x00, 0x80, 0xbd, 0x50, 0x92, 0x9d, 0x23, 0xec,
+  0x48, 0x83, 0xac, 0x22, 0x90, 0x20, 0xb1, 0x0d, 0x42, 0x02, 0xdd, 0x29, 0x84, 0xac, 0x63, 0xa0,
+  0x0a, 0x12, 0x9a, 0x88, 0x20, 0x25, 0xdc, 0x29, 0x03, 0xa9, 0x19, 0x22, 0xe8, 0x3a, 0x07, 0xa9,
+  0x31, 0xc8, 0x1b, 0x81, 0x39, 0x84, 0x9f, 0x31, 0xb0, 0x28, 0x91, 0x2a, 0x15, 0xcb, 0x29, 0x03,
+  0xbb, 0x28, 0xb1, 0x49, 0x94, 0x2c, 0x47, 0xeb, 0x28, 0x83, 0x9e, 0x41, 0xa1, 0x09, 0x91, 0x8a,
+  0x33, 0xe9, 0x29, 0x15, 0xba, 0x88, 0x08, 0x33, 0xc9, 0x38, 0xf1, 0x0b, 0x17, 0xa9, 0x20, 0xb0,
+  0x29, 0xa2, 0x8f, 0x43, 0xb9, 0x50, 0x91, 0x8c, 0x03, 0xcc, 0x41, 0x92, 0x8c, 0x43, 0xb8, 0x1b,
+  0x01, 0x89, 0x33, 0xea, 0x38, 0x92, 0x0a, 0x04, 0xba, 0x10, 0xcc, 0x51, 0xa1, 0x3b, 0x17, 0xcb,
+  0x19, 0x80, 0x41, 0xa2, 0x9d, 0x31, 0x91, 0x8b, 0x32, 0xd1, 0x8c, 0x24, 0xa9, 0x29, 0xa0, 0x78,
+  0x93, 0xae, 0x22, 0xd8, 0x39, 0x14, 0x9a, 0x80, 0xba, 0x51, 0x93, 0x8b, 0x24, 0xb8, 0x8b, 0x41,
+  0x13, 0xeb, 0x29, 0x94, 0xae, 0x31, 0x92, 0x8a, 0x11, 0x29, 0x25, 0xeb, 0x19, 0x01, 0xa9, 0x28,
+  0x6d, 0x00, 0x25, 0x00, 0xa1, 0x0b, 0x15, 0xbb, 0x73, 0xc0, 0x1c, 0x03, 0xbb, 0x63, 0xa0, 0x29,
+  0xc1, 0x1c, 0x15, 0xb9, 0x10, 0xd8, 0x39, 0x15, 0x89, 0x82, 0xcc, 0x50, 0xa1, 0x8c, 0x23, 0xc9,
+  0x38, 0x83, 0xba, 0x20, 0x81, 0x9b, 0x62, 0xb2, 0x8d, 0x33, 0xca, 0x29, 0x93, 0xaa, 0xb8, 0x79,
+  0x47, 0xa8, 0x0a, 0xa0, 0xbc, 0x40, 0x24, 0xa8, 0x1a, 0x01, 0xbb, 0x38, 0x83, 0x8b, 0x23, 0x01,
+  0xb1, 0xff, 0x2b, 0x14, 0x89, 0x34, 0xd1, 0x8a, 0x82, 0x9a, 0x31, 0x91, 0x31, 0xf8, 0x1c, 0x24,
+  0xea, 0x2a, 0x24, 0xca, 0x2a, 0x03, 0x9c, 0x52, 0xa0, 0x2a, 0x02, 0xbc, 0x18, 0x33, 0xc1, 0x8c,
+  0x26, 0xd8, 0x19, 0x02, 0x0a, 0x82, 0x9d, 0x43, 0xc0, 0x2a, 0x83, 0x9c, 0x34, 0xe8, 0x8a, 0x13,
+  0x90, 0x32, 0xb1, 0x8e, 0x42, 0xb0, 0xab, 0x21, 0x21, 0x00, 0xa8, 0x9d, 0x52, 0xd1, 0x8b, 0x26,
+  0xda, 0x18, 0x82, 0x89, 0x12, 0x89, 0x44, 0xd0, 0x9b, 0x42, 0xa2, 0xbd, 0x61, 0xa2, 0x9e, 0x33,
+  0xa0, 0x1a, 0x82, 0x8a, 0x83, 0xad, 0x41, 0xb8, 0x49, 0x15, 0x8a, 0x00, 0xb9, 0x28, 0x82, 0x09,
+  0x12, 0xb0, 0xde, 0x0a, 0x02, 0x18, 0x37, 0xd8, 0x1a, 0x15, 0xcc, 0x28, 0x83, 0x89, 0x12, 0x99,
+  0x01, 0xcd, 0x71, 0x91, 0x9d, 0x32, 0x80, 0x89, 0x80, 0x08, 0xa9, 0x09, 0x22, 0x21, 0x02, 0x9c,
+  0x12, 0xda, 0x38, 0xe0, 0x0d, 0x35, 0xb1, 0x8c, 0x34, 0xd8, 0x0a, 0x13, 0x89, 0x89, 0x0a, 0x36,
+  0xea, 0x1a, 0x14, 0xa8, 0x88, 0x18, 0x13, 0xdc, 0x51, 0xa2, 0x8c, 0x25, 0xcb, 0x39, 0x92, 0x0c,
+  0x12, 0xab, 0x53, 0x92, 0xab, 0x18, 0x23, 0xfb, 0x1c, 0x24, 0xb9, 0x30, 0xa0, 0x1b, 0x84, 0x8c,
+  0x44, 0xd9, 0x2a, 0x04, 0xaa, 0x32, 0xe8, 0x19, 0x05, 0xab, 0x40, 0x91, 0x8c, 0x31, 0xa1, 0x0a,
+  0xb8, 0x00, 0x24, 0x00, 0xa1, 0x9d, 0x12, 0xa9, 0x42, 0xa0, 0x59, 0x14, 0xcb, 0x88, 0x98, 0x21,
+  0xc8, 0x49, 0x24, 0x88, 0xea, 0x9c, 0x24, 0xc0, 0x48, 0x84, 0xab, 0x31, 0xc8, 0x8a, 0x22, 0x98,
+  0x18, 0xa2, 0xbc, 0x72, 0x82, 0xaa, 0x80, 0x9b, 0x64, 0xb1, 0x0c, 0x33, 0xc9, 0x0a, 0x33, 0xb9,
+  0x9b, 0x73, 0x05, 0xcb, 0x28, 0x13, 0xca, 0x89, 0x32, 0xb1, 0x9f, 0x53, 0xa1, 0x9b, 0x11, 0x98,
+  0x52, 0xa2, 0x8a, 0x80, 0xbb, 0xa8, 0x3a, 0x77, 0xc9, 0x48, 0x03, 0x9c, 0x22, 0xca, 0x28, 0xe8,
+  0x39, 0x07, 0xa9, 0x18, 0x88, 0x10, 0xa8, 0x40, 0xc1, 0x0c, 0x22, 0x98, 0x91, 0xac, 0x47, 0xb0,
+  0x1b, 0x04, 0xcb, 0x31, 0xc0, 0x1b, 0x05, 0xa9, 0x52, 0xc1, 0x8a, 0x03, 0xab, 0x44, 0xb8, 0x59,
+  0xb2, 0x9c, 0x14, 0xa9, 0x30, 0xa0, 0x09, 0xa1, 0x20, 0xe9, 0x78, 0x94, 0x9d, 0x33, 0xd8, 0x2a,
+  0x03, 0x09, 0x82, 0xaf, 0x51, 0xa1, 0x8a, 0x12, 0xb9, 0x49, 0x03, 0xaa, 0x10, 0x80, 0xba, 0x48,
+  0x14, 0x9b, 0x21, 0xee, 0x48, 0xa3, 0x8e, 0x34, 0xc8, 0x29, 0x93, 0x9d, 0x21, 0xa8, 0x38, 0x81,
+  0x8b, 0x21, 0x89, 0x10, 0xa8, 0x3a, 0x47, 0xc8, 0x8c, 0x43, 0xc8, 0x9b, 0x63, 0x90, 0x0b, 0x34,
+  0xc0, 0x8b, 0x03, 0x8b, 0x53, 0xd8, 0x19, 0x02, 0x19, 0x82, 0x9b, 0x33, 0xfb, 0x1a, 0x12, 0x08,
+  0x80, 0x00, 0xfa, 0x4b, 0x16, 0xbb, 0x39, 0x92, 0x0a, 0x02, 0x8b, 0x35, 0xb0, 0x0c, 0x33, 0xfa,
+  0x8b, 0x34, 0xb8, 0x2a, 0x15, 0xa8, 0xa9, 0x9c, 0x54, 0xb8, 0x79, 0x03, 0xbe, 0x40, 0x81, 0x9b,
+  0x32, 0xb0, 0x0b, 0x25, 0xb9, 0x2a, 0x83, 0xaa, 0x98, 0x39, 0x37, 0xdc, 0x40, 0xa1, 0x0c, 0x24,
+  0xb9, 0x19, 0x43, 0x92, 0xbf, 0x30, 0xb2, 0x1c, 0x04, 0xaa, 0x24, 0xc9, 0x48, 0xa2, 0x1b, 0xa2,
+  0x75, 0xfe, 0x24, 0x00, 0x7a, 0x83, 0x9b, 0x33, 0xca, 0x09, 0x10, 0x35, 0xe9, 0x29, 0xa1, 0x0c,
+  0x24, 0x89, 0x23, 0xfa, 0x18, 0xa2, 0x8b, 0x11, 0x08, 0x14, 0xca, 0x09, 0x80, 0x31, 0x02, 0x10,
+  0xfb, 0x48, 0xa3, 0x9e, 0x22, 0xcb, 0x61, 0x82, 0x99, 0x99, 0x38, 0x93, 0x9e, 0x43, 0xd9, 0x1a,
+  0x23, 0x90, 0xaa, 0x48, 0x04, 0x8c, 0x23, 0xfc, 0x38, 0x94, 0x9b, 0x43, 0xc8, 0x0b, 0x43, 0xb1,
+  0xab, 0x41, 0x92, 0xab, 0x52, 0x82, 0xbb, 0x50, 0xc2, 0x9e, 0x53, 0xa0, 0x9a, 0x10, 0x11, 0x91,
+  0x9b, 0x42, 0xb0, 0x8b, 0x41, 0x24, 0xa8, 0x89, 0xcd, 0x38, 0xc2, 0x6a, 0x06, 0xac, 0x41, 0xa0,
+  0x0b, 0x82, 0x19, 0x94, 0xac, 0x34, 0xd8, 0x30, 0xa1, 0x1a, 0xe1, 0x2b, 0x27, 0xcb, 0x40, 0xa1,
+  0x1b, 0x02, 0x9c, 0x32, 0x90, 0x20, 0xe8, 0x1a, 0x02, 0x0a, 0x13, 0xbb, 0x40, 0xc8, 0x58, 0xa3,
+  0x8b, 0x14, 0xdd, 0x40, 0x02, 0x9b, 0x18, 0x01, 0xb9, 0x38, 0x17, 0xca, 0x38, 0x82, 0xbb, 0x8a,
+  0x54, 0xa2, 0x9e, 0x32, 0xc1, 0x8b, 0x53, 0xa0, 0x1b, 0x14, 0xcc, 0x38, 0x83, 0x8b, 0x32, 0xa0,
+  0xac, 0x70, 0xa3, 0x9e, 0x33, 0xd8, 0x29, 0xb3, 0x1c, 0x15, 0xba, 0x21, 0xb8, 0x40, 0xc1, 0x2b,
+  0x06, 0xab, 0x32, 0xa0, 0x28, 0xa0, 0x8b, 0x82, 0xdb, 0x48, 0x05, 0xca, 0x52, 0xb1, 0x0e, 0x23,
+  0xdb, 0x38, 0x93, 0x8b, 0x33, 0xc9, 0x1b, 0x24, 0xb9, 0x28, 0xf1, 0x2b, 0x27, 0xdb, 0x30, 0xa3,
+  0x8e, 0x22, 0xb8, 0x29, 0x02, 0x98, 0xbb, 0x73, 0xa3, 0x8c, 0x23, 0xa9, 0x09, 0xa9, 0x28, 0x80,
+  0x51, 0xa2, 0x0d, 0x14, 0xaa, 0x10, 0x18, 0x13, 0xef, 0x48, 0x82, 0xab, 0x00, 0x01, 0x02, 0x18,
+  0x82, 0xaf, 0x63, 0xd8, 0x2a, 0x04, 0xba, 0x40, 0x92, 0x99, 0x88, 0x00, 0xba, 0x72, 0xa4, 0x8c,
+  0x3d, 0x00, 0x27, 0x00, 0xb1, 0x3b, 0x95, 0x8c, 0x25, 0xda, 0x28, 0x91, 0x38, 0xa2, 0x0c, 0x04,
+  0xab, 0x11, 0xab, 0x47, 0xd8, 0x2a, 0x84, 0xab, 0x21, 0x80, 0x11, 0x98, 0x98, 0xad, 0x72, 0xa2,
+  0x8b, 0x13, 0x98, 0x81, 0xad, 0x21, 0x99, 0x75, 0xa1, 0x8c, 0x12, 0x99, 0x00, 0xbb, 0x51, 0x93,
+  0x9b, 0x32, 0x00, 0x82, 0xed, 0x28, 0x13, 0xba, 0x41, 0xd1, 0x0c, 0x23, 0xc9, 0x30, 0xb2, 0x2a,
+  0x06, 0x8a, 0xc0, 0x8e, 0x36, 0xc9, 0x19, 0x82, 0x1a, 0x02, 0x9c, 0x22, 0xb0, 0x18, 0xda, 0x50,
+  0x02, 0x89, 0xd9, 0x49, 0x84, 0x8c, 0x02, 0x9a, 0x26, 0xfa, 0x28, 0x83, 0x9c, 0x12, 0x90, 0x00,
+  0x89, 0x01, 0x89, 0x11, 0xcc, 0x51, 0xa1, 0x3a, 0x84, 0x9c, 0x90, 0x8a, 0x16, 0xaa, 0x54, 0xd8,
+  0x1a, 0x83, 0x09, 0x04, 0xba, 0x41, 0xa1, 0xac, 0x8a, 0x43, 0x81, 0x29, 0xa3, 0x8c, 0x24, 0xad,
+  0x72, 0xc0, 0x0c, 0x33, 0xb9, 0x28, 0x83, 0x10, 0xd8, 0x0c, 0x24, 0xba, 0x19, 0xa8, 0x72, 0x91,
+  0x0b, 0x83, 0x8c, 0x23, 0xcc, 0x51, 0xa0, 0x2a, 0x85, 0xcc, 0x20, 0x03, 0xb9, 0x29, 0x26, 0xd9,
+  0x29, 0x81, 0x9a, 0x21, 0x90, 0xaa, 0x29, 0x22, 0x31, 0xa3, 0xaf, 0x33, 0xd9, 0x50, 0xd1, 0x1b,
+  0x15, 0xa8, 0x18, 0xa9, 0x29, 0x16, 0xca, 0x2a, 0x16, 0xbb, 0x61, 0xc0, 0x1a, 0x14, 0xac, 0x41,
+  0xa2, 0xab, 0x31, 0x82, 0x9b, 0x21, 0x98, 0x41, 0xfa, 0x2b, 0x06, 0xa9, 0x18, 0x00, 0x22, 0xba,
+  0x28, 0xfb, 0x70, 0x92, 0x8d, 0x13, 0xb9, 0x30, 0xe8, 0x29, 0x04, 0xaa, 0x11, 0x08, 0x10, 0x98,
+  0x00, 0x9b, 0x54, 0xd8, 0x0a, 0x23, 0x91, 0xcc, 0x49, 0x84, 0xab, 0x62, 0x02, 0xa9, 0xae, 0x40,
+  0xa0, 0x4a, 0x84, 0xab, 0x52, 0xa8, 0x29, 0xa8, 0x38, 0xd1, 0x3a, 0x87, 0x8b, 0x24, 0xdc, 0x38,
+  0xca, 0x00, 0x2e, 0x00, 0x98, 0x10, 0x9a, 0x41, 0xb0, 0x39, 0xd3, 0x8d, 0x24, 0xa8, 0x08, 0x89,
+  0x32, 0xf9, 0x29, 0x83, 0x8a, 0x14, 0xdb, 0x30, 0xb1, 0x38, 0x94, 0x8c, 0x14, 0xbc, 0x60, 0x82,
+  0x9b, 0x80, 0xab, 0x43, 0x91, 0x20, 0xc8, 0x39, 0xa4, 0x9f, 0x52, 0xb0, 0x1b, 0x33, 0xc9, 0x1a,
+  0x44, 0xc9, 0x2a, 0x14, 0xdb, 0x29, 0x12, 0x98, 0x9b, 0x55, 0xc0, 0x0d, 0x43, 0xc9, 0x2a, 0x13,
+  0xb9, 0x29, 0x13, 0xba, 0x09, 0x34, 0x02, 0xfa, 0x8c, 0x42, 0xa1, 0x0c, 0x23, 0xb8, 0x39, 0xa4,
+  0xad, 0x11, 0x90, 0x30, 0xa4, 0x9e, 0x53, 0x92, 0xbb, 0x38, 0x92, 0xac, 0x40, 0x82, 0x99, 0x9a,
+  0x51, 0xa2, 0x8c, 0x33, 0xa8, 0x61, 0xa1, 0xae, 0x21, 0xa8, 0x9c, 0x73, 0x91, 0x8c, 0x34, 0xc0,
+  0x0b, 0x25, 0xe9, 0x0a, 0x33, 0xb0, 0x8c, 0x22, 0xa1, 0x09, 0x14, 0xea, 0x28, 0x03, 0xba, 0x30,
+  0xa2, 0xae, 0x89, 0x63, 0x02, 0x9a, 0x88, 0x08, 0x02, 0x9e, 0x64, 0xb0, 0x1c, 0x14, 0xac, 0x30,
+  0xb0, 0x3a, 0x04, 0x9a, 0x00, 0x99, 0x21, 0x02, 0xd8, 0x8e, 0x63, 0xb0, 0x0a, 0x81, 0x10, 0xb0,
+  0x3a, 0x07, 0xab, 0x44, 0xc8, 0x18, 0xc1, 0x1b, 0x83, 0x3a, 0x17, 0xbc, 0x51, 0xb1, 0x8c, 0x22,
+  0x01, 0xb0, 0x9c, 0x32, 0xb8, 0xab, 0x30, 0x77, 0x90, 0x1a, 0x91, 0xaf, 0x40, 0x03, 0xcb, 0x19,
+  0x24, 0xa8, 0x29, 0x93, 0xae, 0x31, 0xa2, 0x0b, 0x14, 0xb9, 0xaa, 0x29, 0x46, 0x98, 0x38, 0xa3,
+  0xcf, 0x20, 0x02, 0x88, 0x89, 0x10, 0x02, 0xc8, 0x9c, 0x73, 0xc0, 0x0a, 0x25, 0xda, 0x19, 0x13,
+  0x98, 0x88, 0x00, 0x90, 0x89, 0xb8, 0x5a, 0x37, 0xca, 0x19, 0x91, 0x1c, 0x25, 0xa8, 0x89, 0xa9,
+  0x71, 0xa3, 0x9e, 0x32, 0xd0, 0x1a, 0x24, 0xb9, 0x19, 0x14, 0xda, 0x09, 0x12, 0x99, 0x38, 0x25,
+  0x58, 0x02, 0x2b, 0x00, 0xcb, 0x38, 0x03, 0xa9, 0x80, 0xbc, 0x50, 0xb8, 0x69, 0x14, 0xab, 0x00,
+  0xd9, 0x29, 0x23, 0x81, 0xba, 0x59, 0x83, 0xad, 0x09, 0x20, 0x15, 0xca, 0x40, 0xc0, 0x1b, 0x25,
+  0xca, 0x18, 0xa1, 0x29, 0x15, 0xcb, 0x58, 0x03, 0xcc, 0x38, 0x13, 0xeb, 0x29, 0x25, 0xd9, 0x1a,
+  0x12, 0xa9, 0x28, 0x23, 0xb9, 0x8a, 0x43, 0xe8, 0x8a, 0x33, 0xca, 0x38, 0x84, 0x99, 0x43, 0xd9,
+  0x9b, 0x34, 0xa1, 0x0c, 0x23, 0xfb, 0x29, 0x26, 0xca, 0x0a, 0x32, 0x82, 0xca, 0x29, 0x05, 0xb9,
+  0x19, 0xa9, 0x58, 0x15, 0xb9, 0x19, 0x91, 0x59, 0x15, 0xce, 0x19, 0x82, 0x8b, 0x55, 0x12, 0x80,
+  0xed, 0x09, 0x13, 0x99, 0x11, 0xb8, 0x29, 0xa1, 0x9e, 0x32, 0x22, 0x01, 0x9a, 0x20, 0xa8, 0x08,
+  0xfb, 0x1e, 0x13, 0xbb, 0x71, 0x05, 0x89, 0x88, 0xba, 0x08, 0x80, 0x31, 0x93, 0x9e, 0x21, 0xc9,
+  0x48, 0x03, 0x8b, 0x42, 0x81, 0xba, 0xaf, 0x48, 0x82, 0xaa, 0x20, 0x11, 0x88, 0x41, 0x84, 0xac,
+  0x51, 0xb1, 0xae, 0x80, 0x10, 0x34, 0x92, 0xab, 0x00, 0x90, 0x60, 0x24, 0xa9, 0xbb, 0xac, 0x29,
+  0x14, 0x28, 0x16, 0xeb, 0x29, 0x82, 0x9a, 0x44, 0xa0, 0xab, 0x9b, 0x41, 0x83, 0x1a, 0x26, 0xda,
+  0x8a, 0x01, 0x11, 0x01, 0xcb, 0xab, 0x9b, 0x55, 0x14, 0xa8, 0xbb, 0x8a, 0x22, 0x12, 0x44, 0x04,
+  0xcc, 0x09, 0x22, 0x10, 0x11, 0xbb, 0x3a, 0x24, 0x91, 0xab, 0x75, 0x95, 0xbd, 0x0a, 0x21, 0x32,
+  0x91, 0xbb, 0x08, 0x32, 0x92, 0x9c, 0x45, 0xd0, 0xad, 0x19, 0x44, 0x82, 0xca, 0x88, 0x88, 0x20,
+  0xb0, 0x8d, 0x23, 0xa8, 0x10, 0xea, 0x40, 0x94, 0x8d, 0x52, 0x12, 0x08, 0xb8, 0x9c, 0x10, 0xb9,
+  0x09, 0x42, 0x35, 0x82, 0xbb, 0x20, 0x92, 0xdc, 0xaa, 0x08, 0x22, 0x21, 0x12, 0xeb, 0x8a, 0x90,
+  0x9e, 0xff, 0x18, 0x00, 0x72, 0x14, 0x90, 0x88, 0xb9, 0x8b, 0xaa, 0x0a, 0x35, 0x81, 0xeb, 0x1a,
+  0x67, 0x81, 0xab, 0x18, 0xa8, 0x0a, 0x21, 0x10, 0x42, 0xb1, 0xbe, 0x0a, 0x32, 0x13, 0x80, 0x22,
+  0xb1, 0xaf, 0xab, 0xab, 0x64, 0x81, 0xab, 0x10, 0x08, 0x12, 0xdb, 0x68, 0x83, 0xac, 0x20, 0x51,
+  0x47, 0x92, 0xad, 0x9a, 0x8a, 0x10, 0x23, 0x43, 0x82, 0xab, 0x31, 0xb0, 0xbc, 0xca, 0xab, 0x1a,
+  0x54, 0x14, 0x81, 0xa9, 0xcb, 0x89, 0x63, 0x02, 0xaa, 0x99, 0xba, 0x29, 0x23, 0x10, 0x23, 0xfb,
+  0x19, 0x90, 0x71, 0x07, 0xba, 0x89, 0x08, 0x00, 0xa8, 0x61, 0x03, 0x60, 0x05, 0xcb, 0x48, 0x13,
+  0xbb, 0x9a, 0x10, 0x02, 0x98, 0x21, 0xd0, 0x2b, 0x36, 0x02, 0x01, 0xf9, 0xac, 0x9a, 0x20, 0x23,
+  0x44, 0x23, 0xb9, 0x38, 0x16, 0x88, 0x80, 0xdd, 0xab, 0x21, 0x83, 0xbe, 0x30, 0x04, 0x09, 0x90,
+  0x9c, 0x88, 0xcc, 0x48, 0x14, 0xa9, 0x99, 0xb8, 0xde, 0x0a, 0x45, 0x02, 0x89, 0x21, 0xa0, 0x9a,
+  0x18, 0xb0, 0xdf, 0x18, 0x02, 0x80, 0x53, 0x02, 0xba, 0xae, 0x89, 0x10, 0x31, 0x24, 0x12, 0x81,
+  0xa8, 0xa9, 0x1b, 0x57, 0x01, 0x88, 0x99, 0x99, 0x99, 0x30, 0x16, 0xa9, 0x19, 0x12, 0x38, 0x67,
+  0xc0, 0xbc, 0xba, 0xbb, 0x38, 0x26, 0x23, 0xb2, 0xbf, 0x9a, 0x9c, 0x38, 0x23, 0x45, 0x92, 0xbc,
+  0x10, 0x80, 0x09, 0xa9, 0x89, 0xc9, 0x4b, 0x47, 0x82, 0xaa, 0x89, 0xc9, 0xbd, 0x51, 0x34, 0x01,
+  0x01, 0x80, 0xeb, 0x1a, 0x37, 0x90, 0x19, 0x13, 0xcb, 0x0a, 0x31, 0xa2, 0xae, 0x62, 0x92, 0x1a,
+  0x35, 0xa0, 0xab, 0xaa, 0xcb, 0xbc, 0x71, 0x36, 0x22, 0x43, 0x01, 0x89, 0x90, 0xcb, 0x9b, 0xa9,
+  0x29, 0x36, 0x81, 0x89, 0x8a, 0x52, 0xb1, 0x1b, 0x16, 0xcc, 0x1a, 0xc0, 0xcf, 0xaa, 0x08, 0x80,
+  0x6a, 0xfc, 0x2a, 0x00, 0x31, 0x25, 0x90, 0x99, 0xa8, 0xcf, 0x9b, 0x80, 0x98, 0x28, 0x34, 0x03,
+  0xa8, 0x19, 0x82, 0xad, 0x71, 0x82, 0x89, 0x08, 0x99, 0xba, 0x8d, 0x43, 0x91, 0x50, 0x25, 0x80,
+  0x98, 0xca, 0xbb, 0x9d, 0x20, 0x90, 0x9b, 0x98, 0xcd, 0x09, 0x88, 0xa8, 0xab, 0x38, 0xb2, 0xaf,
+  0x80, 0xdb, 0x9a, 0x99, 0x50, 0x13, 0x40, 0x85, 0x9a, 0x42, 0x01, 0x74, 0x82, 0x30, 0x14, 0x48,
+  0x27, 0x80, 0x42, 0x81, 0x19, 0x26, 0x21, 0x24, 0x11, 0x36, 0xc8, 0x0a, 0x82, 0x9b, 0x77, 0x35,
+  0x33, 0x12, 0x00, 0xea, 0xbd, 0x99, 0xa9, 0x18, 0x33, 0x23, 0x90, 0x09, 0xa1, 0xef, 0x89, 0xa8,
+  0x9a, 0x08, 0x08, 0xd9, 0xad, 0x99, 0xaa, 0x28, 0x34, 0x33, 0x82, 0xba, 0xcc, 0xbe, 0x9b, 0x08,
+  0x31, 0x35, 0x44, 0x24, 0x01, 0x10, 0x80, 0x99, 0x0a, 0x52, 0x23, 0x31, 0x34, 0xc8, 0xac, 0x09,
+  0x00, 0x10, 0x62, 0x03, 0xcb, 0x08, 0xda, 0xbd, 0xbb, 0xaa, 0xab, 0x29, 0x35, 0x90, 0xaa, 0xda,
+  0xbc, 0x9c, 0x28, 0x82, 0xba, 0x09, 0x98, 0x9a, 0x65, 0x14, 0xa9, 0x29, 0x44, 0x12, 0x31, 0x15,
+  0xca, 0x0a, 0x43, 0x23, 0x33, 0x43, 0x82, 0xac, 0x51, 0x81, 0x18, 0xb8, 0x8c, 0x98, 0x8d, 0x43,
+  0xb1, 0xcb, 0xbc, 0x29, 0x91, 0x5a, 0x17, 0xc9, 0x08, 0x20, 0x22, 0xc8, 0x38, 0x16, 0x18, 0x57,
+  0x22, 0x00, 0xa8, 0x18, 0x02, 0x72, 0x57, 0x11, 0x88, 0x99, 0xa9, 0xcb, 0x09, 0x11, 0xa9, 0x39,
+  0x25, 0xa0, 0x8a, 0xa9, 0xdf, 0xab, 0x08, 0x88, 0x9a, 0x88, 0xeb, 0xac, 0x99, 0x88, 0x10, 0x01,
+  0x21, 0x01, 0x88, 0xa8, 0xc9, 0xdc, 0xab, 0x72, 0x44, 0x42, 0x43, 0x02, 0x88, 0x88, 0x01, 0x10,
+  0x31, 0x25, 0x90, 0x0a, 0x01, 0xca, 0x8a, 0x01, 0x90, 0xcb, 0x38, 0xe1, 0xbf, 0xba, 0xdd, 0xab,
+  0x69, 0xf1, 0x34, 0x00, 0x00, 0x11, 0x00, 0x00, 0xc9, 0x9d, 0x18, 0xb0, 0x9b, 0x23, 0xa0, 0x0a,
+  0x52, 0x13, 0xcc, 0x58, 0x25, 0x89, 0x54, 0x03, 0x88, 0x98, 0x08, 0xc9, 0x8c, 0x45, 0x91, 0x18,
+  0x15, 0x90, 0xaa, 0xaa, 0x00, 0xdb, 0x50, 0x04, 0xab, 0x08, 0x90, 0xaa, 0x9a, 0x10, 0xea, 0x39,
+  0x47, 0x81, 0x88, 0x91, 0xba, 0x68, 0x25, 0x01, 0x52, 0x23, 0x10, 0x32, 0x27, 0xa1, 0x0b, 0x34,
+  0x00, 0x76, 0x34, 0x01, 0x99, 0xaa, 0xeb, 0xab, 0x10, 0x90, 0xaa, 0x10, 0x83, 0xdb, 0x0a, 0xda,
+  0xbe, 0x99, 0x80, 0x80, 0x99, 0x99, 0xdd, 0x9c, 0x89, 0x18, 0x12, 0x22, 0x44, 0x81, 0x08, 0x81,
+  0xa9, 0xba, 0x59, 0x37, 0x33, 0x45, 0x22, 0x00, 0x80, 0x09, 0x81, 0x18, 0x43, 0x81, 0x10, 0xf9,
+  0x9b, 0xa8, 0xbc, 0x20, 0x82, 0xb8, 0xcd, 0x8a, 0xfb, 0xbc, 0x89, 0xba, 0x0b, 0x32, 0x24, 0xa8,
+  0x8a, 0xb8, 0xbf, 0x28, 0x23, 0x12, 0x10, 0x21, 0xa0, 0x2b, 0x77, 0x02, 0x10, 0x22, 0x22, 0x12,
+  0x01, 0xb8, 0xbf, 0x19, 0x14, 0x00, 0x34, 0x82, 0xa9, 0xa9, 0xdc, 0xcd, 0x89, 0x01, 0x99, 0x18,
+  0xb0, 0xbd, 0x18, 0x11, 0x81, 0xcb, 0x28, 0xa8, 0x70, 0x47, 0x80, 0x10, 0x98, 0x73, 0x15, 0x18,
+  0x43, 0x00, 0x28, 0x43, 0x34, 0x82, 0x39, 0x37, 0x08, 0x76, 0x33, 0x11, 0x98, 0xcb, 0xdb, 0xab,
+  0x10, 0x98, 0x8a, 0x11, 0xa0, 0xaa, 0xb9, 0xdd, 0xbd, 0xaa, 0x88, 0x88, 0x88, 0xcb, 0xcd, 0xbb,
+  0x9b, 0x30, 0x33, 0x33, 0x36, 0x13, 0xaa, 0x18, 0x91, 0xcd, 0x40, 0x36, 0x23, 0x44, 0x24, 0x80,
+  0x89, 0x00, 0x90, 0x19, 0x35, 0x82, 0xaa, 0xaa, 0xeb, 0xab, 0x1a, 0x21, 0xb8, 0x9a, 0xd9, 0xbe,
+  0xaa, 0xcc, 0xcb, 0xaa, 0x89, 0x32, 0x32, 0x24, 0xc8, 0xac, 0x99, 0x09, 0x54, 0x22, 0x10, 0x88,
+  0x3f, 0xf5, 0x28, 0x00, 0x00, 0x11, 0x63, 0x23, 0x10, 0x63, 0x33, 0x80, 0x99, 0xea, 0xcc, 0x89,
+  0x21, 0x12, 0x88, 0x32, 0xe0, 0xbe, 0x99, 0xaa, 0xbb, 0x18, 0x34, 0xb8, 0x1a, 0x27, 0xb8, 0x8b,
+  0x35, 0xd0, 0x0b, 0x34, 0x12, 0x31, 0x64, 0x92, 0xac, 0x73, 0x02, 0x28, 0x45, 0x01, 0x08, 0x31,
+  0x13, 0xbc, 0x58, 0x04, 0x29, 0x77, 0x23, 0x81, 0x99, 0xb9, 0xcd, 0x8a, 0x12, 0xa9, 0x1a, 0x12,
+  0xc9, 0xab, 0x19, 0xe9, 0xbc, 0x10, 0x91, 0x9b, 0x88, 0xeb, 0xcc, 0x9b, 0x18, 0x11, 0x42, 0x33,
+  0x22, 0x11, 0x98, 0x09, 0xa9, 0xae, 0x40, 0x46, 0x32, 0x53, 0x22, 0x80, 0x9a, 0x18, 0x81, 0x18,
+  0x34, 0xa0, 0xbd, 0xcb, 0xbc, 0x9c, 0x10, 0x22, 0x00, 0x00, 0xea, 0xbd, 0x99, 0xdb, 0xac, 0x8a,
+  0x11, 0x11, 0x54, 0x23, 0xa9, 0x9a, 0x99, 0x8a, 0x31, 0x65, 0x82, 0x89, 0x00, 0x98, 0x30, 0x14,
+  0x80, 0x98, 0x60, 0x15, 0x90, 0xa9, 0xcf, 0x9b, 0x00, 0x32, 0x02, 0x00, 0xc8, 0xce, 0x0a, 0x00,
+  0x88, 0x20, 0x81, 0xb9, 0x09, 0x44, 0x82, 0x9d, 0x43, 0xd9, 0x2b, 0x36, 0x10, 0x41, 0x32, 0x03,
+  0xbb, 0x73, 0x95, 0x8b, 0x44, 0x81, 0x18, 0x63, 0x13, 0xa8, 0x38, 0x94, 0x8c, 0x77, 0x23, 0x02,
+  0x80, 0xa9, 0xce, 0x8a, 0x01, 0xa8, 0x19, 0x13, 0xb8, 0xab, 0x18, 0xfa, 0xae, 0x18, 0x80, 0x8a,
+  0x11, 0xb8, 0xbf, 0xab, 0x09, 0x08, 0x62, 0x23, 0x11, 0x10, 0xa8, 0x9a, 0x98, 0x89, 0x31, 0x46,
+  0x35, 0x43, 0x33, 0x81, 0x99, 0x09, 0x00, 0x31, 0x33, 0x91, 0xde, 0xbc, 0xbb, 0xbb, 0x20, 0x24,
+  0x02, 0xdb, 0xbb, 0xb9, 0xbc, 0x18, 0xe9, 0xbe, 0x89, 0x21, 0x13, 0x41, 0x26, 0xa0, 0x8b, 0x42,
+  0x82, 0x09, 0x11, 0xd8, 0xad, 0x39, 0x25, 0x01, 0x10, 0x90, 0xab, 0x8a, 0x01, 0xf9, 0xcc, 0x99,
+  0xaf, 0xf5, 0x2b, 0x00, 0x08, 0x80, 0x88, 0x80, 0xed, 0xab, 0x10, 0x11, 0x80, 0x42, 0xc2, 0xbf,
+  0x20, 0x15, 0xa8, 0x30, 0x25, 0xba, 0x1a, 0x44, 0x80, 0x19, 0x57, 0x81, 0x89, 0x43, 0x90, 0x0a,
+  0x31, 0x11, 0x08, 0x76, 0x14, 0x98, 0x01, 0xc8, 0x0b, 0x66, 0x33, 0x13, 0x01, 0xda, 0xcd, 0x89,
+  0x80, 0x89, 0x10, 0x82, 0x98, 0x89, 0x01, 0xed, 0x9b, 0x80, 0x9a, 0x18, 0x22, 0xd8, 0xbe, 0x9a,
+  0x99, 0x28, 0x45, 0x13, 0x11, 0x80, 0x98, 0xaa, 0xab, 0x89, 0x20, 0x55, 0x45, 0x33, 0x12, 0x90,
+  0x99, 0x99, 0x89, 0x43, 0x01, 0x90, 0xea, 0xcc, 0xab, 0x89, 0x20, 0x24, 0x23, 0xa0, 0xbe, 0xaa,
+  0xbc, 0xac, 0x99, 0xa9, 0x08, 0x53, 0x35, 0x23, 0x81, 0xa9, 0xaa, 0x30, 0x65, 0x23, 0x90, 0xbd,
+  0x9a, 0x88, 0x28, 0x44, 0x02, 0x98, 0x21, 0x12, 0xfb, 0xbc, 0xcc, 0xbb, 0x19, 0x34, 0x22, 0x11,
+  0xd9, 0xbe, 0x8b, 0x20, 0x12, 0x21, 0x14, 0xb8, 0x1a, 0x26, 0xa8, 0x0b, 0x23, 0xd9, 0x1a, 0x46,
+  0x01, 0x19, 0x65, 0x01, 0x09, 0x45, 0x91, 0x8a, 0x10, 0x80, 0xaa, 0x71, 0x17, 0x88, 0x21, 0xa2,
+  0xab, 0x72, 0x36, 0x24, 0x01, 0xa0, 0xce, 0xaa, 0x80, 0x89, 0x20, 0x11, 0x90, 0x89, 0x11, 0xfa,
+  0x9d, 0x89, 0xb9, 0x89, 0x31, 0x81, 0xcd, 0x9b, 0x99, 0x8a, 0x54, 0x24, 0x01, 0x90, 0x99, 0xaa,
+  0x88, 0x88, 0x21, 0x54, 0x44, 0x34, 0x43, 0x91, 0x99, 0x89, 0x9a, 0x28, 0x24, 0x91, 0xbb, 0xaa,
+  0xfa, 0x9c, 0x21, 0x02, 0x18, 0x80, 0xec, 0xcb, 0xaa, 0xb9, 0x9b, 0x20, 0xa8, 0x79, 0x36, 0x80,
+  0x08, 0x81, 0xbc, 0x0b, 0x74, 0x03, 0xaa, 0x30, 0xb1, 0x9f, 0x42, 0x03, 0x99, 0x8a, 0x20, 0xc0,
+  0x8d, 0x11, 0xea, 0x8b, 0x21, 0x11, 0x23, 0x91, 0xca, 0xdd, 0x8b, 0x11, 0x88, 0x10, 0x82, 0x89,
+  0x2e, 0xf3, 0x28, 0x00, 0x34, 0x11, 0x92, 0xbb, 0x38, 0xd1, 0x1b, 0x16, 0xbd, 0x68, 0x24, 0x00,
+  0x34, 0x23, 0x92, 0xcc, 0x40, 0x82, 0x8a, 0x47, 0x02, 0x00, 0x11, 0xb8, 0xad, 0x71, 0x47, 0x22,
+  0x11, 0x98, 0xcd, 0xab, 0x88, 0x98, 0x00, 0x22, 0x81, 0x89, 0x00, 0xe9, 0xcc, 0x99, 0xa8, 0x8a,
+  0x32, 0xa2, 0xbd, 0xcb, 0xcb, 0x19, 0x55, 0x23, 0x00, 0x08, 0xa9, 0xcb, 0x18, 0x01, 0x8a, 0x71,
+  0x24, 0x23, 0x33, 0x03, 0xb9, 0xaa, 0x88, 0x08, 0x28, 0x82, 0xdf, 0x9b, 0x98, 0x89, 0x31, 0x43,
+  0x23, 0xd9, 0xac, 0xcc, 0xbc, 0xac, 0x8a, 0x01, 0x28, 0x63, 0x23, 0x02, 0xaa, 0x29, 0xc0, 0x3a,
+  0x47, 0x11, 0x91, 0xbc, 0x8a, 0xa8, 0x60, 0x26, 0x00, 0x80, 0xa9, 0x89, 0xda, 0x9c, 0xa9, 0x8a,
+  0x42, 0x43, 0x26, 0xb1, 0xbd, 0xab, 0x89, 0xa9, 0x60, 0x34, 0xb9, 0x1a, 0x34, 0xa1, 0xac, 0x38,
+  0x82, 0x9d, 0x73, 0x02, 0xba, 0x8a, 0x22, 0x80, 0x61, 0x25, 0x90, 0x09, 0x32, 0x81, 0x9b, 0x62,
+  0x83, 0x89, 0x55, 0x91, 0xcc, 0x19, 0x57, 0x33, 0x23, 0x12, 0xfa, 0xbc, 0x99, 0x88, 0x08, 0x10,
+  0x12, 0x80, 0x89, 0x08, 0xdc, 0xab, 0xbb, 0x8b, 0x22, 0x98, 0x80, 0xff, 0xab, 0x08, 0x42, 0x33,
+  0x23, 0x82, 0xeb, 0x9a, 0x00, 0xa9, 0x09, 0x34, 0x33, 0x64, 0x34, 0x02, 0x99, 0x98, 0xaa, 0x19,
+  0x53, 0x03, 0xaa, 0xb9, 0xec, 0x8a, 0x22, 0x01, 0x10, 0xa1, 0xdd, 0xab, 0x89, 0xd9, 0xad, 0x08,
+  0x80, 0x28, 0x45, 0x12, 0xa9, 0x0a, 0x01, 0xa9, 0x51, 0x14, 0xb8, 0x9c, 0x51, 0x13, 0x09, 0x45,
+  0x91, 0xba, 0x9a, 0x11, 0xe9, 0xac, 0x00, 0xaa, 0x71, 0x23, 0x11, 0xa8, 0xcc, 0xbc, 0x9c, 0x10,
+  0x98, 0x19, 0x32, 0x33, 0x23, 0x63, 0x83, 0xcf, 0x8b, 0x11, 0x21, 0x11, 0x12, 0xb8, 0x3a, 0x57,
+  0xd6, 0xfd, 0x31, 0x00, 0x10, 0x21, 0x82, 0xaa, 0x72, 0x03, 0xcb, 0x28, 0x03, 0x18, 0x67, 0x82,
+  0xeb, 0x19, 0x45, 0x21, 0x54, 0x13, 0xca, 0xbc, 0x89, 0x98, 0x0a, 0x42, 0x81, 0x9b, 0x51, 0x82,
+  0xca, 0xab, 0xb9, 0xba, 0x29, 0x26, 0xc0, 0xcc, 0x99, 0x88, 0x32, 0x34, 0x22, 0xb0, 0xad, 0x09,
+  0x98, 0xaa, 0x19, 0x31, 0x55, 0x55, 0x13, 0x80, 0x99, 0x99, 0xab, 0x50, 0x24, 0x90, 0x99, 0x98,
+  0xaa, 0x10, 0x01, 0x90, 0xa9, 0xb8, 0xce, 0x19, 0xd8, 0xcf, 0x0a, 0x01, 0x88, 0x41, 0x23, 0xb9,
+  0x9b, 0x21, 0xa8, 0x39, 0x47, 0xb0, 0x8c, 0x43, 0x90, 0x28, 0x36, 0x02, 0x8a, 0x10, 0xd8, 0xae,
+  0x18, 0x82, 0xba, 0x48, 0x14, 0x98, 0x10, 0xb1, 0xdf, 0x9a, 0x08, 0x90, 0x20, 0x03, 0xcc, 0x19,
+  0x32, 0x12, 0x80, 0x11, 0xfa, 0x9d, 0x11, 0x22, 0x12, 0x38, 0x27, 0xa0, 0x2a, 0x14, 0x80, 0x98,
+  0x72, 0x37, 0xba, 0x28, 0x92, 0x9c, 0x62, 0x24, 0xa1, 0xac, 0x12, 0xd9, 0x70, 0x37, 0x01, 0x98,
+  0x9a, 0xda, 0x9b, 0x30, 0x03, 0xbb, 0x20, 0x24, 0xa8, 0x8a, 0xa1, 0xff, 0x0a, 0x21, 0x80, 0x98,
+  0x99, 0xcb, 0x9a, 0x42, 0x24, 0x80, 0x88, 0xb9, 0x99, 0x88, 0xa9, 0x88, 0x8a, 0x72, 0x57, 0x23,
+  0x80, 0x98, 0x9a, 0x89, 0x41, 0x34, 0x81, 0xcb, 0x9a, 0x99, 0x30, 0x24, 0x92, 0xaa, 0x0a, 0x53,
+  0xc0, 0xbf, 0xac, 0xaa, 0x08, 0x33, 0x34, 0x90, 0xab, 0xa9, 0xad, 0x40, 0x03, 0x9a, 0x11, 0x11,
+  0x01, 0x28, 0x37, 0x81, 0x71, 0x14, 0x80, 0x80, 0xc9, 0xcd, 0x8a, 0x32, 0x12, 0x10, 0x12, 0xa8,
+  0xca, 0xcc, 0x9a, 0xa9, 0x9a, 0x00, 0xa9, 0xab, 0xac, 0x73, 0x04, 0x8a, 0x63, 0xa2, 0xbd, 0x9a,
+  0xb9, 0x1a, 0x57, 0x33, 0x01, 0xaa, 0x40, 0x81, 0x2b, 0x47, 0x01, 0x88, 0x9b, 0x40, 0xb1, 0x1d,
+  0xa3, 0x05, 0x2f, 0x00, 0x17, 0x08, 0x03, 0xb9, 0xaa, 0x78, 0x77, 0x12, 0x80, 0x99, 0xbc, 0x9b,
+  0x19, 0x32, 0x13, 0x01, 0x88, 0x9a, 0xc9, 0xcd, 0xac, 0x89, 0x88, 0x00, 0x23, 0xc0, 0xbe, 0x9b,
+  0x18, 0x31, 0x33, 0x02, 0xeb, 0xac, 0x8a, 0x80, 0x89, 0x42, 0x32, 0x47, 0x24, 0x11, 0x92, 0xbc,
+  0x09, 0x01, 0x44, 0x02, 0x89, 0x01, 0x09, 0x42, 0x82, 0xb9, 0xac, 0x38, 0x24, 0xfb, 0xad, 0xbb,
+  0xac, 0x38, 0x27, 0x81, 0x98, 0xb9, 0xcb, 0x9a, 0x18, 0x01, 0x89, 0x41, 0x24, 0x80, 0xa9, 0x9b,
+  0x42, 0x34, 0x45, 0x23, 0xc8, 0xad, 0x9a, 0x22, 0x24, 0x23, 0x01, 0xa8, 0x99, 0xa8, 0xc9, 0xcd,
+  0xcb, 0x09, 0x33, 0x02, 0x10, 0xd1, 0xdf, 0x89, 0x21, 0x02, 0xca, 0x99, 0xa8, 0x59, 0x26, 0x88,
+  0x89, 0xca, 0x38, 0x14, 0x20, 0x24, 0x98, 0x28, 0x11, 0x55, 0x91, 0x0a, 0x23, 0x10, 0x67, 0x03,
+  0xd9, 0x0b, 0x54, 0x12, 0x64, 0x24, 0xa0, 0xbc, 0x8a, 0x98, 0x9a, 0x62, 0x03, 0xba, 0x18, 0x81,
+  0xac, 0xaa, 0x99, 0xcb, 0x0a, 0x35, 0xc0, 0xad, 0xaa, 0x9c, 0x30, 0x24, 0x13, 0xa0, 0xbd, 0xbb,
+  0x0a, 0x22, 0x98, 0x61, 0x12, 0x52, 0x34, 0x12, 0x90, 0xcb, 0x09, 0x11, 0x55, 0x13, 0x98, 0x89,
+  0x88, 0x31, 0x34, 0x34, 0xa0, 0xbd, 0xbb, 0x89, 0xba, 0xbd, 0x89, 0xa9, 0x50, 0x34, 0xa1, 0xbd,
+  0xad, 0xbb, 0xbb, 0x28, 0x25, 0x91, 0xaa, 0x89, 0x00, 0x08, 0x20, 0x75, 0x13, 0x98, 0x10, 0xa8,
+  0x9c, 0x28, 0x64, 0x24, 0x11, 0x01, 0xd9, 0x9c, 0x00, 0x98, 0x29, 0x34, 0x34, 0x01, 0xeb, 0xbc,
+  0x8b, 0x08, 0x21, 0x02, 0xdc, 0x29, 0xb0, 0x8d, 0x34, 0xea, 0x09, 0x81, 0x38, 0x15, 0x89, 0x22,
+  0xeb, 0x40, 0x83, 0x0b, 0x45, 0xa0, 0x1a, 0x45, 0x03, 0xa9, 0x30, 0xa2, 0x7a, 0x77, 0x13, 0x91,
+  0x3e, 0x32, 0x3f, 0x00, 0x99, 0xcb, 0x9c, 0x42, 0x82, 0x98, 0x21, 0x80, 0xba, 0x89, 0xa0, 0xdf,
+  0x8a, 0x22, 0x98, 0x08, 0xc9, 0xcc, 0x99, 0x20, 0x33, 0x01, 0xb9, 0xce, 0xab, 0x0a, 0x10, 0x32,
+  0x11, 0x08, 0x64, 0x33, 0x10, 0x81, 0xb9, 0x0a, 0x54, 0x34, 0x13, 0x99, 0x18, 0x53, 0x45, 0x12,
+  0x80, 0x99, 0x9a, 0x90, 0xd9, 0xbc, 0x8a, 0x31, 0x35, 0x22, 0xb1, 0xcf, 0xab, 0xaa, 0x9c, 0x08,
+  0xb9, 0xac, 0x88, 0x18, 0x11, 0x10, 0x13, 0xfc, 0x8b, 0x12, 0xa9, 0x08, 0xe9, 0x8b, 0x73, 0x44,
+  0x23, 0x90, 0xaa, 0x89, 0x20, 0x63, 0x23, 0x90, 0x88, 0x00, 0x32, 0x83, 0xcb, 0xcc, 0x0b, 0x46,
+  0x90, 0x99, 0xea, 0xab, 0x08, 0x28, 0x26, 0xb8, 0x89, 0xd9, 0x0b, 0x83, 0x9c, 0x62, 0xa1, 0x28,
+  0x24, 0x80, 0xa8, 0x71, 0x26, 0x90, 0x20, 0xb3, 0xbf, 0x48, 0x56, 0x23, 0x22, 0x81, 0xeb, 0xab,
+  0x89, 0x18, 0x32, 0x13, 0x81, 0xab, 0x21, 0xf8, 0xac, 0x88, 0xcb, 0x09, 0x02, 0xc9, 0xbd, 0xab,
+  0x9a, 0x19, 0x45, 0x82, 0xdb, 0xab, 0xbb, 0xab, 0x18, 0x43, 0x12, 0x32, 0x22, 0x42, 0x36, 0xa8,
+  0x1a, 0x23, 0x08, 0x56, 0x02, 0x22, 0x43, 0x53, 0x33, 0x12, 0x22, 0xb0, 0xad, 0x88, 0xcb, 0x0a,
+  0x44, 0x12, 0x10, 0x11, 0xfa, 0xad, 0x98, 0xd9, 0xba, 0xa9, 0xaa, 0x08, 0x08, 0x80, 0xdd, 0xab,
+  0x08, 0xaa, 0x18, 0xea, 0xbc, 0xbb, 0x29, 0x37, 0x32, 0x35, 0x81, 0x09, 0xb8, 0xad, 0x10, 0x19,
+  0x65, 0x82, 0x31, 0x24, 0xaa, 0x50, 0x92, 0x9c, 0x10, 0x01, 0x10, 0x81, 0x99, 0xfb, 0x9d, 0x41,
+  0x13, 0x88, 0x21, 0xfa, 0xac, 0x08, 0x89, 0x11, 0x80, 0x51, 0x13, 0x8a, 0x44, 0xa1, 0x8a, 0x41,
+  0x35, 0xa0, 0x8c, 0x82, 0xbc, 0x75, 0x47, 0x11, 0x00, 0xa9, 0xca, 0xab, 0x30, 0x12, 0x88, 0x11,
+  0x38, 0x1e, 0x34, 0x00, 0x88, 0x19, 0x23, 0xfb, 0xbc, 0x0a, 0x11, 0xb8, 0xdb, 0xdb, 0xbc, 0x9a,
+  0x42, 0x23, 0x98, 0xba, 0xdc, 0xad, 0x9a, 0x08, 0x00, 0x18, 0x43, 0x33, 0x02, 0xa0, 0xcd, 0x8a,
+  0x42, 0x34, 0x33, 0x91, 0xba, 0x30, 0x36, 0x55, 0x33, 0x00, 0x21, 0x81, 0xba, 0xba, 0x9e, 0x10,
+  0x43, 0x37, 0x02, 0x9a, 0x88, 0xcb, 0x09, 0x12, 0xb9, 0xdc, 0xab, 0xa8, 0xbb, 0x0b, 0xb8, 0xad,
+  0x19, 0x11, 0xd9, 0xbf, 0xbb, 0xbc, 0x09, 0x33, 0x23, 0x03, 0xba, 0x8b, 0x89, 0x73, 0x14, 0xaa,
+  0x28, 0x24, 0x21, 0x43, 0x03, 0xac, 0x40, 0x45, 0x54, 0x22, 0x88, 0x89, 0xba, 0x2a, 0x24, 0x21,
+  0x37, 0x92, 0x19, 0x92, 0xbd, 0x99, 0xba, 0x48, 0x82, 0x40, 0x15, 0xcb, 0x0a, 0x22, 0x43, 0x34,
+  0x13, 0xfb, 0x9f, 0x19, 0x32, 0x45, 0x23, 0x80, 0xba, 0xaa, 0x19, 0x31, 0x34, 0x91, 0xdb, 0x89,
+  0x00, 0x11, 0x12, 0xa0, 0xab, 0x63, 0x13, 0x80, 0xfd, 0xbc, 0xaa, 0x09, 0x42, 0x23, 0xa9, 0xce,
+  0xdb, 0xaa, 0x9a, 0x08, 0x00, 0x30, 0x03, 0xdc, 0xab, 0xba, 0x18, 0x43, 0x34, 0x92, 0xbf, 0x0a,
+  0x99, 0x19, 0x46, 0x22, 0x11, 0x22, 0x03, 0xdb, 0xac, 0x09, 0x10, 0x43, 0x34, 0x02, 0xba, 0xbb,
+  0x9c, 0x73, 0x15, 0x88, 0x80, 0xaa, 0xab, 0x99, 0x20, 0x83, 0x09, 0x34, 0xa0, 0x89, 0xeb, 0x9c,
+  0xaa, 0xab, 0x20, 0x33, 0x25, 0x63, 0x04, 0xfb, 0x9e, 0x10, 0x11, 0x22, 0x22, 0x01, 0xcb, 0x49,
+  0x24, 0x98, 0xa9, 0xdc, 0xab, 0x10, 0x45, 0x34, 0x81, 0x99, 0x98, 0xa8, 0xbb, 0x88, 0xb9, 0xac,
+  0x41, 0x47, 0x90, 0xbc, 0x89, 0xa9, 0x40, 0x25, 0x00, 0x90, 0x99, 0x80, 0xdc, 0x9b, 0x11, 0x20,
+  0x64, 0x13, 0xa0, 0xdb, 0x89, 0x43, 0x34, 0x22, 0x81, 0xea, 0xab, 0x20, 0x11, 0x21, 0x04, 0x98,
+  0x4c, 0x02, 0x20, 0x00, 0x32, 0x42, 0x04, 0xea, 0x09, 0x11, 0x31, 0x27, 0xb8, 0xad, 0x09, 0x10,
+  0x22, 0x00, 0x90, 0x08, 0x52, 0x34, 0xb2, 0xbf, 0x18, 0x23, 0x41, 0x23, 0xea, 0x9b, 0x88, 0x30,
+  0x24, 0x99, 0x20, 0x91, 0x50, 0x16, 0xb9, 0xae, 0xbb, 0x99, 0x18, 0x53, 0x82, 0xfb, 0xbb, 0x9b,
+  0x18, 0x30, 0x33, 0xb8, 0xbe, 0xdc, 0xbc, 0x99, 0x99, 0x31, 0x14, 0x00, 0xb8, 0xcf, 0x9a, 0x80,
+  0x11, 0x00, 0x08, 0x01, 0xc9, 0xaa, 0xca, 0xac, 0x9a, 0x31, 0x34, 0x24, 0xa0, 0xbc, 0x98, 0xcc,
+  0x18, 0x81, 0x99, 0xa8, 0x19, 0x02, 0x8d, 0x76, 0x02, 0x00, 0x11, 0x90, 0x89, 0x20, 0x43, 0x32,
+  0x44, 0x23, 0x53, 0x24, 0x21, 0x92, 0xcc, 0x18, 0x34, 0x45, 0x22, 0x80, 0x11, 0xa9, 0x38, 0x26,
+  0x12, 0x32, 0x13, 0x32, 0x33, 0x23, 0x20, 0x77, 0x43, 0x33, 0x01, 0x08, 0xa9, 0x0c, 0x65, 0x43,
+  0x42, 0x12, 0x80, 0x08, 0x00, 0x42, 0x35, 0x23, 0x33, 0x12, 0x00, 0x41, 0x33, 0x33, 0x44, 0x22,
+  0x21, 0x22, 0x81, 0xdb, 0xbc, 0xad, 0x18, 0x43, 0x23, 0xb8, 0xdf, 0xbc, 0xac, 0xaa, 0xaa, 0x98,
+  0xca, 0xbc, 0xcc, 0xbb, 0xac, 0xaa, 0x99, 0x99, 0xaa, 0xdd, 0xbb, 0xad, 0xaa, 0x89, 0x09, 0x88,
+  0xa9, 0xbb, 0xbb, 0xae, 0x9a, 0xaa, 0xdb, 0xba, 0xbc, 0xbc, 0xbc, 0xab, 0xaa, 0x9a, 0x90, 0xeb,
+  0xbc, 0xcd, 0xac, 0xaa, 0x9a, 0x09, 0x08, 0x98, 0x89, 0x88, 0x89, 0x18, 0x22, 0x33, 0x12, 0x46,
+  0x34, 0x54, 0x44, 0x33, 0x34, 0x23, 0x43, 0x22, 0x22, 0x34, 0x32, 0x53, 0x32, 0x34, 0x53, 0x32,
+  0x24, 0x23, 0x32, 0x24, 0x01, 0x08, 0x01, 0x10, 0x65, 0x44, 0x43, 0x22, 0x12, 0x01, 0x08, 0x63,
+  0x33, 0x34, 0x43, 0x23, 0x43, 0x33, 0x44, 0x24, 0x32, 0x34, 0x33, 0x53, 0x22, 0x11, 0x11, 0x31,
+  0x5d, 0x03, 0x0d, 0x00, 0x46, 0x53, 0x24, 0x13, 0x00, 0x98, 0xa9, 0x18, 0x73, 0x43, 0x24, 0x11,
+  0x00, 0x99, 0x9a, 0x28, 0x33, 0x35, 0x43, 0x01, 0xb9, 0xaa, 0x89, 0x28, 0x54, 0x12, 0xba, 0xce,
+  0xbc, 0xbc, 0xaa, 0xaa, 0xb9, 0xbc, 0xbd, 0xbd, 0xbd, 0xbb, 0xcb, 0xaa, 0xba, 0xcb, 0xbc, 0xcc,
+  0xbb, 0xcb, 0xba, 0xba, 0xcb, 0xbc, 0xbb, 0xbb, 0xbb, 0xcb, 0xcb, 0xcc, 0xbb, 0xbc, 0xbb, 0xac,
+  0xbb, 0xbb, 0xab, 0xab, 0xdb, 0xcc, 0xcb, 0xbb, 0xbb, 0x9a, 0x98, 0xcb, 0xbd, 0xbd, 0xab, 0x8a,
+  0x00, 0x90, 0xca, 0xbb, 0xac, 0x09, 0x41, 0x34, 0x33, 0x34, 0x24, 0x11, 0x32, 0x63, 0x53, 0x34,
+  0x36, 0x33, 0x33, 0x34, 0x32, 0x21, 0x32, 0x43, 0x53, 0x44, 0x34, 0x33, 0x43, 0x12, 0x00, 0x80,
+  0x10, 0x32, 0x45, 0x43, 0x23, 0x12, 0x11, 0x21, 0x32, 0x46, 0x44, 0x33, 0x33, 0x33, 0x13, 0x11,
+  0x52, 0x45, 0x44, 0x44, 0x32, 0x22, 0x12, 0x01, 0x11, 0x53, 0x34, 0x24, 0x23, 0x13, 0x12, 0x22,
+  0x53, 0x43, 0x33, 0x32, 0x12, 0x80, 0x89, 0x10, 0x51, 0x44, 0x35, 0x34, 0x33, 0x13, 0x90, 0xba,
+  0x9c, 0x19, 0x73, 0x53, 0x22, 0x01, 0x99, 0xaa, 0xaa, 0xaa, 0x99, 0xb9, 0xeb, 0xdb, 0xcc, 0xbc,
+  0xbd, 0xcb, 0xaa, 0xbb, 0xbc, 0xbd, 0xbd, 0xbc, 0xcb, 0xab, 0xbb, 0xbb, 0xcb, 0xbc, 0xdb, 0xbb,
+  0xbc, 0xcb, 0xba, 0xab, 0xab, 0xab, 0xbb, 0xbc, 0xbd, 0xac, 0xcb, 0xaa, 0xaa, 0xbb, 0xbc, 0xbb,
+  0xbb, 0xab, 0xba, 0xbd, 0xcc, 0xbb, 0xbc, 0xba, 0x99, 0x09, 0x10, 0x80, 0xa9, 0xdb, 0x09, 0x52,
+  0x54, 0x34, 0x24, 0x13, 0x01, 0x80, 0x08, 0x52, 0x54, 0x44, 0x23, 0x33, 0x23, 0x21, 0x22, 0x53,
+  0x34, 0x43, 0x33, 0x43, 0x33, 0x24, 0x23, 0x34, 0x53, 0x42, 0x32, 0x34, 0x33, 0x33, 0x33, 0x32,
+  0x22, 0xff, 0x05, 0x00, 0x54, 0x53, 0x43, 0x33, 0x24, 0x33, 0x25, 0x33, 0x24, 0x33, 0x24, 0x43,
+  0x33, 0x34, 0x53, 0x33, 0x33, 0x44, 0x22, 0x32, 0x33, 0x33, 0x34, 0x25, 0x32, 0x43, 0x22, 0x33,
+  0x35, 0x33, 0x34, 0x23, 0x22, 0x32, 0x43, 0x43, 0x44, 0x34, 0x43, 0x33, 0x24, 0x32, 0x22, 0x81,
+  0x10, 0x01, 0x19, 0x93, 0xeb, 0xba, 0xde, 0xbb, 0xbb, 0xcb, 0xab, 0xcb, 0xbc, 0xcd, 0xcb, 0xca,
+  0xcb, 0xab, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xab, 0xbb,
+  0xbb, 0xac, 0xab, 0xba, 0xdb, 0xab, 0xba, 0xac, 0x08, 0xb9, 0xab, 0xb9, 0xbd, 0x89, 0xa9, 0xba,
+  0x9a, 0x19, 0xb9, 0xac, 0xb8, 0xdb, 0x8a, 0x10, 0x12, 0x11, 0x33, 0x33, 0x36, 0x92, 0x08, 0x22,
+  0x30, 0x57, 0x23, 0x90, 0x00, 0x99, 0x10, 0x34, 0x34, 0x13, 0x52, 0x37, 0x13, 0x32, 0x24, 0x32,
+  0x45, 0x22, 0x32, 0x25, 0x32, 0x44, 0x32, 0x33, 0x34, 0x32, 0x36, 0x34, 0x13, 0x23, 0x33, 0x42,
+  0x45, 0x13, 0x22, 0x34, 0x12, 0x33, 0x24, 0x32, 0x36, 0x22, 0x32, 0x34, 0x22, 0x52, 0x33, 0x32,
+  0x43, 0x21, 0x32, 0x33, 0x33, 0x91, 0x40, 0x36, 0x02, 0x52, 0x34, 0x81, 0x99, 0x11, 0x11, 0x51,
+  0x13, 0x0a, 0x03, 0xbd, 0x42, 0x02, 0x20, 0xf0, 0x9d, 0x08, 0xab, 0x11, 0xb9, 0x39, 0xf9, 0x9f,
+  0x80, 0xba, 0x99, 0xca, 0xab, 0xb8, 0xbe, 0xcc, 0x9a, 0xcb, 0xbc, 0x9a, 0xdb, 0xad, 0x9a, 0x98,
+  0xaa, 0x9b, 0x88, 0x99, 0x89, 0x98, 0xcb, 0xad, 0x09, 0xe9, 0xab, 0x01, 0x9a, 0x91, 0xff, 0x1b,
+  0x02, 0xab, 0x00, 0xdc, 0x8a, 0xb8, 0xab, 0xba, 0x1c, 0x24, 0xbb, 0x77, 0x26, 0x12, 0x00, 0x20,
+  0x45, 0x91, 0xdd, 0xbd, 0xad, 0xab, 0xaa, 0x89, 0x32, 0x26, 0x12, 0x11, 0x81, 0x89, 0x32, 0x24,
+  0x78, 0xfd, 0x1d, 0x00, 0xa8, 0xac, 0x09, 0x88, 0x28, 0x45, 0x34, 0x81, 0xaa, 0x89, 0xca, 0x8a,
+  0x38, 0x77, 0x24, 0x13, 0x22, 0x12, 0x81, 0xa9, 0xba, 0xaa, 0xfb, 0xae, 0x8a, 0xa9, 0x18, 0x33,
+  0x52, 0x35, 0x91, 0x99, 0xc8, 0xbc, 0x9a, 0x18, 0x35, 0x13, 0x00, 0x44, 0x82, 0x09, 0x81, 0xcf,
+  0x19, 0x82, 0x8a, 0x44, 0x81, 0x00, 0xc9, 0x69, 0x15, 0x99, 0x09, 0xea, 0x8b, 0x10, 0x20, 0x45,
+  0x11, 0x20, 0x91, 0xcc, 0x0a, 0x88, 0x20, 0x33, 0xa8, 0x40, 0x35, 0x44, 0x83, 0xec, 0x9a, 0xc9,
+  0xac, 0x10, 0x00, 0x72, 0x14, 0xa0, 0x89, 0x80, 0xba, 0xac, 0x89, 0x31, 0x34, 0xb0, 0xae, 0x30,
+  0x12, 0x08, 0xa8, 0x2a, 0xa2, 0xef, 0x09, 0xeb, 0x0a, 0x43, 0x21, 0x63, 0x91, 0xdc, 0x9b, 0x90,
+  0x10, 0x34, 0x91, 0x38, 0x26, 0xa8, 0xb9, 0x8c, 0x53, 0xe0, 0xab, 0x20, 0x21, 0x82, 0xbb, 0x74,
+  0x82, 0x9b, 0x22, 0xa8, 0x9a, 0x30, 0x25, 0xb8, 0x8c, 0x52, 0x81, 0xbb, 0xbd, 0x9c, 0x62, 0x24,
+  0x90, 0x98, 0x88, 0xea, 0xbc, 0x28, 0x35, 0x81, 0x19, 0x23, 0xb8, 0x1a, 0x93, 0xbe, 0x19, 0x01,
+  0xb8, 0x8b, 0x57, 0xa1, 0x8c, 0x32, 0xb0, 0xdc, 0x8b, 0x74, 0x82, 0xaa, 0x31, 0xa1, 0x9b, 0x53,
+  0x02, 0xb9, 0xcd, 0x8a, 0x43, 0x13, 0x11, 0x14, 0xfa, 0x8b, 0x91, 0xcb, 0x71, 0x13, 0x9a, 0x28,
+  0x02, 0xeb, 0x1b, 0x44, 0xa0, 0x8a, 0x01, 0xab, 0x29, 0x22, 0x82, 0x9a, 0x72, 0x92, 0xbc, 0x0a,
+  0x22, 0xa0, 0x9b, 0x56, 0x93, 0xdd, 0x18, 0x13, 0xaa, 0x00, 0xcb, 0x72, 0x06, 0xa9, 0x88, 0xb8,
+  0x19, 0x01, 0x28, 0x27, 0xa8, 0x8a, 0xa0, 0x0a, 0x33, 0xd9, 0x3a, 0x16, 0x99, 0x10, 0xca, 0x3a,
+  0x16, 0xb9, 0x89, 0x81, 0xa9, 0x28, 0x34, 0xa8, 0x48, 0xd2, 0x9e, 0x42, 0x02, 0xba, 0xbc, 0x61,
+  0xe3, 0x02, 0x33, 0x00, 0xb0, 0x1a, 0x14, 0xa9, 0x00, 0xc8, 0xac, 0x28, 0x44, 0x91, 0x10, 0x80,
+  0x8a, 0xa0, 0x9e, 0x63, 0xc8, 0x1b, 0x15, 0xb8, 0x38, 0x93, 0xab, 0x25, 0xf9, 0x8a, 0x13, 0x80,
+  0x21, 0x98, 0x19, 0x12, 0xec, 0xab, 0x30, 0x81, 0x72, 0x84, 0xbb, 0x20, 0xc9, 0x48, 0x03, 0x9b,
+  0x13, 0xdb, 0x19, 0xa0, 0x50, 0x93, 0xbd, 0x30, 0x34, 0x91, 0xce, 0x9a, 0x51, 0x13, 0x88, 0x89,
+  0xaa, 0x09, 0x90, 0x29, 0x83, 0x2a, 0x47, 0x01, 0x22, 0xfb, 0x9b, 0x99, 0x61, 0x04, 0xbb, 0x09,
+  0x32, 0x04, 0xca, 0x49, 0x93, 0xbd, 0x40, 0x02, 0x00, 0x11, 0xc9, 0xac, 0x20, 0x11, 0x91, 0xac,
+  0x71, 0x91, 0x0b, 0x26, 0xb9, 0x49, 0x82, 0xab, 0xb9, 0x9e, 0x72, 0x03, 0x9a, 0x10, 0xb0, 0x9f,
+  0x32, 0x80, 0x38, 0xd2, 0x8d, 0x33, 0xb9, 0x60, 0xb2, 0x9e, 0x11, 0x80, 0x01, 0x90, 0x21, 0xc0,
+  0x0b, 0x26, 0xa9, 0x99, 0x8a, 0x43, 0xe8, 0x59, 0x04, 0xbc, 0x41, 0xa0, 0x0b, 0x03, 0xab, 0x54,
+  0xa0, 0x39, 0x03, 0xad, 0x20, 0xb8, 0x1b, 0x12, 0xbd, 0x70, 0x82, 0x9b, 0x42, 0xa1, 0x9c, 0x11,
+  0x99, 0x30, 0x93, 0x9c, 0x31, 0xa0, 0x49, 0xb3, 0xbf, 0x22, 0xd8, 0x0a, 0x43, 0x83, 0xbf, 0x60,
+  0x03, 0x9b, 0x10, 0xda, 0x39, 0x03, 0x9a, 0x00, 0x00, 0x00, 0x55, 0xb1, 0xad, 0x80, 0xad, 0x40,
+  0x82, 0x41, 0xa2, 0x0c, 0x82, 0xbd, 0x21, 0x90, 0x62, 0xa0, 0x4a, 0x94, 0x9f, 0x21, 0xb8, 0x1a,
+  0x03, 0x8a, 0x45, 0xa1, 0x9b, 0x12, 0xea, 0x1a, 0x34, 0xb8, 0x29, 0x13, 0xeb, 0x09, 0x01, 0x10,
+  0x21, 0xc0, 0x8c, 0x03, 0xdc, 0x50, 0x84, 0x8a, 0x01, 0x98, 0x20, 0xf8, 0x2a, 0x23, 0xb9, 0x28,
+  0x80, 0xa9, 0x0a, 0x35, 0xb9, 0x48, 0x84, 0x41, 0xc2, 0x8f, 0x22, 0xe9, 0x09, 0x22, 0x91, 0xac,
+  0x8d, 0xfe, 0x2b, 0x00, 0x25, 0xb8, 0x0b, 0x08, 0x20, 0xe0, 0x1b, 0x37, 0xa8, 0x19, 0x02, 0xca,
+  0x9b, 0x43, 0xa2, 0x9b, 0x10, 0x89, 0xe9, 0x3b, 0x77, 0xa0, 0x89, 0x81, 0x89, 0x88, 0x20, 0x03,
+  0xac, 0x54, 0xb8, 0x0c, 0x13, 0xaa, 0x41, 0xa1, 0xad, 0x11, 0x22, 0x33, 0x91, 0xbc, 0xcc, 0x2a,
+  0x26, 0xa8, 0x20, 0xf9, 0x0a, 0x02, 0x41, 0x85, 0xbc, 0x38, 0x92, 0x09, 0x98, 0x48, 0x85, 0xbc,
+  0x41, 0xa0, 0x1a, 0x03, 0xab, 0x35, 0xf9, 0x29, 0x05, 0xcb, 0x41, 0x91, 0x8c, 0x23, 0xc8, 0x1a,
+  0x02, 0x9a, 0x44, 0xca, 0x4a, 0x84, 0x9b, 0x31, 0xca, 0x40, 0xa1, 0x0b, 0x14, 0xaa, 0x20, 0xda,
+  0x1a, 0x24, 0x82, 0xca, 0x28, 0xa3, 0x0c, 0x45, 0xa0, 0xbb, 0xab, 0x52, 0x83, 0x8a, 0x25, 0xc9,
+  0x0a, 0x12, 0x20, 0x04, 0xdc, 0x48, 0xa2, 0xae, 0x41, 0x92, 0x0a, 0x03, 0xcb, 0x30, 0xc0, 0x19,
+  0x13, 0x00, 0xea, 0x1b, 0x16, 0xbb, 0x72, 0xb2, 0x8b, 0x23, 0xb8, 0x9a, 0x49, 0x17, 0xda, 0x39,
+  0x83, 0x8a, 0x12, 0xcb, 0x31, 0xc0, 0x1a, 0x15, 0xb9, 0x99, 0x21, 0x13, 0xac, 0x52, 0xc8, 0x79,
+  0x14, 0xcb, 0x89, 0x00, 0x88, 0x88, 0x32, 0xc1, 0x5a, 0x85, 0x9c, 0x34, 0xe8, 0x1a, 0x01, 0x19,
+  0x03, 0xac, 0x30, 0xc0, 0x29, 0x92, 0x1a, 0x94, 0x8c, 0x24, 0xd9, 0x40, 0x93, 0xbc, 0x28, 0x13,
+  0xca, 0x39, 0x06, 0xca, 0x28, 0x92, 0x0a, 0x02, 0x9a, 0x61, 0x82, 0xca, 0x0a, 0x22, 0xfb, 0x29,
+  0x16, 0xa9, 0x1a, 0x32, 0xd9, 0x3a, 0x07, 0xcb, 0x50, 0x92, 0x8b, 0x13, 0xcd, 0x20, 0x03, 0x8a,
+  0x32, 0xc0, 0xbd, 0x51, 0x83, 0x9b, 0x23, 0xd9, 0x29, 0xa1, 0x0c, 0x33, 0x99, 0x18, 0xa0, 0xa9,
+  0x19, 0x14, 0xdd, 0x60, 0x04, 0xaa, 0x00, 0xa9, 0x40, 0xb1, 0x2b, 0x05, 0xac, 0x51, 0xa0, 0x3a,
+  0x09, 0x02, 0x29, 0x00, 0xf9, 0x1a, 0x13, 0x99, 0x00, 0x89, 0x12, 0xab, 0x72, 0xb8, 0x69, 0x83,
+  0x8c, 0x12, 0xdb, 0x10, 0xc9, 0x50, 0xa2, 0x8c, 0x34, 0xc8, 0x19, 0x12, 0x99, 0x98, 0x89, 0x90,
+  0x88, 0x75, 0x82, 0xbd, 0x38, 0xa3, 0x8c, 0x33, 0x90, 0x10, 0xeb, 0x38, 0x94, 0xad, 0x31, 0x81,
+  0x99, 0x30, 0x82, 0x8b, 0x35, 0xfa, 0x28, 0xa1, 0x0e, 0x34, 0xda, 0x2a, 0x24, 0xda, 0x19, 0x33,
+  0xc9, 0x0a, 0x33, 0xc8, 0x1a, 0x12, 0x99, 0x41, 0xd1, 0x9c, 0x34, 0xd8, 0x3a, 0x05, 0xcb, 0x40,
+  0x91, 0x09, 0x81, 0x89, 0xa1, 0x1b, 0x27, 0xa9, 0x10, 0xe9, 0x40, 0xc0, 0x0d, 0x15, 0xa8, 0x28,
+  0x90, 0x19, 0x82, 0x9c, 0x01, 0x98, 0x51, 0x91, 0x8a, 0x12, 0xca, 0x8b, 0x21, 0xa9, 0x58, 0x02,
+  0x09, 0x53, 0xb1, 0x9f, 0x30, 0x93, 0x0b, 0x13, 0x9a, 0xa1, 0xff, 0x39, 0x03, 0x8b, 0x34, 0xc9,
+  0x58, 0x03, 0xac, 0x28, 0x82, 0x9b, 0x22, 0xfa, 0x29, 0x17, 0xca, 0x2a, 0x23, 0xca, 0x39, 0x06,
+  0xba, 0x20, 0x91, 0x1a, 0x13, 0xcd, 0x38, 0xb2, 0x4b, 0x26, 0xbb, 0x38, 0xe1, 0x0a, 0x13, 0x9a,
+  0x25, 0xca, 0x30, 0xa2, 0x0c, 0x91, 0x1c, 0x17, 0xd9, 0x19, 0x03, 0xa8, 0x09, 0x31, 0xa1, 0x3a,
+  0x84, 0xbd, 0x32, 0xc9, 0x2a, 0x15, 0x01, 0xd8, 0x0a, 0x83, 0xaf, 0x72, 0xa1, 0x0b, 0x14, 0xa9,
+  0x30, 0xda, 0x49, 0x93, 0x9c, 0x24, 0xa8, 0x8a, 0x9a, 0x73, 0xc1, 0x0a, 0x15, 0x98, 0x00, 0xba,
+  0x50, 0xa1, 0x9c, 0x32, 0x92, 0xac, 0x62, 0x92, 0xad, 0x32, 0xd0, 0x1a, 0x24, 0xba, 0x29, 0x84,
+  0x8a, 0x22, 0xe9, 0x1a, 0x13, 0xaa, 0x29, 0x35, 0xe0, 0x0c, 0x34, 0xda, 0x29, 0x92, 0x1a, 0x05,
+  0xac, 0x41, 0x91, 0x0a, 0x90, 0x30, 0xc3, 0x9e, 0x32, 0xb8, 0x38, 0xa3, 0x9e, 0x42, 0xa1, 0x9a,
+  0xf0, 0xff, 0x2b, 0x00, 0x82, 0xac, 0x73, 0xd0, 0x2a, 0x15, 0xcb, 0x38, 0x93, 0x9c, 0x21, 0x88,
+  0x20, 0xb0, 0x1a, 0x04, 0x9a, 0x31, 0x91, 0x88, 0x08, 0xb9, 0xbe, 0x28, 0x13, 0x53, 0xe8, 0x3a,
+  0x86, 0xac, 0x42, 0xe9, 0x38, 0x05, 0xac, 0x10, 0x01, 0x08, 0x98, 0x08, 0x00, 0x42, 0xf0, 0x8b,
+  0x15, 0xca, 0x41, 0x92, 0x8b, 0x01, 0x88, 0xa8, 0x3c, 0x27, 0xdb, 0x48, 0xa2, 0x8a, 0x02, 0x98,
+  0x80, 0x88, 0x23, 0xca, 0x52, 0xb1, 0x0b, 0x91, 0x4a, 0x94, 0x8d, 0x12, 0xab, 0x62, 0xc8, 0x39,
+  0x85, 0xab, 0x30, 0x81, 0x89, 0x11, 0xda, 0x50, 0xb2, 0x8f, 0x25, 0xea, 0x38, 0x93, 0xad, 0x52,
+  0x90, 0x1a, 0x82, 0xba, 0x32, 0xc0, 0x2b, 0x15, 0xb9, 0x89, 0x10, 0x02, 0xaa, 0x73, 0xc8, 0x3b,
+  0x07, 0xab, 0x52, 0xd8, 0x19, 0x03, 0x9d, 0x42, 0xb0, 0x3a, 0x84, 0x9c, 0x32, 0xdb, 0x48, 0xa3,
+  0x9d, 0x34, 0xb8, 0x0b, 0x23, 0xa9, 0x18, 0x82, 0x99, 0x20, 0x01, 0x99, 0x30, 0xf8, 0x8d, 0x43,
+  0xd8, 0x29, 0x06, 0xac, 0x30, 0xa1, 0x2a, 0x16, 0xbc, 0x58, 0x81, 0x8c, 0x41, 0xa8, 0x1b, 0x13,
+  0xba, 0x30, 0xa0, 0x68, 0x92, 0x9e, 0x23, 0xda, 0x48, 0x93, 0x9c, 0x23, 0xea, 0x48, 0x92, 0x9b,
+  0x43, 0xc8, 0x1a, 0x23, 0xa9, 0x20, 0xa1, 0x9b, 0x21, 0xc9, 0x28, 0x93, 0x9c, 0x62, 0x82, 0xbc,
+  0x30, 0xa2, 0x8d, 0x34, 0xc9, 0x49, 0x83, 0xae, 0x41, 0xb1, 0x8c, 0x34, 0xd9, 0x19, 0x04, 0x9a,
+  0x32, 0xda, 0x58, 0x91, 0x0c, 0x02, 0x9c, 0x32, 0xb8, 0x61, 0xc1, 0x1b, 0x05, 0xcb, 0x41, 0xb2,
+  0x9b, 0x43, 0xa8, 0x89, 0x23, 0xc8, 0x3a, 0x05, 0xad, 0x40, 0xa1, 0x0c, 0x33, 0xd9, 0x18, 0x81,
+  0x28, 0x04, 0xbc, 0x30, 0xc0, 0x8c, 0x53, 0x91, 0x8b, 0x31, 0xc0, 0x0c, 0x24, 0xbb, 0x51, 0xc1,
+  0x40, 0xfd, 0x32, 0x00, 0x42, 0xd0, 0x1b, 0x15, 0xaa, 0x31, 0xc1, 0x0a, 0x03, 0xab, 0x31, 0x92,
+  0x19, 0x91, 0x9b, 0x54, 0xe0, 0x8b, 0x26, 0xd9, 0x3a, 0x05, 0xac, 0x41, 0xb1, 0x1a, 0x13, 0xac,
+  0x21, 0xa1, 0x08, 0x90, 0x38, 0xb3, 0x8f, 0x23, 0xca, 0x38, 0xa1, 0x39, 0x86, 0x9b, 0x02, 0xbd,
+  0x54, 0xc1, 0x1b, 0x14, 0xcb, 0x51, 0xa1, 0x8b, 0x23, 0xa8, 0x8a, 0x80, 0x31, 0x83, 0xa8, 0xba,
+  0x60, 0xb2, 0x9f, 0x43, 0xd9, 0x1a, 0x15, 0xa8, 0x0a, 0x34, 0xc0, 0x0b, 0x02, 0x1a, 0x14, 0xce,
+  0x50, 0xa2, 0x9d, 0x33, 0xb1, 0x0b, 0x83, 0x09, 0x23, 0xcd, 0x40, 0xb1, 0x8e, 0x34, 0xb0, 0x1b,
+  0x13, 0xba, 0x30, 0xa2, 0x0c, 0x25, 0xec, 0x28, 0x83, 0x9c, 0x53, 0xc8, 0x1a, 0x05, 0xba, 0x38,
+  0x93, 0x8a, 0x12, 0x88, 0x01, 0xcd, 0x70, 0xa1, 0xab, 0x43, 0xa0, 0x28, 0xa1, 0xab, 0x21, 0x01,
+  0x99, 0x61, 0x91, 0x0c, 0x13, 0xae, 0x53, 0xd8, 0x0a, 0x14, 0xa9, 0x10, 0x13, 0xb8, 0x9c, 0x43,
+  0x91, 0x9a, 0x89, 0x32, 0xf9, 0x2b, 0x27, 0xc9, 0x09, 0x02, 0xa9, 0x28, 0x26, 0xc8, 0x2a, 0x06,
+  0xca, 0x38, 0xa0, 0x0b, 0x13, 0xcb, 0x51, 0x04, 0xca, 0x19, 0x24, 0xd9, 0x0b, 0x24, 0xa9, 0x10,
+  0x91, 0x8a, 0x12, 0x99, 0x10, 0x99, 0x54, 0xda, 0x78, 0xa2, 0x8d, 0x33, 0xdb, 0x38, 0x92, 0x0a,
+  0x82, 0x9b, 0x26, 0xc9, 0x48, 0xa1, 0x9c, 0x22, 0x81, 0xa9, 0x28, 0x25, 0xb9, 0x28, 0xc1, 0x9c,
+  0x43, 0xd9, 0x48, 0x84, 0xbb, 0x41, 0xe8, 0x1a, 0x24, 0x98, 0x18, 0x81, 0x99, 0x09, 0x00, 0xcb,
+  0x41, 0xf8, 0x2b, 0x16, 0x99, 0x20, 0xb0, 0x1b, 0x12, 0x8a, 0x21, 0x10, 0xe9, 0x3b, 0x07, 0xbc,
+  0x43, 0xe8, 0x49, 0x84, 0xac, 0x32, 0xb0, 0x39, 0xb2, 0x0c, 0x14, 0xca, 0x38, 0x92, 0x9a, 0x11,
+  0x0d, 0x00, 0x27, 0x00, 0x89, 0x42, 0xb2, 0x9f, 0x43, 0xc0, 0x8d, 0x43, 0xb8, 0x3b, 0x05, 0xab,
+  0x42, 0xc8, 0x39, 0xc2, 0x1d, 0x25, 0xc9, 0x08, 0x81, 0x18, 0xa0, 0x29, 0x84, 0xac, 0x31, 0x98,
+  0x20, 0xc9, 0x60, 0x92, 0x9c, 0x33, 0xc9, 0x0a, 0x90, 0x30, 0x03, 0xac, 0x63, 0xb0, 0x0b, 0xa2,
+  0x1e, 0x16, 0xdb, 0x61, 0xa1, 0x0c, 0x22, 0xaa, 0x28, 0x91, 0x08, 0xb0, 0x39, 0xa3, 0x0d, 0x16,
+  0xab, 0x41, 0xb8, 0x39, 0x92, 0x48, 0xa4, 0xbf, 0x63, 0xa0, 0x0a, 0x03, 0xbc, 0x40, 0x82, 0x0b,
+  0x23, 0xd9, 0x0a, 0x12, 0x88, 0x18, 0x02, 0xdc, 0x38, 0xd2, 0x0c, 0x27, 0xb8, 0x19, 0x02, 0x9a,
+  0x98, 0x1a, 0x16, 0xc9, 0x28, 0x82, 0xab, 0x62, 0xa1, 0x0c, 0x34, 0xd9, 0x28, 0xa2, 0x8c, 0x11,
+  0x9a, 0x33, 0xc9, 0x74, 0xd1, 0x0b, 0x14, 0xab, 0x51, 0xa1, 0x0b, 0x13, 0x9a, 0x11, 0xa9, 0x48,
+  0xa1, 0xaf, 0x40, 0x03, 0xcb, 0x41, 0xc0, 0x29, 0x06, 0xbb, 0x21, 0xb8, 0x3a, 0x86, 0x9b, 0x43,
+  0xc0, 0x0a, 0x23, 0xc9, 0x19, 0x13, 0xaa, 0x43, 0xc8, 0x2b, 0x94, 0xae, 0x52, 0xa0, 0x49, 0x83,
+  0xae, 0x31, 0xa1, 0x0b, 0x23, 0xa9, 0x8a, 0x30, 0xa3, 0xaf, 0x54, 0xb1, 0x9b, 0x31, 0xb0, 0x0c,
+  0x25, 0xda, 0x48, 0x85, 0xac, 0x41, 0x91, 0x89, 0x00, 0x99, 0x9a, 0x62, 0xb1, 0x1d, 0x16, 0xcb,
+  0x30, 0x92, 0x1b, 0x93, 0xad, 0x42, 0xa0, 0x08, 0x91, 0x18, 0xc8, 0x48, 0x85, 0x9c, 0x02, 0xbb,
+  0x63, 0x91, 0x1a, 0x84, 0xaa, 0x21, 0xa9, 0x0a, 0x13, 0xb0, 0x8c, 0x83, 0xbf, 0x62, 0x92, 0x29,
+  0xa3, 0x9d, 0x43, 0xc8, 0x09, 0x00, 0x00, 0xb8, 0x71, 0xd3, 0x8d, 0x25, 0xc9, 0x29, 0x83, 0x9b,
+  0x31, 0x80, 0x98, 0x89, 0x22, 0xd9, 0x38, 0xd1, 0x2c, 0x07, 0xba, 0x41, 0xa1, 0x8c, 0x21, 0x12,
+  0x58, 0x01, 0x2a, 0x00, 0xad, 0x40, 0x92, 0x0b, 0x22, 0x88, 0x80, 0xac, 0x30, 0xa0, 0x49, 0x04,
+  0xdb, 0x8b, 0x64, 0xa1, 0x9c, 0x20, 0x12, 0xd9, 0x2b, 0x37, 0xb9, 0x2a, 0xb2, 0x1b, 0x04, 0x9c,
+  0x44, 0xb8, 0x9c, 0x43, 0xa2, 0xbf, 0x72, 0xa1, 0x8b, 0x23, 0xa9, 0x30, 0xb8, 0x39, 0xc1, 0x1c,
+  0x17, 0xc9, 0x28, 0x82, 0xa9, 0x80, 0x01, 0x00, 0x21, 0xc0, 0x1b, 0x96, 0xae, 0x72, 0xa0, 0x0c,
+  0x23, 0xba, 0x40, 0x92, 0x1b, 0xa1, 0x8c, 0x43, 0xb8, 0x28, 0xb8, 0x38, 0xa4, 0x0e, 0x34, 0xc9,
+  0x29, 0x12, 0xb9, 0x8b, 0x54, 0xd8, 0x1a, 0x04, 0xaa, 0x38, 0xa0, 0x38, 0x84, 0xab, 0x18, 0x11,
+  0x12, 0xfb, 0x49, 0x17, 0xdb, 0x49, 0x94, 0xac, 0x43, 0xc8, 0x3a, 0x83, 0x9c, 0x33, 0xb9, 0x20,
+  0xa8, 0x39, 0xc1, 0x3a, 0x96, 0x9b, 0x24, 0x89, 0x32, 0xfc, 0x38, 0xb2, 0x9d, 0x43, 0x98, 0x88,
+  0x11, 0x90, 0x9d, 0x42, 0xb8, 0x3a, 0x06, 0xaa, 0x18, 0x81, 0x9a, 0x30, 0x05, 0x9b, 0x00, 0xbb,
+  0x65, 0xd8, 0x3a, 0x06, 0xbb, 0x30, 0x92, 0x9b, 0x21, 0x81, 0x9a, 0x43, 0x91, 0x38, 0xc1, 0x1d,
+  0x84, 0xbd, 0x10, 0x98, 0x54, 0xb0, 0x0c, 0x23, 0x90, 0x98, 0x49, 0x85, 0xbe, 0x42, 0xc1, 0x1a,
+  0x81, 0x19, 0x03, 0x8d, 0x14, 0xcc, 0x51, 0xb1, 0x0b, 0x05, 0x9a, 0x41, 0xa1, 0x9a, 0x10, 0x80,
+  0xbb, 0x73, 0xb3, 0x0b, 0x83, 0x9f, 0x34, 0xd9, 0x38, 0xa2, 0x8d, 0x23, 0xa9, 0x21, 0xc0, 0x29,
+  0x82, 0x8a, 0x98, 0x58, 0x92, 0x8a, 0x92, 0x9e, 0x13, 0xbb, 0x74, 0xb0, 0x18, 0xe8, 0x4a, 0x06,
+  0x9c, 0x41, 0xa8, 0x19, 0x92, 0xab, 0x32, 0x81, 0x10, 0x88, 0x00, 0xc8, 0x19, 0xc2, 0x9e, 0x22,
+  0x00, 0x32, 0xc8, 0x39, 0xd2, 0x8d, 0x34, 0xb0, 0x1b, 0x14, 0xca, 0x1b, 0x05, 0xba, 0x61, 0xa2,
+  0x0b, 0xff, 0x29, 0x00, 0x58, 0xa3, 0xbe, 0x50, 0x83, 0xbb, 0x52, 0xb0, 0x2b, 0x15, 0xac, 0x30,
+  0xa0, 0x19, 0x90, 0x09, 0x24, 0x80, 0xb9, 0x39, 0x94, 0x8d, 0x13, 0xac, 0x47, 0xd9, 0x1a, 0x04,
+  0xba, 0x40, 0x02, 0xbb, 0x30, 0xb2, 0x0d, 0x24, 0xba, 0x60, 0xa1, 0x0a, 0x83, 0xba, 0xa8, 0x29,
+  0x15, 0x8b, 0x35, 0xfb, 0x38, 0x92, 0x2b, 0x06, 0xac, 0x42, 0xa0, 0x9c, 0x01, 0x01, 0x98, 0x30,
+  0xc1, 0x0d, 0x15, 0xca, 0x50, 0xb2, 0x8c, 0x43, 0xa8, 0x19, 0x03, 0x98, 0x89, 0x99, 0x98, 0x00,
+  0xd8, 0x0c, 0x35, 0xa8, 0x40, 0xc2, 0x8d, 0x24, 0xa8, 0x38, 0xc0, 0x2b, 0x07, 0xeb, 0x28, 0x03,
+  0xba, 0x30, 0x93, 0xab, 0x52, 0xb2, 0x9d, 0x53, 0xb0, 0x8c, 0x11, 0x80, 0x20, 0xa8, 0x28, 0xc0,
+  0x4a, 0x17, 0xdb, 0x38, 0x83, 0x9a, 0x81, 0x09, 0x12, 0xba, 0x9a, 0x51, 0x85, 0xae, 0x73, 0xc0,
+  0x0a, 0x05, 0xaa, 0x50, 0x91, 0xab, 0x21, 0x91, 0x1a, 0x13, 0xaa, 0x30, 0xc8, 0x38, 0xb2, 0x2c,
+  0x87, 0xab, 0x22, 0xab, 0x23, 0xcf, 0x72, 0xb2, 0x0c, 0x23, 0x9b, 0x23, 0xec, 0x40, 0xa1, 0x0b,
+  0x04, 0xa9, 0x00, 0x08, 0x12, 0xcb, 0x63, 0xc8, 0x19, 0x14, 0x9a, 0x81, 0xab, 0x31, 0x00, 0x22,
+  0x98, 0x12, 0xff, 0x29, 0xa1, 0x49, 0x85, 0xab, 0x43, 0xb9, 0x31, 0xe8, 0x39, 0x92, 0x1a, 0xa2,
+  0x1d, 0x07, 0xcb, 0x30, 0xa1, 0x28, 0xc1, 0x2b, 0x16, 0xaa, 0x31, 0xb0, 0x9c, 0x31, 0x03, 0xce,
+  0x58, 0xa2, 0x8d, 0x43, 0xb9, 0x48, 0xa1, 0x0c, 0x22, 0x9a, 0x32, 0xb9, 0x60, 0xc1, 0x0b, 0x14,
+  0xaa, 0x18, 0xba, 0x70, 0x81, 0x0a, 0x12, 0x9a, 0x21, 0xc9, 0x39, 0x93, 0xaf, 0x52, 0xa1, 0x0b,
+  0x25, 0xea, 0x39, 0x83, 0xac, 0x30, 0x91, 0x18, 0xa0, 0x49, 0x05, 0xbc, 0x40, 0xc0, 0x0c, 0x24,
+  0x22, 0x01, 0x2f, 0x00, 0xab, 0x30, 0xa2, 0x19, 0x12, 0x1a, 0x27, 0xfb, 0x2a, 0x03, 0x9b, 0x31,
+  0x80, 0x20, 0xa0, 0x39, 0xf9, 0x8f, 0x23, 0xb9, 0x20, 0xa0, 0x70, 0x82, 0x8a, 0x81, 0xbc, 0x62,
+  0xb0, 0x1b, 0x05, 0xca, 0x29, 0x82, 0x09, 0x31, 0x10, 0x01, 0x98, 0x00, 0xfa, 0x8b, 0x02, 0x29,
+  0x05, 0xcd, 0x50, 0x02, 0x9a, 0x01, 0xba, 0x19, 0x23, 0xb0, 0x8d, 0x65, 0xa0, 0x9c, 0x22, 0xa1,
+  0xab, 0x30, 0x15, 0xb9, 0x20, 0xc2, 0xae, 0x73, 0x91, 0xab, 0x31, 0xb0, 0x0b, 0x52, 0x23, 0xda,
+  0x29, 0x05, 0xa9, 0x00, 0xbc, 0x51, 0xa1, 0x8b, 0x02, 0xba, 0x52, 0x14, 0xda, 0x1a, 0x15, 0xa9,
+  0x19, 0x80, 0x31, 0xfa, 0x3c, 0x05, 0xaa, 0x33, 0xa8, 0x18, 0xfb, 0x48, 0xa1, 0x2b, 0x07, 0xab,
+  0x51, 0xb0, 0x8b, 0x21, 0x23, 0xe9, 0x1a, 0x15, 0xba, 0x89, 0x11, 0x43, 0xa0, 0x30, 0xf8, 0x8e,
+  0x12, 0x91, 0xa9, 0x38, 0x06, 0xaa, 0x52, 0xc0, 0x2b, 0x84, 0xab, 0x53, 0xd8, 0x29, 0x03, 0xac,
+  0x42, 0xa1, 0x0a, 0x04, 0xdb, 0x18, 0x12, 0x88, 0x09, 0x20, 0x23, 0xfa, 0x8b, 0x24, 0xd8, 0x1a,
+  0x24, 0xda, 0x19, 0x14, 0xb8, 0x0a, 0x24, 0xcb, 0x38, 0xc3, 0x1b, 0x37, 0xda, 0x38, 0x92, 0x9d,
+  0x32, 0xa0, 0x8b, 0x11, 0x11, 0xa0, 0xae, 0x52, 0xa1, 0x0b, 0x45, 0xb8, 0x0b, 0x15, 0xb9, 0x19,
+  0x81, 0xa9, 0x08, 0x63, 0xc1, 0x9c, 0x44, 0xa0, 0x18, 0xa2, 0x8a, 0x02, 0x9a, 0x36, 0xfb, 0x3a,
+  0x03, 0xae, 0x28, 0x13, 0xa8, 0x8b, 0x44, 0xa1, 0x8b, 0x12, 0xa8, 0x18, 0x83, 0xba, 0xbb, 0x19,
+  0x15, 0xbb, 0x62, 0xc8, 0x68, 0xc3, 0x9f, 0x63, 0xa1, 0x0b, 0x22, 0xb8, 0xab, 0x71, 0x04, 0xdb,
+  0x20, 0x91, 0x9c, 0x22, 0x91, 0x10, 0x88, 0x10, 0xf9, 0x2a, 0x26, 0xba, 0x2a, 0x03, 0x9b, 0x13,
+  0xab, 0xff, 0x28, 0x00, 0x0e, 0x24, 0xc9, 0x3a, 0x05, 0xaa, 0x28, 0x13, 0xa9, 0x8a, 0x12, 0xd9,
+  0x0a, 0x13, 0x12, 0xe0, 0x0c, 0x23, 0xea, 0x30, 0x05, 0x99, 0x00, 0x98, 0x1a, 0x24, 0xfc, 0x1c,
+  0x22, 0xba, 0x72, 0x91, 0x0b, 0x12, 0x9a, 0x52, 0xd0, 0x0a, 0x04, 0xca, 0x19, 0x02, 0x88, 0x20,
+  0x11, 0x98, 0x99, 0x80, 0xa9, 0x71, 0x83, 0x8d, 0x33, 0xc0, 0x19, 0xc0, 0x49, 0x85, 0x9e, 0x42,
+  0xd0, 0x1b, 0x33, 0xba, 0x1a, 0x01, 0x52, 0xa1, 0x2b, 0x94, 0xaf, 0x30, 0xa2, 0x29, 0x03, 0x8b,
+  0x02, 0xcf, 0x20, 0x92, 0x1b, 0x36, 0xd9, 0x0b, 0x32, 0xc9, 0x50, 0xa2, 0x8c, 0x23, 0x88, 0x52,
+  0xe9, 0x29, 0x92, 0x9c, 0x12, 0x99, 0x52, 0xc9, 0x39, 0x94, 0x9d, 0x22, 0x99, 0x31, 0xd0, 0x2a,
+  0x93, 0xae, 0x44, 0xa1, 0x0a, 0x13, 0xab, 0x08, 0xdb, 0x40, 0x93, 0x8d, 0x32, 0xb8, 0x1b, 0x12,
+  0x98, 0x99, 0x58, 0x37, 0xc9, 0x2b, 0x25, 0xca, 0x09, 0x81, 0x09, 0x22, 0xa9, 0x29, 0x35, 0xa0,
+  0x0b, 0x92, 0xff, 0x30, 0x83, 0xac, 0x10, 0x00, 0x01, 0xab, 0x72, 0x91, 0xac, 0x10, 0x22, 0x00,
+  0x09, 0x90, 0xab, 0x53, 0xfa, 0x2b, 0x84, 0x8c, 0x44, 0xe9, 0x1a, 0x03, 0x9a, 0x40, 0x12, 0x00,
+  0x99, 0x28, 0xa1, 0x8c, 0x02, 0xab, 0x52, 0xa1, 0x0a, 0x22, 0xd0, 0xdf, 0x19, 0x24, 0xa8, 0x20,
+  0xa0, 0x0a, 0x14, 0xaa, 0x30, 0x02, 0x01, 0xfb, 0x1a, 0x15, 0x99, 0x52, 0xa0, 0x9b, 0x02, 0xcf,
+  0x58, 0x83, 0xad, 0x30, 0x93, 0x9c, 0x42, 0x90, 0x28, 0x81, 0xab, 0xa9, 0x09, 0x12, 0xa9, 0x62,
+  0xa1, 0x8a, 0x21, 0x01, 0x00, 0x32, 0xfb, 0x0f, 0x13, 0xcc, 0x30, 0xa1, 0x8d, 0x02, 0xaa, 0x41,
+  0x23, 0x45, 0x92, 0x99, 0xa0, 0x8c, 0x25, 0xd9, 0x8a, 0x80, 0x9a, 0x30, 0x22, 0x90, 0xc9, 0xbd,
+  0xc7, 0xfe, 0x1c, 0x00, 0x43, 0x12, 0x32, 0x03, 0x61, 0x93, 0xad, 0x98, 0xcd, 0x8a, 0xa9, 0x40,
+  0x84, 0x1b, 0x14, 0xcc, 0x40, 0x82, 0x1a, 0x35, 0xa8, 0x20, 0xb0, 0x9b, 0x80, 0xa9, 0x98, 0x48,
+  0x17, 0xc9, 0x28, 0x13, 0xcc, 0x1a, 0x22, 0xa9, 0x50, 0x82, 0xbc, 0x28, 0x80, 0x40, 0x12, 0x21,
+  0xa2, 0xef, 0x08, 0x82, 0x89, 0x20, 0x91, 0x38, 0x37, 0x81, 0x80, 0x90, 0x88, 0xb9, 0xad, 0x10,
+  0x81, 0x98, 0xed, 0xbc, 0x9a, 0x98, 0xaa, 0x41, 0x55, 0x12, 0xc9, 0x8a, 0xd9, 0x9d, 0x53, 0x82,
+  0x89, 0x10, 0x00, 0x81, 0x8a, 0x46, 0xd8, 0x8b, 0x81, 0x99, 0x32, 0xc8, 0x8a, 0xb9, 0xad, 0x20,
+  0x54, 0x24, 0x21, 0x01, 0x88, 0xa9, 0x09, 0x45, 0x81, 0x80, 0xa9, 0x9b, 0xa9, 0x60, 0x92, 0xaf,
+  0x89, 0x89, 0x73, 0x13, 0x10, 0xa1, 0xad, 0x88, 0x89, 0x65, 0x02, 0x99, 0x99, 0xbb, 0x09, 0x90,
+  0x0a, 0x13, 0xeb, 0x29, 0x14, 0xea, 0xab, 0x20, 0x02, 0x21, 0x64, 0x33, 0x92, 0x8b, 0x35, 0xc8,
+  0x0a, 0xb1, 0x9e, 0x22, 0xdc, 0x8b, 0xa8, 0x40, 0x17, 0xa8, 0x09, 0x98, 0x19, 0x81, 0x29, 0xa3,
+  0xdf, 0x10, 0x90, 0x29, 0x24, 0x89, 0x80, 0xbb, 0x51, 0x03, 0x72, 0x07, 0xa8, 0x08, 0x98, 0x0b,
+  0x32, 0x81, 0x98, 0xca, 0x09, 0x90, 0x9b, 0xd8, 0xbf, 0x18, 0x80, 0x18, 0xa1, 0x8c, 0x11, 0xba,
+  0x9a, 0x29, 0x77, 0x85, 0x89, 0x00, 0x99, 0x89, 0x21, 0x13, 0x8a, 0x54, 0xb1, 0x9c, 0x80, 0x30,
+  0x37, 0xa9, 0x30, 0xd1, 0x3a, 0x25, 0x89, 0x42, 0x01, 0x89, 0xca, 0x70, 0x24, 0x80, 0x08, 0xb9,
+  0x19, 0x81, 0x9a, 0x01, 0xdd, 0x29, 0x13, 0x80, 0x02, 0x88, 0x55, 0x02, 0x51, 0x34, 0x31, 0x02,
+  0xcb, 0x50, 0x13, 0x00, 0x90, 0x29, 0x93, 0x2b, 0x57, 0xc9, 0x0b, 0x81, 0x99, 0x30, 0x56, 0x11,
+  0xa1, 0x02, 0x14, 0x00, 0x63, 0x01, 0x31, 0x82, 0xbb, 0x99, 0xcf, 0x99, 0xdb, 0x9b, 0xea, 0xac,
+  0xb9, 0xbd, 0x8a, 0xca, 0x99, 0xb9, 0x8b, 0x90, 0xae, 0x31, 0xb8, 0x39, 0x05, 0x99, 0x02, 0x99,
+  0x32, 0xe8, 0x1a, 0xa1, 0x9b, 0xa8, 0xae, 0x11, 0xca, 0x9a, 0xcc, 0x38, 0x16, 0x09, 0x53, 0x80,
+  0x41, 0x13, 0x30, 0x35, 0x91, 0x20, 0x23, 0x01, 0x01, 0xa0, 0xbd, 0x89, 0xba, 0x19, 0xc1, 0x8d,
+  0xb1, 0xff, 0x9b, 0x88, 0x20, 0x82, 0x38, 0x04, 0x9c, 0x62, 0x23, 0x44, 0x24, 0x32, 0x33, 0x45,
+  0x43, 0x42, 0x24, 0x32, 0x34, 0x34, 0x44, 0x23, 0x33, 0x34, 0x43, 0x45, 0x43, 0x53, 0x22, 0x23,
+  0x33, 0x33, 0x44, 0x35, 0x25, 0x23, 0x00, 0xb8, 0xbc, 0xbb, 0xaa, 0xcb, 0xbc, 0xce, 0xdb, 0xba,
+  0xcb, 0xaa, 0xbb, 0xbc, 0xca, 0xaa, 0xba, 0xaa, 0xaa, 0xab, 0xab, 0xba, 0xaa, 0x21, 0x21, 0x22,
+  0x81, 0xeb, 0xcc, 0x1a, 0x34, 0x23, 0x35, 0x83, 0x10, 0x22, 0x73, 0x27, 0x22, 0x34, 0x24, 0x43,
+  0x24, 0x33, 0x33, 0x31, 0x45, 0x23, 0x43, 0x33, 0x01, 0x88, 0x89, 0x08, 0xc9, 0xaa, 0xd9, 0xce,
+  0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xba, 0xbd, 0xbb, 0xba, 0xbb, 0xaa, 0xaa, 0xba, 0xbd, 0x8a, 0x00,
+  0x28, 0x36, 0x03, 0x20, 0x21, 0x41, 0x45, 0x33, 0x27, 0x12, 0x21, 0x33, 0x24, 0x32, 0x33, 0x35,
+  0x22, 0x53, 0x34, 0x32, 0x21, 0x13, 0x52, 0x45, 0x33, 0x42, 0x33, 0x01, 0x41, 0x45, 0x34, 0x32,
+  0x34, 0x34, 0x42, 0x63, 0x43, 0x01, 0x10, 0x32, 0x43, 0x46, 0x43, 0x12, 0x98, 0x9a, 0x99, 0x8a,
+  0x31, 0x04, 0xfb, 0xbc, 0xcb, 0xdb, 0xaa, 0x9a, 0xcb, 0xac, 0xbb, 0xbb, 0xcc, 0xaa, 0x99, 0xcb,
+  0xaa, 0xa9, 0xab, 0x09, 0x10, 0x11, 0xba, 0x9b, 0x90, 0x9b, 0x67, 0x24, 0x11, 0x01, 0x08, 0x12,
+  0x84, 0xf1, 0x1e, 0x00, 0x40, 0x27, 0x12, 0x41, 0x32, 0x53, 0x23, 0x33, 0x25, 0x32, 0x63, 0x43,
+  0x33, 0x23, 0x33, 0x12, 0x20, 0x23, 0x11, 0x23, 0xb8, 0x9c, 0xfb, 0xbe, 0xcb, 0xbc, 0xbb, 0xbc,
+  0xbc, 0xca, 0xbc, 0xbb, 0xbc, 0xac, 0xaa, 0xab, 0xaa, 0xaa, 0x99, 0xb9, 0xab, 0x0a, 0x10, 0x31,
+  0x57, 0x32, 0x43, 0x33, 0x44, 0x24, 0x22, 0x34, 0x22, 0x52, 0x33, 0x43, 0x34, 0x11, 0x23, 0x12,
+  0x41, 0x24, 0x32, 0x35, 0x31, 0x44, 0x82, 0x41, 0x14, 0x10, 0x43, 0x88, 0x31, 0x82, 0x73, 0x06,
+  0x00, 0x23, 0x08, 0x73, 0x23, 0x42, 0x12, 0x40, 0x35, 0x34, 0x36, 0x13, 0x00, 0xa8, 0x89, 0x10,
+  0x11, 0x13, 0xf9, 0xbe, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xcc, 0xba, 0xac, 0xba, 0xbb, 0xbb, 0xca,
+  0xbb, 0xaa, 0x9b, 0x89, 0x00, 0x33, 0x03, 0x9a, 0x19, 0x51, 0x47, 0x35, 0x33, 0x82, 0x90, 0x08,
+  0x30, 0x73, 0x43, 0x12, 0x10, 0x32, 0x33, 0x44, 0x35, 0x32, 0x43, 0x34, 0x35, 0x32, 0x33, 0x34,
+  0x21, 0x21, 0x32, 0x01, 0x10, 0x03, 0xa9, 0xdb, 0xcf, 0xbc, 0xcc, 0xbb, 0xba, 0xcc, 0xaa, 0xcc,
+  0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xcb, 0x99, 0xa9, 0x99, 0x88, 0x08, 0x21, 0x54, 0x34, 0x43,
+  0x34, 0x43, 0x53, 0x23, 0x34, 0x33, 0x42, 0x23, 0x42, 0x43, 0x32, 0x34, 0x13, 0x32, 0x03, 0x31,
+  0x36, 0x21, 0x44, 0x01, 0x31, 0x13, 0x41, 0x25, 0x01, 0x32, 0x11, 0x52, 0x13, 0x53, 0x25, 0x42,
+  0x45, 0x23, 0x12, 0x11, 0x62, 0x45, 0x63, 0x33, 0x13, 0x80, 0xa8, 0x18, 0x31, 0x45, 0x12, 0xb8,
+  0xbe, 0xad, 0xba, 0xaa, 0xa9, 0xcc, 0xbc, 0xbc, 0xac, 0xba, 0xbb, 0xbb, 0xbc, 0xbc, 0xba, 0xbb,
+  0xa9, 0x88, 0x80, 0xb9, 0xbc, 0xab, 0x28, 0x57, 0x43, 0x13, 0x01, 0x88, 0x11, 0x52, 0x44, 0x23,
+  0x37, 0xf7, 0x25, 0x00, 0x11, 0x21, 0x43, 0x33, 0x44, 0x12, 0x32, 0x53, 0x43, 0x34, 0x23, 0x24,
+  0x12, 0x31, 0x22, 0x31, 0x43, 0x32, 0x33, 0xa8, 0xbc, 0xde, 0xbb, 0xab, 0xbb, 0xcc, 0xbd, 0xbd,
+  0xcb, 0xbb, 0xcb, 0xac, 0xcb, 0xaa, 0xab, 0xab, 0xba, 0xcc, 0xaa, 0xa9, 0x89, 0x00, 0x18, 0x22,
+  0x08, 0x65, 0x23, 0x32, 0x36, 0x22, 0x45, 0x32, 0x43, 0x23, 0x11, 0x42, 0x23, 0x53, 0x43, 0x12,
+  0x22, 0x11, 0x30, 0x33, 0x10, 0x55, 0x12, 0x41, 0x13, 0x89, 0x11, 0xbb, 0x72, 0x13, 0x20, 0x03,
+  0x9b, 0x57, 0x43, 0x53, 0x02, 0x88, 0x20, 0x74, 0x45, 0x33, 0x22, 0x01, 0x98, 0x08, 0x42, 0x45,
+  0x02, 0x80, 0xb9, 0xcd, 0xaa, 0xaa, 0xa9, 0xbc, 0xcc, 0xcb, 0xbc, 0xac, 0xaa, 0xaa, 0xbb, 0xbc,
+  0xcc, 0xab, 0x9a, 0x80, 0x00, 0x99, 0xcc, 0xbb, 0x09, 0x63, 0x24, 0x12, 0x00, 0xaa, 0x09, 0x53,
+  0x44, 0x22, 0x22, 0x12, 0x01, 0x53, 0x23, 0x32, 0x25, 0x42, 0x43, 0x23, 0x34, 0x33, 0x43, 0x34,
+  0x12, 0x11, 0x11, 0x42, 0x35, 0x33, 0x02, 0xc9, 0xcd, 0x9a, 0xaa, 0x89, 0xba, 0xbf, 0xcb, 0xbc,
+  0xac, 0xbb, 0xbd, 0xbb, 0xbb, 0xab, 0xba, 0xcc, 0xda, 0xbb, 0x9b, 0x99, 0x10, 0x14, 0x80, 0x80,
+  0x98, 0x51, 0x44, 0x53, 0x33, 0x12, 0x33, 0x43, 0x63, 0x43, 0x22, 0x22, 0x11, 0x31, 0x25, 0x33,
+  0x34, 0x13, 0x31, 0x04, 0x08, 0x34, 0x00, 0x64, 0x13, 0x31, 0x82, 0xaa, 0x31, 0x08, 0x67, 0x82,
+  0x88, 0x81, 0x29, 0x67, 0x22, 0x21, 0x90, 0x09, 0x73, 0x45, 0x44, 0x12, 0x81, 0x88, 0x88, 0x21,
+  0x35, 0x24, 0x81, 0xba, 0xdb, 0xbb, 0xab, 0xb9, 0xdb, 0xcc, 0xdb, 0xab, 0xbc, 0xab, 0xab, 0xcb,
+  0xcb, 0xcb, 0xbb, 0xaa, 0x89, 0x10, 0xa0, 0xbd, 0xbc, 0x9a, 0x31, 0x37, 0x23, 0x12, 0x99, 0x88,
+  0x16, 0xf1, 0x21, 0x00, 0x42, 0x45, 0x22, 0x22, 0x21, 0x22, 0x33, 0x33, 0x24, 0x32, 0x36, 0x25,
+  0x24, 0x33, 0x42, 0x33, 0x23, 0x33, 0x02, 0x30, 0x35, 0x34, 0x25, 0x90, 0xba, 0xcd, 0xab, 0xa9,
+  0xba, 0xdb, 0xbc, 0xcc, 0xcb, 0xbb, 0xbc, 0xad, 0xab, 0xaa, 0xaa, 0xbb, 0xbc, 0xcb, 0xbc, 0xab,
+  0x9a, 0x09, 0x20, 0x44, 0x13, 0x10, 0x11, 0x22, 0x56, 0x34, 0x35, 0x23, 0x21, 0x22, 0x32, 0x44,
+  0x34, 0x23, 0x21, 0x21, 0x12, 0x54, 0x33, 0x22, 0x02, 0x99, 0x21, 0x81, 0x75, 0x13, 0x10, 0x02,
+  0xba, 0x18, 0xb9, 0x71, 0x16, 0x10, 0x12, 0xbb, 0x19, 0x53, 0x56, 0x34, 0x12, 0x01, 0x00, 0x73,
+  0x37, 0x34, 0x32, 0x02, 0x89, 0x00, 0x43, 0x44, 0x13, 0x80, 0xda, 0xcb, 0x9a, 0xa9, 0xaa, 0xeb,
+  0xbc, 0xbc, 0xbc, 0xab, 0xbb, 0xbc, 0xba, 0xcc, 0xcb, 0xba, 0x9b, 0x88, 0x00, 0x98, 0xba, 0xbe,
+  0x89, 0x42, 0x53, 0x33, 0x82, 0x88, 0x00, 0x51, 0x35, 0x23, 0x42, 0x81, 0x20, 0x25, 0x21, 0x33,
+  0x12, 0x43, 0x33, 0x63, 0x34, 0x22, 0x34, 0x23, 0x23, 0x01, 0x21, 0x33, 0x45, 0x23, 0x01, 0xda,
+  0xad, 0xaa, 0xaa, 0x98, 0xfb, 0xcb, 0xdb, 0xbb, 0xba, 0xad, 0xbb, 0xbd, 0xac, 0xb9, 0xaa, 0xaa,
+  0xbc, 0xbb, 0xbc, 0x9b, 0x08, 0x10, 0x11, 0x11, 0x22, 0x44, 0x55, 0x43, 0x22, 0x33, 0x34, 0x44,
+  0x43, 0x32, 0x22, 0x23, 0x32, 0x25, 0x12, 0x32, 0x13, 0x41, 0x45, 0x12, 0x10, 0x91, 0x9b, 0x52,
+  0x11, 0x52, 0x13, 0x8a, 0x22, 0x90, 0x63, 0xb0, 0x1a, 0x15, 0x18, 0x35, 0x88, 0x51, 0x22, 0x76,
+  0x13, 0x10, 0x00, 0x41, 0x56, 0x44, 0x43, 0x02, 0x00, 0x88, 0x28, 0x53, 0x43, 0x22, 0xa0, 0xbb,
+  0xcc, 0xba, 0xa9, 0xba, 0xcc, 0xcc, 0xbc, 0xbb, 0xad, 0xbb, 0xba, 0xbb, 0xbd, 0xcb, 0xbb, 0xaa,
+  0x65, 0xf0, 0x27, 0x00, 0x08, 0x98, 0xb9, 0xbd, 0x9b, 0x10, 0x55, 0x33, 0x13, 0x00, 0x89, 0x20,
+  0x45, 0x44, 0x23, 0x22, 0x21, 0x21, 0x31, 0x43, 0x33, 0x44, 0x33, 0x43, 0x23, 0x23, 0x43, 0x53,
+  0x33, 0x33, 0x12, 0x80, 0x20, 0x32, 0x45, 0x81, 0xcc, 0xcc, 0xbc, 0x9a, 0xba, 0xbb, 0xec, 0xac,
+  0xbb, 0xbb, 0xba, 0xcd, 0xba, 0xcb, 0xab, 0xa9, 0xba, 0xaa, 0xbb, 0x9c, 0xa9, 0xab, 0x89, 0x20,
+  0x36, 0x46, 0x34, 0x11, 0x32, 0x22, 0x52, 0x45, 0x32, 0x43, 0x12, 0x20, 0x31, 0x31, 0x53, 0x24,
+  0x01, 0x01, 0x11, 0x11, 0x35, 0x13, 0x11, 0xa0, 0xbc, 0x40, 0x13, 0x40, 0x15, 0xa8, 0x28, 0x91,
+  0x40, 0x15, 0xaa, 0x22, 0xc0, 0x19, 0xa8, 0x79, 0x26, 0x41, 0x34, 0x81, 0x28, 0x63, 0x57, 0x44,
+  0x32, 0x14, 0x01, 0x01, 0x21, 0x54, 0x23, 0x22, 0x02, 0xa8, 0x99, 0xb9, 0xab, 0xfb, 0xbc, 0xbc,
+  0xbd, 0xbc, 0xbb, 0xbc, 0xab, 0xcc, 0xcb, 0xcb, 0xab, 0x9b, 0x89, 0x88, 0xba, 0xcc, 0xbb, 0x9a,
+  0x21, 0x44, 0x32, 0x10, 0x00, 0x11, 0x63, 0x34, 0x43, 0x32, 0x32, 0x33, 0x34, 0x22, 0x34, 0x32,
+  0x43, 0x33, 0x22, 0x23, 0x33, 0x67, 0x23, 0x12, 0x13, 0x98, 0x18, 0x32, 0x54, 0x24, 0x81, 0x98,
+  0xda, 0xac, 0xaa, 0xba, 0xab, 0xbb, 0xbe, 0xbc, 0xcd, 0xac, 0xab, 0xac, 0xaa, 0xba, 0xcb, 0xcb,
+  0xac, 0xa9, 0x9a, 0x89, 0xb8, 0x9a, 0x89, 0x28, 0x46, 0x43, 0x43, 0x32, 0x32, 0x43, 0x45, 0x43,
+  0x43, 0x23, 0x22, 0x22, 0x11, 0x41, 0x33, 0x24, 0x34, 0x02, 0x90, 0x88, 0x08, 0x20, 0x34, 0x02,
+  0x28, 0xc2, 0x9f, 0x21, 0xfa, 0x18, 0x82, 0x0a, 0x24, 0xdb, 0x10, 0xb8, 0x3a, 0x05, 0xab, 0x98,
+  0x9c, 0x65, 0x33, 0x43, 0x03, 0x28, 0x65, 0x64, 0x34, 0x33, 0x23, 0x11, 0x21, 0x53, 0x44, 0x24,
+  0xe2, 0x1b, 0x2c, 0x00, 0x01, 0x90, 0xa9, 0x9a, 0xaa, 0x99, 0xeb, 0xbd, 0xcb, 0xbd, 0xcb, 0xab,
+  0xbb, 0xbc, 0xcb, 0xbc, 0xac, 0xaa, 0x99, 0x88, 0xa9, 0xcb, 0xcb, 0x8a, 0x20, 0x34, 0x33, 0x03,
+  0x80, 0x10, 0x43, 0x36, 0x24, 0x33, 0x43, 0x22, 0x22, 0x23, 0x23, 0x73, 0x33, 0x33, 0x23, 0x10,
+  0x55, 0x24, 0x44, 0x13, 0x80, 0x00, 0x88, 0x41, 0x15, 0x01, 0x81, 0xdb, 0x8b, 0xa9, 0xac, 0xaa,
+  0xbf, 0x9b, 0xbb, 0xbc, 0xb9, 0xce, 0xba, 0xba, 0xab, 0xa9, 0xba, 0x9c, 0xbb, 0xad, 0x88, 0x89,
+  0x20, 0x02, 0x31, 0x34, 0x32, 0x65, 0x33, 0x44, 0x43, 0x33, 0x32, 0x43, 0x12, 0x43, 0x33, 0x34,
+  0x25, 0x22, 0x32, 0x02, 0x21, 0x12, 0x11, 0x23, 0x11, 0x01, 0x18, 0x34, 0xb1, 0x8b, 0xfd, 0x9f,
+  0x99, 0xaa, 0x29, 0x03, 0x38, 0x16, 0x98, 0x08, 0xec, 0x19, 0x23, 0x30, 0x16, 0xa8, 0x08, 0x08,
+  0x77, 0x23, 0x11, 0x80, 0x18, 0x67, 0x44, 0x34, 0x24, 0x10, 0x01, 0x20, 0x53, 0x24, 0x24, 0x02,
+  0x88, 0x88, 0x9a, 0x99, 0xc9, 0xcb, 0xcc, 0xcc, 0xab, 0xcb, 0xbb, 0xbb, 0xcd, 0xbb, 0xbc, 0xac,
+  0x9a, 0xa9, 0x88, 0xa9, 0xcb, 0xca, 0x9a, 0x10, 0x32, 0x24, 0x13, 0x12, 0x21, 0x44, 0x43, 0x24,
+  0x23, 0x22, 0x33, 0x44, 0x43, 0x33, 0x33, 0x32, 0x22, 0x31, 0x44, 0x45, 0x43, 0x43, 0x32, 0x01,
+  0x08, 0x80, 0x10, 0x33, 0x14, 0x22, 0xda, 0xbc, 0xea, 0xcb, 0xaa, 0xcc, 0xab, 0xcb, 0xbb, 0xcb,
+  0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xba, 0xaa, 0x88, 0x08, 0x10, 0x88, 0xaa, 0x08, 0x62, 0x47, 0x34,
+  0x34, 0x22, 0x21, 0x12, 0x21, 0x45, 0x43, 0x43, 0x22, 0x20, 0x32, 0x11, 0x63, 0x22, 0x01, 0x82,
+  0x88, 0x41, 0x23, 0x32, 0x14, 0xfb, 0x9c, 0x99, 0xaa, 0x31, 0xa2, 0x8c, 0xa0, 0xdf, 0x08, 0xb8,
+  0x8a, 0xfe, 0x1b, 0x00, 0x20, 0xd9, 0x19, 0x04, 0x8a, 0x12, 0xeb, 0x28, 0xb1, 0x3a, 0x07, 0x99,
+  0x73, 0x22, 0x53, 0x03, 0x89, 0x22, 0x42, 0x77, 0x25, 0x22, 0x22, 0x00, 0x30, 0x33, 0x63, 0x24,
+  0x00, 0x01, 0xa0, 0x89, 0x90, 0xbc, 0xcb, 0xcd, 0xbb, 0xcc, 0xbb, 0xba, 0xcb, 0xac, 0xdb, 0xdb,
+  0xba, 0xaa, 0x89, 0x80, 0x98, 0xca, 0xcb, 0x9b, 0x18, 0x21, 0x23, 0x01, 0x10, 0x22, 0x54, 0x35,
+  0x22, 0x22, 0x21, 0x42, 0x44, 0x43, 0x43, 0x23, 0x24, 0x21, 0x11, 0x22, 0x44, 0x53, 0x34, 0x13,
+  0x01, 0x01, 0x98, 0x18, 0x82, 0x8a, 0xa8, 0xdf, 0x99, 0xc9, 0xac, 0xca, 0xcc, 0xaa, 0xca, 0x9a,
+  0xa9, 0xcb, 0xba, 0xbc, 0xab, 0xcb, 0x99, 0xa9, 0x9a, 0x88, 0x28, 0x44, 0x23, 0x34, 0x23, 0x20,
+  0x55, 0x34, 0x53, 0x43, 0x22, 0x11, 0x13, 0x20, 0x43, 0x11, 0x73, 0x23, 0x21, 0x23, 0xa8, 0x09,
+  0x20, 0x54, 0x33, 0x01, 0xb9, 0xab, 0x9a, 0x49, 0x15, 0xda, 0xab, 0xec, 0x9a, 0x08, 0x89, 0x88,
+  0xc9, 0xbc, 0xbb, 0xbc, 0x0b, 0x80, 0x9b, 0x34, 0xc8, 0x48, 0x03, 0x49, 0x47, 0x01, 0x53, 0x01,
+  0x30, 0x25, 0x63, 0x25, 0x02, 0x10, 0x88, 0x62, 0x46, 0x34, 0x34, 0x12, 0x10, 0x21, 0x32, 0x36,
+  0x23, 0x12, 0x80, 0x89, 0x99, 0x98, 0xeb, 0xbd, 0xcc, 0xbc, 0xcb, 0xca, 0xaa, 0xaa, 0xbc, 0xcb,
+  0xcc, 0xbb, 0xab, 0x9a, 0x00, 0x98, 0x9a, 0xbc, 0x9c, 0x09, 0x11, 0x22, 0x02, 0x11, 0x53, 0x54,
+  0x43, 0x23, 0x12, 0x11, 0x11, 0x34, 0x45, 0x24, 0x33, 0x24, 0x22, 0x31, 0x32, 0x22, 0x44, 0x24,
+  0x24, 0x23, 0x12, 0x81, 0x89, 0xb9, 0xbc, 0xeb, 0xcb, 0xaa, 0xbc, 0xbb, 0xec, 0xcc, 0xba, 0xcb,
+  0x9a, 0xaa, 0x9b, 0xba, 0xad, 0x99, 0xba, 0x99, 0xb8, 0x8a, 0x10, 0x42, 0x46, 0x32, 0x53, 0x23,
+  0x65, 0xf6, 0x1f, 0x00, 0x43, 0x32, 0x53, 0x43, 0x32, 0x34, 0x32, 0x22, 0x24, 0x00, 0x10, 0x80,
+  0x18, 0x34, 0x34, 0x34, 0x90, 0x8b, 0xd9, 0x9c, 0x21, 0x88, 0x42, 0xc0, 0x8b, 0xd9, 0xae, 0x10,
+  0xba, 0x0b, 0xe9, 0xac, 0x00, 0xaa, 0x31, 0xd0, 0xac, 0xa8, 0xad, 0x10, 0x01, 0x28, 0x33, 0x81,
+  0x74, 0x03, 0x10, 0x24, 0x00, 0x64, 0x03, 0x31, 0x25, 0x21, 0x45, 0x02, 0x18, 0x90, 0x58, 0x67,
+  0x43, 0x53, 0x12, 0x11, 0x10, 0x20, 0x34, 0x24, 0x32, 0x02, 0x89, 0x08, 0xb9, 0xbb, 0xcf, 0xcc,
+  0xcb, 0xbb, 0xba, 0xbb, 0xbc, 0xca, 0xbc, 0xcc, 0xbb, 0xbb, 0x9b, 0x0a, 0x08, 0xa8, 0xaa, 0xcb,
+  0xab, 0x11, 0x21, 0x12, 0x11, 0x62, 0x44, 0x44, 0x33, 0x12, 0x00, 0x88, 0x31, 0x64, 0x35, 0x33,
+  0x34, 0x23, 0x33, 0x33, 0x32, 0x35, 0x33, 0x45, 0x24, 0x22, 0x21, 0x88, 0x98, 0xeb, 0xbb, 0xcc,
+  0xbc, 0xaa, 0xbb, 0xac, 0xbd, 0xbd, 0xcb, 0xac, 0x9a, 0xaa, 0xa9, 0x99, 0x89, 0x08, 0x11, 0x00,
+  0x81, 0x89, 0x72, 0x35, 0x35, 0x25, 0x22, 0x23, 0x12, 0x42, 0x23, 0x42, 0x43, 0x23, 0x24, 0x22,
+  0x22, 0x01, 0x08, 0x00, 0x08, 0x81, 0x0a, 0x01, 0xcc, 0x8a, 0xb8, 0xbb, 0xdf, 0xbd, 0xaa, 0xbb,
+  0x19, 0x81, 0xda, 0xbd, 0xbc, 0xbc, 0x9a, 0x88, 0x99, 0x98, 0xcb, 0x89, 0xdd, 0x0a, 0x01, 0x8a,
+  0x46, 0x81, 0x51, 0x02, 0x29, 0x35, 0x10, 0x46, 0x02, 0x31, 0x14, 0x20, 0x45, 0x11, 0x20, 0x90,
+  0x8a, 0x33, 0x34, 0x25, 0xc9, 0xcb, 0x8a, 0x74, 0x37, 0x43, 0x22, 0x02, 0x11, 0x32, 0x45, 0x33,
+  0x22, 0x11, 0x00, 0x00, 0x88, 0xd9, 0xdd, 0xbb, 0xbc, 0xbc, 0xcb, 0xab, 0xac, 0xbb, 0xbb, 0xcd,
+  0xbc, 0xbb, 0x9a, 0x08, 0x00, 0x00, 0xaa, 0x9a, 0x10, 0x32, 0x12, 0xaa, 0x0a, 0x63, 0x46, 0x34,
+  0x8c, 0xf6, 0x25, 0x00, 0x01, 0x00, 0x88, 0x00, 0x10, 0x21, 0x64, 0x44, 0x35, 0x33, 0x32, 0x22,
+  0x11, 0x43, 0x35, 0x43, 0x33, 0x33, 0x23, 0x81, 0xc9, 0xdc, 0xbc, 0xac, 0xcb, 0xbb, 0xcb, 0xbc,
+  0xbb, 0xbc, 0xcc, 0xbb, 0xcb, 0xaa, 0x89, 0x18, 0x10, 0x22, 0x33, 0x33, 0x24, 0x33, 0x35, 0x45,
+  0x53, 0x33, 0x24, 0x32, 0x23, 0x23, 0x22, 0x12, 0x00, 0x31, 0x55, 0x34, 0x23, 0x02, 0xa0, 0xbb,
+  0xbb, 0xa9, 0x88, 0x88, 0xaa, 0xcb, 0xce, 0xcb, 0xda, 0xab, 0xaa, 0xbd, 0xab, 0xc9, 0x8a, 0x01,
+  0xb9, 0xb9, 0xef, 0xaa, 0xa9, 0x8a, 0x12, 0x11, 0x33, 0x82, 0x99, 0xaa, 0x48, 0x46, 0x55, 0x24,
+  0x22, 0x23, 0x01, 0x52, 0x23, 0x63, 0x13, 0x20, 0x23, 0xb9, 0x72, 0x82, 0x18, 0xa1, 0xbf, 0x98,
+  0x99, 0x52, 0xa1, 0xad, 0xba, 0x2a, 0x77, 0x37, 0x32, 0x22, 0x11, 0x11, 0x33, 0x37, 0x22, 0x11,
+  0x01, 0x98, 0x88, 0xa8, 0xcc, 0xcd, 0xbb, 0xcc, 0xcb, 0xba, 0xab, 0xab, 0x9a, 0xcb, 0xcd, 0xcb,
+  0x9a, 0x88, 0x11, 0x11, 0x88, 0xa9, 0x08, 0x31, 0x12, 0xa0, 0xcc, 0xab, 0x08, 0x53, 0x25, 0x11,
+  0x11, 0x01, 0x00, 0x10, 0x42, 0x56, 0x54, 0x34, 0x43, 0x22, 0x22, 0x23, 0x32, 0x34, 0x22, 0x01,
+  0x01, 0x88, 0x88, 0xeb, 0xcd, 0xdc, 0xbb, 0xbc, 0xbc, 0xab, 0xbb, 0xba, 0xba, 0xca, 0xcb, 0xba,
+  0xaa, 0x08, 0x21, 0x43, 0x34, 0x33, 0x45, 0x33, 0x32, 0x24, 0x11, 0x32, 0x35, 0x35, 0x34, 0x23,
+  0x24, 0x22, 0x22, 0x12, 0x11, 0x10, 0x53, 0x34, 0x53, 0x23, 0x01, 0x88, 0xdb, 0xbb, 0xfb, 0xab,
+  0xaa, 0xbc, 0xab, 0xdb, 0xbb, 0xcb, 0xbc, 0x99, 0xba, 0x0a, 0x80, 0x8a, 0x31, 0x35, 0x56, 0x23,
+  0x22, 0x81, 0xa9, 0x30, 0x54, 0x54, 0x22, 0x02, 0x81, 0x99, 0x88, 0x99, 0x41, 0x03, 0x40, 0x25,
+  0xb5, 0x00, 0x19, 0x00, 0x1a, 0x81, 0x8b, 0x44, 0x90, 0x11, 0xfb, 0x8e, 0x08, 0x28, 0x25, 0xa1,
+  0xa9, 0xbe, 0xab, 0x88, 0x18, 0xf9, 0x9e, 0x10, 0x54, 0x47, 0x33, 0x24, 0x11, 0x11, 0x23, 0x33,
+  0x45, 0x12, 0x00, 0x00, 0x98, 0xa8, 0xeb, 0xcb, 0xdc, 0xbb, 0xbb, 0xbd, 0x9b, 0xaa, 0x99, 0xaa,
+  0xcc, 0xcb, 0xab, 0x8a, 0x10, 0x10, 0x12, 0x11, 0x11, 0x32, 0x14, 0xa1, 0xdc, 0xbb, 0xbc, 0x9b,
+  0x20, 0x35, 0x32, 0x24, 0x13, 0x11, 0x53, 0x36, 0x35, 0x45, 0x43, 0x43, 0x32, 0x32, 0x22, 0x10,
+  0x01, 0xa8, 0xba, 0xbd, 0xbc, 0xdb, 0xcb, 0xcb, 0xcc, 0xcb, 0xbb, 0xac, 0xab, 0x99, 0x88, 0x80,
+  0x01, 0x01, 0x08, 0x32, 0x33, 0x35, 0x43, 0x44, 0x13, 0x33, 0x24, 0x11, 0x11, 0x11, 0x10, 0x98,
+  0x61, 0x35, 0x44, 0x35, 0x33, 0x33, 0x23, 0x53, 0x32, 0x33, 0x35, 0x11, 0x01, 0x88, 0xca, 0xdc,
+  0xdb, 0xcb, 0xbc, 0xca, 0xba, 0xab, 0xbb, 0xaa, 0xba, 0x8a, 0x88, 0x09, 0x62, 0x24, 0x34, 0x34,
+  0x24, 0x33, 0x32, 0x36, 0x02, 0x10, 0x12, 0x90, 0x20, 0x21, 0x21, 0xe9, 0x0a, 0x92, 0xaf, 0x30,
+  0x91, 0x30, 0x15, 0x18, 0x92, 0xbf, 0x10, 0xda, 0x1b, 0x92, 0xae, 0x10, 0xba, 0x29, 0xb1, 0x3a,
+  0x07, 0x99, 0x22, 0xfa, 0x29, 0x24, 0x00, 0x12, 0xdb, 0x59, 0x77, 0x53, 0x34, 0x23, 0x13, 0x02,
+  0x21, 0x24, 0x22, 0x01, 0xa0, 0xbc, 0xac, 0xcb, 0xbc, 0xcc, 0xbc, 0xdb, 0xbc, 0xaa, 0xaa, 0x8a,
+  0x01, 0x80, 0x99, 0xcb, 0x8a, 0x08, 0x31, 0x14, 0x98, 0xa9, 0x99, 0x22, 0x23, 0xb8, 0xff, 0xad,
+  0xab, 0x99, 0x10, 0x43, 0x45, 0x33, 0x43, 0x34, 0x42, 0x33, 0x34, 0x33, 0x33, 0x32, 0x33, 0x43,
+  0x22, 0xb0, 0xed, 0xcc, 0xcb, 0xcb, 0xba, 0xba, 0xbb, 0xab, 0xbb, 0xaa, 0xaa, 0x09, 0x88, 0x28,
+  0xeb, 0xef, 0x1d, 0x00, 0x14, 0x52, 0x45, 0x34, 0x23, 0x12, 0x80, 0xcb, 0xaa, 0xab, 0xcb, 0xcb,
+  0x29, 0x01, 0x71, 0x35, 0x22, 0x44, 0x23, 0x34, 0x34, 0x32, 0x25, 0x21, 0x33, 0x14, 0x80, 0xb8,
+  0xbd, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0xaa, 0xaa, 0xa9, 0xab, 0x99, 0x08, 0x32, 0x35, 0x35, 0x35,
+  0x34, 0x43, 0x32, 0x23, 0x22, 0x11, 0x80, 0xa9, 0xbc, 0xcb, 0xbb, 0x89, 0x21, 0x12, 0x32, 0x13,
+  0x00, 0x21, 0x98, 0x73, 0x35, 0x45, 0x24, 0x22, 0x02, 0xb8, 0xeb, 0xed, 0xac, 0xab, 0xbb, 0xab,
+  0xaa, 0xaa, 0xba, 0x19, 0x23, 0x00, 0x75, 0x53, 0x32, 0x35, 0x34, 0x22, 0x32, 0x53, 0x02, 0x98,
+  0xa9, 0xcb, 0x70, 0x57, 0x43, 0x33, 0x23, 0x22, 0x21, 0x42, 0x13, 0xa8, 0xa9, 0xfb, 0xab, 0xba,
+  0xbc, 0xdb, 0xbd, 0xbb, 0xcd, 0xab, 0xa9, 0x9b, 0x80, 0x80, 0x00, 0x90, 0x28, 0x23, 0x11, 0x02,
+  0xdd, 0xbb, 0xba, 0x18, 0x80, 0x88, 0xd8, 0xbe, 0xaa, 0x9a, 0x30, 0x23, 0x67, 0x43, 0x53, 0x44,
+  0x32, 0x24, 0x13, 0x22, 0x11, 0x08, 0x00, 0xa9, 0xb9, 0xeb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xab,
+  0xbb, 0xab, 0x89, 0x10, 0x32, 0x42, 0x44, 0x13, 0x32, 0x22, 0x88, 0x10, 0x80, 0x18, 0xb0, 0xbd,
+  0xba, 0xdf, 0x9a, 0xca, 0x9b, 0x10, 0x41, 0x45, 0x34, 0x34, 0x44, 0x32, 0x33, 0x23, 0x21, 0x11,
+  0x00, 0x01, 0xa8, 0xcb, 0xdd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xaa, 0x9a, 0x08, 0x11, 0x31, 0x24,
+  0x32, 0x25, 0x13, 0x33, 0x23, 0x54, 0x23, 0x31, 0x32, 0x90, 0x99, 0xca, 0xcd, 0xbb, 0x9b, 0x10,
+  0x54, 0x44, 0x22, 0x22, 0x23, 0x22, 0x24, 0x02, 0x90, 0x80, 0xa9, 0xba, 0xdd, 0xbc, 0xcd, 0xad,
+  0xcb, 0xcc, 0x9b, 0x99, 0x0a, 0x21, 0x80, 0x32, 0x91, 0x72, 0x15, 0x10, 0x33, 0x00, 0x32, 0x03,
+  0x53, 0x00, 0x1e, 0x00, 0x67, 0x80, 0x21, 0x82, 0xca, 0x09, 0x08, 0x90, 0xab, 0x20, 0xba, 0x75,
+  0x77, 0x25, 0x12, 0x12, 0x11, 0x18, 0x21, 0x91, 0xcb, 0xbb, 0xbd, 0xbc, 0xba, 0xbb, 0xcd, 0xab,
+  0xb9, 0xcc, 0x9a, 0x99, 0x00, 0x32, 0x32, 0x12, 0x18, 0x44, 0x12, 0x88, 0xea, 0xbd, 0xbb, 0xbb,
+  0xaa, 0xbb, 0xab, 0xba, 0x19, 0x34, 0x54, 0x45, 0x43, 0x53, 0x33, 0x35, 0x44, 0x32, 0x22, 0x01,
+  0x90, 0xa9, 0xbb, 0xcd, 0xbc, 0xcb, 0xbb, 0xab, 0xbb, 0xbb, 0xab, 0xaa, 0x99, 0x88, 0x31, 0x47,
+  0x34, 0x34, 0x33, 0x21, 0x01, 0x90, 0xba, 0xdf, 0xcb, 0xbb, 0xab, 0x8a, 0x08, 0x18, 0x33, 0x53,
+  0x45, 0x32, 0x43, 0x25, 0x32, 0x34, 0x32, 0x33, 0x14, 0x11, 0xa0, 0xcc, 0xbc, 0xcc, 0xab, 0xba,
+  0xbb, 0x9a, 0xaa, 0x08, 0x11, 0x32, 0x22, 0x21, 0x26, 0x33, 0x34, 0x23, 0x11, 0x10, 0x98, 0xc9,
+  0xdd, 0xbb, 0xaa, 0x89, 0x18, 0x11, 0x74, 0x35, 0x44, 0x34, 0x33, 0x43, 0x24, 0x22, 0x01, 0x90,
+  0xb9, 0xcc, 0xba, 0xbc, 0xcc, 0xab, 0xaa, 0xba, 0xaa, 0xdb, 0xac, 0x09, 0x88, 0x42, 0x91, 0x19,
+  0x02, 0x19, 0x37, 0xb8, 0x0a, 0xd8, 0x9c, 0x01, 0xcb, 0x48, 0x02, 0x60, 0x25, 0x10, 0x54, 0x22,
+  0x53, 0x23, 0x22, 0x23, 0x98, 0x31, 0xe8, 0x9c, 0x98, 0xab, 0x40, 0x77, 0x34, 0x24, 0x24, 0x12,
+  0x00, 0x01, 0x08, 0xb9, 0xbd, 0xbc, 0xbe, 0xaa, 0xb9, 0xab, 0xab, 0xac, 0xbb, 0xbc, 0x9a, 0x99,
+  0x20, 0x45, 0x22, 0x22, 0x01, 0x20, 0x82, 0xeb, 0xdd, 0xcc, 0xaa, 0x9a, 0x89, 0x80, 0x19, 0x41,
+  0x32, 0x45, 0x24, 0x32, 0x34, 0x43, 0x34, 0x32, 0x33, 0x23, 0x11, 0x80, 0xec, 0xbc, 0xcb, 0xcb,
+  0xbb, 0xbb, 0xac, 0x9a, 0x08, 0x31, 0x22, 0x43, 0x33, 0x22, 0x44, 0x82, 0xa9, 0xb9, 0xbd, 0xab,
+  0x11, 0xf8, 0x22, 0x00, 0xcd, 0xcb, 0xac, 0xaa, 0xa9, 0x89, 0x10, 0x33, 0x57, 0x34, 0x33, 0x35,
+  0x34, 0x32, 0x23, 0x00, 0x98, 0xcb, 0x9a, 0xdb, 0xbc, 0xb9, 0xbb, 0xaa, 0xa8, 0x99, 0x99, 0x0a,
+  0x53, 0x12, 0x61, 0x35, 0x12, 0x22, 0x13, 0xa0, 0xde, 0xab, 0xba, 0xcf, 0x89, 0x99, 0xaa, 0x10,
+  0x53, 0x23, 0x44, 0x35, 0x12, 0x31, 0x34, 0x81, 0x10, 0x12, 0xa0, 0xaa, 0x18, 0xe9, 0xae, 0x09,
+  0xc9, 0xac, 0x88, 0xa9, 0xbb, 0x28, 0x24, 0x80, 0x62, 0x24, 0x98, 0x08, 0xa0, 0xde, 0x9b, 0x99,
+  0xda, 0x9b, 0x89, 0x99, 0x20, 0x45, 0x22, 0x20, 0x34, 0x23, 0x41, 0x45, 0x01, 0x10, 0x33, 0x81,
+  0x21, 0x24, 0x91, 0xab, 0x73, 0x93, 0xad, 0x41, 0xa0, 0x9c, 0x23, 0xb0, 0x68, 0x77, 0x34, 0x32,
+  0x33, 0x13, 0x80, 0x32, 0x81, 0xcd, 0xcc, 0xdb, 0xbb, 0xaa, 0xa9, 0xbb, 0x89, 0x98, 0xaa, 0x8a,
+  0x18, 0x91, 0x28, 0x27, 0xa8, 0x0b, 0x11, 0x98, 0xda, 0xce, 0xcc, 0xbc, 0xab, 0x99, 0x9a, 0x19,
+  0x22, 0x54, 0x35, 0x35, 0x34, 0x32, 0x42, 0x22, 0x10, 0x12, 0x01, 0xa9, 0xcb, 0xac, 0xcc, 0xab,
+  0xaa, 0xcc, 0xaa, 0x99, 0xaa, 0x09, 0x22, 0x24, 0x53, 0x34, 0x01, 0x08, 0x11, 0xfb, 0xad, 0xbb,
+  0xcd, 0xaa, 0x9a, 0x88, 0x89, 0x31, 0x25, 0x32, 0x45, 0x33, 0x32, 0x43, 0x23, 0x12, 0x12, 0x22,
+  0x91, 0xeb, 0xbb, 0xbd, 0xad, 0x9a, 0xa9, 0x89, 0x18, 0x62, 0x34, 0x32, 0x34, 0x12, 0x80, 0xa9,
+  0xeb, 0xcc, 0xcb, 0xba, 0xaa, 0x9a, 0x99, 0x00, 0x18, 0x44, 0x33, 0x44, 0x23, 0x52, 0x34, 0x23,
+  0x32, 0x15, 0x01, 0x21, 0x12, 0x80, 0xdc, 0xab, 0xbc, 0xbb, 0x30, 0x13, 0x08, 0x53, 0x12, 0x53,
+  0x35, 0x02, 0x80, 0xda, 0xbd, 0xcb, 0xbb, 0xbb, 0xbc, 0xaa, 0xfa, 0x9c, 0x08, 0xa9, 0x09, 0x12,
+  0x7b, 0xf8, 0x1f, 0x00, 0x10, 0x42, 0x55, 0x33, 0x42, 0x35, 0x01, 0x18, 0x12, 0x98, 0xa9, 0xcb,
+  0xbb, 0xcb, 0x09, 0x23, 0x18, 0x65, 0x34, 0x54, 0x13, 0x11, 0x23, 0x00, 0x10, 0xb0, 0xbc, 0xcb,
+  0x70, 0x57, 0x33, 0x34, 0x24, 0x22, 0x11, 0x21, 0xa0, 0xdd, 0xdb, 0xbb, 0xcb, 0xac, 0x89, 0xa8,
+  0x0a, 0x11, 0x00, 0x20, 0x11, 0x24, 0xc8, 0x9c, 0xa1, 0xbe, 0x1a, 0xb0, 0xbc, 0xbb, 0xad, 0xaa,
+  0xdb, 0x19, 0x90, 0x0a, 0x55, 0x23, 0x54, 0x24, 0x33, 0x33, 0x22, 0x21, 0x80, 0x98, 0xc9, 0xbd,
+  0xac, 0xcb, 0x9a, 0x88, 0x88, 0x09, 0x11, 0x12, 0x20, 0x44, 0x82, 0xa9, 0xca, 0xbb, 0xde, 0xbc,
+  0xba, 0xdd, 0xaa, 0xaa, 0x9a, 0x80, 0x10, 0x53, 0x33, 0x44, 0x35, 0x33, 0x32, 0x11, 0x21, 0x98,
+  0xab, 0xa8, 0xdc, 0xab, 0x80, 0x89, 0x10, 0x42, 0x43, 0x32, 0x64, 0x33, 0x12, 0x31, 0x82, 0x89,
+  0xa9, 0xde, 0xbd, 0xcc, 0xca, 0xba, 0xbb, 0xa9, 0x09, 0x43, 0x44, 0x53, 0x33, 0x34, 0x32, 0x33,
+  0x81, 0xba, 0xcb, 0xbc, 0xbb, 0xab, 0x9a, 0x9a, 0x60, 0x35, 0x21, 0x53, 0x23, 0x22, 0x24, 0x22,
+  0x12, 0x12, 0x91, 0xfb, 0xbc, 0xbd, 0xbb, 0xbc, 0xdb, 0xcb, 0x99, 0x88, 0x18, 0x32, 0x01, 0x11,
+  0x23, 0x81, 0xc9, 0x09, 0xc0, 0xae, 0x30, 0x15, 0x80, 0x51, 0x24, 0x08, 0x75, 0x13, 0x00, 0x00,
+  0x00, 0x80, 0xab, 0x41, 0xf8, 0x9c, 0x22, 0x90, 0x41, 0x34, 0x34, 0x02, 0x41, 0x25, 0x80, 0x18,
+  0xc0, 0xbc, 0x20, 0x57, 0x43, 0x33, 0x24, 0x12, 0x21, 0x22, 0x98, 0xed, 0xbc, 0xac, 0xcb, 0xa9,
+  0x99, 0x8a, 0x80, 0x20, 0x44, 0x81, 0x21, 0x92, 0xba, 0xdc, 0xbc, 0xba, 0xcc, 0x9a, 0xb8, 0xbb,
+  0x09, 0x11, 0x23, 0x43, 0x35, 0x12, 0x31, 0x36, 0x33, 0x32, 0x35, 0x24, 0x12, 0x22, 0x03, 0xa8,
+  0xf8, 0x04, 0x21, 0x00, 0x99, 0xda, 0xcc, 0xaa, 0x8a, 0x88, 0x18, 0x55, 0x23, 0x31, 0x13, 0xa8,
+  0xfb, 0xbe, 0xbb, 0xdc, 0xbb, 0xba, 0xbb, 0x9a, 0x88, 0x52, 0x33, 0x42, 0x35, 0x23, 0x32, 0x24,
+  0x12, 0xa8, 0xbb, 0xbc, 0xeb, 0xbb, 0x89, 0x80, 0x30, 0x47, 0x43, 0x32, 0x34, 0x34, 0x22, 0x08,
+  0x81, 0xdb, 0xac, 0xaa, 0xdb, 0xbb, 0xbb, 0xaa, 0xcb, 0x8a, 0x00, 0x00, 0x62, 0x34, 0x33, 0x53,
+  0x43, 0x33, 0x13, 0x02, 0x90, 0xbd, 0x9a, 0xdb, 0x8c, 0x08, 0x08, 0x31, 0x44, 0x44, 0x33, 0x63,
+  0x23, 0x80, 0x18, 0xa8, 0xcb, 0xaa, 0xaa, 0xbb, 0xbc, 0x9b, 0xda, 0xac, 0x18, 0xb0, 0x9a, 0x90,
+  0xce, 0xac, 0x8a, 0x00, 0x98, 0x89, 0xb9, 0xdf, 0x8b, 0x21, 0xb8, 0x2a, 0x16, 0x88, 0x42, 0x44,
+  0x53, 0x22, 0x63, 0x13, 0x08, 0x34, 0xa1, 0x0b, 0x82, 0xcd, 0xba, 0xab, 0xa9, 0xbd, 0x72, 0x13,
+  0x20, 0x46, 0x02, 0x10, 0x53, 0x02, 0xa9, 0x09, 0xa0, 0x9e, 0x74, 0x34, 0x11, 0x31, 0x25, 0x81,
+  0x20, 0x03, 0xfb, 0xad, 0x9b, 0xcb, 0xbb, 0x8a, 0x98, 0x89, 0x41, 0x33, 0x12, 0x41, 0x32, 0xc9,
+  0xcd, 0xba, 0xcc, 0xac, 0xaa, 0x9a, 0xba, 0x09, 0x42, 0x23, 0x42, 0x44, 0x22, 0x10, 0x32, 0x03,
+  0x80, 0x30, 0x34, 0x80, 0x30, 0x26, 0x01, 0x32, 0x33, 0x08, 0x80, 0xa9, 0x30, 0x15, 0x80, 0x11,
+  0x32, 0x06, 0xfa, 0x9a, 0xfb, 0xdf, 0xaa, 0xaa, 0xcb, 0xaa, 0x99, 0x88, 0x10, 0x54, 0x24, 0x12,
+  0x42, 0x22, 0x80, 0x88, 0xa9, 0xdc, 0xac, 0x9a, 0xa8, 0x9a, 0x51, 0x34, 0x32, 0x55, 0x23, 0x22,
+  0x22, 0x13, 0x91, 0xbb, 0xab, 0xfd, 0xbb, 0x9a, 0xbb, 0xbb, 0x99, 0x11, 0x10, 0x52, 0x44, 0x32,
+  0x32, 0x34, 0x13, 0x88, 0x10, 0xb0, 0xbc, 0xc9, 0xbb, 0xaa, 0x9c, 0x41, 0xa1, 0x78, 0x27, 0x21,
+  0x5c, 0x01, 0x24, 0x00, 0x34, 0x22, 0x11, 0x10, 0x13, 0xd9, 0x9b, 0xc9, 0xbe, 0xab, 0x89, 0x00,
+  0x88, 0x41, 0x83, 0x18, 0x34, 0xa0, 0xcb, 0xde, 0xbb, 0xbc, 0xac, 0x89, 0xaa, 0x8b, 0x10, 0x10,
+  0x54, 0x12, 0x43, 0x13, 0x21, 0x46, 0x80, 0x88, 0x91, 0x19, 0x24, 0x11, 0x56, 0x81, 0x0a, 0x33,
+  0x91, 0x18, 0x80, 0x99, 0xcf, 0x3a, 0x27, 0x88, 0x73, 0x03, 0x98, 0x41, 0x24, 0x90, 0x8b, 0x23,
+  0xfa, 0x59, 0x37, 0x03, 0x21, 0x34, 0x13, 0x88, 0x33, 0xd1, 0xcf, 0x9a, 0xba, 0xcc, 0x99, 0x80,
+  0x9a, 0x28, 0x44, 0x11, 0x11, 0x33, 0xa0, 0xbc, 0xbb, 0xed, 0xcb, 0xaa, 0xbb, 0xaa, 0x89, 0x21,
+  0x35, 0x32, 0x34, 0x24, 0x33, 0x22, 0x11, 0x81, 0xcc, 0x09, 0x01, 0xa9, 0x40, 0x24, 0x22, 0x53,
+  0x35, 0x12, 0x00, 0x21, 0xa1, 0xbc, 0x9a, 0xca, 0xbb, 0xdb, 0xbb, 0xbb, 0xbe, 0xbc, 0xbb, 0xcc,
+  0xbc, 0x9b, 0x99, 0x99, 0x31, 0x35, 0x23, 0x42, 0x44, 0x81, 0x99, 0xa8, 0xdc, 0xac, 0xab, 0x9a,
+  0x88, 0x61, 0x35, 0x34, 0x34, 0x34, 0x43, 0x12, 0x01, 0x80, 0xcb, 0xbc, 0xab, 0xbc, 0xac, 0x8a,
+  0x00, 0x80, 0x52, 0x25, 0x01, 0x21, 0x23, 0xb8, 0xac, 0x88, 0xfa, 0xbb, 0x10, 0xa0, 0xab, 0x63,
+  0x03, 0x08, 0x53, 0x13, 0x88, 0x41, 0x24, 0x81, 0x72, 0x33, 0x01, 0x32, 0x03, 0xaa, 0x89, 0xf9,
+  0xbc, 0xab, 0xb9, 0xcb, 0x19, 0x24, 0xb9, 0x78, 0x14, 0xa8, 0x18, 0xa0, 0xce, 0xcb, 0x9a, 0xbb,
+  0xbc, 0x08, 0x98, 0x28, 0x34, 0x42, 0x44, 0x23, 0x00, 0x11, 0x90, 0xbc, 0x0b, 0x01, 0xda, 0x3a,
+  0x47, 0x13, 0x42, 0x35, 0x22, 0x80, 0x08, 0x01, 0xda, 0x9c, 0x18, 0xa1, 0x9c, 0x72, 0x24, 0x81,
+  0x40, 0x25, 0xa0, 0x0a, 0x24, 0xb9, 0x8d, 0x73, 0x33, 0x32, 0x46, 0x23, 0x00, 0x30, 0x82, 0xfb,
+  0x6b, 0x16, 0x30, 0x00, 0xbb, 0xcc, 0xac, 0x9a, 0x89, 0x89, 0x10, 0x33, 0x33, 0x44, 0x13, 0x88,
+  0xb9, 0xdf, 0xbb, 0xbc, 0xbc, 0xba, 0xaa, 0x99, 0x00, 0x44, 0x34, 0x33, 0x34, 0x12, 0x11, 0x01,
+  0xa8, 0xcb, 0xbb, 0xab, 0x9a, 0x51, 0x45, 0x33, 0x36, 0x14, 0x12, 0x22, 0x01, 0x98, 0xbb, 0xcc,
+  0xcc, 0xaa, 0xa9, 0xaa, 0xab, 0x88, 0x88, 0x88, 0x10, 0xb8, 0xcc, 0xaa, 0xba, 0xbe, 0x9a, 0xba,
+  0xbe, 0xba, 0xca, 0xba, 0xab, 0x9a, 0xbd, 0x58, 0x35, 0x43, 0x35, 0x24, 0x33, 0x63, 0x23, 0x82,
+  0x80, 0x00, 0xda, 0xab, 0x80, 0xda, 0x9b, 0x41, 0x32, 0x21, 0x54, 0x24, 0x81, 0x10, 0x03, 0xea,
+  0xbb, 0xba, 0xeb, 0xab, 0x8a, 0x08, 0x80, 0x30, 0x37, 0x12, 0x21, 0x35, 0x03, 0x00, 0x10, 0x81,
+  0xa9, 0x2a, 0x26, 0xa0, 0x48, 0x26, 0x01, 0x20, 0x24, 0x90, 0xbb, 0x18, 0xc8, 0xae, 0x18, 0x90,
+  0xbc, 0x29, 0x92, 0xcd, 0x8a, 0xb8, 0xcf, 0x9c, 0x9a, 0xbb, 0xab, 0x10, 0x81, 0x88, 0x51, 0x33,
+  0x33, 0x22, 0x12, 0xe0, 0xbf, 0x0a, 0x11, 0xa9, 0x19, 0x56, 0x34, 0x42, 0x54, 0x23, 0x08, 0x20,
+  0x13, 0xb9, 0x8a, 0x81, 0xfb, 0x9b, 0x63, 0x01, 0x38, 0x47, 0x01, 0x19, 0x43, 0x82, 0xab, 0x40,
+  0x92, 0x8b, 0x77, 0x16, 0x01, 0x21, 0x23, 0x90, 0x18, 0x02, 0xfd, 0xac, 0x99, 0xba, 0xbc, 0x18,
+  0x90, 0x99, 0x62, 0x23, 0x01, 0x20, 0x13, 0xfb, 0xac, 0xba, 0xcc, 0xbb, 0xab, 0x9a, 0x9a, 0x30,
+  0x46, 0x22, 0x42, 0x23, 0x23, 0x11, 0x89, 0xa8, 0xcd, 0x9c, 0x89, 0x98, 0x10, 0x52, 0x44, 0x33,
+  0x52, 0x23, 0x11, 0x00, 0x90, 0xda, 0xcc, 0xaa, 0xab, 0xac, 0x8a, 0x09, 0x88, 0x20, 0x43, 0x13,
+  0x00, 0x12, 0xd9, 0xbb, 0xcc, 0xad, 0xaa, 0xbc, 0x9b, 0x99, 0x9b, 0x11, 0x11, 0x53, 0x24, 0x54,
+  0x40, 0xf8, 0x24, 0x00, 0x24, 0x31, 0x25, 0x02, 0x21, 0x03, 0x99, 0x99, 0xdb, 0xab, 0xbb, 0x8b,
+  0x22, 0x28, 0x77, 0x12, 0x31, 0x25, 0x02, 0x00, 0xb8, 0xbd, 0xcb, 0xab, 0xba, 0xba, 0x8a, 0x00,
+  0x73, 0x45, 0x12, 0x32, 0x14, 0x80, 0x20, 0x81, 0xbc, 0xab, 0x80, 0xba, 0x5a, 0x47, 0x02, 0x20,
+  0x36, 0x81, 0x09, 0x12, 0xb0, 0xae, 0x09, 0xb9, 0xad, 0x09, 0x91, 0xba, 0x30, 0x92, 0xbc, 0x08,
+  0xb0, 0xdf, 0x9b, 0xaa, 0xbd, 0x8a, 0x81, 0x98, 0x28, 0x12, 0x22, 0x24, 0x00, 0x11, 0xd9, 0x8c,
+  0x53, 0x23, 0x34, 0x54, 0x35, 0x23, 0x53, 0x15, 0x81, 0x88, 0xa8, 0xaa, 0xca, 0x9b, 0x01, 0x88,
+  0x62, 0x44, 0x45, 0x22, 0x30, 0x44, 0x91, 0x09, 0x22, 0xc9, 0x9c, 0x52, 0x35, 0x33, 0x55, 0x24,
+  0x01, 0x31, 0x12, 0xc9, 0xdb, 0xcb, 0xbc, 0xbc, 0x9a, 0xaa, 0x99, 0x10, 0x32, 0x44, 0x22, 0x23,
+  0x91, 0xcd, 0xbd, 0xdb, 0xbc, 0xbb, 0xbb, 0xaa, 0x9a, 0x42, 0x43, 0x43, 0x34, 0x24, 0x12, 0x11,
+  0x88, 0xca, 0xcb, 0xba, 0x9a, 0x09, 0x31, 0x65, 0x34, 0x43, 0x43, 0x32, 0x12, 0x00, 0x88, 0xeb,
+  0xbc, 0xba, 0xcb, 0xbb, 0x89, 0x88, 0x00, 0x52, 0x24, 0x01, 0x20, 0x81, 0xeb, 0xbb, 0xcb, 0xdc,
+  0xab, 0x9a, 0xb9, 0x9a, 0x30, 0x33, 0x01, 0x64, 0x34, 0x01, 0x32, 0x33, 0x81, 0x8a, 0x53, 0x83,
+  0x89, 0x63, 0x12, 0x00, 0x41, 0x44, 0x12, 0x20, 0x63, 0x12, 0x08, 0x31, 0x12, 0xa8, 0xbd, 0x9a,
+  0xeb, 0xad, 0x8a, 0x88, 0xaa, 0x89, 0x52, 0x12, 0x00, 0x44, 0x14, 0x80, 0xaa, 0x10, 0xc0, 0xaf,
+  0x20, 0x23, 0xb9, 0x49, 0x37, 0x02, 0x19, 0x55, 0x81, 0xab, 0x38, 0x93, 0xcd, 0x08, 0x03, 0xc9,
+  0x0a, 0x34, 0xa1, 0x8c, 0x21, 0xd8, 0xac, 0x0a, 0xb8, 0xcd, 0x89, 0x90, 0x99, 0x09, 0x18, 0x88,
+  0x39, 0xfd, 0x16, 0x00, 0x19, 0x15, 0xb9, 0x0c, 0x21, 0xa8, 0x29, 0x64, 0x22, 0x31, 0x67, 0x13,
+  0x00, 0x41, 0x01, 0x10, 0x13, 0x90, 0x10, 0x01, 0x42, 0x57, 0x43, 0x01, 0x38, 0x36, 0xa1, 0x1b,
+  0x46, 0xb0, 0x9c, 0x63, 0x02, 0x10, 0x47, 0x22, 0x80, 0x30, 0x24, 0xb9, 0x8b, 0xb0, 0xef, 0x9b,
+  0x88, 0xa9, 0xaa, 0x20, 0x12, 0x08, 0x73, 0x12, 0x98, 0xbb, 0xca, 0xdd, 0xcb, 0xaa, 0xba, 0xbb,
+  0x9a, 0x28, 0x32, 0x34, 0x46, 0x12, 0x11, 0x01, 0x90, 0xa9, 0xcd, 0x9b, 0x99, 0x9a, 0x41, 0x44,
+  0x24, 0x53, 0x53, 0x12, 0x01, 0x11, 0x90, 0xdb, 0xab, 0xb9, 0xdc, 0x8a, 0x10, 0x88, 0x28, 0x44,
+  0x12, 0x08, 0x22, 0xb0, 0xce, 0x9a, 0xca, 0xcc, 0xaa, 0x89, 0xa9, 0x0a, 0x32, 0x12, 0x20, 0x45,
+  0x23, 0x98, 0x20, 0x14, 0xc9, 0x0a, 0x23, 0xa8, 0x1b, 0x56, 0x12, 0x10, 0x64, 0x13, 0x00, 0x32,
+  0x24, 0x10, 0x00, 0x32, 0xa1, 0xad, 0x18, 0xb0, 0xad, 0x89, 0x08, 0x80, 0x08, 0x65, 0x23, 0x80,
+  0x32, 0x24, 0xa8, 0x9b, 0x10, 0xfb, 0x9f, 0x08, 0x00, 0x00, 0x41, 0x35, 0x12, 0x52, 0x24, 0x01,
+  0x80, 0x98, 0xb9, 0xcc, 0xbb, 0xaa, 0x99, 0x09, 0x33, 0x36, 0x25, 0x01, 0x11, 0xa2, 0xdf, 0xab,
+  0xbb, 0xfb, 0xbb, 0x0a, 0x90, 0xbb, 0x40, 0x14, 0x80, 0x10, 0x36, 0xc1, 0xac, 0x20, 0xb0, 0xaf,
+  0x20, 0x82, 0x89, 0x62, 0x34, 0x11, 0x10, 0x45, 0x92, 0x8a, 0x32, 0xb0, 0xac, 0x20, 0x25, 0xa8,
+  0x59, 0x37, 0x80, 0x28, 0x36, 0x81, 0x8a, 0x62, 0x81, 0x8b, 0x55, 0x23, 0x88, 0x51, 0x14, 0xa8,
+  0x28, 0x14, 0xfb, 0x9b, 0x08, 0xca, 0xab, 0x11, 0x91, 0xab, 0x52, 0x04, 0xa9, 0x08, 0x91, 0xcf,
+  0xbb, 0xba, 0xbc, 0xbc, 0x9b, 0x88, 0x89, 0x20, 0x36, 0x13, 0x10, 0x21, 0x02, 0xeb, 0xaa, 0x98,
+  0xd7, 0xf7, 0x21, 0x00, 0xae, 0x08, 0x23, 0x21, 0x64, 0x44, 0x22, 0x21, 0x33, 0x02, 0x99, 0xaa,
+  0xcb, 0xbe, 0xbb, 0x89, 0x98, 0x18, 0x54, 0x22, 0x11, 0x24, 0x03, 0xba, 0xbc, 0xdc, 0xcd, 0xab,
+  0xaa, 0xbb, 0x99, 0x88, 0x00, 0x31, 0x63, 0x33, 0x31, 0x12, 0x99, 0x08, 0xfa, 0x9b, 0x11, 0xaa,
+  0x39, 0x45, 0x34, 0x23, 0x64, 0x34, 0x00, 0x41, 0x12, 0x80, 0x18, 0x10, 0x02, 0xbb, 0x30, 0x84,
+  0x8a, 0x32, 0x35, 0x25, 0xa0, 0x48, 0x15, 0xba, 0x0b, 0x21, 0xc1, 0xbf, 0x30, 0xa2, 0xbe, 0x30,
+  0x03, 0x90, 0x19, 0x47, 0x91, 0x0a, 0x35, 0x91, 0x09, 0x13, 0x80, 0xa9, 0x89, 0x32, 0x92, 0x30,
+  0x27, 0xa1, 0x38, 0x93, 0xdf, 0x00, 0xfa, 0x9c, 0x88, 0x9a, 0x89, 0xaa, 0x21, 0xd8, 0x3b, 0x27,
+  0xa9, 0x08, 0x82, 0x90, 0xca, 0x19, 0x03, 0xbf, 0x50, 0x24, 0x98, 0x71, 0x13, 0x89, 0x41, 0x12,
+  0x88, 0x9b, 0x72, 0x92, 0x8d, 0x64, 0x81, 0x19, 0x53, 0x02, 0x88, 0x31, 0x12, 0xc9, 0x1a, 0x37,
+  0x91, 0x48, 0x36, 0x81, 0x38, 0x24, 0x81, 0xaa, 0x9b, 0xda, 0xbf, 0x8a, 0xa8, 0xcb, 0x08, 0x01,
+  0x88, 0x10, 0x14, 0xc8, 0xac, 0xdb, 0xcc, 0xcb, 0xaa, 0xca, 0xaa, 0x89, 0x80, 0x20, 0x43, 0x32,
+  0x23, 0x21, 0x02, 0xda, 0xbc, 0xcb, 0xaa, 0x9a, 0x19, 0x64, 0x33, 0x35, 0x45, 0x23, 0x11, 0x22,
+  0x91, 0xcb, 0xaa, 0xdb, 0xac, 0xab, 0x09, 0x88, 0x28, 0x45, 0x12, 0x20, 0x01, 0xba, 0xbd, 0xcd,
+  0xcb, 0xbb, 0xcb, 0x9a, 0x09, 0x00, 0x11, 0x53, 0x23, 0x11, 0x02, 0x98, 0xc9, 0xad, 0x9a, 0xb9,
+  0x19, 0x35, 0x63, 0x44, 0x32, 0x34, 0x34, 0x12, 0x12, 0x22, 0x11, 0x88, 0x31, 0x24, 0x80, 0x51,
+  0x45, 0x01, 0x19, 0x43, 0xa1, 0xbd, 0x28, 0xa2, 0xcf, 0x19, 0x81, 0xaa, 0x0b, 0x43, 0xa2, 0x8d,
+  0x32, 0xff, 0x1a, 0x00, 0x15, 0xa9, 0x89, 0x12, 0xb8, 0xad, 0x30, 0x03, 0x99, 0x62, 0x34, 0x13,
+  0x20, 0x47, 0x82, 0x09, 0x00, 0x98, 0xba, 0xae, 0x08, 0xca, 0x8b, 0x02, 0x80, 0x31, 0x34, 0x43,
+  0x22, 0x82, 0xa9, 0xb9, 0xff, 0xaa, 0xbb, 0x9a, 0xc9, 0x0b, 0x37, 0x12, 0x53, 0x22, 0x32, 0x82,
+  0x0a, 0x33, 0xfb, 0x0e, 0x22, 0x01, 0x31, 0x47, 0x12, 0x21, 0x35, 0x23, 0x12, 0x20, 0x14, 0x80,
+  0x75, 0x25, 0x21, 0x53, 0x12, 0x11, 0x21, 0x91, 0xcc, 0xbc, 0xba, 0xbe, 0x9b, 0x80, 0x99, 0x18,
+  0x53, 0x02, 0x89, 0x21, 0xf8, 0xaf, 0xaa, 0xbc, 0xcb, 0xbb, 0x89, 0xa9, 0x0a, 0x35, 0x23, 0x31,
+  0x43, 0x02, 0xca, 0x9c, 0xa9, 0xce, 0x9a, 0x18, 0x80, 0x38, 0x47, 0x22, 0x32, 0x24, 0x13, 0x90,
+  0x99, 0xb9, 0xce, 0x9b, 0xaa, 0x9b, 0x08, 0x21, 0x63, 0x33, 0x33, 0x23, 0x11, 0xd8, 0xbe, 0xbb,
+  0xcd, 0xac, 0x8a, 0x99, 0x99, 0x20, 0x25, 0x00, 0x32, 0x25, 0x90, 0x9a, 0x98, 0xeb, 0xac, 0x09,
+  0x80, 0x09, 0x34, 0x35, 0x24, 0x33, 0x33, 0x14, 0x80, 0x88, 0x08, 0xb9, 0xad, 0x41, 0x24, 0x08,
+  0x73, 0x24, 0x00, 0x28, 0x11, 0xc9, 0xac, 0x08, 0xa0, 0xbd, 0x29, 0x13, 0x88, 0x51, 0x34, 0x01,
+  0x99, 0x38, 0x84, 0xdc, 0x19, 0x23, 0x90, 0x39, 0x67, 0x02, 0x18, 0x24, 0x02, 0x98, 0x08, 0x22,
+  0xe9, 0x0a, 0x13, 0xb9, 0x30, 0x12, 0x21, 0xb1, 0x0b, 0xb1, 0xff, 0x9a, 0xba, 0x99, 0xba, 0x18,
+  0xc8, 0x3a, 0x07, 0xba, 0x21, 0xe8, 0x9b, 0xa9, 0x29, 0x93, 0x0d, 0x67, 0x02, 0x28, 0x25, 0x02,
+  0x00, 0x31, 0x13, 0xca, 0x19, 0x14, 0xa9, 0x61, 0x35, 0x21, 0x42, 0x34, 0x13, 0x10, 0x55, 0x12,
+  0x10, 0x42, 0x02, 0x88, 0x31, 0x25, 0xb0, 0xab, 0x22, 0xf9, 0x9e, 0x20, 0xb0, 0xad, 0x18, 0x90,
+  0x74, 0x08, 0x1c, 0x00, 0xae, 0x19, 0xc8, 0xbe, 0x0a, 0xa9, 0xcd, 0x8a, 0x98, 0xba, 0x9d, 0x11,
+  0xa8, 0x8c, 0x00, 0xa0, 0xbc, 0x9b, 0x99, 0xfb, 0x9a, 0x20, 0x90, 0x18, 0x54, 0x32, 0x11, 0x42,
+  0x14, 0x80, 0x09, 0x98, 0xb9, 0xcb, 0x09, 0x82, 0x9a, 0x74, 0x12, 0x20, 0x35, 0xa0, 0x9a, 0x98,
+  0xce, 0xac, 0xaa, 0xba, 0xcd, 0x89, 0x01, 0xb8, 0x0a, 0x34, 0xd9, 0x8c, 0x21, 0xd8, 0xad, 0x18,
+  0x90, 0xcb, 0x28, 0x24, 0x98, 0x41, 0x37, 0x91, 0x19, 0x36, 0x91, 0x8a, 0x33, 0x90, 0x09, 0x32,
+  0x36, 0xa8, 0x69, 0x16, 0x98, 0x30, 0x13, 0x99, 0x88, 0x20, 0x91, 0xbd, 0x19, 0x90, 0x9c, 0x28,
+  0x32, 0x02, 0x09, 0x34, 0x90, 0x98, 0x9b, 0x66, 0xc1, 0x8c, 0x44, 0x81, 0x28, 0x44, 0x12, 0x10,
+  0x42, 0x25, 0x81, 0x20, 0x25, 0x90, 0x38, 0x16, 0xb8, 0x18, 0x12, 0x98, 0x28, 0x37, 0x02, 0x28,
+  0x45, 0x02, 0x89, 0x41, 0x04, 0xc9, 0x28, 0x03, 0x99, 0x29, 0x74, 0x13, 0x98, 0x72, 0x83, 0xbb,
+  0x20, 0x02, 0xaa, 0xac, 0x64, 0x02, 0x09, 0x46, 0x13, 0x08, 0x21, 0x24, 0x00, 0x54, 0x14, 0x21,
+  0x12, 0x08, 0x53, 0xb0, 0x9c, 0xa8, 0xbd, 0xca, 0xab, 0x31, 0xe8, 0x8b, 0x33, 0xe8, 0xbb, 0x09,
+  0xf9, 0xae, 0x89, 0xb9, 0xbc, 0x89, 0x88, 0xba, 0x9a, 0x32, 0xc0, 0x9d, 0x01, 0xfa, 0xab, 0x98,
+  0xba, 0xaa, 0x8a, 0x31, 0x24, 0x31, 0x55, 0x12, 0x10, 0x01, 0xb9, 0xac, 0xcc, 0x9b, 0x01, 0xcb,
+  0x60, 0x23, 0x88, 0x34, 0x01, 0x11, 0xea, 0x8c, 0xa1, 0xbe, 0x2a, 0xa1, 0xab, 0x21, 0x03, 0x11,
+  0x88, 0x51, 0xe0, 0xad, 0x08, 0xb8, 0x9b, 0x20, 0x12, 0x08, 0x73, 0x15, 0x88, 0x42, 0x81, 0x8a,
+  0x33, 0x90, 0x19, 0x46, 0x33, 0x02, 0x72, 0x34, 0x80, 0x38, 0x24, 0xa9, 0x0a, 0x35, 0x92, 0x9a,
+  0x81, 0xfd, 0x14, 0x00, 0x37, 0x91, 0x28, 0x43, 0x81, 0xba, 0x0a, 0x02, 0xde, 0x1a, 0x25, 0x80,
+  0x31, 0x35, 0x21, 0x23, 0x21, 0x45, 0xb0, 0x0b, 0x23, 0xd9, 0x19, 0x11, 0x63, 0x81, 0x49, 0x37,
+  0x91, 0x38, 0x14, 0xa8, 0x09, 0x00, 0x98, 0xbb, 0x0b, 0x35, 0xc8, 0x69, 0x35, 0x08, 0x31, 0x14,
+  0x00, 0x11, 0x99, 0x00, 0xa8, 0xcd, 0x28, 0x16, 0x80, 0x51, 0x23, 0x22, 0xa1, 0x3a, 0x47, 0xda,
+  0x39, 0x14, 0xaa, 0x31, 0x34, 0x12, 0xa9, 0x73, 0x93, 0xbd, 0x30, 0x17, 0x01, 0x51, 0x13, 0x00,
+  0x10, 0x00, 0xa0, 0xce, 0x9b, 0xeb, 0x9b, 0x88, 0x99, 0x30, 0x12, 0x18, 0x00, 0xb0, 0xff, 0xab,
+  0xba, 0xbe, 0xac, 0xa9, 0x88, 0xaa, 0x38, 0x14, 0x99, 0x30, 0x91, 0xdc, 0xac, 0xbb, 0xcb, 0xac,
+  0x89, 0x21, 0x00, 0x53, 0x25, 0x01, 0x11, 0x81, 0x99, 0xc9, 0xcc, 0xaa, 0x99, 0x89, 0x10, 0x45,
+  0x01, 0x18, 0x23, 0xb0, 0xbd, 0xbc, 0xab, 0xec, 0x8b, 0x31, 0xa0, 0x49, 0x25, 0x08, 0x00, 0xa8,
+  0x9a, 0xed, 0x9b, 0x00, 0xaa, 0x39, 0x33, 0x45, 0x81, 0x48, 0x15, 0xb8, 0x08, 0x81, 0x88, 0xba,
+  0x70, 0x14, 0x88, 0x73, 0x23, 0x80, 0x20, 0x33, 0x81, 0x9a, 0x48, 0x26, 0xc9, 0x59, 0x24, 0xa9,
+  0x41, 0x02, 0x28, 0xa1, 0x1c, 0x26, 0xdb, 0x48, 0x03, 0x8a, 0x44, 0x91, 0x20, 0x03, 0x10, 0x15,
+  0xa8, 0x30, 0x93, 0x8a, 0x55, 0x11, 0x30, 0x35, 0x81, 0x20, 0x14, 0x99, 0x20, 0x90, 0x29, 0x25,
+  0x18, 0x36, 0x02, 0x62, 0x02, 0xaa, 0x31, 0x92, 0x9a, 0x41, 0x36, 0x03, 0x60, 0x36, 0xa0, 0x0a,
+  0x23, 0xb9, 0xba, 0xab, 0x42, 0xe9, 0x59, 0x26, 0x98, 0x30, 0x03, 0x28, 0x02, 0xbb, 0x52, 0xe8,
+  0x0b, 0x33, 0xb9, 0x28, 0x12, 0x77, 0x15, 0x80, 0x43, 0xb0, 0x8c, 0x90, 0xcb, 0x99, 0xdc, 0x09,
+  0xd6, 0x05, 0x22, 0x00, 0xba, 0x30, 0x84, 0x0a, 0x02, 0xbb, 0xca, 0xde, 0x9a, 0xba, 0xbc, 0xaa,
+  0xab, 0x08, 0x01, 0x32, 0x91, 0x09, 0xe9, 0xad, 0xa8, 0xdd, 0xaa, 0xa9, 0xa9, 0x98, 0x38, 0x24,
+  0x01, 0x73, 0x81, 0xab, 0x00, 0xca, 0xaa, 0xca, 0x9b, 0x91, 0xaa, 0x73, 0x03, 0x08, 0x82, 0xcd,
+  0x89, 0xb9, 0xad, 0x99, 0xb9, 0x8a, 0x22, 0x22, 0x12, 0x09, 0x23, 0xfd, 0x8e, 0x88, 0xaa, 0x89,
+  0x09, 0x32, 0xc1, 0x69, 0x26, 0x90, 0x09, 0x22, 0x00, 0x09, 0x31, 0x83, 0xcb, 0x60, 0x35, 0x01,
+  0x40, 0x27, 0x01, 0x42, 0x23, 0x01, 0x12, 0x80, 0x32, 0xd1, 0x2b, 0x27, 0x08, 0x64, 0x13, 0x20,
+  0x43, 0x11, 0x11, 0x9a, 0x31, 0xc1, 0x0b, 0x37, 0x13, 0x21, 0x44, 0x35, 0x80, 0x30, 0x15, 0xb9,
+  0x19, 0x32, 0x02, 0x00, 0x74, 0x25, 0x10, 0x31, 0x33, 0xa0, 0x9c, 0x42, 0x92, 0x8b, 0x62, 0x33,
+  0x12, 0x71, 0x24, 0x98, 0x29, 0x02, 0xaa, 0xaa, 0xbb, 0x21, 0xd9, 0x78, 0x26, 0x88, 0x20, 0x02,
+  0x19, 0x80, 0xac, 0x08, 0xec, 0x0a, 0x90, 0x8a, 0x22, 0x08, 0x64, 0xb0, 0x0a, 0x04, 0xba, 0x00,
+  0xfc, 0x09, 0xa1, 0x9b, 0x55, 0x91, 0xab, 0x30, 0x82, 0xaa, 0x51, 0x13, 0xfa, 0xbc, 0x19, 0xa1,
+  0xbf, 0x08, 0xb8, 0xae, 0x08, 0x08, 0x88, 0xbc, 0x38, 0xc1, 0xbe, 0x09, 0xb9, 0xbd, 0xab, 0x08,
+  0xb8, 0x9c, 0x22, 0xb9, 0xbb, 0xaa, 0x99, 0xff, 0x9d, 0x81, 0xca, 0x18, 0x81, 0x8a, 0x01, 0x88,
+  0x21, 0xb8, 0x0c, 0xa0, 0xcd, 0x99, 0x98, 0xa9, 0x89, 0x43, 0x91, 0x0a, 0x93, 0xcd, 0x8a, 0x00,
+  0x81, 0x89, 0x54, 0x13, 0x89, 0x89, 0x30, 0xb3, 0xff, 0x08, 0xb8, 0x2b, 0x36, 0x02, 0x01, 0x42,
+  0x25, 0x81, 0x41, 0x02, 0x89, 0x80, 0x18, 0x37, 0x98, 0x60, 0x23, 0x18, 0x55, 0x23, 0x21, 0x43,
+  0xde, 0xfc, 0x16, 0x00, 0x01, 0x89, 0x01, 0xbb, 0x1a, 0x12, 0x73, 0x57, 0x21, 0x34, 0x24, 0x21,
+  0x13, 0x80, 0xa9, 0xab, 0x88, 0xba, 0x71, 0x27, 0x33, 0x25, 0x22, 0x22, 0xa8, 0x9a, 0xca, 0xae,
+  0x8a, 0x20, 0x41, 0x44, 0x35, 0x32, 0x22, 0x12, 0x98, 0xbb, 0xab, 0x99, 0xbd, 0x39, 0x37, 0x33,
+  0x53, 0x33, 0x12, 0x80, 0x99, 0xea, 0xbd, 0x0a, 0x81, 0x99, 0x63, 0x03, 0x08, 0x42, 0x83, 0xba,
+  0xba, 0xec, 0xab, 0x09, 0x98, 0x00, 0xba, 0x48, 0x85, 0xab, 0x21, 0xfa, 0x9f, 0x90, 0xaa, 0x08,
+  0x88, 0x40, 0x12, 0x18, 0x23, 0x12, 0x02, 0xed, 0xab, 0xb8, 0xbe, 0x1a, 0xa1, 0xab, 0x21, 0xfb,
+  0x0d, 0x90, 0xbc, 0x89, 0xfc, 0x9a, 0x90, 0xab, 0x09, 0xb8, 0x8b, 0xb8, 0xbf, 0xa9, 0xba, 0x89,
+  0xfb, 0x9b, 0xa9, 0x9b, 0x00, 0xd9, 0x9a, 0xf9, 0xac, 0x98, 0xcb, 0x9c, 0x98, 0xaa, 0x10, 0x02,
+  0x28, 0x36, 0x90, 0x20, 0xb1, 0xdf, 0x88, 0x88, 0x99, 0x88, 0x10, 0x11, 0x51, 0x24, 0x00, 0x08,
+  0xa9, 0xaa, 0xcd, 0x8c, 0x88, 0xa9, 0x51, 0x43, 0x12, 0x41, 0x33, 0x90, 0x30, 0x03, 0xaa, 0x31,
+  0x34, 0x24, 0xa9, 0x73, 0x47, 0x21, 0x34, 0x90, 0x39, 0x34, 0x43, 0x24, 0x90, 0x10, 0x81, 0x62,
+  0x25, 0x20, 0x34, 0x23, 0x32, 0x15, 0x00, 0x08, 0x10, 0x81, 0x99, 0x60, 0x35, 0x32, 0x56, 0x13,
+  0x18, 0x32, 0x01, 0x31, 0x04, 0xaa, 0x21, 0x11, 0x66, 0x34, 0x32, 0x22, 0x42, 0x22, 0x99, 0x30,
+  0xb0, 0x9d, 0x11, 0x50, 0x37, 0x23, 0x34, 0x14, 0x01, 0x81, 0xba, 0xbc, 0xbb, 0xa9, 0x0a, 0x45,
+  0x33, 0x66, 0x23, 0x00, 0x88, 0xda, 0xac, 0xab, 0x08, 0x91, 0x18, 0x22, 0x41, 0x47, 0x81, 0x20,
+  0xc0, 0xbf, 0x89, 0xa9, 0x09, 0x13, 0x21, 0x21, 0x88, 0x08, 0x10, 0xfa, 0xaf, 0x8a, 0xca, 0x1a,
+  0xd4, 0x03, 0x1a, 0x00, 0x82, 0x51, 0x14, 0x99, 0x32, 0xe9, 0x9b, 0x90, 0xce, 0x99, 0xa0, 0x99,
+  0x10, 0x80, 0x10, 0xa1, 0xbd, 0xba, 0xde, 0xaa, 0xa9, 0xbd, 0x09, 0x80, 0x08, 0x12, 0xb8, 0xdb,
+  0xcc, 0x9b, 0xb9, 0xbd, 0x9a, 0x99, 0x8a, 0x32, 0x12, 0x91, 0xcd, 0xbd, 0xdb, 0xbb, 0x99, 0x89,
+  0x22, 0xa1, 0x19, 0x27, 0x80, 0x42, 0xa1, 0xce, 0xaa, 0xaa, 0x28, 0x22, 0x44, 0x23, 0x22, 0x22,
+  0x02, 0xc8, 0xab, 0xa8, 0xef, 0x8a, 0x00, 0x28, 0x54, 0x12, 0x21, 0x11, 0xb9, 0x9c, 0x80, 0xdc,
+  0x29, 0x25, 0x18, 0x46, 0x02, 0x20, 0x02, 0x99, 0x20, 0xea, 0x19, 0x24, 0x01, 0x53, 0x44, 0x33,
+  0x81, 0x08, 0xa8, 0x1a, 0x34, 0x12, 0x02, 0xca, 0x71, 0x24, 0x42, 0x37, 0x81, 0x89, 0x81, 0xdb,
+  0x18, 0x23, 0x32, 0x24, 0x21, 0x43, 0x00, 0x61, 0x13, 0xa9, 0x88, 0xa9, 0x1a, 0x73, 0x35, 0x23,
+  0x42, 0x81, 0xaa, 0xa9, 0xbb, 0x73, 0x06, 0x08, 0x22, 0x98, 0x62, 0x83, 0x9a, 0x98, 0xdb, 0x28,
+  0x22, 0x41, 0x34, 0x91, 0x9a, 0x80, 0xeb, 0x9c, 0x80, 0xcb, 0x28, 0x03, 0x19, 0x57, 0x81, 0x9a,
+  0xb8, 0xcd, 0x8a, 0x88, 0x18, 0x01, 0x98, 0x10, 0x91, 0xab, 0xa9, 0xdf, 0xab, 0xa9, 0xbc, 0x18,
+  0x11, 0x62, 0x82, 0xba, 0xa9, 0xcd, 0x9a, 0xca, 0x9a, 0xd9, 0x9c, 0x11, 0xda, 0x58, 0x04, 0xdb,
+  0x99, 0xeb, 0x9b, 0x01, 0x09, 0x43, 0xb0, 0x9c, 0x90, 0xae, 0x20, 0xb0, 0xac, 0x99, 0xda, 0x8a,
+  0x99, 0xaa, 0x10, 0xc0, 0xaf, 0x89, 0xba, 0x48, 0x16, 0xa9, 0x18, 0xb8, 0x0c, 0x02, 0x89, 0x00,
+  0xec, 0x0a, 0x11, 0x99, 0x51, 0x35, 0x82, 0xaa, 0xc9, 0xcc, 0x09, 0x12, 0x10, 0x01, 0xaa, 0x73,
+  0x12, 0x18, 0x23, 0xc8, 0xbb, 0xbc, 0xab, 0x41, 0x35, 0x33, 0x24, 0xa1, 0x1a, 0x33, 0x02, 0xc9,
+  0x68, 0xfc, 0x0b, 0x00, 0x38, 0x04, 0x70, 0x37, 0x92, 0x18, 0x13, 0xba, 0x0b, 0x53, 0x53, 0x44,
+  0x33, 0x11, 0x10, 0x01, 0x42, 0x82, 0xbb, 0x53, 0xb0, 0x79, 0x26, 0x11, 0x32, 0x82, 0x99, 0x18,
+  0x52, 0x13, 0xa0, 0xcc, 0x09, 0x12, 0x71, 0x37, 0x92, 0x89, 0x81, 0xdb, 0x09, 0x11, 0x20, 0x34,
+  0x22, 0x34, 0x24, 0x01, 0x10, 0x90, 0xbb, 0xa9, 0xcf, 0x0b, 0x33, 0x54, 0x35, 0x92, 0x99, 0x80,
+  0xba, 0xaa, 0xcd, 0x9b, 0x11, 0x33, 0x36, 0x12, 0x98, 0x18, 0x00, 0x10, 0xb1, 0xdf, 0x18, 0xb8,
+  0x0c, 0x34, 0x22, 0x54, 0x92, 0xcc, 0xbb, 0xbd, 0x89, 0x00, 0x88, 0x89, 0x41, 0x36, 0x22, 0x11,
+  0x91, 0xcb, 0xbb, 0xcc, 0xcc, 0xaa, 0xa9, 0x18, 0x43, 0x12, 0x44, 0x82, 0x9a, 0x90, 0xbd, 0xbb,
+  0xcf, 0x9b, 0x09, 0x98, 0x20, 0x25, 0x10, 0x21, 0xe9, 0xaa, 0xd9, 0xbd, 0x99, 0xc9, 0x8b, 0x21,
+  0x11, 0x22, 0x82, 0x30, 0xd2, 0xbf, 0x9a, 0xca, 0x8a, 0x41, 0x11, 0x01, 0x33, 0x93, 0xcd, 0xbb,
+  0xce, 0x99, 0x98, 0x89, 0x10, 0x08, 0x41, 0x12, 0xb8, 0xce, 0x9b, 0x98, 0x8a, 0x63, 0x90, 0x29,
+  0x47, 0x22, 0x82, 0xcb, 0xbc, 0xab, 0x19, 0x34, 0x01, 0x11, 0x31, 0x45, 0x12, 0x99, 0x98, 0xcb,
+  0x08, 0xa9, 0x38, 0x24, 0x41, 0x15, 0x98, 0x20, 0xd9, 0x0a, 0x13, 0xab, 0x73, 0x25, 0x01, 0x42,
+  0x13, 0xba, 0x9c, 0xa9, 0x70, 0x35, 0x81, 0x41, 0x33, 0x22, 0x24, 0xda, 0xab, 0x28, 0x33, 0x25,
+  0x11, 0x80, 0x99, 0x52, 0x23, 0x12, 0xc9, 0xae, 0x19, 0x21, 0x46, 0x14, 0x81, 0x11, 0x34, 0x34,
+  0x34, 0x81, 0xbb, 0xab, 0x89, 0x32, 0x91, 0x60, 0x47, 0x12, 0x01, 0xd9, 0xbc, 0x08, 0x12, 0x23,
+  0x83, 0xba, 0x99, 0x8b, 0x67, 0x03, 0xca, 0xaa, 0xbc, 0x0b, 0x45, 0x32, 0x43, 0x13, 0xa8, 0xbd,
+  0x2e, 0x02, 0x18, 0x00, 0xbc, 0x8a, 0x98, 0xa9, 0x28, 0x33, 0x76, 0x43, 0x00, 0x08, 0xb8, 0xbc,
+  0x08, 0x98, 0x11, 0x02, 0x31, 0x26, 0xc9, 0x0a, 0x01, 0xaa, 0x40, 0x14, 0xeb, 0x8a, 0x98, 0xdb,
+  0x9a, 0x9a, 0x31, 0x82, 0xbd, 0x9b, 0xcc, 0x9b, 0x11, 0x80, 0x30, 0x93, 0xdd, 0xba, 0x9c, 0x51,
+  0x34, 0x80, 0xdb, 0xce, 0xaa, 0x10, 0x32, 0x24, 0x81, 0xca, 0xcc, 0xba, 0x09, 0x12, 0x12, 0x22,
+  0xe9, 0xac, 0x98, 0xba, 0x10, 0x12, 0x80, 0xca, 0xcf, 0x9a, 0x30, 0x45, 0x33, 0x81, 0xba, 0xcb,
+  0xcb, 0x8a, 0xba, 0x1a, 0x46, 0x32, 0x42, 0x91, 0x9c, 0x10, 0x81, 0x11, 0xd1, 0xce, 0xaa, 0x09,
+  0x42, 0x43, 0x33, 0x12, 0x91, 0xb9, 0xbb, 0xde, 0x9b, 0x18, 0x00, 0x21, 0x23, 0x31, 0x35, 0x12,
+  0x91, 0xfd, 0xac, 0x9a, 0x08, 0x52, 0x25, 0x82, 0x88, 0x80, 0x09, 0x01, 0x81, 0x99, 0x8a, 0x73,
+  0x35, 0x43, 0x13, 0x99, 0xa9, 0xdb, 0x29, 0x24, 0x81, 0x20, 0x23, 0x10, 0x33, 0x91, 0x1b, 0x36,
+  0x90, 0x74, 0x92, 0x1b, 0x57, 0x80, 0x0a, 0x01, 0xdb, 0x1a, 0x22, 0x00, 0x98, 0xa9, 0x70, 0x36,
+  0x12, 0x80, 0xc9, 0xbe, 0x09, 0x81, 0x40, 0x45, 0x12, 0x00, 0xc9, 0xcb, 0x99, 0x00, 0x11, 0x82,
+  0xa8, 0x31, 0x34, 0x11, 0x81, 0xdb, 0x28, 0x35, 0x22, 0xa0, 0xff, 0xaa, 0x8a, 0x08, 0x54, 0x33,
+  0x13, 0x01, 0xda, 0xad, 0x9a, 0x89, 0x11, 0x23, 0x03, 0xd9, 0x8b, 0x21, 0x53, 0x24, 0xa0, 0xbc,
+  0xcb, 0x8a, 0x31, 0x24, 0x22, 0x90, 0x99, 0xda, 0xac, 0x88, 0x08, 0x34, 0xa3, 0xce, 0xbd, 0xac,
+  0x89, 0x10, 0x22, 0x43, 0x22, 0x00, 0xa8, 0xcb, 0x0a, 0x23, 0x63, 0x24, 0xd8, 0xbd, 0xdb, 0xba,
+  0x89, 0x31, 0x33, 0x11, 0x32, 0x12, 0xd9, 0xef, 0x9b, 0x18, 0x31, 0x35, 0x80, 0xcb, 0xbc, 0x09,
+  0xef, 0xfe, 0x15, 0x00, 0x32, 0x22, 0x82, 0xba, 0xcb, 0xbc, 0x0a, 0x23, 0x82, 0xb9, 0xdd, 0xbc,
+  0xaa, 0x98, 0x72, 0x35, 0x33, 0x14, 0xb8, 0xad, 0x08, 0x00, 0x80, 0xdb, 0xbc, 0x08, 0x31, 0x45,
+  0x12, 0x00, 0x01, 0xb9, 0xad, 0xbb, 0x9b, 0x9a, 0x51, 0x37, 0x13, 0x08, 0xa8, 0xdc, 0x09, 0x11,
+  0xa9, 0x89, 0x38, 0x47, 0x33, 0x33, 0x11, 0x98, 0xdb, 0xab, 0x0a, 0x30, 0x04, 0xa8, 0x08, 0x28,
+  0x77, 0x24, 0xa8, 0xaa, 0x9a, 0x39, 0x47, 0x22, 0x90, 0xcc, 0xbb, 0x9a, 0x20, 0x34, 0x43, 0x24,
+  0x13, 0xa8, 0xbb, 0x9b, 0x31, 0x43, 0x82, 0xff, 0x9d, 0x88, 0x10, 0x43, 0x33, 0x11, 0x00, 0xaa,
+  0x9a, 0x98, 0xbb, 0x0a, 0x01, 0xda, 0x8b, 0x53, 0x53, 0x45, 0x33, 0x22, 0x81, 0xed, 0xbc, 0x9a,
+  0x19, 0x21, 0x22, 0x90, 0x09, 0x54, 0x44, 0x23, 0x82, 0xb9, 0xbb, 0xcd, 0xab, 0x9a, 0x9a, 0x99,
+  0x88, 0x42, 0x24, 0x01, 0x41, 0x92, 0xcc, 0xba, 0xcd, 0x1a, 0x43, 0x13, 0x21, 0x90, 0xdc, 0xbb,
+  0x89, 0x31, 0x55, 0x33, 0x90, 0xcd, 0xbb, 0x89, 0x20, 0x54, 0x33, 0x01, 0xb9, 0xbc, 0xca, 0xcb,
+  0x8a, 0x41, 0x63, 0x22, 0x12, 0xb9, 0xaf, 0x09, 0x00, 0x98, 0x00, 0x31, 0x34, 0x02, 0xca, 0xdd,
+  0xbb, 0x18, 0x53, 0x33, 0x25, 0x02, 0xa8, 0xdb, 0xbc, 0x09, 0x11, 0x43, 0x33, 0x02, 0xd9, 0xbd,
+  0xba, 0xbb, 0x29, 0x46, 0x22, 0x81, 0x98, 0xaa, 0x0a, 0x32, 0x23, 0xa0, 0xff, 0x9a, 0x09, 0x08,
+  0x32, 0x01, 0x54, 0x14, 0x00, 0xa9, 0xcd, 0x9a, 0x89, 0x08, 0x43, 0x32, 0x63, 0x34, 0x13, 0xb0,
+  0xdc, 0xab, 0x8a, 0x31, 0x33, 0xe8, 0xbc, 0x9b, 0x51, 0x35, 0x23, 0x90, 0xdb, 0xbb, 0x9a, 0x10,
+  0x43, 0x01, 0xba, 0xab, 0x29, 0x55, 0x43, 0x22, 0x12, 0xa0, 0xaa, 0x19, 0x98, 0xa9, 0xd9, 0xbd,
+  0xeb, 0xff, 0x0c, 0x00, 0xbc, 0x8b, 0x32, 0x36, 0x23, 0x01, 0x31, 0x44, 0x12, 0x21, 0x11, 0xd9,
+  0xbd, 0xac, 0xac, 0x09, 0x01, 0x00, 0x80, 0x49, 0x77, 0x02, 0x98, 0xca, 0xac, 0x9b, 0x08, 0x21,
+  0x01, 0xb9, 0xcc, 0x29, 0x57, 0x33, 0x82, 0xea, 0xbb, 0x8a, 0x18, 0x43, 0x81, 0x9a, 0x89, 0x11,
+  0x53, 0x81, 0x9a, 0x22, 0x81, 0xca, 0xcd, 0x09, 0x24, 0x12, 0x01, 0xdc, 0x1a, 0x47, 0x12, 0x88,
+  0x98, 0xcb, 0xaa, 0x8a, 0x18, 0x53, 0x11, 0x08, 0x80, 0xaa, 0xba, 0xcc, 0x09, 0x62, 0x35, 0x81,
+  0x08, 0x32, 0x81, 0xfb, 0xcb, 0x8a, 0x21, 0x53, 0x33, 0x13, 0xa9, 0xdb, 0xcc, 0xad, 0x18, 0x11,
+  0x01, 0x12, 0x11, 0x73, 0x24, 0x21, 0x33, 0xd0, 0xbd, 0xcc, 0x8a, 0x31, 0x11, 0x11, 0x91, 0xaa,
+  0x10, 0x21, 0x45, 0x23, 0x00, 0xc9, 0xce, 0xba, 0x9a, 0x20, 0x33, 0x43, 0x11, 0x98, 0x99, 0x19,
+  0x57, 0x12, 0xaa, 0x29, 0x65, 0x23, 0x91, 0xdb, 0xab, 0x20, 0x43, 0x22, 0x90, 0xbb, 0xa9, 0xdd,
+  0xab, 0x89, 0x73, 0x33, 0x01, 0xdc, 0xad, 0x8a, 0x10, 0x43, 0x23, 0xa8, 0xa9, 0xaa, 0x31, 0x04,
+  0xda, 0xbc, 0x8b, 0x31, 0x25, 0x01, 0x98, 0x99, 0xa9, 0x38, 0x27, 0x98, 0xa9, 0xeb, 0xcc, 0xaa,
+  0x28, 0x65, 0x33, 0x22, 0x01, 0xca, 0x9a, 0x99, 0x9a, 0xa9, 0xbc, 0x50, 0x34, 0x21, 0xa2, 0xbf,
+  0x0b, 0x10, 0x32, 0x23, 0x98, 0xcb, 0xac, 0x8a, 0x73, 0x33, 0x01, 0xa8, 0xdc, 0x1a, 0x45, 0x23,
+  0x91, 0xcb, 0xcc, 0xaa, 0x18, 0x22, 0x45, 0x23, 0xb8, 0xcb, 0x9b, 0x20, 0x23, 0xb9, 0xde, 0x9c,
+  0x30, 0x14, 0x12, 0x90, 0x9a, 0x21, 0x13, 0x11, 0xa8, 0x0a, 0xc0, 0xcf, 0xbb, 0x8a, 0x73, 0x27,
+  0x02, 0x88, 0x99, 0x00, 0x12, 0x91, 0xa9, 0x8b, 0x72, 0x13, 0xca, 0xbc, 0xad, 0x29, 0x45, 0x32,
+  0xa6, 0x00, 0x13, 0x00, 0xa0, 0xbd, 0xac, 0x89, 0x18, 0x22, 0x90, 0x9b, 0x09, 0x62, 0x46, 0x02,
+  0xa8, 0xcd, 0xbc, 0x19, 0x43, 0x24, 0xa1, 0xdb, 0xaa, 0x28, 0x53, 0x24, 0x01, 0xb9, 0xbb, 0xbc,
+  0x09, 0x73, 0x33, 0x01, 0xca, 0xcb, 0x89, 0x21, 0x33, 0x12, 0x01, 0xb8, 0xcc, 0x9b, 0x09, 0x31,
+  0x33, 0x91, 0xbd, 0xab, 0x99, 0x18, 0x33, 0x52, 0x55, 0x45, 0x33, 0x01, 0xda, 0xcd, 0x99, 0x10,
+  0x01, 0x81, 0xaa, 0xab, 0xbb, 0x1a, 0x54, 0x43, 0x34, 0x13, 0xa8, 0x99, 0xdc, 0xbd, 0xab, 0x88,
+  0x53, 0x14, 0x91, 0x88, 0xa8, 0x89, 0x30, 0x54, 0x03, 0xca, 0xcb, 0xcb, 0x1a, 0x53, 0x02, 0x80,
+  0xa8, 0xbb, 0x30, 0x33, 0x44, 0x23, 0xa9, 0xdb, 0xab, 0x72, 0x25, 0x80, 0xbb, 0xbc, 0xab, 0x48,
+  0x45, 0x02, 0x00, 0x80, 0xa9, 0x99, 0x72, 0x45, 0x23, 0xa1, 0xec, 0xbb, 0x9a, 0x30, 0x43, 0x22,
+  0x11, 0x80, 0x10, 0xa1, 0xdb, 0xbc, 0xbc, 0x09, 0x22, 0x33, 0x12, 0x90, 0xeb, 0x8a, 0x53, 0x91,
+  0xeb, 0xcc, 0xab, 0x08, 0x73, 0x24, 0x12, 0x98, 0x99, 0x00, 0x22, 0x23, 0x81, 0xfb, 0xaf, 0x9a,
+  0x00, 0x22, 0x23, 0x01, 0x21, 0x43, 0x03, 0xb9, 0xcf, 0xba, 0x9b, 0x80, 0x09, 0x72, 0x35, 0x13,
+  0x81, 0xa9, 0x0a, 0x32, 0x92, 0xdd, 0xbd, 0xbc, 0x9a, 0x18, 0x52, 0x43, 0x81, 0xa9, 0xca, 0x89,
+  0x11, 0x00, 0x80, 0xa9, 0xbb, 0x9a, 0x74, 0x46, 0x24, 0x02, 0xd9, 0xab, 0x89, 0x28, 0x01, 0xa9,
+  0xcb, 0xab, 0x71, 0x43, 0x12, 0x81, 0xda, 0x9a, 0x31, 0x37, 0x01, 0xda, 0xbc, 0xab, 0x29, 0x44,
+  0x43, 0x01, 0xa8, 0xba, 0x9a, 0x29, 0x34, 0x04, 0xb9, 0xbc, 0xbb, 0x28, 0x44, 0x12, 0x10, 0x11,
+  0x53, 0x24, 0x01, 0xfb, 0xcb, 0x9a, 0x99, 0x30, 0x43, 0x81, 0x98, 0xbb, 0x1a, 0x46, 0x22, 0xb0,
+  0xf4, 0xff, 0x09, 0x00, 0xaf, 0x18, 0x33, 0x22, 0xa0, 0xba, 0x19, 0x63, 0x23, 0xa0, 0x0a, 0x90,
+  0xdc, 0xbc, 0xbc, 0x39, 0x47, 0x33, 0x13, 0x90, 0xcb, 0xaa, 0xab, 0x1a, 0x12, 0x90, 0x19, 0x11,
+  0x11, 0x33, 0x25, 0x00, 0x99, 0xfb, 0xbb, 0xaa, 0x89, 0x89, 0xdd, 0x9c, 0x28, 0x55, 0x23, 0x13,
+  0xb8, 0xbf, 0xbb, 0x29, 0x45, 0x24, 0x81, 0xca, 0xac, 0x18, 0x53, 0x22, 0xa8, 0xcb, 0x9a, 0x89,
+  0x11, 0x12, 0x11, 0x51, 0x35, 0x02, 0x9a, 0xba, 0xce, 0x8a, 0x31, 0x43, 0x23, 0x91, 0x89, 0x30,
+  0x45, 0x13, 0xb8, 0xbf, 0xad, 0x99, 0x00, 0x80, 0xa9, 0xa8, 0xcc, 0x1b, 0x53, 0x43, 0x22, 0xc9,
+  0xbb, 0x29, 0x55, 0x13, 0xa0, 0xdb, 0xac, 0x09, 0x31, 0x33, 0x01, 0x00, 0x21, 0x90, 0xdb, 0xab,
+  0x53, 0x22, 0x21, 0x91, 0xec, 0xdb, 0xaa, 0x00, 0x31, 0x35, 0x23, 0x00, 0xb9, 0xbc, 0x0b, 0x31,
+  0x37, 0x43, 0x92, 0xfb, 0xac, 0x9a, 0x31, 0x43, 0x33, 0x82, 0xbb, 0x0b, 0x21, 0x53, 0x33, 0xa1,
+  0xbd, 0x31, 0x15, 0x99, 0xbc, 0xbf, 0x9a, 0x00, 0x22, 0x33, 0x00, 0xd9, 0xcf, 0xac, 0x09, 0x43,
+  0x44, 0x22, 0x91, 0xca, 0xcb, 0x99, 0x21, 0x43, 0x32, 0x02, 0xa9, 0x9a, 0x10, 0x45, 0x34, 0x92,
+  0xdc, 0xac, 0xaa, 0x09, 0x10, 0x01, 0x12, 0xa0, 0x19, 0xa0, 0xbb, 0x53, 0x03, 0x11, 0x12, 0x90,
+  0xfb, 0xcb, 0xbb, 0x8a, 0x42, 0x23, 0x43, 0x12, 0x31, 0x92, 0x0a, 0x73, 0x12, 0x11, 0xb0, 0xdd,
+  0xbc, 0x9a, 0x33, 0x25, 0x22, 0x11, 0x01, 0x98, 0x52, 0x35, 0x82, 0x99, 0xcb, 0x9a, 0x81, 0x09,
+  0xe9, 0xbd, 0x0a, 0x11, 0x11, 0xc9, 0xcd, 0xab, 0x18, 0x44, 0x02, 0xb8, 0xcc, 0xac, 0x19, 0x44,
+  0x24, 0x80, 0xa8, 0x99, 0x09, 0x21, 0x45, 0x33, 0xb8, 0xbd, 0xac, 0x09, 0x43, 0x03, 0xdb, 0xbb,
+  0xce, 0xff, 0x08, 0x00, 0x52, 0x24, 0x12, 0xa9, 0x9a, 0x10, 0x32, 0x35, 0x14, 0x81, 0xdb, 0xbd,
+  0xbb, 0x41, 0x36, 0x91, 0xcb, 0xab, 0x18, 0x43, 0x23, 0xb0, 0xcc, 0xba, 0x99, 0x52, 0x13, 0x98,
+  0xca, 0x9b, 0x42, 0x46, 0x33, 0x90, 0xdc, 0xcb, 0x9b, 0x08, 0x32, 0x14, 0x90, 0x99, 0x09, 0x73,
+  0x23, 0xb8, 0xeb, 0xbb, 0x18, 0x33, 0x35, 0x33, 0x80, 0xdb, 0xac, 0x1a, 0x32, 0x53, 0x01, 0xa9,
+  0xb9, 0x09, 0x53, 0x02, 0x90, 0xc9, 0x2a, 0x54, 0x33, 0x12, 0xdc, 0xbc, 0xad, 0x38, 0x46, 0x23,
+  0x91, 0xcd, 0x9b, 0x00, 0x42, 0x33, 0x01, 0xba, 0xbf, 0xaa, 0x99, 0x28, 0x43, 0x12, 0x01, 0x00,
+  0x01, 0xb9, 0x8b, 0x43, 0x45, 0x14, 0xd9, 0xbe, 0x9b, 0x18, 0x53, 0x33, 0x22, 0x80, 0x88, 0x98,
+  0xaa, 0xbb, 0xbb, 0xbc, 0x19, 0x13, 0x90, 0x29, 0x33, 0x44, 0x12, 0x32, 0x14, 0xfa, 0xbc, 0xbc,
+  0xbb, 0x08, 0x33, 0x36, 0x23, 0x80, 0x18, 0xc9, 0xbb, 0x9a, 0xbb, 0x71, 0x12, 0x98, 0x8a, 0x98,
+  0x41, 0x45, 0x14, 0x81, 0x80, 0xea, 0xcb, 0xab, 0x8a, 0x00, 0x11, 0x33, 0x24, 0x22, 0x43, 0x02,
+  0xba, 0xbc, 0xbd, 0x0b, 0x43, 0x43, 0x13, 0xa0, 0xbb, 0x39, 0x46, 0x33, 0x13, 0xdb, 0xcd, 0xbb,
+  0x20, 0x35, 0x02, 0x98, 0xaa, 0x8a, 0x10, 0x32, 0x23, 0xba, 0x99, 0x31, 0x45, 0x22, 0xa8, 0xbc,
+  0x0b, 0x53, 0x33, 0x82, 0xcb, 0xcb, 0x99, 0x00, 0x32, 0x43, 0x12, 0xea, 0xbd, 0x8b, 0x80, 0x19,
+  0x32, 0x12, 0x90, 0xfb, 0xcb, 0x9b, 0x19, 0x44, 0x24, 0x13, 0x81, 0xa9, 0xab, 0x29, 0x44, 0x01,
+  0xdc, 0xbc, 0xab, 0x8a, 0x62, 0x35, 0x23, 0x01, 0x89, 0x00, 0xb8, 0xdb, 0xab, 0x9b, 0x63, 0x33,
+  0x91, 0xdb, 0x9a, 0x30, 0x34, 0x14, 0x90, 0xa9, 0xfb, 0xaa, 0xab, 0x19, 0x34, 0x24, 0x90, 0xce,
+  0xd8, 0xff, 0x0a, 0x00, 0x9a, 0x11, 0x34, 0x24, 0x01, 0x99, 0x99, 0x98, 0xaa, 0x29, 0x44, 0x02,
+  0xb9, 0xcb, 0x31, 0x37, 0x22, 0x90, 0xba, 0xcc, 0xbb, 0xbd, 0xac, 0x18, 0x34, 0x14, 0x81, 0x99,
+  0x18, 0x20, 0x34, 0x93, 0xce, 0xaa, 0x89, 0x21, 0x34, 0x03, 0xca, 0xbc, 0x89, 0x53, 0x43, 0x91,
+  0xba, 0x0b, 0x43, 0x82, 0xb9, 0x1a, 0x63, 0x43, 0x44, 0x02, 0xa8, 0xba, 0xab, 0x89, 0x99, 0x31,
+  0x92, 0xba, 0xbc, 0x9b, 0x42, 0x33, 0xb9, 0xbe, 0xbc, 0xad, 0x18, 0x33, 0x12, 0x80, 0x30, 0x35,
+  0x12, 0x02, 0xba, 0xae, 0x0a, 0x11, 0x42, 0x33, 0xb1, 0xbe, 0x9b, 0x30, 0x57, 0x13, 0x91, 0xeb,
+  0xba, 0x89, 0x10, 0x20, 0x22, 0x23, 0x9a, 0x9a, 0xdb, 0x30, 0x36, 0x02, 0xb9, 0xcc, 0xab, 0x98,
+  0x99, 0xba, 0x30, 0x37, 0x14, 0x98, 0xcb, 0xa9, 0x10, 0x32, 0x33, 0x14, 0xb8, 0xbf, 0xbb, 0x0a,
+  0x61, 0x34, 0x14, 0xa8, 0xca, 0xab, 0x09, 0x31, 0x45, 0x02, 0xa8, 0xca, 0xbb, 0x99, 0x11, 0x09,
+  0x21, 0x23, 0x21, 0x11, 0x31, 0x33, 0x35, 0x24, 0xa0, 0xbb, 0xbc, 0xba, 0xbc, 0x9c, 0x00, 0x41,
+  0x54, 0x32, 0x22, 0x80, 0xaa, 0xaa, 0x99, 0x99, 0xdb, 0x9b, 0x19, 0x51, 0x43, 0x22, 0x90, 0xba,
+  0x30, 0x14, 0xc9, 0xbc, 0xbc, 0xaa, 0x10, 0x73, 0x11, 0x01, 0xb9, 0xcb, 0x18, 0x53, 0x25, 0x01,
+  0xd9, 0xdb, 0x9a, 0x11, 0x02, 0x01, 0x90, 0x90, 0x31, 0x43, 0x91, 0xbb, 0x1a, 0x01, 0x99, 0x21,
+  0x23, 0x32, 0x43, 0x12, 0xaa, 0x19, 0x11, 0xba, 0xbb, 0x9a, 0x99, 0x09, 0xa9, 0xdb, 0x9a, 0x8a,
+  0x10, 0x53, 0x33, 0x91, 0xdd, 0x9a, 0x19, 0x32, 0x23, 0x13, 0xa0, 0xaa, 0x09, 0x31, 0x01, 0xa9,
+  0x10, 0x32, 0x35, 0x81, 0x98, 0x9a, 0xbb, 0xbb, 0x31, 0x43, 0x22, 0x13, 0xba, 0x9d, 0x20, 0x23,
+  0x13, 0x00, 0x00, 0x00, 0xbb, 0x9c, 0x19, 0x21, 0x23, 0x11, 0x00, 0x21, 0x12, 0x11, 0x01, 0x90,
+  0xbb, 0xbc, 0x19, 0x53, 0x33, 0x82, 0xbb, 0xbd, 0xaa, 0x10, 0x33, 0x02, 0xba, 0xbd, 0xab, 0x99,
+  0x09, 0x99, 0x20, 0x73, 0x22, 0x11, 0x00, 0x09, 0x9a, 0x09, 0x00, 0x90, 0x00, 0x11, 0x11, 0x90,
+  0x9b, 0x20, 0x23, 0x90, 0xba, 0x9a, 0x9a, 0xab, 0xba, 0xbd, 0x0a, 0x62, 0x24, 0x12, 0x98, 0xaa,
+  0x0a, 0x21, 0x33, 0x33, 0x13, 0x12, 0x01, 0x09, 0x11, 0x91, 0xba, 0xbb, 0x19, 0x01, 0x99, 0x99,
+  0x99, 0x09, 0x11, 0x12, 0x99, 0x00, 0x90, 0xbb, 0x0b, 0x53, 0x33, 0x01, 0xba, 0xbd, 0xa9, 0x10,
+  0x01, 0x90, 0xa9, 0x99, 0x09, 0x00, 0x10, 0x11, 0x91, 0xba, 0x99, 0x32, 0x02, 0xb9, 0xbb, 0x09,
+  0x33, 0x26, 0x01, 0xa9, 0xba, 0xbb, 0x09, 0x32, 0x35, 0x12, 0x99, 0x9a, 0x19, 0x32, 0x33, 0x13,
+  0xeb, 0xbb, 0x9b, 0x20, 0x53, 0x23, 0x91, 0xba, 0x99, 0x19, 0x90, 0xba, 0xbc, 0x9a, 0x53, 0x43,
+  0x02, 0xba, 0xbc, 0x09, 0x63, 0x33, 0x02, 0xba, 0xcd, 0xbb, 0x99, 0x12, 0x53, 0x13, 0x91, 0xbb,
+  0x9c, 0x11, 0x33, 0x12, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x90, 0xa9, 0x10, 0x53, 0x12, 0xa0,
+  0xbd, 0x8b, 0x51, 0x44, 0x22, 0x91, 0xcb, 0xbc, 0x9b, 0x08, 0x10, 0x11, 0x91, 0x9a, 0x0a, 0x31,
+  0x33, 0x33, 0x01, 0x99, 0x9a, 0xbb, 0xbe, 0x9a, 0x19, 0x32, 0x27, 0x22, 0x12, 0x90, 0xa0, 0xbb,
+  0xbc, 0xbb, 0xab, 0x21, 0x11, 0xb9, 0x19, 0x53, 0x33, 0x80, 0xb9, 0xba, 0xbb, 0xab, 0x09, 0x01,
+  0x09, 0x31, 0x33, 0x33, 0x90, 0x99, 0x9a, 0xbb, 0xbb, 0xab, 0x31, 0x33, 0x14, 0x91, 0x90, 0x00,
+  0x31, 0x12, 0x91, 0xb9, 0xa9, 0xaa, 0x99, 0x10, 0x01, 0x00, 0x01, 0x90, 0x9a, 0x19, 0x12, 0x11,
+  0xfe, 0xff, 0x00, 0x00, 0xa0, 0xbb, 0x9c, 0x20, 0x33, 0x13, 0x91, 0xa9, 0x19, 0x33, 0x33, 0x23,
+  0xa0, 0xbb, 0xbb, 0x31, 0x23, 0xb9, 0xcb, 0x0a, 0x31, 0x43, 0x12, 0x11, 0xa0, 0x99, 0x10, 0x33,
+  0x13, 0x99, 0xab, 0xa9, 0x00, 0x11, 0x13, 0x02, 0x90, 0x09, 0x01, 0x90, 0x99, 0xaa, 0xa9, 0x00,
+  0x00, 0xa9, 0xab, 0x09, 0x11, 0x11, 0x90, 0xaa, 0x9a, 0x99, 0x19, 0x23, 0x32, 0x12, 0xa9, 0x9a,
+  0x10, 0x23, 0x91, 0xbb, 0xbb, 0x9a, 0x31, 0x63, 0x22, 0x90, 0xba, 0xbb, 0x09, 0x31, 0x12, 0x12,
+  0x11, 0x01, 0x00, 0x90, 0x99, 0x9a, 0x09, 0x11, 0x90, 0x99, 0x9a, 0x10, 0x11, 0x12, 0x12, 0x02,
+  0xb9, 0xdb, 0xab, 0x09, 0x31, 0x25, 0x11, 0x90, 0x99, 0x09, 0x00, 0x10, 0x11, 0x12, 0x01, 0x00,
+  0x90, 0x10, 0x21, 0x12, 0x12, 0x90, 0xbb, 0xbb, 0xab, 0x99, 0x11, 0x13, 0x90, 0x99, 0x09, 0x11,
+  0x21, 0x12, 0x91, 0xaa, 0x9a, 0x99, 0x10, 0x11, 0x00, 0x90, 0x09, 0x11, 0x31, 0x12, 0xa0, 0xbb,
+  0x0a, 0x21, 0x01, 0x00, 0x90, 0x10, 0x32, 0x43, 0x12, 0x00, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9b,
+  0x9a, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0xba, 0xcb, 0x0a, 0x10, 0x11, 0x11, 0x11, 0x11, 0x22,
+  0x31, 0x21, 0x90, 0x99, 0x9a, 0x9a, 0x19, 0x11, 0x91, 0x99, 0x09, 0x32, 0x24, 0x92, 0xba, 0xad,
+  0x99, 0x00, 0x11, 0x90, 0x9a, 0x21, 0x33, 0x24, 0x11, 0x91, 0xb9, 0xab, 0x9a, 0x99, 0xa9, 0xa9,
+  0x19, 0x31, 0x22, 0x01, 0x09, 0x99, 0x99, 0x99, 0x00, 0x09, 0x90, 0xa9, 0xa9, 0x09, 0x31, 0x43,
+  0x12, 0x99, 0xbb, 0xab, 0x19, 0x11, 0x01, 0x10, 0x00, 0x99, 0x99, 0x99, 0x11, 0x11, 0x99, 0x9a,
+  0x9a, 0x00, 0x11, 0x23, 0x22, 0x22, 0x12, 0x90, 0x9a, 0x9a, 0x99, 0x99, 0x99, 0x99, 0x99, 0x11,
+  0xfe, 0xff, 0x00, 0x00, 0x33, 0x13, 0x91, 0xbb, 0x99, 0x10, 0x90, 0x99, 0x19, 0x11, 0x12, 0x13,
+  0x12, 0x00, 0x09, 0x00, 0x90, 0xaa, 0x9a, 0x9a, 0x11, 0x21, 0x11, 0x01, 0x00, 0x99, 0xaa, 0x9a,
+  0x19, 0x23, 0x12, 0xb9, 0x9a, 0x9a, 0x11, 0x12, 0x11, 0xa9, 0xaa, 0x09, 0x21, 0x11, 0x01, 0x00,
+  0x11, 0x00, 0x01, 0x11, 0x00, 0x99, 0x99, 0x10, 0x10, 0x00, 0x00, 0x11, 0x11, 0x91, 0xb9, 0x99,
+  0x99, 0x99, 0x99, 0x19, 0x21, 0x01, 0x09, 0x10, 0x11, 0x12, 0x00, 0x90, 0xa9, 0xa9, 0x10, 0x21,
+  0x11, 0x01, 0x01, 0x11, 0x11, 0x00, 0x90, 0xa9, 0x99, 0x10, 0x00, 0x10, 0x11, 0x12, 0x11, 0x90,
+  0x00, 0x01, 0x90, 0xa9, 0x99, 0x00, 0x11, 0x00, 0x11, 0x11, 0x01, 0x11, 0x00, 0x99, 0x99, 0x99,
+  0x99, 0x11, 0x12, 0x90, 0x9a, 0x19, 0x11, 0x11, 0x90, 0x99, 0xa9, 0xaa, 0x99, 0x99, 0x00, 0x90,
+  0x99, 0x00, 0x21, 0x22, 0x12, 0x91, 0x9a, 0x99, 0x10, 0x11, 0x90, 0x09, 0x10, 0x11, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x99, 0xa9, 0xa9, 0x09, 0x10, 0x22, 0x11, 0x90, 0x9a, 0x10,
+  0x11, 0x11, 0x11, 0x21, 0x01, 0x90, 0x00, 0x00, 0x99, 0x99, 0x09, 0x00, 0x00, 0x09, 0x10, 0x11,
+  0x01, 0x11, 0x01, 0x99, 0x90, 0x99, 0x99, 0x10, 0x11, 0x12, 0x90, 0x09, 0x10, 0x01, 0x99, 0x99,
+  0x99, 0x09, 0x99, 0x99, 0x99, 0x99, 0x11, 0x11, 0x11, 0x00, 0x10, 0x00, 0x99, 0x09, 0x11, 0x13,
+  0x11, 0x90, 0x00, 0x99, 0x99, 0x09, 0x11, 0x01, 0x00, 0x99, 0x10, 0x21, 0x11, 0x00, 0x99, 0xa9,
+  0xa9, 0x09, 0x00, 0x00, 0x11, 0x21, 0x11, 0x01, 0x00, 0x90, 0x99, 0x9a, 0x9a, 0x10, 0x11, 0x11,
+  0x00, 0x99, 0x09, 0x11, 0x12, 0x01, 0xb9, 0x99, 0x99, 0x09, 0x00, 0x09, 0x11, 0x21, 0x11, 0x01,
+  0xfe, 0xff, 0x00, 0x00, 0x99, 0x19, 0x11, 0x11, 0x11, 0x11, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00,
+  0x11, 0x90, 0x99, 0x09, 0x10, 0x11, 0x01, 0x00, 0x90, 0x99, 0x19, 0x01, 0x90, 0x09, 0x00, 0x10,
+  0x00, 0x09, 0x11, 0x11, 0x00, 0x99, 0x09, 0x09, 0x10, 0x10, 0x01, 0x99, 0x99, 0x09, 0x11, 0x12,
+  0x90, 0x99, 0xab, 0x9a, 0x19, 0x11, 0x12, 0x11, 0x90, 0x99, 0x00, 0x10, 0x11, 0x00, 0x00, 0x11,
+  0x01, 0x99, 0x11, 0x11, 0x11, 0x91, 0x99, 0x09, 0xa9, 0x10, 0x11, 0x00, 0x00, 0x99, 0x10, 0x21,
+  0x11, 0x99, 0x99, 0x99, 0x09, 0x00, 0x11, 0x01, 0x09, 0x10, 0x01, 0x11, 0x01, 0x99, 0x99, 0x90,
+  0xa9, 0x99, 0x99, 0x09, 0x01, 0x11, 0x21, 0x91, 0x09, 0x90, 0x99, 0x19, 0x11, 0x90, 0x99, 0x09,
+  0x11, 0x12, 0x11, 0x00, 0x90, 0x99, 0x10, 0x91, 0x99, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11, 0x91,
+  0x99, 0x99, 0x9a, 0x10, 0x11, 0x90, 0x10, 0x01, 0x00, 0x90, 0x00, 0x00, 0x99, 0x99, 0x99, 0x09,
+  0x11, 0x11, 0x09, 0x10, 0x10, 0x11, 0x02, 0x00, 0x01, 0x99, 0x00, 0x99, 0x9b, 0x11, 0x11, 0x11,
+  0x01, 0x99, 0x10, 0x01, 0x00, 0x10, 0x91, 0xaa, 0x99, 0x11, 0x11, 0x11, 0x01, 0x11, 0x01, 0x09,
+  0x00, 0x00, 0x00, 0x90, 0x99, 0x10, 0x11, 0x10, 0x11, 0x90, 0x00, 0x00, 0x01, 0x90, 0x99, 0x09,
+  0x09, 0x10, 0x11, 0x90, 0xa9, 0x10, 0x00, 0x11, 0x92, 0xa9, 0x00, 0x09, 0x11, 0x11, 0x09, 0x10,
+  0x90, 0x99, 0x09, 0x00, 0x11, 0x11, 0x91, 0x00, 0x99, 0x00, 0x00, 0x10, 0x11, 0x11, 0x99, 0x99,
+  0x99, 0x09, 0x11, 0x11, 0x90, 0x09, 0x00, 0x00, 0x99, 0x11, 0x01, 0x01, 0x99, 0x09, 0x99, 0x99,
+  0x00, 0x11, 0x00, 0x09, 0x11, 0x02, 0x99, 0x99, 0x99, 0x10, 0x11, 0x10, 0x11, 0x99, 0x0a, 0x00,
+  0xfc, 0xff, 0x00, 0x00, 0x10, 0x11, 0x99, 0x99, 0x01, 0x09, 0x11, 0x01, 0x09, 0x00, 0x10, 0x01,
+  0x00, 0x01, 0x00, 0x90, 0x10, 0x11, 0x00, 0x10, 0x90, 0x99, 0x99, 0x10, 0x11, 0x00, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x00, 0x99, 0x10, 0x00, 0x09, 0x99, 0x11, 0x91, 0x09, 0x00, 0x09, 0x21,
+  0x91, 0x10, 0x91, 0x99, 0x99, 0x19, 0x11, 0x00, 0x09, 0x11, 0x01, 0x99, 0x11, 0x91, 0x09, 0x00,
+  0x99, 0x09, 0x11, 0x90, 0x99, 0x09, 0x10, 0x11, 0x99, 0x10, 0x91, 0x99, 0x01, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x99, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x00, 0x90, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x11, 0x11, 0x90, 0x99, 0x19, 0x00, 0x10, 0x00, 0x09,
+  0x99, 0x19, 0x01, 0x10, 0x11, 0x99, 0x19, 0x01, 0x09, 0x01, 0x09, 0x00, 0x10, 0x11, 0x11, 0x00,
+  0x00, 0x90, 0x99, 0x09, 0x10, 0x00, 0x90, 0x00, 0x99, 0x99, 0x11, 0x11, 0x11, 0x00, 0x10, 0x90,
+  0x99, 0x10, 0x01, 0x10, 0x90, 0x10, 0x90, 0x19, 0x11, 0x99, 0x00, 0x00, 0x10, 0x91, 0x99, 0x90,
+  0x10, 0x01, 0x99, 0x09, 0x01, 0x10, 0x11, 0x99, 0x99, 0x91, 0x90, 0x10, 0x91, 0x10, 0x90, 0x99,
+  0x11, 0x91, 0x09, 0x00, 0x90, 0x10, 0x01, 0x00, 0x90, 0x11, 0x00, 0x90, 0x00, 0x11, 0x00, 0x10,
+  0x90, 0x99, 0x00, 0x10, 0x90, 0x10, 0x11, 0x00, 0x90, 0x09, 0x00, 0x00, 0x11, 0x90, 0x99, 0x01,
+  0x00, 0x00, 0x11, 0x91, 0x99, 0x19, 0x11, 0x90, 0x00, 0x00, 0x11, 0x00, 0xa9, 0x19, 0x91, 0x19,
+  0x01, 0x09, 0x11, 0x90, 0x19, 0x11, 0x99, 0x11, 0x90, 0x99, 0x09, 0x01, 0x00, 0x10, 0x00, 0x99,
+  0x09, 0x01, 0x00, 0x00, 0x11, 0x91, 0x9a, 0x10, 0x90, 0x10, 0x11, 0x00, 0x90, 0x99, 0x11, 0x01,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x11, 0x09, 0x10, 0x00, 0x01, 0x99, 0x09, 0x00,
+  0x11, 0x90, 0x19, 0x11, 0x99, 0x11, 0x90, 0x00, 0x90, 0x0a, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00,
+  0x01, 0x99, 0x99, 0x00, 0x00, 0x11, 0x99, 0x09, 0x11, 0x01, 0x90, 0x99, 0x10, 0x01, 0x00, 0x00,
+  0x90, 0x19, 0x11, 0x99, 0x11, 0x00, 0x00, 0x91, 0x99, 0x10, 0x01, 0x00, 0x99, 0x10, 0x00, 0x11,
+  0x01, 0x99, 0x00, 0x99, 0x11, 0x00, 0x10, 0x90, 0x09, 0x10, 0x11, 0x09, 0x01, 0x99, 0x09, 0x00,
+  0x10, 0x01, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x19, 0x11, 0x90, 0x09, 0x90, 0x10, 0x01,
+  0x99, 0x19, 0x01, 0x00, 0x10, 0x99, 0x11, 0x99, 0x19, 0x01, 0x09, 0x11, 0x91, 0x10, 0x00, 0x90,
+  0x09, 0x11, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x99, 0x99, 0x11, 0x91,
+  0x10, 0x90, 0x09, 0x00, 0x00, 0x01, 0x90, 0x11, 0x90, 0x09, 0x19, 0x99, 0x10, 0x10, 0x00, 0x01,
+  0x00, 0x91, 0xa9, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x00, 0x10, 0x90, 0x10, 0x90, 0x00, 0x11,
+  0x00, 0x99, 0x99, 0x21, 0x90, 0x19, 0x91, 0x09, 0x01, 0x00, 0x01, 0x99, 0x10, 0x01, 0x90, 0x09,
+  0x11, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x01, 0x99, 0x10, 0x91, 0x99, 0x11, 0x99, 0x19, 0x91,
+  0x09, 0x11, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x99, 0x19, 0x11, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x11, 0x00, 0x11, 0x99, 0x09, 0x90, 0x09, 0x00, 0x10, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x90, 0x09, 0x11, 0x00, 0x11, 0x90, 0x0a, 0x11, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x10, 0x11, 0x01, 0x90, 0x09, 0x11, 0x90, 0x09,
+  0x90, 0x19, 0x11, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x90, 0x10, 0x90, 0x09, 0x01, 0x10, 0x90,
+  0x10, 0x01, 0x99, 0x11, 0x91, 0x99, 0x11, 0x00, 0x09, 0x10, 0x90, 0x19, 0x01, 0x00, 0x00, 0x99,
+  0x10, 0x90, 0x10, 0x01, 0x09, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x11, 0x01, 0x09, 0x90, 0x09, 0x10, 0x00, 0x01, 0x90, 0x09, 0x00, 0x90, 0x11,
+  0x90, 0x19, 0x11, 0x91, 0x19, 0x00, 0x09, 0x90, 0x00, 0x01, 0x10, 0x01, 0x99, 0x10, 0x90, 0x10,
+  0x11, 0x99, 0x00, 0x09, 0x99, 0x11, 0x01, 0x99, 0x11, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x90,
+  0x99, 0x11, 0x11, 0x00, 0x90, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x99, 0x19, 0x90, 0x10, 0x91,
+  0x09, 0x00, 0x00, 0x11, 0x90, 0x09, 0x00, 0x09, 0x11, 0x01, 0x99, 0x00, 0x09, 0x10, 0x00, 0x01,
+  0x99, 0x19, 0x11, 0x99, 0x11, 0x90, 0x19, 0x01, 0x99, 0x11, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00,
+  0x01, 0x09, 0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x00, 0x10, 0x90,
+  0x09, 0x11, 0x90, 0x10, 0x90, 0x09, 0x11, 0x90, 0x11, 0x90, 0x10, 0x90, 0x09, 0x01, 0x00, 0x01,
+  0x99, 0x10, 0x00, 0x10, 0x00, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01,
+  0x09, 0x01, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x10, 0x11, 0x19, 0x91, 0xa9, 0x10, 0x90,
+  0x19, 0x01, 0x10, 0x01, 0x09, 0x01, 0x99, 0x11, 0x91, 0x09, 0x91, 0x09, 0x00, 0x09, 0x11, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x00, 0x99, 0x00, 0x01, 0x00, 0x01, 0x99, 0x10, 0x01, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x11, 0x90, 0x11, 0x90, 0x09, 0x00, 0x10, 0x01,
+  0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x09, 0x11, 0x01, 0x90, 0x09, 0x00, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x11,
+  0x90, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x90, 0x00, 0x09, 0x10, 0x90, 0x00, 0x00, 0x09, 0x11, 0x99, 0x10, 0x00, 0x10, 0x91,
+  0x99, 0x01, 0x09, 0x11, 0x90, 0x10, 0x01, 0x90, 0x00, 0x00, 0x10, 0x01, 0x00, 0x99, 0x00, 0x09,
+  0x11, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x99, 0x19, 0x01, 0x00, 0x01, 0x90, 0x00, 0x90,
+  0x00, 0x10, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x90, 0x00, 0x11, 0x99, 0x10, 0x91, 0x09,
+  0x01, 0x99, 0x10, 0x00, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x09, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x09, 0x01, 0x09, 0x11, 0x90, 0x19, 0x01, 0x00, 0x00,
+  0x09, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x10, 0x00, 0x90, 0x09, 0x10, 0x00,
+  0x00, 0x01, 0x90, 0x09, 0x09, 0x10, 0x10, 0x01, 0x99, 0x09, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x90, 0x09, 0x01, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x11, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x09,
+  0x10, 0x90, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x90, 0x11, 0x90, 0x09, 0x01, 0x09, 0x11, 0x90,
+  0xff, 0xff, 0x00, 0x00, 0x11, 0x00, 0x10, 0x90, 0x99, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x11, 0x00, 0x00, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x09, 0x00, 0x90, 0x10, 0x01, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x10, 0x00,
+  0x09, 0x00, 0x09, 0x11, 0x01, 0x09, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x10, 0x90, 0x10, 0x11,
+  0x99, 0x00, 0x00, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x99,
+  0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x99, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x99, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00,
+  0x09, 0x10, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x01, 0x00, 0x90, 0x09, 0x00, 0x01, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09,
+  0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x90, 0x09, 0x00, 0x00, 0x10, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x01,
+  0x00, 0x90, 0x09, 0x00, 0x10, 0x01, 0x00, 0x90, 0x99, 0x00, 0x00, 0x10, 0x01, 0x00, 0x90, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x10, 0x00, 0x99,
+  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x11, 0x00, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x90, 0x00, 0x11, 0x10, 0x00, 0x99, 0x00, 0x90, 0x10, 0x01, 0x00, 0x00, 0x99, 0x10,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
+  0x90, 0x00, 0x90, 0x00, 0x11, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x11, 0x99,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90, 0x00, 0x90, 0x10, 0x01, 0x09,
+  0x00, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x99,
+  0x10, 0x00, 0x00, 0x01, 0x90, 0x09, 0x09, 0x10, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00,
+  0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x99, 0x19, 0x11, 0x00, 0x09, 0x10, 0x90, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x99, 0x00, 0x00, 0x10, 0x01, 0x00,
+  0x90, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x90, 0x09, 0x11, 0x00, 0x00, 0x00, 0x99, 0x09, 0x11, 0x01, 0x09, 0x00, 0x90,
+  0x09, 0x11, 0x01, 0x00, 0x09, 0x00, 0x90, 0x10, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x90, 0x09,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x09,
+  0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x01, 0x99, 0x19, 0x01, 0x09, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x01, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00,
+  0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x90, 0x09,
+  0x00, 0x00, 0x01, 0x11, 0x90, 0x99, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x90,
+  0x10, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x10, 0x01, 0x09, 0x01, 0x09, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x99, 0x10, 0x01, 0x09, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x90, 0x10, 0x01, 0x09, 0x11, 0x99, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90,
+  0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x11, 0x00, 0x99, 0x10, 0x00, 0x09, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x91, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x11, 0x01, 0x00, 0x90, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x90,
+  0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x11, 0x99, 0x19, 0x01, 0x99,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x01, 0x90,
+  0x99, 0x10, 0x00, 0x10, 0x00, 0x99, 0x10, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x01,
+  0x09, 0x10, 0x90, 0x10, 0x01, 0x90, 0x09, 0x00, 0x00, 0x11, 0x90, 0x09, 0x00, 0x00, 0x00, 0x11,
+  0x91, 0x09, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x01, 0x90, 0x00, 0x00,
+  0x09, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x09, 0x11, 0x01, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x99, 0x10, 0x00, 0x00, 0x11, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+  0x99, 0x10, 0x01, 0x00, 0x00, 0x00, 0x99, 0x10, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x10, 0x91, 0x99, 0x10, 0x00, 0x00, 0x11, 0x99, 0x00,
+  0x90, 0x10, 0x01, 0x01, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x00, 0x09, 0x09, 0x10, 0x01, 0x09,
+  0x01, 0x09, 0x00, 0x00, 0x90, 0x00, 0x11, 0x90, 0x00, 0x01, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x10, 0x01,
+  0x09, 0x10, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00, 0x10, 0x00, 0x99, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x90, 0x10, 0x00, 0x10, 0x90, 0x09, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00,
+  0x90, 0x10, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00, 0x90, 0x10, 0x01, 0x09, 0x00, 0x90, 0x00, 0x11,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x11, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x01, 0x09, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x11, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x90, 0x99, 0x10, 0x01, 0x10, 0x00, 0x90,
+  0x09, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x90, 0x09, 0x01, 0x09, 0x11, 0x90, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x10, 0x01, 0x09, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x01, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x99,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x09, 0x10, 0x10, 0x01, 0x99, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x11, 0x91, 0x00, 0x90,
+  0x09, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x01, 0x90, 0x00, 0x90, 0x00, 0x10, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x01, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x01, 0x90, 0x00, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x90, 0x10, 0x90, 0x09, 0x11, 0x00, 0x90, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x90, 0x00, 0x01, 0x90, 0x10, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x09, 0x00, 0x01, 0x90,
+  0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x11, 0x00, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00,
+  0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01,
+  0x09, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x90, 0x10, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10,
+  0x00, 0x09, 0x01, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x01,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01,
+  0x09, 0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x99, 0x10, 0x90,
+  0x10, 0x00, 0x01, 0x90, 0x09, 0x00, 0x10, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90,
+  0x09, 0x00, 0x00, 0x10, 0x01, 0x90, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x90, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x99, 0x00,
+  0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x10, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09,
+  0x00, 0x11, 0x00, 0x00, 0x09, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x09, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x90, 0x10, 0x90,
+  0x00, 0x01, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09,
+  0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90,
+  0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x99,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x01, 0x99, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x01, 0x09, 0x10, 0x90, 0x10, 0x90, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x09, 0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90,
+  0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x01, 0x00, 0x90,
+  0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x99, 0x11, 0x90, 0x10, 0x00,
+  0x90, 0x09, 0x11, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x01,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x09, 0x11,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x99, 0x10, 0x90, 0x00, 0x10, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x11, 0x91, 0x09, 0x00, 0x09, 0x10, 0x90, 0x11,
+  0x91, 0x99, 0x00, 0x90, 0x09, 0x11, 0x91, 0x10, 0x90, 0x00, 0x00, 0x09, 0x11, 0x90, 0x01, 0x99,
+  0x10, 0x00, 0x10, 0x91, 0x99, 0x11, 0x90, 0x10, 0x01, 0x90, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x90, 0x19, 0x01, 0x99, 0x11, 0x90, 0x19, 0x01, 0x09, 0x00,
+  0x09, 0x11, 0x90, 0x11, 0x90, 0x99, 0x11, 0x91, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x90, 0x19, 0x11, 0x99, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x09, 0x00, 0x09, 0x00, 0x11, 0x90, 0x09, 0x01, 0x00,
+  0x01, 0x99, 0x10, 0x01, 0x09, 0x00, 0x09, 0x01, 0x09, 0x01, 0x90, 0x09, 0x01, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x90, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90,
+  0x10, 0x90, 0x09, 0x11, 0x99, 0x11, 0x90, 0x10, 0x91, 0x09, 0x01, 0x19, 0x01, 0x99, 0x11, 0x90,
+  0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x19, 0x11, 0x99, 0x10, 0x91,
+  0x99, 0x11, 0x90, 0x10, 0x01, 0x99, 0x00, 0x09, 0x11, 0x90, 0x00, 0x11, 0x99, 0x09, 0x11, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x99, 0x00, 0x10, 0x00, 0x10, 0x90, 0x09, 0x11, 0x99, 0x10,
+  0x00, 0x10, 0x90, 0x09, 0x11, 0x91, 0x09, 0x01, 0x09, 0x10, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x10, 0x01, 0x09, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x10, 0x00, 0x99, 0x10, 0x91, 0x09, 0x00, 0x10, 0x00, 0x09, 0x10, 0x01, 0x09, 0x00,
+  0x00, 0x09, 0x10, 0x01, 0x99, 0x00, 0x10, 0x90, 0x09, 0x11, 0x90, 0x10, 0x01, 0x99, 0x00, 0x01,
+  0x90, 0x19, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0x10, 0x90, 0x10, 0x90,
+  0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x90, 0x09, 0x91, 0x09, 0x11, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x99, 0x11, 0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x19, 0x11, 0x99, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x09, 0x11, 0x00, 0x09, 0x00, 0x10, 0x01, 0x99, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x11, 0x99, 0x09, 0x00, 0x00, 0x11, 0x90, 0x99, 0x01,
+  0x90, 0x11, 0x01, 0x09, 0x01, 0x99, 0x19, 0x01, 0x00, 0x01, 0x90, 0x09, 0x00, 0x09, 0x11, 0x90,
+  0x10, 0x90, 0x10, 0x91, 0x09, 0x11, 0x99, 0x10, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x10, 0x90, 0x19, 0x01, 0x09, 0x01, 0x99, 0x19, 0x01, 0x00, 0x01, 0x99, 0x10, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x90,
+  0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x90, 0x09, 0x11, 0x91, 0x99, 0x10, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00,
+  0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x01, 0x90,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x09, 0x00,
+  0x09, 0x11, 0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x09, 0x10, 0x01, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x11, 0x99, 0x19, 0x01, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x09, 0x11, 0x99, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x90, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x10, 0x00, 0x09, 0x01, 0x09, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90,
+  0x09, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x09, 0x01, 0x09, 0x01, 0x00, 0x00, 0x90,
+  0x19, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x11, 0x99, 0x09, 0x00, 0x00, 0x10, 0x11, 0x99,
+  0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x10, 0x00, 0x09,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x01, 0x90,
+  0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01,
+  0x99, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x10, 0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x11, 0x01, 0x99, 0x09, 0x00, 0x00, 0x11, 0x00, 0x09, 0x01,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x00, 0x99, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x10, 0x01, 0x00, 0x00, 0x99, 0x00, 0x01,
+  0x00, 0x10, 0x90, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x10, 0x90, 0x09, 0x11,
+  0x90, 0x00, 0x01, 0x99, 0x10, 0x01, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x09,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x00, 0x00, 0x99, 0x10, 0x11,
+  0x99, 0x10, 0x91, 0x09, 0x01, 0x09, 0x10, 0x00, 0x10, 0x90, 0x09, 0x01, 0x09, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x10, 0x00, 0x10, 0x00, 0x99, 0x00, 0x01, 0x90, 0x10,
+  0x01, 0x99, 0x10, 0x91, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09, 0x01, 0x00, 0x11,
+  0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x01, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x99, 0x10, 0x91, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x01, 0x09,
+  0x00, 0x90, 0x10, 0x01, 0x90, 0x90, 0x00, 0x01, 0x90, 0x00, 0x90, 0x10, 0x11, 0x99, 0x10, 0x90,
+  0xfe, 0xff, 0x00, 0x00, 0x10, 0x01, 0x09, 0x11, 0x90, 0x09, 0x09, 0x10, 0x01, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x10, 0x90, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x90, 0x09, 0x01, 0x00, 0x01,
+  0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x11, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x01, 0x99, 0x10, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0x09, 0x10, 0x11, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x91, 0x99, 0x10,
+  0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01, 0x90, 0x09, 0x10, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10,
+  0x90, 0x00, 0x01, 0x09, 0x01, 0x99, 0x10, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01,
+  0x90, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x09, 0x11, 0x90, 0x00, 0x00, 0x00, 0x01, 0x09,
+  0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x00, 0x10, 0x01, 0x00, 0x09,
+  0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x09, 0x01, 0x09, 0x11, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x90, 0x00,
+  0x11, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x10, 0x01, 0x09, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x90, 0x00, 0x11, 0x99, 0x10, 0x91, 0x99, 0x11, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x11, 0x90, 0x00, 0x90, 0x10, 0x01, 0x99, 0x11, 0x90, 0x99, 0x11, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x99, 0x11, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x90, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x01, 0x00, 0x90, 0x09, 0x00, 0x01, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x09, 0x00, 0x01, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x01, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x01, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x10, 0x00, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x00,
+  0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x90, 0x09, 0x00, 0x09, 0x11, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x11, 0x00, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x09, 0x10,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x09, 0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x90, 0x10, 0x01, 0x09,
+  0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x99, 0x10, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10,
+  0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x11, 0x90,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x00, 0x99, 0x00, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x01, 0x00, 0x00, 0x90, 0x10,
+  0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x11, 0x00, 0x01,
+  0x90, 0x99, 0x00, 0x10, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10,
+  0x01, 0x99, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x11, 0x90, 0x09, 0x01, 0x00, 0x01, 0x90, 0x10,
+  0x91, 0x99, 0x11, 0x90, 0x10, 0x91, 0x09, 0x01, 0x90, 0x10, 0x01, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09,
+  0x11, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x01, 0x00, 0x10, 0x90, 0x09, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x09, 0x10, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x90, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x11, 0x90, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x90, 0x19, 0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x99, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x01, 0x09, 0x11,
+  0x90, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x90, 0x00, 0x01, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x99, 0x11, 0x01, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x09, 0x00, 0x90,
+  0x11, 0x91, 0x09, 0x11, 0x99, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x10, 0x00, 0x99, 0x00,
+  0x11, 0x00, 0x90, 0x00, 0x99, 0x00, 0x11, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x90, 0x09, 0x00,
+  0x09, 0x11, 0x90, 0x10, 0x90, 0x09, 0x11, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x10, 0x00, 0x09, 0x11, 0x99, 0x19, 0x00, 0x09, 0x01, 0x00, 0x00, 0x90, 0x10,
+  0x90, 0x10, 0x11, 0x99, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10,
+  0x90, 0x00, 0x01, 0x99, 0x11, 0x90, 0x00, 0x01, 0x09, 0x11, 0x99, 0x10, 0x01, 0x09, 0x10, 0x90,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x10, 0x01, 0x99, 0x11, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x90, 0x10, 0x01, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x10,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x09, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00, 0x01,
+  0x00, 0x99, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x09, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x90, 0x09,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x90, 0x09, 0x10, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x01, 0x90, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x09, 0x10,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x99, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x10, 0x00, 0x99, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x09, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x10, 0x01, 0x00, 0x09,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x90, 0x10, 0x01, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00,
+  0x00, 0x00, 0x99, 0x10, 0x00, 0x00, 0x01, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10,
+  0x01, 0x00, 0x00, 0x90, 0x09, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x00, 0x10, 0x01, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x01, 0x99, 0x00, 0x90, 0x10, 0x01, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00,
+  0x00, 0x01, 0x09, 0x00, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x10, 0x01, 0x00, 0x01, 0x99,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x00, 0x01,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0x99, 0x90, 0x00, 0x00,
+  0x00, 0x11, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x09, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x00,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x00,
+  0x10, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x99, 0x00, 0x90, 0x10, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x90, 0x09, 0x90,
+  0x00, 0x01, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x01, 0x00, 0x01, 0x99, 0x00, 0x90, 0x10,
+  0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x99, 0x00,
+  0x11, 0x00, 0x01, 0x90, 0x00, 0x99, 0x09, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x90, 0x09,
+  0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x09, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x10, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x99, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x10, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0xfe, 0xff, 0x00, 0x00, 0x10, 0x01, 0x00, 0x09, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x09, 0x00,
+  0x90, 0x00, 0x10, 0x01, 0x00, 0x00, 0x90, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x90, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x09, 0x10, 0x01, 0x00, 0x09, 0x00, 0x09, 0x10, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x09, 0x01, 0x09,
+  0x10, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x90, 0x09, 0x10, 0x01, 0x00, 0x00, 0x99, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0x09, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x90, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x10, 0x90, 0x09, 0x01, 0x00, 0x00,
+  0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x99, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x09, 0x00, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x99, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x90, 0x00, 0x01, 0x99, 0x10, 0x00, 0x00,
+  0x01, 0x00, 0x99, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x09,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x11, 0x00, 0x10, 0x90, 0x09, 0x00, 0x00,
+  0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x00, 0x10, 0x00, 0x99, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00,
+  0x09, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x10, 0x90, 0x10, 0x01,
+  0xff, 0xff, 0x00, 0x00, 0x19, 0x01, 0x99, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10,
+  0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x90, 0x99, 0x10, 0x00, 0x10,
+  0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x90, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x01, 0x90, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00,
+  0x01, 0x09, 0x10, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x90, 0x09, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x90, 0x09, 0x11, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x09, 0x01, 0x90, 0x10, 0x00,
+  0x00, 0x90, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+  0x01, 0x90, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x90, 0x00, 0x01, 0x09, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x99, 0x00, 0x11, 0x90, 0x10, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x11, 0x00, 0x99, 0x00, 0x09, 0x10, 0x00, 0x10, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x90,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x11, 0x00, 0x00, 0x90,
+  0x00, 0x90, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x10, 0x90, 0x00, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00,
+  0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x10, 0x00, 0x09, 0x00, 0x09, 0x10, 0x00, 0x00, 0x01, 0x90, 0x00, 0x90, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x90, 0x00, 0x01, 0x90, 0x00, 0x00, 0x09, 0x10, 0x00, 0x09, 0x00, 0x00, 0x01, 0x11,
+  0x00, 0x99, 0x00, 0x99, 0x10, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x90, 0x00, 0x00, 0x09,
+  0x00, 0x90, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x90,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x10, 0x00, 0x90, 0x09, 0x00,
+  0x01, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00,
+  0x01, 0x00, 0x10, 0x00, 0x90, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x00, 0x09, 0x10, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x10, 0x00, 0x10, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x90, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00, 0x10, 0x00,
+  0x10, 0x00, 0x09, 0x00, 0x09, 0x00, 0x11, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };